@@ -204,6 +204,11 @@ object NativeLibrary {
      */
     external fun getShadersBuilding(): Int
 
+    /**
+     * Returns the current and peak host memory held by each emulator subsystem
+     */
+    external fun getMemoryAccounting(): String
+
     /**
      * Returns the current CPU backend.
      */
@@ -646,6 +651,11 @@ object NativeLibrary {
      */
     external fun updatePowerState(percentage: Int, isCharging: Boolean, hasBattery: Boolean)
 
+    /**
+     * Passes the thermal headroom forecast to the thermal governor, NaN when it isn't known
+     */
+    external fun updateThermalHeadroom(headroom: Float)
+
     /**
      * Profile manager native calls
      */
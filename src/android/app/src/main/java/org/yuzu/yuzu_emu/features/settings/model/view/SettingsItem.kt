@@ -646,6 +646,13 @@ abstract class SettingsItem(
                     descriptionId = R.string.renderer_force_max_clock_description
                 )
             )
+            put(
+                SwitchSetting(
+                    BooleanSetting.THERMAL_GOVERNOR,
+                    titleId = R.string.thermal_governor,
+                    descriptionId = R.string.thermal_governor_description
+                )
+            )
             put(
                 SwitchSetting(
                     BooleanSetting.RENDERER_ASYNCHRONOUS_GPU_EMULATION,
@@ -1527,6 +1527,10 @@ class EmulationFragment : Fragment(), SurfaceHolder.Callback {
                         val appRamUsage =
                             File("/proc/self/statm").readLines()[0].split(' ')[1].toLong() * 4096 / 1000000
                         sb.append(getString(R.string.process_ram, appRamUsage))
+                        val memoryAccounting = NativeLibrary.getMemoryAccounting()
+                        if (memoryAccounting.isNotEmpty()) {
+                            sb.append(" ($memoryAccounting)")
+                        }
                     }
 
                     if (BooleanSetting.SHOW_SYSTEM_RAM_USAGE.getBoolean(needsGlobal)) {
@@ -13,6 +13,10 @@ object PowerStateUpdater {
     private lateinit var handler: Handler
     private lateinit var runnable: Runnable
     private const val UPDATE_INTERVAL_MS = 1000L
+
+    // The headroom can't be queried more than once per second
+    private const val THERMAL_UPDATE_TICKS = 2
+    private var ticks = 0
     private var isStarted = false
 
     fun start() {
@@ -26,6 +30,10 @@ object PowerStateUpdater {
         runnable = Runnable {
             val info = PowerStateUtils.getBatteryInfo(context)
             NativeLibrary.updatePowerState(info[0], info[1] == 1, info[2] == 1)
+            if (++ticks >= THERMAL_UPDATE_TICKS) {
+                ticks = 0
+                NativeLibrary.updateThermalHeadroom(PowerStateUtils.getThermalHeadroom(context))
+            }
             handler.postDelayed(runnable, UPDATE_INTERVAL_MS)
         }
         handler.post(runnable)
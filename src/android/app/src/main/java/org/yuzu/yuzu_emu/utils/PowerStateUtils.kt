@@ -8,6 +8,7 @@ import android.content.Intent
 import android.content.IntentFilter
 import android.os.BatteryManager
 import android.os.Build
+import android.os.PowerManager
 
 object PowerStateUtils {
 
@@ -41,4 +42,19 @@ object PowerStateUtils {
 
         return results
     }
+
+    /**
+     * Forecast of the thermal headroom in 10 seconds, where 1.0 means severe throttling.
+     * Returns NaN when the device doesn't provide one or was asked too recently.
+     */
+    @JvmStatic
+    fun getThermalHeadroom(context: Context?): Float {
+        if (context == null || Build.VERSION.SDK_INT < Build.VERSION_CODES.R) {
+            return Float.NaN
+        }
+        val pm = context.getSystemService(Context.POWER_SERVICE) as PowerManager?
+        return pm?.getThermalHeadroom(THERMAL_FORECAST_SECONDS) ?: Float.NaN
+    }
+
+    private const val THERMAL_FORECAST_SECONDS = 10
 }
@@ -152,6 +152,9 @@ namespace AndroidSettings {
                                  Settings::Specialization::Default,
                                  true,
                                  true};
+        /// Caps the frame rate ahead of thermal throttling, see ThermalGovernor
+        Settings::Setting<bool> thermal_governor{linkage, false, "thermal_governor",
+                                                 Settings::Category::Android};
 
 
         Settings::Setting<bool> show_input_overlay{linkage, true, "show_input_overlay",
@@ -46,6 +46,7 @@ extern "C" {
 #include "common/dynamic_library.h"
 #include "common/fs/path_util.h"
 #include "common/logging.h"
+#include "common/memory_accounting.h"
 #include "common/scm_rev.h"
 #include "common/scope_exit.h"
 #include "common/settings.h"
@@ -344,6 +345,7 @@ void EmulationSession::ShutdownEmulation() {
     }
 
     m_is_running = false;
+    m_thermal_governor.Reset();
 
     // Unload user input.
     m_system.HIDCore().UnloadInputDevices();
@@ -365,6 +367,12 @@ void EmulationSession::ShutdownEmulation() {
     m_window.reset();
 }
 
+void EmulationSession::UpdateThermalHeadroom(float headroom) {
+    if (IsRunning()) {
+        m_thermal_governor.Update(headroom);
+    }
+}
+
 void EmulationSession::PauseEmulation() {
     std::scoped_lock lock(m_mutex);
     m_system.Pause();
@@ -957,6 +965,24 @@ jint Java_org_yuzu_yuzu_1emu_NativeLibrary_getShadersBuilding(JNIEnv* env, jclas
     return j_shaders;
 }
 
+jstring Java_org_yuzu_yuzu_1emu_NativeLibrary_getMemoryAccounting(JNIEnv* env, jclass clazz) {
+    using namespace Common::MemoryAccounting;
+    std::string summary;
+    for (u32 index = 0; index < static_cast<u32>(Tag::Count); ++index) {
+        const Tag tag = static_cast<Tag>(index);
+        const Usage usage = GetUsage(tag);
+        if (usage.peak == 0) {
+            continue;
+        }
+        if (!summary.empty()) {
+            summary += ", ";
+        }
+        // Current and peak usage
+        summary += fmt::format("{} {}/{} MB", GetName(tag), usage.current >> 20, usage.peak >> 20);
+    }
+    return Common::Android::ToJString(env, summary);
+}
+
 jstring Java_org_yuzu_yuzu_1emu_NativeLibrary_getCpuBackend(JNIEnv* env, jclass clazz) {
     if (Settings::IsNceEnabled()) {
         return Common::Android::ToJString(env, "NCE");
@@ -1685,6 +1711,13 @@ JNIEXPORT void JNICALL Java_org_yuzu_yuzu_1emu_NativeLibrary_updatePowerState(
     g_has_battery.store(hasBattery, std::memory_order_relaxed);
 }
 
+JNIEXPORT void JNICALL Java_org_yuzu_yuzu_1emu_NativeLibrary_updateThermalHeadroom(
+        JNIEnv* env,
+        jobject,
+        jfloat headroom) {
+    EmulationSession::GetInstance().UpdateThermalHeadroom(headroom);
+}
+
 JNIEXPORT jboolean JNICALL Java_org_yuzu_yuzu_1emu_NativeLibrary_isUpdateCheckerEnabled(
         JNIEnv* env,
         jobject obj) {
@@ -12,6 +12,7 @@
 #include "core/perf_stats.h"
 #include "frontend_common/content_manager.h"
 #include "jni/emu_window/emu_window.h"
+#include "jni/thermal_governor.h"
 #include "video_core/rasterizer_interface.h"
 
 #pragma once
@@ -44,6 +45,7 @@ public:
     void HaltEmulation();
     void RunEmulation();
     void ShutdownEmulation();
+    void UpdateThermalHeadroom(float headroom);
 
     const Core::PerfStatsResults& PerfStats();
     int ShadersBuilding();
@@ -93,4 +95,6 @@ private:
 
     // Program index for next boot
     std::atomic<s32> m_next_program_index = -1;
+
+    ThermalGovernor m_thermal_governor;
 };
@@ -0,0 +1,54 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <cmath>
+
+#include "common/logging.h"
+#include "common/settings.h"
+#include "jni/android_settings.h"
+#include "jni/thermal_governor.h"
+
+namespace {
+
+/// Headroom at which the frame rate is capped, ahead of the severe throttling at 1.0
+constexpr float ThrottleHeadroom = 0.85f;
+/// Headroom at which the configured target comes back, below the cap for hysteresis
+constexpr float RestoreHeadroom = 0.7f;
+
+constexpr Settings::FramePacingMode ThrottledMode = Settings::FramePacingMode::Target_30;
+
+} // Anonymous namespace
+
+void ThermalGovernor::Update(float headroom) {
+    if (std::isnan(headroom) || headroom < 0.0f) {
+        // The forecast is only refreshed once a second, and not every device provides one
+        return;
+    }
+    std::scoped_lock lock{mutex};
+    if (!AndroidSettings::values.thermal_governor.GetValue()) {
+        if (saved_mode) {
+            Settings::values.frame_pacing_mode.SetValue(*saved_mode);
+            saved_mode.reset();
+        }
+        return;
+    }
+    auto& frame_pacing_mode = Settings::values.frame_pacing_mode;
+    if (!saved_mode && headroom >= ThrottleHeadroom &&
+        frame_pacing_mode.GetValue() != ThrottledMode) {
+        LOG_INFO(Frontend, "Thermal headroom at {:.2f}, capping the frame rate", headroom);
+        saved_mode = frame_pacing_mode.GetValue();
+        frame_pacing_mode.SetValue(ThrottledMode);
+    } else if (saved_mode && headroom <= RestoreHeadroom) {
+        LOG_INFO(Frontend, "Thermal headroom at {:.2f}, restoring the frame rate", headroom);
+        frame_pacing_mode.SetValue(*saved_mode);
+        saved_mode.reset();
+    }
+}
+
+void ThermalGovernor::Reset() {
+    std::scoped_lock lock{mutex};
+    if (saved_mode) {
+        Settings::values.frame_pacing_mode.SetValue(*saved_mode);
+        saved_mode.reset();
+    }
+}
@@ -0,0 +1,28 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <mutex>
+#include <optional>
+
+#include "common/settings_enums.h"
+
+/**
+ * Lowers the frame pacing target while the device comes close to thermal throttling, and brings
+ * back the configured target once it has cooled down. Capping the frame rate early costs less than
+ * letting the driver throttle the clocks, which makes the frame pacing collapse.
+ */
+class ThermalGovernor {
+public:
+    /// Reacts to a new thermal headroom forecast, where 1.0 means severe throttling
+    void Update(float headroom);
+
+    /// Restores the configured frame pacing target
+    void Reset();
+
+private:
+    std::mutex mutex;
+    /// Configured target while the governor has lowered it
+    std::optional<Settings::FramePacingMode> saved_mode;
+};
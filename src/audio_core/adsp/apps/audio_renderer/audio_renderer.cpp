@@ -4,8 +4,10 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <array>
 #include <chrono>
+#include <string>
 
 #include "audio_core/adsp/apps/audio_renderer/audio_renderer.h"
 #include "audio_core/audio_core.h"
@@ -13,6 +15,7 @@
 #include "audio_core/sink/sink.h"
 #include "common/logging.h"
 #include "common/thread.h"
+#include "common/trace.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 
@@ -30,6 +33,13 @@ void AudioRenderer::Start() {
 
     mailbox.Initialize(AppMailboxId::AudioRenderer);
 
+    // Leave most of the host to the guest cores and the GPU, a few voice workers are enough.
+    const auto num_voice_workers{(std::min)(std::thread::hardware_concurrency() / 2, 3U)};
+    if (num_voice_workers > 0) {
+        voice_workers = std::make_unique<Common::ThreadWorker>(num_voice_workers,
+                                                               "DSP_AudioRenderer_Voice");
+    }
+
     main_thread = std::jthread([this](std::stop_token stop_token) { Main(stop_token); });
 
     mailbox.Send(Direction::DSP, Message::InitializeOK);
@@ -53,6 +63,7 @@ void AudioRenderer::Stop() {
     }
     main_thread.request_stop();
     main_thread.join();
+    voice_workers.reset();
 
     for (auto& stream : streams) {
         if (stream) {
@@ -119,6 +130,35 @@ u64 AudioRenderer::GetRenderingStartTick(s32 session_id) const noexcept {
     return (1000 * command_buffers[session_id].render_time_taken_us) + signalled_tick;
 }
 
+HostMetricsResults AudioRenderer::GetAndResetHostMetrics() {
+    const auto results{host_metrics.GetAndReset()};
+    if (results.frames.count == 0) {
+        return results;
+    }
+
+    // The per command breakdown is too long for the status bar, leave it to the log.
+    const auto to_us = [](std::chrono::nanoseconds time) {
+        return std::chrono::duration<f64, std::micro>(time).count();
+    };
+    std::string breakdown{};
+    for (size_t i = 0; i < results.commands.size(); i++) {
+        const auto& command{results.commands[i]};
+        if (command.count > 0) {
+            breakdown += fmt::format("\n\t{}: {} commands, {:.2f} us average, {:.2f} us max",
+                                     GetCommandName(static_cast<Renderer::CommandId>(i)),
+                                     command.count, to_us(command.Average()),
+                                     to_us(command.max));
+        }
+    }
+    LOG_DEBUG(Audio_DSP,
+              "{} frames, {:.2f} us average, {:.2f} us max. {} voices, {:.2f} us average, "
+              "{:.2f} us max. {} underruns, {} buffers queued{}",
+              results.frames.count, to_us(results.frames.Average()), to_us(results.frames.max),
+              results.voices.count, to_us(results.voices.Average()), to_us(results.voices.max),
+              results.underruns, results.queue_depth, breakdown);
+    return results;
+}
+
 void AudioRenderer::CreateSinkStreams() {
     u32 channels{sink.GetDeviceChannels()};
     for (u32 i = 0; i < MaxRendererSessions; i++) {
@@ -131,7 +171,7 @@ void AudioRenderer::CreateSinkStreams() {
 
 void AudioRenderer::Main(std::stop_token stop_token) {
     Common::SetCurrentThreadName("DSP_AudioRenderer_Main");
-    Common::SetCurrentThreadPriority(Common::ThreadPriority::High);
+    Common::SetCurrentThreadRole(Common::ThreadRole::Audio);
 
     // TODO: Create buffer map/unmap thread + mailbox
     // TODO: Create gMix devices, initialize them here
@@ -162,6 +202,7 @@ void AudioRenderer::Main(std::stop_token stop_token) {
             std::array<bool, MaxRendererSessions> buffers_reset{};
             std::array<u64, MaxRendererSessions> render_times_taken{};
             const auto start_time{system.CoreTiming().GetGlobalTimeUs().count()};
+            std::chrono::nanoseconds frame_time{};
 
             for (u32 index = 0; index < MaxRendererSessions; index++) {
                 auto& command_buffer{command_buffers[index]};
@@ -174,7 +215,8 @@ void AudioRenderer::Main(std::stop_token stop_token) {
                     if (command_buffer.remaining_command_count == 0) {
                         command_list_processor.Initialize(system, *command_buffer.process,
                             command_buffer.buffer,
-                            command_buffer.size, streams[index]);
+                            command_buffer.size, streams[index], voice_workers.get(),
+                            &host_metrics);
                     }
 
                     if (command_buffer.reset_buffer && !buffers_reset[index]) {
@@ -200,8 +242,12 @@ void AudioRenderer::Main(std::stop_token stop_token) {
 
                     // Process the command list
                     {
+                        const auto process_begin{Common::Trace::Now()};
                         render_times_taken[index] =
                             command_list_processor.Process(index) - start_time;
+                        const auto process_end{Common::Trace::Now()};
+                        Common::Trace::AddEvent("Audio render", process_begin, process_end);
+                        frame_time += std::chrono::nanoseconds{process_end - process_begin};
                     }
 
                     const auto end_time{system.CoreTiming().GetGlobalTimeUs().count()};
@@ -211,6 +257,11 @@ void AudioRenderer::Main(std::stop_token stop_token) {
                     command_buffer.render_time_taken_us = end_time - start_time;
                 }
             }
+            if (command_buffers[0].buffer != 0) {
+                host_metrics.AddFrameTime(frame_time);
+                host_metrics.UpdateSinkState(streams[0]->GetQueueSize(),
+                                             streams[0]->GetAndResetUnderrunCount());
+            }
             mailbox.Send(Direction::Host, Message::RenderResponse);
         } break;
         default:
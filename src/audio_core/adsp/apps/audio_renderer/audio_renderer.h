@@ -12,10 +12,12 @@
 
 #include "audio_core/adsp/apps/audio_renderer/command_buffer.h"
 #include "audio_core/adsp/apps/audio_renderer/command_list_processor.h"
+#include "audio_core/adsp/apps/audio_renderer/host_metrics.h"
 #include "audio_core/adsp/mailbox.h"
 #include "common/common_types.h"
 #include "common/polyfill_thread.h"
 #include "common/thread.h"
+#include "common/thread_worker.h"
 
 namespace Core {
 class System;
@@ -81,6 +83,13 @@ public:
     void ClearRemainCommandCount(s32 session_id) noexcept;
     u64 GetRenderingStartTick(s32 session_id) const noexcept;
 
+    /**
+     * Get the host timings and sink state gathered since the last call, and reset them.
+     *
+     * @return The gathered metrics.
+     */
+    HostMetricsResults GetAndResetHostMetrics();
+
 private:
     /**
      * Main AudioRenderer thread, responsible for processing the command lists.
@@ -102,6 +111,8 @@ private:
     Mailbox mailbox;
     /// Main thread
     std::jthread main_thread{};
+    /// Workers helping the main thread with the voice commands
+    std::unique_ptr<Common::ThreadWorker> voice_workers{};
     /// The current state
     std::atomic<bool> running{};
     /// Shared memory of input command buffers, set by host, read by DSP
@@ -112,6 +123,8 @@ private:
     std::array<Sink::SinkStream*, MaxRendererSessions> streams{};
     /// CPU Tick when the DSP was signalled to process, uses time rather than tick
     u64 signalled_tick{0};
+    /// Host timings of the rendering
+    HostMetrics host_metrics{};
 };
 
 } // namespace ADSP::AudioRenderer
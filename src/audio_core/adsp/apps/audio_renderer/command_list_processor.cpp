@@ -1,12 +1,15 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <optional>
 #include <string>
 
 #include "audio_core/adsp/apps/audio_renderer/command_list_processor.h"
 #include "audio_core/renderer/command/command_list_header.h"
 #include "audio_core/renderer/command/commands.h"
 #include "common/settings.h"
+#include "common/trace.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 #include "core/hle/kernel/k_process.h"
@@ -14,8 +17,35 @@
 
 namespace AudioCore::ADSP::AudioRenderer {
 
+namespace {
+/// Fewer voices than this are not worth waking the workers for
+constexpr size_t MinParallelVoices = 8;
+
+bool IsVoiceCommand(Renderer::CommandId type) {
+    switch (type) {
+    case Renderer::CommandId::DataSourcePcmInt16Version1:
+    case Renderer::CommandId::DataSourcePcmInt16Version2:
+    case Renderer::CommandId::DataSourcePcmFloatVersion1:
+    case Renderer::CommandId::DataSourcePcmFloatVersion2:
+    case Renderer::CommandId::DataSourceAdpcmVersion1:
+    case Renderer::CommandId::DataSourceAdpcmVersion2:
+    case Renderer::CommandId::VolumeRamp:
+    case Renderer::CommandId::BiquadFilter:
+    case Renderer::CommandId::MultiTapBiquadFilter:
+    case Renderer::CommandId::MixRamp:
+    case Renderer::CommandId::MixRampGrouped:
+    case Renderer::CommandId::DepopPrepare:
+        return true;
+    default:
+        return false;
+    }
+}
+} // Anonymous namespace
+
 void CommandListProcessor::Initialize(Core::System& system_, Kernel::KProcess& process,
-                                      CpuAddr buffer, u64 size, Sink::SinkStream* stream_) {
+                                      CpuAddr buffer, u64 size, Sink::SinkStream* stream_,
+                                      Common::ThreadWorker* voice_workers_,
+                                      HostMetrics* host_metrics_) {
     system = &system_;
     memory = &process.GetMemory();
     stream = stream_;
@@ -28,6 +58,8 @@ void CommandListProcessor::Initialize(Core::System& system_, Kernel::KProcess& p
     mix_buffers = header->samples_buffer;
     buffer_count = header->buffer_count;
     processed_command_count = 0;
+    voice_workers = voice_workers_;
+    host_metrics = host_metrics_;
 }
 
 void CommandListProcessor::SetProcessTimeMax(const u64 time) {
@@ -55,7 +87,24 @@ u64 CommandListProcessor::Process(u32 session_id) {
 
     std::string dump{fmt::format("\nSession {}\n", session_id)};
 
+    // Time of the voice whose commands are being processed, when they are not spread out
+    std::optional<u32> voice_node_id{};
+    std::chrono::nanoseconds voice_time{};
+    const auto end_voice = [&] {
+        if (voice_node_id && host_metrics) {
+            host_metrics->AddVoiceTime(voice_time);
+        }
+        voice_node_id.reset();
+        voice_time = {};
+    };
+
     for (u32 index = 0; index < command_count; index++) {
+        if (index == header->voice_command_start && !Settings::values.dump_audio_commands &&
+            ProcessVoiceCommands()) {
+            index += header->voice_command_count - 1;
+            continue;
+        }
+
         auto& command{*reinterpret_cast<Renderer::ICommand*>(commands)};
 
         if (command.magic != 0xCAFEBABE) {
@@ -82,8 +131,19 @@ u64 CommandListProcessor::Process(u32 session_id) {
             break;
         }
 
+        const bool is_voice_command{index >= header->voice_command_start &&
+                                    index - header->voice_command_start <
+                                        header->voice_command_count};
+        if (!is_voice_command || voice_node_id != command.node_id) {
+            end_voice();
+        }
+
         if (command.enabled) {
-            command.Process(*this);
+            const auto time{ProcessCommand(command)};
+            if (is_voice_command) {
+                voice_node_id = command.node_id;
+                voice_time += time;
+            }
         } else {
             dump += fmt::format("\tDisabled!\n");
         }
@@ -92,6 +152,8 @@ u64 CommandListProcessor::Process(u32 session_id) {
         commands += command.size;
     }
 
+    end_voice();
+
     if (Settings::values.dump_audio_commands && dump != last_dump) {
         LOG_WARNING(Service_Audio, "{}", dump);
         last_dump = dump;
@@ -101,4 +163,151 @@ u64 CommandListProcessor::Process(u32 session_id) {
     return end_time - start_time_;
 }
 
+bool CommandListProcessor::ProcessVoiceCommands() {
+    const auto voice_command_count{header->voice_command_count};
+    if (voice_workers == nullptr || voice_command_count == 0 ||
+        header->voice_command_start + voice_command_count > command_count) {
+        return false;
+    }
+
+    // Split the commands into voices, falling back to the ordered path for anything unexpected.
+    const auto command_base{CpuAddr(header) + sizeof(Renderer::CommandListHeader)};
+    auto& voices{voice_commands};
+    voices.clear();
+    u8* current{commands};
+    u32 current_node_id{};
+    for (u32 i = 0; i < voice_command_count; i++) {
+        auto& command{*reinterpret_cast<Renderer::ICommand*>(current)};
+        if (command.magic != Renderer::CommandMagic || command.size <= 0 ||
+            CpuAddr(current) - command_base + command.size > commands_buffer_size ||
+            !IsVoiceCommand(command.type) || !command.Verify(*this)) {
+            return false;
+        }
+        if (voices.empty() || command.node_id != current_node_id) {
+            voices.push_back({current, 0, 0});
+            current_node_id = command.node_id;
+        }
+        voices.back().count++;
+        voices.back().estimated_process_time += command.estimated_process_time;
+        current += command.size;
+    }
+
+    if (voices.size() < MinParallelVoices) {
+        return false;
+    }
+
+    // Depop prepare adds the voices' last samples to the shared depop buffer. It only reads what
+    // the previous list left in the voice state, so all of them can run first, in order.
+    for (const auto& voice : voices) {
+        u8* command_ptr{voice.start};
+        for (u32 i = 0; i < voice.count; i++) {
+            auto& command{*reinterpret_cast<Renderer::ICommand*>(command_ptr)};
+            if (command.enabled && command.type == Renderer::CommandId::DepopPrepare) {
+                ProcessCommand(command);
+            }
+            command_ptr += command.size;
+        }
+    }
+
+    // Split the voices into contiguous groups of similar estimated cost.
+    const size_t group_count{(std::min)(voice_workers->NumWorkers() + 1, voices.size())};
+    const auto voice_cost = [&](size_t voice) -> u64 {
+        return u64{voices[voice].estimated_process_time} + 1;
+    };
+    u64 total_cost{};
+    for (size_t i = 0; i < voices.size(); i++) {
+        total_cost += voice_cost(i);
+    }
+    auto& group_ends{voice_group_ends};
+    group_ends.clear();
+    u64 accumulated_cost{};
+    for (size_t i = 0; i + 1 < voices.size() && group_ends.size() + 1 < group_count; i++) {
+        accumulated_cost += voice_cost(i);
+        const auto groups_after{group_count - group_ends.size() - 1};
+        const auto voices_after{voices.size() - i - 1};
+        if (voices_after == groups_after ||
+            accumulated_cost * group_count >= total_cost * (group_ends.size() + 1)) {
+            group_ends.push_back(i + 1);
+        }
+    }
+    group_ends.push_back(voices.size());
+
+    const auto buffer_size{mix_buffers.size()};
+    voice_mix_buffers.resize_destructive(buffer_size * group_ends.size());
+    voice_processors.resize(group_ends.size());
+
+    const auto process_group = [&](size_t group) {
+        auto& processor{voice_processors[group]};
+        processor.system = system;
+        processor.memory = memory;
+        processor.stream = stream;
+        processor.header = header;
+        processor.commands_buffer_size = commands_buffer_size;
+        processor.max_process_time = max_process_time;
+        processor.command_count = command_count;
+        processor.sample_count = sample_count;
+        processor.target_sample_rate = target_sample_rate;
+        processor.buffer_count = buffer_count;
+        processor.start_time = start_time;
+        processor.current_processing_time = current_processing_time;
+        processor.host_metrics = host_metrics;
+        processor.mix_buffers =
+            std::span<s32>(voice_mix_buffers.data() + group * buffer_size, buffer_size);
+        std::ranges::fill(processor.mix_buffers, 0);
+
+        const size_t first_voice{group == 0 ? 0 : group_ends[group - 1]};
+        for (size_t voice = first_voice; voice < group_ends[group]; voice++) {
+            std::chrono::nanoseconds voice_time{};
+            u8* command_ptr{voices[voice].start};
+            for (u32 i = 0; i < voices[voice].count; i++) {
+                auto& command{*reinterpret_cast<Renderer::ICommand*>(command_ptr)};
+                if (command.enabled && command.type != Renderer::CommandId::DepopPrepare) {
+                    voice_time += processor.ProcessCommand(command);
+                }
+                command_ptr += command.size;
+            }
+            if (host_metrics) {
+                host_metrics->AddVoiceTime(voice_time);
+            }
+        }
+    };
+
+    for (size_t group = 1; group < group_ends.size(); group++) {
+        voice_workers->QueueWork([&process_group, group] { process_group(group); });
+    }
+    process_group(0);
+    voice_workers->WaitForRequests();
+
+    // Only the mix buffers are read after the voices, their scratch buffers can be dropped.
+    const auto mix_size{(std::min)(
+        static_cast<size_t>((std::max)(header->mix_buffer_count, s16{0})) * sample_count,
+        buffer_size)};
+    for (size_t group = 0; group < group_ends.size(); group++) {
+        const auto group_buffer{voice_processors[group].mix_buffers};
+        for (size_t i = 0; i < mix_size; i++) {
+            mix_buffers[i] = static_cast<s32>(static_cast<u32>(mix_buffers[i]) +
+                                              static_cast<u32>(group_buffer[i]));
+        }
+    }
+
+    processed_command_count += voice_command_count;
+    commands = current;
+    return true;
+}
+
+std::chrono::nanoseconds CommandListProcessor::ProcessCommand(Renderer::ICommand& command) {
+    if (host_metrics == nullptr) {
+        command.Process(*this);
+        return {};
+    }
+    const auto begin{Common::Trace::Now()};
+    command.Process(*this);
+    const auto end{Common::Trace::Now()};
+    Common::Trace::AddEvent(GetCommandName(command.type).data(), begin, end);
+
+    const std::chrono::nanoseconds time{end - begin};
+    host_metrics->AddCommandTime(command.type, time);
+    return time;
+}
+
 } // namespace AudioCore::ADSP::AudioRenderer
@@ -3,11 +3,17 @@
 
 #pragma once
 
+#include <chrono>
 #include <span>
+#include <string>
+#include <vector>
 
+#include "audio_core/adsp/apps/audio_renderer/host_metrics.h"
 #include "audio_core/common/common.h"
 #include "audio_core/renderer/command/command_list_header.h"
 #include "common/common_types.h"
+#include "common/scratch_buffer.h"
+#include "common/thread_worker.h"
 
 namespace Core {
 namespace Memory {
@@ -27,6 +33,7 @@ class SinkStream;
 
 namespace Renderer {
 struct CommandListHeader;
+struct ICommand;
 }
 
 namespace ADSP::AudioRenderer {
@@ -39,13 +46,16 @@ public:
     /**
      * Initialize the processor.
      *
-     * @param system - The core system.
-     * @param buffer - The command buffer to process.
-     * @param size   - The size of the buffer.
-     * @param stream - The stream to be used for sending the samples.
+     * @param system        - The core system.
+     * @param buffer        - The command buffer to process.
+     * @param size          - The size of the buffer.
+     * @param stream        - The stream to be used for sending the samples.
+     * @param voice_workers - Workers the voice commands may be spread across, can be null.
+     * @param host_metrics  - Receives the host time taken by the commands, can be null.
      */
     void Initialize(Core::System& system, Kernel::KProcess& process, CpuAddr buffer, u64 size,
-                    Sink::SinkStream* stream);
+                    Sink::SinkStream* stream, Common::ThreadWorker* voice_workers,
+                    HostMetrics* host_metrics);
 
     /**
      * Set the maximum processing time for this command list.
@@ -111,6 +121,45 @@ public:
     u64 end_time{};
     /// Last command list string generated, used for dumping audio commands to console
     std::string last_dump{};
+
+private:
+    /**
+     * Process the voice commands of the list across the voice workers.
+     * Every voice only touches its own state and scratch buffers and adds into the mix buffers,
+     * so groups of voices are mixed into private mix buffers which are then summed, giving the
+     * same result as processing the voices in order.
+     *
+     * @return True if the voice commands were processed, false if they must be processed
+     *         in order.
+     */
+    bool ProcessVoiceCommands();
+
+    /**
+     * Process a command, recording its host time in the metrics.
+     *
+     * @param command - The command to process.
+     * @return The host time taken, zero if there are no metrics to record it in.
+     */
+    std::chrono::nanoseconds ProcessCommand(Renderer::ICommand& command);
+
+    struct VoiceCommands {
+        u8* start;
+        u32 count;
+        u32 estimated_process_time;
+    };
+
+    /// Workers the voice commands are spread across
+    Common::ThreadWorker* voice_workers{};
+    /// Host timings of the commands
+    HostMetrics* host_metrics{};
+    /// Processors handing the private mix buffers to each group of voices
+    std::vector<CommandListProcessor> voice_processors{};
+    /// Private mix buffers of each group of voices
+    Common::ScratchBuffer<s32> voice_mix_buffers{};
+    /// Commands of each voice of the list being processed
+    std::vector<VoiceCommands> voice_commands{};
+    /// Index past the last voice of each group
+    std::vector<size_t> voice_group_ends{};
 };
 
 } // namespace ADSP::AudioRenderer
@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "audio_core/adsp/apps/audio_renderer/host_metrics.h"
+
+namespace AudioCore::ADSP::AudioRenderer {
+
+std::string_view GetCommandName(Renderer::CommandId type) {
+    static constexpr std::array<std::string_view, CommandIdCount> Names{
+        "Invalid",
+        "DataSourcePcmInt16Version1",
+        "DataSourcePcmInt16Version2",
+        "DataSourcePcmFloatVersion1",
+        "DataSourcePcmFloatVersion2",
+        "DataSourceAdpcmVersion1",
+        "DataSourceAdpcmVersion2",
+        "Volume",
+        "VolumeRamp",
+        "BiquadFilter",
+        "Mix",
+        "MixRamp",
+        "MixRampGrouped",
+        "DepopPrepare",
+        "DepopForMixBuffers",
+        "Delay",
+        "Upsample",
+        "DownMix6chTo2ch",
+        "Aux",
+        "DeviceSink",
+        "CircularBufferSink",
+        "Reverb",
+        "I3dl2Reverb",
+        "Performance",
+        "ClearMixBuffer",
+        "CopyMixBuffer",
+        "LightLimiterVersion1",
+        "LightLimiterVersion2",
+        "MultiTapBiquadFilter",
+        "Capture",
+        "Compressor",
+    };
+    const auto index{static_cast<size_t>(type)};
+    return index < Names.size() ? Names[index] : "Unknown";
+}
+
+void HostMetrics::Counter::Add(std::chrono::nanoseconds time) {
+    const auto ns{static_cast<u64>(time.count())};
+    count.fetch_add(1, std::memory_order_relaxed);
+    total_ns.fetch_add(ns, std::memory_order_relaxed);
+    auto current_max{max_ns.load(std::memory_order_relaxed)};
+    while (current_max < ns &&
+           !max_ns.compare_exchange_weak(current_max, ns, std::memory_order_relaxed)) {
+    }
+}
+
+HostMetricsResults::Timing HostMetrics::Counter::GetAndReset() {
+    return {
+        .count = count.exchange(0, std::memory_order_relaxed),
+        .total = std::chrono::nanoseconds{
+            static_cast<s64>(total_ns.exchange(0, std::memory_order_relaxed))},
+        .max = std::chrono::nanoseconds{
+            static_cast<s64>(max_ns.exchange(0, std::memory_order_relaxed))},
+    };
+}
+
+HostMetricsResults HostMetrics::GetAndReset() {
+    HostMetricsResults results{
+        .frames = frames.GetAndReset(),
+        .voices = voices.GetAndReset(),
+        .commands = {},
+        .underruns = underruns.exchange(0, std::memory_order_relaxed),
+        .queue_depth = queue_depth.load(std::memory_order_relaxed),
+    };
+    for (size_t i = 0; i < commands.size(); i++) {
+        results.commands[i] = commands[i].GetAndReset();
+    }
+    return results;
+}
+
+} // namespace AudioCore::ADSP::AudioRenderer
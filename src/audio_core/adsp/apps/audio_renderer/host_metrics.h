@@ -0,0 +1,112 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <string_view>
+
+#include "audio_core/renderer/command/icommand.h"
+#include "common/common_types.h"
+
+namespace AudioCore::ADSP::AudioRenderer {
+
+constexpr size_t CommandIdCount = static_cast<size_t>(Renderer::CommandId::Compressor) + 1;
+
+/**
+ * Host timings of the AudioRenderer gathered since the last reset.
+ * The performance frames given to the guest only hold the estimated times of the commands, these
+ * are the wall times of the host, to tell whether stutter comes from rendering or from the sink.
+ */
+struct HostMetricsResults {
+    struct Timing {
+        /// Number of measurements
+        u64 count;
+        /// Sum of the measurements
+        std::chrono::nanoseconds total;
+        /// Longest measurement
+        std::chrono::nanoseconds max;
+
+        std::chrono::nanoseconds Average() const {
+            return count == 0 ? std::chrono::nanoseconds{} : total / static_cast<s64>(count);
+        }
+    };
+
+    /// Time spent rendering each frame, not counting the waits for the sink
+    Timing frames;
+    /// Time spent processing the commands of each voice
+    Timing voices;
+    /// Time spent processing each type of command
+    std::array<Timing, CommandIdCount> commands;
+    /// Number of times the sink ran out of samples
+    u32 underruns;
+    /// Number of rendered buffers waiting in the sink after the last frame
+    u32 queue_depth;
+};
+
+/**
+ * Get the name of a command type, for the metrics output.
+ *
+ * @param type - The command type.
+ * @return The name of the command type.
+ */
+std::string_view GetCommandName(Renderer::CommandId type);
+
+/**
+ * Gathers the host timings of the AudioRenderer. Measurements may be added from any thread.
+ */
+class HostMetrics {
+public:
+    void AddFrameTime(std::chrono::nanoseconds time) {
+        frames.Add(time);
+    }
+
+    void AddVoiceTime(std::chrono::nanoseconds time) {
+        voices.Add(time);
+    }
+
+    void AddCommandTime(Renderer::CommandId type, std::chrono::nanoseconds time) {
+        const auto index{static_cast<size_t>(type)};
+        if (index < commands.size()) {
+            commands[index].Add(time);
+        }
+    }
+
+    /**
+     * Record the state of the sink after a frame was rendered.
+     *
+     * @param queue_depth_ - Number of buffers queued in the sink.
+     * @param underruns_   - Number of underruns since the last call.
+     */
+    void UpdateSinkState(u32 queue_depth_, u32 underruns_) {
+        queue_depth.store(queue_depth_, std::memory_order_relaxed);
+        underruns.fetch_add(underruns_, std::memory_order_relaxed);
+    }
+
+    /**
+     * Get the metrics gathered since the last call, and reset them.
+     *
+     * @return The gathered metrics.
+     */
+    HostMetricsResults GetAndReset();
+
+private:
+    struct Counter {
+        void Add(std::chrono::nanoseconds time);
+        HostMetricsResults::Timing GetAndReset();
+
+        std::atomic<u64> count{};
+        std::atomic<u64> total_ns{};
+        std::atomic<u64> max_ns{};
+    };
+
+    Counter frames;
+    Counter voices;
+    std::array<Counter, CommandIdCount> commands;
+    std::atomic<u32> underruns{};
+    std::atomic<u32> queue_depth{};
+};
+
+} // namespace AudioCore::ADSP::AudioRenderer
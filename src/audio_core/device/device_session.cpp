@@ -111,8 +111,10 @@ void DeviceSession::AppendBuffers(std::span<const AudioBuffer> buffers) {
 
 void DeviceSession::ReleaseBuffer(const AudioBuffer& buffer) const {
     if (type == Sink::StreamType::In) {
-        auto samples{stream->ReleaseBuffer(buffer.size / sizeof(s16))};
-        handle->GetMemory().WriteBlockUnsafe(buffer.samples, samples.data(), buffer.size);
+        // Pop the recorded samples straight into the game's buffer when it is contiguous
+        Core::Memory::CpuGuestMemoryScoped<s16, Core::Memory::GuestMemoryFlags::UnsafeWrite>
+            samples(handle->GetMemory(), buffer.samples, buffer.size / sizeof(s16));
+        stream->ReleaseBuffer({samples.data(), samples.size()});
     }
 }
 
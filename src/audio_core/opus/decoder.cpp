@@ -4,6 +4,9 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <utility>
+
 #include "audio_core/opus/decoder.h"
 #include "audio_core/opus/hardware_opus.h"
 #include "audio_core/opus/parameters.h"
@@ -27,13 +30,30 @@ OpusDecoder::OpusDecoder(Core::System& system_, HardwareOpus& hardware_opus_)
 
 OpusDecoder::~OpusDecoder() {
     if (decode_object_initialized) {
-        hardware_opus.ShutdownDecodeObject(shared_buffer.data(), shared_buffer.size());
+        hardware_opus.ReleaseDecodeObject(decode_object_params, std::move(shared_buffer));
     }
 }
 
+bool OpusDecoder::AcquireWorkBuffer(u64 transfer_memory_size) {
+    shared_buffer = hardware_opus.AcquireDecodeObject(decode_object_params, transfer_memory_size);
+    if (!shared_buffer.empty()) {
+        return true;
+    }
+    shared_buffer.resize(transfer_memory_size, 0);
+    return false;
+}
+
 Result OpusDecoder::Initialize(const OpusParametersEx& params, Kernel::KTransferMemory* transfer_memory, u64 transfer_memory_size) {
     auto frame_size{params.use_large_frame_size ? 5760 : 1920};
-    shared_buffer.resize(transfer_memory_size);
+    decode_object_params = {
+        .multi_stream = false,
+        .sample_rate = params.sample_rate,
+        .channel_count = params.channel_count,
+        .total_stream_count = 0,
+        .stereo_stream_count = 0,
+        .mappings = {},
+    };
+    const bool pooled{AcquireWorkBuffer(transfer_memory_size)};
     shared_memory_mapped = true;
 
     buffer_size =
@@ -50,8 +70,14 @@ Result OpusDecoder::Initialize(const OpusParametersEx& params, Kernel::KTransfer
         }
     };
 
-    R_TRY(hardware_opus.InitializeDecodeObject(params.sample_rate, params.channel_count,
-                                               shared_buffer.data(), shared_buffer.size()));
+    // A pooled decode object is still initialized with these parameters, resetting its state on
+    // the first decode makes it equivalent to a new one without a round trip to the DSP
+    if (pooled) {
+        reset_pending = true;
+    } else {
+        R_TRY(hardware_opus.InitializeDecodeObject(params.sample_rate, params.channel_count,
+                                                   shared_buffer.data(), shared_buffer.size()));
+    }
 
     sample_rate = params.sample_rate;
     channel_count = params.channel_count;
@@ -62,7 +88,17 @@ Result OpusDecoder::Initialize(const OpusParametersEx& params, Kernel::KTransfer
 
 Result OpusDecoder::Initialize(const OpusMultiStreamParametersEx& params, Kernel::KTransferMemory* transfer_memory, u64 transfer_memory_size) {
     auto frame_size{params.use_large_frame_size ? 5760 : 1920};
-    shared_buffer.resize(transfer_memory_size, 0);
+    decode_object_params = {
+        .multi_stream = true,
+        .sample_rate = params.sample_rate,
+        .channel_count = params.channel_count,
+        .total_stream_count = params.total_stream_count,
+        .stereo_stream_count = params.stereo_stream_count,
+        .mappings = {},
+    };
+    std::memcpy(decode_object_params.mappings.data(), params.mappings.data(),
+                (std::min)(static_cast<size_t>(params.channel_count), MaxChannels));
+    const bool pooled{AcquireWorkBuffer(transfer_memory_size)};
     shared_memory_mapped = true;
 
     buffer_size =
@@ -79,10 +115,14 @@ Result OpusDecoder::Initialize(const OpusMultiStreamParametersEx& params, Kernel
         }
     };
 
-    R_TRY(hardware_opus.InitializeMultiStreamDecodeObject(
-        params.sample_rate, params.channel_count, params.total_stream_count,
-        params.stereo_stream_count, params.mappings.data(), shared_buffer.data(),
-        shared_buffer.size()));
+    if (pooled) {
+        reset_pending = true;
+    } else {
+        R_TRY(hardware_opus.InitializeMultiStreamDecodeObject(
+            params.sample_rate, params.channel_count, params.total_stream_count,
+            params.stereo_stream_count, params.mappings.data(), shared_buffer.data(),
+            shared_buffer.size()));
+    }
 
     sample_rate = params.sample_rate;
     channel_count = params.channel_count;
@@ -115,6 +155,8 @@ Result OpusDecoder::DecodeInterleaved(u32* out_data_size, u64* out_time_taken,
 
     std::memcpy(in_data.data(), input_data.data() + sizeof(OpusPacketHeader), header.size);
 
+    // The DSP resets the decoder before decoding, even if the decode itself then fails
+    reset |= std::exchange(reset_pending, false);
     R_TRY(hardware_opus.DecodeInterleaved(out_samples, out_data.data(), out_data.size_bytes(),
                                           channel_count, in_data.data(), header.size,
                                           shared_buffer.data(), time_taken, reset));
@@ -161,6 +203,7 @@ Result OpusDecoder::DecodeInterleavedForMultiStream(u32* out_data_size, u64* out
 
     std::memcpy(in_data.data(), input_data.data() + sizeof(OpusPacketHeader), header.size);
 
+    reset |= std::exchange(reset_pending, false);
     R_TRY(hardware_opus.DecodeInterleavedForMultiStream(
         out_samples, out_data.data(), out_data.size_bytes(), channel_count, in_data.data(),
         header.size, shared_buffer.data(), time_taken, reset));
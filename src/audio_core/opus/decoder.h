@@ -37,6 +37,9 @@ public:
                                            std::span<u8> output_data, bool reset);
 
 private:
+    /// Takes a pooled work buffer matching decode_object_params, or allocates a new one
+    bool AcquireWorkBuffer(u64 transfer_memory_size);
+
     Core::System& system;
     HardwareOpus& hardware_opus;
     std::vector<u8> shared_buffer{};
@@ -50,6 +53,10 @@ private:
     s32 stereo_stream_count{};
     bool shared_memory_mapped{false};
     bool decode_object_initialized{false};
+    /// Parameters of the decode object, used to pool its work buffer once the decoder closes
+    DecodeObjectParameters decode_object_params{};
+    /// The decode object came from the pool and must be reset by the next decode
+    bool reset_pending{false};
 };
 
 } // namespace AudioCore::OpusDecoder
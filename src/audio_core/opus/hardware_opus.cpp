@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <array>
 
 #include "audio_core/audio_core.h"
@@ -239,4 +240,34 @@ Result HardwareOpus::UnmapMemory(void* buffer, u64 buffer_size) {
     R_SUCCEED();
 }
 
+std::vector<u8> HardwareOpus::AcquireDecodeObject(const DecodeObjectParameters& params,
+                                                  u64 buffer_size) {
+    std::scoped_lock l{pool_mutex};
+    const auto it = std::ranges::find_if(pooled_decode_objects, [&](const auto& pooled) {
+        return pooled.params == params && pooled.buffer.size() == buffer_size;
+    });
+    if (it == pooled_decode_objects.end()) {
+        return {};
+    }
+    auto buffer{std::move(it->buffer)};
+    pooled_decode_objects.erase(it);
+    return buffer;
+}
+
+void HardwareOpus::ReleaseDecodeObject(const DecodeObjectParameters& params,
+                                       std::vector<u8>&& buffer) {
+    {
+        std::scoped_lock l{pool_mutex};
+        if (pooled_decode_objects.size() < MaxPooledDecodeObjects) {
+            pooled_decode_objects.push_back({params, std::move(buffer)});
+            return;
+        }
+    }
+    if (params.multi_stream) {
+        ShutdownMultiStreamDecodeObject(buffer.data(), buffer.size());
+    } else {
+        ShutdownDecodeObject(buffer.data(), buffer.size());
+    }
+}
+
 } // namespace AudioCore::OpusDecoder
@@ -4,11 +4,13 @@
 #pragma once
 
 #include <mutex>
+#include <vector>
 #include <opus.h>
 
 #include "audio_core/adsp/apps/opus/opus_decoder.h"
 #include "audio_core/adsp/apps/opus/shared_memory.h"
 #include "audio_core/adsp/mailbox.h"
+#include "audio_core/opus/parameters.h"
 #include "core/hle/service/audio/errors.h"
 
 namespace AudioCore::OpusDecoder {
@@ -36,9 +38,37 @@ public:
     Result MapMemory(void* buffer, u64 buffer_size);
     Result UnmapMemory(void* buffer, u64 buffer_size);
 
+    /**
+     * Takes a pooled work buffer holding a decode object initialized with the given parameters.
+     * The decode object must be reset before decoding with it.
+     *
+     * @param params      - Parameters the decode object must have been initialized with.
+     * @param buffer_size - Size of the work buffer.
+     * @return The work buffer, or an empty buffer if none matches.
+     */
+    std::vector<u8> AcquireDecodeObject(const DecodeObjectParameters& params, u64 buffer_size);
+
+    /**
+     * Gives back the work buffer of a closed decoder, keeping its decode object initialized so a
+     * decoder opened later with the same parameters can skip the initialization.
+     * The decode object is shut down if the pool is full.
+     *
+     * @param params - Parameters the decode object was initialized with.
+     * @param buffer - Work buffer of the decode object.
+     */
+    void ReleaseDecodeObject(const DecodeObjectParameters& params, std::vector<u8>&& buffer);
+
 private:
+    struct PooledDecodeObject {
+        DecodeObjectParameters params;
+        std::vector<u8> buffer;
+    };
+    static constexpr size_t MaxPooledDecodeObjects = 8;
+
     Core::System& system;
     std::mutex mutex;
+    std::mutex pool_mutex;
+    std::vector<PooledDecodeObject> pooled_decode_objects;
     ADSP::OpusDecoder::OpusDecoder& opus_decoder;
     ADSP::OpusDecoder::SharedMemory shared_memory;
 };
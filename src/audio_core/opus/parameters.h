@@ -51,4 +51,16 @@ struct OpusPacketHeader {
     /* 0x04 */ u32 final_range;
 }; // size = 0x8
 static_assert(sizeof(OpusPacketHeader) == 0x8, "OpusPacketHeader has the wrong size!");
+
+/// Parameters a decode object was initialized with, a pooled one is only reused for equal ones
+struct DecodeObjectParameters {
+    bool multi_stream;
+    u32 sample_rate;
+    u32 channel_count;
+    u32 total_stream_count;
+    u32 stereo_stream_count;
+    std::array<u8, MaxChannels> mappings;
+
+    bool operator==(const DecodeObjectParameters&) const = default;
+};
 } // namespace AudioCore::OpusDecoder
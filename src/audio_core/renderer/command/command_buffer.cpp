@@ -69,7 +69,7 @@ void CommandBuffer::GeneratePcmInt16Version1Command(const s32 node_id,
 
     cmd.src_quality = voice_info.src_quality;
     cmd.output_index = buffer_count + channel;
-    cmd.flags = voice_info.flags & 3;
+    cmd.flags = voice_info.flags & (3 | VoiceInfo::SkipOutputFlag);
     cmd.sample_rate = voice_info.sample_rate;
     cmd.pitch = voice_info.pitch;
     cmd.channel_index = channel;
@@ -93,7 +93,7 @@ void CommandBuffer::GeneratePcmInt16Version2Command(const s32 node_id, VoiceInfo
 
     cmd.src_quality = voice_info.src_quality;
     cmd.output_index = buffer_count + channel;
-    cmd.flags = voice_info.flags & 3;
+    cmd.flags = voice_info.flags & (3 | VoiceInfo::SkipOutputFlag);
     cmd.sample_rate = voice_info.sample_rate;
     cmd.pitch = voice_info.pitch;
     cmd.channel_index = channel;
@@ -119,7 +119,7 @@ void CommandBuffer::GeneratePcmFloatVersion1Command(const s32 node_id,
 
     cmd.src_quality = voice_info.src_quality;
     cmd.output_index = buffer_count + channel;
-    cmd.flags = voice_info.flags & 3;
+    cmd.flags = voice_info.flags & (3 | VoiceInfo::SkipOutputFlag);
     cmd.sample_rate = voice_info.sample_rate;
     cmd.pitch = voice_info.pitch;
     cmd.channel_index = channel;
@@ -143,7 +143,7 @@ void CommandBuffer::GeneratePcmFloatVersion2Command(const s32 node_id, VoiceInfo
 
     cmd.src_quality = voice_info.src_quality;
     cmd.output_index = buffer_count + channel;
-    cmd.flags = voice_info.flags & 3;
+    cmd.flags = voice_info.flags & (3 | VoiceInfo::SkipOutputFlag);
     cmd.sample_rate = voice_info.sample_rate;
     cmd.pitch = voice_info.pitch;
     cmd.channel_index = channel;
@@ -168,7 +168,7 @@ void CommandBuffer::GenerateAdpcmVersion1Command(const s32 node_id,
 
     cmd.src_quality = voice_info.src_quality;
     cmd.output_index = buffer_count + channel;
-    cmd.flags = voice_info.flags & 3;
+    cmd.flags = voice_info.flags & (3 | VoiceInfo::SkipOutputFlag);
     cmd.sample_rate = voice_info.sample_rate;
     cmd.pitch = voice_info.pitch;
 
@@ -191,7 +191,7 @@ void CommandBuffer::GenerateAdpcmVersion2Command(const s32 node_id, VoiceInfo& v
 
     cmd.src_quality = voice_info.src_quality;
     cmd.output_index = buffer_count + channel;
-    cmd.flags = voice_info.flags & 3;
+    cmd.flags = voice_info.flags & (3 | VoiceInfo::SkipOutputFlag);
     cmd.sample_rate = voice_info.sample_rate;
     cmd.pitch = voice_info.pitch;
     cmd.channel_index = channel;
@@ -168,12 +168,74 @@ void CommandGenerator::GenerateBiquadFilterCommandForVoice(VoiceInfo& voice_info
     }
 }
 
+bool CommandGenerator::IsVoiceInaudible(const VoiceInfo& voice_info) {
+    if (voice_info.biquads[0].enabled || voice_info.biquads[1].enabled) {
+        return false;
+    }
+
+    if (!voice_info.HasAnyConnection() ||
+        (voice_info.volume == 0.0f && voice_info.prev_volume == 0.0f)) {
+        return true;
+    }
+
+    const auto is_silent = [](std::span<const f32> volumes, std::span<const f32> prev_volumes,
+                              s16 buffer_count) {
+        for (s16 i = 0; i < buffer_count; i++) {
+            if (volumes[i] != 0.0f || prev_volumes[i] != 0.0f) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    for (s8 channel = 0; channel < voice_info.channel_count; channel++) {
+        if (voice_info.mix_id != UnusedMixId) {
+            const auto mix_info{mix_context.GetInfo(voice_info.mix_id)};
+            const auto& channel_resource{
+                voice_context.GetChannelResource(voice_info.channel_resource_ids[channel])};
+            if (!is_silent(channel_resource.mix_volumes, channel_resource.prev_mix_volumes,
+                           mix_info->buffer_count)) {
+                return false;
+            }
+            continue;
+        }
+
+        auto i{channel};
+        auto destination{splitter_context.GetDestinationData(voice_info.splitter_id, i)};
+        while (destination != nullptr) {
+            if (destination->IsConfigured()) {
+                const auto mix_id{destination->GetMixId()};
+                if (mix_id < mix_context.GetCount() &&
+                    static_cast<s32>(mix_id) != UnusedSplitterId &&
+                    !is_silent(destination->GetMixVolume(), destination->GetMixVolumePrev(),
+                               mix_context.GetInfo(mix_id)->buffer_count)) {
+                    return false;
+                }
+            }
+            i += voice_info.channel_count;
+            destination = splitter_context.GetDestinationData(voice_info.splitter_id, i);
+        }
+    }
+    return true;
+}
+
 void CommandGenerator::GenerateVoiceCommand(VoiceInfo& voice_info) {
     u8 precision{15};
     if (render_context.behavior->IsVolumeMixParameterPrecisionQ23Supported()) {
         precision = 23;
     }
 
+    // Inaudible voices still run their data source commands so the wavebuffers are consumed as
+    // usual, and mix with 0 volumes so the depop samples are cleared as they would have been.
+    static constexpr std::array<f32, MaxMixBuffers> SilentMixVolumes{};
+    const std::span<const f32> silent_volumes{SilentMixVolumes};
+    const bool inaudible{IsVoiceInaudible(voice_info)};
+    if (inaudible) {
+        voice_info.flags |= VoiceInfo::SkipOutputFlag;
+    } else {
+        voice_info.flags &= static_cast<u16>(~VoiceInfo::SkipOutputFlag);
+    }
+
     for (s8 channel = 0; channel < voice_info.channel_count; channel++) {
         const auto resource_id{voice_info.channel_resource_ids[channel]};
         auto& voice_state{voice_context.GetDspSharedState(resource_id)};
@@ -211,25 +273,29 @@ void CommandGenerator::GenerateVoiceCommand(VoiceInfo& voice_info) {
             continue;
         }
 
-        DetailAspect biquad_detail_aspect(*this, PerformanceEntryType::Voice, voice_info.node_id,
-                                          PerformanceDetailType::Unk4);
-        GenerateBiquadFilterCommandForVoice(
-            voice_info, voice_state, render_context.mix_buffer_count, channel, voice_info.node_id);
+        if (!inaudible) {
+            DetailAspect biquad_detail_aspect(*this, PerformanceEntryType::Voice,
+                                              voice_info.node_id, PerformanceDetailType::Unk4);
+            GenerateBiquadFilterCommandForVoice(voice_info, voice_state,
+                                                render_context.mix_buffer_count, channel,
+                                                voice_info.node_id);
 
-        if (biquad_detail_aspect.initialized) {
-            command_buffer.GeneratePerformanceCommand(
-                biquad_detail_aspect.node_id, PerformanceState::Stop,
-                biquad_detail_aspect.performance_entry_address);
-        }
+            if (biquad_detail_aspect.initialized) {
+                command_buffer.GeneratePerformanceCommand(
+                    biquad_detail_aspect.node_id, PerformanceState::Stop,
+                    biquad_detail_aspect.performance_entry_address);
+            }
 
-        DetailAspect volume_ramp_detail_aspect(*this, PerformanceEntryType::Voice,
-                                               voice_info.node_id, PerformanceDetailType::Unk3);
-        command_buffer.GenerateVolumeRampCommand(
-            voice_info.node_id, voice_info, render_context.mix_buffer_count + channel, precision);
-        if (volume_ramp_detail_aspect.initialized) {
-            command_buffer.GeneratePerformanceCommand(
-                volume_ramp_detail_aspect.node_id, PerformanceState::Stop,
-                volume_ramp_detail_aspect.performance_entry_address);
+            DetailAspect volume_ramp_detail_aspect(*this, PerformanceEntryType::Voice,
+                                                   voice_info.node_id, PerformanceDetailType::Unk3);
+            command_buffer.GenerateVolumeRampCommand(voice_info.node_id, voice_info,
+                                                     render_context.mix_buffer_count + channel,
+                                                     precision);
+            if (volume_ramp_detail_aspect.initialized) {
+                command_buffer.GeneratePerformanceCommand(
+                    volume_ramp_detail_aspect.node_id, PerformanceState::Stop,
+                    volume_ramp_detail_aspect.performance_entry_address);
+            }
         }
 
         voice_info.prev_volume = voice_info.volume;
@@ -245,7 +311,8 @@ void CommandGenerator::GenerateVoiceCommand(VoiceInfo& voice_info) {
                             static_cast<s32>(mix_id) != UnusedSplitterId) {
                             auto mix_info{mix_context.GetInfo(mix_id)};
                             GenerateVoiceMixCommand(
-                                destination->GetMixVolume(), destination->GetMixVolumePrev(),
+                                inaudible ? silent_volumes : destination->GetMixVolume(),
+                                inaudible ? silent_volumes : destination->GetMixVolumePrev(),
                                 voice_state, mix_info->buffer_offset, mix_info->buffer_count,
                                 render_context.mix_buffer_count + channel, voice_info.node_id);
                             destination->MarkAsNeedToUpdateInternalState();
@@ -259,7 +326,8 @@ void CommandGenerator::GenerateVoiceCommand(VoiceInfo& voice_info) {
             DetailAspect volume_mix_detail_aspect(*this, PerformanceEntryType::Voice,
                                                   voice_info.node_id, PerformanceDetailType::Unk3);
             auto mix_info{mix_context.GetInfo(voice_info.mix_id)};
-            GenerateVoiceMixCommand(channel_resource.mix_volumes, channel_resource.prev_mix_volumes,
+            GenerateVoiceMixCommand(inaudible ? silent_volumes : channel_resource.mix_volumes,
+                                    inaudible ? silent_volumes : channel_resource.prev_mix_volumes,
                                     voice_state, mix_info->buffer_offset, mix_info->buffer_count,
                                     render_context.mix_buffer_count + channel, voice_info.node_id);
             if (volume_mix_detail_aspect.initialized) {
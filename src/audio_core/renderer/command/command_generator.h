@@ -154,9 +154,20 @@ public:
     void GenerateBiquadFilterCommandForVoice(VoiceInfo& voice_info, const VoiceState& voice_state,
                                              s16 buffer_count, s8 channel, s32 node_id);
 
+    /**
+     * Check if nothing of a voice can be heard on this frame, either because it is routed nowhere
+     * or because all of its volumes are 0 on both ends of the ramps.
+     * Voices with biquad filters are never considered inaudible, the filters need the samples.
+     *
+     * @param voice_info - Voice info to check.
+     * @return True if the voice's output can be skipped, otherwise false.
+     */
+    bool IsVoiceInaudible(const VoiceInfo& voice_info);
+
     /**
      * Generate commands for a voice.
      * Includes a data source, biquad filter, volume and mixing.
+     * Inaudible voices only get their playback state advanced, and their mixes cleared.
      *
      * @param voice_info - Voice info these commands are generated from.
      */
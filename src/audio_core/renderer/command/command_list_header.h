@@ -17,6 +17,12 @@ struct CommandListHeader {
     s16 buffer_count;
     u32 sample_count;
     u32 sample_rate;
+    /// Number of mix buffers used by the mixes, the voice buffers follow them
+    s16 mix_buffer_count;
+    /// Index of the first command generated for the voices
+    u32 voice_command_start;
+    /// Number of commands generated for the voices, each voice's commands are contiguous
+    u32 voice_command_count;
 };
 
 } // namespace AudioCore::Renderer
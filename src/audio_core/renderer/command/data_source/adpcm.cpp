@@ -42,6 +42,7 @@ void AdpcmDataSourceVersion1Command::Process(const AudioRenderer::CommandListPro
         .data_size{data_size},
         .IsVoicePlayedSampleCountResetAtLoopPointSupported{(flags & 1) != 0},
         .IsVoicePitchAndSrcSkippedSupported{(flags & 2) != 0},
+        .skip_output{(flags & 4) != 0},
     };
 
     DecodeFromWaveBuffers(*processor.memory, args);
@@ -78,6 +79,7 @@ void AdpcmDataSourceVersion2Command::Process(const AudioRenderer::CommandListPro
         .data_size{data_size},
         .IsVoicePlayedSampleCountResetAtLoopPointSupported{(flags & 1) != 0},
         .IsVoicePitchAndSrcSkippedSupported{(flags & 2) != 0},
+        .skip_output{(flags & 4) != 0},
     };
 
     DecodeFromWaveBuffers(*processor.memory, args);
@@ -94,6 +94,45 @@ static u32 DecodePcm(Core::Memory::Memory& memory, std::span<s16> out_buffer,
     return samples_to_decode;
 }
 
+/**
+ * Skip over PCM data the same way DecodePcm would read it, only decoding the last samples which
+ * are kept as the resampler history.
+ *
+ * @tparam T            - Type to decode. Only s16 and f32 are supported.
+ * @param memory        - Core memory for reading samples.
+ * @param out_buffer    - Output mix buffer to receive the last samples.
+ * @param req           - Information for how to decode.
+ * @param history_count - Number of samples to decode at the end of the range.
+ * @return Number of samples skipped.
+ */
+template <typename T>
+static u32 SkipPcm(Core::Memory::Memory& memory, std::span<s16> out_buffer, const DecodeArg& req,
+                   u32 history_count) {
+    if (req.buffer == 0 || req.buffer_size == 0) {
+        return 0;
+    }
+
+    if (req.start_offset >= req.end_offset) {
+        return 0;
+    }
+
+    if (req.channel_count == 1 && req.target_channel != 0) {
+        // Let DecodePcm report the error
+        return DecodePcm<T>(memory, out_buffer, req);
+    }
+
+    const auto samples_to_skip{
+        (std::min)(req.samples_to_read, req.end_offset - req.start_offset - req.offset)};
+    const auto samples_to_decode{(std::min)(samples_to_skip, history_count)};
+    if (samples_to_decode > 0) {
+        DecodeArg tail{req};
+        tail.offset += samples_to_skip - samples_to_decode;
+        tail.samples_to_read = samples_to_decode;
+        DecodePcm<T>(memory, out_buffer.subspan(samples_to_skip - samples_to_decode), tail);
+    }
+    return samples_to_skip;
+}
+
 /**
  * Decode ADPCM data.
  *
@@ -275,6 +314,10 @@ void DecodeFromWaveBuffers(Core::Memory::Memory& memory, const DecodeFromWaveBuf
     auto output_buffer{args.output};
     std::array<s16, TempBufferSize> temp_buffer{};
 
+    // When the output is skipped, PCM data only needs the samples kept in the resampler history.
+    // ADPCM is still decoded in full, its context depends on every sample.
+    const u32 history_count{args.IsVoicePitchAndSrcSkippedSupported ? 0U : pitch};
+
     while (remaining_sample_count > 0) {
         const auto samples_to_write{(std::min)(remaining_sample_count, max_remaining_sample_count)};
         const auto samples_to_read{
@@ -336,17 +379,21 @@ void DecodeFromWaveBuffers(Core::Memory::Memory& memory, const DecodeFromWaveBuf
             s32 samples_decoded{0};
 
             switch (args.sample_format) {
-            case SampleFormat::PcmInt16:
-                samples_decoded = DecodePcm<s16>(
-                    memory, {&temp_buffer[temp_buffer_pos], TempBufferSize - temp_buffer_pos},
-                    decode_arg);
-                break;
+            case SampleFormat::PcmInt16: {
+                const std::span<s16> out{&temp_buffer[temp_buffer_pos],
+                                         TempBufferSize - temp_buffer_pos};
+                samples_decoded = args.skip_output
+                                      ? SkipPcm<s16>(memory, out, decode_arg, history_count)
+                                      : DecodePcm<s16>(memory, out, decode_arg);
+            } break;
 
-            case SampleFormat::PcmFloat:
-                samples_decoded = DecodePcm<f32>(
-                    memory, {&temp_buffer[temp_buffer_pos], TempBufferSize - temp_buffer_pos},
-                    decode_arg);
-                break;
+            case SampleFormat::PcmFloat: {
+                const std::span<s16> out{&temp_buffer[temp_buffer_pos],
+                                         TempBufferSize - temp_buffer_pos};
+                samples_decoded = args.skip_output
+                                      ? SkipPcm<f32>(memory, out, decode_arg, history_count)
+                                      : DecodePcm<f32>(memory, out, decode_arg);
+            } break;
 
             case SampleFormat::Adpcm: {
                 decode_arg.adpcm_context = &voice_state.adpcm_context;
@@ -396,18 +443,26 @@ void DecodeFromWaveBuffers(Core::Memory::Memory& memory, const DecodeFromWaveBuf
         }
 
         if (args.IsVoicePitchAndSrcSkippedSupported) {
-            if (samples_read > output_buffer.size()) {
-                LOG_ERROR(Service_Audio, "Attempting to write past the end of output buffer!");
-            }
-            for (u32 i = 0; i < samples_read; i++) {
-                output_buffer[i] = temp_buffer[i];
+            if (!args.skip_output) {
+                if (samples_read > output_buffer.size()) {
+                    LOG_ERROR(Service_Audio, "Attempting to write past the end of output buffer!");
+                }
+                for (u32 i = 0; i < samples_read; i++) {
+                    output_buffer[i] = temp_buffer[i];
+                }
             }
         } else {
             std::memset(&temp_buffer[temp_buffer_pos], 0,
                         (samples_to_read - samples_read) * sizeof(s16));
 
-            Resample(output_buffer, temp_buffer, sample_rate_ratio, fraction, samples_to_write,
-                     args.src_quality);
+            if (!args.skip_output) {
+                Resample(output_buffer, temp_buffer, sample_rate_ratio, fraction, samples_to_write,
+                         args.src_quality);
+            } else if (args.src_quality != SrcQuality::Low || sample_rate_ratio != 1.0f) {
+                // Advance the fraction as the resampler would have, one ratio per output sample
+                fraction += samples_to_write * sample_rate_ratio;
+                fraction.clear_int();
+            }
 
             std::memcpy(voice_state.sample_history.data(), &temp_buffer[samples_to_read],
                         pitch * sizeof(s16));
@@ -33,6 +33,8 @@ struct DecodeFromWaveBuffersArgs {
     u64 data_size;
     bool IsVoicePlayedSampleCountResetAtLoopPointSupported;
     bool IsVoicePitchAndSrcSkippedSupported;
+    /// The voice cannot be heard, only advance the playback state without producing any output
+    bool skip_output;
 };
 
 struct DecodeArg {
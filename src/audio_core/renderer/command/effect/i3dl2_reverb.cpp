@@ -56,6 +56,15 @@ constexpr std::array<f32, I3dl2ReverbInfo::MaxDelayTaps> EarlyGains{
     0.24712f, 0.45945f, 0.45021f, 0.64196f, 0.54879f, 0.92925f, 0.3827f,
     0.72867f, 0.69794f, 0.5464f,  0.24563f, 0.45214f, 0.44042f};
 
+/// EarlyGains converted to fixed point once, rather than for every tap of every sample
+constexpr auto EarlyGainsFixed = [] {
+    std::array<Common::FixedPoint<50, 14>, I3dl2ReverbInfo::MaxDelayTaps> gains{};
+    for (size_t i = 0; i < gains.size(); i++) {
+        gains[i] = EarlyGains[i];
+    }
+    return gains;
+}();
+
 /**
  * Update the I3dl2ReverbInfo state according to the given parameters.
  *
@@ -271,19 +280,30 @@ static void ApplyI3dl2ReverbEffect(I3dl2ReverbInfo::State& state,
         tap_indexes = OutTapIndexes6Ch;
     }
 
+    // The gains and coefficients are constant over the whole buffer, convert them to fixed point
+    // once rather than for every use
+    const Common::FixedPoint<50, 14> early_gain{state.early_gain};
+    const Common::FixedPoint<50, 14> late_gain{state.late_gain};
+    const Common::FixedPoint<50, 14> lowpass_2{state.lowpass_2};
+    std::array<std::array<Common::FixedPoint<50, 14>, 3>, I3dl2ReverbInfo::MaxDelayLines>
+        lowpass_coeff{};
+    for (u32 delay_line = 0; delay_line < I3dl2ReverbInfo::MaxDelayLines; delay_line++) {
+        for (u32 i = 0; i < lowpass_coeff[delay_line].size(); i++) {
+            lowpass_coeff[delay_line][i] = state.lowpass_coeff[delay_line][i];
+        }
+    }
+
     for (u32 sample_index = 0; sample_index < sample_count; sample_index++) {
         Common::FixedPoint<50, 14> early_to_late_tap{
             state.early_delay_line.TapOut(state.early_to_late_taps)};
         std::array<Common::FixedPoint<50, 14>, NumChannels> output_samples{};
 
         for (u32 early_tap = 0; early_tap < I3dl2ReverbInfo::MaxDelayTaps; early_tap++) {
-            output_samples[tap_indexes[early_tap]] +=
-                state.early_delay_line.TapOut(state.early_tap_steps[early_tap]) *
-                EarlyGains[early_tap];
+            const auto sample{state.early_delay_line.TapOut(state.early_tap_steps[early_tap]) *
+                              EarlyGainsFixed[early_tap]};
+            output_samples[tap_indexes[early_tap]] += sample;
             if constexpr (NumChannels == 6) {
-                output_samples[static_cast<u32>(Channels::LFE)] +=
-                    state.early_delay_line.TapOut(state.early_tap_steps[early_tap]) *
-                    EarlyGains[early_tap];
+                output_samples[static_cast<u32>(Channels::LFE)] += sample;
             }
         }
 
@@ -293,29 +313,30 @@ static void ApplyI3dl2ReverbEffect(I3dl2ReverbInfo::State& state,
         }
 
         state.lowpass_0 =
-            (current_sample * state.lowpass_2 + state.lowpass_0 * state.lowpass_1).to_float();
+            (current_sample * lowpass_2 + state.lowpass_0 * state.lowpass_1).to_float();
         state.early_delay_line.Tick(state.lowpass_0);
 
         for (u32 channel = 0; channel < NumChannels; channel++) {
-            output_samples[channel] *= state.early_gain;
+            output_samples[channel] *= early_gain;
         }
 
         std::array<Common::FixedPoint<50, 14>, I3dl2ReverbInfo::MaxDelayLines> filtered_samples{};
         for (u32 delay_line = 0; delay_line < I3dl2ReverbInfo::MaxDelayLines; delay_line++) {
+            const auto fdn_sample{state.fdn_delay_lines[delay_line].Read()};
             filtered_samples[delay_line] =
-                state.fdn_delay_lines[delay_line].Read() * state.lowpass_coeff[delay_line][0] +
-                state.shelf_filter[delay_line];
+                fdn_sample * lowpass_coeff[delay_line][0] + state.shelf_filter[delay_line];
             state.shelf_filter[delay_line] =
-                (filtered_samples[delay_line] * state.lowpass_coeff[delay_line][2] +
-                 state.fdn_delay_lines[delay_line].Read() * state.lowpass_coeff[delay_line][1])
+                (filtered_samples[delay_line] * lowpass_coeff[delay_line][2] +
+                 fdn_sample * lowpass_coeff[delay_line][1])
                     .to_float();
         }
 
+        const auto late_sample{early_to_late_tap * late_gain};
         const std::array<Common::FixedPoint<50, 14>, I3dl2ReverbInfo::MaxDelayLines> mix_matrix{
-            filtered_samples[1] + filtered_samples[2] + early_to_late_tap * state.late_gain,
-            -filtered_samples[0] - filtered_samples[3] + early_to_late_tap * state.late_gain,
-            filtered_samples[0] - filtered_samples[3] + early_to_late_tap * state.late_gain,
-            filtered_samples[1] - filtered_samples[2] + early_to_late_tap * state.late_gain,
+            filtered_samples[1] + filtered_samples[2] + late_sample,
+            -filtered_samples[0] - filtered_samples[3] + late_sample,
+            filtered_samples[0] - filtered_samples[3] + late_sample,
+            filtered_samples[1] - filtered_samples[2] + late_sample,
         };
 
         std::array<Common::FixedPoint<50, 14>, I3dl2ReverbInfo::MaxDelayLines> allpass_samples{};
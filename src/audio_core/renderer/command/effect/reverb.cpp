@@ -312,6 +312,18 @@ static void ApplyReverbEffect(const ReverbInfo::ParameterVersion2& params, Rever
         tap_indexes = OutTapIndexes6Ch;
     }
 
+    // The gains are constant over the whole buffer, convert them once rather than every sample
+    const auto base_gain{Common::FixedPoint<50, 14>::from_base(params.base_gain)};
+    const auto late_gain{Common::FixedPoint<50, 14>::from_base(params.late_gain)};
+    const auto dry_gain{Common::FixedPoint<50, 14>::from_base(params.dry_gain)};
+    const auto wet_gain{Common::FixedPoint<50, 14>::from_base(params.wet_gain)};
+
+    // Dividing a FixedPoint by an integer goes through a 128-bit division of the shifted raw
+    // value, dividing the raw value directly truncates the same way.
+    const auto scale_wet = [](Common::FixedPoint<50, 14> sample) {
+        return Common::FixedPoint<50, 14>::from_base(sample.to_raw() / 64);
+    };
+
     for (u32 sample_index = 0; sample_index < sample_count; sample_index++) {
         std::array<Common::FixedPoint<50, 14>, NumChannels> output_samples{};
 
@@ -334,7 +346,7 @@ static void ApplyReverbEffect(const ReverbInfo::ParameterVersion2& params, Rever
         }
 
         input_sample *= 64;
-        input_sample *= Common::FixedPoint<50, 14>::from_base(params.base_gain);
+        input_sample *= base_gain;
         state.pre_delay_line.Write(input_sample);
 
         for (u32 i = 0; i < ReverbInfo::MaxDelayLines; i++) {
@@ -343,9 +355,8 @@ static void ApplyReverbEffect(const ReverbInfo::ParameterVersion2& params, Rever
                 state.fdn_delay_lines[i].Read() * state.hf_decay_gain[i];
         }
 
-        Common::FixedPoint<50, 14> pre_delay_sample{
-            state.pre_delay_line.TapOut(state.pre_delay_time) *
-            Common::FixedPoint<50, 14>::from_base(params.late_gain)};
+        const Common::FixedPoint<50, 14> pre_delay_sample{
+            state.pre_delay_line.TapOut(state.pre_delay_time) * late_gain};
 
         std::array<Common::FixedPoint<50, 14>, ReverbInfo::MaxDelayLines> mix_matrix{
             state.prev_feedback_output[2] + state.prev_feedback_output[1] + pre_delay_sample,
@@ -360,9 +371,6 @@ static void ApplyReverbEffect(const ReverbInfo::ParameterVersion2& params, Rever
                                                   state.fdn_delay_lines[i], mix_matrix[i]);
         }
 
-        const auto dry_gain{Common::FixedPoint<50, 14>::from_base(params.dry_gain)};
-        const auto wet_gain{Common::FixedPoint<50, 14>::from_base(params.wet_gain)};
-
         if constexpr (NumChannels == 6) {
             const std::array<Common::FixedPoint<50, 14>, MaxChannels> allpass_outputs{
                 allpass_samples[0], allpass_samples[1], allpass_samples[2] - allpass_samples[3],
@@ -379,14 +387,14 @@ static void ApplyReverbEffect(const ReverbInfo::ParameterVersion2& params, Rever
                     allpass = allpass_outputs[channel];
                 }
 
-                auto out_sample{((output_samples[channel] + allpass) * wet_gain) / 64};
+                auto out_sample{scale_wet((output_samples[channel] + allpass) * wet_gain)};
                 outputs[channel][sample_index] = (in_sample + out_sample).to_int();
             }
         } else {
             for (u32 channel = 0; channel < NumChannels; channel++) {
                 auto in_sample{inputs[channel][sample_index] * dry_gain};
-                auto out_sample{((output_samples[channel] + allpass_samples[channel]) * wet_gain) /
-                                64};
+                auto out_sample{
+                    scale_wet((output_samples[channel] + allpass_samples[channel]) * wet_gain)};
                 outputs[channel][sample_index] = (in_sample + out_sample).to_int();
             }
         }
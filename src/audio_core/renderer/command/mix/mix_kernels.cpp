@@ -0,0 +1,219 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <array>
+#include <limits>
+
+#if defined(ARCHITECTURE_x86_64)
+#include <immintrin.h>
+#elif defined(ARCHITECTURE_arm64)
+#include <arm_neon.h>
+#endif
+
+#include "audio_core/renderer/command/mix/mix_kernels.h"
+#ifdef ARCHITECTURE_x86_64
+#include "common/cpu_features.h"
+#endif
+
+namespace AudioCore::Renderer {
+namespace {
+
+// The output sample is (output << Q) + product shifted back by Q. The low Q bits of the first
+// term are zero, so the rounding only depends on the product and the output can be added after
+// the shift. Only the low 32 bits of the shifted product are kept, which a logical shift gives
+// just as well as an arithmetic one, so each lane needs one 32x32->64 multiply, a few adds and
+// shifts in 64-bit lanes.
+
+template <bool Accumulate>
+void ProcessGeneric(s32* output, const s32* input, s64 volume, s64 ramp, u32 q, u32 count) {
+    for (u32 i = 0; i < count; i++) {
+        const s32 sample = ScaleSample(input[i], volume, q);
+        if constexpr (Accumulate) {
+            output[i] = static_cast<s32>(static_cast<u32>(output[i]) + static_cast<u32>(sample));
+        } else {
+            output[i] = sample;
+        }
+        volume += ramp;
+    }
+}
+
+/// Volumes of the first lanes, wrapping like the s32 lanes of the vector units do
+template <size_t N>
+std::array<s32, N> LaneVolumes(s32 volume, s32 ramp) {
+    std::array<s32, N> volumes{};
+    for (size_t i = 0; i < N; i++) {
+        volumes[i] = static_cast<s32>(static_cast<u32>(volume) +
+                                      static_cast<u32>(ramp) * static_cast<u32>(i));
+    }
+    return volumes;
+}
+
+constexpr s32 LaneStep(s32 ramp, u32 lanes) {
+    return static_cast<s32>(static_cast<u32>(ramp) * lanes);
+}
+
+#if defined(ARCHITECTURE_x86_64) && (defined(__GNUC__) || defined(__clang__))
+#define SSE41_TARGET __attribute__((target("sse4.1")))
+#define AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define SSE41_TARGET
+#define AVX2_TARGET
+#endif
+
+#ifdef ARCHITECTURE_x86_64
+SSE41_TARGET __m128i ScaleSSE41(__m128i products, __m128i fractional_mask, __m128i shift) {
+    const __m128i rounding = _mm_srli_epi64(_mm_and_si128(products, fractional_mask), 1);
+    return _mm_srl_epi64(_mm_add_epi64(products, rounding), shift);
+}
+
+AVX2_TARGET __m256i ScaleAVX2(__m256i products, __m256i fractional_mask, __m128i shift) {
+    const __m256i rounding = _mm256_srli_epi64(_mm256_and_si256(products, fractional_mask), 1);
+    return _mm256_srl_epi64(_mm256_add_epi64(products, rounding), shift);
+}
+
+template <bool Accumulate>
+SSE41_TARGET u32 ProcessSSE41(s32* output, const s32* input, s32 volume, s32 ramp, u32 q,
+                              u32 count) {
+    const __m128i shift = _mm_cvtsi32_si128(static_cast<int>(q));
+    const __m128i fractional_mask = _mm_set1_epi64x((s64{1} << q) - 1);
+
+    const auto lanes = LaneVolumes<4>(volume, ramp);
+    __m128i volumes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lanes.data()));
+    const __m128i step = _mm_set1_epi32(LaneStep(ramp, 4));
+
+    u32 i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        const __m128i even = ScaleSSE41(_mm_mul_epi32(samples, volumes), fractional_mask, shift);
+        const __m128i odd =
+            ScaleSSE41(_mm_mul_epi32(_mm_srli_epi64(samples, 32), _mm_srli_epi64(volumes, 32)),
+                       fractional_mask, shift);
+        __m128i result = _mm_blend_epi16(even, _mm_slli_epi64(odd, 32), 0xCC);
+        if constexpr (Accumulate) {
+            result = _mm_add_epi32(
+                result, _mm_loadu_si128(reinterpret_cast<const __m128i*>(output + i)));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), result);
+        volumes = _mm_add_epi32(volumes, step);
+    }
+    return i;
+}
+
+template <bool Accumulate>
+AVX2_TARGET u32 ProcessAVX2(s32* output, const s32* input, s32 volume, s32 ramp, u32 q,
+                            u32 count) {
+    const __m128i shift = _mm_cvtsi32_si128(static_cast<int>(q));
+    const __m256i fractional_mask = _mm256_set1_epi64x((s64{1} << q) - 1);
+
+    const auto lanes = LaneVolumes<8>(volume, ramp);
+    __m256i volumes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lanes.data()));
+    const __m256i step = _mm256_set1_epi32(LaneStep(ramp, 8));
+
+    u32 i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256i samples = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+        const __m256i even =
+            ScaleAVX2(_mm256_mul_epi32(samples, volumes), fractional_mask, shift);
+        const __m256i odd = ScaleAVX2(
+            _mm256_mul_epi32(_mm256_srli_epi64(samples, 32), _mm256_srli_epi64(volumes, 32)),
+            fractional_mask, shift);
+        __m256i result = _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+        if constexpr (Accumulate) {
+            result = _mm256_add_epi32(
+                result, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(output + i)));
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), result);
+        volumes = _mm256_add_epi32(volumes, step);
+    }
+    return i;
+}
+#endif
+
+#ifdef ARCHITECTURE_arm64
+int32x2_t ScaleNEON(int64x2_t products, int64x2_t fractional_mask, int64x2_t shift) {
+    const int64x2_t rounding = vshrq_n_s64(vandq_s64(products, fractional_mask), 1);
+    return vmovn_s64(vshlq_s64(vaddq_s64(products, rounding), shift));
+}
+
+template <bool Accumulate>
+u32 ProcessNEON(s32* output, const s32* input, s32 volume, s32 ramp, u32 q, u32 count) {
+    const int64x2_t shift = vdupq_n_s64(-static_cast<s64>(q));
+    const int64x2_t fractional_mask = vdupq_n_s64((s64{1} << q) - 1);
+
+    const auto lanes = LaneVolumes<4>(volume, ramp);
+    int32x4_t volumes = vld1q_s32(lanes.data());
+    const int32x4_t step = vdupq_n_s32(LaneStep(ramp, 4));
+
+    u32 i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const int32x4_t samples = vld1q_s32(input + i);
+        const int32x2_t low = ScaleNEON(vmull_s32(vget_low_s32(samples), vget_low_s32(volumes)),
+                                        fractional_mask, shift);
+        const int32x2_t high = ScaleNEON(vmull_high_s32(samples, volumes), fractional_mask, shift);
+        int32x4_t result = vcombine_s32(low, high);
+        if constexpr (Accumulate) {
+            result = vaddq_s32(result, vld1q_s32(output + i));
+        }
+        vst1q_s32(output + i, result);
+        volumes = vaddq_s32(volumes, step);
+    }
+    return i;
+}
+#endif
+
+using KernelFunc = u32 (*)(s32* output, const s32* input, s32 volume, s32 ramp, u32 q, u32 count);
+
+template <bool Accumulate>
+KernelFunc SelectKernel() {
+#if defined(ARCHITECTURE_x86_64)
+    if (Common::g_cpu_caps.avx2) {
+        return &ProcessAVX2<Accumulate>;
+    }
+    if (Common::g_cpu_caps.sse4_1) {
+        return &ProcessSSE41<Accumulate>;
+    }
+#elif defined(ARCHITECTURE_arm64)
+    return &ProcessNEON<Accumulate>;
+#endif
+    return nullptr;
+}
+
+/// The vector kernels multiply 32-bit volumes, check every volume of the ramp fits
+bool FitsVectorLanes(s64 volume, s64 ramp, u32 count) {
+    constexpr s64 min = std::numeric_limits<s32>::min();
+    constexpr s64 max = std::numeric_limits<s32>::max();
+    if (count == 0 || volume < min || volume > max || ramp < min || ramp > max) {
+        return false;
+    }
+    const s64 last_volume = volume + ramp * static_cast<s64>(count - 1);
+    return last_volume >= min && last_volume <= max;
+}
+
+template <bool Accumulate>
+void Process(std::span<s32> output, std::span<const s32> input, s64 volume, s64 ramp, u32 q,
+             u32 sample_count) {
+    static const KernelFunc kernel = SelectKernel<Accumulate>();
+
+    u32 done = 0;
+    if (kernel && FitsVectorLanes(volume, ramp, sample_count)) {
+        done = kernel(output.data(), input.data(), static_cast<s32>(volume),
+                      static_cast<s32>(ramp), q, sample_count);
+    }
+    ProcessGeneric<Accumulate>(output.data() + done, input.data() + done,
+                               volume + ramp * static_cast<s64>(done), ramp, q,
+                               sample_count - done);
+}
+
+} // Anonymous namespace
+
+void MixSamples(std::span<s32> output, std::span<const s32> input, s64 volume, s64 ramp, u32 q,
+                u32 sample_count) {
+    Process<true>(output, input, volume, ramp, q, sample_count);
+}
+
+void ScaleSamples(std::span<s32> output, std::span<const s32> input, s64 volume, s64 ramp, u32 q,
+                  u32 sample_count) {
+    Process<false>(output, input, volume, ramp, q, sample_count);
+}
+
+} // namespace AudioCore::Renderer
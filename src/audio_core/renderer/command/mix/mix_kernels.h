@@ -0,0 +1,47 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <span>
+
+#include "common/common_types.h"
+
+namespace AudioCore::Renderer {
+
+/**
+ * Returns (sample * volume).to_int() computed with Common::FixedPoint<64 - Q, Q>.
+ *
+ * @param sample - Input sample.
+ * @param volume - Raw fixed point volume.
+ * @param q      - Number of fractional bits of the volume.
+ */
+constexpr s32 ScaleSample(s32 sample, s64 volume, u32 q) {
+    const s64 product = static_cast<s64>(static_cast<u64>(s64{sample}) * static_cast<u64>(volume));
+    const s64 fractional_mask = (s64{1} << q) - 1;
+    return static_cast<s32>((product + ((product & fractional_mask) >> 1)) >> q);
+}
+
+/**
+ * Adds the input mix buffer, scaled by a ramping volume, to the output mix buffer.
+ * The result is bit exact with (output[i] + input[i] * volume).to_int() computed with
+ * Common::FixedPoint<64 - Q, Q>, adding ramp to the volume after every sample.
+ * Uses the widest vector unit of the host when the volumes fit its lanes.
+ *
+ * @param output       - Output mix buffer.
+ * @param input        - Input mix buffer, may be the output buffer.
+ * @param volume       - Raw fixed point volume of the first sample.
+ * @param ramp         - Raw fixed point amount added to the volume every sample.
+ * @param q            - Number of fractional bits of the volume, at most 31.
+ * @param sample_count - Number of samples to process.
+ */
+void MixSamples(std::span<s32> output, std::span<const s32> input, s64 volume, s64 ramp, u32 q,
+                u32 sample_count);
+
+/**
+ * Like MixSamples, but overwrites the output with the scaled input instead of adding to it.
+ */
+void ScaleSamples(std::span<s32> output, std::span<const s32> input, s64 volume, s64 ramp, u32 q,
+                  u32 sample_count);
+
+} // namespace AudioCore::Renderer
@@ -5,6 +5,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "audio_core/adsp/apps/audio_renderer/command_list_processor.h"
+#include "audio_core/renderer/command/mix/mix_kernels.h"
 #include "audio_core/renderer/command/mix/mix_ramp.h"
 #include "common/fixed_point.h"
 #include "common/logging.h"
@@ -14,23 +15,18 @@ namespace AudioCore::Renderer {
 template <size_t Q>
 s32 ApplyMixRamp(std::span<s32> output, std::span<const s32> input, const f32 volume_,
                  const f32 ramp_, const u32 sample_count) {
-    Common::FixedPoint<64 - Q, Q> volume{volume_};
-    Common::FixedPoint<64 - Q, Q> sample{0};
-
-    if (ramp_ == 0.0f) {
-        for (u32 i = 0; i < sample_count; i++) {
-            sample = input[i] * volume;
-            output[i] = (output[i] + sample).to_int();
-        }
-    } else {
-        Common::FixedPoint<64 - Q, Q> ramp{ramp_};
-        for (u32 i = 0; i < sample_count; i++) {
-            sample = input[i] * volume;
-            output[i] = (output[i] + sample).to_int();
-            volume += ramp;
-        }
+    if (sample_count == 0) {
+        return 0;
     }
-    return sample.to_int();
+
+    const s64 volume = Common::FixedPoint<64 - Q, Q>{volume_}.to_raw();
+    const s64 ramp = Common::FixedPoint<64 - Q, Q>{ramp_}.to_raw();
+
+    // The input may be the output buffer, take the last input sample before it is mixed.
+    const s32 last_sample = ScaleSample(input[sample_count - 1],
+                                        volume + ramp * static_cast<s64>(sample_count - 1), Q);
+    MixSamples(output, input, volume, ramp, Q, sample_count);
+    return last_sample;
 }
 
 template s32 ApplyMixRamp<15>(std::span<s32>, std::span<const s32>, f32, f32, u32);
@@ -1,10 +1,64 @@
 // SPDX-FileCopyrightText: Copyright 2022 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#if defined(ARCHITECTURE_x86_64)
+#include <emmintrin.h>
+#elif defined(ARCHITECTURE_arm64)
+#include <arm_neon.h>
+#endif
+
 #include "audio_core/renderer/command/resample/resample.h"
 
 namespace AudioCore::Renderer {
 
+/**
+ * Apply one phase of a polyphase filter, returning the floored sum of the taps in Q8.
+ * Every tap is converted to Common::FixedPoint<56, 8> before the sum, like the game's resampler,
+ * which the vector paths reproduce by truncating the scaled products to integers lane by lane.
+ *
+ * @tparam Taps  - Number of filter taps, 4 or 8.
+ * @param input  - First input sample of the phase.
+ * @param coeffs - Filter coefficients of the phase.
+ * @return The filtered sample.
+ */
+template <size_t Taps>
+static s32 ApplyFilter(const s16* input, const f32* coeffs) {
+    static_assert(Taps == 4 || Taps == 8);
+#if defined(ARCHITECTURE_x86_64)
+    const auto taps = [&](size_t offset) {
+        const __m128i packed =
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(input + offset));
+        const __m128i samples = _mm_srai_epi32(_mm_unpacklo_epi16(packed, packed), 16);
+        const __m128 products = _mm_mul_ps(_mm_cvtepi32_ps(samples), _mm_loadu_ps(coeffs + offset));
+        return _mm_cvttps_epi32(_mm_mul_ps(products, _mm_set1_ps(256.0f)));
+    };
+    __m128i sum = taps(0);
+    if constexpr (Taps == 8) {
+        sum = _mm_add_epi32(sum, taps(4));
+    }
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(1, 0, 3, 2)));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(sum) >> 8;
+#elif defined(ARCHITECTURE_arm64)
+    const auto taps = [&](size_t offset) {
+        const int32x4_t samples = vmovl_s16(vld1_s16(input + offset));
+        const float32x4_t products = vmulq_f32(vcvtq_f32_s32(samples), vld1q_f32(coeffs + offset));
+        return vcvtq_s32_f32(vmulq_n_f32(products, 256.0f));
+    };
+    int32x4_t sum = taps(0);
+    if constexpr (Taps == 8) {
+        sum = vaddq_s32(sum, taps(4));
+    }
+    return vaddvq_s32(sum) >> 8;
+#else
+    Common::FixedPoint<56, 8> sum{0};
+    for (size_t i = 0; i < Taps; i++) {
+        sum += Common::FixedPoint<56, 8>{input[i] * coeffs[i]};
+    }
+    return sum.to_int_floor();
+#endif
+}
+
 static void ResampleLowQuality(std::span<s32> output, std::span<const s16> input,
                                const Common::FixedPoint<49, 15>& sample_rate_ratio,
                                Common::FixedPoint<49, 15>& fraction, const u32 samples_to_write) {
@@ -296,11 +350,7 @@ static void ResampleNormalQuality(std::span<s32> output, std::span<const s16> in
     u32 read_index{0};
     for (u32 i = 0; i < samples_to_write; i++) {
         const auto lut_index{(fraction.get_frac() >> 8) * 4};
-        const Common::FixedPoint<56, 8> sample0{input[read_index + 0] * lut[lut_index + 0]};
-        const Common::FixedPoint<56, 8> sample1{input[read_index + 1] * lut[lut_index + 1]};
-        const Common::FixedPoint<56, 8> sample2{input[read_index + 2] * lut[lut_index + 2]};
-        const Common::FixedPoint<56, 8> sample3{input[read_index + 3] * lut[lut_index + 3]};
-        output[i] = (sample0 + sample1 + sample2 + sample3).to_int_floor();
+        output[i] = ApplyFilter<4>(&input[read_index], &lut[lut_index]);
         fraction += sample_rate_ratio;
         read_index += static_cast<u32>(fraction.to_int_floor());
         fraction.clear_int();
@@ -846,16 +896,7 @@ static void ResampleHighQuality(std::span<s32> output, std::span<const s16> inpu
     u32 read_index{0};
     for (u32 i = 0; i < samples_to_write; i++) {
         const auto lut_index{(fraction.get_frac() >> 8) * 8};
-        const Common::FixedPoint<56, 8> sample0{input[read_index + 0] * lut[lut_index + 0]};
-        const Common::FixedPoint<56, 8> sample1{input[read_index + 1] * lut[lut_index + 1]};
-        const Common::FixedPoint<56, 8> sample2{input[read_index + 2] * lut[lut_index + 2]};
-        const Common::FixedPoint<56, 8> sample3{input[read_index + 3] * lut[lut_index + 3]};
-        const Common::FixedPoint<56, 8> sample4{input[read_index + 4] * lut[lut_index + 4]};
-        const Common::FixedPoint<56, 8> sample5{input[read_index + 5] * lut[lut_index + 5]};
-        const Common::FixedPoint<56, 8> sample6{input[read_index + 6] * lut[lut_index + 6]};
-        const Common::FixedPoint<56, 8> sample7{input[read_index + 7] * lut[lut_index + 7]};
-        output[i] = (sample0 + sample1 + sample2 + sample3 + sample4 + sample5 + sample6 + sample7)
-                        .to_int_floor();
+        output[i] = ApplyFilter<8>(&input[read_index], &lut[lut_index]);
         fraction += sample_rate_ratio;
         read_index += static_cast<u32>(fraction.to_int_floor());
         fraction.clear_int();
@@ -641,6 +641,7 @@ u64 System::GenerateCommand(std::span<u8> in_command_buffer,
     auto command_list_header{reinterpret_cast<CommandListHeader*>(in_command_buffer.data())};
 
     command_list_header->buffer_count = static_cast<s16>(voice_channels + mix_buffer_count);
+    command_list_header->mix_buffer_count = mix_buffer_count;
     command_list_header->sample_count = sample_count;
     command_list_header->sample_rate = sample_rate;
     command_list_header->samples_buffer = samples_workbuffer;
@@ -691,7 +692,10 @@ u64 System::GenerateCommand(std::span<u8> in_command_buffer,
                                        sink_context,   splitter_context,     perf_manager};
 
     voice_context.SortInfo();
+    command_list_header->voice_command_start = command_buffer.count;
     command_generator.GenerateVoiceCommands();
+    command_list_header->voice_command_count =
+        command_buffer.count - command_list_header->voice_command_start;
 
     const auto start_estimated_time{drop_voice_param *
                                     static_cast<f32>(command_buffer.estimated_process_time)};
@@ -28,7 +28,7 @@ void SystemManager::InitializeUnsafe() {
         audio_renderer.Start();
         thread = std::jthread([this](std::stop_token stop_token) {
             Common::SetCurrentThreadName("AudioRenderSystemManager");
-            Common::SetCurrentThreadPriority(Common::ThreadPriority::High);
+            Common::SetCurrentThreadRole(Common::ThreadRole::Audio);
             while (active && !stop_token.stop_requested()) {
                 {
                     std::scoped_lock l{mutex1};
@@ -410,6 +410,9 @@ public:
     u16 wave_buffer_index{};
     /// Flags controlling decode behavior
     u16 flags{};
+    /// Set in flags by the command generator when the voice cannot be heard on this frame, its
+    /// data source commands then only advance the playback state
+    static constexpr u16 SkipOutputFlag = 1 << 2;
     /// Game memory for ADPCM coefficients
     AddressInfo data_address{0, 0};
     /// Wavebuffers
@@ -21,9 +21,7 @@ public:
         : SinkStream{system_, type_} {}
     ~NullSinkStreamImpl() override {}
     void AppendBuffer(SinkBuffer&, std::span<s16>) override {}
-    std::vector<s16> ReleaseBuffer(u64) override {
-        return {};
-    }
+    void ReleaseBuffer(std::span<s16>) override {}
 };
 
 /**
@@ -4,6 +4,7 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <memory>
@@ -60,13 +61,14 @@ void SinkStream::AppendBuffer(SinkBuffer& buffer, std::span<s16> samples) {
         queue.EmplaceWait(buffer);
         samples_buffer.Push(samples.subspan(0, samples.size() / system_channels * device_channels));
     } else if (system_channels < device_channels) {
-        std::vector<s16> new_samples(samples.size() / system_channels * device_channels);
+        upmix_buffer.resize_destructive(samples.size() / system_channels * device_channels);
+        std::fill(upmix_buffer.begin(), upmix_buffer.end(), s16{0});
         for (u32 r_offs = 0, w_offs = 0; r_offs < samples.size(); r_offs += system_channels, w_offs += device_channels)
             for (u32 channel = 0; channel < system_channels; ++channel)
-                new_samples[w_offs + channel] = s16(std::clamp(s32(f32(samples[r_offs + channel]) * volume), min, max));
+                upmix_buffer[w_offs + channel] = s16(std::clamp(s32(f32(samples[r_offs + channel]) * volume), min, max));
 
         queue.EmplaceWait(buffer);
-        samples_buffer.Push(new_samples);
+        samples_buffer.Push(upmix_buffer.data(), upmix_buffer.size());
     } else {
         if (volume != 1.0f) {
             for (u32 i = 0; i < samples.size(); ++i)
@@ -80,8 +82,8 @@ void SinkStream::AppendBuffer(SinkBuffer& buffer, std::span<s16> samples) {
     ++queued_buffers;
 }
 
-std::vector<s16> SinkStream::ReleaseBuffer(u64 num_samples) {
-    auto samples{samples_buffer.Pop(num_samples)};
+void SinkStream::ReleaseBuffer(std::span<s16> output) {
+    const auto samples_read{samples_buffer.Pop(output.data(), output.size())};
 
     // TODO: Up-mix to 6 channels if the game expects it.
     // For audio input this is unlikely to ever be the case though.
@@ -91,18 +93,17 @@ std::vector<s16> SinkStream::ReleaseBuffer(u64 num_samples) {
     constexpr s32 min = (std::numeric_limits<s16>::min)();
     constexpr s32 max = (std::numeric_limits<s16>::max)();
     auto volume{system_volume * device_volume * 8};
-    for (u32 i = 0; i < samples.size(); i++)
-        samples[i] = s16(std::clamp(s32(f32(samples[i]) * volume), min, max));
+    for (size_t i = 0; i < samples_read; i++)
+        output[i] = s16(std::clamp(s32(f32(output[i]) * volume), min, max));
 
-    if (samples.size() < num_samples)
-        samples.resize(num_samples, 0);
-    return samples;
+    std::fill(output.begin() + samples_read, output.end(), s16{0});
 }
 
 void SinkStream::ClearQueue() {
     std::scoped_lock lk{release_mutex};
 
-    samples_buffer.Pop();
+    // The backend callback may be popping at the same time, let it skip the samples instead
+    samples_buffer.Clear();
     SinkBuffer tmp;
     while (queue.TryPop(tmp));
 
@@ -115,44 +116,18 @@ void SinkStream::ProcessAudioIn(std::span<const s16> input_buffer, std::size_t n
     const std::size_t num_channels = GetDeviceChannels();
     const std::size_t frame_size = num_channels;
     const std::size_t frame_size_bytes = frame_size * sizeof(s16);
-    size_t frames_written{0};
 
     // If we're paused or going to shut down, we don't want to consume buffers as coretiming is
     // paused and we'll desync, so just return.
     if (system.IsPaused() || system.IsShuttingDown())
         return;
 
-    while (frames_written < num_frames) {
-        // If the playing buffer has been consumed or has no frames, we need a new one
-        if (playing_buffer.consumed || playing_buffer.frames == 0) {
-            if (!queue.TryPop(playing_buffer)) {
-                // If no buffer was available we've underrun, just push the samples and
-                // continue.
-                samples_buffer.Push(&input_buffer[frames_written * frame_size], (num_frames - frames_written) * frame_size);
-                frames_written = num_frames;
-                continue;
-            }
-            // Successfully dequeued a new buffer.
-            queued_buffers--;
-        }
-
-        // Get the minimum frames available between the currently playing buffer, and the
-        // amount we have left to fill
-        size_t frames_available{std::min<u64>(playing_buffer.frames - playing_buffer.frames_played, num_frames - frames_written)};
-
-        samples_buffer.Push(&input_buffer[frames_written * frame_size], frames_available * frame_size);
-
-        frames_written += frames_available;
-        playing_buffer.frames_played += frames_available;
-
-        // If that's all the frames in the current buffer, add its samples and mark it as
-        // consumed
-        if (playing_buffer.frames_played >= playing_buffer.frames)
-            playing_buffer.consumed = true;
-    }
+    // No buffers are queued for audio in, the recorded samples go straight into the ring, and are
+    // popped into the guest's buffers as they are released. Anything past a full ring is dropped.
+    samples_buffer.Push(input_buffer.data(), num_frames * frame_size);
 
-    if (frames_written > 0) {
-        std::memcpy(&last_frame[0], &input_buffer[(frames_written - 1) * frame_size], frame_size_bytes);
+    if (num_frames > 0) {
+        std::memcpy(&last_frame[0], &input_buffer[(num_frames - 1) * frame_size], frame_size_bytes);
     }
 
     // update sample counts fuer audio-ins
@@ -160,7 +135,7 @@ void SinkStream::ProcessAudioIn(std::span<const s16> input_buffer, std::size_t n
         std::scoped_lock lk{sample_count_lock};
         last_sample_count_update_time = system.CoreTiming().GetGlobalTimeNs();
         min_played_sample_count = max_played_sample_count;
-        max_played_sample_count += frames_written;
+        max_played_sample_count += num_frames;
     }
 }
 
@@ -182,12 +157,14 @@ void SinkStream::ProcessAudioOutAndRender(std::span<s16> output_buffer, std::siz
         return;
     }
 
+    bool underrun{false};
     while (frames_written < num_frames) {
         if (playing_buffer.consumed || playing_buffer.frames == 0) {
             std::unique_lock lk{release_mutex};
 
             if (!queue.TryPop(playing_buffer)) {
                 lk.unlock();
+                underrun = !paused;
                 for (size_t i = frames_written; i < num_frames; i++)
                     std::memcpy(&output_buffer[i * frame_size], last_frame.data(), frame_size_bytes);
                 frames_written = num_frames;
@@ -219,6 +196,32 @@ void SinkStream::ProcessAudioOutAndRender(std::span<s16> output_buffer, std::siz
         min_played_sample_count = max_played_sample_count;
         max_played_sample_count += actual_frames_written;
     }
+
+    if (underrun) {
+        ++underrun_count;
+    }
+    if (Settings::values.low_latency_audio.GetValue()) {
+        UpdateTargetQueueSize(num_frames, underrun);
+    }
+}
+
+void SinkStream::UpdateTargetQueueSize(std::size_t num_frames, bool underrun) {
+    // Always keep enough buffers queued to fill one backend callback, plus one being rendered.
+    const auto callback_buffers{
+        static_cast<u32>((num_frames + TargetSampleCount - 1) / TargetSampleCount)};
+    const auto max_target{(std::max)(max_queue_size, 2U)};
+    const auto min_target{(std::min)(callback_buffers + 1, max_target)};
+
+    auto target{target_queue_size.load()};
+    if (underrun) {
+        target += 1;
+        callbacks_without_underrun = 0;
+    } else if (++callbacks_without_underrun * num_frames >= TargetSampleRate * 2) {
+        // Two seconds without an underrun, try with one buffer less.
+        target -= target > min_target ? 1 : 0;
+        callbacks_without_underrun = 0;
+    }
+    target_queue_size = std::clamp(target, min_target, max_target);
 }
 
 u64 SinkStream::GetExpectedPlayedSampleCount() {
@@ -234,13 +237,18 @@ u64 SinkStream::GetExpectedPlayedSampleCount() {
 void SinkStream::WaitFreeSpace(std::stop_token stop_token) {
     std::unique_lock lk{release_mutex};
 
-    auto can_continue = [this]() {
-        return paused || queued_buffers < max_queue_size;
+    // In low latency mode the queue follows the backend, with less room to run ahead of it.
+    const bool low_latency{Settings::values.low_latency_audio.GetValue()};
+    const u32 queue_size{low_latency ? target_queue_size.load() : max_queue_size};
+    const u32 queue_slack{low_latency ? 1U : 3U};
+
+    auto can_continue = [this, queue_size]() {
+        return paused || queued_buffers < queue_size;
     };
 
     release_cv.wait_for(lk, std::chrono::milliseconds(7), can_continue);
 
-    if (queued_buffers > max_queue_size + 3) {
+    if (queued_buffers > queue_size + queue_slack) {
         release_cv.wait(lk, stop_token, can_continue);
     }
 }
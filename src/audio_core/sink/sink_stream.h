@@ -19,6 +19,7 @@
 #include "common/common_types.h"
 #include "common/polyfill_thread.h"
 #include "common/ring_buffer.h"
+#include "common/scratch_buffer.h"
 #include "common/thread.h"
 
 namespace Core {
@@ -160,11 +161,21 @@ public:
         return queued_buffers.load();
     }
 
+    /**
+     * Get the number of times the backend ran out of samples since the last call, and reset it.
+     *
+     * @return The number of underruns.
+     */
+    u32 GetAndResetUnderrunCount() {
+        return underrun_count.exchange(0);
+    }
+
     /**
      * Set the maximum buffer queue size.
      */
     void SetRingSize(u32 ring_size) {
         max_queue_size = ring_size;
+        target_queue_size = ring_size;
     }
 
     /**
@@ -177,11 +188,11 @@ public:
 
     /**
      * Release a buffer. Audio In only, will fill a buffer with recorded samples.
+     * Any samples not recorded yet are filled with silence.
      *
-     * @param num_samples - Maximum number of samples to receive.
-     * @return Vector of recorded samples. May have fewer than num_samples.
+     * @param output - Buffer to receive the recorded samples.
      */
-    virtual std::vector<s16> ReleaseBuffer(u64 num_samples);
+    virtual void ReleaseBuffer(std::span<s16> output);
 
     /**
      * Empty out the buffer queue.
@@ -222,6 +233,16 @@ protected:
      */
     void SignalPause();
 
+private:
+    /**
+     * Adjust the number of buffers the renderer may queue in low latency mode, called from the
+     * backend callback.
+     *
+     * @param num_frames - Number of frames requested by the backend this callback.
+     * @param underrun   - Whether the queue ran dry before the request was filled.
+     */
+    void UpdateTargetQueueSize(std::size_t num_frames, bool underrun);
+
 protected:
     /// Core system
     Core::System& system;
@@ -243,12 +264,20 @@ private:
     Common::SPSCQueue<SinkBuffer, 0x10000> queue;
     /// The currently-playing audio buffer
     SinkBuffer playing_buffer{};
+    /// Samples of the appended buffer up-mixed to the device channels
+    Common::ScratchBuffer<s16> upmix_buffer;
     /// The last played (or received) frame of audio, used when the callback underruns
     std::array<s16, MaxChannels> last_frame{};
     /// Number of buffers waiting to be played
     std::atomic<u32> queued_buffers{};
     /// The ring size for audio out buffers (usually 4, rarely 2 or 8)
     u32 max_queue_size{};
+    /// Number of buffers the renderer may queue in low latency mode, at most max_queue_size
+    std::atomic<u32> target_queue_size{};
+    /// Number of backend callbacks since the queue last underran or was shrunk
+    u32 callbacks_without_underrun{};
+    /// Number of backend callbacks which ran out of samples, reset when read
+    std::atomic<u32> underrun_count{};
     /// Locks access to sample count tracking info
     std::mutex sample_count_lock;
     /// Minimum number of total samples that have been played since the last callback
@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <random>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "audio_core/renderer/command/mix/mix_kernels.h"
+#include "common/common_types.h"
+#include "common/fixed_point.h"
+
+namespace {
+using namespace AudioCore::Renderer;
+
+/// Samples of a renderer update at 48kHz, and the mix buffers of a 5.1 submix feeding the final mix
+constexpr u32 SampleCount = 240;
+constexpr u32 BufferCount = 24;
+
+std::vector<std::vector<s32>> RandomBuffers(std::mt19937& rng) {
+    std::uniform_int_distribution<s32> dist(-0x800000, 0x7FFFFF);
+    std::vector<std::vector<s32>> buffers(BufferCount, std::vector<s32>(SampleCount));
+    for (auto& buffer : buffers) {
+        for (s32& sample : buffer) {
+            sample = dist(rng);
+        }
+    }
+    return buffers;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("Mix commands", "[audio_core]") {
+    std::mt19937 rng{1234};
+    const auto inputs = RandomBuffers(rng);
+    auto outputs = RandomBuffers(rng);
+    const s64 volume = Common::FixedPoint<49, 15>{0.7071f}.to_raw();
+    const s64 ramp = Common::FixedPoint<49, 15>{0.0001f}.to_raw();
+
+    BENCHMARK("Mix") {
+        for (u32 i = 0; i < BufferCount; ++i) {
+            MixSamples(outputs[i], inputs[i], volume, 0, 15, SampleCount);
+        }
+        return outputs[0][0];
+    };
+    BENCHMARK("Mix ramp") {
+        for (u32 i = 0; i < BufferCount; ++i) {
+            MixSamples(outputs[i], inputs[i], volume, ramp, 15, SampleCount);
+        }
+        return outputs[0][0];
+    };
+    BENCHMARK("Volume ramp") {
+        for (u32 i = 0; i < BufferCount; ++i) {
+            ScaleSamples(outputs[i], inputs[i], volume, ramp, 15, SampleCount);
+        }
+        return outputs[0][0];
+    };
+}
@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <random>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/lz4_compression.h"
+#include "common/zstd_compression.h"
+
+namespace {
+
+/// Data with some redundancy, like the NSOs and shader caches that go through these paths
+std::vector<u8> CompressibleData(size_t size) {
+    std::mt19937 rng{1234};
+    std::vector<u8> data(size);
+    for (size_t i = 0; i < size; ++i) {
+        data[i] = (rng() % 4 == 0) ? static_cast<u8>(rng()) : static_cast<u8>(i / 64);
+    }
+    return data;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("LZ4", "[common]") {
+    const auto data = CompressibleData(4ULL << 20);
+    const auto compressed = Common::Compression::CompressDataLZ4(data.data(), data.size());
+
+    BENCHMARK("Compress") {
+        return Common::Compression::CompressDataLZ4(data.data(), data.size());
+    };
+    BENCHMARK("Compress HC") {
+        return Common::Compression::CompressDataLZ4HC(data.data(), data.size(), 9);
+    };
+    BENCHMARK("Decompress") {
+        return Common::Compression::DecompressDataLZ4(compressed, data.size());
+    };
+}
+
+TEST_CASE("Zstandard", "[common]") {
+    const auto data = CompressibleData(4ULL << 20);
+    const auto compressed = Common::Compression::CompressDataZSTDDefault(data.data(), data.size());
+
+    BENCHMARK("Compress") {
+        return Common::Compression::CompressDataZSTDDefault(data.data(), data.size());
+    };
+    BENCHMARK("Decompress") {
+        return Common::Compression::DecompressDataZSTD(compressed);
+    };
+}
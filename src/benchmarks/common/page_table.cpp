@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <random>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/multi_level_page_table.h"
+#include "common/page_table.h"
+
+namespace {
+
+constexpr size_t AddressSpaceBits = 39;
+constexpr size_t PageBits = 12;
+constexpr u64 MappedSize = 256ULL << 20;
+constexpr size_t Lookups = 1 << 16;
+
+std::vector<u64> RandomAddresses(u64 size, u32 seed) {
+    std::mt19937_64 rng{seed};
+    std::uniform_int_distribution<u64> dist{0, size - 1};
+    std::vector<u64> addresses(Lookups);
+    for (u64& address : addresses) {
+        address = dist(rng);
+    }
+    return addresses;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("PageTable", "[common]") {
+    Common::PageTable page_table;
+    page_table.Resize(AddressSpaceBits, PageBits);
+    std::vector<u8> backing(MappedSize);
+    for (u64 page = 0; page < (MappedSize >> PageBits); ++page) {
+        page_table.entries[page].ptr.Store(reinterpret_cast<uintptr_t>(backing.data()),
+                                           Common::PageType::Memory);
+        page_table.entries[page].addr = page << PageBits;
+    }
+    const auto addresses = RandomAddresses(MappedSize, 1234);
+
+    BENCHMARK("Pointer lookup") {
+        uintptr_t sum = 0;
+        for (const u64 address : addresses) {
+            const auto [pointer, type] = page_table.entries[address >> PageBits].ptr.PointerType();
+            if (type == Common::PageType::Memory) {
+                sum += pointer + address;
+            }
+        }
+        return sum;
+    };
+
+    BENCHMARK("Physical address lookup") {
+        u64 sum = 0;
+        for (const u64 address : addresses) {
+            Common::PhysicalAddress physical{};
+            if (page_table.GetPhysicalAddress(&physical, address)) {
+                sum += GetInteger(physical);
+            }
+        }
+        return sum;
+    };
+}
+
+TEST_CASE("MultiLevelPageTable", "[common]") {
+    // The layout the GPU memory manager uses for small pages
+    constexpr size_t GpuAddressSpaceBits = 40;
+    constexpr size_t GpuPageBits = 16;
+    Common::MultiLevelPageTable<u32> page_table(GpuAddressSpaceBits,
+                                                GpuAddressSpaceBits + GpuPageBits - 38, GpuPageBits);
+    page_table.ReserveRange(0, MappedSize);
+    for (u64 page = 0; page < (MappedSize >> GpuPageBits); ++page) {
+        page_table[page] = static_cast<u32>(page * 3);
+    }
+    const auto addresses = RandomAddresses(MappedSize, 5678);
+
+    BENCHMARK("Lookup") {
+        u64 sum = 0;
+        for (const u64 address : addresses) {
+            sum += page_table[address >> GpuPageBits];
+        }
+        return sum;
+    };
+}
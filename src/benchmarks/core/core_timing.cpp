@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <array>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/core_timing.h"
+
+namespace {
+
+constexpr size_t NumEvents = 64;
+
+std::optional<std::chrono::nanoseconds> EmptyCallback(s64, std::chrono::nanoseconds) {
+    return std::nullopt;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("CoreTiming", "[core]") {
+    Core::Timing::CoreTiming core_timing;
+    core_timing.SetMulticore(false);
+    core_timing.Initialize([] {});
+
+    std::array<std::shared_ptr<Core::Timing::EventType>, NumEvents> events;
+    for (size_t i = 0; i < events.size(); ++i) {
+        events[i] = Core::Timing::CreateEvent("Event" + std::to_string(i), EmptyCallback);
+    }
+
+    BENCHMARK("Schedule and unschedule") {
+        // Far enough in the future that none of them fires while scheduling
+        for (size_t i = 0; i < events.size(); ++i) {
+            core_timing.ScheduleEvent(std::chrono::seconds{10} + std::chrono::microseconds{i * 37 % 61},
+                                      events[i]);
+        }
+        for (const auto& event : events) {
+            core_timing.UnscheduleEvent(event, Core::Timing::UnscheduleEventType::NoWait);
+        }
+    };
+
+    BENCHMARK("Schedule and advance") {
+        for (size_t i = 0; i < events.size(); ++i) {
+            core_timing.ScheduleEvent(std::chrono::nanoseconds{static_cast<s64>(i)}, events[i]);
+        }
+        core_timing.AddTicks(1'000'000);
+        return core_timing.Advance();
+    };
+}
@@ -0,0 +1,99 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <array>
+#include <span>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "core/core.h"
+#include "core/device_memory.h"
+#include "video_core/engines/maxwell_3d.h"
+#include "video_core/host1x/gpu_device_memory_manager.h"
+#include "video_core/macro.h"
+#include "video_core/memory_manager.h"
+
+namespace {
+using namespace Tegra::Macro;
+using Tegra::Engines::Maxwell3D;
+
+constexpr u32 MacroMethod = 0;
+constexpr u32 LoopCount = 256;
+
+u32 Instruction(Operation operation, ResultOperation result, u32 dst, u32 src_a, s32 immediate,
+                bool is_exit = false) {
+    Opcode opcode{};
+    opcode.operation.Assign(operation);
+    opcode.result_operation.Assign(result);
+    opcode.dst.Assign(dst);
+    opcode.src_a.Assign(src_a);
+    opcode.immediate.Assign(immediate);
+    opcode.is_exit.Assign(is_exit ? 1 : 0);
+    return opcode.raw;
+}
+
+u32 AluInstruction(ALUOperation alu_operation, ResultOperation result, u32 dst, u32 src_a,
+                   u32 src_b) {
+    Opcode opcode{};
+    opcode.operation.Assign(Operation::ALU);
+    opcode.result_operation.Assign(result);
+    opcode.dst.Assign(dst);
+    opcode.src_a.Assign(src_a);
+    opcode.src_b.Assign(src_b);
+    opcode.alu_operation.Assign(alu_operation);
+    return opcode.raw;
+}
+
+u32 BranchInstruction(BranchCondition condition, u32 src_a, s32 target) {
+    Opcode opcode{};
+    opcode.operation.Assign(Operation::Branch);
+    opcode.branch_condition.Assign(condition);
+    opcode.branch_annul.Assign(1);
+    opcode.src_a.Assign(src_a);
+    opcode.immediate.Assign(target);
+    return opcode.raw;
+}
+
+/// Sends a running sum to a register the number of times of its parameter, the shape of the
+/// loops titles use to fill registers from macros
+const std::array<u32, 6> LoopMacro{
+    Instruction(Operation::AddImmediate, ResultOperation::MoveAndSetMethod, 2, 0,
+                MAXWELL3D_REG_INDEX(vertex_buffer.first)),
+    AluInstruction(ALUOperation::Add, ResultOperation::MoveAndSend, 3, 3, 1),
+    Instruction(Operation::AddImmediate, ResultOperation::Move, 1, 1, -1),
+    BranchInstruction(BranchCondition::NotZero, 1, -2),
+    Instruction(Operation::AddImmediate, ResultOperation::Move, 0, 0, 0, true),
+    Instruction(Operation::AddImmediate, ResultOperation::Move, 0, 0, 0),
+};
+
+void BenchmarkMacro(bool is_interpreted, const char* name) {
+    Core::System system;
+    Core::DeviceMemory device_memory;
+    Tegra::MaxwellDeviceMemoryManager device_memory_manager(device_memory);
+    Tegra::MemoryManager memory_manager(system, device_memory_manager);
+    Maxwell3D maxwell3d(memory_manager);
+
+    Tegra::MacroEngine engine(is_interpreted);
+    for (const u32 instruction : LoopMacro) {
+        engine.AddCode(MacroMethod, instruction);
+    }
+    const std::array<u32, 1> parameters{LoopCount};
+    // Compile outside of the measurements
+    engine.Execute(system, maxwell3d, MacroMethod, parameters);
+
+    BENCHMARK(name) {
+        engine.Execute(system, maxwell3d, MacroMethod, parameters);
+        return maxwell3d.regs.vertex_buffer.first;
+    };
+}
+
+} // Anonymous namespace
+
+TEST_CASE("Macro", "[video_core]") {
+    BenchmarkMacro(true, "Interpreter");
+#if defined(ARCHITECTURE_x86_64) || defined(ARCHITECTURE_arm64)
+    BenchmarkMacro(false, "JIT");
+#endif
+}
@@ -0,0 +1,99 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "video_core/surface.h"
+#include "video_core/texture_cache/decode_bc.h"
+#include "video_core/texture_cache/types.h"
+#include "video_core/textures/astc.h"
+#include "video_core/textures/decoders.h"
+
+namespace {
+using VideoCore::Surface::PixelFormat;
+
+constexpr u32 Width = 1024;
+constexpr u32 Height = 1024;
+
+std::vector<u8> RandomBytes(size_t size, u32 seed) {
+    std::mt19937 rng{seed};
+    std::vector<u8> bytes(size);
+    for (u8& byte : bytes) {
+        byte = static_cast<u8>(rng());
+    }
+    return bytes;
+}
+
+void BenchmarkBCn(PixelFormat format, u32 block_size, const char* name) {
+    const auto input = RandomBytes((Width / 4) * (Height / 4) * block_size, 1234);
+    std::vector<u8> output(Width * Height * VideoCommon::ConvertedBytesPerBlock(format));
+    VideoCommon::BufferImageCopy copy{
+        .buffer_offset = 0,
+        .buffer_size = input.size(),
+        .buffer_row_length = Width,
+        .buffer_image_height = Height,
+        .image_subresource = {},
+        .image_offset = {},
+        .image_extent = {Width, Height, 1},
+    };
+    BENCHMARK(name) {
+        VideoCommon::DecompressBCn(input, output, copy, format);
+        return output[0];
+    };
+}
+
+} // Anonymous namespace
+
+TEST_CASE("Texture swizzle", "[video_core]") {
+    using namespace Tegra::Texture;
+    constexpr u32 bytes_per_pixel = 4;
+    constexpr u32 block_height = 4;
+    const auto linear = RandomBytes(Width * Height * bytes_per_pixel, 1234);
+    std::vector<u8> swizzled(CalculateSize(true, bytes_per_pixel, Width, Height, 1, block_height, 0));
+    std::vector<u8> unswizzled(linear.size());
+
+    BENCHMARK("Swizzle") {
+        SwizzleTexture(swizzled, linear, bytes_per_pixel, Width, Height, 1, block_height, 0);
+        return swizzled[0];
+    };
+    BENCHMARK("Unswizzle") {
+        UnswizzleTexture(unswizzled, swizzled, bytes_per_pixel, Width, Height, 1, block_height, 0);
+        return unswizzled[0];
+    };
+    BENCHMARK("Unswizzle subrect") {
+        UnswizzleSubrect(unswizzled, swizzled, bytes_per_pixel, Width, Height, 1, 128, 128, 512,
+                         512, block_height, 0, 512 * bytes_per_pixel);
+        return unswizzled[0];
+    };
+}
+
+TEST_CASE("ASTC decode", "[video_core]") {
+    // Random blocks go through the weight and endpoint decoding of the block modes they hit, and
+    // through the error path for the invalid ones
+    for (const auto [block_width, block_height] : {std::pair{4U, 4U}, std::pair{8U, 8U}}) {
+        const auto input =
+            RandomBytes((Width / block_width) * (Height / block_height) * 16, block_width);
+        std::vector<u8> output(Width * Height * 4);
+        BENCHMARK(block_width == 4 ? "ASTC 4x4" : "ASTC 8x8") {
+            Tegra::Texture::ASTC::Decompress(input, Width, Height, 1, block_width, block_height,
+                                             output);
+            return output[0];
+        };
+    }
+}
+
+TEST_CASE("BCn decode", "[video_core]") {
+    BenchmarkBCn(PixelFormat::BC1_RGBA_UNORM, 8, "BC1");
+    BenchmarkBCn(PixelFormat::BC3_UNORM, 16, "BC3");
+    BenchmarkBCn(PixelFormat::BC4_UNORM, 8, "BC4");
+    BenchmarkBCn(PixelFormat::BC5_UNORM, 16, "BC5");
+    BenchmarkBCn(PixelFormat::BC6H_UFLOAT, 16, "BC6H");
+    BenchmarkBCn(PixelFormat::BC7_UNORM, 16, "BC7");
+}
@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <memory>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "video_core/buffer_cache/word_manager.h"
+
+namespace {
+using namespace VideoCommon;
+
+/// Counts the calls instead of tracking pages, so only the word manager is measured
+struct DeviceTracker {
+    void UpdatePagesCachedCount(DAddr, size_t, s32) {
+        ++calls;
+    }
+
+    void UpdatePagesCachedBatch(std::span<const std::pair<DAddr, size_t>> ranges, s32) {
+        calls += ranges.size();
+    }
+
+    size_t calls = 0;
+};
+
+/// The size the memory tracker gives every manager
+constexpr size_t RegionSize = 4ULL << 20;
+using Manager = WordManager<DeviceTracker, Common::DivCeil(RegionSize, BYTES_PER_WORD), RegionSize>;
+
+std::vector<std::pair<u64, u64>> RandomRanges(u32 seed) {
+    std::mt19937 rng{seed};
+    std::uniform_int_distribution<u64> offset_dist{0, RegionSize - 1};
+    std::uniform_int_distribution<u64> size_dist{1, 64 * 1024};
+    std::vector<std::pair<u64, u64>> ranges(1024);
+    for (auto& [offset, size] : ranges) {
+        offset = offset_dist(rng);
+        size = (std::min)(size_dist(rng), RegionSize - offset);
+    }
+    return ranges;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("WordManager", "[video_core]") {
+    DeviceTracker tracker;
+    auto manager = std::make_unique<Manager>(0, tracker);
+    const auto ranges = RandomRanges(1234);
+
+    BENCHMARK("Mark CPU modified") {
+        for (const auto& [offset, size] : ranges) {
+            manager->ChangeRegionState(Type::CPU, true, offset, size);
+        }
+        return tracker.calls;
+    };
+    BENCHMARK("Query CPU modified") {
+        size_t modified = 0;
+        for (const auto& [offset, size] : ranges) {
+            modified += manager->IsRegionModified(Type::CPU, offset, size) ? 1 : 0;
+        }
+        return modified;
+    };
+    BENCHMARK("Mark and flush GPU modified") {
+        for (const auto& [offset, size] : ranges) {
+            manager->ChangeRegionState(Type::GPU, true, offset, size);
+        }
+        u64 flushed = 0;
+        manager->ForEachModifiedRange(Type::GPU, true, 0, RegionSize,
+                                      [&](u64, u64 size) { flushed += size; });
+        return flushed;
+    };
+}
@@ -1,13 +1,15 @@
-// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <condition_variable>
 #include <cstddef>
+#include <memory>
 #include <mutex>
 #include <new>
 
@@ -152,44 +154,153 @@ private:
     } consumer;
 };
 
+/// @brief Bounded lock-free multi-producer, single-consumer queue.
+/// Every push takes a ticket from a shared counter, values are popped in ticket order, so the
+/// ticket returned by EmplaceWait can be used as a fence by the producer.
 template <typename T, size_t Capacity = detail::DefaultCapacity>
 class MPSCQueue {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two.");
+
 public:
+    MPSCQueue() noexcept {
+        for (size_t i = 0; i < Capacity; ++i) {
+            m_slots[i].sequence.store(i, std::memory_order::relaxed);
+        }
+    }
+
     template <typename... Args>
     bool TryEmplace(Args&&... args) {
-        std::scoped_lock lock{write_mutex};
-        return spsc_queue.TryEmplace(std::forward<Args>(args)...);
+        size_t ticket = producer.index.load(std::memory_order::relaxed);
+        for (;;) {
+            const size_t sequence = m_slots[ticket % Capacity].sequence.load(std::memory_order::acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence - ticket);
+            if (diff == 0) {
+                if (producer.index.compare_exchange_weak(ticket, ticket + 1, std::memory_order::relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // The slot is still owned by the consumer, the queue is full.
+                return false;
+            } else {
+                ticket = producer.index.load(std::memory_order::relaxed);
+            }
+        }
+        Publish(ticket, std::forward<Args>(args)...);
+        return true;
     }
 
+    /// Pushes a value, waiting for a free slot if the queue is full.
+    /// @returns The ticket of the pushed value, tickets start at zero and follow pop order.
     template <typename... Args>
-    void EmplaceWait(Args&&... args) {
-        std::scoped_lock lock{write_mutex};
-        spsc_queue.EmplaceWait(std::forward<Args>(args)...);
+    size_t EmplaceWait(Args&&... args) {
+        const size_t ticket = producer.index.fetch_add(1, std::memory_order::relaxed);
+        const auto is_free = [this, ticket] {
+            return m_slots[ticket % Capacity].sequence.load(std::memory_order::acquire) == ticket;
+        };
+        if (!is_free()) {
+            std::unique_lock lock{producer.cv_mutex};
+            producer.waiters.fetch_add(1, std::memory_order::seq_cst);
+            producer.cv.wait(lock, is_free);
+            producer.waiters.fetch_sub(1, std::memory_order::relaxed);
+        }
+        Publish(ticket, std::forward<Args>(args)...);
+        return ticket;
     }
 
     bool TryPop(T& t) {
-        return spsc_queue.TryPop(t);
+        Slot& slot = m_slots[consumer.index % Capacity];
+        if (slot.sequence.load(std::memory_order::acquire) != consumer.index + 1) {
+            return false;
+        }
+        t = std::move(slot.value);
+        // Hand the slot back to the producer that will take ticket index + Capacity.
+        slot.sequence.store(consumer.index + Capacity, std::memory_order::release);
+        ++consumer.index;
+        std::atomic_thread_fence(std::memory_order::seq_cst);
+        if (producer.waiters.load(std::memory_order::relaxed) != 0) {
+            std::scoped_lock lock{producer.cv_mutex};
+            producer.cv.notify_all();
+        }
+        return true;
     }
 
     void PopWait(T& t) {
-        spsc_queue.PopWait(t);
+        if (!TryPop(t)) {
+            Wait({});
+            TryPop(t);
+        }
     }
 
     void PopWait(T& t, std::stop_token stop_token) {
-        spsc_queue.PopWait(t, stop_token);
+        if (!TryPop(t)) {
+            Wait(stop_token);
+            if (!stop_token.stop_requested()) {
+                TryPop(t);
+            }
+        }
     }
 
     T PopWait() {
-        return spsc_queue.PopWait();
+        T t{};
+        PopWait(t);
+        return t;
     }
 
     T PopWait(std::stop_token stop_token) {
-        return spsc_queue.PopWait(stop_token);
+        T t{};
+        PopWait(t, stop_token);
+        return t;
+    }
+
+    /// Returns true when there is nothing to pop, only meaningful on the consumer thread.
+    [[nodiscard]] bool Empty() const noexcept {
+        return !IsReady();
     }
 
 private:
-    SPSCQueue<T, Capacity> spsc_queue;
-    std::mutex write_mutex;
+    struct Slot {
+        std::atomic_size_t sequence{0};
+        T value{};
+    };
+
+    template <typename... Args>
+    void Publish(size_t ticket, Args&&... args) {
+        Slot& slot = m_slots[ticket % Capacity];
+        slot.value = T(std::forward<Args>(args)...);
+        slot.sequence.store(ticket + 1, std::memory_order::release);
+        // Only take the lock when the consumer may be sleeping.
+        std::atomic_thread_fence(std::memory_order::seq_cst);
+        if (consumer.waiting.load(std::memory_order::relaxed)) {
+            std::scoped_lock lock{consumer.cv_mutex};
+            consumer.cv.notify_one();
+        }
+    }
+
+    [[nodiscard]] bool IsReady() const noexcept {
+        return m_slots[consumer.index % Capacity].sequence.load(std::memory_order::acquire) ==
+               consumer.index + 1;
+    }
+
+    void Wait(std::stop_token stop_token) {
+        std::unique_lock lock{consumer.cv_mutex};
+        consumer.waiting.store(true, std::memory_order::seq_cst);
+        consumer.cv.wait(lock, stop_token, [this] { return IsReady(); });
+        consumer.waiting.store(false, std::memory_order::relaxed);
+    }
+
+    std::array<Slot, Capacity> m_slots;
+    alignas(64) struct {
+        std::atomic_size_t index{0};
+        std::atomic_size_t waiters{0};
+        std::condition_variable_any cv;
+        std::mutex cv_mutex;
+    } producer;
+    alignas(64) struct {
+        size_t index{0};
+        std::atomic_bool waiting{false};
+        std::condition_variable_any cv;
+        std::mutex cv_mutex;
+    } consumer;
 };
 
 template <typename T, size_t Capacity = detail::DefaultCapacity>
@@ -0,0 +1,245 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <utility>
+#include <vector>
+
+#include <ankerl/unordered_dense.h>
+
+#include "common/common_types.h"
+
+namespace Common {
+
+/**
+ * Thread safe cache that evicts the least recently used entries once the cost of its entries goes
+ * over a budget. The cost is whatever the user measures, usually the size of the value in bytes.
+ *
+ * Entries are spread over independently locked shards by key hash. Recency is approximated with
+ * the CLOCK algorithm: a hit only sets a flag on the entry, so lookups take a shared lock and
+ * don't contend with each other. Eviction sweeps a shard and gives referenced entries a second
+ * chance.
+ *
+ * Values are handed out as shared pointers, so an evicted value stays alive for as long as a
+ * caller holds it.
+ */
+template <typename Key, typename Value, typename Hash = ankerl::unordered_dense::hash<Key>>
+class ConcurrentLruCache {
+public:
+    using ValuePtr = std::shared_ptr<Value>;
+    /// Called for every evicted entry, after the lock of its shard has been released
+    using EvictCallback = std::function<void(const Key&, const ValuePtr&)>;
+
+    /// Builds a cache of the given total budget, the shard count is rounded up to a power of two
+    explicit ConcurrentLruCache(size_t budget, size_t num_shards = 16,
+                                EvictCallback on_evict_ = {})
+        : on_evict{std::move(on_evict_)}, shards(std::bit_ceil((std::max)(num_shards, size_t{1}))),
+          shard_shift{64 - std::countr_zero(shards.size())} {
+        const size_t shard_budget = budget / shards.size();
+        for (Shard& shard : shards) {
+            shard.budget = shard_budget;
+        }
+    }
+
+    ConcurrentLruCache(const ConcurrentLruCache&) = delete;
+    ConcurrentLruCache& operator=(const ConcurrentLruCache&) = delete;
+
+    /// Returns the value of a key and marks it as recently used, or null when it isn't cached
+    [[nodiscard]] ValuePtr Find(const Key& key) const {
+        const Shard& shard = GetShard(key);
+        std::shared_lock lock{shard.mutex};
+        const auto it = shard.index.find(key);
+        if (it == shard.index.end()) {
+            return nullptr;
+        }
+        const Slot& slot = shard.slots[it->second];
+        if (!slot.referenced.load(std::memory_order_relaxed)) {
+            slot.referenced.store(true, std::memory_order_relaxed);
+        }
+        return slot.value;
+    }
+
+    /**
+     * Caches a value, replacing the previous value of the key. Entries are evicted until the cost
+     * fits in the budget of the shard. A value that costs more than a whole shard isn't cached.
+     * @returns True when the value was cached, null values never are
+     */
+    bool Insert(const Key& key, ValuePtr value, size_t cost) {
+        if (!value) {
+            return false;
+        }
+        std::vector<std::pair<Key, ValuePtr>> evicted;
+        ValuePtr replaced;
+        bool inserted = false;
+        Shard& shard = GetShard(key);
+        {
+            std::scoped_lock lock{shard.mutex};
+            // Replacing a value isn't an eviction
+            if (const auto it = shard.index.find(key); it != shard.index.end()) {
+                replaced = std::move(shard.slots[it->second].value);
+                shard.Release(it);
+            }
+            if (cost <= shard.budget) {
+                while (shard.cost + cost > shard.budget) {
+                    shard.EvictOne(evicted);
+                }
+                shard.Emplace(key, std::move(value), cost);
+                inserted = true;
+            }
+        }
+        NotifyEvicted(evicted);
+        return inserted;
+    }
+
+    /// Removes a key from the cache, without calling the eviction callback
+    void Erase(const Key& key) {
+        ValuePtr value;
+        Shard& shard = GetShard(key);
+        std::scoped_lock lock{shard.mutex};
+        if (const auto it = shard.index.find(key); it != shard.index.end()) {
+            // Released after the lock, values can be expensive to destroy
+            value = std::move(shard.slots[it->second].value);
+            shard.Release(it);
+        }
+    }
+
+    /// Removes every entry, without calling the eviction callback
+    void Clear() {
+        for (Shard& shard : shards) {
+            std::scoped_lock lock{shard.mutex};
+            shard.index.clear();
+            shard.slots.clear();
+            shard.free_slots.clear();
+            shard.hand = 0;
+            shard.cost = 0;
+        }
+    }
+
+    /// Total cost of the cached entries
+    [[nodiscard]] size_t Cost() const {
+        size_t cost = 0;
+        for (const Shard& shard : shards) {
+            std::shared_lock lock{shard.mutex};
+            cost += shard.cost;
+        }
+        return cost;
+    }
+
+    /// Number of cached entries
+    [[nodiscard]] size_t Size() const {
+        size_t size = 0;
+        for (const Shard& shard : shards) {
+            std::shared_lock lock{shard.mutex};
+            size += shard.index.size();
+        }
+        return size;
+    }
+
+private:
+    struct Slot {
+        Key key{};
+        ValuePtr value;
+        size_t cost{};
+        mutable std::atomic<bool> referenced{};
+    };
+
+    struct Shard {
+        using Index = ankerl::unordered_dense::map<Key, size_t, Hash>;
+
+        void Emplace(const Key& key, ValuePtr value, size_t value_cost) {
+            size_t slot_index;
+            if (free_slots.empty()) {
+                slot_index = slots.size();
+                slots.emplace_back();
+            } else {
+                slot_index = free_slots.back();
+                free_slots.pop_back();
+            }
+            Slot& slot = slots[slot_index];
+            slot.key = key;
+            slot.value = std::move(value);
+            slot.cost = value_cost;
+            // Only a hit makes an entry recently used, so entries that are never looked up again go
+            // first. The slot is behind the hand, a new entry isn't swept until a full turn.
+            slot.referenced.store(false, std::memory_order_relaxed);
+            index.emplace(key, slot_index);
+            cost += value_cost;
+        }
+
+        void EvictOne(std::vector<std::pair<Key, ValuePtr>>& evicted) {
+            // The index isn't empty while the cost is above zero, so the sweep finishes
+            while (true) {
+                if (hand >= slots.size()) {
+                    hand = 0;
+                }
+                Slot& slot = slots[hand++];
+                if (!slot.value) {
+                    continue;
+                }
+                if (slot.referenced.exchange(false, std::memory_order_relaxed)) {
+                    continue;
+                }
+                evicted.emplace_back(slot.key, std::move(slot.value));
+                Release(index.find(slot.key));
+                return;
+            }
+        }
+
+        void Release(typename Index::iterator it) {
+            Slot& slot = slots[it->second];
+            cost -= slot.cost;
+            slot.value.reset();
+            slot.cost = 0;
+            free_slots.push_back(it->second);
+            index.erase(it);
+        }
+
+        mutable std::shared_mutex mutex;
+        Index index;
+        std::deque<Slot> slots;
+        std::vector<size_t> free_slots;
+        size_t hand = 0;
+        size_t cost = 0;
+        size_t budget = 0;
+    };
+
+    [[nodiscard]] Shard& GetShard(const Key& key) {
+        return shards[ShardIndex(key)];
+    }
+
+    [[nodiscard]] const Shard& GetShard(const Key& key) const {
+        return shards[ShardIndex(key)];
+    }
+
+    [[nodiscard]] size_t ShardIndex(const Key& key) const {
+        if (shards.size() == 1) {
+            return 0;
+        }
+        // Take the top bits after mixing, the low bits of cheap hashes are often poorly spread
+        const u64 hash = static_cast<u64>(Hash{}(key)) * 0x9E3779B97F4A7C15ULL;
+        return static_cast<size_t>(hash >> shard_shift);
+    }
+
+    void NotifyEvicted(std::vector<std::pair<Key, ValuePtr>>& evicted) {
+        if (on_evict) {
+            for (const auto& [key, value] : evicted) {
+                on_evict(key, value);
+            }
+        }
+    }
+
+    EvictCallback on_evict;
+    std::vector<Shard> shards;
+    int shard_shift;
+};
+
+} // namespace Common
@@ -138,9 +138,12 @@ const CPUCaps g_cpu_caps = [] {
 
     const u32 max_ex_fn = cpu_id[0];
 
+    bool is_hypervisor = false;
+
     // Detect family and other miscellaneous features
     if (max_std_fn >= 1) {
         __cpuid(cpu_id, 0x00000001);
+        is_hypervisor = Common::Bit<31>(cpu_id[2]);
         caps.sse3 = Common::Bit<0>(cpu_id[2]);
         caps.pclmulqdq = Common::Bit<1>(cpu_id[2]);
         caps.ssse3 = Common::Bit<9>(cpu_id[2]);
@@ -213,16 +216,6 @@ const CPUCaps g_cpu_caps = [] {
         caps.tsc_crystal_ratio_denominator = cpu_id[0];
         caps.tsc_crystal_ratio_numerator = cpu_id[1];
         caps.crystal_frequency = cpu_id[2];
-        // Some CPU models might not return a crystal frequency.
-        // The CPU model can be detected to use the values from turbostat
-        // https://github.com/torvalds/linux/blob/master/tools/power/x86/turbostat/turbostat.c#L5569
-        // but it's easier to just estimate the TSC tick rate for these cases.
-        if (caps.tsc_crystal_ratio_denominator) {
-            caps.tsc_frequency = u64(caps.crystal_frequency)
-                * caps.tsc_crystal_ratio_numerator / caps.tsc_crystal_ratio_denominator;
-        } else {
-            caps.tsc_frequency = X64::EstimateRDTSCFrequency();
-        }
     }
 
     if (max_std_fn >= 0x16) {
@@ -231,6 +224,31 @@ const CPUCaps g_cpu_caps = [] {
         caps.max_frequency = cpu_id[1];
         caps.bus_frequency = cpu_id[2];
     }
+
+    // Prefer the frequencies reported through CPUID, calibrating takes ~100ms at startup.
+    if (caps.tsc_crystal_ratio_denominator && caps.crystal_frequency) {
+        caps.tsc_frequency = u64(caps.crystal_frequency)
+            * caps.tsc_crystal_ratio_numerator / caps.tsc_crystal_ratio_denominator;
+    } else if (caps.tsc_crystal_ratio_denominator && caps.base_frequency) {
+        // Some CPU models (e.g. Skylake client) don't return a crystal frequency, but their TSC
+        // runs at the nominal core frequency, which leaf 0x16 reports in MHz.
+        caps.tsc_frequency = u64(caps.base_frequency) * 1'000'000;
+    }
+    if (!caps.tsc_frequency && is_hypervisor) {
+        // Hypervisors which don't pass through leaf 0x15 commonly report the TSC frequency in
+        // kHz through the generic timing leaf.
+        __cpuid(cpu_id, 0x40000000);
+        if (u32(cpu_id[0]) >= 0x40000010) {
+            __cpuid(cpu_id, 0x40000010);
+            caps.tsc_frequency = u64(u32(cpu_id[0])) * 1'000;
+        }
+    }
+    if (!caps.tsc_frequency && max_std_fn >= 0x15) {
+        // The CPU model can be detected to use the values from turbostat
+        // https://github.com/torvalds/linux/blob/master/tools/power/x86/turbostat/turbostat.c#L5569
+        // but it's easier to just estimate the TSC tick rate for the remaining cases.
+        caps.tsc_frequency = X64::EstimateRDTSCFrequency();
+    }
     return caps;
 }();
 
@@ -4,10 +4,11 @@
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
-#include <thread>
 #include <mutex>
+#include <vector>
 
 #include "common/assert.h"
+#include "common/common_types.h"
 #include "common/fiber.h"
 #include "common/virtual_buffer.h"
 
@@ -20,26 +21,81 @@ constexpr size_t DEFAULT_STACK_SIZE = 128 * 4096;
 #else
 constexpr size_t DEFAULT_STACK_SIZE = 512 * 4096;
 #endif
-constexpr u32 CANARY_VALUE = 0xDEADBEEF;
+// Below each stack, so an overflow faults instead of running into another allocation. It is a
+// multiple of every host page size and of the Windows allocation granularity.
+constexpr size_t STACK_GUARD_SIZE = 64 * 1024;
+// Stacks kept around for the next fibers, guest programs create and exit threads in bursts
+constexpr size_t MAX_POOLED_STACKS = 32;
+
+namespace {
+
+/// Recycles fiber stacks, so creating a fiber doesn't map and unmap memory every time
+class StackPool {
+public:
+    ~StackPool() {
+        for (u8* const allocation : free_stacks) {
+            FreeMemoryPages(allocation, STACK_GUARD_SIZE + DEFAULT_STACK_SIZE);
+        }
+    }
+
+    /// Returns the lowest address of a stack of DEFAULT_STACK_SIZE bytes
+    u8* Acquire() {
+        {
+            std::scoped_lock lock{mutex};
+            if (!free_stacks.empty()) {
+                u8* const allocation = free_stacks.back();
+                free_stacks.pop_back();
+                return allocation + STACK_GUARD_SIZE;
+            }
+        }
+        u8* const allocation =
+            static_cast<u8*>(AllocateMemoryPages(STACK_GUARD_SIZE + DEFAULT_STACK_SIZE));
+        ProtectMemoryPages(allocation, STACK_GUARD_SIZE);
+        return allocation + STACK_GUARD_SIZE;
+    }
+
+    void Release(u8* stack) {
+        u8* const allocation = stack - STACK_GUARD_SIZE;
+        {
+            std::scoped_lock lock{mutex};
+            if (free_stacks.size() < MAX_POOLED_STACKS) {
+                free_stacks.push_back(allocation);
+                return;
+            }
+        }
+        FreeMemoryPages(allocation, STACK_GUARD_SIZE + DEFAULT_STACK_SIZE);
+    }
+
+private:
+    std::mutex mutex;
+    std::vector<u8*> free_stacks;
+};
+
+StackPool& GetStackPool() {
+    static StackPool pool;
+    return pool;
+}
+
+} // Anonymous namespace
 
 struct Fiber::FiberImpl {
     FiberImpl() {}
 
-    u32 canary_1 = CANARY_VALUE;
-    std::array<u8, DEFAULT_STACK_SIZE> stack{};
-    std::array<u8, DEFAULT_STACK_SIZE> rewind_stack{};
-    u32 canary_2 = CANARY_VALUE;
+    ~FiberImpl() {
+        if (stack_limit) {
+            GetStackPool().Release(stack_limit);
+        }
+    }
 
     boost::context::detail::fcontext_t context{};
-    boost::context::detail::fcontext_t rewind_context{};
 
     std::mutex guard;
     std::function<void()> entry_point;
     std::function<void()> rewind_point;
     std::shared_ptr<Fiber> previous_fiber;
 
+    // Thread fibers run on the stack of their thread and don't have one
     u8* stack_limit = nullptr;
-    u8* rewind_stack_limit = nullptr;
     bool is_thread_fiber = false;
     bool released = false;
 };
@@ -50,14 +106,11 @@ void Fiber::SetRewindPoint(std::function<void()>&& rewind_func) {
 
 Fiber::Fiber(std::function<void()>&& entry_point_func) : impl{std::make_unique<FiberImpl>()} {
     impl->entry_point = std::move(entry_point_func);
-    impl->stack_limit = impl->stack.data();
-    impl->rewind_stack_limit = impl->rewind_stack.data();
+    impl->stack_limit = GetStackPool().Acquire();
     u8* stack_base = impl->stack_limit + DEFAULT_STACK_SIZE;
-    impl->context = boost::context::detail::make_fcontext(stack_base, impl->stack.size(), [](boost::context::detail::transfer_t transfer) -> void {
+    impl->context = boost::context::detail::make_fcontext(stack_base, DEFAULT_STACK_SIZE, [](boost::context::detail::transfer_t transfer) -> void {
         auto* fiber = static_cast<Fiber*>(transfer.data);
         ASSERT(fiber && fiber->impl && fiber->impl->previous_fiber && fiber->impl->previous_fiber->impl);
-        ASSERT(fiber->impl->canary_1 == CANARY_VALUE);
-        ASSERT(fiber->impl->canary_2 == CANARY_VALUE);
         fiber->impl->previous_fiber->impl->context = transfer.fctx;
         fiber->impl->previous_fiber->impl->guard.unlock();
         fiber->impl->previous_fiber.reset();
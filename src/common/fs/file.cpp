@@ -4,6 +4,8 @@
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <utility>
 #include <vector>
 
 #include "common/assert.h"
@@ -17,7 +19,11 @@
 #ifdef _WIN32
 #include <io.h>
 #include <share.h>
+#include <windows.h>
 #else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #endif
 
@@ -456,4 +462,100 @@ s64 IOFile::Tell() const {
     return ftello(file);
 }
 
+MappedFile::~MappedFile() {
+    Close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data{std::exchange(other.data, nullptr)}, size{std::exchange(other.size, 0)} {}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        Close();
+        data = std::exchange(other.data, nullptr);
+        size = std::exchange(other.size, 0);
+    }
+    return *this;
+}
+
+bool MappedFile::Open(const fs::path& path) {
+    Close();
+
+#ifdef _WIN32
+    const HANDLE file_handle =
+        CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file_handle == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER file_size{};
+    if (!GetFileSizeEx(file_handle, &file_size) || file_size.QuadPart <= 0) {
+        CloseHandle(file_handle);
+        return false;
+    }
+    const HANDLE mapping_handle =
+        CreateFileMappingW(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file_handle);
+    if (mapping_handle == nullptr) {
+        return false;
+    }
+    void* const view = MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping_handle);
+    if (view == nullptr) {
+        return false;
+    }
+    data = static_cast<u8*>(view);
+    size = static_cast<size_t>(file_size.QuadPart);
+#else
+    const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat file_stat {};
+    if (fstat(fd, &file_stat) != 0 || file_stat.st_size <= 0) {
+        close(fd);
+        return false;
+    }
+    void* const view = mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (view == MAP_FAILED) {
+        return false;
+    }
+    data = static_cast<u8*>(view);
+    size = static_cast<size_t>(file_stat.st_size);
+#endif
+    return true;
+}
+
+void MappedFile::Close() {
+    if (data == nullptr) {
+        return;
+    }
+#ifdef _WIN32
+    UnmapViewOfFile(data);
+#else
+    munmap(data, size);
+#endif
+    data = nullptr;
+    size = 0;
+}
+
+void MappedFile::Prefetch(size_t offset, size_t length) const {
+    if (offset >= size || length == 0) {
+        return;
+    }
+    length = (std::min)(length, size - offset);
+#ifdef _WIN32
+    WIN32_MEMORY_RANGE_ENTRY range{data + offset, length};
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#else
+    // madvise needs a page aligned start
+    const uintptr_t page_mask = uintptr_t(sysconf(_SC_PAGESIZE)) - 1;
+    const uintptr_t start = reinterpret_cast<uintptr_t>(data + offset);
+    const uintptr_t aligned_start = start & ~page_mask;
+    madvise(reinterpret_cast<void*>(aligned_start), length + (start - aligned_start),
+            MADV_WILLNEED);
+#endif
+}
+
 } // namespace Common::FS
@@ -457,4 +457,52 @@ private:
     std::FILE* file = nullptr;
 };
 
+/**
+ * A read-only view of the whole contents of a file, mapped into memory.
+ * The file itself can be closed once mapped, the view keeps the contents reachable.
+ */
+class MappedFile final {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * Maps the file at path, replacing any previous mapping.
+     *
+     * @param path Filesystem path
+     *
+     * @returns True if the file was mapped, false if it is empty or couldn't be mapped.
+     */
+    bool Open(const std::filesystem::path& path);
+
+    /// Unmaps the file.
+    void Close();
+
+    /**
+     * Hints the host to start reading a range of the file in, ahead of it being accessed.
+     *
+     * @param offset Offset of the range in the file
+     * @param length Length of the range in bytes
+     */
+    void Prefetch(size_t offset, size_t length) const;
+
+    [[nodiscard]] std::span<const u8> Span() const {
+        return {data, size};
+    }
+
+    [[nodiscard]] bool IsOpen() const {
+        return data != nullptr;
+    }
+
+private:
+    u8* data = nullptr;
+    size_t size = 0;
+};
+
 } // namespace Common::FS
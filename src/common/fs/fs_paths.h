@@ -37,3 +37,4 @@
 
 // yuzu-specific files
 #define LOG_FILE "eden_log.txt"
+#define LOG_BINARY_FILE "eden_log.bin"
@@ -0,0 +1,50 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <cstring>
+
+#include "common/hash.h"
+
+namespace Common::Hash {
+
+void StreamHasher::Update(std::span<const u8> data) noexcept {
+    if (m_block_size != 0) {
+        const size_t copy_size = (std::min)(BlockSize - m_block_size, data.size());
+        std::memcpy(m_block.data() + m_block_size, data.data(), copy_size);
+        m_block_size += copy_size;
+        data = data.subspan(copy_size);
+        if (m_block_size < BlockSize || data.empty()) {
+            return;
+        }
+        m_block_size = 0;
+        HashBlock(m_block.data());
+    }
+    // Blocks are only hashed once more data follows them, so the last one always ends up in
+    // Finalize no matter how the input was split
+    while (data.size() > BlockSize) {
+        HashBlock(data.data());
+        data = data.subspan(BlockSize);
+    }
+    if (!data.empty()) {
+        std::memcpy(m_block.data(), data.data(), data.size());
+        m_block_size = data.size();
+    }
+}
+
+u64 StreamHasher::Finalize() const noexcept {
+    const auto tail = reinterpret_cast<const char*>(m_block.data());
+    if (!m_has_state) {
+        return CityHash64(tail, m_block_size);
+    }
+    return CityHash64WithSeed(tail, m_block_size, m_state);
+}
+
+void StreamHasher::HashBlock(const u8* block) noexcept {
+    const auto data = reinterpret_cast<const char*>(block);
+    m_state = m_has_state ? CityHash64WithSeed(data, BlockSize, m_state)
+                          : CityHash64(data, BlockSize);
+    m_has_state = true;
+}
+
+} // namespace Common::Hash
@@ -3,10 +3,16 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
+#include <span>
+#include <type_traits>
 #include <utility>
 #include <boost/functional/hash.hpp>
 
+#include "common/cityhash.h"
+#include "common/common_types.h"
+
 namespace Common {
 
 struct PairHash {
@@ -25,4 +31,44 @@ struct IdentityHash {
     }
 };
 
+namespace Hash {
+
+/// Hashes a byte range for in-memory lookups, the value may change between versions
+[[nodiscard]] inline u64 Hash64(std::span<const u8> data) noexcept {
+    return CityHash64(reinterpret_cast<const char*>(data.data()), data.size());
+}
+
+/// Hashes a byte range into a value that is kept stable for the on-disk caches
+[[nodiscard]] inline u64 StableHash64(std::span<const u8> data) noexcept {
+    return CityHash64(reinterpret_cast<const char*>(data.data()), data.size());
+}
+
+/// Hashes the object representation of a key type
+template <typename T>
+    requires std::is_trivially_copyable_v<T>
+[[nodiscard]] u64 HashObject(const T& object) noexcept {
+    return Hash64(std::span(reinterpret_cast<const u8*>(&object), sizeof(T)));
+}
+
+/// Hashes data as it arrives. The result only depends on the bytes fed, not on how they were
+/// split, and matches StableHash64 for inputs that fit in a single block.
+class StreamHasher {
+public:
+    void Update(std::span<const u8> data) noexcept;
+
+    [[nodiscard]] u64 Finalize() const noexcept;
+
+private:
+    static constexpr size_t BlockSize = 4096;
+
+    void HashBlock(const u8* block) noexcept;
+
+    std::array<u8, BlockSize> m_block;
+    size_t m_block_size = 0;
+    u64 m_state = 0;
+    bool m_has_state = false;
+};
+
+} // namespace Hash
+
 } // namespace Common
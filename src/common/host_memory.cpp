@@ -130,7 +130,7 @@ public:
         , kernelbase_dll("Kernelbase")
     {}
 
-    bool Init() {
+    bool Init([[maybe_unused]] bool prefer_low_base, [[maybe_unused]] bool use_huge_pages) {
         if (!kernelbase_dll.IsOpen()) {
             LOG_CRITICAL(HW_Memory, "Failed to load Kernelbase.dll");
             return false;
@@ -401,7 +401,7 @@ private:
 
 #ifdef ARCHITECTURE_arm64
 
-static void* ChooseVirtualBase(size_t virtual_size) {
+static void* ChooseVirtualBase(size_t virtual_size, [[maybe_unused]] bool prefer_low_base) {
     constexpr uintptr_t Map39BitSize = (1ULL << 39);
     constexpr uintptr_t Map36BitSize = (1ULL << 36);
 
@@ -441,7 +441,16 @@ static void* ChooseVirtualBase(size_t virtual_size) {
 
 #else
 
-static void* ChooseVirtualBase(size_t virtual_size) {
+static void* ChooseVirtualBase(size_t virtual_size, [[maybe_unused]] bool prefer_low_base) {
+#if defined(__linux__) && defined(ARCHITECTURE_x86_64) && defined(MAP_FIXED_NOREPLACE)
+    // The bottom of the address space is usually free, the first huge page is left alone as
+    // the null page and mmap_min_addr live there
+    if (prefer_low_base) {
+        void* virtual_base = mmap(reinterpret_cast<void*>(HugePageSize), virtual_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED_NOREPLACE, -1, 0);
+        if (virtual_base != MAP_FAILED)
+            return virtual_base;
+    }
+#endif
 #if defined(__FreeBSD__) || defined(__DragonFly__) || defined(__OpenBSD__) || defined(__sun__) || defined(__HAIKU__) || defined(__managarm__) || defined(__AIX__)
     void* virtual_base = mmap(nullptr, virtual_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_ALIGNED_SUPER, -1, 0);
     if (virtual_base != MAP_FAILED)
@@ -506,7 +515,7 @@ public:
         , virtual_size{virtual_size_}
     {}
 
-    bool Init() {
+    bool Init(bool prefer_low_base, [[maybe_unused]] bool use_huge_pages) {
         long page_size = sysconf(_SC_PAGESIZE);
         ASSERT_MSG(page_size == 0x1000, "page size {:#x} is incompatible with 4K paging", page_size);
         // Backing memory initialization
@@ -553,9 +562,20 @@ public:
             LOG_CRITICAL(HW_Memory, "mmap failed: {}", strerror(errno));
             return false;
         }
+#if defined(__linux__)
+        // hugetlbfs would force every guest mapping to be 2 MiB aligned, so rely on transparent
+        // huge pages instead. Shared memory only honours this with shmem_enabled set to advise.
+        if (use_huge_pages) {
+            if (madvise(backing_base, backing_size, MADV_HUGEPAGE) == 0) {
+                huge_pages = true;
+            } else {
+                LOG_WARNING(HW_Memory, "madvise(MADV_HUGEPAGE) failed: {}", strerror(errno));
+            }
+        }
+#endif
 
         // Virtual memory initialization
-        virtual_base = virtual_map_base = static_cast<u8*>(ChooseVirtualBase(virtual_size));
+        virtual_base = virtual_map_base = static_cast<u8*>(ChooseVirtualBase(virtual_size, prefer_low_base));
         if (virtual_base == MAP_FAILED) {
             LOG_CRITICAL(HW_Memory, "mmap failed: {}", strerror(errno));
             return false;
@@ -591,6 +611,14 @@ public:
         int flags = (fd >= 0 ? MAP_SHARED : MAP_PRIVATE) | MAP_FIXED;
         void* ret = mmap(virtual_base + virtual_offset, length, prot_flags, flags, fd, host_offset);
         ASSERT_MSG(ret != MAP_FAILED, "mmap: {} {}", strerror(errno), fd);
+#if defined(__linux__)
+        // The fixed mapping replaced the advised one. Only ranges whose guest and host offsets
+        // share their alignment within a huge page can actually be mapped with one.
+        if (huge_pages && (reinterpret_cast<uintptr_t>(ret) ^ host_offset) % HugePageSize == 0 &&
+            length >= HugePageSize) {
+            madvise(ret, length, MADV_HUGEPAGE);
+        }
+#endif
     }
 
     void Unmap(size_t virtual_offset, size_t length) {
@@ -680,12 +708,14 @@ private:
     }
 
     int fd{-1}; // memfd file descriptor, -1 is the error value of memfd_create
+    bool huge_pages{}; ///< Whether the backing memory was advised to use huge pages
     FreeRegionManager free_manager{};
 };
 
 #endif // ^^^ POSIX ^^^
 
-HostMemory::HostMemory(size_t backing_size_, size_t virtual_size_)
+HostMemory::HostMemory(size_t backing_size_, size_t virtual_size_, [[maybe_unused]] bool prefer_low_base,
+                       [[maybe_unused]] bool use_huge_pages)
     : backing_size(backing_size_)
     , virtual_size(virtual_size_)
 {
@@ -698,7 +728,7 @@ HostMemory::HostMemory(size_t backing_size_, size_t virtual_size_)
     // Try to allocate a fastmem arena.
     // The implementation will fail with std::bad_alloc on errors.
     impl = std::make_unique<HostMemory::Impl>(AlignUp(backing_size, PageAlignment), AlignUp(virtual_size, PageAlignment) + HugePageSize);
-    if (impl->Init()) {
+    if (impl->Init(prefer_low_base, use_huge_pages)) {
         backing_base = impl->backing_base;
         virtual_base = impl->virtual_base;
         if (virtual_base) {
@@ -772,6 +802,7 @@ void HostMemory::EnableDirectMappedAddress() {
     if (impl) {
         impl->EnableDirectMappedAddress();
         virtual_size += reinterpret_cast<uintptr_t>(virtual_base);
+        direct_mapped = true;
     }
 #endif
 }
@@ -28,7 +28,11 @@ DECLARE_ENUM_FLAG_OPERATORS(MemoryPermission)
  */
 class HostMemory {
 public:
-    explicit HostMemory(size_t backing_size_, size_t virtual_size_);
+    /// @param prefer_low_base Try to place the virtual reservation at the bottom of the host
+    ///                        address space, so that guest addresses can be host addresses
+    /// @param use_huge_pages  Ask the host to back the memory and its mappings with huge pages
+    explicit HostMemory(size_t backing_size_, size_t virtual_size_, bool prefer_low_base = false,
+                        bool use_huge_pages = false);
     ~HostMemory();
 
     /**
@@ -73,6 +77,17 @@ public:
         return address >= virtual_base && address < virtual_base + virtual_size;
     }
 
+    /// Whether every guest address from lowest_address upwards can be mapped at the same host
+    /// address by EnableDirectMappedAddress, without relocating the guest address space
+    [[nodiscard]] bool CanDirectMapFrom(size_t lowest_address) const noexcept {
+        return virtual_base != nullptr && virtual_base_offset == 0 &&
+               reinterpret_cast<uintptr_t>(virtual_base) <= lowest_address;
+    }
+
+    [[nodiscard]] bool IsDirectMapped() const noexcept {
+        return direct_mapped;
+    }
+
 private:
     size_t backing_size{};
     size_t virtual_size{};
@@ -85,6 +100,7 @@ private:
     u8* backing_base{};
     u8* virtual_base{};
     size_t virtual_base_offset{};
+    bool direct_mapped{};
     // Windows requires it for kernels whom lack proper support for some functions!
     std::optional<Common::VirtualBuffer<u8>> fallback_buffer;
 };
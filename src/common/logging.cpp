@@ -4,12 +4,19 @@
 // SPDX-FileCopyrightText: 2014 Citra Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <climits>
+#include <condition_variable>
 #include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
 #include <regex>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 #if defined(__ANDROID__)
 #include <android/log.h>
@@ -22,6 +29,7 @@
 #endif
 
 #include <boost/algorithm/string/replace.hpp>
+#include <fmt/args.h>
 #include <fmt/ranges.h>
 
 #include "common/fs/file.h"
@@ -157,6 +165,25 @@ constexpr const char* TrimSourcePath(std::string_view source) noexcept {
     return source.data() + idx;
 }
 
+#ifndef __ANDROID__
+/// @brief Name of the user, which is replaced in the logs when censor_username is set
+const std::string& GetUsername() noexcept {
+    // This must be a static otherwise it would get checked on EVERY
+    // instance of logging an entry...
+    static const std::string username = []() -> std::string {
+        // in order of precedence
+        // LOGNAME usually works on UNIX, USERNAME on Windows
+        // Some UNIX systems suck and don't use LOGNAME so we also
+        // need USER :(
+        for (auto const var : { "LOGNAME", "USERNAME", "USER", })
+            if (auto const s = ::getenv(var); s != nullptr)
+                return std::string{s};
+        return std::string{};
+    }();
+    return username;
+}
+#endif
+
 /// @brief Interface for logging backends.
 struct Backend {
     virtual ~Backend() noexcept = default;
@@ -264,19 +291,7 @@ struct FileBackend final : public Backend {
         auto message = FormatLogMessage(entry).append(1, '\n');
 #ifndef __ANDROID__
         if (Settings::values.censor_username.GetValue()) {
-            // This must be a static otherwise it would get checked on EVERY
-            // instance of logging an entry...
-            static std::string username = []() -> std::string {
-                // in order of precedence
-                // LOGNAME usually works on UNIX, USERNAME on Windows
-                // Some UNIX systems suck and don't use LOGNAME so we also
-                // need USER :(
-                for (auto const var : { "LOGNAME", "USERNAME", "USER", })
-                    if (auto const s = ::getenv(var); s != nullptr)
-                        return std::string{s};
-                return std::string{};
-            }();
-            if (!username.empty())
+            if (auto const& username = GetUsername(); !username.empty())
                 boost::replace_all(message, username, "user");
         }
 #endif
@@ -344,6 +359,319 @@ struct LogcatBackend : public Backend {
 };
 #endif
 
+#ifndef __OPENORBIS__
+/// @brief Binary log layout: the magic, then a sequence of records each starting with its
+/// RecordKind. Values are stored in host byte order, strings as a u32 length and their bytes.
+constexpr std::array<char, 8> BinaryLogMagic{'E', 'D', 'E', 'N', 'B', 'L', 'O', 'G'};
+
+enum class RecordKind : u8 {
+    Site,      ///< u32 id, u8 class, u8 level, u32 line, format, filename and function strings
+    Message,   ///< u32 site id, s64 timestamp, u8 argument count and the tagged arguments
+    Formatted, ///< u32 site id, s64 timestamp and the formatted message string
+};
+
+enum class ArgKind : u8 {
+    Signed,   ///< s64
+    Unsigned, ///< u64
+    Float,    ///< f32, kept apart from f64 since it's printed with fewer digits
+    Double,   ///< f64
+    Bool,     ///< u8
+    Char,     ///< char
+    String,   ///< string
+    Pointer,  ///< u64
+};
+
+struct RecordWriter {
+    template <typename T>
+    void Put(const T& value) {
+        const std::size_t offset = data.size();
+        data.resize(offset + sizeof(T));
+        std::memcpy(data.data() + offset, &value, sizeof(T));
+    }
+    void PutString(std::string_view string) {
+        Put(u32(string.size()));
+        data.insert(data.end(), string.begin(), string.end());
+    }
+    std::vector<u8> data;
+};
+
+struct RecordReader {
+    template <typename T>
+    [[nodiscard]] bool Get(T& value) {
+        return std::fread(&value, sizeof(T), 1, file) == 1;
+    }
+    [[nodiscard]] bool GetString(std::string& string) {
+        u32 size{};
+        if (!Get(size))
+            return false;
+        string.resize(size);
+        return size == 0 || std::fread(string.data(), 1, size, file) == size;
+    }
+    std::FILE* file;
+};
+
+/// @brief Stores the arguments with their kind, false if one of them can only be formatted
+/// @note Custom formatters may depend on state that is gone by the time the log is decoded
+[[nodiscard]] bool EncodeArgs(RecordWriter& writer, const fmt::format_args& args) {
+    const std::size_t count_offset = writer.data.size();
+    writer.Put(u8(0));
+    u8 count = 0;
+    const auto encode = [&writer](auto value) -> bool {
+        using T = decltype(value);
+        if constexpr (std::is_same_v<T, bool>) {
+            writer.Put(ArgKind::Bool);
+            writer.Put(u8(value));
+        } else if constexpr (std::is_same_v<T, char>) {
+            writer.Put(ArgKind::Char);
+            writer.Put(value);
+        } else if constexpr (std::is_same_v<T, int> || std::is_same_v<T, long long>) {
+            writer.Put(ArgKind::Signed);
+            writer.Put(s64(value));
+        } else if constexpr (std::is_same_v<T, unsigned> || std::is_same_v<T, unsigned long long>) {
+            writer.Put(ArgKind::Unsigned);
+            writer.Put(u64(value));
+        } else if constexpr (std::is_same_v<T, float>) {
+            writer.Put(ArgKind::Float);
+            writer.Put(value);
+        } else if constexpr (std::is_same_v<T, double>) {
+            writer.Put(ArgKind::Double);
+            writer.Put(value);
+        } else if constexpr (std::is_same_v<T, const char*> || std::is_same_v<T, fmt::string_view>) {
+            const std::string_view string = [&value] {
+                if constexpr (std::is_same_v<T, const char*>)
+                    return std::string_view{value};
+                else
+                    return std::string_view{value.data(), value.size()};
+            }();
+            writer.Put(ArgKind::String);
+#ifndef __ANDROID__
+            if (Settings::values.censor_username.GetValue() && !GetUsername().empty() &&
+                string.find(GetUsername()) != std::string_view::npos) {
+                std::string censored{string};
+                boost::replace_all(censored, GetUsername(), "user");
+                writer.PutString(censored);
+                return true;
+            }
+#endif
+            writer.PutString(string);
+        } else if constexpr (std::is_same_v<T, const void*>) {
+            writer.Put(ArgKind::Pointer);
+            writer.Put(u64(reinterpret_cast<uintptr_t>(value)));
+        } else {
+            return false;
+        }
+        return true;
+    };
+    for (int i = 0;; ++i) {
+        const auto arg = args.get(i);
+        if (!arg)
+            break;
+        if (count == (std::numeric_limits<u8>::max)())
+            return false;
+#if FMT_VERSION >= 110000
+        if (!arg.visit(encode))
+#else
+        if (!fmt::visit_format_arg(encode, arg))
+#endif
+            return false;
+        ++count;
+    }
+    writer.data[count_offset] = count;
+    return true;
+}
+
+/// @brief Backend that copies the raw arguments of messages into lock-free per-thread rings, and
+/// writes them to a binary file from its own thread without formatting them
+struct BinaryBackend {
+    /// Single producer, single consumer byte ring, the drain always takes whole records
+    struct ThreadRing {
+        static constexpr std::size_t Capacity = 256 * 1024;
+        std::unique_ptr<u8[]> data = std::make_unique<u8[]>(Capacity);
+        alignas(64) std::atomic<u64> write_pos{};
+        alignas(64) std::atomic<u64> read_pos{};
+        std::atomic_bool is_exited{};
+    };
+
+    struct SiteKey {
+        const char* format;
+        const char* filename;
+        unsigned int line_num;
+        Class log_class;
+        Level log_level;
+        bool operator==(const SiteKey&) const = default;
+    };
+    struct SiteKeyHash {
+        std::size_t operator()(const SiteKey& key) const noexcept {
+            return std::hash<const void*>{}(key.format) ^ (std::hash<const void*>{}(key.filename) << 1) ^ (std::size_t(key.line_num) << 8);
+        }
+    };
+
+    /// State of a logging thread, it only touches the shared state on the first message of a site
+    struct ThreadState {
+        ~ThreadState() {
+            is_thread_exiting = true;
+            if (ring)
+                ring->is_exited.store(true, std::memory_order_release);
+        }
+        std::shared_ptr<ThreadRing> ring;
+        std::unordered_map<SiteKey, u32, SiteKeyHash> sites;
+        RecordWriter record;
+    };
+
+    explicit BinaryBackend(const std::filesystem::path& filename) noexcept {
+        auto old_filename = filename;
+        old_filename += ".old";
+        void(FS::RemoveFile(old_filename));
+        void(FS::RenameFile(filename, old_filename));
+        file.emplace(filename, FS::FileAccessMode::Write, FS::FileType::BinaryFile);
+        bytes_written += file->WriteSpan(std::span<const char>{BinaryLogMagic});
+        thread = std::jthread([this](std::stop_token stop_token) { DrainThread(stop_token); });
+    }
+    ~BinaryBackend() noexcept {
+        thread.request_stop();
+        thread.join();
+        Flush();
+    }
+
+    void Write(Class log_class, Level log_level, const char* filename, unsigned int line_num, const char* function, fmt::string_view format, const fmt::format_args& args, std::chrono::microseconds timestamp) noexcept {
+        const SiteKey key{format.data(), filename, line_num, log_class, log_level};
+        if (is_thread_exiting) {
+            // Messages logged by the destructors of other thread locals skip the ring
+            RecordWriter record;
+            EncodeRecord(record, RegisterSite(key, function, format), format, args, timestamp);
+            std::scoped_lock lock{mutex};
+            WriteToFile(record.data);
+            return;
+        }
+        static thread_local ThreadState state;
+        if (!state.ring) {
+            state.ring = std::make_shared<ThreadRing>();
+            std::scoped_lock lock{mutex};
+            rings.push_back(state.ring);
+        }
+        auto site = state.sites.find(key);
+        if (site == state.sites.end())
+            site = state.sites.emplace(key, RegisterSite(key, function, format)).first;
+        EncodeRecord(state.record, site->second, format, args, timestamp);
+        Push(*state.ring, state.record.data);
+    }
+
+    /// @brief Writes everything the threads logged so far to the file
+    void Flush() noexcept {
+        std::scoped_lock lock{mutex};
+        Drain();
+        file->Flush();
+    }
+
+private:
+    static void EncodeRecord(RecordWriter& record, u32 site_id, fmt::string_view format, const fmt::format_args& args, std::chrono::microseconds timestamp) {
+        record.data.clear();
+        record.Put(RecordKind::Message);
+        record.Put(site_id);
+        record.Put(s64(timestamp.count()));
+        if (!EncodeArgs(record, args)) {
+            record.data.clear();
+            record.Put(RecordKind::Formatted);
+            record.Put(site_id);
+            record.Put(s64(timestamp.count()));
+            record.PutString(fmt::vformat(format, args));
+        }
+    }
+
+    u32 RegisterSite(const SiteKey& key, const char* function, fmt::string_view format) {
+        std::scoped_lock lock{mutex};
+        const auto [it, is_new] = sites.try_emplace(key, u32(sites.size()));
+        if (is_new) {
+            // Written straight away, so it always precedes the messages that are still queued
+            RecordWriter record;
+            record.Put(RecordKind::Site);
+            record.Put(it->second);
+            record.Put(key.log_class);
+            record.Put(key.log_level);
+            record.Put(u32(key.line_num));
+            record.PutString({format.data(), format.size()});
+            record.PutString(key.filename);
+            record.PutString(function);
+            WriteToFile(record.data);
+        }
+        return it->second;
+    }
+
+    void Push(ThreadRing& ring, std::span<const u8> record) noexcept {
+        if (record.size() > ThreadRing::Capacity / 2) {
+            // Too large for the ring, keep the order of the thread by draining it first
+            std::scoped_lock lock{mutex};
+            Drain();
+            WriteToFile(record);
+            return;
+        }
+        const u64 write_pos = ring.write_pos.load(std::memory_order_relaxed);
+        u64 used = write_pos - ring.read_pos.load(std::memory_order_acquire);
+        if (used + record.size() > ThreadRing::Capacity / 2) {
+            drain_requested.store(true, std::memory_order_relaxed);
+            drain_cv.notify_one();
+        }
+        while (used + record.size() > ThreadRing::Capacity) {
+            std::this_thread::yield();
+            used = write_pos - ring.read_pos.load(std::memory_order_acquire);
+        }
+        const std::size_t offset = std::size_t(write_pos % ThreadRing::Capacity);
+        const std::size_t first = (std::min)(record.size(), ThreadRing::Capacity - offset);
+        std::memcpy(ring.data.get() + offset, record.data(), first);
+        std::memcpy(ring.data.get(), record.data() + first, record.size() - first);
+        ring.write_pos.store(write_pos + record.size(), std::memory_order_release);
+    }
+
+    void DrainThread(std::stop_token stop_token) {
+        Common::SetCurrentThreadName("Logger");
+        while (!stop_token.stop_requested()) {
+            std::unique_lock lock{mutex};
+            drain_cv.wait_for(lock, stop_token, std::chrono::milliseconds{50}, [this] {
+                return drain_requested.exchange(false, std::memory_order_relaxed);
+            });
+            Drain();
+        }
+    }
+
+    /// @note Call with the mutex held
+    void Drain() noexcept {
+        std::erase_if(rings, [this](const std::shared_ptr<ThreadRing>& ring) {
+            const bool is_exited = ring->is_exited.load(std::memory_order_acquire);
+            const u64 read_pos = ring->read_pos.load(std::memory_order_relaxed);
+            const u64 write_pos = ring->write_pos.load(std::memory_order_acquire);
+            const std::size_t offset = std::size_t(read_pos % ThreadRing::Capacity);
+            const std::size_t size = std::size_t(write_pos - read_pos);
+            const std::size_t first = (std::min)(size, ThreadRing::Capacity - offset);
+            WriteToFile({ring->data.get() + offset, first});
+            WriteToFile({ring->data.get(), size - first});
+            ring->read_pos.store(write_pos, std::memory_order_release);
+            return is_exited;
+        });
+    }
+
+    /// @note Call with the mutex held
+    void WriteToFile(std::span<const u8> data) noexcept {
+        using namespace Common::Literals;
+        // Same limit as the text log, in case entries are spammed
+        const auto write_limit = Settings::values.extended_logging.GetValue() ? 1_GiB : 100_MiB;
+        if (data.empty() || bytes_written > write_limit)
+            return;
+        bytes_written += file->WriteSpan(data);
+    }
+
+    static inline thread_local bool is_thread_exiting = false;
+
+    std::mutex mutex;
+    std::condition_variable_any drain_cv;
+    std::atomic_bool drain_requested = false;
+    std::vector<std::shared_ptr<ThreadRing>> rings;
+    std::unordered_map<SiteKey, u32, SiteKeyHash> sites;
+    std::optional<FS::IOFile> file;
+    std::size_t bytes_written = 0;
+    std::jthread thread;
+};
+#endif
+
 /// @brief Static state as a singleton.
 struct Impl {
     // Well, I mean it's the default constructor!
@@ -374,6 +702,10 @@ struct Impl {
 #endif
 #ifdef __ANDROID__
     LogcatBackend lc_backend{};
+#endif
+#ifndef __OPENORBIS__
+    std::optional<BinaryBackend> binary_backend;
+    std::atomic_bool binary_enabled = false;
 #endif
     std::chrono::steady_clock::time_point time_origin{std::chrono::steady_clock::now()};
 };
@@ -395,6 +727,7 @@ void Initialize() {
         void(CreateDir(log_dir));
         logging_instance->file_backend.emplace(log_dir / LOG_FILE);
 #endif
+        SetBinaryBackendEnabled(Settings::values.log_binary.GetValue());
     }
 }
 
@@ -402,8 +735,13 @@ void Start() {
 }
 
 void Stop() {
-    if (logging_instance)
+    if (logging_instance) {
         logging_instance->ForEachBackend([](Backend& backend) { backend.Flush(); });
+#ifndef __OPENORBIS__
+        if (logging_instance->binary_backend)
+            logging_instance->binary_backend->Flush();
+#endif
+    }
 }
 
 void SetGlobalFilter(const Filter& filter) {
@@ -416,22 +754,165 @@ void SetColorConsoleBackendEnabled(bool enabled) {
         logging_instance->color_console_backend.enabled = enabled;
 }
 
+void SetBinaryBackendEnabled(bool enabled) {
+#ifndef __OPENORBIS__
+    if (!logging_instance)
+        return;
+    if (enabled && !logging_instance->binary_backend) {
+        using namespace Common::FS;
+        const auto& log_dir = GetEdenPath(EdenPath::LogDir);
+        void(CreateDir(log_dir));
+        logging_instance->binary_backend.emplace(log_dir / LOG_BINARY_FILE);
+    }
+    logging_instance->binary_enabled = enabled;
+#else
+    (void)enabled;
+#endif
+}
+
 void FmtLogMessageImpl(Class log_class, Level log_level, const char* filename, unsigned int line_num, const char* function, fmt::string_view format, const fmt::format_args& args) {
     if (logging_instance && logging_instance->filter.CheckMessage(log_class, log_level)) {
+        auto const timestamp = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - logging_instance->time_origin);
+#ifndef __OPENORBIS__
+        if (logging_instance->binary_enabled) {
+            auto& binary_backend = *logging_instance->binary_backend;
+            binary_backend.Write(log_class, log_level, TrimSourcePath(filename), line_num, function, format, args, timestamp);
+            if (log_level >= Level::Error)
+                binary_backend.Flush();
+            // Warnings and errors are still worth seeing right away
+            if (log_level < Level::Warning)
+                return;
+        }
+#endif
         auto const flush = ::Settings::values.log_flush_line.GetValue();
-        logging_instance->ForEachBackend([=](Backend& backend) {
-            backend.Write(Entry{
-                .message = fmt::vformat(format, args),
-                .timestamp = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - logging_instance->time_origin),
-                .log_class = log_class,
-                .log_level = log_level,
-                .filename = TrimSourcePath(filename),
-                .function = function,
-                .line_num = line_num,
-            });
+        // Formatted once for all the backends
+        const Entry entry{
+            .message = fmt::vformat(format, args),
+            .timestamp = timestamp,
+            .log_class = log_class,
+            .log_level = log_level,
+            .filename = TrimSourcePath(filename),
+            .function = function,
+            .line_num = line_num,
+        };
+        logging_instance->ForEachBackend([&](Backend& backend) {
+            backend.Write(entry);
             if (flush)
                 backend.Flush();
         });
     }
 }
+
+bool DecodeBinaryLog(std::FILE* in, std::FILE* out) {
+#ifndef __OPENORBIS__
+    struct Site {
+        std::string format;
+        std::string filename;
+        std::string function;
+        u32 line_num{};
+        Class log_class{};
+        Level log_level{};
+    };
+    RecordReader reader{in};
+    std::array<char, 8> magic{};
+    if (!reader.Get(magic) || magic != BinaryLogMagic)
+        return false;
+    std::vector<Site> sites;
+    while (true) {
+        RecordKind kind{};
+        if (!reader.Get(kind))
+            return std::feof(in) != 0;
+        if (kind == RecordKind::Site) {
+            u32 id{};
+            Site site;
+            if (!reader.Get(id) || !reader.Get(site.log_class) || !reader.Get(site.log_level) || !reader.Get(site.line_num) || !reader.GetString(site.format) || !reader.GetString(site.filename) || !reader.GetString(site.function))
+                return false;
+            if (id >= sites.size())
+                sites.resize(id + 1);
+            sites[id] = std::move(site);
+            continue;
+        }
+        u32 id{};
+        s64 timestamp{};
+        if (!reader.Get(id) || !reader.Get(timestamp) || id >= sites.size())
+            return false;
+        const Site& site = sites[id];
+        std::string message;
+        if (kind == RecordKind::Formatted) {
+            if (!reader.GetString(message))
+                return false;
+        } else if (kind == RecordKind::Message) {
+            fmt::dynamic_format_arg_store<fmt::format_context> store;
+            u8 count{};
+            if (!reader.Get(count))
+                return false;
+            for (u8 i = 0; i < count; ++i) {
+                ArgKind arg_kind{};
+                if (!reader.Get(arg_kind))
+                    return false;
+                const bool is_read = [&] {
+                    const auto push = [&]<typename T>(T value) {
+                        if (!reader.Get(value))
+                            return false;
+                        store.push_back(value);
+                        return true;
+                    };
+                    switch (arg_kind) {
+                    case ArgKind::Signed: return push(s64{});
+                    case ArgKind::Unsigned: return push(u64{});
+                    case ArgKind::Float: return push(f32{});
+                    case ArgKind::Double: return push(f64{});
+                    case ArgKind::Char: return push(char{});
+                    case ArgKind::Bool: {
+                        u8 value{};
+                        if (!reader.Get(value))
+                            return false;
+                        store.push_back(value != 0);
+                        return true;
+                    }
+                    case ArgKind::String: {
+                        std::string value;
+                        if (!reader.GetString(value))
+                            return false;
+                        store.push_back(std::move(value));
+                        return true;
+                    }
+                    case ArgKind::Pointer: {
+                        u64 value{};
+                        if (!reader.Get(value))
+                            return false;
+                        store.push_back(reinterpret_cast<const void*>(uintptr_t(value)));
+                        return true;
+                    }
+                    }
+                    return false;
+                }();
+                if (!is_read)
+                    return false;
+            }
+            try {
+                message = fmt::vformat(site.format, store);
+            } catch (const fmt::format_error&) {
+                message = site.format;
+            }
+        } else {
+            return false;
+        }
+        auto const line = FormatLogMessage(Entry{
+            .message = std::move(message),
+            .timestamp = std::chrono::microseconds{timestamp},
+            .log_class = site.log_class,
+            .log_level = site.log_level,
+            .filename = site.filename.c_str(),
+            .function = site.function.c_str(),
+            .line_num = site.line_num,
+        }).append(1, '\n');
+        std::fwrite(line.data(), 1, line.size(), out);
+    }
+#else
+    (void)in;
+    (void)out;
+    return false;
+#endif
+}
 } // namespace Common::Log
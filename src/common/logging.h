@@ -7,6 +7,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstdio>
 #include <algorithm>
 #include <type_traits>
 #include <fmt/ranges.h>
@@ -140,6 +141,16 @@ void Stop();
 void SetGlobalFilter(const Filter& filter);
 void SetColorConsoleBackendEnabled(bool enabled);
 
+/// Enables the binary backend, which only copies the format string id and the raw arguments of
+/// each message and leaves the formatting to DecodeBinaryLog. Messages below warnings then skip
+/// the text backends.
+void SetBinaryBackendEnabled(bool enabled);
+
+/// Formats a log written by the binary backend into text lines, as the file backend would have.
+/// Lines of different threads are grouped per flush, their timestamps give the actual order.
+/// @returns false if the input isn't a binary log or is truncated
+bool DecodeBinaryLog(std::FILE* in, std::FILE* out);
+
 /// @brief A log entry. Log entries are store in a structured format to permit more varied output
 /// formatting on different frontends, as well as facilitating filtering and aggregation.
 struct Entry {
@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <array>
+#include <atomic>
+
+#include <fmt/format.h>
+
+#include "common/memory_accounting.h"
+
+namespace Common::MemoryAccounting {
+
+namespace {
+
+constexpr size_t NumTags = static_cast<size_t>(Tag::Count);
+
+constexpr std::array<const char*, NumTags> TagNames{
+    "Texture cache",
+    "Buffer cache",
+    "Staging buffers",
+    "JIT code cache",
+};
+
+struct Counter {
+    std::atomic<u64> current;
+    std::atomic<u64> peak;
+};
+
+// Each counter on its own cache line, the GPU and CPU threads update different tags
+struct alignas(64) PaddedCounter : Counter {};
+
+std::array<PaddedCounter, NumTags> counters{};
+
+Counter& GetCounter(Tag tag) noexcept {
+    return counters[static_cast<size_t>(tag)];
+}
+
+} // Anonymous namespace
+
+void Add(Tag tag, u64 bytes) noexcept {
+    if (bytes == 0) {
+        return;
+    }
+    Counter& counter = GetCounter(tag);
+    const u64 current = counter.current.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    u64 peak = counter.peak.load(std::memory_order_relaxed);
+    while (current > peak &&
+           !counter.peak.compare_exchange_weak(peak, current, std::memory_order_relaxed)) {
+    }
+}
+
+void Subtract(Tag tag, u64 bytes) noexcept {
+    if (bytes == 0) {
+        return;
+    }
+    GetCounter(tag).current.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+Usage GetUsage(Tag tag) noexcept {
+    const Counter& counter = GetCounter(tag);
+    return Usage{
+        .current = counter.current.load(std::memory_order_relaxed),
+        .peak = counter.peak.load(std::memory_order_relaxed),
+    };
+}
+
+const char* GetName(Tag tag) noexcept {
+    return TagNames[static_cast<size_t>(tag)];
+}
+
+void ResetPeaks() noexcept {
+    for (Counter& counter : counters) {
+        counter.peak.store(counter.current.load(std::memory_order_relaxed),
+                           std::memory_order_relaxed);
+    }
+}
+
+std::string GetReport() {
+    constexpr double MiB = 1024.0 * 1024.0;
+    std::string report;
+    for (size_t index = 0; index < NumTags; ++index) {
+        const Tag tag = static_cast<Tag>(index);
+        const Usage usage = GetUsage(tag);
+        report += fmt::format("{:<16} {:>9.1f} MiB, peak {:>9.1f} MiB\n", GetName(tag),
+                              static_cast<double>(usage.current) / MiB,
+                              static_cast<double>(usage.peak) / MiB);
+    }
+    return report;
+}
+
+} // namespace Common::MemoryAccounting
@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <string>
+#include <utility>
+
+#include "common/common_types.h"
+
+/// Counts the host memory held by each subsystem, with the peak since emulation started
+namespace Common::MemoryAccounting {
+
+enum class Tag : u32 {
+    TextureCache,   ///< Images of the texture cache
+    BufferCache,    ///< Buffers of the buffer cache
+    StagingBuffers, ///< Host visible buffers used to upload and download GPU memory
+    JitCodeCache,   ///< Code caches reserved by the CPU recompilers
+    Count,
+};
+
+struct Usage {
+    u64 current;
+    u64 peak;
+};
+
+void Add(Tag tag, u64 bytes) noexcept;
+void Subtract(Tag tag, u64 bytes) noexcept;
+
+[[nodiscard]] Usage GetUsage(Tag tag) noexcept;
+[[nodiscard]] const char* GetName(Tag tag) noexcept;
+
+/// Sets the peak of every tag to its current value
+void ResetPeaks() noexcept;
+
+/// One line per tag with its current and peak usage
+[[nodiscard]] std::string GetReport();
+
+/// Bytes held by one owner under a tag, they are given back when the account is destroyed
+class Account {
+public:
+    Account() = default;
+    explicit Account(Tag tag_, u64 bytes_ = 0) noexcept : tag{tag_} {
+        Add(bytes_);
+    }
+    ~Account() {
+        MemoryAccounting::Subtract(tag, bytes);
+    }
+
+    Account(const Account&) = delete;
+    Account& operator=(const Account&) = delete;
+
+    Account(Account&& other) noexcept : tag{other.tag}, bytes{std::exchange(other.bytes, 0)} {}
+    Account& operator=(Account&& other) noexcept {
+        if (this != &other) {
+            MemoryAccounting::Subtract(tag, bytes);
+            tag = other.tag;
+            bytes = std::exchange(other.bytes, 0);
+        }
+        return *this;
+    }
+
+    void Add(u64 amount) noexcept {
+        bytes += amount;
+        MemoryAccounting::Add(tag, amount);
+    }
+
+    void Subtract(u64 amount) noexcept {
+        bytes -= amount;
+        MemoryAccounting::Subtract(tag, amount);
+    }
+
+private:
+    Tag tag{};
+    u64 bytes = 0;
+};
+
+} // namespace Common::MemoryAccounting
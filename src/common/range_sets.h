@@ -1,3 +1,5 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
 // SPDX-FileCopyrightText: 2024 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -23,6 +25,13 @@ public:
 
     void Add(AddressType base_address, size_t size);
     void Subtract(AddressType base_address, size_t size);
+
+    /// Adds all the ranges of another set, in a single pass over both
+    void Add(const RangeSet& other);
+
+    /// Removes all the ranges of another set, in a single pass over both
+    void Subtract(const RangeSet& other);
+
     void Clear();
     bool Empty() const;
 
@@ -15,11 +15,12 @@
 #include <span>
 #include <type_traits>
 #include <vector>
-#include <mutex>
 
 namespace Common {
 
 /// SPSC ring buffer
+/// Push must only be called from the producer thread, and Pop from the consumer thread. Neither
+/// takes a lock, so they are safe to use from real-time audio callbacks.
 /// @tparam T            Element type
 /// @tparam capacity     Number of slots in ring buffer
 template <typename T, std::size_t capacity>
@@ -38,9 +39,9 @@ public:
     /// @param slot_count  Number of slots to push
     /// @returns The number of slots actually pushed
     std::size_t Push(const void* new_slots, std::size_t slot_count) {
-        std::lock_guard lock(rb_mutex);
-
-        const std::size_t slots_free = capacity + read_index - write_index;
+        const std::size_t write_index = m_write_index.load(std::memory_order_relaxed);
+        const std::size_t slots_free =
+            capacity + m_read_index.load(std::memory_order_acquire) - write_index;
         const std::size_t push_count = (std::min)(slot_count, slots_free);
         const std::size_t pos = write_index % capacity;
         const std::size_t first_copy = (std::min)(capacity - pos, push_count);
@@ -51,7 +52,7 @@ public:
         in += first_copy * slot_size;
         std::memcpy(m_data.data(), in, second_copy * slot_size);
 
-        write_index = write_index + push_count;
+        m_write_index.store(write_index + push_count, std::memory_order_release);
         return push_count;
     }
 
@@ -64,9 +65,8 @@ public:
     /// @param max_slots  Maximum number of slots to pop
     /// @returns The number of slots actually popped
     std::size_t Pop(void* output, std::size_t max_slots = ~std::size_t(0)) {
-        std::lock_guard lock(rb_mutex);
-
-        const std::size_t slots_filled = write_index - read_index;
+        const std::size_t read_index = GetReadIndex();
+        const std::size_t slots_filled = m_write_index.load(std::memory_order_acquire) - read_index;
         const std::size_t pop_count = (std::min)(slots_filled, max_slots);
         const std::size_t pos = read_index % capacity;
         const std::size_t first_copy = (std::min)(capacity - pos, pop_count);
@@ -77,7 +77,7 @@ public:
         out += first_copy * slot_size;
         std::memcpy(out, m_data.data(), second_copy * slot_size);
 
-        read_index = read_index + pop_count;
+        m_read_index.store(read_index + pop_count, std::memory_order_release);
         return pop_count;
     }
 
@@ -88,9 +88,21 @@ public:
         return out;
     }
 
+    /// Drops every slot pushed so far. Unlike Pop this may be called from any thread, the slots
+    /// are skipped by the consumer on its next Pop.
+    void Clear() {
+        const std::size_t write_index = m_write_index.load(std::memory_order_acquire);
+        std::size_t discard_index = m_discard_index.load(std::memory_order_relaxed);
+        while (discard_index < write_index &&
+               !m_discard_index.compare_exchange_weak(discard_index, write_index,
+                                                      std::memory_order_release,
+                                                      std::memory_order_relaxed)) {
+        }
+    }
+
     /// @returns Number of slots used
     [[nodiscard]] inline std::size_t Size() const {
-        return write_index - read_index;
+        return m_write_index.load(std::memory_order_acquire) - GetReadIndex();
     }
 
     /// @returns Maximum size of ring buffer
@@ -99,11 +111,18 @@ public:
     }
 
 private:
+    /// @returns The index of the next slot to pop, past any cleared slots
+    [[nodiscard]] std::size_t GetReadIndex() const {
+        return (std::max)(m_read_index.load(std::memory_order_relaxed),
+                          m_discard_index.load(std::memory_order_acquire));
+    }
+
+    // Keep the indices written by each side on their own cache line
+    alignas(128) std::atomic_size_t m_read_index{0};
+    alignas(128) std::atomic_size_t m_write_index{0};
+    alignas(128) std::atomic_size_t m_discard_index{0};
+
     std::array<T, capacity> m_data;
-    // This is wrong, a thread-safe ringbuffer is impossible.
-    std::size_t read_index{0};
-    std::size_t write_index{0};
-    std::mutex rb_mutex;
 };
 
 } // namespace Common
@@ -152,36 +152,39 @@ bool getDebugKnobAt(u8 i) {
     return (values.debug_knobs.GetValue() & (1 << (i & 0xF))) != 0;
 }
 
-void UpdateGPUAccuracy() {
-    values.current_gpu_accuracy = values.gpu_accuracy.GetValue();
+namespace {
+SettingsSnapshot snapshot;
 }
 
-bool IsGPULevelHigh() {
-    return values.current_gpu_accuracy == GpuAccuracy::High;
-}
-
-bool IsDMALevelDefault() {
-    return values.dma_accuracy.GetValue() == DmaAccuracy::Default;
-}
-
-bool IsDMALevelSafe() {
-    return values.dma_accuracy.GetValue() == DmaAccuracy::Safe;
-}
-
-bool IsGPUFenceBehaviorDefault() {
-    return values.gpu_fence_behavior.GetValue() == GpuFenceBehavior::Default;
+void UpdateSnapshot() {
+    const GpuAccuracy gpu_accuracy = values.gpu_accuracy.GetValue();
+    const GpuFenceBehavior fence_behavior = values.gpu_fence_behavior.GetValue();
+    const DmaAccuracy dma_accuracy = values.dma_accuracy.GetValue();
+    const bool is_high = gpu_accuracy == GpuAccuracy::High;
+    snapshot = SettingsSnapshot{
+        .gpu_accuracy = gpu_accuracy,
+        .use_safe_dma = dma_accuracy == DmaAccuracy::Default ? is_high
+                                                             : dma_accuracy == DmaAccuracy::Safe,
+        .delay_fences = fence_behavior == GpuFenceBehavior::Default
+                            ? is_high
+                            : fence_behavior == GpuFenceBehavior::Balanced ||
+                                  fence_behavior == GpuFenceBehavior::Accurate ||
+                                  fence_behavior == GpuFenceBehavior::Strict,
+        .wait_for_buffer_fences = fence_behavior == GpuFenceBehavior::Accurate ||
+                                  fence_behavior == GpuFenceBehavior::Strict,
+        .buffer_fence_tick_delay = fence_behavior == GpuFenceBehavior::Strict ? 0U : 3U,
+        .use_reactive_flushing = values.use_reactive_flushing.GetValue(),
+        .enable_gpu_buffer_readback = values.enable_gpu_buffer_readback.GetValue(),
+        .sync_memory_operations = values.sync_memory_operations.GetValue(),
+    };
 }
 
-bool IsGPUFenceBehaviorBalanced() {
-    return values.gpu_fence_behavior.GetValue() == GpuFenceBehavior::Balanced;
+const SettingsSnapshot& GetSnapshot() {
+    return snapshot;
 }
 
-bool IsGPUFenceBehaviorAccurate() {
-    return values.gpu_fence_behavior.GetValue() == GpuFenceBehavior::Accurate;
-}
-
-bool IsGPUFenceBehaviorStrict() {
-    return values.gpu_fence_behavior.GetValue() == GpuFenceBehavior::Strict;
+bool IsGPULevelHigh() {
+    return snapshot.gpu_accuracy == GpuAccuracy::High;
 }
 
 bool IsFastmemEnabled() {
@@ -200,6 +203,15 @@ bool IsFastmemEnabled() {
 #endif
 }
 
+bool IsFastmemDirectMapped() {
+#if defined(__linux__) && defined(ARCHITECTURE_x86_64)
+    return values.cpu_accuracy.GetValue() == CpuAccuracy::Unsafe &&
+           values.cpuopt_unsafe_direct_fastmem.GetValue() && IsFastmemEnabled();
+#else
+    return false;
+#endif
+}
+
 static bool is_nce_enabled = false;
 
 void SetNceEnabled(bool is_39bit) {
@@ -190,6 +190,8 @@ struct Values {
                                        Specialization::Scalar | Specialization::Percentage,
                                        true,
                                        true};
+    SwitchableSetting<bool> low_latency_audio{linkage, false, "low_latency_audio",
+                                              Category::Audio};
     Setting<bool, false> audio_muted{
                                      linkage, false, "audio_muted", Category::Audio, Specialization::Default, true, true};
     Setting<bool, false> dump_audio_commands{
@@ -203,6 +205,14 @@ struct Values {
                                                              Category::Core,
                                                              Specialization::Default,
                                                              true};
+    Setting<bool> use_huge_pages{linkage, false, "use_huge_pages", Category::Core};
+    SwitchableSetting<ThreadPlacement> thread_placement{linkage,
+#ifdef __ANDROID__
+                                                        ThreadPlacement::Pin,
+#else
+                                                        ThreadPlacement::System,
+#endif
+                                                        "thread_placement", Category::Core};
     SwitchableSetting<bool> use_speed_limit{
                                             linkage, true, "use_speed_limit", Category::Core, Specialization::Paired, true, true};
 
@@ -287,6 +297,9 @@ struct Values {
                                            true,
                                            &use_custom_cpu_ticks};
 
+    Setting<bool> cpu_jit_block_cache{linkage, false, "cpu_jit_block_cache", Category::Cpu};
+    Setting<bool> cpu_jit_profiling{linkage, false, "cpu_jit_profiling", Category::Cpu};
+
     Setting<bool> cpuopt_page_tables{linkage, true, "cpuopt_page_tables", Category::CpuDebug};
     Setting<bool> cpuopt_block_linking{linkage, true, "cpuopt_block_linking", Category::CpuDebug};
     Setting<bool> cpuopt_return_stack_buffer{linkage, true, "cpuopt_return_stack_buffer",
@@ -297,6 +310,9 @@ struct Values {
                                              Category::CpuDebug};
     Setting<bool> cpuopt_const_prop{linkage, true, "cpuopt_const_prop", Category::CpuDebug};
     Setting<bool> cpuopt_misc_ir{linkage, true, "cpuopt_misc_ir", Category::CpuDebug};
+    Setting<bool> cpuopt_block_merging{linkage, true, "cpuopt_block_merging", Category::CpuDebug};
+    Setting<bool> cpuopt_precompile_successors{linkage, true, "cpuopt_precompile_successors",
+                                               Category::CpuDebug};
     Setting<bool> cpuopt_reduce_misalign_checks{linkage, true, "cpuopt_reduce_misalign_checks",
                                                 Category::CpuDebug};
     SwitchableSetting<bool> cpuopt_fastmem{linkage, true, "cpuopt_fastmem", Category::CpuDebug};
@@ -327,6 +343,8 @@ struct Values {
                                                         linkage, true, "cpuopt_unsafe_fastmem_check", Category::CpuUnsafe};
     SwitchableSetting<bool> cpuopt_unsafe_ignore_global_monitor{
                                                                 linkage, true, "cpuopt_unsafe_ignore_global_monitor", Category::CpuUnsafe};
+    SwitchableSetting<bool> cpuopt_unsafe_direct_fastmem{
+                                                         linkage, false, "cpuopt_unsafe_direct_fastmem", Category::CpuUnsafe};
 
     // Renderer
     SwitchableSetting<RendererBackend, true> renderer_backend{linkage,
@@ -342,6 +360,14 @@ struct Values {
     ResolutionScalingInfo resolution_info{};
     SwitchableSetting<ResolutionSetup> resolution_setup{linkage, ResolutionSetup::Res1X,
                                                         "resolution_setup", Category::Renderer};
+    SwitchableSetting<bool> dynamic_resolution{linkage, false, "dynamic_resolution",
+                                               Category::Renderer};
+    SwitchableSetting<ResolutionSetup> dynamic_resolution_min{linkage, ResolutionSetup::Res3_4X,
+                                                              "dynamic_resolution_min",
+                                                              Category::Renderer};
+    SwitchableSetting<ResolutionSetup> dynamic_resolution_max{linkage, ResolutionSetup::Res2X,
+                                                              "dynamic_resolution_max",
+                                                              Category::Renderer};
 
     SwitchableSetting<VSyncMode, true> vsync_mode{linkage,
                                                   VSyncMode::Fifo,
@@ -428,8 +454,6 @@ struct Values {
                                                       true,
                                                       true};
 
-    GpuAccuracy current_gpu_accuracy{GpuAccuracy::High};
-
     SwitchableSetting<DmaAccuracy, true> dma_accuracy{linkage,
                                                       DmaAccuracy::Default,
                                                       "dma_accuracy",
@@ -468,6 +492,8 @@ struct Values {
                                                             AstcDecodeMode::Gpu,
                                                             "accelerate_astc",
                                                             Category::RendererAdvanced};
+    SwitchableSetting<bool> accelerate_bcn{linkage, true, "accelerate_bcn",
+                                           Category::RendererAdvanced};
 
     SwitchableSetting<FramePacingMode, true> frame_pacing_mode{linkage,
                                                                FramePacingMode::Target_Auto,
@@ -478,6 +504,18 @@ struct Values {
                                                                Specialization::Default,
                                                                true,
                                                                true};
+    SwitchableSetting<bool> frame_interpolation{linkage, false, "frame_interpolation",
+                                                Category::RendererAdvanced};
+
+    SwitchableSetting<u8, true> max_frames_in_flight{linkage,
+                                                     0,
+                                                     0,
+                                                     3,
+                                                     "max_frames_in_flight",
+                                                     Category::RendererAdvanced,
+                                                     Specialization::Default,
+                                                     true,
+                                                     false};
 
     SwitchableSetting<AstcRecompression, true> astc_recompression{linkage,
                                                                   AstcRecompression::Uncompressed,
@@ -587,6 +625,9 @@ struct Values {
     SwitchableSetting<bool> use_asynchronous_shaders{linkage, false, "use_asynchronous_shaders",
                                                      Category::RendererHacks};
 
+    SwitchableSetting<bool> async_query_readback{linkage, false, "async_query_readback",
+                                                 Category::RendererHacks};
+
     SwitchableSetting<GpuUnswizzleSize> gpu_unswizzle_texture_size{linkage,
                                                   GpuUnswizzleSize::Large,
                                                   "gpu_unswizzle_texture_size",
@@ -635,6 +676,9 @@ struct Values {
 #endif
                                                        "vertex_input_dynamic_state", Category::RendererExtensions};
 
+    Setting<bool> dynamic_rendering{linkage, false, "dynamic_rendering",
+                                    Category::RendererExtensions};
+
     Setting<bool> renderer_debug{linkage, false, "debug", Category::RendererDebug};
     Setting<bool> renderer_shader_feedback{linkage, false, "shader_feedback",
                                            Category::RendererDebug};
@@ -654,6 +698,12 @@ struct Values {
                                          Specialization::Default,
                                                          true,
                                                          true};
+    Setting<bool> disable_async_transfer_queue{linkage, false, "disable_async_transfer_queue",
+                                               Category::RendererDebug};
+    /// Makes the null renderer translate the guest shaders, to profile the shader recompiler
+    Setting<bool> null_renderer_translate_shaders{linkage, false,
+                                                  "null_renderer_translate_shaders",
+                                                  Category::RendererDebug};
 
     // System
     SwitchableSetting<Language, true> language_index{linkage,
@@ -803,6 +853,8 @@ struct Values {
                                false};
     Setting<bool> dump_macros{
                               linkage, false, "dump_macros", Category::DebuggingGraphics, Specialization::Default, false};
+    /// Frames of GPU commands to record into the dump directory when emulation starts
+    Setting<u16> gpu_capture_frames{linkage, 0, "gpu_capture_frames", Category::DebuggingGraphics};
     Setting<bool> enable_fs_access_log{linkage, false, "enable_fs_access_log", Category::Debugging};
     Setting<bool> reporting_services{
                                      linkage, false, "reporting_services", Category::Debugging, Specialization::Default, false};
@@ -821,6 +873,8 @@ struct Values {
                                          Category::Debugging};
     Setting<bool> perform_vulkan_check{linkage, true, "perform_vulkan_check", Category::Debugging};
     Setting<bool> disable_web_applet{linkage, true, "disable_web_applet", Category::Debugging};
+    Setting<bool> enable_hot_path_tracing{linkage, false, "enable_hot_path_tracing",
+                                          Category::Debugging};
 
     // GPU Logging
     Setting<GpuLogLevel> gpu_log_level{linkage, GpuLogLevel::Off, "gpu_log_level",
@@ -846,6 +900,7 @@ struct Values {
     // Miscellaneous
     Setting<std::string> log_filter{linkage, "*:Info", "log_filter", Category::Miscellaneous};
     Setting<bool> log_flush_line{linkage, false, "flush_line", Category::Miscellaneous, Specialization::Default, true, true};
+    Setting<bool> log_binary{linkage, false, "log_binary", Category::Miscellaneous};
     Setting<bool> censor_username{linkage, true, "censor_username", Category::Miscellaneous};
     Setting<bool> first_launch{linkage, true, "first_launch", Category::Miscellaneous};
 
@@ -853,6 +908,10 @@ struct Values {
     Setting<std::string> network_interface{linkage, std::string(), "network_interface",
                                            Category::Network};
     SwitchableSetting<bool> airplane_mode{linkage, false, "airplane_mode", Category::Network};
+    // Send the local wireless datagrams straight to the room members that enabled it too. The
+    // room shares the public address of this member with them.
+    Setting<bool> multiplayer_direct_connect{linkage, false, "multiplayer_direct_connect",
+                                             Category::Network};
 
     // WebService
     Setting<std::string> web_api_url{linkage, "api.ynet-fun.xyz", "web_api_url",
@@ -873,18 +932,34 @@ extern Values values;
 
 bool getDebugKnobAt(u8 i);
 
-void UpdateGPUAccuracy();
-bool IsGPULevelHigh();
+/**
+ * Resolved values of the settings the GPU checks on every command list, draw or buffer upload.
+ * Reading a switchable setting picks between its global and custom values each time, the snapshot
+ * is a set of plain fields instead. It is taken when the GPU starts and after each command list, so
+ * a setting changed while running is picked up at the next command list, as before.
+ */
+struct SettingsSnapshot {
+    GpuAccuracy gpu_accuracy{GpuAccuracy::High};
+    /// Whether the pushbuffers are read from guest memory with the safe path
+    bool use_safe_dma{};
+    /// Whether fences wait for the pending flushes to be committed before being signaled
+    bool delay_fences{};
+    /// Whether a buffer waits for the GPU to catch up with its last write before being accessed
+    bool wait_for_buffer_fences{};
+    /// Ticks the GPU may lag behind the last write of a buffer before waiting for it
+    u64 buffer_fence_tick_delay{};
+    bool use_reactive_flushing{};
+    bool enable_gpu_buffer_readback{};
+    bool sync_memory_operations{};
+};
 
-bool IsDMALevelDefault();
-bool IsDMALevelSafe();
+void UpdateSnapshot();
+const SettingsSnapshot& GetSnapshot();
 
-bool IsGPUFenceBehaviorDefault();
-bool IsGPUFenceBehaviorBalanced();
-bool IsGPUFenceBehaviorAccurate();
-bool IsGPUFenceBehaviorStrict();
+bool IsGPULevelHigh();
 
 bool IsFastmemEnabled();
+bool IsFastmemDirectMapped();
 void SetNceEnabled(bool is_64bit);
 bool IsNceEnabled();
 
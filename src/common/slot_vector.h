@@ -152,6 +152,11 @@ public:
         return values_capacity - free_list.size();
     }
 
+    /// Number of slots, every id the vector hands out is below it
+    [[nodiscard]] size_t capacity() const noexcept {
+        return values_capacity;
+    }
+
 private:
     struct NonTrivialDummy {
         NonTrivialDummy() noexcept {}
@@ -225,6 +230,75 @@ private:
     std::vector<u32> free_list;
 };
 
+/// Slot id that remembers which object it was made for, see PackedSlotVector
+struct SlotHandle {
+    constexpr auto operator<=>(const SlotHandle&) const noexcept = default;
+    constexpr explicit operator bool() const noexcept {
+        return static_cast<bool>(id);
+    }
+
+    SlotId id;
+    u32 generation = 0;
+};
+
+/**
+ * SlotVector that also keeps a small copy of the hot fields of every object in a packed array, so
+ * loops that only test addresses or flags don't pull whole objects into the cache. Hot is built
+ * from the object when it is inserted, the owner keeps fields that change in sync through Hot().
+ *
+ * Every slot also counts how many objects it held, so handles to erased objects can be told
+ * apart from handles to whatever reused the slot.
+ */
+template <class T, class Hot>
+    requires std::is_trivially_copyable_v<Hot> && std::is_constructible_v<Hot, const T&>
+class PackedSlotVector : public SlotVector<T> {
+public:
+    template <typename... Args>
+    [[nodiscard]] SlotId insert(Args&&... args) noexcept {
+        const SlotId id = SlotVector<T>::insert(std::forward<Args>(args)...);
+        if (id.Value() >= hot.size()) {
+            hot.resize(this->capacity());
+            generations.resize(this->capacity());
+        }
+        hot[id.Value()] = Hot((*this)[id]);
+        return id;
+    }
+
+    void erase(SlotId id) noexcept {
+        ++generations[id.Value()];
+        SlotVector<T>::erase(id);
+    }
+
+    using SlotVector<T>::operator[];
+
+    [[nodiscard]] T& operator[](SlotHandle handle) noexcept {
+        DEBUG_ASSERT(IsCurrent(handle));
+        return (*this)[handle.id];
+    }
+
+    [[nodiscard]] Hot& GetHot(SlotId id) noexcept {
+        return hot[id.Value()];
+    }
+
+    [[nodiscard]] const Hot& GetHot(SlotId id) const noexcept {
+        return hot[id.Value()];
+    }
+
+    [[nodiscard]] SlotHandle MakeHandle(SlotId id) const noexcept {
+        return SlotHandle{id, generations[id.Value()]};
+    }
+
+    /// Whether the object the handle was made for is still stored
+    [[nodiscard]] bool IsCurrent(SlotHandle handle) const noexcept {
+        return handle.id && handle.id.Value() < generations.size() &&
+               generations[handle.id.Value()] == handle.generation;
+    }
+
+private:
+    std::vector<Hot> hot;
+    std::vector<u32> generations;
+};
+
 } // namespace Common
 
 template <>
@@ -15,6 +15,18 @@
 
 namespace Common {
 
+/// @brief Tells the CPU that the thread is busy waiting, easing the pressure on a sibling
+/// hyperthread and on the memory bus.
+inline void CpuRelax() noexcept {
+#if defined(ARCHITECTURE_x86_64)
+    _mm_pause();
+#elif defined(ARCHITECTURE_arm64) && defined(_MSC_VER)
+    __yield();
+#elif defined(ARCHITECTURE_arm64)
+    asm("yield");
+#endif
+}
+
 /// @brief A lock similar to mutex that forces a thread to spin wait instead calling the
 /// supervisor. Should be used on short sequences of code.
 struct SpinLock {
@@ -26,13 +38,7 @@ struct SpinLock {
 
     inline void lock() noexcept {
         while (lck.test_and_set(std::memory_order_acquire)) {
-#if defined(ARCHITECTURE_x86_64)
-            _mm_pause();
-#elif defined(ARCHITECTURE_arm64) && defined(_MSC_VER)
-            __yield();
-#elif defined(ARCHITECTURE_arm64)
-            asm("yield");
-#endif
+            CpuRelax();
         }
     }
 
@@ -4,15 +4,23 @@
 // SPDX-FileCopyrightText: 2014 Citra Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <chrono>
+#include <fstream>
 #include <limits>
+#include <numeric>
+#include <ranges>
+#include <span>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "common/error.h"
 #include "common/logging.h"
 #include "common/assert.h"
+#include "common/settings.h"
 #include "common/thread.h"
+#include "common/trace.h"
 #ifdef __APPLE__
 #include <mach/mach.h>
 #elif defined(__HAIKU__)
@@ -97,6 +105,7 @@ void SetCurrentThreadPriority(ThreadPriority new_priority) {
 }
 
 void SetCurrentThreadName(const char* name) {
+    Trace::SetThreadName(name);
 #ifdef _MSC_VER
     // Sets the debugger-visible name of the current thread.
     if (auto pf = (decltype(&SetThreadDescription))(void*)GetProcAddress(GetModuleHandle(TEXT("KernelBase.dll")), "SetThreadDescription"); pf)
@@ -132,30 +141,171 @@ void SetCurrentThreadName(const char* name) {
 #endif
 }
 
-void PinCurrentThreadToPerformanceCore(size_t core_id) {
-    ASSERT(core_id < 4);
-    // If we set a flag for a CPU that doesn't exist, the thread may not be allowed to
-    // run in ANY processor!
-    auto const total_cores = std::thread::hardware_concurrency();
-    if (core_id < total_cores) {
+namespace {
+
+/// Cores at least this fast, in percent of the fastest one, count as big cores
+constexpr u64 BigCorePerformancePercent = 80;
+
+#if defined(__linux__)
+u64 ReadCpuValue(u32 cpu, const char* file) {
+    std::ifstream stream{"/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/" + file};
+    u64 value{};
+    if (!(stream >> value)) {
+        return 0;
+    }
+    return value;
+}
+#endif
+
+/// Relative performance of each logical processor, empty when it can't be told
+std::vector<u64> GetCorePerformance() {
+    const u32 total_cores = std::thread::hardware_concurrency();
+    std::vector<u64> performance;
+#if defined(__linux__)
+    // The scheduler capacity accounts for the microarchitecture, the max frequency is a fallback
+    for (const char* file : {"cpu_capacity", "cpufreq/cpuinfo_max_freq"}) {
+        performance.assign(total_cores, 0);
+        if (std::ranges::all_of(std::views::iota(0U, total_cores), [&](u32 cpu) {
+                performance[cpu] = ReadCpuValue(cpu, file);
+                return performance[cpu] != 0;
+            })) {
+            return performance;
+        }
+    }
+    performance.clear();
+#elif defined(_WIN32)
+    DWORD length = 0;
+    GetLogicalProcessorInformationEx(RelationProcessorCore, nullptr, &length);
+    std::vector<u8> buffer(length);
+    if (length == 0 ||
+        !GetLogicalProcessorInformationEx(
+            RelationProcessorCore,
+            reinterpret_cast<SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(buffer.data()), &length)) {
+        return {};
+    }
+    // Only the first processor group is used, as with the affinity masks below
+    performance.assign((std::min)(total_cores, 64U), 0);
+    for (DWORD offset = 0; offset < length;) {
+        const auto& entry =
+            *reinterpret_cast<const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(buffer.data() + offset);
+        const GROUP_AFFINITY& group_mask = entry.Processor.GroupMask[0];
+        for (u32 cpu = 0; group_mask.Group == 0 && cpu < performance.size(); ++cpu) {
+            if ((group_mask.Mask >> cpu) & 1) {
+                performance[cpu] = u64(entry.Processor.EfficiencyClass) + 1;
+            }
+        }
+        offset += entry.Size;
+    }
+#endif
+    return performance;
+}
+
+/// Logical processors of the performance cores, all of them when the cores are alike
+const std::vector<u32>& GetBigCores() {
+    static const std::vector<u32> big_cores = [] {
+        const std::vector<u64> performance = GetCorePerformance();
+        std::vector<u32> cores;
+        if (!performance.empty()) {
+            const u64 fastest = *std::ranges::max_element(performance);
+            for (u32 cpu = 0; cpu < performance.size(); ++cpu) {
+                if (performance[cpu] * 100 >= fastest * BigCorePerformancePercent) {
+                    cores.push_back(cpu);
+                }
+            }
+        }
+        if (cores.empty()) {
+            cores.resize((std::max)(std::thread::hardware_concurrency(), 1U));
+            std::iota(cores.begin(), cores.end(), 0U);
+        }
+        return cores;
+    }();
+    return big_cores;
+}
+
+void SetCurrentThreadAffinity(std::span<const u32> cores) {
 #if defined(__ANDROID__)
-        cpu_set_t set;
-        CPU_ZERO(&set);
-        CPU_SET(core_id, &set);
-        sched_setaffinity(pthread_self(), sizeof(set), &set);
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (const u32 core : cores) {
+        CPU_SET(core, &set);
+    }
+    sched_setaffinity(gettid(), sizeof(set), &set);
 #elif defined(__linux__) || defined(__FreeBSD__)
-        cpu_set_t set;
-        CPU_ZERO(&set);
-        CPU_SET(core_id, &set);
-        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (const u32 core : cores) {
+        CPU_SET(core, &set);
+    }
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
 #elif defined(_WIN32)
-        DWORD set = 1UL << core_id;
-        SetThreadAffinityMask(GetCurrentThread(), set);
+    DWORD_PTR set = 0;
+    for (const u32 core : cores) {
+        set |= DWORD_PTR(1) << core;
+    }
+    SetThreadAffinityMask(GetCurrentThread(), set);
 #else
-        // No pin functionality implemented
+    // No pin functionality implemented
+    (void)cores;
 #endif
+}
+
+struct ThreadRoleInfo {
+    ThreadPriority priority;
+    bool on_big_cores; ///< Whether the emulation speed depends on it
+};
+
+constexpr ThreadRoleInfo GetThreadRoleInfo(ThreadRole role) {
+    switch (role) {
+    case ThreadRole::GuestCore:
+    case ThreadRole::Gpu:
+        return {ThreadPriority::Critical, true};
+    case ThreadRole::Render:
+        return {ThreadPriority::Normal, true};
+    case ThreadRole::Audio:
+    case ThreadRole::Timing:
+        return {ThreadPriority::High, false};
+    case ThreadRole::Service:
+    case ThreadRole::Worker:
+        return {ThreadPriority::Normal, false};
+    }
+    return {ThreadPriority::Normal, false};
+}
+
+} // Anonymous namespace
+
+void SetCurrentThreadRole(ThreadRole role, std::size_t index) {
+    const ThreadRoleInfo info = GetThreadRoleInfo(role);
+    SetCurrentThreadPriority(info.priority);
+
+    const auto placement = Settings::values.thread_placement.GetValue();
+    if (placement == Settings::ThreadPlacement::System || !info.on_big_cores) {
+        return;
+    }
+    const std::vector<u32>& big_cores = GetBigCores();
+    if (placement == Settings::ThreadPlacement::Pin && role == ThreadRole::GuestCore) {
+        // Each guest core gets a host core of its own, so they don't migrate between clusters
+        const u32 core = big_cores[index % big_cores.size()];
+        SetCurrentThreadAffinity({&core, 1});
+        return;
+    }
+    SetCurrentThreadAffinity(big_cores);
+}
+
+#ifdef _WIN32
+bool Event::WaitForCoarse(const std::chrono::nanoseconds time) {
+    // Two ticks of margin cover the rounding of the timeout on either side
+    const auto margin = 2 * Common::Windows::GetCurrentTimerResolution();
+    if (time <= margin) {
+        return false;
+    }
+    std::unique_lock lk{mutex};
+    if (!condvar.wait_for(lk, time - margin, [this] { return is_set.load(); })) {
+        return false;
     }
+    is_set = false;
+    return true;
 }
+#endif
 
 #ifdef ARCHITECTURE_x86_64
 // On Linux and UNIX systems, a futex would nominally be used to cover the costs
@@ -217,6 +367,9 @@ bool Event::WaitFor(const std::chrono::nanoseconds time) {
                 return true;
         }
     } else {
+        if (WaitForCoarse(time)) {
+            return true;
+        }
 #ifdef _MSC_VER
         while (!is_set.load() && end > __rdtsc())
             Common::Windows::SleepForOneTick();
@@ -240,6 +393,9 @@ bool Event::WaitFor(const std::chrono::nanoseconds time) {
 bool Event::WaitFor(const std::chrono::nanoseconds time) {
 #ifdef _WIN32
     auto const end = Common::g_wall_clock.GetTimeNS() + time;
+    if (WaitForCoarse(time)) {
+        return true;
+    }
     while (!is_set.load() && end > Common::g_wall_clock.GetTimeNS())
         Common::Windows::SleepForOneTick();
     if (is_set.load())
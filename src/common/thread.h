@@ -57,6 +57,13 @@ public:
     }
 
 private:
+#ifdef _WIN32
+    /// Sleeps on the condition variable until shortly before the timeout, returning true if the
+    /// event was set meanwhile. Windows rounds timed sleeps to its timer resolution, so the last
+    /// stretch has to be polled to avoid oversleeping.
+    bool WaitForCoarse(std::chrono::nanoseconds time);
+#endif
+
     alignas(64) std::atomic<bool> is_set{false};
     std::condition_variable condvar;
     std::mutex mutex;
@@ -99,8 +106,26 @@ enum class ThreadPriority : u32 {
     Critical = 4,
 };
 
+/// What a host thread is used for, decides its priority and the cores it may run on
+enum class ThreadRole : u32 {
+    GuestCore, ///< Runs an emulated CPU core
+    Gpu,       ///< Processes the GPU command lists
+    Render,    ///< Records, submits and presents host GPU work
+    Audio,     ///< Renders audio
+    Timing,    ///< Fires the core timing events
+    Service,   ///< Runs an HLE service
+    Worker,    ///< Runs background jobs, like shader compilation
+};
+
 void SetCurrentThreadPriority(ThreadPriority new_priority);
 void SetCurrentThreadName(const char* name);
-void PinCurrentThreadToPerformanceCore(size_t core_id);
+
+/**
+ * Applies the priority of a role to the calling thread, and places it on the host cores following
+ * the thread placement setting.
+ * @param role  Role of the calling thread
+ * @param index Index of the thread among the ones of the same role, picks the core it's pinned to
+ */
+void SetCurrentThreadRole(ThreadRole role, std::size_t index = 0);
 
 } // namespace Common
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <condition_variable>
 #include <functional>
@@ -22,6 +23,14 @@
 
 namespace Common {
 
+/// Order in which queued work is picked up by the workers, work of the same priority is FIFO.
+enum class WorkPriority : size_t {
+    High,   ///< Needed right now, e.g. by the current draw
+    Normal,
+    Low,    ///< Speculative work that may never be needed, e.g. disk cache loads
+    Count,
+};
+
 template <class StateType = void>
 class StatefulThreadWorker {
     static constexpr bool with_state = !std::is_same_v<StateType, void>;
@@ -41,22 +50,21 @@ public:
         : workers_queued{num_workers}, thread_name{std::move(name)} {
         const auto lambda = [this, func](std::stop_token stop_token) {
             Common::SetCurrentThreadName(thread_name.c_str());
+            Common::SetCurrentThreadRole(Common::ThreadRole::Worker);
             {
                 [[maybe_unused]] std::conditional_t<with_state, StateType, int> state{func()};
                 while (!stop_token.stop_requested()) {
                     Task task;
                     {
                         std::unique_lock lock{queue_mutex};
-                        if (requests.empty()) {
+                        if (!HasRequests()) {
                             wait_condition.notify_all();
                         }
-                        condition.wait(lock, stop_token,
-                                       [this] { return !requests.empty(); });
+                        condition.wait(lock, stop_token, [this] { return HasRequests(); });
                         if (stop_token.stop_requested()) {
                             break;
                         }
-                        task = std::move(requests.front());
-                        requests.pop();
+                        task = PopRequest();
                     }
                     if constexpr (with_state) {
                         task(&state);
@@ -81,15 +89,35 @@ public:
     StatefulThreadWorker& operator=(StatefulThreadWorker&&) = delete;
     StatefulThreadWorker(StatefulThreadWorker&&) = delete;
 
-    void QueueWork(Task work) {
+    void QueueWork(Task work, WorkPriority priority = WorkPriority::Normal) {
         {
             std::unique_lock lock{queue_mutex};
-            requests.emplace(std::move(work));
+            requests[static_cast<size_t>(priority)].emplace(std::move(work));
             ++work_scheduled;
         }
         condition.notify_one();
     }
 
+    /// Drops all the work of the given priority that hasn't started yet.
+    /// @returns The number of discarded tasks
+    size_t CancelWork(WorkPriority priority) {
+        size_t num_cancelled{};
+        {
+            std::unique_lock lock{queue_mutex};
+            auto& queue = requests[static_cast<size_t>(priority)];
+            num_cancelled = queue.size();
+            queue = {};
+            // Cancelled work counts as done so WaitForRequests doesn't wait on it
+            work_done += num_cancelled;
+        }
+        wait_condition.notify_all();
+        return num_cancelled;
+    }
+
+    [[nodiscard]] size_t NumWorkers() const noexcept {
+        return threads.size();
+    }
+
     void WaitForRequests(std::stop_token stop_token = {}) {
         std::stop_callback callback(stop_token, [this] {
             for (auto& thread : threads) {
@@ -103,7 +131,27 @@ public:
     }
 
 private:
-    std::queue<Task> requests;
+    bool HasRequests() const {
+        for (const auto& queue : requests) {
+            if (!queue.empty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    Task PopRequest() {
+        for (auto& queue : requests) {
+            if (!queue.empty()) {
+                Task task = std::move(queue.front());
+                queue.pop();
+                return task;
+            }
+        }
+        return {};
+    }
+
+    std::array<std::queue<Task>, static_cast<size_t>(WorkPriority::Count)> requests;
     std::mutex queue_mutex;
     std::condition_variable_any condition;
     std::condition_variable wait_condition;
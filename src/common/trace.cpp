@@ -0,0 +1,190 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "common/fs/file.h"
+#include "common/logging.h"
+#include "common/steady_clock.h"
+#include "common/trace.h"
+
+namespace Common::Trace {
+
+namespace Detail {
+std::atomic_bool is_enabled{false};
+}
+
+namespace {
+
+/// Events kept per thread, older events are overwritten
+constexpr size_t RING_SIZE = 1 << 16;
+
+struct Event {
+    const char* name;
+    u64 begin_ns;
+    u64 end_ns;
+    Track track;
+};
+
+struct ThreadRing {
+    std::array<Event, RING_SIZE> events;
+    std::atomic<u64> write_index{0};
+    u64 consumed_index{0};
+    u32 thread_id{};
+    std::string thread_name;
+};
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadRing>> rings;
+    u32 next_thread_id = 1;
+};
+
+Registry& GetRegistry() {
+    static Registry registry;
+    return registry;
+}
+
+thread_local ThreadRing* local_ring = nullptr;
+thread_local std::string local_thread_name;
+
+ThreadRing& GetLocalRing() {
+    if (local_ring) [[likely]] {
+        return *local_ring;
+    }
+    Registry& registry = GetRegistry();
+    std::scoped_lock lock{registry.mutex};
+    auto& ring = registry.rings.emplace_back(std::make_unique<ThreadRing>());
+    ring->thread_id = registry.next_thread_id++;
+    ring->thread_name = local_thread_name;
+    local_ring = ring.get();
+    return *local_ring;
+}
+
+void AppendJsonString(std::string& out, std::string_view string) {
+    for (const char c : string) {
+        switch (c) {
+        case '"':
+            out += "\\\"";
+            break;
+        case '\\':
+            out += "\\\\";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) >= 0x20) {
+                out += c;
+            }
+            break;
+        }
+    }
+}
+
+} // Anonymous namespace
+
+void SetEnabled(bool enabled) {
+    Detail::is_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+u64 Now() noexcept {
+    return static_cast<u64>(SteadyClock::Now().time_since_epoch().count());
+}
+
+void AddEvent(const char* name, u64 begin_ns, u64 end_ns, Track track) {
+    if (!IsEnabled()) {
+        return;
+    }
+    ThreadRing& ring = GetLocalRing();
+    const u64 index = ring.write_index.load(std::memory_order_relaxed);
+    ring.events[index % RING_SIZE] = Event{
+        .name = name,
+        .begin_ns = begin_ns,
+        .end_ns = end_ns,
+        .track = track,
+    };
+    ring.write_index.store(index + 1, std::memory_order_release);
+}
+
+void SetThreadName(std::string_view name) {
+    local_thread_name = name;
+    if (local_ring) {
+        std::scoped_lock lock{GetRegistry().mutex};
+        local_ring->thread_name = name;
+    }
+}
+
+void ConsumeThreadEvents(const std::function<void(const char* name, u64 duration_ns)>& func) {
+    ThreadRing& ring = GetLocalRing();
+    const u64 end = ring.write_index.load(std::memory_order_relaxed);
+    const u64 begin = (std::max)(ring.consumed_index, end > RING_SIZE ? end - RING_SIZE : 0);
+    for (u64 index = begin; index < end; ++index) {
+        const Event& event = ring.events[index % RING_SIZE];
+        func(event.name, event.end_ns - event.begin_ns);
+    }
+    ring.consumed_index = end;
+}
+
+bool DumpChromeTrace(const std::filesystem::path& path) {
+    // Rings are read while their threads may still write to them, skip the slots that are the
+    // most likely to be overwritten during the dump.
+    static constexpr u64 OVERWRITE_SLACK = 1024;
+
+    std::string out = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first = true;
+    const auto append = [&](std::string_view event) {
+        if (!first) {
+            out += ',';
+        }
+        first = false;
+        out += event;
+    };
+    u64 base_ns = ~0ULL;
+    Registry& registry = GetRegistry();
+    std::scoped_lock lock{registry.mutex};
+    for (const auto& ring : registry.rings) {
+        const u64 end = ring->write_index.load(std::memory_order_acquire);
+        const u64 begin = end > RING_SIZE - OVERWRITE_SLACK ? end - (RING_SIZE - OVERWRITE_SLACK) : 0;
+        for (u64 index = begin; index < end; ++index) {
+            base_ns = (std::min)(base_ns, ring->events[index % RING_SIZE].begin_ns);
+        }
+    }
+    for (const auto& ring : registry.rings) {
+        std::string name;
+        AppendJsonString(name, ring->thread_name.empty() ? fmt::format("Thread {}", ring->thread_id)
+                                                         : ring->thread_name);
+        append(fmt::format("{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},"
+                           "\"args\":{{\"name\":\"{}\"}}}}",
+                           ring->thread_id, name));
+        const u64 end = ring->write_index.load(std::memory_order_acquire);
+        const u64 begin = end > RING_SIZE - OVERWRITE_SLACK ? end - (RING_SIZE - OVERWRITE_SLACK) : 0;
+        for (u64 index = begin; index < end; ++index) {
+            const Event& event = ring->events[index % RING_SIZE];
+            const u32 pid = event.track == Track::Gpu ? 2 : 1;
+            std::string event_name;
+            AppendJsonString(event_name, event.name);
+            append(fmt::format("{{\"name\":\"{}\",\"ph\":\"X\",\"pid\":{},\"tid\":{},"
+                               "\"ts\":{:.3f},\"dur\":{:.3f}}}",
+                               event_name, pid, ring->thread_id,
+                               static_cast<double>(event.begin_ns - base_ns) / 1000.0,
+                               static_cast<double>(event.end_ns - event.begin_ns) / 1000.0));
+        }
+    }
+    append("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"CPU\"}}");
+    append("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":2,\"args\":{\"name\":\"GPU\"}}");
+    out += "]}";
+
+    if (FS::WriteStringToFile(path, FS::FileType::TextFile, out) != out.size()) {
+        LOG_ERROR(Common, "Failed to write trace to {}", path.string());
+        return false;
+    }
+    LOG_INFO(Common, "Trace written to {}", path.string());
+    return true;
+}
+
+} // namespace Common::Trace
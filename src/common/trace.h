@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <filesystem>
+#include <functional>
+#include <string_view>
+
+#include "common/common_funcs.h"
+#include "common/common_types.h"
+
+/// Lightweight hot path tracing.
+/// Every thread appends events to its own fixed size ring without taking locks, the rings are
+/// merged into a Chrome trace (also readable by Perfetto) on demand.
+namespace Common::Trace {
+
+/// Virtual tracks for events not timed on the recording thread
+enum class Track : u32 {
+    Thread = 0, ///< The calling thread
+    Gpu = 1,    ///< Timestamps read back from the host GPU
+};
+
+namespace Detail {
+extern std::atomic_bool is_enabled;
+}
+
+/// Returns true when events are being recorded
+[[nodiscard]] inline bool IsEnabled() noexcept {
+    return Detail::is_enabled.load(std::memory_order_relaxed);
+}
+
+/// Starts or stops recording events
+void SetEnabled(bool enabled);
+
+/// Returns the timestamp used by trace events in nanoseconds
+[[nodiscard]] u64 Now() noexcept;
+
+/// Records a complete event, name must outlive the trace (string literals)
+void AddEvent(const char* name, u64 begin_ns, u64 end_ns, Track track = Track::Thread);
+
+/// Names the calling thread in the dumped trace
+void SetThreadName(std::string_view name);
+
+/// Writes all the recorded events as a Chrome trace JSON file
+bool DumpChromeTrace(const std::filesystem::path& path);
+
+/// Calls func for the events recorded by the calling thread since the previous call.
+/// Events overwritten in the meantime are skipped.
+void ConsumeThreadEvents(const std::function<void(const char* name, u64 duration_ns)>& func);
+
+class ScopedEvent {
+public:
+    explicit ScopedEvent(const char* name_) noexcept
+        : name{IsEnabled() ? name_ : nullptr}, begin{name ? Now() : 0} {}
+
+    ~ScopedEvent() {
+        if (name) {
+            AddEvent(name, begin, Now());
+        }
+    }
+
+    ScopedEvent(const ScopedEvent&) = delete;
+    ScopedEvent& operator=(const ScopedEvent&) = delete;
+
+private:
+    const char* name;
+    u64 begin;
+};
+
+} // namespace Common::Trace
+
+/// Records the time spent until the end of the current scope
+#define TRACE_SCOPE(name) ::Common::Trace::ScopedEvent CONCAT2(trace_scope_, __LINE__){name}
@@ -12,6 +12,8 @@ namespace Common {
 
 void* AllocateMemoryPages(std::size_t size) noexcept;
 void FreeMemoryPages(void* base, std::size_t size) noexcept;
+/// Makes pages inaccessible, so touching them faults instead of silently corrupting memory
+void ProtectMemoryPages(void* base, std::size_t size) noexcept;
 
 template <typename T>
 class VirtualBuffer final {
@@ -56,6 +56,9 @@ public:
     // Perform any backend-specific initialization.
     virtual void Initialize() {}
 
+    // Perform any backend-specific teardown that still needs the guest address space.
+    virtual void Finalize() {}
+
     // Runs the CPU until an event happens.
     virtual HaltReason RunThread(Kernel::KThread* thread) = 0;
 
@@ -28,6 +28,7 @@ struct BacktraceEntry {
     std::string name;
 };
 
+void SymbolicateBacktrace(Kernel::KProcess* process, std::vector<BacktraceEntry>& out);
 std::vector<BacktraceEntry> GetBacktraceFromContext(Kernel::KProcess* process,
                                                     const Kernel::Svc::ThreadContext& ctx);
 std::vector<BacktraceEntry> GetBacktrace(const Kernel::KThread* thread);
@@ -11,6 +11,8 @@
 #include "core/arm/dynarmic/dynarmic_exclusive_monitor.h"
 #include "core/core_timing.h"
 #include "core/hle/kernel/k_process.h"
+#include "core/hle/kernel/svc.h"
+#include "core/hle/kernel/svc_fast_path.h"
 
 namespace Core {
 
@@ -108,6 +110,14 @@ void DynarmicCallbacks32::ExceptionRaised(u32 pc, Dynarmic::A32::Exception excep
 }
 
 void DynarmicCallbacks32::CallSVC(u32 swi) {
+    if (const auto result = Kernel::Svc::CallFast(m_parent.m_system, swi)) {
+        m_parent.m_jit->Regs()[0] = static_cast<u32>(*result);
+        // 64-bit results are split across r0 and r1 on AArch32.
+        if (static_cast<Kernel::Svc::SvcId>(swi) == Kernel::Svc::SvcId::GetSystemTick) {
+            m_parent.m_jit->Regs()[1] = static_cast<u32>(*result >> 32);
+        }
+        return;
+    }
     m_parent.m_svc_swi = swi;
     m_parent.m_jit->HaltExecution(SupervisorCall);
 }
@@ -301,6 +311,8 @@ void ArmDynarmic32::MakeJit(Common::PageTable* page_table) {
         config.fastmem_exclusive_access = false;
     }
     m_jit.emplace(config);
+    m_code_cache_account = Common::MemoryAccounting::Account{
+        Common::MemoryAccounting::Tag::JitCodeCache, config.code_cache_size};
 }
 
 static std::pair<u32, u32> FpscrToFpsrFpcr(u32 fpscr) {
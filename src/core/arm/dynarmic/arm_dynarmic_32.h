@@ -8,6 +8,7 @@
 
 #include <dynarmic/interface/A32/a32.h>
 #include <dynarmic/interface/code_page.h>
+#include "common/memory_accounting.h"
 
 #include "core/arm/arm_interface.h"
 #include "core/arm/dynarmic/dynarmic_exclusive_monitor.h"
@@ -107,6 +108,7 @@ private:
     std::size_t m_core_index{};
 
     std::optional<Dynarmic::A32::Jit> m_jit{};
+    Common::MemoryAccounting::Account m_code_cache_account;
 
     // SVC callback
     u32 m_svc_swi{};
@@ -4,17 +4,35 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <array>
+#include <fstream>
+#include <map>
+#include <vector>
+
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/hex_util.h"
+#include "common/logging.h"
 #include "common/settings.h"
+#include "core/arm/debug.h"
 #include "core/arm/dynarmic/arm_dynarmic.h"
 #include "core/arm/dynarmic/arm_dynarmic_64.h"
 #include "core/arm/dynarmic/dynarmic_exclusive_monitor.h"
+#include "core/core.h"
 #include "core/core_timing.h"
+#include "core/device_memory.h"
 #include "core/hle/kernel/k_process.h"
+#include "core/hle/kernel/svc_fast_path.h"
 
 namespace Core {
 
 using namespace Common::Literals;
 
+namespace {
+constexpr std::array<char, 8> BLOCK_CACHE_MAGIC_NUMBER{'e', 'd', 'e', 'n', 'j', 'i', 't', 'b'};
+constexpr u32 BLOCK_CACHE_VERSION = 1;
+} // Anonymous namespace
+
 DynarmicCallbacks64::DynarmicCallbacks64(ArmDynarmic64& parent, Kernel::KProcess* process)
     : m_parent{parent}, m_memory(process->GetMemory())
     , m_process(process), m_debugger_enabled{parent.m_system.DebuggerEnabled()}
@@ -101,6 +119,25 @@ bool DynarmicCallbacks64::MemoryWriteExclusive128(u64 vaddr, Dynarmic::A64::Vect
             m_memory.WriteExclusive128(vaddr, value, expected);
 }
 
+bool DynarmicCallbacks64::IsReadOnlyMemory(u64 vaddr) {
+    // Breakpoints and memory edits from the debugger would be missed by folded reads
+    if (m_debugger_enabled)
+        return false;
+    if (vaddr >= m_read_only_begin && vaddr < m_read_only_end)
+        return true;
+    // Only the static segments of the main image are never remapped or written to
+    Kernel::KMemoryInfo info;
+    Kernel::Svc::PageInfo page_info;
+    if (m_process->GetPageTable().QueryInfo(&info, &page_info, vaddr) != ResultSuccess)
+        return false;
+    if (info.m_state != Kernel::KMemoryState::Code ||
+        True(info.m_permission & Kernel::KMemoryPermission::UserWrite))
+        return false;
+    m_read_only_begin = info.m_address;
+    m_read_only_end = info.m_address + info.m_size;
+    return true;
+}
+
 void DynarmicCallbacks64::InstructionCacheOperationRaised(Dynarmic::A64::InstructionCacheOperation op, u64 value) {
     last_code_addr = u64(-1); //invalidate cached page
     switch (op) {
@@ -121,6 +158,12 @@ void DynarmicCallbacks64::InstructionCacheOperationRaised(Dynarmic::A64::Instruc
     m_parent.m_jit->HaltExecution(Dynarmic::HaltReason::CacheInvalidation);
 }
 
+void DynarmicCallbacks64::CodeCacheEvicted(std::size_t evicted_blocks, std::size_t evicted_bytes) {
+    ++m_code_cache_evictions;
+    LOG_INFO(Core_ARM, "Core {} code cache full, evicted {} blocks from {} KiB (eviction #{})",
+             m_parent.m_core_index, evicted_blocks, evicted_bytes / 1024, m_code_cache_evictions);
+}
+
 void DynarmicCallbacks64::ExceptionRaised(u64 pc, Dynarmic::A64::Exception exception) {
     switch (exception) {
     case Dynarmic::A64::Exception::WaitForInterrupt:
@@ -145,6 +188,10 @@ void DynarmicCallbacks64::ExceptionRaised(u64 pc, Dynarmic::A64::Exception excep
 }
 
 void DynarmicCallbacks64::CallSVC(u32 svc) {
+    if (const auto result = Kernel::Svc::CallFast(m_parent.m_system, svc)) {
+        m_parent.m_jit->SetRegister(0, *result);
+        return;
+    }
     m_parent.m_svc = svc;
     m_parent.m_jit->HaltExecution(SupervisorCall);
 }
@@ -263,10 +310,20 @@ void ArmDynarmic64::MakeJit(Common::PageTable* page_table, std::size_t address_s
         config.check_halt_on_memory_access = true;
     }
 
+    // Compile the blocks a missed block links to during the same stall
+    config.precompile_successors = true;
+
+    // Only evict the oldest part of the code cache when it fills instead of recompiling everything
+    config.code_cache_eviction = true;
+
+    // Count block executions for the guest code profile
+    config.enable_block_profiling = Settings::values.cpu_jit_profiling.GetValue();
+
     // null_jit
     if (!page_table) {
         // Don't waste too much memory on null_jit
         config.code_cache_size = std::uint32_t(8_MiB);
+        config.precompile_successors = false;
     }
 
     switch (Settings::values.cpu_accuracy.GetValue()) {
@@ -293,6 +350,12 @@ void ArmDynarmic64::MakeJit(Common::PageTable* page_table, std::size_t address_s
         if (!Settings::values.cpuopt_misc_ir) {
             config.optimizations &= ~Dynarmic::OptimizationFlag::MiscIROpt;
         }
+        if (!Settings::values.cpuopt_block_merging) {
+            config.optimizations &= ~Dynarmic::OptimizationFlag::BlockMerging;
+        }
+        if (!Settings::values.cpuopt_precompile_successors) {
+            config.precompile_successors = false;
+        }
         if (!Settings::values.cpuopt_reduce_misalign_checks) {
             config.only_detect_misalignment_via_page_table_on_page_boundary = false;
         }
@@ -352,10 +415,20 @@ void ArmDynarmic64::MakeJit(Common::PageTable* page_table, std::size_t address_s
         config.fastmem_pointer = std::nullopt;
         config.fastmem_exclusive_access = false;
     }
+    // The loader mapped guest memory at the guest addresses themselves
+    if (config.fastmem_pointer && m_system.DeviceMemory().buffer.IsDirectMapped()) {
+        config.fastmem_pointer = 0;
+    }
     m_jit.emplace(config);
+    m_code_cache_account = Common::MemoryAccounting::Account{
+        Common::MemoryAccounting::Tag::JitCodeCache, config.code_cache_size};
 }
 
 HaltReason ArmDynarmic64::RunThread(Kernel::KThread* thread) {
+    if (!m_block_cache_loaded) {
+        // Modules are only mapped once the process starts running, precompile from here
+        LoadBlockCache();
+    }
     m_jit->ClearExclusiveState();
     return TranslateHaltReason(m_jit->Run());
 }
@@ -399,7 +472,126 @@ ArmDynarmic64::ArmDynarmic64(System& system, bool uses_wall_clock, Kernel::KProc
     MakeJit(&page_table_impl, page_table.GetAddressSpaceWidth());
 }
 
-ArmDynarmic64::~ArmDynarmic64() = default;
+ArmDynarmic64::~ArmDynarmic64() {
+    SaveBlockCache();
+}
+
+void ArmDynarmic64::Finalize() {
+    // Symbolication reads the modules, so this can't wait for the destructor
+    SaveBlockProfile();
+}
+
+void ArmDynarmic64::LoadBlockCache() try {
+    m_block_cache_loaded = true;
+    const auto& build_id = m_system.GetApplicationProcessBuildID();
+    const u64 program_id = m_cb->m_process->GetProgramId();
+    if (!Settings::values.cpu_jit_block_cache.GetValue() || !m_cb->m_process->IsApplication() ||
+        program_id == 0) {
+        return;
+    }
+    // Translations are only reused by the same build of the application, the locations are
+    // recompiled with the current configuration so it does not need to be part of the key
+    const auto cache_dir{Common::FS::GetEdenPath(Common::FS::EdenPath::CacheDir) / "jit"};
+    const auto base_dir{cache_dir / fmt::format("{:016x}", program_id)};
+    if (!Common::FS::CreateDir(cache_dir) || !Common::FS::CreateDir(base_dir)) {
+        LOG_ERROR(Common_Filesystem, "Failed to create JIT cache directories");
+        return;
+    }
+    m_block_cache_path =
+        base_dir / fmt::format("{}_{}.bin", Common::HexToString(build_id, false), m_core_index);
+
+    std::ifstream file(m_block_cache_path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return;
+    }
+    file.exceptions(std::ifstream::failbit);
+    const auto end{file.tellg()};
+    file.seekg(0, std::ios::beg);
+
+    std::array<char, 8> magic_number;
+    u32 cache_version;
+    file.read(magic_number.data(), magic_number.size())
+        .read(reinterpret_cast<char*>(&cache_version), sizeof(cache_version));
+    if (magic_number != BLOCK_CACHE_MAGIC_NUMBER || cache_version != BLOCK_CACHE_VERSION) {
+        file.close();
+        LOG_INFO(Common_Filesystem, "Deleting old JIT cache");
+        Common::FS::RemoveFile(m_block_cache_path);
+        return;
+    }
+    std::vector<u64> locations(static_cast<size_t>(end - file.tellg()) / sizeof(u64));
+    file.read(reinterpret_cast<char*>(locations.data()), locations.size() * sizeof(u64));
+    m_jit->Precompile(locations);
+    LOG_INFO(Core_ARM, "Core {} precompiled {} blocks from the JIT cache", m_core_index,
+             locations.size());
+} catch (const std::ios_base::failure& e) {
+    LOG_ERROR(Common_Filesystem, "{}", e.what());
+    Common::FS::RemoveFile(m_block_cache_path);
+}
+
+void ArmDynarmic64::SaveBlockCache() const try {
+    if (m_block_cache_path.empty()) {
+        return;
+    }
+    const std::vector<u64> locations{m_jit->GetCachedBlockLocations()};
+    if (locations.empty()) {
+        return;
+    }
+    std::ofstream file(m_block_cache_path, std::ios::binary | std::ios::trunc);
+    file.exceptions(std::ofstream::failbit);
+    if (!file.is_open()) {
+        LOG_ERROR(Common_Filesystem, "Failed to open JIT cache file {}",
+                  Common::FS::PathToUTF8String(m_block_cache_path));
+        return;
+    }
+    file.write(BLOCK_CACHE_MAGIC_NUMBER.data(), BLOCK_CACHE_MAGIC_NUMBER.size())
+        .write(reinterpret_cast<const char*>(&BLOCK_CACHE_VERSION), sizeof(BLOCK_CACHE_VERSION))
+        .write(reinterpret_cast<const char*>(locations.data()), locations.size() * sizeof(u64));
+} catch (const std::ios_base::failure& e) {
+    LOG_ERROR(Common_Filesystem, "{}", e.what());
+    Common::FS::RemoveFile(m_block_cache_path);
+}
+
+void ArmDynarmic64::SaveBlockProfile() const {
+    if (!Settings::values.cpu_jit_profiling.GetValue() || !m_jit) {
+        return;
+    }
+    const std::vector<Dynarmic::A64::Jit::BlockProfile> profile{m_jit->GetBlockProfile()};
+    if (profile.empty()) {
+        return;
+    }
+
+    std::vector<BacktraceEntry> entries;
+    entries.reserve(profile.size());
+    for (const auto& block : profile) {
+        entries.push_back({"", 0, block.pc, 0, ""});
+    }
+    SymbolicateBacktrace(m_cb->m_process, entries);
+
+    // Blocks are folded into the function containing them, blocks without a symbol are kept
+    // apart by their offset in the module
+    std::map<std::string, u64> function_cycles;
+    for (size_t i = 0; i < profile.size(); ++i) {
+        const auto& entry{entries[i]};
+        const auto function{entry.name.empty() ? fmt::format("{:#x}", entry.offset) : entry.name};
+        function_cycles[fmt::format("{};{}", entry.module, function)] +=
+            profile[i].executions * profile[i].cycles;
+    }
+
+    const auto path{Common::FS::GetEdenPath(Common::FS::EdenPath::LogDir) /
+                    fmt::format("jit_profile_{:016x}_{}.folded",
+                                m_cb->m_process->GetProgramId(), m_core_index)};
+    std::ofstream file(path, std::ios::trunc);
+    if (!file.is_open()) {
+        LOG_ERROR(Common_Filesystem, "Failed to open JIT profile file {}",
+                  Common::FS::PathToUTF8String(path));
+        return;
+    }
+    for (const auto& [function, cycles] : function_cycles) {
+        file << function << ' ' << cycles << '\n';
+    }
+    LOG_INFO(Core_ARM, "Core {} wrote the profile of {} guest functions to {}", m_core_index,
+             function_cycles.size(), Common::FS::PathToUTF8String(path));
+}
 
 void ArmDynarmic64::SetTpidrroEl0(u64 value) {
     m_cb->m_tpidrro_el0 = value;
@@ -7,12 +7,14 @@
 #pragma once
 
 #include <atomic>
+#include <filesystem>
 #include <memory>
 #include <ankerl/unordered_dense.h>
 
 #include <dynarmic/interface/A64/a64.h>
 #include <dynarmic/interface/code_page.h>
 #include "common/common_types.h"
+#include "common/memory_accounting.h"
 #include "common/hash.h"
 #include "core/arm/arm_interface.h"
 #include "core/arm/dynarmic/dynarmic_exclusive_monitor.h"
@@ -55,7 +57,9 @@ public:
     bool MemoryWriteExclusive32(u64 vaddr, std::uint32_t value, std::uint32_t expected) override;
     bool MemoryWriteExclusive64(u64 vaddr, std::uint64_t value, std::uint64_t expected) override;
     bool MemoryWriteExclusive128(u64 vaddr, Dynarmic::A64::Vector value, Dynarmic::A64::Vector expected) override;
+    bool IsReadOnlyMemory(u64 vaddr) override;
     void InstructionCacheOperationRaised(Dynarmic::A64::InstructionCacheOperation op, u64 value) override;
+    void CodeCacheEvicted(std::size_t evicted_blocks, std::size_t evicted_bytes) override;
     void ExceptionRaised(u64 pc, Dynarmic::A64::Exception exception) override;
     void CallSVC(u32 svc) override;
     void AddTicks(u64 ticks) override;
@@ -66,6 +70,8 @@ public:
 
     Dynarmic::CodePage cached_code_page;
     u64 last_code_addr = u64(-1);
+    u64 m_read_only_begin{};
+    u64 m_read_only_end{};
     ArmDynarmic64& m_parent;
     Core::Memory::Memory& m_memory;
     u64 m_tpidrro_el0{};
@@ -73,6 +79,7 @@ public:
     Kernel::KProcess* m_process{};
     const bool m_debugger_enabled{};
     const bool m_check_memory_access{};
+    u64 m_code_cache_evictions{};
     static constexpr u64 MinimumRunCycles = 10000U;
 };
 
@@ -86,6 +93,8 @@ public:
         return Architecture::AArch64;
     }
 
+    void Finalize() override;
+
     HaltReason RunThread(Kernel::KThread* thread) override;
     HaltReason StepThread(Kernel::KThread* thread) override;
 
@@ -113,10 +122,21 @@ private:
     friend class DynarmicCallbacks64;
 
     void MakeJit(Common::PageTable* page_table, std::size_t address_space_bits);
+
+    /// Precompiles the blocks translated by this core on a previous boot of the application
+    void LoadBlockCache();
+    /// Persists the locations of the blocks currently translated by this core
+    void SaveBlockCache() const;
+    /// Writes the guest functions executed by this core, weighted by cycles, as a flame graph
+    void SaveBlockProfile() const;
+
     std::optional<DynarmicCallbacks64> m_cb{};
     std::size_t m_core_index{};
 
     std::optional<Dynarmic::A64::Jit> m_jit{};
+    Common::MemoryAccounting::Account m_code_cache_account;
+    std::filesystem::path m_block_cache_path;
+    bool m_block_cache_loaded{};
 
     // SVC callback
     u32 m_svc{};
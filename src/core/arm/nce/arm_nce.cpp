@@ -6,6 +6,7 @@
 
 #include <cinttypes>
 #include <memory>
+#include <mutex>
 
 #include "common/signal_chain.h"
 #include "core/arm/nce/arm_nce.h"
@@ -144,13 +145,25 @@ bool ArmNce::HandleFailedGuestFault(GuestContext* guest_ctx, void* raw_info, voi
 bool ArmNce::HandleGuestAlignmentFault(GuestContext* guest_ctx, void* raw_info, void* raw_context) {
     auto& host_ctx = static_cast<ucontext_t*>(raw_context)->uc_mcontext;
     auto* fpctx = GetFloatingPointState(host_ctx);
-    auto& memory = guest_ctx->parent->m_running_thread->GetOwnerProcess()->GetMemory();
-
-    // Match and execute an instruction.
-    auto next_pc = MatchAndExecuteOneInstruction(memory, &host_ctx, fpctx);
-    if (next_pc) {
-        host_ctx.pc = *next_pc;
-        return true;
+    auto* process = guest_ctx->parent->m_running_thread->GetOwnerProcess();
+    auto& memory = process->GetMemory();
+    auto& fault_patcher = process->GetFaultSitePatcher();
+
+    {
+        std::scoped_lock lk{fault_patcher.GetLock()};
+
+        // Another core rewrote this instruction after it faulted here, so execute it again.
+        if (fault_patcher.IsPatched(host_ctx.pc)) {
+            return true;
+        }
+
+        // Match and execute an instruction.
+        auto next_pc = MatchAndExecuteOneInstruction(memory, &host_ctx, fpctx);
+        if (next_pc) {
+            fault_patcher.RecordFault(memory, host_ctx.pc);
+            host_ctx.pc = *next_pc;
+            return true;
+        }
     }
 
     // We couldn't handle the access.
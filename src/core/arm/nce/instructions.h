@@ -149,4 +149,35 @@ static_assert(Exclusive(0xC85FFC00).AsOrdered() == 0xC85FFC00);
 static_assert(Exclusive(0xC85F7C00).AsOrdered() == 0xC85FFC00);
 static_assert(Exclusive(0xC8200440).AsOrdered() == 0xC8208440);
 
+// https://developer.arm.com/documentation/ddi0596/2021-12/Base-Instructions/LDAR--Load-Acquire-Register-
+// https://developer.arm.com/documentation/ddi0596/2021-12/Base-Instructions/STLR--Store-Release-Register-
+// https://developer.arm.com/documentation/ddi0596/2021-12/Base-Instructions/LDR--immediate---Load-Register--immediate--
+union OrderedLoadStore {
+    constexpr explicit OrderedLoadStore(u32 raw_) : raw{raw_} {}
+
+    // Matches LDAR, STLR, LDLAR and STLLR of any size
+    constexpr bool Verify() {
+        return (raw & 0x3FBF7C00) == 0x089F7C00;
+    }
+
+    // LDR/STR (unsigned immediate) with a zero offset keeps size, L, Rn and Rt in the same bits
+    constexpr u32 AsUnordered() {
+        return (raw & 0xC04003FF) | 0x39000000;
+    }
+
+    u32 raw;
+
+private:
+    BitField<0, 5, u32> rt;    // memory operand
+    BitField<5, 5, u32> rn;    // base register
+    BitField<22, 1, u32> l;    // load
+    BitField<30, 2, u32> size; // size
+};
+static_assert(OrderedLoadStore(0xC8DFFC20).Verify());      // LDAR X0, [X1]
+static_assert(OrderedLoadStore(0x089FFFE3).Verify());      // STLRB W3, [SP]
+static_assert(!OrderedLoadStore(0xC85FFC00).Verify());     // LDAXR X0, [X0]
+static_assert(OrderedLoadStore(0xC8DFFC20).AsUnordered() == 0xF9400020); // LDR X0, [X1]
+static_assert(OrderedLoadStore(0x089FFFE3).AsUnordered() == 0x390003E3); // STRB W3, [SP]
+static_assert(OrderedLoadStore(0x48DF7C41).AsUnordered() == 0x79400041); // LDRH W1, [X2]
+
 } // namespace Core::NCE
@@ -1,10 +1,18 @@
 // SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <numeric>
 #include <bit>
+#include <fstream>
 #include "common/cpu_features.h"
 #include "common/alignment.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/hash.h"
+#include "common/hex_util.h"
 #include "common/literals.h"
 #include "core/arm/nce/arm_nce.h"
 #include "core/arm/nce/guest_context.h"
@@ -26,6 +34,18 @@ using NativeExecutionParameters = Kernel::KThread::NativeExecutionParameters;
 constexpr size_t MaxRelativeBranch = 128_MiB;
 constexpr u32 ModuleCodeIndex = 0x24 / sizeof(u32);
 
+// Trampolines reserved per module for instructions that keep faulting at runtime
+constexpr size_t FaultPatchSlots = 256;
+constexpr size_t FaultPatchSlotWords = 4;
+// Number of emulated faults after which a site is rewritten
+constexpr u32 FaultPatchThreshold = 8;
+
+constexpr u32 DmbIsh = 0xD5033BBF;
+
+constexpr std::array<char, 8> PATCH_CACHE_MAGIC_NUMBER{'e', 'd', 'e', 'n', 'n', 'c', 'e', 'p'};
+// Bump whenever the set of patched instructions changes
+constexpr u32 PATCH_CACHE_VERSION = 1;
+
 Patcher::Patcher() : c(m_patch_instructions), c_pre(m_patch_instructions_pre) {
     // The first word of the patch section is always a branch to the first instruction of the
     // module.
@@ -81,8 +101,9 @@ bool Patcher::PatchText(std::span<const u8> program_image, const Kernel::CodeSet
     const auto text_words =
         std::span<const u32>{reinterpret_cast<const u32*>(text.data()), text.size() / sizeof(u32)};
 
-    // Loop through instructions, patching as needed.
-    for (u32 i = ModuleCodeIndex; i < static_cast<u32>(text_words.size()); i++) {
+    // Patches only depend on the instruction they replace, so the sites found on a previous
+    // launch of the same module can be patched without decoding the whole text again.
+    const auto PatchInstruction = [&](u32 i) -> bool {
         const u32 inst = text_words[i];
 
         const auto AddRelocations = [&](bool& pre_buffer) {
@@ -111,7 +132,7 @@ bool Patcher::PatchText(std::span<const u8> program_image, const Kernel::CodeSet
             } else {
                 WriteSvcTrampoline(ret, svc.GetValue(), c, m_save_context, m_load_context);
             }
-            continue;
+            return true;
         }
 
         // MRS Xn, TPIDR_EL0
@@ -128,7 +149,7 @@ bool Patcher::PatchText(std::span<const u8> program_image, const Kernel::CodeSet
             } else {
                 WriteMrsHandler(ret, dest_reg, src_reg, c);
             }
-            continue;
+            return true;
         }
 
         // MRS Xn, CNTPCT_EL0
@@ -140,7 +161,7 @@ bool Patcher::PatchText(std::span<const u8> program_image, const Kernel::CodeSet
             } else {
                 WriteCntpctHandler(ret, oaknut::XReg{static_cast<int>(mrs.GetRt())}, c);
             }
-            continue;
+            return true;
         }
 
         // MRS Xn, CNTFRQ_EL0
@@ -152,7 +173,7 @@ bool Patcher::PatchText(std::span<const u8> program_image, const Kernel::CodeSet
             } else {
                 WriteCntfrqHandler(ret, oaknut::XReg{static_cast<int>(mrs.GetRt())}, c);
             }
-            continue;
+            return true;
         }
 
         // MSR TPIDR_EL0, Xn
@@ -164,11 +185,39 @@ bool Patcher::PatchText(std::span<const u8> program_image, const Kernel::CodeSet
             } else {
                 WriteMsrHandler(ret, oaknut::XReg{static_cast<int>(msr.GetRt())}, c);
             }
-            continue;
+            return true;
         }
 
         if (auto exclusive = Exclusive{inst}; exclusive.Verify()) {
             curr_patch->m_exclusives.push_back(i);
+            return true;
+        }
+        return false;
+    };
+
+    const u64 text_hash = Common::Hash::StableHash64(
+        std::span(reinterpret_cast<const u8*>(text.data()), text.size()));
+    if (auto cached_sites = LoadPatchSites(text_hash, text_words.size())) {
+        for (const u32 i : *cached_sites) {
+            PatchInstruction(i);
+        }
+    } else {
+        // Loop through instructions, patching as needed.
+        std::vector<u32> sites;
+        for (u32 i = ModuleCodeIndex; i < static_cast<u32>(text_words.size()); i++) {
+            if (PatchInstruction(i)) {
+                sites.push_back(i);
+            }
+        }
+        SavePatchSites(text_hash, sites);
+    }
+
+    // Reserve trampolines for fault sites after this module's patches, where they are in range of
+    // its text. Split modules span more than a branch can reach, so they fault every time.
+    if (!use_split) {
+        curr_patch->m_fault_pool_offset = c.offset();
+        for (size_t i = 0; i < FaultPatchSlots * FaultPatchSlotWords; ++i) {
+            c.dw(0);
         }
     }
 
@@ -182,7 +231,7 @@ bool Patcher::PatchText(std::span<const u8> program_image, const Kernel::CodeSet
     return true;
 }
 
-bool Patcher::RelocateAndCopy(Common::ProcessAddress load_base, const Kernel::CodeSet::Segment& code, std::vector<u8>& program_image, EntryTrampolines* out_trampolines) {
+bool Patcher::RelocateAndCopy(Common::ProcessAddress load_base, const Kernel::CodeSet::Segment& code, std::vector<u8>& program_image, EntryTrampolines* out_trampolines, FaultSitePatcher* out_fault_patcher) {
     const size_t patch_size = GetSectionSize();
     const size_t pre_patch_size = GetPreSectionSize();
 
@@ -317,6 +366,16 @@ bool Patcher::RelocateAndCopy(Common::ProcessAddress load_base, const Kernel::Co
             oaknut::CodeGenerator rc{m_patch_instructions.data() + rel.patch_offset / sizeof(u32)};
             rc.dx(RebasePc(rel.module_offset));
         }
+
+        if (out_fault_patcher && patch.m_fault_pool_offset) {
+            out_fault_patcher->AddPool({
+                .text_begin = RebasePc(0),
+                .text_end = RebasePc(text.size()),
+                .slots_begin = RebasePatch(*patch.m_fault_pool_offset),
+                .num_slots = FaultPatchSlots,
+                .used_slots = 0,
+            });
+        }
     }
 
     if (mode != PatchMode::Split) {
@@ -672,6 +731,73 @@ void Patcher::LockContext(oaknut::VectorCodeGenerator& cg) {
     cg.LDP(X0, X1, SP, POST_INDEXED, 16);
 }
 
+std::filesystem::path Patcher::GetPatchCachePath() const {
+    return Common::FS::GetEdenPath(Common::FS::EdenPath::CacheDir) / "nce" /
+           fmt::format("{}.bin", Common::HexToString(module_id, false));
+}
+
+std::optional<std::vector<u32>> Patcher::LoadPatchSites(u64 text_hash, size_t text_words) const try {
+    // Modules without a build ID can't be told apart
+    if (module_id == ModuleID{}) {
+        return std::nullopt;
+    }
+    std::ifstream file(GetPatchCachePath(), std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return std::nullopt;
+    }
+    file.exceptions(std::ifstream::failbit);
+    const auto end{file.tellg()};
+    file.seekg(0, std::ios::beg);
+
+    std::array<char, 8> magic_number;
+    u32 cache_version;
+    u64 cached_text_hash;
+    file.read(magic_number.data(), magic_number.size())
+        .read(reinterpret_cast<char*>(&cache_version), sizeof(cache_version))
+        .read(reinterpret_cast<char*>(&cached_text_hash), sizeof(cached_text_hash));
+    // The build ID is kept by mods patching the text, the hash tells them apart
+    if (magic_number != PATCH_CACHE_MAGIC_NUMBER || cache_version != PATCH_CACHE_VERSION ||
+        cached_text_hash != text_hash) {
+        return std::nullopt;
+    }
+    std::vector<u32> sites(static_cast<size_t>(end - file.tellg()) / sizeof(u32));
+    file.read(reinterpret_cast<char*>(sites.data()), sites.size() * sizeof(u32));
+    if (std::ranges::any_of(sites, [&](u32 i) { return i < ModuleCodeIndex || i >= text_words; })) {
+        return std::nullopt;
+    }
+    LOG_INFO(Core_ARM, "Patching {} known instructions of module {}", sites.size(),
+             Common::HexToString(module_id, false));
+    return sites;
+} catch (const std::ios_base::failure& e) {
+    LOG_ERROR(Common_Filesystem, "{}", e.what());
+    return std::nullopt;
+}
+
+void Patcher::SavePatchSites(u64 text_hash, std::span<const u32> sites) const try {
+    if (module_id == ModuleID{}) {
+        return;
+    }
+    const auto path{GetPatchCachePath()};
+    if (!Common::FS::CreateDirs(path.parent_path())) {
+        LOG_ERROR(Common_Filesystem, "Failed to create NCE patch cache directory");
+        return;
+    }
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        LOG_ERROR(Common_Filesystem, "Failed to open NCE patch cache file {}",
+                  Common::FS::PathToUTF8String(path));
+        return;
+    }
+    file.exceptions(std::ofstream::failbit);
+    file.write(PATCH_CACHE_MAGIC_NUMBER.data(), PATCH_CACHE_MAGIC_NUMBER.size())
+        .write(reinterpret_cast<const char*>(&PATCH_CACHE_VERSION), sizeof(PATCH_CACHE_VERSION))
+        .write(reinterpret_cast<const char*>(&text_hash), sizeof(text_hash))
+        .write(reinterpret_cast<const char*>(sites.data()), sites.size_bytes());
+} catch (const std::ios_base::failure& e) {
+    LOG_ERROR(Common_Filesystem, "{}", e.what());
+    Common::FS::RemoveFile(GetPatchCachePath());
+}
+
 void Patcher::UnlockContext(oaknut::VectorCodeGenerator& cg) {
     // Save scratches.
     cg.STP(X0, X1, SP, PRE_INDEXED, -16);
@@ -690,4 +816,82 @@ void Patcher::UnlockContext(oaknut::VectorCodeGenerator& cg) {
     cg.LDP(X0, X1, SP, POST_INDEXED, 16);
 }
 
+void FaultSitePatcher::AddPool(const Pool& pool) {
+    std::scoped_lock lk{lock};
+    pools.push_back(pool);
+}
+
+bool FaultSitePatcher::IsPatched(u64 pc) const {
+    return patched_sites.contains(pc);
+}
+
+void FaultSitePatcher::RecordFault(Core::Memory::Memory& memory, u64 pc) {
+    // Sites are only considered once, so one that cannot be patched does not retry every fault.
+    if (++fault_counts[pc] != FaultPatchThreshold) {
+        return;
+    }
+    if (TryPatch(memory, pc)) {
+        fault_counts.erase(pc);
+        patched_sites.insert(pc);
+    }
+}
+
+bool FaultSitePatcher::TryPatch(Core::Memory::Memory& memory, u64 pc) {
+    // Only load-acquire and store-release instructions are rewritten. They fault when unaligned
+    // but the same access done by a plain load or store between barriers does not. Exclusives
+    // and atomics need the access to stay atomic, so they keep being emulated on every fault.
+    auto ordered = OrderedLoadStore{memory.Read32(pc)};
+    if (!ordered.Verify()) {
+        return false;
+    }
+
+    const auto pool = std::find_if(pools.begin(), pools.end(), [pc](const Pool& p) {
+        return pc >= p.text_begin && pc < p.text_end && p.used_slots < p.num_slots;
+    });
+    if (pool == pools.end()) {
+        return false;
+    }
+
+    const auto EncodeBranch = [](u64 from, u64 to) -> std::optional<u32> {
+        const s64 offset = static_cast<s64>(to - from);
+        if (offset < -static_cast<s64>(MaxRelativeBranch) ||
+            offset >= static_cast<s64>(MaxRelativeBranch)) {
+            return std::nullopt;
+        }
+        return 0x14000000U | (static_cast<u32>(offset >> 2) & 0x3FFFFFFU);
+    };
+
+    constexpr size_t SlotSize = FaultPatchSlotWords * sizeof(u32);
+    const u64 slot = pool->slots_begin + pool->used_slots * SlotSize;
+    const u64 slot_return = slot + 3 * sizeof(u32);
+    const auto branch_to_slot = EncodeBranch(pc, slot);
+    const auto branch_to_module = EncodeBranch(slot_return, pc + sizeof(u32));
+    if (!branch_to_slot || !branch_to_module) {
+        return false;
+    }
+
+    // Write the trampoline before the site branches to it. Guest addresses are host addresses
+    // under NCE, and the page table points at a writable alias of the same memory.
+    const std::array<u32, FaultPatchSlotWords> trampoline{
+        DmbIsh,
+        ordered.AsUnordered(),
+        DmbIsh,
+        *branch_to_module,
+    };
+    std::memcpy(memory.GetPointer(slot), trampoline.data(), sizeof(trampoline));
+    __builtin___clear_cache(reinterpret_cast<char*>(slot),
+                            reinterpret_cast<char*>(slot + SlotSize));
+    ++pool->used_slots;
+
+    // Other cores may be executing the site, so replace it with a single aligned store. Cores
+    // that still fault on the old instruction see the site as patched and retry it.
+    std::atomic_ref<u32>{*reinterpret_cast<u32*>(memory.GetPointer(pc))}.store(
+        *branch_to_slot, std::memory_order_release);
+    __builtin___clear_cache(reinterpret_cast<char*>(pc),
+                            reinterpret_cast<char*>(pc + sizeof(u32)));
+
+    LOG_DEBUG(Core_ARM, "Patched faulting instruction at {:#x} to trampoline {:#x}", pc, slot);
+    return true;
+}
+
 } // namespace Core::NCE
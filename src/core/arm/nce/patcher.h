@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <filesystem>
+#include <optional>
 #include <span>
 #include <ankerl/unordered_dense.h>
 #include <vector>
@@ -12,6 +14,7 @@
 #include "common/logging.h"
 #include "common/common_types.h"
 #include "common/settings.h"
+#include "common/spin_lock.h"
 #include "core/hle/kernel/code_set.h"
 #include "core/hle/kernel/k_typed_address.h"
 #include <utility>
@@ -34,6 +37,10 @@ struct std::hash<PatchCacheKey> {
     }
 };
 
+namespace Core::Memory {
+class Memory;
+}
+
 namespace Core::NCE {
 
 enum class PatchMode : u32 {
@@ -48,6 +55,41 @@ using ModuleTextAddress = u64;
 using PatchTextAddress = u64;
 using EntryTrampolines = ankerl::unordered_dense::map<ModuleTextAddress, PatchTextAddress>;
 
+/// Rewrites guest instructions that keep raising alignment faults at runtime so they branch into
+/// trampolines reserved in the patch section, which perform the access without trapping.
+class FaultSitePatcher {
+public:
+    /// Trampoline space reserved for the text of one module.
+    struct Pool {
+        u64 text_begin;
+        u64 text_end;
+        u64 slots_begin;
+        size_t num_slots;
+        size_t used_slots;
+    };
+
+    void AddPool(const Pool& pool);
+
+    /// Held while a faulting instruction is emulated, so it cannot be rewritten meanwhile.
+    Common::SpinLock& GetLock() noexcept {
+        return lock;
+    }
+
+    /// Whether the instruction at pc has been rewritten since it faulted and can be retried.
+    bool IsPatched(u64 pc) const;
+
+    /// Counts an emulated fault at pc, rewriting the site once it has faulted often enough.
+    void RecordFault(Core::Memory::Memory& memory, u64 pc);
+
+private:
+    bool TryPatch(Core::Memory::Memory& memory, u64 pc);
+
+    Common::SpinLock lock;
+    std::vector<Pool> pools;
+    ankerl::unordered_dense::map<u64, u32> fault_counts;
+    ankerl::unordered_dense::set<u64> patched_sites;
+};
+
 class Patcher {
 public:
     void SetModuleID(const ModuleID& id) {
@@ -56,7 +98,7 @@ public:
     explicit Patcher();
     ~Patcher();
     bool PatchText(std::span<const u8> program_image, const Kernel::CodeSet::Segment& code);
-    bool RelocateAndCopy(Common::ProcessAddress load_base, const Kernel::CodeSet::Segment& code, std::vector<u8>& program_image, EntryTrampolines* out_trampolines);
+    bool RelocateAndCopy(Common::ProcessAddress load_base, const Kernel::CodeSet::Segment& code, std::vector<u8>& program_image, EntryTrampolines* out_trampolines, FaultSitePatcher* out_fault_patcher);
     size_t GetSectionSize() const noexcept;
     size_t GetPreSectionSize() const noexcept;
 
@@ -83,6 +125,11 @@ private:
     void WriteCntfrqHandler(ModuleDestLabel module_dest, oaknut::XReg dest_reg, oaknut::VectorCodeGenerator& code);
     void WriteCntpctHandler(ModuleDestLabel module_dest, oaknut::XReg dest_reg, oaknut::VectorCodeGenerator& code);
 
+    // Cache of the patched instruction indices of a module, keyed by its build ID
+    std::filesystem::path GetPatchCachePath() const;
+    std::optional<std::vector<u32>> LoadPatchSites(u64 text_hash, size_t text_words) const;
+    void SavePatchSites(u64 text_hash, std::span<const u32> sites) const;
+
     // Convenience wrappers using default code generator
     void WriteLoadContext() { WriteLoadContext(c); }
     void WriteSaveContext() { WriteSaveContext(c); }
@@ -145,6 +192,7 @@ private:
         std::vector<Relocation> m_write_module_pc_relocations{};
         std::vector<Relocation> m_write_module_pc_relocations_pre{};
         std::vector<ModuleTextAddress> m_exclusives{};
+        std::optional<ptrdiff_t> m_fault_pool_offset{};
     };
 
     oaknut::VectorCodeGenerator c;
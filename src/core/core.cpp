@@ -3,16 +3,20 @@
 
 #include <array>
 #include <atomic>
+#include <future>
 #include <memory>
 #include <utility>
 
 #include "game_settings.h"
 #include "audio_core/audio_core.h"
 #include "common/fs/fs.h"
+#include "common/fs/path_util.h"
 #include "common/logging.h"
+#include "common/memory_accounting.h"
 #include "common/settings.h"
 #include "common/settings_enums.h"
 #include "common/string_util.h"
+#include "common/trace.h"
 #include "core/arm/exclusive_monitor.h"
 #include "core/core.h"
 
@@ -43,6 +47,7 @@
 #include "core/hle/service/filesystem/filesystem.h"
 #include "core/hle/service/glue/glue_manager.h"
 #include "core/hle/service/glue/time/static.h"
+#include "core/hle/service/ipc_profiler.h"
 #include "core/hle/service/psc/time/static.h"
 #include "core/hle/service/psc/time/steady_clock.h"
 #include "core/hle/service/psc/time/system_clock.h"
@@ -148,6 +153,10 @@ struct System::Impl {
                                        Settings::MemoryLayout::Memory_4Gb);
 
         if (!must_reinitialize) {
+            // Direct mapping can't be undone, and the reservation is only placed low when asked
+            if (device_memory->buffer.IsDirectMapped() || Settings::IsFastmemDirectMapped()) {
+                device_memory.emplace();
+            }
             return;
         }
 
@@ -269,14 +278,17 @@ struct System::Impl {
         cpu_manager.Initialize();
     }
 
-    SystemResultStatus SetupForApplicationProcess(System& system, Frontend::EmuWindow& emu_window) {
+    SystemResultStatus CreateVideoAndAudio(System& system, Frontend::EmuWindow& emu_window) {
         host1x_core.emplace(system);
         VideoCore::CreateGPU(gpu_core, emu_window, system);
         if (!gpu_core)
             return SystemResultStatus::ErrorVideoCore;
 
         audio_core.emplace(system);
+        return SystemResultStatus::Success;
+    }
 
+    SystemResultStatus SetupForApplicationProcess(System& system) {
         service_manager = std::make_shared<Service::SM::ServiceManager>(kernel);
         services.emplace(service_manager, system, stop_event.get_token());
 
@@ -296,14 +308,21 @@ struct System::Impl {
     SystemResultStatus Load(System& system, Frontend::EmuWindow& emu_window,
                             const std::string& filepath,
                             Service::AM::FrontendAppletParameters& params) {
+        Common::MemoryAccounting::ResetPeaks();
         InitializeKernel(system);
 
         const auto file = GetGameFileFromPath(virtual_filesystem, filepath);
 
-        // Create the application process
+        // Create the application process. Loading it is mostly reading and decompressing the
+        // game, while creating the renderer is mostly driver work and stays on this thread, which
+        // owns the window. Neither needs the other, so they overlap.
         Loader::ResultStatus load_result{};
         std::vector<u8> control;
-        auto process = Service::AM::CreateApplicationProcess(control, app_loader, load_result, system, file, params.program_id, params.program_index);
+        auto pending_process = std::async(std::launch::async, [&] {
+            return Service::AM::CreateApplicationProcess(control, app_loader, load_result, system, file, params.program_id, params.program_index);
+        });
+        const SystemResultStatus video_result{CreateVideoAndAudio(system, emu_window)};
+        auto process = pending_process.get();
         if (load_result != Loader::ResultStatus::Success) {
             LOG_CRITICAL(Core, "Failed to load ROM (Error {})!", load_result);
             ShutdownMainProcess();
@@ -312,9 +331,16 @@ struct System::Impl {
 
         if (!app_loader) {
             LOG_CRITICAL(Core, "Failed to obtain loader for {}!", filepath);
+            ShutdownMainProcess();
             return SystemResultStatus::ErrorGetLoader;
         }
 
+        if (video_result != SystemResultStatus::Success) {
+            LOG_CRITICAL(Core, "Failed to initialize system (Error {})!", int(video_result));
+            ShutdownMainProcess();
+            return video_result;
+        }
+
         if (app_loader->ReadProgramId(params.program_id) != Loader::ResultStatus::Success) {
             LOG_ERROR(Core, "Failed to find program id for ROM!");
         }
@@ -329,6 +355,9 @@ struct System::Impl {
         // Expose program id to dump sites and other global readers.
         Settings::SetCurrentProgramID(params.program_id);
 
+        Common::Trace::SetEnabled(Settings::values.enable_hot_path_tracing.GetValue());
+        Service::IpcProfiler::Reset();
+
         // Track launch time for frontend launches
         LaunchTimestampCache::SaveLaunchTimestamp(params.program_id);
 
@@ -336,7 +365,7 @@ struct System::Impl {
         kernel.MakeApplicationProcess(process->GetHandle());
 
         // Set up the rest of the system.
-        SystemResultStatus init_result{SetupForApplicationProcess(system, emu_window)};
+        SystemResultStatus init_result{SetupForApplicationProcess(system)};
         if (init_result != SystemResultStatus::Success) {
             LOG_CRITICAL(Core, "Failed to initialize system (Error {})!", int(init_result));
             ShutdownMainProcess();
@@ -388,6 +417,10 @@ struct System::Impl {
     void ShutdownMainProcess() {
         SetShuttingDown(true);
 
+        if (is_powered_on) {
+            LOG_INFO(Core, "Host memory by subsystem:\n{}", Common::MemoryAccounting::GetReport());
+        }
+
         // Reset per-game flags
         Settings::values.use_squashed_iterated_blend = false;
 
@@ -412,6 +445,14 @@ struct System::Impl {
         audio_core.reset();
         gpu_core.reset();
         host1x_core.reset();
+        if (Common::Trace::IsEnabled()) {
+            Common::Trace::SetEnabled(false);
+            // Dumped once the GPU threads are gone so no ring is written to meanwhile
+            Common::Trace::DumpChromeTrace(
+                Common::FS::GetEdenPath(Common::FS::EdenPath::LogDir) / "trace.json");
+            Service::IpcProfiler::DumpCsv(
+                Common::FS::GetEdenPath(Common::FS::EdenPath::LogDir) / "ipc_profile.csv");
+        }
         perf_stats.reset();
         cpu_manager.Shutdown();
         debugger.reset();
@@ -443,7 +484,19 @@ struct System::Impl {
     }
 
     PerfStatsResults GetAndResetPerfStats() {
-        return perf_stats->GetAndResetStats(core_timing.GetGlobalTimeUs());
+        auto results{perf_stats->GetAndResetStats(core_timing.GetGlobalTimeUs())};
+        if (audio_core) {
+            const auto audio{audio_core->ADSP().AudioRenderer().GetAndResetHostMetrics()};
+            results.audio_frametime =
+                std::chrono::duration<double>(audio.frames.Average()).count();
+            results.audio_underruns = audio.underruns;
+            results.audio_queue_depth = audio.queue_depth;
+        }
+        const auto input{hid_core.GetInputLatency().GetAndReset()};
+        results.input_latency = std::chrono::duration<double>(input.sample.Average()).count();
+        results.input_present_latency =
+            std::chrono::duration<double>(input.present.Average()).count();
+        return results;
     }
 
     Timing::CoreTiming core_timing;
@@ -8,6 +8,7 @@
 #include <mutex>
 #include <string>
 #include <tuple>
+#include <boost/container/small_vector.hpp>
 #include "common/cpu_features.h"
 #include "common/cpu_features.h"
 
@@ -58,7 +59,7 @@ void CoreTiming::Initialize(std::function<void()>&& on_thread_init_) {
     if (is_multicore) {
         timer_thread = std::jthread([this](std::stop_token stop_token) {
             Common::SetCurrentThreadName("HostTiming");
-            Common::SetCurrentThreadPriority(Common::ThreadPriority::High);
+            Common::SetCurrentThreadRole(Common::ThreadRole::Timing);
             on_thread_init();
             has_started = true;
 
@@ -89,6 +90,11 @@ void CoreTiming::Initialize(std::function<void()>&& on_thread_init_) {
 
 void CoreTiming::ClearPendingEvents() {
     std::scoped_lock lock{advance_lock, basic_lock};
+    for (const Event& e : event_queue) {
+        if (const auto event_type{e.type.lock()}) {
+            event_type->pending_count = 0;
+        }
+    }
     event_queue.clear();
     event.Set();
 }
@@ -139,6 +145,7 @@ void CoreTiming::ScheduleEvent(std::chrono::nanoseconds ns_into_future,
 
         auto h{event_queue.emplace(Event{next_time.count(), event_fifo_id++, event_type, 0})};
         (*h).handle = h;
+        event_type->pending_count++;
     }
 
     event.Set();
@@ -155,6 +162,7 @@ void CoreTiming::ScheduleLoopingEvent(std::chrono::nanoseconds start_time,
         auto h{event_queue.emplace(
             Event{next_time.count(), event_fifo_id++, event_type, resched_time.count()})};
         (*h).handle = h;
+        event_type->pending_count++;
     }
 
     event.Set();
@@ -165,10 +173,13 @@ void CoreTiming::UnscheduleEvent(const std::shared_ptr<EventType>& event_type,
     {
         std::scoped_lock lk{basic_lock};
 
-        std::vector<heap_t::handle_type> to_remove;
-        for (auto itr = event_queue.begin(); itr != event_queue.end(); itr++) {
+        // Most events are pending at most once, so stop as soon as every instance is found.
+        // Comparing owners avoids touching the reference count of every queued event.
+        boost::container::small_vector<heap_t::handle_type, 4> to_remove;
+        for (auto itr = event_queue.begin();
+             to_remove.size() < event_type->pending_count && itr != event_queue.end(); itr++) {
             const Event& e = *itr;
-            if (e.type.lock().get() == event_type.get()) {
+            if (!e.type.owner_before(event_type) && !event_type.owner_before(e.type)) {
                 to_remove.push_back(itr->handle);
             }
         }
@@ -177,6 +188,7 @@ void CoreTiming::UnscheduleEvent(const std::shared_ptr<EventType>& event_type,
             event_queue.erase(h);
         }
 
+        event_type->pending_count -= to_remove.size();
         event_type->sequence_number++;
     }
 
@@ -239,6 +251,7 @@ std::optional<s64> CoreTiming::Advance() {
 
             if (evt.reschedule_time == 0) {
                 event_queue.pop();
+                event_type->pending_count--;
 
                 basic_lock.unlock();
 
@@ -273,6 +286,9 @@ std::optional<s64> CoreTiming::Advance() {
                 event_queue.update(evt.handle, Event{next_time, event_fifo_id++, evt.type,
                                                      next_schedule_time, evt.handle});
             }
+        } else {
+            // The event type was destroyed without being unscheduled
+            event_queue.pop();
         }
 
         global_timer = GetGlobalTimeNs().count();
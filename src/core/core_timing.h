@@ -30,7 +30,8 @@ using TimedCallback = std::function<std::optional<std::chrono::nanoseconds>(
 /// Contains the characteristics of a particular event.
 struct EventType {
     explicit EventType(TimedCallback&& callback_, std::string&& name_)
-        : callback{std::move(callback_)}, name{std::move(name_)}, sequence_number{0} {}
+        : callback{std::move(callback_)}, name{std::move(name_)}, sequence_number{0},
+          pending_count{0} {}
 
     /// The event's callback function.
     TimedCallback callback;
@@ -39,6 +40,9 @@ struct EventType {
     /// A monotonic sequence number, incremented when this event is
     /// changed externally.
     size_t sequence_number;
+    /// Number of instances of this event in the queue, so unscheduling can stop searching once
+    /// all of them are found.
+    size_t pending_count;
 };
 
 enum class UnscheduleEventType {
@@ -33,6 +33,9 @@ struct CipherContext {
     EVP_CIPHER_CTX* encryption_context = nullptr;
     EVP_CIPHER_CTX* decryption_context = nullptr;
     EVP_CIPHER* cipher = nullptr;
+    // The IV is applied when transcoding, so that only the context in use is reinitialized
+    std::array<u8, AesBlockBytes> iv{};
+    bool has_iv = false;
 };
 
 static inline const std::string GetCipherName(Mode mode, u32 key_size) {
@@ -116,7 +119,7 @@ void AESCipher<Key>::Transcode(const u8* src, std::size_t size, u8* dest, Op op)
         return;
 
     // reset
-    ASSERT(EVP_CipherInit_ex(context, nullptr, nullptr, nullptr, nullptr, -1));
+    ASSERT(EVP_CipherInit_ex(context, nullptr, nullptr, nullptr, ctx->has_iv ? ctx->iv.data() : nullptr, -1));
 
     const int block_size = EVP_CIPHER_CTX_get_block_size(context);
     ASSERT(block_size > 0 && block_size <= int(AesBlockBytes));
@@ -164,9 +167,10 @@ void AESCipher<Key>::XTSTranscode(const u8* src, std::size_t size, u8* dest, std
 
 template <typename Key>
 void AESCipher<Key>::SetIV(std::span<const u8> data) {
-    const int ret_enc = EVP_CipherInit_ex(ctx->encryption_context, nullptr, nullptr, nullptr, data.data(), -1);
-    const int ret_dec = EVP_CipherInit_ex(ctx->decryption_context, nullptr, nullptr, nullptr, data.data(), -1);
-    ASSERT(ret_enc == 1 && ret_dec == 1 && "Failed to set IV on OpenSSL contexts");
+    ASSERT(data.size() <= ctx->iv.size());
+    ctx->iv = {};
+    std::memcpy(ctx->iv.data(), data.data(), data.size());
+    ctx->has_iv = true;
 }
 
 template class AESCipher<Key128>;
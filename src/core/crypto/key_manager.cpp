@@ -775,8 +775,8 @@ void KeyManager::WriteKeyToFile(KeyCategory category, std::string_view keyname,
             "# If you are experiencing issues involving keys, it may help to delete this file\n"));
     }
 
+    // Callers already hold the key in memory, so the file does not need to be parsed again.
     void(file.WriteString(fmt::format("\n{} = {}", keyname, Common::HexToString(key))));
-    LoadFromFile(path, category == KeyCategory::Title);
 }
 
 void KeyManager::SetKey(S128KeyType id, Key128 key, u64 field1, u64 field2) {
@@ -1054,8 +1054,10 @@ void KeyManager::PopulateTickets() {
             tickets.insert(tickets.end(), blob2.begin(), blob2.end());
         }
 
+        // Title keys are only decrypted from these tickets once they are looked up, as every
+        // personalized ticket costs an RSA decryption.
         for (const auto& ticket : tickets) {
-            AddTicket(ticket);
+            StoreTicket(ticket);
         }
     }
 }
@@ -1128,10 +1130,10 @@ const std::map<u128, Ticket>& KeyManager::GetPersonalizedTickets() const {
     return personal_tickets;
 }
 
-bool KeyManager::AddTicket(const Ticket& ticket) {
+std::optional<u128> KeyManager::StoreTicket(const Ticket& ticket) {
     if (!ticket.IsValid()) {
         LOG_WARNING(Crypto, "Attempted to add invalid ticket.");
-        return false;
+        return std::nullopt;
     }
 
     const auto& rid = ticket.GetData().rights_id;
@@ -1142,7 +1144,39 @@ bool KeyManager::AddTicket(const Ticket& ticket) {
     } else {
         personal_tickets[rights_id] = ticket;
     }
+    failed_title_keys.erase(rights_id);
+    return rights_id;
+}
+
+void KeyManager::DeriveTitleKeyLazy(const u128& rights_id) {
+    if (HasKey(S128KeyType::Titlekey, rights_id[1], rights_id[0]) ||
+        failed_title_keys.contains(rights_id)) {
+        return;
+    }
+
+    auto iter = personal_tickets.find(rights_id);
+    if (iter == personal_tickets.end()) {
+        iter = common_tickets.find(rights_id);
+        if (iter == common_tickets.end()) {
+            return;
+        }
+    }
+
+    const auto key = ParseTicketTitleKey(iter->second);
+    if (!key) {
+        failed_title_keys.insert(rights_id);
+        return;
+    }
+    SetKey(S128KeyType::Titlekey, key.value(), rights_id[1], rights_id[0]);
+}
+
+bool KeyManager::AddTicket(const Ticket& ticket) {
+    const auto stored_rights_id = StoreTicket(ticket);
+    if (!stored_rights_id) {
+        return false;
+    }
 
+    const u128 rights_id = *stored_rights_id;
     if (HasKey(S128KeyType::Titlekey, rights_id[1], rights_id[0])) {
         LOG_DEBUG(Crypto,
             "Skipping parsing title key from ticket for known rights ID {:016X}{:016X}.",
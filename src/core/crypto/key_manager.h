@@ -10,6 +10,7 @@
 #include <filesystem>
 #include <map>
 #include <optional>
+#include <set>
 #include <span>
 #include <string>
 
@@ -282,6 +283,10 @@ public:
     // save 8*43 and the private file to exist.
     void DeriveSDSeedLazy();
 
+    // Call before looking up a title key to decrypt it from the tickets loaded by
+    // PopulateTickets, which are only parsed on demand.
+    void DeriveTitleKeyLazy(const u128& rights_id);
+
     bool BaseDeriveNecessary() const;
     void DeriveBase();
     void DeriveETicket(PartitionDataManager& data, const FileSys::ContentProvider& provider);
@@ -308,6 +313,8 @@ private:
     std::map<u128, Ticket> common_tickets;
     std::map<u128, Ticket> personal_tickets;
     bool ticket_databases_loaded = false;
+    // Rights IDs whose ticket could not be parsed, so the RSA work is not repeated
+    std::set<u128> failed_title_keys;
 
     std::array<std::array<u8, 0xB0>, 0x20> encrypted_keyblobs{};
     std::array<std::array<u8, 0x90>, 0x20> keyblobs{};
@@ -328,6 +335,9 @@ private:
     void SetKeyWrapped(S128KeyType id, Key128 key, u64 field1 = 0, u64 field2 = 0);
     void SetKeyWrapped(S256KeyType id, Key256 key, u64 field1 = 0, u64 field2 = 0);
 
+    /// Adds a ticket to the ticket maps without parsing its title key.
+    std::optional<u128> StoreTicket(const Ticket& ticket);
+
     /// Parses the title key section of a ticket.
     std::optional<Key128> ParseTicketTitleKey(const Ticket& ticket);
 };
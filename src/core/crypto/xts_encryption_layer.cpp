@@ -33,6 +33,22 @@ std::size_t XTSEncryptionLayer::Read(u8* data, std::size_t length, std::size_t o
         const std::size_t sector_index = current_offset / XTS_SECTOR_SIZE;
         const std::size_t sector_offset = current_offset % XTS_SECTOR_SIZE;
 
+        // Whole sectors are read and decrypted in place with a single pass.
+        if (sector_offset == 0 && remaining >= XTS_SECTOR_SIZE) {
+            const std::size_t request = remaining - (remaining % XTS_SECTOR_SIZE);
+            const std::size_t got = base->Read(out, request, current_offset);
+            const std::size_t whole = got - (got % XTS_SECTOR_SIZE);
+            if (whole != 0) {
+                cipher.XTSTranscode(out, whole, out, sector_index, XTS_SECTOR_SIZE, Op::Decrypt);
+
+                out += whole;
+                current_offset += whole;
+                remaining -= whole;
+                total_read += whole;
+                continue;
+            }
+        }
+
         const std::size_t sectors_to_read = std::min<std::size_t>(PrefetchSectors,
                                                                   (remaining + sector_offset +
                                                                    XTS_SECTOR_SIZE - 1) /
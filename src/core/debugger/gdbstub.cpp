@@ -60,6 +60,19 @@ static std::string EscapeGDB(std::string_view data) {
     return escaped;
 }
 
+static std::vector<u8> UnescapeBinary(std::string_view data) {
+    std::vector<u8> unescaped;
+    unescaped.reserve(data.size());
+    for (size_t i = 0; i < data.size(); i++) {
+        if (data[i] == '}' && i + 1 < data.size()) {
+            unescaped.push_back(u8(data[++i] ^ 0x20));
+        } else {
+            unescaped.push_back(u8(data[i]));
+        }
+    }
+    return unescaped;
+}
+
 static std::string EscapeXML(std::string_view data) {
     std::u32string converted = U"[Encoding error]";
     try {
@@ -225,36 +238,26 @@ void GDBStub::ExecuteCommand(std::string_view packet, std::vector<DebuggerAction
         SendReply(GDB_STUB_REPLY_OK);
         break;
     }
-    case 'm': {
+    case 'm':
+    case 'x': {
         const auto sep{std::find(command.begin(), command.end(), ',') - command.begin() + 1};
         const size_t addr = size_t(strtoll(command.data(), nullptr, 16));
         const size_t size = size_t(strtoll(command.data() + sep, nullptr, 16));
 
         std::vector<u8> mem(size);
-        if (debug_process->GetMemory().ReadBlock(addr, mem.data(), size)) {
-            // Restore any bytes belonging to replaced instructions.
-            for (auto it = replaced_instructions.lower_bound(addr); it != replaced_instructions.end() && it->first < addr + size; it++) {
-                // Get the bytes of the instruction we previously replaced.
-                const u32 original_bytes = it->second;
-
-                // Calculate where to start writing to the output buffer.
-                const size_t output_offset = it->first - addr;
-
-                // Calculate how many bytes to write.
-                // The loop condition ensures output_offset < size.
-                const size_t n = std::min<size_t>(size - output_offset, sizeof(u32));
-
-                // Write the bytes to the output buffer.
-                std::memcpy(mem.data() + output_offset, &original_bytes, n);
-            }
-
-            SendReply(Common::HexToString(mem));
-        } else {
+        if (!ReadMemory(addr, mem)) {
             SendReply(GDB_STUB_REPLY_ERR);
+        } else if (packet[0] == 'x') {
+            // Binary transfers are half the size of hex ones, SendReply escapes them
+            SendReply(fmt::format("b{}", std::string_view(reinterpret_cast<const char*>(mem.data()),
+                                                          mem.size())));
+        } else {
+            SendReply(Common::HexToString(mem));
         }
         break;
     }
-    case 'M': {
+    case 'M':
+    case 'X': {
         const auto size_sep{std::find(command.begin(), command.end(), ',') - command.begin() + 1};
         const auto mem_sep{std::find(command.begin(), command.end(), ':') - command.begin() + 1};
 
@@ -262,10 +265,10 @@ void GDBStub::ExecuteCommand(std::string_view packet, std::vector<DebuggerAction
         const size_t size{size_t(strtoll(command.data() + size_sep, nullptr, 16))};
 
         const auto mem_substr{std::string_view(command).substr(mem_sep)};
-        const auto mem{Common::HexStringToVector(mem_substr, false)};
+        const auto mem{packet[0] == 'X' ? UnescapeBinary(mem_substr)
+                                        : Common::HexStringToVector(mem_substr, false)};
 
-        if (debug_process->GetMemory().WriteBlock(addr, mem.data(), size)) {
-            Core::InvalidateInstructionCacheRange(debug_process, addr, size);
+        if (mem.size() >= size && WriteMemory(addr, std::span(mem.data(), size))) {
             SendReply(GDB_STUB_REPLY_OK);
         } else {
             SendReply(GDB_STUB_REPLY_ERR);
@@ -389,6 +392,38 @@ void GDBStub::HandleBreakpointRemove(std::string_view sv) {
     }
 }
 
+bool GDBStub::ReadMemory(VAddr addr, std::vector<u8>& mem) const {
+    const size_t size = mem.size();
+    if (!debug_process->GetMemory().ReadBlock(addr, mem.data(), size)) {
+        return false;
+    }
+
+    // Restore any bytes belonging to replaced instructions.
+    for (auto it = replaced_instructions.lower_bound(addr); it != replaced_instructions.end() && it->first < addr + size; it++) {
+        // Get the bytes of the instruction we previously replaced.
+        const u32 original_bytes = it->second;
+
+        // Calculate where to start writing to the output buffer.
+        const size_t output_offset = it->first - addr;
+
+        // Calculate how many bytes to write.
+        // The loop condition ensures output_offset < size.
+        const size_t n = std::min<size_t>(size - output_offset, sizeof(u32));
+
+        // Write the bytes to the output buffer.
+        std::memcpy(mem.data() + output_offset, &original_bytes, n);
+    }
+    return true;
+}
+
+bool GDBStub::WriteMemory(VAddr addr, std::span<const u8> mem) {
+    if (!debug_process->GetMemory().WriteBlock(addr, mem.data(), mem.size())) {
+        return false;
+    }
+    Core::InvalidateInstructionCacheRange(debug_process, addr, mem.size());
+    return true;
+}
+
 static std::string PaginateBuffer(std::string_view buffer, std::string_view request) {
     const auto amount{request.substr(request.find(',') + 1)};
     const auto offset_val{static_cast<u64>(strtoll(request.data(), nullptr, 16))};
@@ -407,10 +442,12 @@ void GDBStub::HandleQuery(std::string_view sv) {
         SendReply("T0");
     } else if (sv.starts_with("Supported")) {
         SendReply("PacketSize=4000;qXfer:features:read+;qXfer:threads:read+;qXfer:libraries:read+;"
-                  "vContSupported+;QStartNoAckMode+");
+                  "qXfer:memory-map:read+;binary-upload+;vContSupported+;QStartNoAckMode+");
     } else if (sv.starts_with("Xfer:features:read:target.xml:")) {
         const auto target_xml{arch->GetTargetXML()};
         SendReply(PaginateBuffer(target_xml, sv.substr(30)));
+    } else if (sv.starts_with("Xfer:memory-map:read::")) {
+        SendReply(PaginateBuffer(BuildMemoryMap(), sv.substr(22)));
     } else if (sv.starts_with("Offsets")) {
         const auto main_offset = Core::FindMainModuleEntrypoint(debug_process);
         SendReply(fmt::format("TextSeg={:x}", GetInteger(main_offset)));
@@ -739,6 +776,37 @@ void GDBStub::HandleRcmd(const std::vector<u8>& command) {
     SendReply(Common::HexToString(reply_span, false));
 }
 
+std::string GDBStub::BuildMemoryMap() const {
+    // Lets the client skip reads of unmapped memory instead of waiting for them to fail
+    std::string buffer;
+    buffer += R"(<?xml version="1.0"?>)";
+    buffer += "<memory-map>";
+
+    auto& page_table = debug_process->GetPageTable();
+    VAddr cur_addr = 0;
+    while (true) {
+        Kernel::KMemoryInfo mem_info{};
+        Kernel::Svc::PageInfo page_info{};
+        R_ASSERT(page_table.QueryInfo(std::addressof(mem_info), std::addressof(page_info),
+                                      cur_addr));
+        const auto svc_mem_info = mem_info.GetSvcMemoryInfo();
+
+        if (svc_mem_info.state != Kernel::Svc::MemoryState::Free &&
+            svc_mem_info.state != Kernel::Svc::MemoryState::Inaccessible) {
+            buffer += fmt::format(R"(<memory type="ram" start="{:#x}" length="{:#x}"/>)",
+                                  svc_mem_info.base_address, svc_mem_info.size);
+        }
+
+        const uintptr_t next_address = svc_mem_info.base_address + svc_mem_info.size;
+        if (next_address <= cur_addr)
+            break;
+        cur_addr = next_address;
+    }
+
+    buffer += "</memory-map>";
+    return buffer;
+}
+
 Kernel::KThread* GDBStub::GetThreadByID(u64 thread_id) {
     auto& threads = debug_process->GetThreadList();
     for (auto& thread : threads)
@@ -42,6 +42,9 @@ struct GDBStub : public DebuggerFrontend {
     void HandleRcmd(const std::vector<u8>& command);
     void HandleBreakpointInsert(std::string_view command);
     void HandleBreakpointRemove(std::string_view command);
+    bool ReadMemory(VAddr addr, std::vector<u8>& mem) const;
+    bool WriteMemory(VAddr addr, std::span<const u8> mem);
+    std::string BuildMemoryMap() const;
     std::vector<char>::const_iterator CommandEnd() const;
     std::optional<std::string> DetachCommand();
     Kernel::KThread* GetThreadByID(u64 thread_id);
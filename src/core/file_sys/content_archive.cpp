@@ -56,6 +56,7 @@ NCA::NCA(VirtualFile file_, const NCA* base_nca)
         u128 rights_id_u128;
         std::memcpy(rights_id_u128.data(), rights_id.data(), sizeof(rights_id));
 
+        keys.DeriveTitleKeyLazy(rights_id_u128);
         auto titlekey =
             keys.GetKey(Core::Crypto::S128KeyType::Titlekey, rights_id_u128[1], rights_id_u128[0]);
         if (titlekey == Core::Crypto::Key128{}) {
@@ -59,7 +59,8 @@ size_t AesCtrStorage::Read(u8* buffer, size_t size, size_t offset) const {
     std::memcpy(ctr.data(), m_iv.data(), IvSize);
     AddCounter(ctr.data(), IvSize, offset / BlockSize);
 
-    // Decrypt.
+    // Decrypt. The cipher is shared by every reader of the storage.
+    std::scoped_lock lk{m_mutex};
     m_cipher->SetIV(ctr);
     m_cipher->Transcode(buffer, size, buffer, Core::Crypto::Op::Decrypt);
 
@@ -92,6 +93,7 @@ size_t AesCtrStorage::Write(const u8* buffer, size_t size, size_t offset) {
     size_t remaining = size;
     size_t current_offset = offset;
 
+    std::scoped_lock lk{m_mutex};
     while (remaining > 0) {
         const size_t write_size = std::min<std::size_t>(pooled_buffer.size(), remaining);
 
@@ -6,6 +6,9 @@
 
 #pragma once
 
+#include <mutex>
+#include <vector>
+
 #include "common/alignment.h"
 #include "core/file_sys/fssystem/fs_i_storage.h"
 #include "core/file_sys/fssystem/fssystem_alignment_matching_storage_impl.h"
@@ -91,6 +94,7 @@ private:
     s64 m_base_storage_size;
     size_t m_data_align;
     mutable std::vector<char> work_buffer;
+    mutable std::mutex work_buffer_mutex;
 
 public:
     explicit AlignmentMatchingStoragePooledBuffer(VirtualFile bs, size_t da)
@@ -108,6 +112,7 @@ public:
         ASSERT(buffer != nullptr);
         s64 bs_size = this->GetSize();
         ASSERT(R_SUCCEEDED(IStorage::CheckAccessRange(offset, size, bs_size)));
+        std::scoped_lock lk{work_buffer_mutex};
         return AlignmentMatchingStorageImpl::Read(m_base_storage, work_buffer.data(),
                                                   work_buffer.size(), m_data_align,
                                                   BufferAlign, offset, buffer, size);
@@ -123,6 +128,7 @@ public:
         ASSERT(buffer != nullptr);
         s64 bs_size = this->GetSize();
         ASSERT(R_SUCCEEDED(IStorage::CheckAccessRange(offset, size, bs_size)));
+        std::scoped_lock lk{work_buffer_mutex};
         return AlignmentMatchingStorageImpl::Write(m_base_storage, work_buffer.data(),
                                                    work_buffer.size(), m_data_align,
                                                    BufferAlign, offset, buffer, size);
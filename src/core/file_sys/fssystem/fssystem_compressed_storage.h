@@ -6,6 +6,11 @@
 
 #pragma once
 
+#include <algorithm>
+#include <mutex>
+#include <utility>
+#include <vector>
+
 #include "common/literals.h"
 
 #include "core/file_sys/errors.h"
@@ -687,6 +692,9 @@ private:
                           size_t max_cache_entries) {
             // Set our fields.
             m_storage_size = storage_size;
+            m_max_cache_entries = max_cache_entries;
+            m_cache_entries.clear();
+            m_cache_entries.reserve(max_cache_entries);
 
             R_SUCCEED();
         }
@@ -771,10 +779,10 @@ private:
             char* cur_dst = static_cast<char*>(buffer);
 
             // Determine our alignment.
-            const bool head_unaligned = head_range.is_block_alignment_required &&
-                                        (cur_offset != head_range.virtual_offset ||
-                                         static_cast<s64>(cur_size) < head_range.virtual_size);
-            const bool tail_unaligned = [&]() -> bool {
+            bool head_unaligned = head_range.is_block_alignment_required &&
+                                  (cur_offset != head_range.virtual_offset ||
+                                   static_cast<s64>(cur_size) < head_range.virtual_size);
+            bool tail_unaligned = [&]() -> bool {
                 if (tail_range.is_block_alignment_required) {
                     if (static_cast<s64>(cur_size + cur_offset) ==
                         tail_range.GetEndVirtualOffset()) {
@@ -790,10 +798,43 @@ private:
                 }
             }();
 
+            // Serve the partially read blocks we decompressed recently from the cache.
+            bool head_cached = false;
+            bool tail_cached = false;
+            if (head_unaligned) {
+                if (const auto* block = this->FindCachedBlock(head_range.virtual_offset)) {
+                    const size_t skip_size = cur_offset - head_range.virtual_offset;
+                    const size_t copy_size = std::min<size_t>(
+                        cur_size, head_range.GetEndVirtualOffset() - cur_offset);
+                    std::memcpy(cur_dst, block->data() + skip_size, copy_size);
+
+                    cur_dst += copy_size;
+                    cur_offset += copy_size;
+                    cur_size -= copy_size;
+                    head_unaligned = false;
+                    head_cached = true;
+                    R_SUCCEED_IF(cur_size == 0);
+                }
+            }
+            if (tail_unaligned) {
+                if (const auto* block = this->FindCachedBlock(tail_range.virtual_offset)) {
+                    ASSERT(cur_offset <= tail_range.virtual_offset);
+                    const size_t dst_offset = tail_range.virtual_offset - cur_offset;
+                    const size_t copy_size = cur_size - dst_offset;
+                    std::memcpy(cur_dst + dst_offset, block->data(), copy_size);
+
+                    cur_size -= copy_size;
+                    tail_unaligned = false;
+                    tail_cached = true;
+                    R_SUCCEED_IF(cur_size == 0);
+                }
+            }
+
             // Determine start/end offsets.
-            const s64 start_offset =
-                head_range.is_block_alignment_required ? head_range.virtual_offset : cur_offset;
-            const s64 end_offset = tail_range.is_block_alignment_required
+            const s64 start_offset = head_range.is_block_alignment_required && !head_cached
+                                         ? head_range.virtual_offset
+                                         : cur_offset;
+            const s64 end_offset = tail_range.is_block_alignment_required && !tail_cached
                                        ? tail_range.GetEndVirtualOffset()
                                        : cur_offset + cur_size;
 
@@ -865,6 +906,10 @@ private:
                             cur_size, unaligned_range->GetEndVirtualOffset() - cur_offset);
                         std::memcpy(cur_dst, pooled_buffer.data() + skip_size, copy_size);
 
+                        // Keep the block, small reads tend to hit the same block repeatedly.
+                        this->StoreCachedBlock(unaligned_range->virtual_offset,
+                                               std::move(pooled_buffer));
+
                         // Advance.
                         cur_dst += copy_size;
                         cur_offset += copy_size;
@@ -878,7 +923,34 @@ private:
         }
 
     private:
+        const std::vector<char>* FindCachedBlock(s64 virtual_offset) {
+            const auto it = std::find_if(
+                m_cache_entries.begin(), m_cache_entries.end(),
+                [virtual_offset](const auto& entry) { return entry.first == virtual_offset; });
+            if (it == m_cache_entries.end()) {
+                return nullptr;
+            }
+
+            // Move the block to the back, which holds the most recently used one.
+            std::rotate(it, it + 1, m_cache_entries.end());
+            return std::addressof(m_cache_entries.back().second);
+        }
+
+        void StoreCachedBlock(s64 virtual_offset, std::vector<char>&& block) {
+            if (m_max_cache_entries == 0) {
+                return;
+            }
+            if (m_cache_entries.size() >= m_max_cache_entries) {
+                m_cache_entries.erase(m_cache_entries.begin());
+            }
+            m_cache_entries.emplace_back(virtual_offset, std::move(block));
+        }
+
         s64 m_storage_size = 0;
+
+        // Decompressed blocks that were only partially read, in least recently used order.
+        size_t m_max_cache_entries = 0;
+        std::vector<std::pair<s64, std::vector<char>>> m_cache_entries;
     };
 
 public:
@@ -934,6 +1006,7 @@ public:
     }
 
     virtual size_t Read(u8* buffer, size_t size, size_t offset) const override {
+        std::scoped_lock lk{m_mutex};
         if (R_SUCCEEDED(m_cache_manager.Read(m_core, offset, buffer, size))) {
             return size;
         } else {
@@ -944,6 +1017,7 @@ public:
 private:
     mutable CompressedStorageCore m_core;
     mutable CacheManager m_cache_manager;
+    mutable std::mutex m_mutex;
 };
 
 } // namespace FileSys
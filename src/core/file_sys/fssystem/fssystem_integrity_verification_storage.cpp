@@ -40,8 +40,8 @@ void IntegrityVerificationStorage::Initialize(VirtualFile hs, VirtualFile ds, s6
     // Validate sizes.
     {
         s64 hash_size = m_hash_storage->GetSize();
-        s64 data_size = m_data_storage->GetSize();
-        ASSERT(((hash_size / HashSize) * m_verification_block_size) >= data_size);
+        m_data_size = m_data_storage->GetSize();
+        ASSERT(((hash_size / HashSize) * m_verification_block_size) >= m_data_size);
     }
 
     // Set data.
@@ -51,6 +51,7 @@ void IntegrityVerificationStorage::Initialize(VirtualFile hs, VirtualFile ds, s6
 void IntegrityVerificationStorage::Finalize() {
     m_hash_storage = VirtualFile();
     m_data_storage = VirtualFile();
+    m_data_size = 0;
 }
 
 size_t IntegrityVerificationStorage::Read(u8* buffer, size_t size, size_t offset) const {
@@ -62,8 +63,8 @@ size_t IntegrityVerificationStorage::Read(u8* buffer, size_t size, size_t offset
     // Validate arguments.
     ASSERT(buffer != nullptr);
 
-    // Validate the offset.
-    s64 data_size = m_data_storage->GetSize();
+    // Validate the offset. The data storage is immutable, so its size is fixed at Initialize.
+    const s64 data_size = m_data_size;
     ASSERT(offset <= static_cast<size_t>(data_size));
 
     // Validate the access range.
@@ -91,7 +92,7 @@ size_t IntegrityVerificationStorage::Read(u8* buffer, size_t size, size_t offset
 }
 
 size_t IntegrityVerificationStorage::GetSize() const {
-    return m_data_storage->GetSize();
+    return static_cast<size_t>(m_data_size);
 }
 
 } // namespace FileSys
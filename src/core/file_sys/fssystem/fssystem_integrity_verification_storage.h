@@ -55,6 +55,7 @@ private:
 private:
     VirtualFile m_hash_storage;
     VirtualFile m_data_storage;
+    s64 m_data_size{};
     s64 m_verification_block_size;
     s64 m_verification_block_order;
     s64 m_upper_layer_verification_block_size;
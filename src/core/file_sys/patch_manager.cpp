@@ -8,7 +8,12 @@
 #include <array>
 #include <cstddef>
 #include <cstring>
+#include <memory>
+#include <mutex>
 
+#include <ankerl/unordered_dense.h>
+
+#include "common/hash.h"
 #include "common/hex_util.h"
 #include "common/logging.h"
 #include "common/settings.h"
@@ -82,6 +87,64 @@ VirtualDir FindSubdirectoryCaseless(const VirtualDir dir, std::string_view name)
 #endif
 }
 
+/// Parsing patch and cheat text costs far more than reading it, and the same files are looked at
+/// for every NSO of a title, again when patching and again on the next boot. Parsed results are
+/// kept by path and reused while the file contents are unchanged.
+template <typename T>
+class ParsedFileCache {
+public:
+    template <typename Parse>
+    std::shared_ptr<const T> Get(const VirtualFile& file, std::vector<u8> data, Parse&& parse) {
+        const u64 hash = Common::Hash::Hash64(data);
+        auto path = file->GetFullPath();
+        {
+            std::scoped_lock lock{mutex};
+            const auto it = entries.find(path);
+            if (it != entries.end() && it->second.hash == hash) {
+                return it->second.value;
+            }
+        }
+        std::shared_ptr<const T> value = parse(std::move(data));
+        std::scoped_lock lock{mutex};
+        // Bound the memory taken by files that were removed or edited many times
+        if (entries.size() >= MaxEntries) {
+            entries.clear();
+        }
+        entries.insert_or_assign(std::move(path), Entry{hash, value});
+        return value;
+    }
+
+private:
+    static constexpr size_t MaxEntries = 1024;
+
+    struct Entry {
+        u64 hash;
+        std::shared_ptr<const T> value;
+    };
+
+    std::mutex mutex;
+    ankerl::unordered_dense::map<std::string, Entry> entries;
+};
+
+std::shared_ptr<const IPSwitchCompiler> GetIPSwitchCompiler(const VirtualFile& file) {
+    static ParsedFileCache<IPSwitchCompiler> cache;
+    return cache.Get(file, file->ReadAllBytes(), [&file](std::vector<u8> data) {
+        // The compiler reads from a copy, the name is kept for its messages
+        return std::make_shared<const IPSwitchCompiler>(
+            std::make_shared<VectorVfsFile>(std::move(data), file->GetName()));
+    });
+}
+
+std::vector<Core::Memory::CheatEntry> ParseCheatFile(const VirtualFile& file,
+                                                     std::vector<u8> data) {
+    static ParsedFileCache<std::vector<Core::Memory::CheatEntry>> cache;
+    return *cache.Get(file, std::move(data), [](std::vector<u8> text) {
+        const Core::Memory::TextCheatParser parser;
+        return std::make_shared<const std::vector<Core::Memory::CheatEntry>>(parser.Parse(
+            std::string_view(reinterpret_cast<const char*>(text.data()), text.size())));
+    });
+}
+
 std::optional<std::vector<Core::Memory::CheatEntry>> ReadCheatFileFromFolder(
     u64 title_id, const PatchManager::BuildID& build_id_, const VirtualDir& base_path, bool upper) {
     const auto build_id_raw = Common::HexToString(build_id_, upper);
@@ -101,8 +164,7 @@ std::optional<std::vector<Core::Memory::CheatEntry>> ReadCheatFileFromFolder(
         return std::nullopt;
     }
 
-    const Core::Memory::TextCheatParser parser;
-    return parser.Parse(std::string_view(reinterpret_cast<const char*>(data.data()), data.size()));
+    return ParseCheatFile(file, std::move(data));
 }
 
 void AppendCommaIfNotEmpty(std::string& to, std::string_view with) {
@@ -367,11 +429,11 @@ std::vector<VirtualFile> PatchManager::CollectPatches(const std::vector<VirtualD
                     if (nso_build_id == this_build_id)
                         out.push_back(file);
                 } else if (file->GetExtension() == "pchtxt") {
-                    IPSwitchCompiler compiler{file};
-                    if (!compiler.IsValid())
+                    const auto compiler = GetIPSwitchCompiler(file);
+                    if (!compiler->IsValid())
                         continue;
 
-                    const auto this_build_id = Common::HexToString(compiler.GetBuildID());
+                    const auto this_build_id = Common::HexToString(compiler->GetBuildID());
                     if (nso_build_id == this_build_id)
                         out.push_back(file);
                 }
@@ -434,8 +496,8 @@ std::vector<u8> PatchManager::PatchNSO(const std::vector<u8>& nso, const std::st
         } else if (patch_file->GetExtension() == "pchtxt") {
             LOG_INFO(Loader, "    - Applying IPSwitch patch from mod \"{}\"",
                      patch_file->GetContainingDirectory()->GetParentDirectory()->GetName());
-            const IPSwitchCompiler compiler{patch_file};
-            const auto patched = compiler.Apply(std::make_shared<VectorVfsFile>(out));
+            const auto compiler = GetIPSwitchCompiler(patch_file);
+            const auto patched = compiler->Apply(std::make_shared<VectorVfsFile>(out));
             if (patched != nullptr)
                 out = patched->ReadAllBytes();
         }
@@ -498,8 +560,7 @@ std::vector<Core::Memory::CheatEntry> PatchManager::CreateCheatList(const BuildI
         if (name.starts_with("cheat_") && std::find(disabled.cbegin(), disabled.cend(), name) == disabled.cend()) {
             std::vector<u8> data(f->GetSize());
             if (f->Read(data.data(), data.size()) == data.size()) {
-                const Core::Memory::TextCheatParser parser;
-                auto const res = parser.Parse(std::string_view(reinterpret_cast<const char*>(data.data()), data.size()));
+                auto const res = ParseCheatFile(f, std::move(data));
                 std::copy(res.begin(), res.end(), std::back_inserter(out));
             } else {
                 LOG_INFO(Common_Filesystem, "Failed to read cheats file for title_id={:016X}", title_id);
@@ -14,6 +14,7 @@
 #include "core/file_sys/patch_manager.h"
 #include "core/file_sys/registered_cache.h"
 #include "core/file_sys/romfs_factory.h"
+#include "core/file_sys/vfs/vfs_cached.h"
 #include "core/hle/kernel/k_process.h"
 #include "core/hle/service/filesystem/filesystem.h"
 #include "core/loader/loader.h"
@@ -38,15 +39,21 @@ void RomFSFactory::SetPackedUpdate(VirtualFile update_raw_file) {
 }
 
 VirtualFile RomFSFactory::OpenCurrentProcess(u64 current_process_title_id) const {
-    if (!updatable) {
-        return file;
+    VirtualFile romfs = file;
+    if (updatable) {
+        const auto type = ContentRecordType::Program;
+        const auto nca = content_provider.GetEntry(current_process_title_id, type);
+        const PatchManager patch_manager{current_process_title_id, filesystem_controller,
+                                         content_provider};
+        romfs = patch_manager.PatchRomFS(nca.get(), file, ContentRecordType::Program,
+                                         packed_update_raw);
     }
 
-    const auto type = ContentRecordType::Program;
-    const auto nca = content_provider.GetEntry(current_process_title_id, type);
-    const PatchManager patch_manager{current_process_title_id, filesystem_controller,
-                                     content_provider};
-    return patch_manager.PatchRomFS(nca.get(), file, ContentRecordType::Program, packed_update_raw);
+    // Serve the decrypted and patched RomFS through a block cache with read-ahead
+    if (romfs == nullptr) {
+        return nullptr;
+    }
+    return std::make_shared<CachedVfsFile>(std::move(romfs));
 }
 
 VirtualFile RomFSFactory::OpenPatchedRomFS(u64 title_id, ContentRecordType type) const {
@@ -5,6 +5,8 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <array>
+#include <future>
 #include <numeric>
 #include <string>
 #include "common/fs/path_util.h"
@@ -526,6 +528,52 @@ bool VfsRawCopy(const VirtualFile& src, const VirtualFile& dest, std::size_t blo
     return true;
 }
 
+bool VfsPipelinedCopy(const VirtualFile& src, const VirtualFile& dest, std::size_t block_size,
+                      const std::function<bool(std::size_t)>& progress) {
+    if (src == nullptr || dest == nullptr || !src->IsReadable() || !dest->IsWritable())
+        return false;
+
+    const std::size_t size = src->GetSize();
+    if (!dest->Resize(size))
+        return false;
+    if (size == 0)
+        return true;
+
+    block_size = (std::min)(block_size, size);
+    std::array<std::vector<u8>, 2> buffers{std::vector<u8>(block_size),
+                                           std::vector<u8>(block_size)};
+    const auto read_block = [&](std::size_t index, std::size_t offset) {
+        const auto length = (std::min)(block_size, size - offset);
+        return src->Read(buffers[index].data(), length, offset) == length;
+    };
+
+    bool read_ok = read_block(0, 0);
+    std::size_t index = 0;
+    for (std::size_t offset = 0; offset < size; offset += block_size, index ^= 1) {
+        if (!read_ok) {
+            return false;
+        }
+        if (progress && progress(offset)) {
+            dest->Resize(0);
+            return false;
+        }
+
+        std::future<bool> next_read;
+        if (offset + block_size < size) {
+            next_read = std::async(std::launch::async, read_block, index ^ 1, offset + block_size);
+        }
+
+        const auto length = (std::min)(block_size, size - offset);
+        const bool write_ok = dest->Write(buffers[index].data(), length, offset) == length;
+        read_ok = next_read.valid() ? next_read.get() : true;
+        if (!write_ok) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 bool VfsRawCopyD(const VirtualDir& src, const VirtualDir& dest, std::size_t block_size) {
     if (src == nullptr || dest == nullptr || !src->IsReadable() || !dest->IsWritable())
         return false;
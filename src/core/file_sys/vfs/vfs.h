@@ -323,6 +323,13 @@ bool DeepEquals(const VirtualFile& file1, const VirtualFile& file2,
 // directory of src/dest.
 bool VfsRawCopy(const VirtualFile& src, const VirtualFile& dest, std::size_t block_size = 0x1000);
 
+// Like VfsRawCopy, but reads the next block on another thread while the current one is written, so
+// the copy runs at the speed of the slower of the two files instead of the sum of both. Meant for
+// large blocks. If given, progress is called with the number of bytes copied before each block and
+// cancels the copy by returning true, in which case dest is truncated.
+bool VfsPipelinedCopy(const VirtualFile& src, const VirtualFile& dest, std::size_t block_size,
+                      const std::function<bool(std::size_t)>& progress = {});
+
 // A method that performs a similar function to VfsRawCopy above, but instead copies entire
 // directories. It suffers the same performance penalties as above and an implementation-specific
 // Copy should always be preferred.
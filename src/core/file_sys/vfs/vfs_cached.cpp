@@ -1,11 +1,30 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <list>
+#include <mutex>
+#include <utility>
+
+#include <ankerl/unordered_dense.h>
+
+#include "common/thread_worker.h"
 #include "core/file_sys/vfs/vfs_cached.h"
 #include "core/file_sys/vfs/vfs_types.h"
 
 namespace FileSys {
 
+namespace {
+
+Common::ThreadWorker& ReadAheadWorker() {
+    static Common::ThreadWorker worker{1, "FS:ReadAhead"};
+    return worker;
+}
+
+} // Anonymous namespace
+
 CachedVfsDirectory::CachedVfsDirectory(VirtualDir&& source_dir)
     : name(source_dir->GetName()), parent(source_dir->GetParentDirectory()) {
     for (auto& dir : source_dir->GetSubdirectories()) {
@@ -60,4 +79,146 @@ VirtualDir CachedVfsDirectory::GetParentDirectory() const {
     return parent;
 }
 
+struct CachedVfsFile::State {
+    using Block = std::pair<std::size_t, std::vector<u8>>;
+
+    VirtualFile base;
+    std::size_t size;
+
+    std::mutex mutex;
+    std::list<Block> blocks; ///< Cached blocks, the most recently used first
+    ankerl::unordered_dense::map<std::size_t, std::list<Block>::iterator> lookup;
+    ankerl::unordered_dense::set<std::size_t> pending; ///< Blocks being read ahead
+    std::size_t last_block = (std::numeric_limits<std::size_t>::max)();
+
+    std::vector<u8> ReadBlock(std::size_t block) const {
+        const std::size_t offset = block * BlockSize;
+        std::vector<u8> data((std::min)(BlockSize, size - offset));
+        data.resize(base->Read(data.data(), data.size(), offset));
+        return data;
+    }
+
+    // Must be called with the mutex held
+    void Insert(std::size_t block, std::vector<u8>&& data) {
+        if (lookup.contains(block)) {
+            return;
+        }
+        blocks.emplace_front(block, std::move(data));
+        lookup.emplace(block, blocks.begin());
+        if (blocks.size() > MaxCachedBlocks) {
+            lookup.erase(blocks.back().first);
+            blocks.pop_back();
+        }
+    }
+
+    // Must be called with the mutex held
+    void NoteAccess(const std::shared_ptr<State>& self, std::size_t block) {
+        const bool sequential = block == last_block + 1;
+        last_block = block;
+        if (!sequential) {
+            return;
+        }
+        const std::size_t num_blocks = (size + BlockSize - 1) / BlockSize;
+        const std::size_t end = (std::min)(block + 1 + ReadAheadBlocks, num_blocks);
+        for (std::size_t next = block + 1; next < end; ++next) {
+            if (lookup.contains(next) || !pending.insert(next).second) {
+                continue;
+            }
+            ReadAheadWorker().QueueWork(
+                [weak = std::weak_ptr<State>(self), next] {
+                    const std::shared_ptr<State> state = weak.lock();
+                    if (!state) {
+                        return;
+                    }
+                    std::vector<u8> data = state->ReadBlock(next);
+                    std::scoped_lock lk{state->mutex};
+                    state->pending.erase(next);
+                    state->Insert(next, std::move(data));
+                },
+                Common::WorkPriority::Low);
+        }
+    }
+};
+
+CachedVfsFile::CachedVfsFile(VirtualFile source_file)
+    : base(std::move(source_file)), state(std::make_shared<State>()) {
+    state->base = base;
+    state->size = base->GetSize();
+}
+
+CachedVfsFile::~CachedVfsFile() = default;
+
+std::string CachedVfsFile::GetName() const {
+    return base->GetName();
+}
+
+std::size_t CachedVfsFile::GetSize() const {
+    return state->size;
+}
+
+bool CachedVfsFile::Resize(std::size_t new_size) {
+    return false;
+}
+
+VirtualDir CachedVfsFile::GetContainingDirectory() const {
+    return base->GetContainingDirectory();
+}
+
+bool CachedVfsFile::IsWritable() const {
+    return false;
+}
+
+bool CachedVfsFile::IsReadable() const {
+    return true;
+}
+
+std::size_t CachedVfsFile::Read(u8* data, std::size_t length, std::size_t offset) const {
+    if (offset >= state->size) {
+        return 0;
+    }
+    length = (std::min)(length, state->size - offset);
+
+    // Reads spanning several blocks gain nothing from the cache
+    if (length >= BlockSize * ReadAheadBlocks) {
+        return base->Read(data, length, offset);
+    }
+
+    std::size_t done = 0;
+    while (done < length) {
+        const std::size_t block = (offset + done) / BlockSize;
+        const std::size_t block_offset = (offset + done) % BlockSize;
+        const std::size_t copy_size = (std::min)(BlockSize - block_offset, length - done);
+
+        std::unique_lock lk{state->mutex};
+        if (const auto it = state->lookup.find(block); it != state->lookup.end()) {
+            state->blocks.splice(state->blocks.begin(), state->blocks, it->second);
+        } else {
+            lk.unlock();
+            std::vector<u8> block_data = state->ReadBlock(block);
+            lk.lock();
+            if (block_data.size() < block_offset + copy_size) {
+                // The source file ended early, return what it had
+                const std::size_t available = block_data.size() - (std::min)(block_data.size(), block_offset);
+                if (available != 0) {
+                    std::memcpy(data + done, block_data.data() + block_offset, available);
+                }
+                return done + available;
+            }
+            state->Insert(block, std::move(block_data));
+        }
+        std::memcpy(data + done, state->lookup.at(block)->second.data() + block_offset, copy_size);
+        state->NoteAccess(state, block);
+        done += copy_size;
+    }
+    return done;
+}
+
+std::size_t CachedVfsFile::Write(const u8* data, std::size_t length, std::size_t offset) {
+    return 0;
+}
+
+bool CachedVfsFile::Rename(std::string_view new_name) {
+    return false;
+}
+
 } // namespace FileSys
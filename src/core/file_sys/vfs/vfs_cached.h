@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string_view>
 #include <vector>
 #include "core/file_sys/vfs/vfs.h"
@@ -28,4 +29,37 @@ private:
     std::map<std::string, VirtualFile, std::less<>> files;
 };
 
+/// Read-only file that keeps the most recently read blocks of another file in memory.
+/// Once reads are found to be sequential, the following blocks are read ahead on a background
+/// thread.
+class CachedVfsFile : public VfsFile {
+public:
+    /// Granularity at which the source file is read and cached
+    static constexpr std::size_t BlockSize = 0x20000;
+    /// Number of blocks kept in memory, bounding the cache to 8 MiB per file
+    static constexpr std::size_t MaxCachedBlocks = 64;
+    /// Number of blocks read ahead of a sequential reader
+    static constexpr std::size_t ReadAheadBlocks = 4;
+
+    explicit CachedVfsFile(VirtualFile source_file);
+    ~CachedVfsFile() override;
+
+    std::string GetName() const override;
+    std::size_t GetSize() const override;
+    bool Resize(std::size_t new_size) override;
+    VirtualDir GetContainingDirectory() const override;
+    bool IsWritable() const override;
+    bool IsReadable() const override;
+    std::size_t Read(u8* data, std::size_t length, std::size_t offset) const override;
+    std::size_t Write(const u8* data, std::size_t length, std::size_t offset) override;
+    bool Rename(std::string_view new_name) override;
+
+private:
+    struct State;
+
+    VirtualFile base;
+    // Shared with the read-ahead work, which may outlive the file
+    std::shared_ptr<State> state;
+};
+
 } // namespace FileSys
@@ -78,18 +78,20 @@ std::vector<VirtualFile> LayeredVfsDirectory::GetFiles() const {
 }
 
 std::vector<VirtualDir> LayeredVfsDirectory::GetSubdirectories() const {
-    std::vector<VirtualDir> out;
-    ankerl::unordered_dense::set<std::string> out_names;
+    // Group the subdirectories of every layer by name in layer order, this is what looking each
+    // name up through GetSubdirectory would return without searching every layer again.
+    ankerl::unordered_dense::map<std::string, std::vector<VirtualDir>> out_layers;
 
     for (const auto& layer : dirs) {
-        for (const auto& sd : layer->GetSubdirectories()) {
-            out_names.emplace(sd->GetName());
+        for (auto& sd : layer->GetSubdirectories()) {
+            out_layers[sd->GetName()].emplace_back(std::move(sd));
         }
     }
 
-    out.reserve(out_names.size());
-    for (const auto& subdir : out_names) {
-        out.emplace_back(GetSubdirectory(subdir));
+    std::vector<VirtualDir> out;
+    out.reserve(out_layers.size());
+    for (auto& [subdir, layers] : out_layers) {
+        out.emplace_back(MakeLayeredDirectory(std::move(layers)));
     }
 
     return out;
@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <iterator>
 #include <utility>
 #include "common/assert.h"
@@ -13,6 +14,7 @@
 #include "common/fs/fs.h"
 #include "common/fs/path_util.h"
 #include "common/logging.h"
+#include "common/string_util.h"
 #include "core/file_sys/vfs/vfs.h"
 #include "core/file_sys/vfs/vfs_real.h"
 
@@ -211,6 +213,7 @@ std::unique_lock<std::mutex> RealVfsFilesystem::RefreshReference(const std::stri
     // Restore file if needed.
     if (!reference.file) {
         this->EvictSingleReferenceLocked();
+        reference.write_position = -1;
 
         reference.file =
             FS::FileOpen(path, ModeFlagsToFileAccessMode(perms), FS::FileType::BinaryFile);
@@ -301,13 +304,33 @@ std::size_t RealVfsFile::GetSize() const {
         return *size;
     }
     auto lk = base.RefreshReference(path, perms, *reference);
-    return reference->file ? reference->file->GetSize() : 0;
+    if (!reference->file) {
+        return 0;
+    }
+    const u64 file_size = reference->file->GetSize();
+    // Writes through this file keep the size up to date from here on.
+    if (True(perms & OpenMode::Write)) {
+        size = file_size;
+    }
+    return file_size;
 }
 
 bool RealVfsFile::Resize(std::size_t new_size) {
     size.reset();
     auto lk = base.RefreshReference(path, perms, *reference);
-    return reference->file ? reference->file->SetSize(new_size) : false;
+    if (!reference->file) {
+        return false;
+    }
+    // Buffered writes must reach the file before it is truncated, or they would extend it again.
+    if (reference->write_position != -1) {
+        reference->write_position = -1;
+        void(reference->file->Flush());
+    }
+    if (!reference->file->SetSize(new_size)) {
+        return false;
+    }
+    size = new_size;
+    return true;
 }
 
 VirtualDir RealVfsFile::GetContainingDirectory() const {
@@ -322,8 +345,45 @@ bool RealVfsFile::IsReadable() const {
     return True(perms & OpenMode::Read);
 }
 
+std::span<const u8> RealVfsFile::GetMapping() const {
+    std::call_once(mapping_flag, [this] {
+        if (perms != OpenMode::Read) {
+            return;
+        }
+#ifdef __ANDROID__
+        if (path[0] != '/') {
+            return;
+        }
+#endif
+        const std::string extension = Common::ToLower(GetExtension());
+        if (extension != "xci" && extension != "nsp" && extension != "nca") {
+            return;
+        }
+        auto mapped_file = std::make_unique<FS::MappedFile>();
+        if (mapped_file->Open(path)) {
+            mapping = std::move(mapped_file);
+        }
+    });
+    return mapping ? mapping->Span() : std::span<const u8>{};
+}
+
 std::size_t RealVfsFile::Read(u8* data, std::size_t length, std::size_t offset) const {
+    if (const std::span<const u8> mapped = GetMapping(); !mapped.empty()) {
+        if (offset >= mapped.size()) {
+            return 0;
+        }
+        const std::size_t read_size = (std::min)(length, mapped.size() - offset);
+        // Let the host read large ranges in with a few big requests rather than one per fault
+        constexpr std::size_t PrefetchThreshold = 0x40000;
+        if (read_size >= PrefetchThreshold) {
+            mapping->Prefetch(offset, read_size);
+        }
+        std::memcpy(data, mapped.data() + offset, read_size);
+        return read_size;
+    }
+
     auto lk = base.RefreshReference(path, perms, *reference);
+    reference->write_position = -1;
     if (!reference->file || !reference->file->Seek(static_cast<s64>(offset))) {
         return 0;
     }
@@ -331,12 +391,31 @@ std::size_t RealVfsFile::Read(u8* data, std::size_t length, std::size_t offset)
 }
 
 std::size_t RealVfsFile::Write(const u8* data, std::size_t length, std::size_t offset) {
-    size.reset();
     auto lk = base.RefreshReference(path, perms, *reference);
-    if (!reference->file || !reference->file->Seek(static_cast<s64>(offset))) {
+    if (!reference->file) {
+        size.reset();
         return 0;
     }
-    return reference->file->WriteSpan(std::span{data, length});
+
+    // Small sequential writes, like the ones of save data, then coalesce in the stream buffer.
+    if (reference->write_position != static_cast<s64>(offset)) {
+        reference->write_position = -1;
+        if (!reference->file->Seek(static_cast<s64>(offset))) {
+            size.reset();
+            return 0;
+        }
+    }
+
+    const auto written = reference->file->WriteSpan(std::span{data, length});
+    reference->write_position = written == length ? static_cast<s64>(offset + length) : -1;
+
+    // Keep the cached size valid, so the write checks of the guest don't query the host every time.
+    if (size && written == length) {
+        size = (std::max)(*size, static_cast<u64>(offset + length));
+    } else {
+        size.reset();
+    }
+    return written;
 }
 
 bool RealVfsFile::Rename(std::string_view name) {
@@ -7,8 +7,10 @@
 #pragma once
 
 #include <map>
+#include <memory>
 #include <mutex>
 #include <optional>
+#include <span>
 #include <string_view>
 #include "common/intrusive_list.h"
 #include "core/file_sys/fs_filesystem.h"
@@ -16,12 +18,16 @@
 
 namespace Common::FS {
 class IOFile;
-}
+class MappedFile;
+} // namespace Common::FS
 
 namespace FileSys {
 
 struct FileReference : public Common::IntrusiveListBaseNode<FileReference> {
     std::shared_ptr<Common::FS::IOFile> file{};
+    // Stream position after the last write, or -1 if the last operation wasn't a write. Lets
+    // sequential writes skip the seek, which would flush the stream buffer every time.
+    s64 write_position{-1};
 };
 
 class RealVfsFile;
@@ -104,8 +110,14 @@ private:
     std::string path;
     std::string parent_path;
     std::vector<std::string> path_components;
-    std::optional<u64> size;
+    mutable std::optional<u64> size;
     OpenMode perms;
+
+    // Read-only game images are read through a memory mapping instead of the file reference,
+    // which is only created if the file is actually read.
+    std::span<const u8> GetMapping() const;
+    mutable std::once_flag mapping_flag;
+    mutable std::unique_ptr<Common::FS::MappedFile> mapping;
 };
 
 // An implementation of VfsDirectory that represents a directory on the user's computer.
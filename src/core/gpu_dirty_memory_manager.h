@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <bit>
 #include <functional>
@@ -14,10 +15,14 @@
 
 namespace Core {
 
+/// Tracks guest writes to GPU visible memory for a single CPU core.
+/// Collect is only called from the owning core and Gather only from the GPU thread, so pages are
+/// handed over through a single-producer single-consumer ring. The mutex is only taken when the
+/// ring overflows before the GPU thread gets to drain it.
 class GPUDirtyMemoryManager {
 public:
     GPUDirtyMemoryManager() : current{default_transform} {
-        back_buffer.reserve(256);
+        overflow_buffer.reserve(256);
         front_buffer.reserve(256);
     }
 
@@ -31,9 +36,13 @@ public:
             original = tmp;
             if (tmp.address != t.address) {
                 if (IsValid(tmp.address)) {
-                    std::scoped_lock lk(guard);
-                    back_buffer.emplace_back(tmp);
-                    current.exchange(t, std::memory_order_relaxed);
+                    // Gather may have taken the previous page in the meantime, flush whatever
+                    // is actually replaced.
+                    const TransformAddress previous =
+                        current.exchange(t, std::memory_order_acq_rel);
+                    if (IsValid(previous.address)) {
+                        Push(previous);
+                    }
                     return;
                 }
                 tmp.address = t.address;
@@ -48,13 +57,22 @@ public:
     }
 
     void Gather(std::function<void(PAddr, size_t)>& callback) {
-        {
+        const size_t write_index = ring_write.load(std::memory_order_acquire);
+        for (size_t index = ring_read.load(std::memory_order_relaxed); index != write_index;
+             ++index) {
+            front_buffer.push_back(ring[index % ring_size]);
+        }
+        ring_read.store(write_index, std::memory_order_release);
+        if (has_overflow.load(std::memory_order_acquire)) {
             std::scoped_lock lk(guard);
-            TransformAddress t = current.exchange(default_transform, std::memory_order_relaxed);
-            front_buffer.swap(back_buffer);
-            if (IsValid(t.address)) {
-                front_buffer.emplace_back(t);
-            }
+            front_buffer.insert(front_buffer.end(), overflow_buffer.begin(),
+                                overflow_buffer.end());
+            overflow_buffer.clear();
+            has_overflow.store(false, std::memory_order_relaxed);
+        }
+        const TransformAddress t = current.exchange(default_transform, std::memory_order_acq_rel);
+        if (IsValid(t.address)) {
+            front_buffer.emplace_back(t);
         }
         for (auto& transform : front_buffer) {
             size_t offset = 0;
@@ -113,9 +131,27 @@ private:
         return result;
     }
 
+    void Push(TransformAddress transform) {
+        const size_t write_index = ring_write.load(std::memory_order_relaxed);
+        if (write_index - ring_read.load(std::memory_order_acquire) < ring_size) {
+            ring[write_index % ring_size] = transform;
+            ring_write.store(write_index + 1, std::memory_order_release);
+            return;
+        }
+        std::scoped_lock lk(guard);
+        overflow_buffer.emplace_back(transform);
+        has_overflow.store(true, std::memory_order_release);
+    }
+
+    constexpr static size_t ring_size = 1024;
+
     std::atomic<TransformAddress> current{};
+    std::array<TransformAddress, ring_size> ring{};
+    alignas(64) std::atomic<size_t> ring_write{};
+    alignas(64) std::atomic<size_t> ring_read{};
+    std::atomic<bool> has_overflow{};
     std::mutex guard;
-    std::vector<TransformAddress> back_buffer;
+    std::vector<TransformAddress> overflow_buffer;
     std::vector<TransformAddress> front_buffer;
 };
 
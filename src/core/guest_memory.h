@@ -7,6 +7,7 @@
 #include <memory>
 #include <optional>
 #include <span>
+#include <utility>
 #include <vector>
 
 #include "common/assert.h"
@@ -194,6 +195,11 @@ public:
                                Common::ScratchBuffer<T>* backup = nullptr)
         : GuestMemory<M, T, FLAGS>(memory, addr, size, backup) {}
 
+    GuestMemoryScoped(GuestMemoryScoped&& rhs) noexcept : GuestMemory<M, T, FLAGS>(std::move(rhs)) {
+        // Only the new owner writes the data back
+        rhs.m_size = 0;
+    }
+
     ~GuestMemoryScoped() {
         if constexpr (FLAGS & GuestMemoryFlags::Write) {
             if (this->size() == 0) [[unlikely]] {
@@ -139,8 +139,9 @@ Result KAddressArbiter::Signal(uint64_t addr, s32 count) {
     {
         KScopedSchedulerLock sl(system.Kernel());
 
-        auto it = m_tree.nfind_key({addr, -1});
-        while ((it != m_tree.end()) && (count <= 0 || num_waiters < count) &&
+        ThreadTree& tree = m_trees.Get(addr);
+        auto it = tree.nfind_key({addr, -1});
+        while ((it != tree.end()) && (count <= 0 || num_waiters < count) &&
                (it->GetAddressArbiterKey() == addr)) {
             // End the thread's wait.
             KThread* target_thread = std::addressof(*it);
@@ -149,7 +150,7 @@ Result KAddressArbiter::Signal(uint64_t addr, s32 count) {
             ASSERT(target_thread->IsWaitingForAddressArbiter());
             target_thread->ClearAddressArbiter();
 
-            it = m_tree.erase(it);
+            it = tree.erase(it);
             ++num_waiters;
         }
     }
@@ -168,8 +169,9 @@ Result KAddressArbiter::SignalAndIncrementIfEqual(uint64_t addr, s32 value, s32
                  ResultInvalidCurrentMemory);
         R_UNLESS(user_value == value, ResultInvalidState);
 
-        auto it = m_tree.nfind_key({addr, -1});
-        while ((it != m_tree.end()) && (count <= 0 || num_waiters < count) &&
+        ThreadTree& tree = m_trees.Get(addr);
+        auto it = tree.nfind_key({addr, -1});
+        while ((it != tree.end()) && (count <= 0 || num_waiters < count) &&
                (it->GetAddressArbiterKey() == addr)) {
             // End the thread's wait.
             KThread* target_thread = std::addressof(*it);
@@ -178,7 +180,7 @@ Result KAddressArbiter::SignalAndIncrementIfEqual(uint64_t addr, s32 value, s32
             ASSERT(target_thread->IsWaitingForAddressArbiter());
             target_thread->ClearAddressArbiter();
 
-            it = m_tree.erase(it);
+            it = tree.erase(it);
             ++num_waiters;
         }
     }
@@ -191,20 +193,21 @@ Result KAddressArbiter::SignalAndModifyByWaitingCountIfEqual(uint64_t addr, s32
     {
         KScopedSchedulerLock sl(system.Kernel());
 
-        auto it = m_tree.nfind_key({addr, -1});
+        ThreadTree& tree = m_trees.Get(addr);
+        auto it = tree.nfind_key({addr, -1});
         // Determine the updated value.
         s32 new_value{};
         if (count <= 0) {
-            if (it != m_tree.end() && it->GetAddressArbiterKey() == addr) {
+            if (it != tree.end() && it->GetAddressArbiterKey() == addr) {
                 new_value = value - 2;
             } else {
                 new_value = value + 1;
             }
         } else {
-            if (it != m_tree.end() && it->GetAddressArbiterKey() == addr) {
+            if (it != tree.end() && it->GetAddressArbiterKey() == addr) {
                 auto tmp_it = it;
                 s32 tmp_num_waiters{};
-                while (++tmp_it != m_tree.end() && tmp_it->GetAddressArbiterKey() == addr) {
+                while (++tmp_it != tree.end() && tmp_it->GetAddressArbiterKey() == addr) {
                     if (tmp_num_waiters++ >= count) {
                         break;
                     }
@@ -232,7 +235,7 @@ Result KAddressArbiter::SignalAndModifyByWaitingCountIfEqual(uint64_t addr, s32
         R_UNLESS(succeeded, ResultInvalidCurrentMemory);
         R_UNLESS(user_value == value, ResultInvalidState);
 
-        while ((it != m_tree.end()) && (count <= 0 || num_waiters < count) &&
+        while ((it != tree.end()) && (count <= 0 || num_waiters < count) &&
                (it->GetAddressArbiterKey() == addr)) {
             // End the thread's wait.
             KThread* target_thread = std::addressof(*it);
@@ -241,7 +244,7 @@ Result KAddressArbiter::SignalAndModifyByWaitingCountIfEqual(uint64_t addr, s32
             ASSERT(target_thread->IsWaitingForAddressArbiter());
             target_thread->ClearAddressArbiter();
 
-            it = m_tree.erase(it);
+            it = tree.erase(it);
             ++num_waiters;
         }
     }
@@ -252,7 +255,8 @@ Result KAddressArbiter::WaitIfLessThan(uint64_t addr, s32 value, bool decrement,
     // Prepare to wait.
     KThread* cur_thread = GetCurrentThreadPointer(system.Kernel());
     KHardwareTimer* timer{};
-    ThreadQueueImplForKAddressArbiter wait_queue(system.Kernel(), std::addressof(m_tree));
+    ThreadTree& tree = m_trees.Get(addr);
+    ThreadQueueImplForKAddressArbiter wait_queue(system.Kernel(), std::addressof(tree));
 
     {
         KScopedSchedulerLockAndSleep slp{system.Kernel(), std::addressof(timer), cur_thread, timeout};
@@ -290,8 +294,8 @@ Result KAddressArbiter::WaitIfLessThan(uint64_t addr, s32 value, bool decrement,
         }
 
         // Set the arbiter.
-        cur_thread->SetAddressArbiter(std::addressof(m_tree), addr);
-        m_tree.insert(*cur_thread);
+        cur_thread->SetAddressArbiter(std::addressof(tree), addr);
+        tree.insert(*cur_thread);
 
         // Wait for the thread to finish.
         wait_queue.SetHardwareTimer(timer);
@@ -307,7 +311,8 @@ Result KAddressArbiter::WaitIfEqual(uint64_t addr, s32 value, s64 timeout) {
     // Prepare to wait.
     KThread* cur_thread = GetCurrentThreadPointer(system.Kernel());
     KHardwareTimer* timer{};
-    ThreadQueueImplForKAddressArbiter wait_queue(system.Kernel(), std::addressof(m_tree));
+    ThreadTree& tree = m_trees.Get(addr);
+    ThreadQueueImplForKAddressArbiter wait_queue(system.Kernel(), std::addressof(tree));
 
     {
         KScopedSchedulerLockAndSleep slp{system.Kernel(), std::addressof(timer), cur_thread, timeout};
@@ -338,8 +343,8 @@ Result KAddressArbiter::WaitIfEqual(uint64_t addr, s32 value, s64 timeout) {
         }
 
         // Set the arbiter.
-        cur_thread->SetAddressArbiter(std::addressof(m_tree), addr);
-        m_tree.insert(*cur_thread);
+        cur_thread->SetAddressArbiter(std::addressof(tree), addr);
+        tree.insert(*cur_thread);
 
         // Wait for the thread to finish.
         wait_queue.SetHardwareTimer(timer);
@@ -24,6 +24,7 @@ class KernelCore;
 class KAddressArbiter {
 public:
     using ThreadTree = KConditionVariable::ThreadTree;
+    using ThreadTreeTable = KConditionVariable::ThreadTreeTable;
 
     explicit KAddressArbiter(Core::System& system);
     ~KAddressArbiter();
@@ -62,7 +63,7 @@ private:
     Result WaitIfEqual(uint64_t addr, s32 value, s64 timeout);
 
 private:
-    ThreadTree m_tree;
+    ThreadTreeTable m_trees;
     Core::System& system;
 };
 
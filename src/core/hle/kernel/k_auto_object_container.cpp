@@ -2,31 +2,45 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <bit>
 
 #include "core/hle/kernel/k_auto_object_container.h"
 
 namespace Kernel {
 
+KAutoObjectWithListContainer::Shard& KAutoObjectWithListContainer::GetShard(
+    const KAutoObjectWithList* obj) {
+    // Slab objects are laid out at a fixed stride, so mix the address before picking a shard.
+    const u64 hash = (reinterpret_cast<uintptr_t>(obj) >> 4) * 0x9E3779B97F4A7C15ULL;
+    return m_shards[hash >> (64 - std::countr_zero(NumShards))];
+}
+
 void KAutoObjectWithListContainer::Register(KAutoObjectWithList* obj) {
     // KScopedInterruptDisable di;
-    KScopedSpinLock lk(m_lock);
+    Shard& shard = GetShard(obj);
+    KScopedSpinLock lk(shard.m_lock);
 
-    m_object_list.insert_unique(*obj);
+    shard.m_object_list.insert_unique(*obj);
 }
 
 void KAutoObjectWithListContainer::Unregister(KAutoObjectWithList* obj) {
     // KScopedInterruptDisable di;
-    KScopedSpinLock lk(m_lock);
+    Shard& shard = GetShard(obj);
+    KScopedSpinLock lk(shard.m_lock);
 
-    m_object_list.erase(*obj);
+    shard.m_object_list.erase(*obj);
 }
 
 size_t KAutoObjectWithListContainer::GetOwnedCount(KProcess* owner) {
-    // KScopedInterruptDisable di;
-    KScopedSpinLock lk(m_lock);
-
-    return std::count_if(m_object_list.begin(), m_object_list.end(),
-                         [&](const auto& obj) { return obj.GetOwner() == owner; });
+    size_t count = 0;
+    for (Shard& shard : m_shards) {
+        // KScopedInterruptDisable di;
+        KScopedSpinLock lk(shard.m_lock);
+
+        count += std::count_if(shard.m_object_list.begin(), shard.m_object_list.end(),
+                               [&](const auto& obj) { return obj.GetOwner() == owner; });
+    }
+    return count;
 }
 
 } // namespace Kernel
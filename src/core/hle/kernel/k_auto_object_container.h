@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <array>
+
 #include <boost/intrusive/rbtree.hpp>
 
 #include "common/common_funcs.h"
@@ -21,7 +23,7 @@ public:
 
     using ListType = boost::intrusive::rbtree<KAutoObjectWithList>;
 
-    KAutoObjectWithListContainer(KernelCore& kernel) : m_lock(), m_object_list() {}
+    KAutoObjectWithListContainer(KernelCore& kernel) : m_shards() {}
 
     void Initialize() {}
     void Finalize() {}
@@ -31,8 +33,17 @@ public:
     size_t GetOwnedCount(KProcess* owner);
 
 private:
-    KSpinLock m_lock;
-    ListType m_object_list;
+    /// Objects are spread over several lists by address, so that cores creating and closing
+    /// objects at the same time rarely wait on each other.
+    struct alignas(64) Shard {
+        KSpinLock m_lock;
+        ListType m_object_list;
+    };
+    static constexpr size_t NumShards = 8;
+
+    Shard& GetShard(const KAutoObjectWithList* obj);
+
+    std::array<Shard, NumShards> m_shards;
 };
 
 } // namespace Kernel
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <array>
+
 #include "common/assert.h"
 
 #include "core/hle/kernel/k_scheduler.h"
@@ -24,6 +26,19 @@ class KConditionVariable {
 public:
     using ThreadTree = typename KThread::ConditionVariableThreadTreeType;
 
+    /// Waiting threads hashed by key into separate trees, so a wait or signal only walks the
+    /// threads parked on keys sharing its bucket. Each tree keeps the usual key/priority order.
+    class ThreadTreeTable {
+    public:
+        ThreadTree& Get(u64 key) {
+            return m_trees[((key >> 2) * 0x9E3779B97F4A7C15ULL) >> (64 - NumBucketsLog2)];
+        }
+
+    private:
+        static constexpr size_t NumBucketsLog2 = 8;
+        std::array<ThreadTree, 1ULL << NumBucketsLog2> m_trees{};
+    };
+
     explicit KConditionVariable(Core::System& system);
     ~KConditionVariable();
 
@@ -40,7 +55,7 @@ private:
 
 private:
     Core::System& m_system;
-    ThreadTree m_tree{};
+    ThreadTreeTable m_trees{};
 };
 
 inline void BeforeUpdatePriority(KernelCore& kernel, KConditionVariable::ThreadTree* tree,
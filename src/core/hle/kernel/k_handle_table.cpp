@@ -15,7 +15,7 @@ void KHandleTable::Finalize(KernelCore& kernel) {
     u16 saved_table_size = 0;
     {
         KScopedDisableDispatch dd{kernel};
-        KScopedSpinLock lk(m_lock);
+        std::scoped_lock lk{m_lock};
 
         std::swap(m_table_size, saved_table_size);
     }
@@ -42,7 +42,7 @@ bool KHandleTable::Remove(KernelCore& kernel, Handle handle) {
     KAutoObject* obj = nullptr;
     {
         KScopedDisableDispatch dd{kernel};
-        KScopedSpinLock lk(m_lock);
+        std::scoped_lock lk{m_lock};
 
         if (this->IsValidHandle(handle)) [[likely]] {
             const auto index = handle_pack.index;
@@ -62,7 +62,7 @@ bool KHandleTable::Remove(KernelCore& kernel, Handle handle) {
 
 Result KHandleTable::Add(KernelCore& kernel, Handle* out_handle, KAutoObject* obj) {
     KScopedDisableDispatch dd{kernel};
-    KScopedSpinLock lk(m_lock);
+    std::scoped_lock lk{m_lock};
 
     // Never exceed our capacity.
     R_UNLESS(m_count < m_table_size, ResultOutOfHandles);
@@ -99,7 +99,7 @@ KScopedAutoObject<KAutoObject> KHandleTable::GetObjectForIpc(KernelCore& kernel,
 
 Result KHandleTable::Reserve(KernelCore& kernel, Handle* out_handle) {
     KScopedDisableDispatch dd{kernel};
-    KScopedSpinLock lk(m_lock);
+    std::scoped_lock lk{m_lock};
 
     // Never exceed our capacity.
     R_UNLESS(m_count < m_table_size, ResultOutOfHandles);
@@ -110,7 +110,7 @@ Result KHandleTable::Reserve(KernelCore& kernel, Handle* out_handle) {
 
 void KHandleTable::Unreserve(KernelCore& kernel, Handle handle) {
     KScopedDisableDispatch dd{kernel};
-    KScopedSpinLock lk(m_lock);
+    std::scoped_lock lk{m_lock};
 
     // Unpack the handle.
     const auto handle_pack = HandlePack(handle);
@@ -129,7 +129,7 @@ void KHandleTable::Unreserve(KernelCore& kernel, Handle handle) {
 
 void KHandleTable::Register(KernelCore& kernel, Handle handle, KAutoObject* obj) {
     KScopedDisableDispatch dd{kernel};
-    KScopedSpinLock lk(m_lock);
+    std::scoped_lock lk{m_lock};
 
     // Unpack the handle.
     const auto handle_pack = HandlePack(handle);
@@ -7,12 +7,13 @@
 #pragma once
 
 #include <array>
+#include <mutex>
+#include <shared_mutex>
 
 #include "common/assert.h"
 #include "common/bit_field.h"
 #include "common/common_types.h"
 #include "core/hle/kernel/k_auto_object.h"
-#include "core/hle/kernel/k_spin_lock.h"
 #include "core/hle/kernel/k_thread.h"
 #include "core/hle/kernel/kernel.h"
 #include "core/hle/kernel/svc_common.h"
@@ -39,7 +40,7 @@ public:
 
         // Lock.
         KScopedDisableDispatch dd{kernel};
-        KScopedSpinLock lk(m_lock);
+        std::scoped_lock lk{m_lock};
 
         // Initialize all fields.
         m_max_count = 0;
@@ -75,7 +76,7 @@ public:
     KScopedAutoObject<T> GetObjectWithoutPseudoHandle(KernelCore& kernel, Handle handle) const {
         // Lock and look up in table.
         KScopedDisableDispatch dd{kernel};
-        KScopedSpinLock lk(m_lock);
+        std::shared_lock lk{m_lock};
 
         if constexpr (std::is_same_v<T, KAutoObject>) {
             return {kernel, this->GetObjectImpl(handle)};
@@ -110,13 +111,13 @@ public:
     KScopedAutoObject<KAutoObject> GetObjectForIpcWithoutPseudoHandle(KernelCore& kernel, Handle handle) const {
         // Lock and look up in table.
         KScopedDisableDispatch dd{kernel};
-        KScopedSpinLock lk(m_lock);
+        std::shared_lock lk{m_lock};
         return {kernel, this->GetObjectImpl(handle)};
     }
     KScopedAutoObject<KAutoObject> GetObjectForIpc(KernelCore& kernel, Handle handle, KThread* cur_thread) const;
     KScopedAutoObject<KAutoObject> GetObjectByIndex(KernelCore& kernel, Handle* out_handle, size_t index) const {
         KScopedDisableDispatch dd{kernel};
-        KScopedSpinLock lk(m_lock);
+        std::shared_lock lk{m_lock};
 
         return {kernel, this->GetObjectByIndexImpl(out_handle, index)};
     }
@@ -134,7 +135,7 @@ public:
         {
             // Lock the table.
             KScopedDisableDispatch dd{kernel};
-            KScopedSpinLock lk(m_lock);
+            std::shared_lock lk{m_lock};
             for (num_opened = 0; num_opened < num_handles; num_opened++) {
                 // Get the current handle.
                 const auto cur_handle = handles[num_opened];
@@ -296,7 +297,8 @@ private:
 private:
     std::array<EntryInfo, MaxTableSize> m_entry_infos{};
     std::array<KAutoObject*, MaxTableSize> m_objects{};
-    mutable KSpinLock m_lock;
+    // Lookups from every core only need shared access, the table is modified far less often.
+    mutable std::shared_mutex m_lock;
     s32 m_free_head_index{};
     u16 m_table_size{};
     u16 m_max_count{};
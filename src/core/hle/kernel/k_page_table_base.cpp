@@ -5790,6 +5790,9 @@ Result KPageTableBase::Operate(PageLinkedList* page_list, KProcessAddress virt_a
 }
 
 void KPageTableBase::FinalizeUpdate(PageLinkedList* page_list) {
+    // Apply the host mapping changes made while the update was in progress.
+    m_memory->FlushHostMappings();
+
     while (page_list->Peek()) {
         [[maybe_unused]] auto page = page_list->Pop();
 
@@ -133,6 +133,13 @@ void KProcess::Finalize(KernelCore& kernel) {
     // Get the used memory size.
     const size_t used_memory_size = this->GetUsedNonSystemUserPhysicalMemorySize(kernel);
 
+    // Let the CPU backends finish with guest memory before it is unmapped.
+    for (auto& interface : m_arm_interfaces) {
+        if (interface) {
+            interface->Finalize();
+        }
+    }
+
     // Finalize the page table.
     m_page_table.Finalize();
 
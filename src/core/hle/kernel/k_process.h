@@ -22,6 +22,10 @@
 #include "core/hle/kernel/k_thread_local_page.h"
 #include "core/memory.h"
 
+#ifdef HAS_NCE
+#include "core/arm/nce/patcher.h"
+#endif
+
 namespace Kernel {
 
 enum class DebugWatchpointType : u8 {
@@ -79,6 +83,7 @@ private:
     std::map<KProcessAddress, u64> m_debug_page_refcounts{};
 #ifdef HAS_NCE
     ankerl::unordered_dense::map<u64, u64> m_post_handlers{};
+    Core::NCE::FaultSitePatcher m_fault_site_patcher{};
 #endif
     std::unique_ptr<Core::ExclusiveMonitor> m_exclusive_monitor;
     Core::Memory::Memory m_memory;
@@ -497,6 +502,10 @@ public:
     ankerl::unordered_dense::map<u64, u64>& GetPostHandlers() noexcept {
         return m_post_handlers;
     }
+
+    Core::NCE::FaultSitePatcher& GetFaultSitePatcher() noexcept {
+        return m_fault_site_patcher;
+    }
 #endif
 
     Core::ArmInterface* GetArmInterface(size_t core_index) const {
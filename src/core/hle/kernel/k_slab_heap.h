@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 
 #include "common/assert.h"
@@ -13,6 +15,7 @@
 #include "common/common_funcs.h"
 #include "common/common_types.h"
 #include "common/spin_lock.h"
+#include "core/hardware_properties.h"
 
 namespace Kernel {
 
@@ -66,6 +69,37 @@ public:
         m_lock.unlock();
     }
 
+    /// Detaches up to count nodes from the free list at once, returning how many were taken.
+    size_t AllocateList(Node** out_head, size_t count) {
+        m_lock.lock();
+
+        Node* const head = m_head;
+        Node* tail = nullptr;
+        size_t taken = 0;
+        for (Node* cur = head; cur != nullptr && taken < count; cur = cur->next) {
+            tail = cur;
+            ++taken;
+        }
+        if (tail != nullptr) {
+            m_head = tail->next;
+            tail->next = nullptr;
+        }
+
+        m_lock.unlock();
+        *out_head = taken != 0 ? head : nullptr;
+        return taken;
+    }
+
+    /// Returns a chain of nodes, from head to tail, to the free list at once.
+    void FreeList(Node* head, Node* tail) {
+        m_lock.lock();
+
+        tail->next = m_head;
+        m_head = head;
+
+        m_lock.unlock();
+    }
+
 private:
     std::atomic<Node*> m_head{};
     Common::SpinLock m_lock;
@@ -79,10 +113,19 @@ class KSlabHeapBase : protected impl::KSlabHeapImpl {
     YUZU_NON_MOVEABLE(KSlabHeapBase);
 
 private:
+    /// Free objects kept aside for the host thread of one emulated core, accessed only by it.
+    struct alignas(64) CoreCache {
+        Node* head{};
+        size_t count{};
+    };
+    static constexpr size_t MaxCoreCacheObjects = 16;
+
     size_t m_obj_size{};
     uintptr_t m_peak{};
     uintptr_t m_start{};
     uintptr_t m_end{};
+    size_t m_core_cache_limit{};
+    std::array<CoreCache, Core::Hardware::NUM_CPU_CORES> m_core_caches{};
 
 private:
     void UpdatePeakImpl(uintptr_t obj) {
@@ -126,6 +169,10 @@ public:
             cur -= obj_size;
             KSlabHeapImpl::Free(cur);
         }
+
+        // Don't let the core caches hold more than a sixteenth of the heap, small heaps go
+        // without them.
+        m_core_cache_limit = (std::min)(MaxCoreCacheObjects, num_obj / (m_core_caches.size() * 16));
     }
 
     size_t GetSlabHeapSize() const {
@@ -149,6 +196,56 @@ public:
         KSlabHeapImpl::Free(obj);
     }
 
+    /// Allocates from the cache of the given host thread, which only emulated cores have.
+    /// The cache is refilled from the shared free list in batches.
+    void* Allocate(size_t host_thread_id) {
+        if (host_thread_id >= m_core_caches.size() || m_core_cache_limit == 0) {
+            return this->Allocate();
+        }
+
+        CoreCache& cache = m_core_caches[host_thread_id];
+        if (cache.head == nullptr) {
+            cache.count = KSlabHeapImpl::AllocateList(&cache.head, (m_core_cache_limit + 1) / 2);
+            if (cache.head == nullptr) [[unlikely]] {
+                return nullptr;
+            }
+        }
+
+        Node* const obj = cache.head;
+        cache.head = obj->next;
+        --cache.count;
+        return obj;
+    }
+
+    /// Frees into the cache of the given host thread, returning the cache to the shared free
+    /// list when it is full.
+    void Free(void* obj, size_t host_thread_id) {
+        if (host_thread_id >= m_core_caches.size() || m_core_cache_limit == 0) {
+            this->Free(obj);
+            return;
+        }
+
+        // Don't allow freeing an object that wasn't allocated from this heap.
+        const bool contained = this->Contains(reinterpret_cast<uintptr_t>(obj));
+        ASSERT(contained);
+
+        CoreCache& cache = m_core_caches[host_thread_id];
+        if (cache.count == m_core_cache_limit) {
+            Node* tail = cache.head;
+            while (tail->next != nullptr) {
+                tail = tail->next;
+            }
+            KSlabHeapImpl::FreeList(cache.head, tail);
+            cache.head = nullptr;
+            cache.count = 0;
+        }
+
+        Node* const node = static_cast<Node*>(obj);
+        node->next = cache.head;
+        cache.head = node;
+        ++cache.count;
+    }
+
     size_t GetObjectIndex(const void* obj) const {
         if constexpr (SupportDynamicExpansion) {
             if (!this->Contains(reinterpret_cast<uintptr_t>(obj))) {
@@ -203,10 +300,23 @@ public:
         return obj;
     }
 
+    T* Allocate(KernelCore& kernel, size_t host_thread_id) {
+        T* obj = static_cast<T*>(BaseHeap::Allocate(host_thread_id));
+
+        if (obj != nullptr) [[likely]] {
+            std::construct_at(obj, kernel);
+        }
+        return obj;
+    }
+
     void Free(T* obj) {
         BaseHeap::Free(obj);
     }
 
+    void Free(T* obj, size_t host_thread_id) {
+        BaseHeap::Free(obj, host_thread_id);
+    }
+
     size_t GetObjectIndex(const T* obj) const {
         return BaseHeap::GetObjectIndex(obj);
     }
@@ -1,11 +1,20 @@
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include "common/spin_lock.h"
 #include "core/hle/kernel/k_spin_lock.h"
 
 namespace Kernel {
 
 void KSpinLock::Lock() {
+    // Kernel locks, above all the scheduler lock, are held for very short sections. Spinning for a
+    // while is much cheaper than putting the guest core's host thread to sleep and waking it.
+    for (u32 i = 0; i < SpinCount; ++i) {
+        if (m_lock.try_lock()) {
+            return;
+        }
+        Common::CpuRelax();
+    }
     m_lock.lock();
 }
 
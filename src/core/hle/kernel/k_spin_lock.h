@@ -6,6 +6,7 @@
 #include <mutex>
 
 #include "common/common_funcs.h"
+#include "common/common_types.h"
 #include "core/hle/kernel/k_scoped_lock.h"
 
 namespace Kernel {
@@ -22,6 +23,8 @@ public:
     bool TryLock();
 
 private:
+    static constexpr u32 SpinCount = 1000;
+
     std::mutex m_lock;
 };
 
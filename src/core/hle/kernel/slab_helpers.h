@@ -27,11 +27,11 @@ public:
     }
 
     static Derived* Allocate(KernelCore& kernel) {
-        return kernel.SlabHeap<Derived>().Allocate(kernel);
+        return kernel.SlabHeap<Derived>().Allocate(kernel, kernel.GetCurrentHostThreadID());
     }
 
     static void Free(KernelCore& kernel, Derived* obj) {
-        kernel.SlabHeap<Derived>().Free(obj);
+        kernel.SlabHeap<Derived>().Free(obj, kernel.GetCurrentHostThreadID());
     }
 
     static size_t GetObjectSize(KernelCore& kernel) {
@@ -61,11 +61,11 @@ class KAutoObjectWithSlabHeap : public Base {
 
 private:
     static Derived* Allocate(KernelCore& kernel) {
-        return kernel.SlabHeap<Derived>().Allocate(kernel);
+        return kernel.SlabHeap<Derived>().Allocate(kernel, kernel.GetCurrentHostThreadID());
     }
 
     static void Free(KernelCore& kernel, Derived* obj) {
-        kernel.SlabHeap<Derived>().Free(obj);
+        kernel.SlabHeap<Derived>().Free(obj, kernel.GetCurrentHostThreadID());
     }
 
 public:
@@ -136,11 +136,11 @@ class KAutoObjectWithSlabHeapAndContainer : public Base {
 
 private:
     static Derived* Allocate(KernelCore& kernel) {
-        return kernel.SlabHeap<Derived>().Allocate(kernel);
+        return kernel.SlabHeap<Derived>().Allocate(kernel, kernel.GetCurrentHostThreadID());
     }
 
     static void Free(KernelCore& kernel, Derived* obj) {
-        kernel.SlabHeap<Derived>().Free(obj);
+        kernel.SlabHeap<Derived>().Free(obj, kernel.GetCurrentHostThreadID());
     }
 
 public:
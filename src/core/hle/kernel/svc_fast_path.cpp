@@ -0,0 +1,25 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "core/core.h"
+#include "core/core_timing.h"
+#include "core/hle/kernel/physical_core.h"
+#include "core/hle/kernel/svc_fast_path.h"
+#include "core/hle/kernel/svc.h"
+
+namespace Kernel::Svc {
+
+std::optional<u64> CallFast(Core::System& system, u32 imm) {
+    // SVCs that synchronize or wait (WaitSynchronization, ArbitrateLock, SendSyncRequest, ...)
+    // may switch to another thread's fiber, which is not possible while the JIT is running.
+    switch (static_cast<SvcId>(imm)) {
+    case SvcId::GetSystemTick:
+        return system.CoreTiming().GetClockTicks();
+    case SvcId::GetCurrentProcessorNumber:
+        return system.CurrentPhysicalCore().CoreIndex();
+    default:
+        return std::nullopt;
+    }
+}
+
+} // namespace Kernel::Svc
@@ -0,0 +1,29 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <optional>
+
+#include "common/common_types.h"
+
+namespace Core {
+class System;
+}
+
+namespace Kernel::Svc {
+
+/**
+ * Services an SVC straight from the JIT callback, without halting the JIT and going through
+ * the regular dispatch in PhysicalCore::RunThread. Only SVCs that take no arguments, produce a
+ * single value and can never block or reschedule are eligible, so the caller only has to write
+ * the result registers back.
+ *
+ * @param system The system instance.
+ * @param imm    The SVC number.
+ *
+ * @return The value of the SVC's result, or nullopt when it must take the regular path.
+ */
+std::optional<u64> CallFast(Core::System& system, u32 imm);
+
+} // namespace Kernel::Svc
@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "common/logging.h"
+#include "common/thread.h"
+#include "core/file_sys/content_archive.h"
+#include "core/file_sys/vfs/vfs.h"
+#include "core/file_sys/vfs/vfs_vector.h"
+#include "core/hle/service/am/applet_image_cache.h"
+#include "core/loader/loader.h"
+
+namespace Service::AM {
+
+AppletImageCache::AppletImageCache() = default;
+
+AppletImageCache::~AppletImageCache() {
+    Clear();
+}
+
+FileSys::VirtualDir AppletImageCache::GetExeFS(u64 program_id,
+                                               const FileSys::VirtualFile& nca_file) {
+    if (!nca_file) {
+        return nullptr;
+    }
+
+    // The lock is held while reading, so a launch waits for a prefetch of the same image instead
+    // of reading it a second time.
+    std::scoped_lock lk{m_lock};
+    auto path = nca_file->GetFullPath();
+    const auto size = nca_file->GetSize();
+    if (const auto it = m_entries.find(program_id); it != m_entries.end()) {
+        if (it->second.path == path && it->second.size == size) {
+            return it->second.exefs;
+        }
+        m_entries.erase(it);
+    }
+
+    const FileSys::NCA nca(nca_file);
+    const auto exefs = nca.GetExeFS();
+    if (nca.GetStatus() != Loader::ResultStatus::Success || !exefs) {
+        return nullptr;
+    }
+
+    std::vector<FileSys::VirtualFile> files;
+    for (const auto& file : exefs->GetFiles()) {
+        files.push_back(
+            std::make_shared<FileSys::VectorVfsFile>(file->ReadAllBytes(), file->GetName()));
+    }
+    auto resident = std::make_shared<FileSys::VectorVfsDirectory>(
+        std::move(files), std::vector<FileSys::VirtualDir>{}, exefs->GetName());
+
+    LOG_DEBUG(Service_AM, "Keeping ExeFS of program {:016X} resident", program_id);
+    m_entries.insert_or_assign(program_id, Entry{std::move(path), size, resident});
+    return resident;
+}
+
+void AppletImageCache::Prefetch(std::vector<std::pair<u64, FileSys::VirtualFile>> programs) {
+    if (m_prefetch_thread.joinable()) {
+        m_prefetch_thread.request_stop();
+        m_prefetch_thread.join();
+    }
+    m_prefetch_thread = std::jthread([this, programs = std::move(programs)](std::stop_token token) {
+        Common::SetCurrentThreadName("AppletPrefetch");
+        Common::SetCurrentThreadPriority(Common::ThreadPriority::Low);
+        for (const auto& [program_id, nca_file] : programs) {
+            if (token.stop_requested()) {
+                return;
+            }
+            GetExeFS(program_id, nca_file);
+        }
+    });
+}
+
+void AppletImageCache::Clear() {
+    if (m_prefetch_thread.joinable()) {
+        m_prefetch_thread.request_stop();
+        m_prefetch_thread.join();
+    }
+    std::scoped_lock lk{m_lock};
+    m_entries.clear();
+}
+
+} // namespace Service::AM
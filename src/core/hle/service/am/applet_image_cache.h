@@ -0,0 +1,46 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/common_types.h"
+#include "core/file_sys/vfs/vfs_types.h"
+
+namespace Service::AM {
+
+/// Keeps the decrypted ExeFS of LLE applets in memory, so that launching an applet again does not
+/// have to go back through the NCA decryption and storage reads for its modules.
+class AppletImageCache {
+public:
+    AppletImageCache();
+    ~AppletImageCache();
+
+    /// Returns the resident ExeFS of the given program NCA, reading it in on first use.
+    /// Returns nullptr when the NCA cannot be parsed or has no ExeFS.
+    FileSys::VirtualDir GetExeFS(u64 program_id, const FileSys::VirtualFile& nca_file);
+
+    /// Reads the images of the given programs on a worker thread.
+    void Prefetch(std::vector<std::pair<u64, FileSys::VirtualFile>> programs);
+
+    /// Stops any prefetch in flight and releases all resident images.
+    void Clear();
+
+private:
+    struct Entry {
+        std::string path;
+        std::size_t size;
+        FileSys::VirtualDir exefs;
+    };
+
+    std::mutex m_lock;
+    std::map<u64, Entry> m_entries;
+    std::jthread m_prefetch_thread;
+};
+
+} // namespace Service::AM
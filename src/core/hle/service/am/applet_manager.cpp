@@ -8,6 +8,7 @@
 #include "common/uuid.h"
 #include "core/core.h"
 #include "core/core_timing.h"
+#include "core/file_sys/registered_cache.h"
 #include "core/hle/service/acc/profile_manager.h"
 #include "core/hle/service/am/applet_data_broker.h"
 #include "core/hle/service/am/applet_manager.h"
@@ -19,6 +20,7 @@
 #include "core/hle/service/am/window_system.h"
 #include "hid_core/hid_types.h"
 #include "core/hle/service/am/process_creation.h"
+#include "core/hle/service/am/service/library_applet_creator.h"
 
 namespace Service::AM {
 
@@ -260,11 +262,26 @@ void AppletManager::SetWindowSystem(WindowSystem* window_system) {
 
     m_window_system = window_system;
     if (!m_window_system) {
+        m_image_cache.Clear();
         return;
     }
 
     m_cv.wait(lk, [&] { return m_pending_process != nullptr; });
 
+    // Read the guest library applets in ahead of time, so that the first launch of each is as
+    // fast as the ones after it.
+    {
+        std::vector<std::pair<u64, FileSys::VirtualFile>> programs;
+        auto& storage = m_system.GetContentProviderUnion();
+        for (const u64 program_id : GetGuestLibraryAppletProgramIds()) {
+            auto nca_raw = storage.GetEntryRaw(program_id, FileSys::ContentRecordType::Program);
+            if (nca_raw) {
+                programs.emplace_back(program_id, std::move(nca_raw));
+            }
+        }
+        m_image_cache.Prefetch(std::move(programs));
+    }
+
     if (Settings::values.enable_overlay && m_window_system->GetOverlayDisplayApplet() == nullptr) {
         if (auto overlay_process = CreateProcess(m_system, static_cast<u64>(AppletProgramId::OverlayDisplay), 0, 0)) {
             auto overlay_applet = std::make_shared<Applet>(m_system, std::move(overlay_process), false);
@@ -10,6 +10,7 @@
 #include <mutex>
 
 #include "core/hle/service/am/am_types.h"
+#include "core/hle/service/am/applet_image_cache.h"
 
 namespace Core {
 class System;
@@ -50,6 +51,7 @@ public:
 public:
     void SetWindowSystem(WindowSystem* window_system);
     [[nodiscard]] WindowSystem* GetWindowSystem() const { return m_window_system; }
+    [[nodiscard]] AppletImageCache& GetImageCache() { return m_image_cache; }
 
 private:
     Core::System& m_system;
@@ -61,6 +63,8 @@ private:
 
     FrontendAppletParameters m_pending_parameters{};
     std::unique_ptr<Process> m_pending_process{};
+
+    AppletImageCache m_image_cache;
 };
 
 } // namespace Service::AM
@@ -11,10 +11,13 @@
 #include "core/file_sys/patch_manager.h"
 #include "core/file_sys/registered_cache.h"
 #include "core/file_sys/romfs_factory.h"
+#include "core/hle/service/am/applet_image_cache.h"
+#include "core/hle/service/am/applet_manager.h"
 #include "core/hle/service/am/process_creation.h"
 #include "core/hle/service/glue/glue_manager.h"
 #include "core/hle/service/os/process.h"
 #include "core/loader/loader.h"
+#include "core/loader/nca.h"
 
 namespace Service::AM {
 
@@ -40,9 +43,25 @@ namespace {
     }
 }
 
+[[nodiscard]] bool IsAppletProgramId(u64 program_id) {
+    return program_id >= static_cast<u64>(AppletProgramId::QLaunch) &&
+           program_id <= static_cast<u64>(AppletProgramId::MaxProgramId);
+}
+
+/// Applets are loaded again on every launch, their modules are served from the resident image
+/// cache instead of being read back out of the NCA.
+[[nodiscard]] std::unique_ptr<Loader::AppLoader> GetProgramLoader(Core::System& system, FileSys::VirtualFile file, u64 program_id, u64 program_index) {
+    if (IsAppletProgramId(program_id) && program_index == 0) {
+        if (auto exefs = system.GetAppletManager().GetImageCache().GetExeFS(program_id, file)) {
+            return std::make_unique<Loader::AppLoader_NCA>(std::move(file), std::move(exefs));
+        }
+    }
+    return Loader::GetLoader(system, std::move(file), program_id, program_index);
+}
+
 [[nodiscard]] inline std::unique_ptr<Process> CreateProcessImpl(std::unique_ptr<Loader::AppLoader>& out_loader, Loader::ResultStatus& out_load_result, Core::System& system, FileSys::VirtualFile file, u64 program_id, u64 program_index) {
     // Get the appropriate loader to parse this NCA.
-    out_loader = Loader::GetLoader(system, file, program_id, program_index);
+    out_loader = GetProgramLoader(system, file, program_id, program_index);
     // Ensure we have a loader which can parse the NCA.
     if (out_loader) {
         // Try to load the process.
@@ -120,7 +139,7 @@ bool ReinitializeProcess(Core::System& system, Process& process, u64 program_id)
         return false;
     }
 
-    auto loader = Loader::GetLoader(system, nca_raw, program_id, 0);
+    auto loader = GetProgramLoader(system, nca_raw, program_id, 0);
     if (!loader) {
         return false;
     }
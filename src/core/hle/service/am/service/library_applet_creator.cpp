@@ -22,6 +22,24 @@ namespace Service::AM {
 
 namespace {
 
+// Library applets that can be switched between the guest and frontend implementations
+#define LIBRARY_APPLET_MODES(X)                                                                    \
+    X(Cabinet, cabinet)                                                                            \
+    X(Controller, controller)                                                                      \
+    X(DataErase, data_erase)                                                                       \
+    X(Error, error)                                                                                \
+    X(NetConnect, net_connect)                                                                     \
+    X(ProfileSelect, player_select)                                                                \
+    X(SoftwareKeyboard, swkbd)                                                                     \
+    X(MiiEdit, mii_edit)                                                                           \
+    X(Web, web)                                                                                    \
+    X(Shop, shop)                                                                                  \
+    X(PhotoViewer, photo_viewer)                                                                   \
+    X(OfflineWeb, offline_web)                                                                     \
+    X(LoginShare, login_share)                                                                     \
+    X(WebAuth, wifi_web_auth)                                                                      \
+    X(MyPage, my_page)
+
 bool ShouldCreateGuestApplet(AppletId applet_id) {
 #define X(Name, name)                                                                              \
     if (applet_id == AppletId::Name &&                                                             \
@@ -29,21 +47,7 @@ bool ShouldCreateGuestApplet(AppletId applet_id) {
         return false;                                                                              \
     }
 
-    X(Cabinet, cabinet)
-    X(Controller, controller)
-    X(DataErase, data_erase)
-    X(Error, error)
-    X(NetConnect, net_connect)
-    X(ProfileSelect, player_select)
-    X(SoftwareKeyboard, swkbd)
-    X(MiiEdit, mii_edit)
-    X(Web, web)
-    X(Shop, shop)
-    X(PhotoViewer, photo_viewer)
-    X(OfflineWeb, offline_web)
-    X(LoginShare, login_share)
-    X(WebAuth, wifi_web_auth)
-    X(MyPage, my_page)
+    LIBRARY_APPLET_MODES(X)
 
 #undef X
 
@@ -168,6 +172,22 @@ std::shared_ptr<ILibraryAppletAccessor> CreateFrontendApplet(Core::System& syste
 
 } // namespace
 
+std::vector<u64> GetGuestLibraryAppletProgramIds() {
+    std::vector<u64> program_ids;
+#define X(Name, name)                                                                              \
+    if (Settings::values.name##_applet_mode.GetValue() == Settings::AppletMode::LLE) {             \
+        program_ids.push_back(static_cast<u64>(AppletIdToProgramId(AppletId::Name)));             \
+    }
+
+    LIBRARY_APPLET_MODES(X)
+
+#undef X
+
+    return program_ids;
+}
+
+#undef LIBRARY_APPLET_MODES
+
 ILibraryAppletCreator::ILibraryAppletCreator(Core::System& system_, std::shared_ptr<Applet> applet,
                                              WindowSystem& window_system)
     : ServiceFramework{system_, "ILibraryAppletCreator"},
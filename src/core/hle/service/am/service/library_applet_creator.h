@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "core/hle/service/am/am_types.h"
 #include "core/hle/service/cmif_types.h"
 #include "core/hle/service/service.h"
@@ -41,4 +43,7 @@ private:
     const std::shared_ptr<Applet> m_applet;
 };
 
+/// Returns the program IDs of the library applets that are set to run as guest processes.
+std::vector<u64> GetGuestLibraryAppletProgramIds();
+
 } // namespace Service::AM
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "common/div_ceil.h"
+#include "core/memory.h"
 
 #include "core/hle/service/cmif_types.h"
 #include "core/hle/service/ipc_helpers.h"
@@ -243,7 +244,11 @@ constexpr RequestLayout GetReplyOutLayout(bool is_domain) {
     return is_domain ? GetDomainReplyOutLayout<MethodArguments>() : GetNonDomainReplyOutLayout<MethodArguments>();
 }
 
-using OutTemporaryBuffers = std::array<Common::ScratchBuffer<u8>, 3>;
+struct OutTemporaryBuffers {
+    std::array<Common::ScratchBuffer<u8>, 3> data{};
+    // Output buffers written in place, which need no copy once the handler returns
+    std::array<std::optional<HLERequestContext::WriteBufferView>, 3> views{};
+};
 
 template <typename MethodArguments, typename CallArguments, size_t PrevAlign = 1, size_t DataOffset = 0, size_t HandleIndex = 0, size_t InBufferIndex = 0, size_t OutBufferIndex = 0, bool RawDataFinished = false, size_t ArgIndex = 0>
 void ReadInArgument(bool is_domain, CallArguments& args, const u8* raw_data, HLERequestContext& ctx, OutTemporaryBuffers& temp) {
@@ -342,16 +347,25 @@ void ReadInArgument(bool is_domain, CallArguments& args, const u8* raw_data, HLE
         } else if constexpr (ArgumentTraits<ArgType>::Type == ArgumentType::OutBuffer) {
             using ElementType = typename ArgType::Type;
 
-            // Set up scratch buffer.
-            auto& buffer = temp[OutBufferIndex];
-            if (ctx.CanWriteBuffer(OutBufferIndex)) {
-                buffer.resize_destructive(ctx.GetWriteBufferSize(OutBufferIndex));
-            } else {
+            // Large mapped buffers are written straight into guest memory, unless they alias an
+            // input the handler may still be reading.
+            constexpr bool CanWriteInPlace = (ArgType::Attr & (BufferAttr_HipcAutoSelect | BufferAttr_HipcMapAlias)) != 0;
+            auto& buffer = temp.data[OutBufferIndex];
+            auto& view = temp.views[OutBufferIndex];
+            if (!ctx.CanWriteBuffer(OutBufferIndex)) {
                 buffer.resize_destructive(0);
+            } else if (CanWriteInPlace && !ctx.WriteBufferOverlapsReadBuffers(OutBufferIndex)) {
+                if constexpr (ArgType::Attr & BufferAttr_HipcAutoSelect) {
+                    view.emplace(ctx.GetWriteBufferView(OutBufferIndex));
+                } else {
+                    view.emplace(ctx.GetWriteBufferViewB(OutBufferIndex));
+                }
+            } else {
+                buffer.resize_destructive(ctx.GetWriteBufferSize(OutBufferIndex));
             }
 
-            ElementType* ptr = (ElementType*) buffer.data();
-            size_t size = buffer.size() / sizeof(ElementType);
+            ElementType* ptr = (ElementType*) (view ? view->data() : buffer.data());
+            size_t size = (view ? view->size() : buffer.size()) / sizeof(ElementType);
 
             std::get<ArgIndex>(args) = std::span(ptr, size);
 
@@ -416,7 +430,7 @@ void WriteOutArgument(bool is_domain, CallArguments& args, u8* raw_data, HLERequ
 
             return WriteOutArgument<MethodArguments, CallArguments, PrevAlign, DataOffset, OutBufferIndex + 1, RawDataFinished, ArgIndex + 1>(is_domain, args, raw_data, ctx, temp);
         } else if constexpr (ArgumentTraits<ArgType>::Type == ArgumentType::OutBuffer) {
-            auto& buffer = temp[OutBufferIndex];
+            auto& buffer = temp.data[OutBufferIndex];
             const size_t size = buffer.size();
 
             if (size > 0 && ctx.CanWriteBuffer(OutBufferIndex)) {
@@ -166,6 +166,7 @@ private:
         if (!CheckRightsId(ctx, rights_id))
             return;
 
+        keys.DeriveTitleKeyLazy(rights_id);
         const auto key =
             keys.GetKey(Core::Crypto::S128KeyType::Titlekey, rights_id[1], rights_id[0]);
 
@@ -797,6 +797,10 @@ void LoopProcess(Core::System& system) {
     server_manager->RegisterNamedService("fsp-ldr", std::make_shared<FSP_LDR>(system));
     server_manager->RegisterNamedService("fsp:pr", std::make_shared<FSP_PR>(system));
     server_manager->RegisterNamedService("fsp-srv", std::move(FileSystemProxyFactory));
+
+    // Files and storages opened by the guest get their own sessions, so reads of unrelated files
+    // no longer wait behind each other
+    server_manager->StartHostThreadPool("FS");
     ServerManager::RunServer(std::move(server_manager));
 }
 
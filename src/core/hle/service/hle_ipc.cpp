@@ -447,6 +447,57 @@ std::size_t HLERequestContext::WriteBufferC(const void* buffer, std::size_t size
     return size;
 }
 
+HLERequestContext::WriteBufferView HLERequestContext::GetWriteBufferView(
+    std::size_t buffer_index) const {
+    const bool is_buffer_b{BufferDescriptorB().size() > buffer_index &&
+                           BufferDescriptorB()[buffer_index].Size()};
+    if (is_buffer_b) {
+        return GetWriteBufferViewB(buffer_index);
+    }
+
+    auto* const backup = buffer_index < write_buffer_data.size() ? &write_buffer_data[buffer_index]
+                                                                 : nullptr;
+    ASSERT_OR_EXECUTE_MSG(
+        BufferDescriptorC().size() > buffer_index, { return WriteBufferView(memory, 0, 0); },
+        "BufferDescriptorC invalid buffer_index {}", buffer_index);
+    return WriteBufferView(memory, BufferDescriptorC()[buffer_index].Address(),
+                           BufferDescriptorC()[buffer_index].Size(), backup);
+}
+
+HLERequestContext::WriteBufferView HLERequestContext::GetWriteBufferViewB(
+    std::size_t buffer_index) const {
+    if (buffer_index >= BufferDescriptorB().size()) {
+        return WriteBufferView(memory, 0, 0);
+    }
+
+    auto* const backup = buffer_index < write_buffer_data.size() ? &write_buffer_data[buffer_index]
+                                                                 : nullptr;
+    return WriteBufferView(memory, BufferDescriptorB()[buffer_index].Address(),
+                           BufferDescriptorB()[buffer_index].Size(), backup);
+}
+
+bool HLERequestContext::WriteBufferOverlapsReadBuffers(std::size_t buffer_index) const {
+    const bool is_buffer_b{BufferDescriptorB().size() > buffer_index &&
+                           BufferDescriptorB()[buffer_index].Size()};
+    u64 address{};
+    u64 size{};
+    if (is_buffer_b) {
+        address = BufferDescriptorB()[buffer_index].Address();
+        size = BufferDescriptorB()[buffer_index].Size();
+    } else if (BufferDescriptorC().size() > buffer_index) {
+        address = BufferDescriptorC()[buffer_index].Address();
+        size = BufferDescriptorC()[buffer_index].Size();
+    }
+
+    const auto overlaps = [address, size](u64 other_address, u64 other_size) {
+        return address < other_address + other_size && other_address < address + size;
+    };
+    return std::ranges::any_of(BufferDescriptorA(),
+                               [&](const auto& a) { return overlaps(a.Address(), a.Size()); }) ||
+           std::ranges::any_of(BufferDescriptorX(),
+                               [&](const auto& x) { return overlaps(x.Address(), x.Size()); });
+}
+
 std::size_t HLERequestContext::GetReadBufferSize(std::size_t buffer_index) const {
     const bool is_buffer_a{BufferDescriptorA().size() > buffer_index &&
                            BufferDescriptorA()[buffer_index].Size()};
@@ -20,6 +20,7 @@
 #include "common/common_types.h"
 #include "common/concepts.h"
 #include "common/swap.h"
+#include "core/guest_memory.h"
 #include "core/hle/ipc.h"
 #include "core/hle/kernel/k_handle_table.h"
 #include "core/hle/kernel/svc_common.h"
@@ -284,6 +285,22 @@ public:
     std::size_t WriteBufferC(const void* buffer, std::size_t size,
                              std::size_t buffer_index = 0) const;
 
+    /// View of an output buffer that handlers write into in place. It only goes through a copy,
+    /// written back when the view is destroyed, if the buffer is not contiguous in host memory.
+    using WriteBufferView =
+        Core::Memory::GuestMemoryScoped<Core::Memory::Memory, u8,
+                                        Core::Memory::GuestMemoryFlags::SafeWrite>;
+
+    /// Helper function to get a view of an output buffer using the appropriate buffer descriptor
+    [[nodiscard]] WriteBufferView GetWriteBufferView(std::size_t buffer_index = 0) const;
+
+    /// Helper function to get a view of buffer B
+    [[nodiscard]] WriteBufferView GetWriteBufferViewB(std::size_t buffer_index = 0) const;
+
+    /// Helper function to test whether the output buffer at buffer_index shares memory with an
+    /// input buffer, in which case writing it in place could clobber input that is still read
+    [[nodiscard]] bool WriteBufferOverlapsReadBuffers(std::size_t buffer_index = 0) const;
+
     /* Helper function to write a buffer using the appropriate buffer descriptor
      *
      * @tparam T an arbitrary container that satisfies the
@@ -414,6 +431,7 @@ private:
 
     mutable std::array<Common::ScratchBuffer<u8>, 3> read_buffer_data_a{};
     mutable std::array<Common::ScratchBuffer<u8>, 3> read_buffer_data_x{};
+    mutable std::array<Common::ScratchBuffer<u8>, 3> write_buffer_data{};
 
     std::optional<IPC::CommandHeader> command_header;
     std::optional<IPC::HandleDescriptorHeader> handle_descriptor_header;
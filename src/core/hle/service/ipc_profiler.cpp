@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <bit>
+#include <deque>
+#include <mutex>
+#include <string>
+
+#include <ankerl/unordered_dense.h>
+#include <fmt/format.h>
+
+#include "common/fs/file.h"
+#include "common/logging.h"
+#include "core/hle/service/ipc_profiler.h"
+
+namespace Service::IpcProfiler {
+
+namespace {
+
+constexpr u64 SubBucketMask = (1ULL << CommandStats::SubBucketBits) - 1;
+
+size_t BucketIndex(u64 ns) noexcept {
+    if (ns <= SubBucketMask) {
+        return static_cast<size_t>(ns);
+    }
+    // Keep the leading bit's position and the SubBucketBits bits after it
+    const size_t msb = static_cast<size_t>(std::bit_width(ns)) - 1;
+    const size_t octave = msb - CommandStats::SubBucketBits + 1;
+    const size_t sub = static_cast<size_t>((ns >> (msb - CommandStats::SubBucketBits)) &
+                                           SubBucketMask);
+    return std::min((octave << CommandStats::SubBucketBits) | sub, CommandStats::NumBuckets - 1);
+}
+
+u64 BucketUpperBound(size_t index) noexcept {
+    if (index <= SubBucketMask) {
+        return index;
+    }
+    const size_t octave = index >> CommandStats::SubBucketBits;
+    const size_t shift = octave - 1;
+    const u64 lower = ((1ULL << CommandStats::SubBucketBits) | (index & SubBucketMask)) << shift;
+    return lower + (1ULL << shift) - 1;
+}
+
+struct Registry {
+    std::mutex mutex;
+    // Deque so that handing out pointers to the elements is safe while it grows
+    std::deque<CommandStats> stats;
+    ankerl::unordered_dense::map<std::string, ankerl::unordered_dense::map<u32, CommandStats*>>
+        services;
+};
+
+Registry& GetRegistry() {
+    static Registry registry;
+    return registry;
+}
+
+} // Anonymous namespace
+
+void CommandStats::Record(u64 duration_ns, u64 bytes) noexcept {
+    total_ns.fetch_add(duration_ns, std::memory_order_relaxed);
+    latency_buckets[BucketIndex(duration_ns)].fetch_add(1, std::memory_order_relaxed);
+    if (bytes != 0) {
+        buffer_bytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+}
+
+CommandStats* GetCommandStats(const char* service_name, u32 command, const char* command_name) {
+    Registry& registry = GetRegistry();
+    std::scoped_lock lock{registry.mutex};
+    auto& commands = registry.services[service_name];
+    auto [it, inserted] = commands.try_emplace(command, nullptr);
+    if (inserted) {
+        it->second = &registry.stats.emplace_back();
+        it->second->service_name = service_name;
+        it->second->command_name = command_name;
+        it->second->command = command;
+    }
+    return it->second;
+}
+
+void Reset() {
+    Registry& registry = GetRegistry();
+    std::scoped_lock lock{registry.mutex};
+    for (CommandStats& stats : registry.stats) {
+        stats.total_ns.store(0, std::memory_order_relaxed);
+        stats.buffer_bytes.store(0, std::memory_order_relaxed);
+        for (auto& bucket : stats.latency_buckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+std::vector<CommandSummary> Snapshot() {
+    Registry& registry = GetRegistry();
+    std::scoped_lock lock{registry.mutex};
+
+    std::vector<CommandSummary> summaries;
+    for (const CommandStats& stats : registry.stats) {
+        std::array<u32, CommandStats::NumBuckets> buckets;
+        u64 calls = 0;
+        for (size_t i = 0; i < buckets.size(); ++i) {
+            buckets[i] = stats.latency_buckets[i].load(std::memory_order_relaxed);
+            calls += buckets[i];
+        }
+        if (calls == 0) {
+            continue;
+        }
+        // Smallest bucket that covers 99% of the calls
+        const u64 target = calls - calls / 100;
+        u64 seen = 0;
+        size_t p99_bucket = 0;
+        while (p99_bucket < buckets.size() - 1 && seen + buckets[p99_bucket] < target) {
+            seen += buckets[p99_bucket++];
+        }
+        summaries.push_back({
+            .service_name = stats.service_name,
+            .command_name = stats.command_name,
+            .command = stats.command,
+            .calls = calls,
+            .total_ns = stats.total_ns.load(std::memory_order_relaxed),
+            .p99_ns = BucketUpperBound(p99_bucket),
+            .buffer_bytes = stats.buffer_bytes.load(std::memory_order_relaxed),
+        });
+    }
+    std::ranges::sort(summaries, std::greater{}, &CommandSummary::total_ns);
+    return summaries;
+}
+
+bool DumpCsv(const std::filesystem::path& path) {
+    const auto summaries = Snapshot();
+    std::string out = "service,command,id,calls,total_us,p99_us,buffer_bytes\n";
+    for (const CommandSummary& summary : summaries) {
+        out += fmt::format("{},{},{},{},{:.1f},{:.1f},{}\n", summary.service_name,
+                           summary.command_name, summary.command, summary.calls,
+                           static_cast<double>(summary.total_ns) / 1000.0,
+                           static_cast<double>(summary.p99_ns) / 1000.0, summary.buffer_bytes);
+    }
+    if (Common::FS::WriteStringToFile(path, Common::FS::FileType::TextFile, out) != out.size()) {
+        LOG_ERROR(Service, "Failed to write the IPC profile to {}", path.string());
+        return false;
+    }
+    LOG_INFO(Service, "Wrote the profile of {} IPC commands to {}", summaries.size(),
+             path.string());
+    return true;
+}
+
+} // namespace Service::IpcProfiler
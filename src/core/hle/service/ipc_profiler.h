@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <filesystem>
+#include <string_view>
+#include <vector>
+
+#include "common/common_types.h"
+
+/// Always on aggregates of HLE service calls, shared by every instance of a service.
+namespace Service::IpcProfiler {
+
+/// Call statistics of one command of a service. They are never freed, so pointers to them can
+/// be kept by the handler tables.
+struct CommandStats {
+    /// Each octave of latencies is split in 1 << SubBucketBits buckets
+    static constexpr size_t SubBucketBits = 2;
+    static constexpr size_t NumBuckets = 32 << SubBucketBits;
+
+    const char* service_name;
+    const char* command_name;
+    u32 command;
+
+    std::atomic<u64> total_ns{};
+    std::atomic<u64> buffer_bytes{};
+    /// Number of calls by latency in nanoseconds, the sum is the number of calls
+    std::array<std::atomic<u32>, NumBuckets> latency_buckets{};
+
+    void Record(u64 duration_ns, u64 bytes) noexcept;
+};
+
+/// Aggregates of one command at the time of a snapshot.
+struct CommandSummary {
+    std::string_view service_name;
+    std::string_view command_name;
+    u32 command;
+    u64 calls;
+    u64 total_ns;
+    u64 p99_ns; ///< Upper bound of the latency bucket holding the 99th percentile
+    u64 buffer_bytes;
+};
+
+/// Returns the statistics of a command, creating them the first time the command is registered.
+[[nodiscard]] CommandStats* GetCommandStats(const char* service_name, u32 command,
+                                            const char* command_name);
+
+/// Clears the statistics of every command, e.g. when a new program starts.
+void Reset();
+
+/// Returns the commands that have been called at least once, by descending total time.
+[[nodiscard]] std::vector<CommandSummary> Snapshot();
+
+/// Writes the snapshot as a CSV file.
+bool DumpCsv(const std::filesystem::path& path);
+
+} // namespace Service::IpcProfiler
@@ -6,9 +6,11 @@
 
 #include <algorithm>
 #include <cstring>
+#include <span>
 #include <vector>
 #include <boost/container/static_vector.hpp>
 
+#include "common/alignment.h"
 #include "common/assert.h"
 #include "common/common_types.h"
 #include "common/logging.h"
@@ -40,16 +42,30 @@ constexpr u32 EXPECTED_MAGIC{0x36f81a1e};  // What we expect the encrypted bfttf
 constexpr u64 SHARED_FONT_MEM_SIZE{0x1100000};
 constexpr FontRegion EMPTY_REGION{0, 0};
 
-static void DecryptSharedFont(const std::span<u32 const> input, std::span<u8> output, std::size_t& offset) {
-    ASSERT(offset + (input.size() * sizeof(u32)) < SHARED_FONT_MEM_SIZE && "Shared fonts exceeds 17mb!");
-    ASSERT(input[0] == EXPECTED_MAGIC && "Failed to derive key, unexpected magic number");
-    const u32 KEY = input[0] ^ EXPECTED_RESULT; // Derive key using an inverse xor
-    std::vector<u32> transformed_font(input.size());
-    // TODO(ogniK): Figure out a better way to do this
-    std::transform(input.begin(), input.end(), transformed_font.begin(), [&KEY](u32 font_data) { return Common::swap32(font_data ^ KEY); });
-    transformed_font[1] = Common::swap32(transformed_font[1]) ^ KEY; // "re-encrypt" the size
-    std::memcpy(output.data() + offset, transformed_font.data(), transformed_font.size() * sizeof(u32));
-    offset += transformed_font.size() * sizeof(u32);
+/// Decrypts a bfttf that has been read verbatim into the font shared memory in place. Words are
+/// stored as big endian u32s xored with the key, where the first word decrypts to EXPECTED_RESULT
+/// and the second word holds the size, which is left encrypted in the shared memory.
+static void DecryptSharedFont(std::span<u8> font) {
+    const auto load = [&font](std::size_t index) {
+        u32 value;
+        std::memcpy(&value, font.data() + index * sizeof(u32), sizeof(u32));
+        return value;
+    };
+    const auto store = [&font](std::size_t index, u32 value) {
+        std::memcpy(font.data() + index * sizeof(u32), &value, sizeof(u32));
+    };
+    const std::size_t num_words = font.size() / sizeof(u32);
+    ASSERT(Common::swap32(load(0)) == EXPECTED_MAGIC &&
+           "Failed to derive key, unexpected magic number");
+    // The key is applied to the big endian words, so it can be swapped once instead of swapping
+    // every word in and out
+    const u32 key = load(0) ^ Common::swap32(EXPECTED_RESULT);
+    store(1, Common::swap32(load(1)));
+    for (std::size_t i = 0; i < num_words; ++i) {
+        if (i != 1) {
+            store(i, load(i) ^ key);
+        }
+    }
 }
 
 void DecryptSharedFontToTTF(const std::vector<u32>& input, std::vector<u8>& output) {
@@ -83,8 +99,6 @@ struct IPlatformServiceManager::Impl {
     // Automatically populated based on shared_fonts dump or system archives.
     // 6 builtin fonts + extra 2 for whatever may come after
     boost::container::static_vector<FontRegion, 8> shared_font_regions;
-    /// Backing memory for the shared font data
-    std::array<u8, SHARED_FONT_MEM_SIZE> shared_font;
 };
 
 IPlatformServiceManager::IPlatformServiceManager(Core::System& system_, const char* service_name_)
@@ -115,6 +129,8 @@ IPlatformServiceManager::IPlatformServiceManager(Core::System& system_, const ch
 
     // Attempt to load shared font data from disk
     const auto* nand = fsc.GetSystemNANDContents();
+    // Fonts are decoded directly into the font shared memory, which is handed out as-is.
+    u8* const shared_font = kernel.GetFontSharedMem().GetPointer();
     std::size_t offset = 0;
     // Rebuild shared fonts from data ncas or synthesize
     for (auto& font : SHARED_FONTS) {
@@ -144,15 +160,19 @@ IPlatformServiceManager::IPlatformServiceManager(Core::System& system_, const ch
             LOG_ERROR(Service_NS, "{:016X} has no file \"{}\"! Skipping", font.first, font.second);
             continue;
         }
-        std::vector<u32> font_data_u32(font_fp->GetSize() / sizeof(u32));
-        font_fp->ReadBytes<u32>(font_data_u32.data(), font_fp->GetSize());
-        // We need to be BigEndian as u32s for the xor encryption
-        std::transform(font_data_u32.begin(), font_data_u32.end(), font_data_u32.begin(),
-                       Common::swap32);
+        const std::size_t font_size = Common::AlignDown(font_fp->GetSize(), sizeof(u32));
+        if (font_size < 2 * sizeof(u32) || offset + font_size > SHARED_FONT_MEM_SIZE) {
+            LOG_ERROR(Service_NS, "{:016X} does not fit in the shared font memory! Skipping",
+                      font.first);
+            continue;
+        }
+        // Read straight into the shared memory and decrypt there, without staging copies
+        const std::span<u8> font_memory{shared_font + offset, font_size};
+        font_fp->ReadBytes(font_memory.data(), font_size);
+        DecryptSharedFont(font_memory);
         // Font offset and size do not account for the header
-        const FontRegion region{u32(offset + 8), u32((font_data_u32.size() * sizeof(u32)) - 8)};
-        DecryptSharedFont(font_data_u32, impl->shared_font, offset);
-        impl->shared_font_regions.push_back(region);
+        impl->shared_font_regions.push_back({u32(offset + 8), u32(font_size - 8)});
+        offset += font_size;
     }
 }
 
@@ -187,9 +207,6 @@ Result IPlatformServiceManager::GetSharedMemoryNativeHandle(OutCopyHandle<Kernel
     // Map backing memory for the font data
     LOG_DEBUG(Service_NS, "called");
 
-    // Create shared font memory object
-    std::memcpy(kernel.GetFontSharedMem().GetPointer(), impl->shared_font.data(), impl->shared_font.size());
-
     // FIXME: this shouldn't belong to the kernel
     *out_shared_memory_native_handle = &kernel.GetFontSharedMem();
     R_SUCCEED();
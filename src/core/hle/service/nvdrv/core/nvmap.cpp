@@ -6,6 +6,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include <functional>
+#include <vector>
 
 #include "common/alignment.h"
 #include "common/assert.h"
@@ -75,9 +76,10 @@ NvResult NvMap::Handle::Duplicate(bool internal_session) {
 NvMap::NvMap(Container& core_, Tegra::Host1x::Host1x& host1x_) : host1x{host1x_}, core{core_} {}
 
 void NvMap::AddHandle(std::shared_ptr<Handle> handle_description) {
-    std::scoped_lock lock(handles_lock);
+    HandleShard& shard{GetShard(handle_description->id)};
+    std::scoped_lock lock(shard.lock);
 
-    handles.emplace(handle_description->id, std::move(handle_description));
+    shard.handles.emplace(handle_description->id, std::move(handle_description));
 }
 
 void NvMap::UnmapHandle(Handle& handle_description) {
@@ -116,11 +118,12 @@ void NvMap::UnmapHandle(Handle& handle_description) {
 bool NvMap::TryRemoveHandle(const Handle& handle_description) {
     // No dupes left, we can remove from handle map
     if (handle_description.dupes == 0 && handle_description.internal_dupes == 0) {
-        std::scoped_lock lock(handles_lock);
+        HandleShard& shard{GetShard(handle_description.id)};
+        std::scoped_lock lock(shard.lock);
 
-        auto it{handles.find(handle_description.id)};
-        if (it != handles.end()) {
-            handles.erase(it);
+        auto it{shard.handles.find(handle_description.id)};
+        if (it != shard.handles.end()) {
+            shard.handles.erase(it);
         }
 
         return true;
@@ -143,21 +146,23 @@ NvResult NvMap::CreateHandle(u64 size, std::shared_ptr<NvMap::Handle>& result_ou
 }
 
 std::shared_ptr<NvMap::Handle> NvMap::GetHandle(Handle::Id handle) {
-    std::scoped_lock lock(handles_lock);
-    try {
-        return handles.at(handle);
-    } catch (std::out_of_range&) {
+    HandleShard& shard{GetShard(handle)};
+    std::shared_lock lock(shard.lock);
+    const auto it{shard.handles.find(handle)};
+    if (it == shard.handles.end()) {
         return nullptr;
     }
+    return it->second;
 }
 
 DAddr NvMap::GetHandleAddress(Handle::Id handle) {
-    std::scoped_lock lock(handles_lock);
-    try {
-        return handles.at(handle)->d_address;
-    } catch (std::out_of_range&) {
+    HandleShard& shard{GetShard(handle)};
+    std::shared_lock lock(shard.lock);
+    const auto it{shard.handles.find(handle)};
+    if (it == shard.handles.end()) {
         return 0;
     }
+    return it->second->d_address;
 }
 
 DAddr NvMap::PinHandle(NvMap::Handle::Id handle, bool low_area_pin) {
@@ -326,10 +331,11 @@ std::optional<NvMap::FreeInfo> NvMap::FreeHandle(Handle::Id handle, bool interna
 }
 
 void NvMap::UnmapAllHandles(NvCore::SessionId session_id) {
-    auto handles_copy = [&] {
-        std::scoped_lock lk{handles_lock};
-        return handles;
-    }();
+    std::vector<std::pair<Handle::Id, std::shared_ptr<Handle>>> handles_copy;
+    for (HandleShard& shard : handle_shards) {
+        std::shared_lock lk{shard.lock};
+        handles_copy.insert(handles_copy.end(), shard.handles.begin(), shard.handles.end());
+    }
 
     for (auto& [id, handle] : handles_copy) {
         {
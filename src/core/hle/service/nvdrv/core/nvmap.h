@@ -7,11 +7,13 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <shared_mutex>
 #include <ankerl/unordered_dense.h>
 #include <assert.h>
 
@@ -161,12 +163,24 @@ private:
     std::list<std::shared_ptr<Handle>> unmap_queue{};
     std::mutex unmap_queue_lock{}; //!< Protects access to `unmap_queue`
 
-    ankerl::unordered_dense::map<Handle::Id, std::shared_ptr<Handle>>
-        handles{};           //!< Main owning map of handles
-    std::mutex handles_lock; //!< Protects access to `handles`
+    /**
+     * @brief A slice of the owning handle map, handles are spread over the shards by ID so that
+     * lookups from different threads rarely wait on each other
+     */
+    struct HandleShard {
+        ankerl::unordered_dense::map<Handle::Id, std::shared_ptr<Handle>> handles{};
+        std::shared_mutex lock; //!< Protects access to `handles`
+    };
 
     static constexpr u32 HandleIdIncrement{
         4}; //!< Each new handle ID is an increment of 4 from the previous
+    static constexpr size_t NumHandleShards{16};
+    std::array<HandleShard, NumHandleShards> handle_shards{}; //!< Main owning map of handles
+
+    HandleShard& GetShard(Handle::Id handle) {
+        return handle_shards[(handle / HandleIdIncrement) % NumHandleShards];
+    }
+
     std::atomic<u32> next_handle_id{HandleIdIncrement};
     Tegra::Host1x::Host1x& host1x;
 
@@ -15,6 +15,7 @@
 #include "core/hle/service/nvdrv/devices/nvdisp_disp0.h"
 #include "core/perf_stats.h"
 #include "video_core/gpu.h"
+#include "video_core/host1x/host1x.h"
 
 namespace Service::Nvidia::Devices {
 
@@ -76,6 +77,7 @@ void nvdisp_disp0::Composite(std::span<const Nvnflinger::HwcLayer> sorted_layers
             .transform_flags = layer.transform,
             .crop_rect = layer.crop_rect,
             .blending = ConvertBlending(layer.blending),
+            .swap_interval = layer.swap_interval,
         });
 
         for (size_t i = 0; i < layer.acquire_fence.num_fences; i++) {
@@ -91,6 +93,20 @@ void nvdisp_disp0::Composite(std::span<const Nvnflinger::HwcLayer> sorted_layers
     system.GetPerfStats().BeginSystemFrame();
 }
 
+bool nvdisp_disp0::IsFenceSignaled(const android::Fence& fence) const {
+    const auto& syncpoint_manager = system.Host1x().GetSyncpointManager();
+    for (size_t i = 0; i < fence.num_fences; i++) {
+        const auto& nv_fence = fence.fences[i];
+        if (nv_fence.id < 0 || static_cast<u32>(nv_fence.id) >= MaxSyncPoints) {
+            continue;
+        }
+        if (!syncpoint_manager.IsReadyGuest(nv_fence.id, nv_fence.value)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 Kernel::KEvent* nvdisp_disp0::QueryEvent(u32 event_id) {
     LOG_CRITICAL(Service_NVDRV, "Unknown DISP Event {}", event_id);
     return nullptr;
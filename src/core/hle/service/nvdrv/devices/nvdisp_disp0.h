@@ -9,6 +9,7 @@
 #include "common/math_util.h"
 #include "core/hle/service/nvdrv/devices/nvdevice.h"
 #include "core/hle/service/nvnflinger/hwc_layer.h"
+#include "core/hle/service/nvnflinger/ui/fence.h"
 
 namespace Service::Nvidia::NvCore {
 class Container;
@@ -37,6 +38,9 @@ public:
     /// Performs a screen flip, compositing each buffer.
     void Composite(std::span<const Nvnflinger::HwcLayer> sorted_layers);
 
+    /// Checks whether the GPU has finished writing a buffer guarded by the given fence.
+    bool IsFenceSignaled(const android::Fence& fence) const;
+
     Kernel::KEvent* QueryEvent(u32 event_id) override;
 
 private:
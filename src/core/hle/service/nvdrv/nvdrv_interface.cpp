@@ -16,9 +16,22 @@
 #include "core/hle/service/nvdrv/nvdata.h"
 #include "core/hle/service/nvdrv/nvdrv.h"
 #include "core/hle/service/nvdrv/nvdrv_interface.h"
+#include "core/memory.h"
 
 namespace Service::Nvidia {
 
+namespace {
+
+/// Output ioctl buffers are written in place when they do not alias the input, which libnx and
+/// the official SDK commonly pass as the same memory.
+bool CanWriteInPlace(const HLERequestContext& ctx, Ioctl command, std::size_t buffer_index) {
+    return command.is_out != 0 && ctx.CanWriteBuffer(buffer_index) &&
+           ctx.GetWriteBufferSize(buffer_index) != 0 &&
+           !ctx.WriteBufferOverlapsReadBuffers(buffer_index);
+}
+
+} // namespace
+
 void NVDRV::Open(HLERequestContext& ctx) {
     LOG_DEBUG(Service_NVDRV, "called");
     IPC::ResponseBuilder rb{ctx, 4};
@@ -68,12 +81,18 @@ void NVDRV::Ioctl1(HLERequestContext& ctx) {
     }
 
     // Check device
-    output_buffer.resize_destructive(ctx.GetWriteBufferSize(0));
     const auto input_buffer = ctx.ReadBuffer(0);
 
-    const auto nv_result = nvdrv->Ioctl1(fd, command, input_buffer, output_buffer);
-    if (command.is_out != 0) {
-        ctx.WriteBuffer(output_buffer);
+    NvResult nv_result;
+    if (CanWriteInPlace(ctx, command, 0)) {
+        auto output = ctx.GetWriteBufferView(0);
+        nv_result = nvdrv->Ioctl1(fd, command, input_buffer, {output.data(), output.size()});
+    } else {
+        output_buffer.resize_destructive(ctx.GetWriteBufferSize(0));
+        nv_result = nvdrv->Ioctl1(fd, command, input_buffer, output_buffer);
+        if (command.is_out != 0) {
+            ctx.WriteBuffer(output_buffer);
+        }
     }
 
     IPC::ResponseBuilder rb{ctx, 3};
@@ -95,12 +114,18 @@ void NVDRV::Ioctl2(HLERequestContext& ctx) {
 
     const auto input_buffer = ctx.ReadBuffer(0);
     const auto input_inlined_buffer = ctx.ReadBuffer(1);
-    output_buffer.resize_destructive(ctx.GetWriteBufferSize(0));
 
-    const auto nv_result =
-        nvdrv->Ioctl2(fd, command, input_buffer, input_inlined_buffer, output_buffer);
-    if (command.is_out != 0) {
-        ctx.WriteBuffer(output_buffer);
+    NvResult nv_result;
+    if (CanWriteInPlace(ctx, command, 0)) {
+        auto output = ctx.GetWriteBufferView(0);
+        nv_result = nvdrv->Ioctl2(fd, command, input_buffer, input_inlined_buffer,
+                                  {output.data(), output.size()});
+    } else {
+        output_buffer.resize_destructive(ctx.GetWriteBufferSize(0));
+        nv_result = nvdrv->Ioctl2(fd, command, input_buffer, input_inlined_buffer, output_buffer);
+        if (command.is_out != 0) {
+            ctx.WriteBuffer(output_buffer);
+        }
     }
 
     IPC::ResponseBuilder rb{ctx, 3};
@@ -121,14 +146,22 @@ void NVDRV::Ioctl3(HLERequestContext& ctx) {
     }
 
     const auto input_buffer = ctx.ReadBuffer(0);
-    output_buffer.resize_destructive(ctx.GetWriteBufferSize(0));
-    inline_output_buffer.resize_destructive(ctx.GetWriteBufferSize(1));
-
-    const auto nv_result =
-        nvdrv->Ioctl3(fd, command, input_buffer, output_buffer, inline_output_buffer);
-    if (command.is_out != 0) {
-        ctx.WriteBuffer(output_buffer, 0);
-        ctx.WriteBuffer(inline_output_buffer, 1);
+
+    NvResult nv_result;
+    if (CanWriteInPlace(ctx, command, 0) && CanWriteInPlace(ctx, command, 1)) {
+        auto output = ctx.GetWriteBufferView(0);
+        auto inline_output = ctx.GetWriteBufferView(1);
+        nv_result = nvdrv->Ioctl3(fd, command, input_buffer, {output.data(), output.size()},
+                                  {inline_output.data(), inline_output.size()});
+    } else {
+        output_buffer.resize_destructive(ctx.GetWriteBufferSize(0));
+        inline_output_buffer.resize_destructive(ctx.GetWriteBufferSize(1));
+        nv_result =
+            nvdrv->Ioctl3(fd, command, input_buffer, output_buffer, inline_output_buffer);
+        if (command.is_out != 0) {
+            ctx.WriteBuffer(output_buffer, 0);
+            ctx.WriteBuffer(inline_output_buffer, 1);
+        }
     }
 
     IPC::ResponseBuilder rb{ctx, 3};
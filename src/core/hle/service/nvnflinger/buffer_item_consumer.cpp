@@ -19,15 +19,17 @@ BufferItemConsumer::BufferItemConsumer(std::shared_ptr<BufferQueueConsumer> cons
     : ConsumerBase{std::move(consumer_)} {}
 
 Status BufferItemConsumer::AcquireBuffer(BufferItem* item, std::chrono::nanoseconds present_when,
-                                         bool wait_for_fence) {
+                                         bool wait_for_fence,
+                                         const FenceSignaledCallback& is_fence_signaled) {
     if (!item) {
         return Status::BadValue;
     }
 
     std::scoped_lock lock{mutex};
 
-    if (const auto status = AcquireBufferLocked(item, present_when); status != Status::NoError) {
-        if (status != Status::NoBufferAvailable) {
+    if (const auto status = AcquireBufferLocked(item, present_when, is_fence_signaled);
+        status != Status::NoError) {
+        if (status != Status::NoBufferAvailable && status != Status::PresentLater) {
             LOG_ERROR(Service_Nvnflinger, "Failed to acquire buffer: {}", status);
         }
         return status;
@@ -21,7 +21,8 @@ class BufferItemConsumer final : public ConsumerBase {
 public:
     explicit BufferItemConsumer(std::shared_ptr<BufferQueueConsumer> consumer);
     Status AcquireBuffer(BufferItem* item, std::chrono::nanoseconds present_when,
-                         bool wait_for_fence = true);
+                         bool wait_for_fence = true,
+                         const FenceSignaledCallback& is_fence_signaled = {});
     Status ReleaseBuffer(const BufferItem& item, const Fence& release_fence);
 };
 
@@ -23,7 +23,8 @@ BufferQueueConsumer::BufferQueueConsumer(std::shared_ptr<BufferQueueCore> core_)
 BufferQueueConsumer::~BufferQueueConsumer() = default;
 
 Status BufferQueueConsumer::AcquireBuffer(BufferItem* out_buffer,
-                                          std::chrono::nanoseconds expected_present) {
+                                          std::chrono::nanoseconds expected_present,
+                                          const FenceSignaledCallback& is_fence_signaled) {
     std::scoped_lock lock{core->mutex};
 
     // Check that the consumer doesn't currently have the maximum number of buffers acquired.
@@ -89,6 +90,28 @@ Status BufferQueueConsumer::AcquireBuffer(BufferItem* out_buffer,
                   expected_present.count());
     }
 
+    // If fences can be checked, leave the front buffer queued until it has been rendered, instead
+    // of having the consumer wait for it. Once it has, skip to the newest buffer that also has.
+    if (is_fence_signaled) {
+        if (!is_fence_signaled(front->fence)) {
+            LOG_DEBUG(Service_Nvnflinger, "defer unsignaled slot={}", front->slot);
+            return Status::PresentLater;
+        }
+
+        while (core->queue.size() > 1 && is_fence_signaled(core->queue[1].fence)) {
+            LOG_DEBUG(Service_Nvnflinger, "drop signaled slot={} size={}", front->slot,
+                      core->queue.size());
+
+            if (core->StillTracking(*front)) {
+                // Front buffer is still in mSlots, so mark the slot as free
+                slots[front->slot].buffer_state = BufferState::Free;
+            }
+
+            core->queue.erase(front);
+            front = core->queue.begin();
+        }
+    }
+
     const auto slot = front->slot;
     *out_buffer = *front;
 
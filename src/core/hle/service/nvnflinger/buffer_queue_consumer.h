@@ -7,6 +7,7 @@
 #pragma once
 
 #include <chrono>
+#include <functional>
 #include <memory>
 
 #include "common/common_types.h"
@@ -20,12 +21,16 @@ class BufferItem;
 class BufferQueueCore;
 class IConsumerListener;
 
+/// Checks whether the producer has finished writing the buffer guarded by a fence.
+using FenceSignaledCallback = std::function<bool(const Fence&)>;
+
 class BufferQueueConsumer final : public IBinder {
 public:
     explicit BufferQueueConsumer(std::shared_ptr<BufferQueueCore> core_);
     ~BufferQueueConsumer() override;
 
-    Status AcquireBuffer(BufferItem* out_buffer, std::chrono::nanoseconds expected_present);
+    Status AcquireBuffer(BufferItem* out_buffer, std::chrono::nanoseconds expected_present,
+                         const FenceSignaledCallback& is_fence_signaled = {});
     Status ReleaseBuffer(s32 slot, u64 frame_number, const Fence& release_fence);
     Status Connect(std::shared_ptr<IConsumerListener> consumer_listener, bool controlled_by_app);
     Status Disconnect();
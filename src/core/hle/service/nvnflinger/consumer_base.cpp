@@ -87,8 +87,9 @@ void ConsumerBase::OnBuffersReleased() {
 
 void ConsumerBase::OnSidebandStreamChanged() {}
 
-Status ConsumerBase::AcquireBufferLocked(BufferItem* item, std::chrono::nanoseconds present_when) {
-    Status err = consumer->AcquireBuffer(item, present_when);
+Status ConsumerBase::AcquireBufferLocked(BufferItem* item, std::chrono::nanoseconds present_when,
+                                         const FenceSignaledCallback& is_fence_signaled) {
+    Status err = consumer->AcquireBuffer(item, present_when, is_fence_signaled);
     if (err != Status::NoError) {
         return err;
     }
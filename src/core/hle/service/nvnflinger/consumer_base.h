@@ -12,6 +12,7 @@
 #include <mutex>
 
 #include "common/common_types.h"
+#include "core/hle/service/nvnflinger/buffer_queue_consumer.h"
 #include "core/hle/service/nvnflinger/buffer_queue_defs.h"
 #include "core/hle/service/nvnflinger/consumer_listener.h"
 #include "core/hle/service/nvnflinger/status.h"
@@ -37,7 +38,8 @@ protected:
 
     void AbandonLocked();
     void FreeBufferLocked(s32 slot_index);
-    Status AcquireBufferLocked(BufferItem* item, std::chrono::nanoseconds present_when);
+    Status AcquireBufferLocked(BufferItem* item, std::chrono::nanoseconds present_when,
+                               const FenceSignaledCallback& is_fence_signaled = {});
     Status ReleaseBufferLocked(s32 slot, const std::shared_ptr<GraphicBuffer>& graphic_buffer);
     bool StillTracking(s32 slot, const std::shared_ptr<GraphicBuffer>& graphic_buffer) const;
     Status AddReleaseFenceLocked(s32 slot, const std::shared_ptr<GraphicBuffer>& graphic_buffer,
@@ -74,6 +74,11 @@ u32 HardwareComposer::ComposeLocked(f32* out_speed_scale, Display& display,
     std::optional<s32> swap_interval{};
     bool has_acquired_buffer{};
 
+    // Buffers still being rendered stay queued, and the current ones are shown until they are done.
+    const android::FenceSignaledCallback is_fence_signaled = [&nvdisp](const android::Fence& fence) {
+        return nvdisp.IsFenceSignaled(fence);
+    };
+
     // Acquire all necessary framebuffers.
     for (auto& layer : display.stack.layers) {
         auto consumer_id = layer->consumer_id;
@@ -93,7 +98,7 @@ u32 HardwareComposer::ComposeLocked(f32* out_speed_scale, Display& display,
 
         // Try to fetch the framebuffer (either new or stale).
         const auto result = should_try_acquire
-            ? this->CacheFramebufferLocked(*layer, consumer_id)
+            ? this->CacheFramebufferLocked(*layer, consumer_id, is_fence_signaled)
             : (m_framebuffers.find(consumer_id) != m_framebuffers.end() && m_framebuffers[consumer_id].is_acquired
                 ? CacheStatus::CachedBufferReused
                 : CacheStatus::NoBufferAvailable);
@@ -125,6 +130,7 @@ u32 HardwareComposer::ComposeLocked(f32* out_speed_scale, Display& display,
                 .transform = static_cast<android::BufferTransformFlags>(item.transform),
                 .crop_rect = item.crop,
                 .acquire_fence = item.fence,
+                .swap_interval = NormalizeSwapInterval(nullptr, item.swap_interval),
             });
         }
 
@@ -226,9 +232,12 @@ void HardwareComposer::RemoveLayerLocked(Display& display, ConsumerId consumer_i
     m_framebuffers.erase(it);
 }
 
-bool HardwareComposer::TryAcquireFramebufferLocked(Layer& layer, Framebuffer& framebuffer) {
+bool HardwareComposer::TryAcquireFramebufferLocked(
+    Layer& layer, Framebuffer& framebuffer,
+    const android::FenceSignaledCallback& is_fence_signaled) {
     // Attempt the update.
-    const auto status = layer.buffer_item_consumer->AcquireBuffer(&framebuffer.item, {}, false);
+    const auto status = layer.buffer_item_consumer->AcquireBuffer(&framebuffer.item, {}, false,
+                                                                  is_fence_signaled);
     if (status != android::Status::NoError) {
         return false;
     }
@@ -242,8 +251,9 @@ bool HardwareComposer::TryAcquireFramebufferLocked(Layer& layer, Framebuffer& fr
     return true;
 }
 
-HardwareComposer::CacheStatus HardwareComposer::CacheFramebufferLocked(Layer& layer,
-                                                                       ConsumerId consumer_id) {
+HardwareComposer::CacheStatus HardwareComposer::CacheFramebufferLocked(
+    Layer& layer, ConsumerId consumer_id,
+    const android::FenceSignaledCallback& is_fence_signaled) {
     // Check if this framebuffer is already present.
     const auto it = m_framebuffers.find(consumer_id);
     if (it != m_framebuffers.end()) {
@@ -253,7 +263,7 @@ HardwareComposer::CacheStatus HardwareComposer::CacheFramebufferLocked(Layer& la
         }
 
         // Try to acquire a new item.
-        if (this->TryAcquireFramebufferLocked(layer, it->second)) {
+        if (this->TryAcquireFramebufferLocked(layer, it->second, is_fence_signaled)) {
             // We got a new item.
             return CacheStatus::BufferAcquired;
         } else {
@@ -265,7 +275,7 @@ HardwareComposer::CacheStatus HardwareComposer::CacheFramebufferLocked(Layer& la
     // Framebuffer is not present, so try to create it.
     Framebuffer framebuffer{};
 
-    if (this->TryAcquireFramebufferLocked(layer, framebuffer)) {
+    if (this->TryAcquireFramebufferLocked(layer, framebuffer, is_fence_signaled)) {
         // Move the buffer item into a new slot.
         m_framebuffers.emplace(consumer_id, std::move(framebuffer));
 
@@ -9,6 +9,7 @@
 #include <boost/container/flat_map.hpp>
 
 #include "core/hle/service/nvnflinger/buffer_item.h"
+#include "core/hle/service/nvnflinger/buffer_queue_consumer.h"
 #include "core/hle/service/nvnflinger/display.h"
 
 namespace Service::Nvidia::Devices {
@@ -50,8 +51,10 @@ private:
     boost::container::flat_map<ConsumerId, Framebuffer> m_framebuffers{};
 
 private:
-    bool TryAcquireFramebufferLocked(Layer& layer, Framebuffer& framebuffer);
-    CacheStatus CacheFramebufferLocked(Layer& layer, ConsumerId consumer_id);
+    bool TryAcquireFramebufferLocked(Layer& layer, Framebuffer& framebuffer,
+                                     const android::FenceSignaledCallback& is_fence_signaled);
+    CacheStatus CacheFramebufferLocked(Layer& layer, ConsumerId consumer_id,
+                                       const android::FenceSignaledCallback& is_fence_signaled);
 };
 
 } // namespace Service::Nvnflinger
@@ -4,6 +4,9 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <thread>
+
 #include "common/scope_exit.h"
 
 #include "core/core.h"
@@ -253,6 +256,12 @@ void ServerManager::StartAdditionalHostThreads(const char* name, size_t num_thre
     }
 }
 
+void ServerManager::StartHostThreadPool(const char* name) {
+    // Leave most host cores to the guest CPU and GPU threads
+    const size_t num_threads = std::clamp<size_t>(std::thread::hardware_concurrency() / 4, 1, 4);
+    this->StartAdditionalHostThreads(name, num_threads);
+}
+
 Result ServerManager::LoopProcess() {
     SCOPE_EXIT {
         m_stopped.Set();
@@ -48,7 +48,13 @@ public:
     Result ManageDeferral(Kernel::KEvent** out_event);
 
     Result LoopProcess();
+
+    /// Starts more host threads waiting on this server. Sessions are spread over all threads, but
+    /// each session is only ever processed by one thread at a time and in order. Handlers shared
+    /// by several sessions stay serialised by their service lock.
     void StartAdditionalHostThreads(const char* name, size_t num_threads);
+    /// Starts additional host threads sized to the host's core count
+    void StartHostThreadPool(const char* name);
 
     static void RunServer(std::unique_ptr<ServerManager>&& server);
 
@@ -4,14 +4,18 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <iterator>
 #include <fmt/ranges.h>
 #include "common/assert.h"
 #include "common/logging.h"
 #include "common/settings.h"
+#include "common/trace.h"
 #include "core/core.h"
 #include "core/hle/ipc.h"
 #include "core/hle/kernel/kernel.h"
 #include "core/hle/service/ipc_helpers.h"
+#include "core/hle/service/ipc_profiler.h"
 #include "core/hle/service/service.h"
 #include "core/hle/service/sm/sm.h"
 #include "core/reporter.h"
@@ -42,18 +46,54 @@ ServiceFrameworkBase::~ServiceFrameworkBase() {
     const auto guard = ServiceFrameworkBase::LockService();
 }
 
+void ServiceFrameworkBase::HandlerTable::Register(const char* service_name,
+                                                  const FunctionInfoBase* new_functions,
+                                                  std::size_t n) {
+    functions.reserve(functions.size() + n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto it = std::ranges::lower_bound(functions, new_functions[i].expected_header, {},
+                                                 &FunctionInfoBase::expected_header);
+        // The first registration of an id wins
+        if (it == functions.end() || it->expected_header != new_functions[i].expected_header) {
+            const auto inserted = functions.insert(it, new_functions[i]);
+            if (inserted->handler_callback != nullptr) {
+                inserted->stats = IpcProfiler::GetCommandStats(
+                    service_name, inserted->expected_header, inserted->name);
+            }
+        }
+    }
+
+    // Usually all ids are small, so rebuild the index over the ones that are
+    const auto direct_end = std::ranges::lower_bound(functions, DirectIndexLimit, {},
+                                                     &FunctionInfoBase::expected_header);
+    const std::size_t direct_size =
+        direct_end == functions.begin() ? 0 : std::prev(direct_end)->expected_header + 1;
+    direct_index.assign(direct_size, NoIndex);
+    for (auto it = functions.begin(); it != direct_end; ++it) {
+        direct_index[it->expected_header] = static_cast<u16>(it - functions.begin());
+    }
+}
+
+const ServiceFrameworkBase::FunctionInfoBase* ServiceFrameworkBase::HandlerTable::Find(
+    u32 command) const {
+    if (command < direct_index.size()) {
+        const u16 index = direct_index[command];
+        return index == NoIndex ? nullptr : &functions[index];
+    }
+    if (command < DirectIndexLimit) {
+        return nullptr;
+    }
+    const auto it = std::ranges::lower_bound(functions, command, {},
+                                             &FunctionInfoBase::expected_header);
+    return it == functions.end() || it->expected_header != command ? nullptr : &*it;
+}
+
 void ServiceFrameworkBase::RegisterHandlersBase(const FunctionInfoBase* functions, std::size_t n) {
-    // Usually this array is sorted by id already, so hint to insert at the end
-    handlers.reserve(handlers.size() + n);
-    for (std::size_t i = 0; i < n; ++i)
-        handlers.emplace_hint(handlers.cend(), functions[i].expected_header, functions[i]);
+    handlers.Register(service_name, functions, n);
 }
 
 void ServiceFrameworkBase::RegisterHandlersBaseTipc(const FunctionInfoBase* functions, std::size_t n) {
-    // Usually this array is sorted by id already, so hint to insert at the end
-    handlers_tipc.reserve(handlers_tipc.size() + n);
-    for (std::size_t i = 0; i < n; ++i)
-        handlers_tipc.emplace_hint(handlers_tipc.cend(), functions[i].expected_header, functions[i]);
+    handlers_tipc.Register(service_name, functions, n);
 }
 
 void ServiceFrameworkBase::ReportUnimplementedFunction(HLERequestContext& ctx,
@@ -76,24 +116,46 @@ void ServiceFrameworkBase::ReportUnimplementedFunction(HLERequestContext& ctx,
     }
 }
 
+void ServiceFrameworkBase::InvokeHandler(HLERequestContext& ctx, const FunctionInfoBase& info) {
+    const u64 begin_ns = Common::Trace::Now();
+    handler_invoker(this, info.handler_callback, ctx);
+    const u64 end_ns = Common::Trace::Now();
+
+    u64 buffer_bytes = 0;
+    for (const auto& descriptor : ctx.BufferDescriptorA()) {
+        buffer_bytes += descriptor.Size();
+    }
+    for (const auto& descriptor : ctx.BufferDescriptorB()) {
+        buffer_bytes += descriptor.Size();
+    }
+    for (const auto& descriptor : ctx.BufferDescriptorX()) {
+        buffer_bytes += descriptor.Size();
+    }
+    for (const auto& descriptor : ctx.BufferDescriptorC()) {
+        buffer_bytes += descriptor.Size();
+    }
+    info.stats->Record(end_ns - begin_ns, buffer_bytes);
+    if (Common::Trace::IsEnabled()) {
+        Common::Trace::AddEvent(info.name, begin_ns, end_ns);
+    }
+}
+
 void ServiceFrameworkBase::InvokeRequest(HLERequestContext& ctx) {
-    auto it = handlers.find(ctx.GetCommand());
-    FunctionInfoBase const* info = it == handlers.end() ? nullptr : &it->second;
+    FunctionInfoBase const* info = handlers.Find(ctx.GetCommand());
     if (info == nullptr || info->handler_callback == nullptr)
         return ReportUnimplementedFunction(ctx, info);
 
     LOG_TRACE(Service, "{}", MakeFunctionString(info->name, GetServiceName(), ctx.CommandBuffer()));
-    handler_invoker(this, info->handler_callback, ctx);
+    InvokeHandler(ctx, *info);
 }
 
 void ServiceFrameworkBase::InvokeRequestTipc(HLERequestContext& ctx) {
-    auto it = handlers_tipc.find(ctx.GetCommand());
-    FunctionInfoBase const* info = it == handlers_tipc.end() ? nullptr : &it->second;
+    FunctionInfoBase const* info = handlers_tipc.Find(ctx.GetCommand());
     if (info == nullptr || info->handler_callback == nullptr)
         return ReportUnimplementedFunction(ctx, info);
 
     LOG_TRACE(Service, "{}", MakeFunctionString(info->name, GetServiceName(), ctx.CommandBuffer()));
-    handler_invoker(this, info->handler_callback, ctx);
+    InvokeHandler(ctx, *info);
 }
 
 Result ServiceFrameworkBase::HandleSyncRequest(Kernel::KServerSession& session,
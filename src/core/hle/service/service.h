@@ -8,6 +8,7 @@
 
 #include <cstddef>
 #include <mutex>
+#include <vector>
 #include <ankerl/unordered_dense.h>
 #include "common/common_types.h"
 #include "core/hle/service/hle_ipc.h"
@@ -34,6 +35,10 @@ namespace SM {
 class ServiceManager;
 }
 
+namespace IpcProfiler {
+struct CommandStats;
+}
+
 /// Default number of maximum connections to a server session.
 static constexpr u32 ServerSessionCountMax = 0x40;
 static_assert(ServerSessionCountMax == 0x40,
@@ -85,6 +90,8 @@ private:
         u32 expected_header;
         HandlerFnP<ServiceFrameworkBase> handler_callback;
         const char* name;
+        /// Filled in on registration
+        IpcProfiler::CommandStats* stats = nullptr;
     };
 
     using InvokerFn = void(ServiceFrameworkBase* object, HandlerFnP<ServiceFrameworkBase> member,
@@ -94,13 +101,30 @@ private:
                                   u32 max_sessions_, InvokerFn* handler_invoker_);
     ~ServiceFrameworkBase() override;
 
+    /// Handlers of a service sorted by command id. Ids below DirectIndexLimit, which almost every
+    /// command uses, are looked up through a direct index instead of a search.
+    class HandlerTable {
+    public:
+        void Register(const char* service_name, const FunctionInfoBase* functions,
+                      std::size_t n);
+        [[nodiscard]] const FunctionInfoBase* Find(u32 command) const;
+
+    private:
+        static constexpr u32 DirectIndexLimit = 1024;
+        static constexpr u16 NoIndex = 0xFFFF;
+
+        std::vector<FunctionInfoBase> functions;
+        std::vector<u16> direct_index;
+    };
+
     void RegisterHandlersBase(const FunctionInfoBase* functions, std::size_t n);
     void RegisterHandlersBaseTipc(const FunctionInfoBase* functions, std::size_t n);
     void ReportUnimplementedFunction(HLERequestContext& ctx, const FunctionInfoBase* info);
+    void InvokeHandler(HLERequestContext& ctx, const FunctionInfoBase& info);
 
 protected:
-    ankerl::unordered_dense::map<u32, FunctionInfoBase> handlers;
-    ankerl::unordered_dense::map<u32, FunctionInfoBase> handlers_tipc;
+    HandlerTable handlers;
+    HandlerTable handlers_tipc;
     /// Used to gain exclusive access to the service members, e.g. from CoreTiming thread.
     std::mutex lock_service;
     /// System context that the service operates under.
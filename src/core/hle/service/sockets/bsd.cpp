@@ -14,11 +14,13 @@
 #include "common/logging.h"
 #include "common/socket_types.h"
 #include "core/core.h"
+#include "core/hle/kernel/k_event.h"
 #include "core/hle/kernel/k_thread.h"
 #include "core/hle/service/ipc_helpers.h"
 #include "core/hle/service/sockets/bsd.h"
 #include "core/hle/service/sockets/sockets_translate.h"
 #include "core/internal_network/network.h"
+#include "core/internal_network/socket_monitor.h"
 #include "core/internal_network/socket_proxy.h"
 #include "core/internal_network/sockets.h"
 #include "network/network.h"
@@ -101,8 +103,6 @@ void BSD::RecvWork::Execute(BSD* bsd) {
 }
 
 void BSD::RecvWork::Response(HLERequestContext& ctx) {
-    ctx.WriteBuffer(message);
-
     IPC::ResponseBuilder rb{ctx, 4};
     rb.Push(ResultSuccess);
     rb.Push<s32>(ret);
@@ -114,7 +114,6 @@ void BSD::RecvFromWork::Execute(BSD* bsd) {
 }
 
 void BSD::RecvFromWork::Response(HLERequestContext& ctx) {
-    ctx.WriteBuffer(message, 0);
     if (!addr.empty()) {
         ctx.WriteBuffer(addr, 1);
     }
@@ -199,12 +198,39 @@ void BSD::Poll(HLERequestContext& ctx) {
 
     LOG_DEBUG(Service, "called. nfds={} timeout={}", nfds, timeout);
 
-    ExecuteWork(ctx, PollWork{
-                         .nfds = nfds,
-                         .timeout = timeout,
-                         .read_buffer = ctx.ReadBuffer(),
-                         .write_buffer = std::vector<u8>(ctx.GetWriteBufferSize()),
-                     });
+    PollWork work{
+        .nfds = nfds,
+        .timeout = timeout,
+        .read_buffer = ctx.ReadBuffer(),
+        .write_buffer = std::vector<u8>(ctx.GetWriteBufferSize()),
+    };
+
+    // Wait for the sockets without holding the service thread, then poll them without blocking.
+    // Sets with sockets that can't be watched, or invalid ones, are left to PollImpl.
+    std::vector<Network::PollFD> host_pollfds;
+    bool watchable = timeout != 0 && nfds > 0 && deferral_event != nullptr &&
+                     work.read_buffer.size() >= nfds * sizeof(PollFD);
+    for (s32 i = 0; watchable && i < nfds; i++) {
+        const auto pollfd = GetValue<PollFD>(work.read_buffer.subspan(i * sizeof(PollFD)));
+        watchable = pollfd.fd >= 0 && pollfd.fd < static_cast<s32>(MAX_FD) &&
+                    file_descriptors[pollfd.fd] &&
+                    Network::SocketMonitor::IsWatchable(file_descriptors[pollfd.fd]->socket.get());
+        if (watchable) {
+            host_pollfds.push_back({
+                .socket = file_descriptors[pollfd.fd]->socket.get(),
+                .events = Translate(pollfd.events),
+                .revents = {},
+            });
+        }
+    }
+    if (watchable) {
+        if (WaitForSockets(ctx, host_pollfds, timeout) == WaitResult::Deferred) {
+            return;
+        }
+        work.timeout = 0;
+    }
+
+    ExecuteWork(ctx, std::move(work));
 }
 
 void BSD::Accept(HLERequestContext& ctx) {
@@ -213,10 +239,11 @@ void BSD::Accept(HLERequestContext& ctx) {
 
     LOG_DEBUG(Service, "called. fd={}", fd);
 
-    ExecuteWork(ctx, AcceptWork{
-                         .fd = fd,
-                         .write_buffer = std::vector<u8>(ctx.GetWriteBufferSize()),
-                     });
+    ExecuteBlockingWork(ctx, 0,
+                        AcceptWork{
+                            .fd = fd,
+                            .write_buffer = std::vector<u8>(ctx.GetWriteBufferSize()),
+                        });
 }
 
 void BSD::Bind(HLERequestContext& ctx) {
@@ -356,11 +383,17 @@ void BSD::Recv(HLERequestContext& ctx) {
 
     LOG_DEBUG(Service, "called. fd={} flags=0x{:x} len={}", fd, flags, ctx.GetWriteBufferSize());
 
-    ExecuteWork(ctx, RecvWork{
-                         .fd = fd,
-                         .flags = flags,
-                         .message = std::vector<u8>(ctx.GetWriteBufferSize()),
-                     });
+    RecvWork work{
+        .fd = fd,
+        .flags = flags,
+    };
+    if (!WaitForBlockingWork(ctx, flags, work)) {
+        return;
+    }
+    // The view is only taken once the socket is ready, so a parked request leaves it untouched
+    auto message = ctx.GetWriteBufferView();
+    work.message = {message.data(), message.size()};
+    ExecuteWork(ctx, std::move(work));
 }
 
 void BSD::RecvFrom(HLERequestContext& ctx) {
@@ -372,12 +405,18 @@ void BSD::RecvFrom(HLERequestContext& ctx) {
     LOG_DEBUG(Service, "called. fd={} flags=0x{:x} len={} addrlen={}", fd, flags,
               ctx.GetWriteBufferSize(0), ctx.GetWriteBufferSize(1));
 
-    ExecuteWork(ctx, RecvFromWork{
-                         .fd = fd,
-                         .flags = flags,
-                         .message = std::vector<u8>(ctx.GetWriteBufferSize(0)),
-                         .addr = std::vector<u8>(ctx.GetWriteBufferSize(1)),
-                     });
+    RecvFromWork work{
+        .fd = fd,
+        .flags = flags,
+        .addr = std::vector<u8>(ctx.GetWriteBufferSize(1)),
+    };
+    if (!WaitForBlockingWork(ctx, flags, work)) {
+        return;
+    }
+    // The view is only taken once the socket is ready, so a parked request leaves it untouched
+    auto message = ctx.GetWriteBufferView(0);
+    work.message = {message.data(), message.size()};
+    ExecuteWork(ctx, std::move(work));
 }
 
 void BSD::Send(HLERequestContext& ctx) {
@@ -495,6 +534,116 @@ void BSD::ExecuteWork(HLERequestContext& ctx, Work work) {
     work.Response(ctx);
 }
 
+template <typename Work>
+void BSD::ExecuteBlockingWork(HLERequestContext& ctx, u32 flags, Work work) {
+    if (WaitForBlockingWork(ctx, flags, work)) {
+        ExecuteWork(ctx, std::move(work));
+    }
+}
+
+template <typename Work>
+bool BSD::WaitForBlockingWork(HLERequestContext& ctx, u32 flags, Work& work) {
+    if (IsBlocking(work.fd, flags)) {
+        const Network::PollFD pollfd{
+            .socket = file_descriptors[work.fd]->socket.get(),
+            .events = Network::PollEvents::In,
+            .revents = {},
+        };
+        switch (WaitForSockets(ctx, {&pollfd, 1}, -1)) {
+        case WaitResult::Deferred:
+            return false;
+        case WaitResult::Cancelled:
+            // Interrupted like the blocking host calls, or the socket was closed meanwhile
+            work.ret = -1;
+            work.bsd_errno = IsFileDescriptorValid(work.fd) ? Errno::AGAIN : Errno::BADF;
+            work.Response(ctx);
+            return false;
+        case WaitResult::Ready:
+        case WaitResult::TimedOut:
+            break;
+        }
+    }
+    return true;
+}
+
+BSD::WaitResult BSD::WaitForSockets(HLERequestContext& ctx,
+                                    std::span<const Network::PollFD> fds, s32 timeout) {
+    using Network::SocketMonitor;
+
+    std::optional<SocketMonitor::Clock::time_point> deadline;
+    {
+        std::scoped_lock lock{pending_mutex};
+        const auto it = pending_waits.find(&ctx);
+        if (it != pending_waits.end()) {
+            if (!it->second.result) {
+                // The deferred requests are all retried when any of them is ready
+                ctx.SetIsDeferred();
+                return WaitResult::Deferred;
+            }
+            const WaitResult result = *it->second.result;
+            deadline = it->second.deadline;
+            pending_waits.erase(it);
+            if (result != WaitResult::Ready) {
+                return result;
+            }
+        } else if (timeout > 0) {
+            deadline = SocketMonitor::Clock::now() + std::chrono::milliseconds(timeout);
+        }
+    }
+
+    // The socket may have been drained since it was found ready, so check it again
+    if (SocketMonitor::IsReady(fds)) {
+        return WaitResult::Ready;
+    }
+
+    // The wait is registered before the watch, which may fire right away
+    {
+        std::scoped_lock lock{pending_mutex};
+        pending_waits[&ctx] = PendingWait{.deadline = deadline};
+    }
+    const u64 watch_id = SocketMonitor::Get().Watch(
+        fds, deadline, [this, key = &ctx](SocketMonitor::Result result) {
+            {
+                std::scoped_lock lock{pending_mutex};
+                const auto it = pending_waits.find(key);
+                if (it == pending_waits.end()) {
+                    return;
+                }
+                switch (result) {
+                case SocketMonitor::Result::Ready:
+                    it->second.result = WaitResult::Ready;
+                    break;
+                case SocketMonitor::Result::TimedOut:
+                    it->second.result = WaitResult::TimedOut;
+                    break;
+                case SocketMonitor::Result::Cancelled:
+                    it->second.result = WaitResult::Cancelled;
+                    break;
+                }
+            }
+            deferral_event->Signal(system.Kernel());
+        });
+    {
+        std::scoped_lock lock{pending_mutex};
+        if (const auto it = pending_waits.find(&ctx); it != pending_waits.end()) {
+            it->second.watch_id = watch_id;
+        }
+    }
+
+    ctx.SetIsDeferred();
+    return WaitResult::Deferred;
+}
+
+bool BSD::IsBlocking(s32 fd, u32 flags) const {
+    if (deferral_event == nullptr || !IsFileDescriptorValid(fd)) {
+        return false;
+    }
+    const FileDescriptor& descriptor = *file_descriptors[fd];
+    return (descriptor.flags & Network::FLAG_O_NONBLOCK) == 0 &&
+           (flags & Network::FLAG_MSG_DONTWAIT) == 0 &&
+           Network::SocketMonitor::IsWatchable(descriptor.socket.get());
+}
+
 std::pair<s32, Errno> BSD::SocketImpl(Domain domain, Type type, Protocol protocol) {
 
     if (type == Type::SEQPACKET) {
@@ -856,7 +1005,7 @@ Errno BSD::ShutdownImpl(s32 fd, s32 how) {
     return Translate(file_descriptors[fd]->socket->Shutdown(host_how));
 }
 
-std::pair<s32, Errno> BSD::RecvImpl(s32 fd, u32 flags, std::vector<u8>& message) {
+std::pair<s32, Errno> BSD::RecvImpl(s32 fd, u32 flags, std::span<u8> message) {
     if (!IsFileDescriptorValid(fd)) {
         return {-1, Errno::BADF};
     }
@@ -883,7 +1032,7 @@ std::pair<s32, Errno> BSD::RecvImpl(s32 fd, u32 flags, std::vector<u8>& message)
     return {ret, bsd_errno};
 }
 
-std::pair<s32, Errno> BSD::RecvFromImpl(s32 fd, u32 flags, std::vector<u8>& message,
+std::pair<s32, Errno> BSD::RecvFromImpl(s32 fd, u32 flags, std::span<u8> message,
                                         std::vector<u8>& addr) {
     if (!IsFileDescriptorValid(fd)) {
         return {-1, Errno::BADF};
@@ -972,6 +1121,9 @@ Errno BSD::CloseImpl(s32 fd) {
         return Errno::BADF;
     }
 
+    // Release the requests parked on the socket before its host handle goes away
+    Network::SocketMonitor::Get().Forget(file_descriptors[fd]->socket.get());
+
     const Errno bsd_errno = Translate(file_descriptors[fd]->socket->Close());
     if (bsd_errno != Errno::SUCCESS) {
         return bsd_errno;
@@ -1052,8 +1204,8 @@ void BSD::OnProxyPacketReceived(const Network::ProxyPacket& packet) {
     }
 }
 
-BSD::BSD(Core::System& system_, const char* name)
-    : ServiceFramework{system_, name} {
+BSD::BSD(Core::System& system_, const char* name, Kernel::KEvent* deferral_event_)
+    : ServiceFramework{system_, name}, deferral_event{deferral_event_} {
     // clang-format off
     static const FunctionInfo functions[] = {
         {0, &BSD::RegisterClient, "RegisterClient"},
@@ -1119,6 +1271,17 @@ BSD::~BSD() {
     if (auto room_member = Network::GetRoomMember().lock()) {
         room_member->Unbind(proxy_packet_received);
     }
+
+    std::vector<u64> watch_ids;
+    {
+        std::scoped_lock lock{pending_mutex};
+        for (const auto& [ctx, wait] : pending_waits) {
+            watch_ids.push_back(wait.watch_id);
+        }
+    }
+    for (const u64 watch_id : watch_ids) {
+        Network::SocketMonitor::Get().Unwatch(watch_id);
+    }
 }
 
 std::unique_lock<std::mutex> BSD::LockService() noexcept {
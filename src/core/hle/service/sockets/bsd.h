@@ -5,8 +5,12 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <span>
+#include <unordered_map>
 #include <vector>
 #include <variant>
 
@@ -20,16 +24,21 @@ namespace Core {
 class System;
 }
 
+namespace Kernel {
+class KEvent;
+}
+
 namespace Network {
 class SocketBase;
 class Socket;
+struct PollFD;
 } // namespace Network
 
 namespace Service::Sockets {
 
 class BSD final : public ServiceFramework<BSD> {
 public:
-    explicit BSD(Core::System& system_, const char* name);
+    explicit BSD(Core::System& system_, const char* name, Kernel::KEvent* deferral_event_);
     ~BSD() override;
 
     // These methods are called from SSL; the first two are also called from
@@ -49,6 +58,20 @@ private:
         bool is_connection_based = false;
     };
 
+    enum class WaitResult {
+        Ready,
+        Deferred,
+        TimedOut,
+        Cancelled,
+    };
+
+    /// Blocking request parked until its sockets are ready
+    struct PendingWait {
+        u64 watch_id{};
+        std::optional<std::chrono::steady_clock::time_point> deadline;
+        std::optional<WaitResult> result;
+    };
+
     struct PollWork {
         void Execute(BSD* bsd);
         void Response(HLERequestContext& ctx);
@@ -86,7 +109,7 @@ private:
 
         s32 fd;
         u32 flags;
-        std::vector<u8> message;
+        std::span<u8> message; ///< Output buffer of the guest, received into in place
         s32 ret{};
         Errno bsd_errno{};
     };
@@ -97,7 +120,7 @@ private:
 
         s32 fd;
         u32 flags;
-        std::vector<u8> message;
+        std::span<u8> message; ///< Output buffer of the guest, received into in place
         std::vector<u8> addr;
         s32 ret{};
         Errno bsd_errno{};
@@ -154,6 +177,29 @@ private:
     template <typename Work>
     void ExecuteWork(HLERequestContext& ctx, Work work);
 
+    /// Execute a work that blocks until its socket is readable, parking the request until then
+    template <typename Work>
+    void ExecuteBlockingWork(HLERequestContext& ctx, u32 flags, Work work);
+
+    /**
+     * Wait until the socket of a work that blocks is readable, parking the request until then.
+     * @return Whether the work can be executed now, otherwise the request was deferred or the
+     *         wait was cancelled and the work already responded
+     */
+    template <typename Work>
+    bool WaitForBlockingWork(HLERequestContext& ctx, u32 flags, Work& work);
+
+    /**
+     * Wait for one of the sockets to be ready without blocking the service thread.
+     * The request is deferred until the sockets are ready, and completed again from the start.
+     * @param timeout Timeout in milliseconds, or -1 to wait forever
+     */
+    WaitResult WaitForSockets(HLERequestContext& ctx, std::span<const Network::PollFD> fds,
+                              s32 timeout);
+
+    /// Check whether a call on the file descriptor would block the service thread
+    bool IsBlocking(s32 fd, u32 flags) const;
+
     std::pair<s32, Errno> SocketImpl(Domain domain, Type type, Protocol protocol);
     std::pair<s32, Errno> PollImpl(std::vector<u8>& write_buffer, std::span<const u8> read_buffer,
                                    s32 nfds, s32 timeout);
@@ -167,8 +213,8 @@ private:
     Errno GetSockOptImpl(s32 fd, u32 level, OptName optname, std::vector<u8>& optval);
     Errno SetSockOptImpl(s32 fd, u32 level, OptName optname, std::span<const u8> optval);
     Errno ShutdownImpl(s32 fd, s32 how);
-    std::pair<s32, Errno> RecvImpl(s32 fd, u32 flags, std::vector<u8>& message);
-    std::pair<s32, Errno> RecvFromImpl(s32 fd, u32 flags, std::vector<u8>& message,
+    std::pair<s32, Errno> RecvImpl(s32 fd, u32 flags, std::span<u8> message);
+    std::pair<s32, Errno> RecvFromImpl(s32 fd, u32 flags, std::span<u8> message,
                                        std::vector<u8>& addr);
     std::pair<s32, Errno> SendImpl(s32 fd, u32 flags, std::span<const u8> message);
     std::pair<s32, Errno> SendToImpl(s32 fd, u32 flags, std::span<const u8> message,
@@ -187,6 +233,12 @@ private:
     // Callback identifier for the OnProxyPacketReceived event.
     Network::RoomMember::CallbackHandle<Network::ProxyPacket> proxy_packet_received;
 
+    /// Event of the server manager that retries the deferred requests
+    Kernel::KEvent* deferral_event;
+
+    std::mutex pending_mutex;
+    std::unordered_map<const HLERequestContext*, PendingWait> pending_waits;
+
 protected:
     std::unique_lock<std::mutex> LockService() noexcept override;
 };
@@ -12,8 +12,14 @@ namespace Service::Sockets {
 void LoopProcess(Core::System& system) {
     auto server_manager = std::make_unique<ServerManager>(system);
 
-    server_manager->RegisterNamedService("bsd:s", std::make_shared<BSD>(system, "bsd:s"));
-    server_manager->RegisterNamedService("bsd:u", std::make_shared<BSD>(system, "bsd:u"));
+    // Blocking socket calls are deferred until their sockets are ready
+    Kernel::KEvent* deferral_event{};
+    server_manager->ManageDeferral(&deferral_event);
+
+    server_manager->RegisterNamedService("bsd:s",
+                                         std::make_shared<BSD>(system, "bsd:s", deferral_event));
+    server_manager->RegisterNamedService("bsd:u",
+                                         std::make_shared<BSD>(system, "bsd:u", deferral_event));
     server_manager->RegisterNamedService("bsdcfg", std::make_shared<BSDCFG>(system));
     server_manager->RegisterNamedService("nsd:a", std::make_shared<NSD>(system, "nsd:a"));
     server_manager->RegisterNamedService("nsd:u", std::make_shared<NSD>(system, "nsd:u"));
@@ -4,7 +4,9 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <map>
 #include <mutex>
+#include <string>
 
 #include <openssl/bio.h>
 #include <openssl/err.h>
@@ -40,10 +42,18 @@ SSL_CTX* ssl_ctx;
 IOFile key_log_file; // only open if SSLKEYLOGFILE set in environment
 BIO_METHOD* bio_meth;
 
+// Sessions given by the servers, so that the next connections to them can be resumed instead of
+// doing a full handshake. They are kept by host name, and apart for the connections that skip the
+// certificate verification so that those never lend a session to a verified connection.
+constexpr size_t MaxCachedSessions = 64;
+std::mutex session_cache_mutex;
+std::map<std::string, SSL_SESSION*> session_cache;
+
 Result CheckOpenSSLErrors();
 void OneTimeInit();
 void OneTimeInitLogFile();
 bool OneTimeInitBIO();
+void OneTimeInitSessionCache();
 
 #ifdef YUZU_BUNDLED_OPENSSL
 // This is ported from httplib
@@ -120,10 +130,6 @@ inline void LoadCaCertStore(SSL_CTX* ctx, const char* ca_cert, std::size_t size)
 class SSLConnectionBackendOpenSSL final : public SSLConnectionBackend {
 public:
     Result Init() {
-        // on bundled OpenSSL, load ca cert store
-#ifdef YUZU_BUNDLED_OPENSSL
-        LoadCaCertStore(ssl_ctx, kCert, sizeof(kCert));
-#endif
         std::call_once(one_time_init_flag, OneTimeInit);
 
         if (!one_time_init_success) {
@@ -139,6 +145,7 @@ public:
         }
 
         SSL_set_connect_state(ssl);
+        SSL_set_app_data(ssl, this);
 
         bio = BIO_new(bio_meth);
         if (!bio) {
@@ -157,7 +164,8 @@ public:
         socket = std::move(socket_in);
     }
 
-    Result SetHostName(const std::string& hostname) override {
+    Result SetHostName(const std::string& hostname_in) override {
+        hostname = hostname_in;
         if (!skip_cert_verification) {
             if (!SSL_set1_host(ssl, hostname.c_str())) {
                 LOG_ERROR(Service_SSL, "SSL_set1_host({}) failed", hostname);
@@ -185,6 +193,10 @@ public:
     }
 
     Result DoHandshake() override {
+        if (!handshake_started) {
+            handshake_started = true;
+            ResumeSession();
+        }
         SSL_set_verify_result(ssl, X509_V_OK);
         const int ret = SSL_do_handshake(ssl);
 
@@ -208,6 +220,31 @@ public:
         return HandleReturn("SSL_do_handshake", 0, ret);
     }
 
+    std::string GetSessionKey() const {
+        return skip_cert_verification ? "unverified:" + hostname : hostname;
+    }
+
+    void ResumeSession() {
+        if (hostname.empty()) {
+            return;
+        }
+        std::scoped_lock lock{session_cache_mutex};
+        const auto it = session_cache.find(GetSessionKey());
+        if (it == session_cache.end()) {
+            return;
+        }
+        SSL_SESSION* const session = it->second;
+        if (SSL_SESSION_is_resumable(session) && SSL_set_session(ssl, session)) {
+            LOG_DEBUG(Service_SSL, "Resuming TLS session with {}", hostname);
+        }
+        // TLS 1.3 tickets are meant to be used once, the server sends new ones after the handshake
+        if (!SSL_SESSION_is_resumable(session) ||
+            SSL_SESSION_get_protocol_version(session) >= TLS1_3_VERSION) {
+            SSL_SESSION_free(session);
+            session_cache.erase(it);
+        }
+    }
+
     Result Read(size_t* out_size, std::span<u8> data) override {
         const int ret = SSL_read_ex(ssl, data.data(), data.size(), out_size);
         return HandleReturn("SSL_read_ex", out_size, ret);
@@ -283,6 +320,26 @@ public:
         LOG_DEBUG(Service_SSL, "Wrote to SSLKEYLOGFILE: {}", line);
     }
 
+    static int NewSessionCallback(SSL* ssl, SSL_SESSION* session) {
+        auto self = static_cast<SSLConnectionBackendOpenSSL*>(SSL_get_app_data(ssl));
+        if (!self || self->hostname.empty()) {
+            return 0;
+        }
+        std::scoped_lock lock{session_cache_mutex};
+        const auto [it, inserted] = session_cache.try_emplace(self->GetSessionKey(), session);
+        if (!inserted) {
+            SSL_SESSION_free(it->second);
+            it->second = session;
+        } else if (session_cache.size() > MaxCachedSessions) {
+            // Evict another host, the cache only has to hold the ones currently in use
+            const auto victim = it == session_cache.begin() ? std::next(it) : session_cache.begin();
+            SSL_SESSION_free(victim->second);
+            session_cache.erase(victim);
+        }
+        // Returning 1 keeps the reference OpenSSL gave us
+        return 1;
+    }
+
     static int WriteCallback(BIO* bio, const char* buf, size_t len, size_t* actual_p) {
         auto self = static_cast<SSLConnectionBackendOpenSSL*>(BIO_get_data(bio));
         ASSERT_OR_EXECUTE_MSG(
@@ -348,6 +405,8 @@ public:
     BIO* bio = nullptr;
     bool got_read_eof = false;
     bool skip_cert_verification = false;
+    bool handshake_started = false;
+    std::string hostname;
 
     std::shared_ptr<Network::SocketBase> socket;
 };
@@ -409,7 +468,13 @@ void OneTimeInit() {
         return;
     }
 
+    // on bundled OpenSSL, load ca cert store, once for all the connections
+#ifdef YUZU_BUNDLED_OPENSSL
+    LoadCaCertStore(ssl_ctx, kCert, sizeof(kCert));
+#endif
+
     OneTimeInitLogFile();
+    OneTimeInitSessionCache();
 
     if (!OneTimeInitBIO()) {
         return;
@@ -432,6 +497,13 @@ void OneTimeInitLogFile() {
     }
 }
 
+void OneTimeInitSessionCache() {
+    // OpenSSL never looks up client sessions by itself, they are handed back with SSL_set_session
+    SSL_CTX_set_session_cache_mode(ssl_ctx,
+                                   SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+    SSL_CTX_sess_set_new_cb(ssl_ctx, &SSLConnectionBackendOpenSSL::NewSessionCallback);
+}
+
 bool OneTimeInitBIO() {
     bio_meth =
         BIO_meth_new(BIO_get_new_index() | BIO_TYPE_SOURCE_SINK, "SSLConnectionBackendOpenSSL");
@@ -92,12 +92,13 @@ public:
         socket = std::move(in_socket);
     }
 
-    Result SetHostName(const std::string& hostname) override {
-        OSStatus status = SSLSetPeerDomainName(context, hostname.c_str(), hostname.size());
+    Result SetHostName(const std::string& hostname_in) override {
+        OSStatus status = SSLSetPeerDomainName(context, hostname_in.c_str(), hostname_in.size());
         if (status) {
             LOG_ERROR(Service_SSL, "SSLSetPeerDomainName failed: {}", OSStatusToString(status));
             return ResultInternalError;
         }
+        hostname = hostname_in;
         return ResultSuccess;
     }
 
@@ -111,6 +112,11 @@ public:
     }
 
     Result DoHandshake() override {
+        if (!handshake_started) {
+            handshake_started = true;
+            SetPeerID();
+        }
+
         OSStatus status = SSLHandshake(context);
 
         if (skip_cert_verification && status == errSSLServerAuthCompleted) {
@@ -121,6 +127,20 @@ public:
         return HandleReturn("SSLHandshake", 0, status);
     }
 
+    void SetPeerID() {
+        if (hostname.empty()) {
+            return;
+        }
+        // SecureTransport resumes the sessions of the earlier connections with the same peer ID.
+        // The connections that skip the certificate verification get their own sessions, so that
+        // they never lend one to a verified connection.
+        const std::string peer_id =
+            skip_cert_verification ? "unverified:" + hostname : hostname;
+        if (const OSStatus status = SSLSetPeerID(context, peer_id.data(), peer_id.size())) {
+            LOG_WARNING(Service_SSL, "SSLSetPeerID failed: {}", OSStatusToString(status));
+        }
+    }
+
     Result Read(size_t* out_size, std::span<u8> data) override {
         OSStatus status = SSLRead(context, data.data(), data.size(), out_size);
         return HandleReturn("SSLRead", out_size, status);
@@ -220,6 +240,8 @@ private:
     CFReleaser<SSLContextRef> context = nullptr;
     bool got_read_eof = false;
     bool skip_cert_verification = false;
+    bool handshake_started = false;
+    std::string hostname;
 
     std::shared_ptr<Network::SocketBase> socket;
 };
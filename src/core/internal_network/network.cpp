@@ -32,6 +32,7 @@
 #include "common/settings.h"
 #include "core/internal_network/network.h"
 #include "core/internal_network/network_interface.h"
+#include "core/internal_network/socket_monitor.h"
 #include "core/internal_network/sockets.h"
 #include "network/network.h"
 
@@ -699,10 +700,12 @@ NetworkInstance::~NetworkInstance() {
 
 void CancelPendingSocketOperations() {
     InterruptSocketOperations();
+    SocketMonitor::Get().Cancel();
 }
 
 void RestartSocketOperations() {
     AcknowledgeInterrupt();
+    SocketMonitor::Get().Restart();
 }
 
 std::optional<IPv4Address> GetHostIPv4Address() {
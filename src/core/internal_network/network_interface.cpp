@@ -2,7 +2,11 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <fstream>
+#include <mutex>
 #include <sstream>
 #include <vector>
 #include <numeric>
@@ -17,6 +21,12 @@
 #include <cerrno>
 #include <ifaddrs.h>
 #include <net/if.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#ifndef __ANDROID__
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#endif
 #elif defined(__FreeBSD__)
 #include <sys/types.h>
 #include <sys/time.h>
@@ -44,9 +54,11 @@
 
 namespace Network {
 
+namespace {
+
 #ifdef _WIN32
 
-std::vector<Network::NetworkInterface> GetAvailableNetworkInterfaces() {
+std::vector<Network::NetworkInterface> EnumerateNetworkInterfaces() {
 
     ULONG buf_size = 0;
     if (GetAdaptersAddresses(
@@ -103,7 +115,7 @@ std::vector<Network::NetworkInterface> GetAvailableNetworkInterfaces() {
 
 #else
 
-std::vector<Network::NetworkInterface> GetAvailableNetworkInterfaces() {
+std::vector<Network::NetworkInterface> EnumerateNetworkInterfaces() {
 #if defined(__ANDROID__) || defined(__linux__)
     struct ifaddrs* ifaddr = nullptr;
     if (getifaddrs(&ifaddr) != 0) {
@@ -220,6 +232,122 @@ std::vector<Network::NetworkInterface> GetAvailableNetworkInterfaces() {
 
 #endif // _WIN32
 
+/**
+ * Interfaces of the host, enumerated again when the host reports a change or, where it can't, once
+ * they are older than a second. nifm and ldn look them up on many of their calls, some titles
+ * every frame, and enumerating the adapters takes a while on some hosts.
+ */
+class InterfaceCache {
+public:
+    InterfaceCache() {
+#ifdef _WIN32
+        if (NotifyIpInterfaceChange(AF_INET, &OnInterfaceChange, this, FALSE,
+                                    &interface_notification) != NO_ERROR) {
+            interface_notification = nullptr;
+        }
+        if (NotifyUnicastIpAddressChange(AF_INET, &OnAddressChange, this, FALSE,
+                                         &address_notification) != NO_ERROR) {
+            address_notification = nullptr;
+        }
+        notified = interface_notification != nullptr && address_notification != nullptr;
+#elif defined(__linux__) && !defined(__ANDROID__)
+        netlink_fd = ::socket(AF_NETLINK, SOCK_RAW | SOCK_NONBLOCK | SOCK_CLOEXEC, NETLINK_ROUTE);
+        if (netlink_fd >= 0) {
+            sockaddr_nl addr{};
+            addr.nl_family = AF_NETLINK;
+            addr.nl_groups = RTMGRP_LINK | RTMGRP_IPV4_IFADDR | RTMGRP_IPV4_ROUTE;
+            if (::bind(netlink_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+                ::close(netlink_fd);
+                netlink_fd = -1;
+            }
+        }
+        notified = netlink_fd >= 0;
+#endif
+        if (!notified) {
+            LOG_DEBUG(Network, "No interface change notifications, refreshing them periodically");
+        }
+    }
+
+    ~InterfaceCache() {
+#ifdef _WIN32
+        if (interface_notification) {
+            CancelMibChangeNotify2(interface_notification);
+        }
+        if (address_notification) {
+            CancelMibChangeNotify2(address_notification);
+        }
+#elif defined(__linux__) && !defined(__ANDROID__)
+        if (netlink_fd >= 0) {
+            ::close(netlink_fd);
+        }
+#endif
+    }
+
+    std::vector<NetworkInterface> Get() {
+        std::scoped_lock lock{mutex};
+        const auto now = std::chrono::steady_clock::now();
+        // Notifications may be missed, so even with them the interfaces are refreshed now and then
+        const auto lifetime = notified ? NotifiedLifetime : PolledLifetime;
+        if (ConsumeChanges() || !last_refresh || now - *last_refresh >= lifetime) {
+            interfaces = EnumerateNetworkInterfaces();
+            last_refresh = now;
+        }
+        return interfaces;
+    }
+
+private:
+    static constexpr auto PolledLifetime = std::chrono::seconds{1};
+    static constexpr auto NotifiedLifetime = std::chrono::seconds{30};
+
+    bool ConsumeChanges() {
+#if defined(__linux__) && !defined(__ANDROID__)
+        if (netlink_fd >= 0) {
+            // Any message means something changed, an overrun as well
+            std::array<char, 4096> buffer;
+            while (true) {
+                const ssize_t ret = ::recv(netlink_fd, buffer.data(), buffer.size(), 0);
+                if (ret > 0 || (ret < 0 && errno == ENOBUFS)) {
+                    changed.store(true, std::memory_order_relaxed);
+                    continue;
+                }
+                break;
+            }
+        }
+#endif
+        return changed.exchange(false, std::memory_order_relaxed);
+    }
+
+#ifdef _WIN32
+    static void NETIOAPI_API_ OnInterfaceChange(PVOID context, PMIB_IPINTERFACE_ROW,
+                                                MIB_NOTIFICATION_TYPE) {
+        static_cast<InterfaceCache*>(context)->changed.store(true, std::memory_order_relaxed);
+    }
+
+    static void NETIOAPI_API_ OnAddressChange(PVOID context, PMIB_UNICASTIPADDRESS_ROW,
+                                              MIB_NOTIFICATION_TYPE) {
+        static_cast<InterfaceCache*>(context)->changed.store(true, std::memory_order_relaxed);
+    }
+
+    HANDLE interface_notification = nullptr;
+    HANDLE address_notification = nullptr;
+#elif defined(__linux__) && !defined(__ANDROID__)
+    int netlink_fd = -1;
+#endif
+
+    std::mutex mutex;
+    std::atomic_bool changed{false};
+    bool notified = false;
+    std::optional<std::chrono::steady_clock::time_point> last_refresh;
+    std::vector<NetworkInterface> interfaces;
+};
+
+} // Anonymous namespace
+
+std::vector<Network::NetworkInterface> GetAvailableNetworkInterfaces() {
+    static InterfaceCache cache;
+    return cache.Get();
+}
+
 std::optional<Network::NetworkInterface> GetSelectedNetworkInterface() {
     auto const& sel_if = Settings::values.network_interface.GetValue();
     if (auto const ifaces = Network::GetAvailableNetworkInterfaces(); ifaces.size() > 0) {
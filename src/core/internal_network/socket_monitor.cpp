@@ -0,0 +1,440 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <array>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#else
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#endif
+#endif
+
+#include "common/logging.h"
+#include "common/thread.h"
+#include "core/internal_network/socket_monitor.h"
+#include "core/internal_network/sockets.h"
+
+namespace Network {
+
+namespace {
+
+constexpr PollEvents ReadEvents = PollEvents::In | PollEvents::Pri | PollEvents::RdNorm |
+                                  PollEvents::RdBand;
+constexpr PollEvents WriteEvents = PollEvents::Out | PollEvents::WrBand;
+constexpr PollEvents ErrorEvents = PollEvents::Err | PollEvents::Hup | PollEvents::Nval;
+
+/// Reduce the events to reading and writing, which is all the host backends tell apart reliably
+PollEvents Coarsen(PollEvents events) {
+    PollEvents result{};
+    if (True(events & ReadEvents)) {
+        result |= PollEvents::In;
+    }
+    if (True(events & WriteEvents)) {
+        result |= PollEvents::Out;
+    }
+    return result | (events & ErrorEvents);
+}
+
+bool Matches(PollEvents watched, PollEvents revents) {
+    return True(revents & ErrorEvents) || True(Coarsen(watched) & Coarsen(revents));
+}
+
+#ifdef __linux__
+u32 ToNative(PollEvents events) {
+    u32 result = 0;
+    if (True(events & PollEvents::In)) {
+        result |= EPOLLIN;
+    }
+    if (True(events & PollEvents::Out)) {
+        result |= EPOLLOUT;
+    }
+    return result;
+}
+
+PollEvents FromNative(u32 events) {
+    PollEvents result{};
+    if ((events & (EPOLLIN | EPOLLPRI | EPOLLRDNORM | EPOLLRDBAND)) != 0) {
+        result |= PollEvents::In;
+    }
+    if ((events & (EPOLLOUT | EPOLLWRBAND)) != 0) {
+        result |= PollEvents::Out;
+    }
+    if ((events & EPOLLERR) != 0) {
+        result |= PollEvents::Err;
+    }
+    if ((events & EPOLLHUP) != 0) {
+        result |= PollEvents::Hup;
+    }
+    return result;
+}
+#else
+short ToNative(PollEvents events) {
+    // WSAPoll rejects the other input events
+    return static_cast<short>((True(events & PollEvents::In) ? POLLIN : 0) |
+                              (True(events & PollEvents::Out) ? POLLOUT : 0));
+}
+
+PollEvents FromNative(short events) {
+    PollEvents result{};
+    if ((events & (POLLIN | POLLPRI | POLLRDNORM | POLLRDBAND)) != 0) {
+        result |= PollEvents::In;
+    }
+    if ((events & (POLLOUT | POLLWRBAND)) != 0) {
+        result |= PollEvents::Out;
+    }
+    if ((events & POLLERR) != 0) {
+        result |= PollEvents::Err;
+    }
+    if ((events & POLLHUP) != 0) {
+        result |= PollEvents::Hup;
+    }
+    if ((events & POLLNVAL) != 0) {
+        result |= PollEvents::Nval;
+    }
+    return result;
+}
+#endif
+
+} // Anonymous namespace
+
+SocketMonitor& SocketMonitor::Get() {
+    static SocketMonitor instance;
+    return instance;
+}
+
+SocketMonitor::SocketMonitor() {
+#ifdef __linux__
+    epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.fd = wake_fd;
+    if (epoll_fd < 0 || wake_fd < 0 || epoll_ctl(epoll_fd, EPOLL_CTL_ADD, wake_fd, &event) != 0) {
+        LOG_ERROR(Network, "Failed to create the socket monitor epoll instance");
+    }
+#elif defined(_WIN32)
+    // Windows sockets can't be polled along with pipes, so a loopback socket wakes the monitor
+    wake_socket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    u_long non_block = 1;
+    if (wake_socket == INVALID_SOCKET ||
+        bind(wake_socket, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0 ||
+        ioctlsocket(wake_socket, FIONBIO, &non_block) != 0) {
+        LOG_ERROR(Network, "Failed to create the socket monitor wake socket");
+    }
+#else
+    if (pipe(wake_pipe) != 0 ||
+        fcntl(wake_pipe[0], F_SETFL, fcntl(wake_pipe[0], F_GETFL) | O_NONBLOCK) != 0) {
+        LOG_ERROR(Network, "Failed to create the socket monitor wake pipe");
+    }
+#endif
+}
+
+SocketMonitor::~SocketMonitor() {
+    if (thread.joinable()) {
+        thread.request_stop();
+        Wake();
+        thread.join();
+    }
+#ifdef __linux__
+    close(wake_fd);
+    close(epoll_fd);
+#elif defined(_WIN32)
+    closesocket(wake_socket);
+#else
+    close(wake_pipe[0]);
+    close(wake_pipe[1]);
+#endif
+}
+
+bool SocketMonitor::IsWatchable(const SocketBase* socket) {
+    return socket != nullptr && socket->GetFD() != static_cast<NativeSocket>(-1);
+}
+
+bool SocketMonitor::IsReady(std::span<const PollFD> fds) {
+    std::vector<PollFD> pollfds(fds.begin(), fds.end());
+    const auto [result, bsd_errno] = Poll(pollfds, 0);
+    return result > 0 && std::ranges::any_of(pollfds, [](const PollFD& pollfd) {
+               return True(pollfd.revents & (pollfd.events | ErrorEvents));
+           });
+}
+
+u64 SocketMonitor::Watch(std::span<const PollFD> fds, std::optional<Clock::time_point> deadline,
+                         Callback callback) {
+    std::scoped_lock lock{mutex};
+    const u64 id = next_id++;
+
+    WatchInfo info{
+        .fds = {},
+        .deadline = deadline,
+        .callback = std::move(callback),
+    };
+    info.fds.reserve(fds.size());
+    for (const PollFD& pollfd : fds) {
+        const NativeSocket fd = pollfd.socket->GetFD();
+        info.fds.emplace_back(fd, pollfd.events);
+        watches_by_fd[fd].push_back(id);
+    }
+    watches.emplace(id, std::move(info));
+    for (const PollFD& pollfd : fds) {
+        UpdateInterest(pollfd.socket->GetFD());
+    }
+
+    if (!thread.joinable()) {
+        thread = std::jthread([this](std::stop_token stop_token) { Loop(stop_token); });
+    } else {
+        Wake();
+    }
+    return id;
+}
+
+void SocketMonitor::Unwatch(u64 id) {
+    {
+        std::scoped_lock lock{mutex};
+        FiredWatches fired;
+        RemoveWatch(id, Result::Cancelled, fired);
+    }
+    // Wait for the callbacks that were already taken out of the watches
+    std::scoped_lock callback_lock{callback_mutex};
+}
+
+void SocketMonitor::Forget(const SocketBase* socket) {
+    std::unique_lock lock{mutex};
+    const auto it = watches_by_fd.find(socket->GetFD());
+    if (it == watches_by_fd.end()) {
+        return;
+    }
+    FiredWatches fired;
+    for (const u64 id : std::vector<u64>(it->second)) {
+        RemoveWatch(id, Result::Cancelled, fired);
+    }
+    RunCallbacks(lock, fired);
+}
+
+void SocketMonitor::Cancel() {
+    std::unique_lock lock{mutex};
+    interrupted = true;
+    FiredWatches fired;
+    while (!watches.empty()) {
+        RemoveWatch(watches.begin()->first, Result::Cancelled, fired);
+    }
+    RunCallbacks(lock, fired);
+}
+
+void SocketMonitor::Restart() {
+    std::scoped_lock lock{mutex};
+    interrupted = false;
+}
+
+void SocketMonitor::Loop(std::stop_token stop_token) {
+    Common::SetCurrentThreadName("SocketMonitor");
+
+    while (!stop_token.stop_requested()) {
+        int timeout_ms = -1;
+        {
+            std::unique_lock lock{mutex};
+            FiredWatches fired;
+            const auto now = Clock::now();
+            std::vector<u64> expired;
+            for (const auto& [id, info] : watches) {
+                if (interrupted || (info.deadline && *info.deadline <= now)) {
+                    expired.push_back(id);
+                } else if (info.deadline) {
+                    const auto remaining = std::chrono::ceil<std::chrono::milliseconds>(
+                        *info.deadline - now);
+                    const int remaining_ms = static_cast<int>(remaining.count());
+                    timeout_ms = timeout_ms < 0 ? remaining_ms : (std::min)(timeout_ms, remaining_ms);
+                }
+            }
+            for (const u64 id : expired) {
+                RemoveWatch(id, interrupted ? Result::Cancelled : Result::TimedOut, fired);
+            }
+            RunCallbacks(lock, fired);
+        }
+
+        const auto events = WaitForEvents(timeout_ms);
+
+        std::unique_lock lock{mutex};
+        FiredWatches fired;
+        for (const auto& [fd, revents] : events) {
+            const auto it = watches_by_fd.find(fd);
+            if (it == watches_by_fd.end()) {
+                continue;
+            }
+            for (const u64 id : std::vector<u64>(it->second)) {
+                const auto& watch_fds = watches.at(id).fds;
+                const bool ready = std::ranges::any_of(watch_fds, [&](const auto& watch_fd) {
+                    return watch_fd.first == fd && Matches(watch_fd.second, revents);
+                });
+                if (ready) {
+                    RemoveWatch(id, Result::Ready, fired);
+                }
+            }
+        }
+        RunCallbacks(lock, fired);
+    }
+}
+
+void SocketMonitor::Wake() {
+#ifdef __linux__
+    const u64 value = 1;
+    [[maybe_unused]] const auto written = write(wake_fd, &value, sizeof(value));
+#elif defined(_WIN32)
+    sockaddr_in addr{};
+    int addr_len = sizeof(addr);
+    const char value = 0;
+    if (getsockname(wake_socket, reinterpret_cast<sockaddr*>(&addr), &addr_len) == 0) {
+        sendto(wake_socket, &value, sizeof(value), 0, reinterpret_cast<const sockaddr*>(&addr),
+               addr_len);
+    }
+#else
+    const u8 value = 0;
+    [[maybe_unused]] const auto written = write(wake_pipe[1], &value, sizeof(value));
+#endif
+}
+
+std::vector<std::pair<SocketMonitor::NativeSocket, PollEvents>> SocketMonitor::WaitForEvents(
+    int timeout_ms) {
+    std::vector<std::pair<NativeSocket, PollEvents>> result;
+#ifdef __linux__
+    std::array<epoll_event, 64> events;
+    const int count = epoll_wait(epoll_fd, events.data(), static_cast<int>(events.size()),
+                                 timeout_ms);
+    for (int i = 0; i < count; i++) {
+        const int fd = events[i].data.fd;
+        if (fd == wake_fd) {
+            u64 value;
+            [[maybe_unused]] const auto read_bytes = read(wake_fd, &value, sizeof(value));
+            continue;
+        }
+        result.emplace_back(fd, FromNative(events[i].events));
+    }
+#else
+#ifdef _WIN32
+    std::vector<WSAPOLLFD> pollfds{{wake_socket, POLLIN, 0}};
+#else
+    std::vector<pollfd> pollfds{{wake_pipe[0], POLLIN, 0}};
+#endif
+    {
+        std::scoped_lock lock{mutex};
+        for (const auto& [fd, events] : interest) {
+            pollfds.push_back({fd, ToNative(events), 0});
+        }
+    }
+#ifdef _WIN32
+    const int count = WSAPoll(pollfds.data(), static_cast<ULONG>(pollfds.size()), timeout_ms);
+#else
+    const int count = poll(pollfds.data(), static_cast<nfds_t>(pollfds.size()), timeout_ms);
+#endif
+    if (count <= 0) {
+        return result;
+    }
+    if (pollfds[0].revents != 0) {
+        std::array<char, 64> buffer;
+#ifdef _WIN32
+        while (recv(wake_socket, buffer.data(), static_cast<int>(buffer.size()), 0) > 0) {
+        }
+#else
+        while (read(wake_pipe[0], buffer.data(), buffer.size()) > 0) {
+        }
+#endif
+    }
+    for (size_t i = 1; i < pollfds.size(); i++) {
+        if (pollfds[i].revents != 0) {
+            result.emplace_back(pollfds[i].fd, FromNative(pollfds[i].revents));
+        }
+    }
+#endif
+    return result;
+}
+
+void SocketMonitor::UpdateInterest(NativeSocket fd) {
+    const auto it = interest.find(fd);
+    const bool registered = it != interest.end();
+    const auto watched = watches_by_fd.find(fd);
+    if (watched == watches_by_fd.end()) {
+        if (registered) {
+            interest.erase(it);
+#ifdef __linux__
+            epoll_ctl(epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+#endif
+        }
+        return;
+    }
+
+    // Errors are reported without asking for them, a watch may only wait for those
+    PollEvents events{};
+    for (const u64 id : watched->second) {
+        for (const auto& [watch_fd, watch_events] : watches.at(id).fds) {
+            if (watch_fd == fd) {
+                events |= Coarsen(watch_events) & ~ErrorEvents;
+            }
+        }
+    }
+    if (registered && it->second == events) {
+        return;
+    }
+    interest[fd] = events;
+
+#ifdef __linux__
+    epoll_event event{};
+    event.events = ToNative(events);
+    event.data.fd = fd;
+    int result = epoll_ctl(epoll_fd, registered ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, fd, &event);
+    if (result != 0 && errno == ENOENT) {
+        result = epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event);
+    } else if (result != 0 && errno == EEXIST) {
+        result = epoll_ctl(epoll_fd, EPOLL_CTL_MOD, fd, &event);
+    }
+    if (result != 0) {
+        LOG_ERROR(Network, "Failed to watch socket fd={} errno={}", fd, errno);
+    }
+#endif
+}
+
+void SocketMonitor::RemoveWatch(u64 id, Result result, FiredWatches& fired) {
+    const auto it = watches.find(id);
+    if (it == watches.end()) {
+        return;
+    }
+    WatchInfo info = std::move(it->second);
+    watches.erase(it);
+
+    for (const auto& [fd, events] : info.fds) {
+        const auto fd_it = watches_by_fd.find(fd);
+        if (fd_it == watches_by_fd.end()) {
+            continue;
+        }
+        std::erase(fd_it->second, id);
+        if (fd_it->second.empty()) {
+            watches_by_fd.erase(fd_it);
+        }
+        UpdateInterest(fd);
+    }
+    fired.emplace_back(std::move(info.callback), result);
+}
+
+void SocketMonitor::RunCallbacks(std::unique_lock<std::mutex>& lock, FiredWatches& fired) {
+    if (fired.empty()) {
+        lock.unlock();
+        return;
+    }
+    // Unwatch waits on the callback lock, so it is taken before the watches are visibly gone
+    std::scoped_lock callback_lock{callback_mutex};
+    lock.unlock();
+    for (auto& [callback, result] : fired) {
+        callback(result);
+    }
+}
+
+} // namespace Network
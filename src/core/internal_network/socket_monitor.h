@@ -0,0 +1,126 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "common/common_types.h"
+#include "core/internal_network/network.h"
+
+namespace Network {
+
+/**
+ * Waits for the readiness of host sockets on a single host thread.
+ * Blocking guest calls register a watch and give their service thread back, instead of blocking
+ * it until the socket is ready. The sockets are watched with epoll on Linux, and with poll on the
+ * other platforms.
+ */
+class SocketMonitor {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    enum class Result {
+        Ready,
+        TimedOut,
+        Cancelled,
+    };
+
+    using Callback = std::function<void(Result)>;
+
+    static SocketMonitor& Get();
+
+    ~SocketMonitor();
+
+    SocketMonitor(const SocketMonitor&) = delete;
+    SocketMonitor& operator=(const SocketMonitor&) = delete;
+
+    /// Check whether a socket is backed by a host socket that can be watched
+    static bool IsWatchable(const SocketBase* socket);
+
+    /// Check without waiting whether one of the sockets is ready for its events
+    static bool IsReady(std::span<const PollFD> fds);
+
+    /**
+     * Call a callback once one of the sockets is ready for its events, the deadline has passed or
+     * the pending socket operations are cancelled. The callback is called from the monitor thread
+     * and must not add or remove watches from there.
+     * @param fds      Sockets to watch, they must be watchable
+     * @param deadline Time after which the callback is called with Result::TimedOut
+     * @param callback Callback called once with the result of the watch
+     * @return Identifier of the watch
+     */
+    u64 Watch(std::span<const PollFD> fds, std::optional<Clock::time_point> deadline,
+              Callback callback);
+
+    /// Remove a watch, once this returns its callback is not running and will not be called
+    void Unwatch(u64 id);
+
+    /// Cancel the watches of a socket that is about to be closed
+    void Forget(const SocketBase* socket);
+
+    /// Cancel all the watches, and the ones added until Restart is called
+    void Cancel();
+
+    /// Stop cancelling the new watches
+    void Restart();
+
+private:
+#ifdef _WIN32
+    using NativeSocket = SOCKET;
+#else
+    using NativeSocket = int;
+#endif
+
+    struct WatchInfo {
+        std::vector<std::pair<NativeSocket, PollEvents>> fds;
+        std::optional<Clock::time_point> deadline;
+        Callback callback;
+    };
+
+    using FiredWatches = std::vector<std::pair<Callback, Result>>;
+
+    SocketMonitor();
+
+    void Loop(std::stop_token stop_token);
+    void Wake();
+
+    /// Wait for readiness, returns the sockets that are ready with their events
+    std::vector<std::pair<NativeSocket, PollEvents>> WaitForEvents(int timeout_ms);
+
+    /// Update the events waited for on a socket to the ones of its watches
+    void UpdateInterest(NativeSocket fd);
+
+    void RemoveWatch(u64 id, Result result, FiredWatches& fired);
+
+    /// Call the callbacks of removed watches, releasing the lock while holding the callback lock
+    void RunCallbacks(std::unique_lock<std::mutex>& lock, FiredWatches& fired);
+
+    std::mutex mutex;
+    std::mutex callback_mutex;
+    std::unordered_map<u64, WatchInfo> watches;
+    std::unordered_map<NativeSocket, std::vector<u64>> watches_by_fd;
+    std::unordered_map<NativeSocket, PollEvents> interest;
+    bool interrupted = false;
+    u64 next_id = 1;
+
+#ifdef __linux__
+    int epoll_fd = -1;
+    int wake_fd = -1;
+#elif defined(_WIN32)
+    SOCKET wake_socket = INVALID_SOCKET;
+#else
+    int wake_pipe[2] = {-1, -1};
+#endif
+
+    std::jthread thread;
+};
+
+} // namespace Network
@@ -229,8 +229,7 @@ std::pair<s32, Errno> ProxySocket::SendTo(u32 flags, std::span<const u8> message
         }
     }
 
-    packet.data.clear();
-    std::copy(message.begin(), message.end(), std::back_inserter(packet.data));
+    packet.data.assign(message.begin(), message.end());
 
     SendPacket(packet);
 
@@ -224,6 +224,16 @@ AppLoader_DeconstructedRomDirectory::LoadResult AppLoader_DeconstructedRomDirect
             buffer.EnableDirectMappedAddress();
             return reinterpret_cast<u64>(buffer.VirtualBasePointer());
         }
+        // Dynarmic can use guest addresses as host addresses when the reservation is low enough
+        // to hold the whole guest address space where it is
+        if (is_application && Settings::IsFastmemDirectMapped() && metadata.Is64BitProgram() &&
+            (metadata.GetAddressSpaceType() == FileSys::ProgramAddressSpaceType::Is36Bit ||
+             metadata.GetAddressSpaceType() == FileSys::ProgramAddressSpaceType::Is39Bit)) {
+            auto& buffer = system.DeviceMemory().buffer;
+            if (buffer.CanDirectMapFrom(0x800'0000)) {
+                buffer.EnableDirectMappedAddress();
+            }
+        }
         return 0;
     }();
 
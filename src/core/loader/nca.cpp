@@ -33,8 +33,9 @@ static u32 CalculatePointerBufferSize(size_t heap_size) {
     }
 }
 
-AppLoader_NCA::AppLoader_NCA(FileSys::VirtualFile file_)
-    : AppLoader(std::move(file_)), nca(std::make_unique<FileSys::NCA>(file)) {}
+AppLoader_NCA::AppLoader_NCA(FileSys::VirtualFile file_, FileSys::VirtualDir resident_exefs_)
+    : AppLoader(std::move(file_)), nca(std::make_unique<FileSys::NCA>(file)),
+      resident_exefs(std::move(resident_exefs_)) {}
 
 AppLoader_NCA::~AppLoader_NCA() = default;
 
@@ -63,7 +64,7 @@ AppLoader_NCA::LoadResult AppLoader_NCA::Load(Kernel::KProcess& process, Core::S
         return {ResultStatus::ErrorNCANotProgram, {}};
     }
 
-    auto exefs = nca->GetExeFS();
+    auto exefs = resident_exefs ? resident_exefs : nca->GetExeFS();
     if (exefs == nullptr) {
         LOG_INFO(Loader, "No ExeFS found in NCA, looking for ExeFS from update");
 
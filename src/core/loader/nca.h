@@ -21,7 +21,8 @@ class AppLoader_DeconstructedRomDirectory;
 /// Loads an NCA file
 class AppLoader_NCA final : public AppLoader {
 public:
-    explicit AppLoader_NCA(FileSys::VirtualFile file_);
+    /// If resident_exefs_ is set, modules are loaded from it instead of the ExeFS of the NCA.
+    explicit AppLoader_NCA(FileSys::VirtualFile file_, FileSys::VirtualDir resident_exefs_ = {});
     ~AppLoader_NCA() override;
 
     /**
@@ -51,6 +52,7 @@ public:
 
 private:
     std::unique_ptr<FileSys::NCA> nca;
+    FileSys::VirtualDir resident_exefs;
     std::unique_ptr<AppLoader_DeconstructedRomDirectory> directory_loader;
 };
 
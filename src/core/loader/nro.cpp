@@ -271,6 +271,13 @@ static bool LoadNroImpl(Core::System& system, Kernel::KProcess& process,
             buffer.EnableDirectMappedAddress();
             return reinterpret_cast<u64>(buffer.VirtualBasePointer());
         }
+        // Homebrew uses the default 39-bit metadata, see AppLoader_DeconstructedRomDirectory
+        if (Settings::IsFastmemDirectMapped()) {
+            auto& buffer = system.DeviceMemory().buffer;
+            if (buffer.CanDirectMapFrom(0x800'0000)) {
+                buffer.EnableDirectMappedAddress();
+            }
+        }
         return 0;
     }();
 
@@ -290,7 +297,7 @@ static bool LoadNroImpl(Core::System& system, Kernel::KProcess& process,
 #ifdef HAS_NCE
     if (Settings::IsNceEnabled()) {
         patch.RelocateAndCopy(process.GetEntryPoint(), code, program_image,
-                              &process.GetPostHandlers());
+                              &process.GetPostHandlers(), &process.GetFaultSitePatcher());
     }
 #endif
 
@@ -5,8 +5,10 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <array>
 #include <cinttypes>
 #include <cstring>
+#include <future>
 #include <vector>
 
 #include "common/common_funcs.h"
@@ -97,23 +99,40 @@ std::optional<VAddr> AppLoader_NSO::LoadModule(Kernel::KProcess& process, Core::
     Kernel::CodeSet codeset;
     codeset.memory.resize(module_start + last_segment_it->location + last_segment_it->size);
     {
-        std::vector<u8> compressed_data(*std::ranges::max_element(nso_header.segments_compressed_size));
-        std::vector<u8> decompressed_size(std::ranges::max_element(nso_header.segments, [](auto const& a, auto const& b) {
-            return a.size < b.size;
-        })->size);
+        // Read the segments serially, the file may sit behind storages shared with other readers.
+        // Segments are disjoint in the image, so they are then decompressed in parallel into it.
+        std::array<std::vector<u8>, std::tuple_size_v<decltype(nso_header.segments)>> compressed_data;
         for (std::size_t i = 0; i < nso_header.segments.size(); ++i) {
-            nso_file.Read(compressed_data.data(), nso_header.segments_compressed_size[i], nso_header.segments[i].offset);
+            u8* const dst = codeset.memory.data() + module_start + nso_header.segments[i].location;
             if (nso_header.IsSegmentCompressed(i)) {
-                int r = Common::Compression::DecompressDataLZ4(decompressed_size.data(), nso_header.segments[i].size, compressed_data.data(), nso_header.segments_compressed_size[i]);
-                ASSERT(r == int(nso_header.segments[i].size));
-                std::memcpy(codeset.memory.data() + module_start + nso_header.segments[i].location, decompressed_size.data(), nso_header.segments[i].size);
+                compressed_data[i].resize(nso_header.segments_compressed_size[i]);
+                nso_file.Read(compressed_data[i].data(), compressed_data[i].size(), nso_header.segments[i].offset);
             } else {
-                std::memcpy(codeset.memory.data() + module_start + nso_header.segments[i].location, compressed_data.data(), nso_header.segments[i].size);
+                nso_file.Read(dst, nso_header.segments[i].size, nso_header.segments[i].offset);
             }
             codeset.segments[i].addr = module_start + nso_header.segments[i].location;
             codeset.segments[i].offset = module_start + nso_header.segments[i].location;
             codeset.segments[i].size = nso_header.segments[i].size;
         }
+        const auto decompress_segment = [&](std::size_t i) {
+            u8* const dst = codeset.memory.data() + module_start + nso_header.segments[i].location;
+            int r = Common::Compression::DecompressDataLZ4(dst, nso_header.segments[i].size, compressed_data[i].data(), compressed_data[i].size());
+            ASSERT(r == int(nso_header.segments[i].size));
+        };
+        std::array<std::future<void>, std::tuple_size_v<decltype(nso_header.segments)>> pending;
+        for (std::size_t i = 1; i < nso_header.segments.size(); ++i) {
+            if (nso_header.IsSegmentCompressed(i)) {
+                pending[i] = std::async(std::launch::async, decompress_segment, i);
+            }
+        }
+        if (nso_header.IsSegmentCompressed(0)) {
+            decompress_segment(0);
+        }
+        for (auto& segment : pending) {
+            if (segment.valid()) {
+                segment.get();
+            }
+        }
     }
 
     if (should_pass_arguments && !Settings::values.program_args.GetValue().empty()) {
@@ -165,7 +184,8 @@ std::optional<VAddr> AppLoader_NSO::LoadModule(Kernel::KProcess& process, Core::
         // Relocate code patch and copy to the program image.
         // Save size before RelocateAndCopy (which may resize)
         const size_t size_before_relocate = codeset.memory.size();
-        if (patch->RelocateAndCopy(load_base, code, codeset.memory, &process.GetPostHandlers())) {
+        if (patch->RelocateAndCopy(load_base, code, codeset.memory, &process.GetPostHandlers(),
+                                   &process.GetFaultSitePatcher())) {
             // Update patch section.
             auto& patch_segment = codeset.PatchSegment();
             auto& post_patch_segment = codeset.PostPatchSegment();
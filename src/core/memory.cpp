@@ -48,6 +48,9 @@ struct Memory::Impl {
     explicit Impl(Core::System& system_) : system{system_} {}
 
     void SetCurrentPageTable(Kernel::KProcess& process) {
+        // Pending host operations target the arena of the outgoing page table.
+        FlushHostMappings();
+
         current_page_table = &process.GetPageTable().GetImpl();
 
         if (process.IsApplication() && Settings::IsFastmemEnabled()) {
@@ -75,7 +78,14 @@ struct Memory::Impl {
                  Common::PageType::Memory);
 
         if (current_page_table->fastmem_arena) {
-            host_buffer->Map(GetInteger(base), GetInteger(target) - DramMemoryMap::Base, size, perms, separate_heap);
+            QueueHostMapping({
+                .type = HostMappingType::Map,
+                .perms = perms,
+                .separate_heap = separate_heap,
+                .virtual_offset = GetInteger(base),
+                .host_offset = GetInteger(target) - DramMemoryMap::Base,
+                .length = size,
+            });
         }
     }
 
@@ -87,7 +97,12 @@ struct Memory::Impl {
                  Common::PageType::Unmapped);
 
         if (current_page_table->fastmem_arena) {
-            host_buffer->Unmap(GetInteger(base), size, separate_heap);
+            QueueHostMapping({
+                .type = HostMappingType::Unmap,
+                .separate_heap = separate_heap,
+                .virtual_offset = GetInteger(base),
+                .length = size,
+            });
         }
     }
 
@@ -96,30 +111,19 @@ struct Memory::Impl {
         ASSERT_MSG((size & YUZU_PAGEMASK) == 0, "non-page aligned size: {:016X}", size);
         ASSERT_MSG((vaddr & YUZU_PAGEMASK) == 0, "non-page aligned base: {:016X}", vaddr);
 
-        if (!current_page_table->fastmem_arena) {
-            return;
-        }
-
-        u64 protect_bytes = 0, protect_begin = 0;
-        for (u64 addr = vaddr; addr < vaddr + size; addr += YUZU_PAGESIZE) {
-            const Common::PageType page_type = current_page_table->entries[addr >> YUZU_PAGEBITS].ptr.Type();
-            switch (page_type) {
-            case Common::PageType::RasterizerCachedMemory:
-                if (protect_bytes > 0) {
-                    host_buffer->Protect(protect_begin, protect_bytes, perms);
-                    protect_bytes = 0;
-                }
-                break;
-            default:
-                if (protect_bytes == 0)
-                    protect_begin = addr;
-                protect_bytes += YUZU_PAGESIZE;
-            }
+        if (current_page_table->fastmem_arena) {
+            QueueHostMapping({
+                .type = HostMappingType::Protect,
+                .perms = perms,
+                .virtual_offset = vaddr,
+                .length = size,
+            });
         }
+    }
 
-        if (protect_bytes > 0) {
-            host_buffer->Protect(protect_begin, protect_bytes, perms);
-        }
+    void FlushHostMappings() {
+        std::scoped_lock lk{host_mapping_guard};
+        FlushHostMappingsLocked();
     }
 
     [[nodiscard]] u8* GetPointerFromRasterizerCachedMemory(u64 vaddr) const {
@@ -232,6 +236,30 @@ struct Memory::Impl {
         return string;
     }
 
+    /// Returns how many of the next max_pages pages, starting at page_index, can be handled in one
+    /// step together with the first one, whose raw page info is first_raw.
+    /// Accessible pages join the run while they stay of the same type and contiguous in host memory.
+    [[nodiscard]] std::size_t ContiguousPageRun(std::size_t page_index, std::size_t max_pages, uintptr_t first_raw) const noexcept {
+        const auto& entries = current_page_table->entries;
+        const auto type = Common::PageTable::PageInfo::ExtractType(first_raw);
+        if (type == Common::PageType::RasterizerCachedMemory) {
+            // The rasterizer resolves device addresses one page at a time
+            return 1;
+        }
+        // Memory pages store their host pointer relative to the page address, and debug pages
+        // do the same with their physical address, so contiguous pages share the same value.
+        const u64 first_addr = entries[page_index].addr;
+        std::size_t count = 1;
+        while (count < max_pages) {
+            const auto& entry = entries[page_index + count];
+            if (entry.ptr.Raw() != first_raw || (type == Common::PageType::DebugMemory && entry.addr != first_addr)) {
+                break;
+            }
+            ++count;
+        }
+        return count;
+    }
+
     template<typename F1, typename F2, typename F3>
     inline bool WalkBlock(const Common::ProcessAddress addr, const std::size_t size, F1&& on_unmapped, F2&& on_memory, F3&& on_rasterizer) {
         std::size_t offset = 0;
@@ -244,10 +272,13 @@ struct Memory::Impl {
         std::size_t page_offset = addr & YUZU_PAGEMASK;
         bool user_accessible = true;
         while (remaining_size != 0) {
-            const std::size_t copy_amount = (std::min)(std::size_t(YUZU_PAGESIZE) - page_offset, remaining_size);
+            const uintptr_t raw = current_page_table->entries[page_index].ptr.Raw();
+            const std::size_t max_pages = ((page_offset + remaining_size - 1) >> YUZU_PAGEBITS) + 1;
+            const std::size_t run_pages = ContiguousPageRun(page_index, max_pages, raw);
+            const std::size_t copy_amount = (std::min)((run_pages << YUZU_PAGEBITS) - page_offset, remaining_size);
             const auto current_vaddr = u64((page_index << YUZU_PAGEBITS) + page_offset);
-            const auto [pointer, type] = current_page_table->entries[page_index].ptr.PointerType();
-            switch (type) {
+            const uintptr_t pointer = Common::PageTable::PageInfo::ExtractPointer(raw);
+            switch (Common::PageTable::PageInfo::ExtractType(raw)) {
             case Common::PageType::Unmapped: {
                 user_accessible = false;
                 on_unmapped(offset, copy_amount, current_vaddr);
@@ -271,7 +302,7 @@ struct Memory::Impl {
             default:
                 UNREACHABLE();
             }
-            page_index++;
+            page_index += run_pages;
             page_offset = 0;
             offset += copy_amount;
             remaining_size -= copy_amount;
@@ -397,6 +428,8 @@ struct Memory::Impl {
         if (current_page_table->fastmem_arena) {
             const auto perm{debug ? Common::MemoryPermission{}
                                   : Common::MemoryPermission::ReadWrite};
+            std::scoped_lock lk{host_mapping_guard};
+            FlushHostMappingsLocked();
             host_buffer->Protect(vaddr, size, perm);
         }
 
@@ -457,6 +490,8 @@ struct Memory::Impl {
             if (!cached) {
                 perm |= Common::MemoryPermission::Write;
             }
+            std::scoped_lock lk{host_mapping_guard};
+            FlushHostMappingsLocked();
             host_buffer->Protect(vaddr, size, perm);
         }
 
@@ -758,6 +793,97 @@ struct Memory::Impl {
             p, scratch_buffers[core], [&](DAddr address) { gpu.InvalidateRegion(address, size); });
     }
 
+    enum class HostMappingType : u8 {
+        Map,
+        Unmap,
+        Protect,
+    };
+
+    struct HostMapping {
+        HostMappingType type;
+        Common::MemoryPermission perms{};
+        bool separate_heap{};
+        size_t virtual_offset;
+        size_t host_offset{};
+        size_t length;
+    };
+
+    /// Defers a host mapping change until the next flush, merging it into the previous change
+    /// when both are of the same kind and continue each other
+    void QueueHostMapping(const HostMapping& mapping) {
+        std::scoped_lock lk{host_mapping_guard};
+        if (!pending_host_mappings.empty()) {
+            HostMapping& last = pending_host_mappings.back();
+            const bool contiguous = last.type == mapping.type &&
+                                    last.separate_heap == mapping.separate_heap &&
+                                    last.virtual_offset + last.length == mapping.virtual_offset;
+            switch (mapping.type) {
+            case HostMappingType::Map:
+                if (contiguous && last.perms == mapping.perms &&
+                    last.host_offset + last.length == mapping.host_offset) {
+                    last.length += mapping.length;
+                    return;
+                }
+                break;
+            case HostMappingType::Unmap:
+                if (contiguous) {
+                    last.length += mapping.length;
+                    return;
+                }
+                break;
+            case HostMappingType::Protect:
+                if (contiguous && last.perms == mapping.perms) {
+                    last.length += mapping.length;
+                    return;
+                }
+                break;
+            }
+        }
+        pending_host_mappings.push_back(mapping);
+    }
+
+    void FlushHostMappingsLocked() {
+        for (const HostMapping& mapping : pending_host_mappings) {
+            switch (mapping.type) {
+            case HostMappingType::Map:
+                host_buffer->Map(mapping.virtual_offset, mapping.host_offset, mapping.length,
+                                 mapping.perms, mapping.separate_heap);
+                break;
+            case HostMappingType::Unmap:
+                host_buffer->Unmap(mapping.virtual_offset, mapping.length, mapping.separate_heap);
+                break;
+            case HostMappingType::Protect:
+                ProtectHostRange(mapping.virtual_offset, mapping.length, mapping.perms);
+                break;
+            }
+        }
+        pending_host_mappings.clear();
+    }
+
+    /// Applies new permissions to a fastmem range, leaving pages cached by the rasterizer alone
+    void ProtectHostRange(VAddr vaddr, u64 size, Common::MemoryPermission perms) {
+        u64 protect_bytes = 0, protect_begin = 0;
+        for (u64 addr = vaddr; addr < vaddr + size; addr += YUZU_PAGESIZE) {
+            const Common::PageType page_type = current_page_table->entries[addr >> YUZU_PAGEBITS].ptr.Type();
+            switch (page_type) {
+            case Common::PageType::RasterizerCachedMemory:
+                if (protect_bytes > 0) {
+                    host_buffer->Protect(protect_begin, protect_bytes, perms);
+                    protect_bytes = 0;
+                }
+                break;
+            default:
+                if (protect_bytes == 0)
+                    protect_begin = addr;
+                protect_bytes += YUZU_PAGESIZE;
+            }
+        }
+
+        if (protect_bytes > 0) {
+            host_buffer->Protect(protect_begin, protect_bytes, perms);
+        }
+    }
+
     Core::System& system;
     Tegra::MaxwellDeviceMemoryManager* gpu_device_memory{};
     Common::PageTable* current_page_table = nullptr;
@@ -767,6 +893,8 @@ struct Memory::Impl {
     std::array<Common::ScratchBuffer<u32>, Core::Hardware::NUM_CPU_CORES> scratch_buffers{};
     std::span<Core::GPUDirtyMemoryManager> gpu_dirty_managers;
     std::mutex sys_core_guard;
+    std::vector<HostMapping> pending_host_mappings;
+    std::mutex host_mapping_guard;
 #ifdef __ANDROID__
     std::optional<Common::HeapTracker> heap_tracker;
     Common::HeapTracker* host_buffer{};
@@ -805,6 +933,10 @@ void Memory::ProtectRegion(Common::PageTable& page_table, Common::ProcessAddress
     impl->ProtectRegion(page_table, GetInteger(vaddr), size, perms);
 }
 
+void Memory::FlushHostMappings() {
+    impl->FlushHostMappings();
+}
+
 bool Memory::IsValidVirtualAddress(const Common::ProcessAddress vaddr) const {
     const auto& page_table = *impl->current_page_table;
     const size_t page = vaddr >> YUZU_PAGEBITS;
@@ -116,6 +116,13 @@ public:
     void ProtectRegion(Common::PageTable& page_table, Common::ProcessAddress base, u64 size,
                        Common::MemoryPermission perms);
 
+    /**
+     * Applies the fastmem mapping changes queued by MapMemoryRegion, UnmapRegion and
+     * ProtectRegion. Adjacent changes of the same kind are merged into a single host operation.
+     * Must be called before the guest is allowed to observe the updated regions.
+     */
+    void FlushHostMappings();
+
     /**
      * Checks whether or not the supplied address is a valid virtual
      * address for the current process.
@@ -4,6 +4,7 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <cstring>
 #include <locale>
 #include "common/hex_util.h"
 #include "common/swap.h"
@@ -67,6 +68,16 @@ void StandardVmCallbacks::MemoryWriteUnsafe(VAddr address, const void* data, u64
         return;
     }
 
+    // Cheats mostly store the same values on every run, skip those writes so the code cache and
+    // the GPU caches aren't invalidated for memory that didn't change
+    if (size <= sizeof(u64)) {
+        u64 current_value{};
+        system.ApplicationMemory().ReadBlockUnsafe(address, &current_value, size);
+        if (std::memcmp(&current_value, data, size) == 0) {
+            return;
+        }
+    }
+
     if (system.ApplicationMemory().WriteBlock(address, data, size)) {
         Core::InvalidateInstructionCacheRange(system.ApplicationProcess(), address, size);
     }
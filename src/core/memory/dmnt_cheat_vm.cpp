@@ -8,6 +8,13 @@
 
 namespace Core::Memory {
 
+#ifdef _DEBUG
+constexpr bool LogExecution = true;
+#else
+// The state dumps are formatted on every executed opcode, even when the log filter drops them
+constexpr bool LogExecution = false;
+#endif
+
 DmntCheatVm::DmntCheatVm(std::unique_ptr<Callbacks> callbacks_)
     : callbacks(std::move(callbacks_)) {}
 
@@ -634,13 +641,35 @@ bool DmntCheatVm::DecodeNextOpcode(CheatVmOpcode& out) {
     return valid;
 }
 
+void DmntCheatVm::DecodeProgram() {
+    // Every opcode the program can reach starts where the previous one ends, since loops only
+    // jump back to the opcode after their start. Decoding in order until the first failure thus
+    // gives exactly the opcodes the interpreter would decode while running.
+    decoded_program.clear();
+    instruction_ptr = 0;
+    decode_success = true;
+    CheatVmOpcode opcode{};
+    while (DecodeNextOpcode(opcode)) {
+        decoded_program.push_back(opcode);
+    }
+    instruction_ptr = 0;
+}
+
+bool DmntCheatVm::FetchOpcode(CheatVmOpcode& out) {
+    if (instruction_ptr >= decoded_program.size()) {
+        return false;
+    }
+    out = decoded_program[instruction_ptr++];
+    return true;
+}
+
 void DmntCheatVm::SkipConditionalBlock(bool is_if) {
     if (condition_depth > 0) {
         // We want to continue until we're out of the current block.
         const std::size_t desired_depth = condition_depth - 1;
 
         CheatVmOpcode skip_opcode{};
-        while (condition_depth > desired_depth && DecodeNextOpcode(skip_opcode)) {
+        while (condition_depth > desired_depth && FetchOpcode(skip_opcode)) {
             // Decode instructions until we see end of the current conditional block.
             // NOTE: This is broken in gateway's implementation.
             // Gateway currently checks for "0x2" instead of "0x20000000"
@@ -717,6 +746,7 @@ bool DmntCheatVm::LoadProgram(const std::vector<CheatEntry>& entries) {
             // Bounds check.
             if (entries[i].definition.num_opcodes + num_opcodes > MaximumProgramOpcodeCount) {
                 num_opcodes = 0;
+                decoded_program.clear();
                 return false;
             }
 
@@ -726,6 +756,7 @@ bool DmntCheatVm::LoadProgram(const std::vector<CheatEntry>& entries) {
         }
     }
 
+    DecodeProgram();
     return true;
 }
 
@@ -735,27 +766,33 @@ void DmntCheatVm::Execute(const CheatProcessMetadata& metadata) {
     // Get Keys down.
     u64 kDown = callbacks->HidKeysDown();
 
-    callbacks->CommandLog("Started VM execution.");
-    callbacks->CommandLog(fmt::format("Main NSO:  {:012X}", metadata.main_nso_extents.base));
-    callbacks->CommandLog(fmt::format("Heap:      {:012X}", metadata.main_nso_extents.base));
-    callbacks->CommandLog(fmt::format("Keys Down: {:08X}", static_cast<u32>(kDown & 0x0FFFFFFF)));
+    if constexpr (LogExecution) {
+        callbacks->CommandLog("Started VM execution.");
+        callbacks->CommandLog(fmt::format("Main NSO:  {:012X}", metadata.main_nso_extents.base));
+        callbacks->CommandLog(fmt::format("Heap:      {:012X}", metadata.main_nso_extents.base));
+        callbacks->CommandLog(
+            fmt::format("Keys Down: {:08X}", static_cast<u32>(kDown & 0x0FFFFFFF)));
+    }
 
     // Clear VM state.
     ResetState();
 
     // Loop until program finishes.
-    while (DecodeNextOpcode(cur_opcode)) {
-        callbacks->CommandLog(
-            fmt::format("Instruction Ptr: {:04X}", static_cast<u32>(instruction_ptr)));
+    while (FetchOpcode(cur_opcode)) {
+        if constexpr (LogExecution) {
+            callbacks->CommandLog(
+                fmt::format("Instruction Ptr: {:04X}", static_cast<u32>(instruction_ptr)));
 
-        for (std::size_t i = 0; i < NumRegisters; i++) {
-            callbacks->CommandLog(fmt::format("Registers[{:02X}]: {:016X}", i, registers[i]));
-        }
+            for (std::size_t i = 0; i < NumRegisters; i++) {
+                callbacks->CommandLog(fmt::format("Registers[{:02X}]: {:016X}", i, registers[i]));
+            }
 
-        for (std::size_t i = 0; i < NumRegisters; i++) {
-            callbacks->CommandLog(fmt::format("SavedRegs[{:02X}]: {:016X}", i, saved_values[i]));
+            for (std::size_t i = 0; i < NumRegisters; i++) {
+                callbacks->CommandLog(
+                    fmt::format("SavedRegs[{:02X}]: {:016X}", i, saved_values[i]));
+            }
+            LogOpcode(cur_opcode);
         }
-        LogOpcode(cur_opcode);
 
         // Increment conditional depth, if relevant.
         if (cur_opcode.begin_conditional_block) {
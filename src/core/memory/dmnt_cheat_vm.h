@@ -304,16 +304,21 @@ private:
     std::unique_ptr<Callbacks> callbacks;
 
     std::size_t num_opcodes = 0;
+    /// Index into `program` while decoding, and into `decoded_program` while executing
     std::size_t instruction_ptr = 0;
     std::size_t condition_depth = 0;
     bool decode_success = false;
     std::array<u32, MaximumProgramOpcodeCount> program{};
+    /// Opcodes of the program, decoded once when it is loaded
+    std::vector<CheatVmOpcode> decoded_program;
     std::array<u64, NumRegisters> registers{};
     std::array<u64, NumRegisters> saved_values{};
     std::array<u64, NumStaticRegisters> static_registers{};
     std::array<std::size_t, NumRegisters> loop_tops{};
 
     bool DecodeNextOpcode(CheatVmOpcode& out);
+    void DecodeProgram();
+    bool FetchOpcode(CheatVmOpcode& out);
     void SkipConditionalBlock(bool is_if);
     void ResetState();
 
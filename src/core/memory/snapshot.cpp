@@ -0,0 +1,147 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <cstring>
+
+#include "common/div_ceil.h"
+#include "common/logging.h"
+#include "common/zstd_compression.h"
+#include "core/memory/snapshot.h"
+
+namespace Core::Memory {
+
+namespace {
+
+constexpr u32 SnapshotMagic = 0x504E5345; // ESNP
+constexpr u32 SnapshotVersion = 1;
+
+struct SnapshotHeader {
+    u32 magic;
+    u32 version;
+    u64 memory_size;
+    u64 chunk_size;
+    u64 num_chunks;
+};
+static_assert(sizeof(SnapshotHeader) == 0x20, "SnapshotHeader has incorrect size.");
+
+struct SnapshotChunkHeader {
+    u64 index;
+    u64 compressed_size;
+};
+static_assert(sizeof(SnapshotChunkHeader) == 0x10, "SnapshotChunkHeader has incorrect size.");
+
+bool IsZeroChunk(std::span<const u8> chunk) {
+    u64 word{};
+    std::size_t offset = 0;
+    for (; offset + sizeof(word) <= chunk.size(); offset += sizeof(word)) {
+        std::memcpy(&word, chunk.data() + offset, sizeof(word));
+        if (word != 0) {
+            return false;
+        }
+    }
+    return std::all_of(chunk.begin() + offset, chunk.end(), [](u8 value) { return value == 0; });
+}
+
+template <typename T>
+void Append(std::vector<u8>& out, const T& value) {
+    const auto* const bytes = reinterpret_cast<const u8*>(&value);
+    out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+template <typename T>
+bool Consume(std::span<const u8>& in, T& value) {
+    if (in.size() < sizeof(T)) {
+        return false;
+    }
+    std::memcpy(&value, in.data(), sizeof(T));
+    in = in.subspan(sizeof(T));
+    return true;
+}
+
+} // Anonymous namespace
+
+std::vector<u8> SerializeMemorySnapshot(std::span<const u8> memory) {
+    std::vector<u8> out;
+    Append(out, SnapshotHeader{});
+
+    u64 num_chunks = 0;
+    for (std::size_t offset = 0; offset < memory.size(); offset += SnapshotChunkSize) {
+        const auto chunk =
+            memory.subspan(offset, std::min(SnapshotChunkSize, memory.size() - offset));
+        if (IsZeroChunk(chunk)) {
+            continue;
+        }
+        const std::vector<u8> compressed =
+            Common::Compression::CompressDataZSTDDefault(chunk.data(), chunk.size());
+        Append(out, SnapshotChunkHeader{
+                        .index = offset / SnapshotChunkSize,
+                        .compressed_size = compressed.size(),
+                    });
+        out.insert(out.end(), compressed.begin(), compressed.end());
+        ++num_chunks;
+    }
+
+    const SnapshotHeader header{
+        .magic = SnapshotMagic,
+        .version = SnapshotVersion,
+        .memory_size = memory.size(),
+        .chunk_size = SnapshotChunkSize,
+        .num_chunks = num_chunks,
+    };
+    std::memcpy(out.data(), &header, sizeof(header));
+    return out;
+}
+
+bool DeserializeMemorySnapshot(std::span<const u8> snapshot, std::span<u8> memory) {
+    SnapshotHeader header{};
+    if (!Consume(snapshot, header) || header.magic != SnapshotMagic) {
+        LOG_ERROR(Core, "Invalid memory snapshot");
+        return false;
+    }
+    if (header.version != SnapshotVersion || header.chunk_size != SnapshotChunkSize) {
+        LOG_ERROR(Core, "Unsupported memory snapshot version={} chunk_size={:#x}",
+                  header.version, header.chunk_size);
+        return false;
+    }
+    if (header.memory_size != memory.size()) {
+        LOG_ERROR(Core, "Memory snapshot size {:#x} does not match memory size {:#x}",
+                  header.memory_size, memory.size());
+        return false;
+    }
+
+    const u64 total_chunks = Common::DivCeil(header.memory_size, header.chunk_size);
+    u64 next_index = 0;
+    const auto clear_until = [&](u64 index) {
+        const std::size_t begin = next_index * SnapshotChunkSize;
+        const std::size_t end = std::min<std::size_t>(index * SnapshotChunkSize, memory.size());
+        if (begin < end) {
+            std::memset(memory.data() + begin, 0, end - begin);
+        }
+    };
+
+    for (u64 i = 0; i < header.num_chunks; ++i) {
+        SnapshotChunkHeader chunk{};
+        if (!Consume(snapshot, chunk) || chunk.index < next_index || chunk.index >= total_chunks ||
+            chunk.compressed_size > snapshot.size()) {
+            LOG_ERROR(Core, "Memory snapshot is truncated or corrupted at chunk {}", i);
+            return false;
+        }
+        const std::size_t offset = chunk.index * SnapshotChunkSize;
+        const std::size_t size = std::min(SnapshotChunkSize, memory.size() - offset);
+        const std::vector<u8> data =
+            Common::Compression::DecompressDataZSTD(snapshot.first(chunk.compressed_size));
+        if (data.size() != size) {
+            LOG_ERROR(Core, "Memory snapshot chunk {} failed to decompress", chunk.index);
+            return false;
+        }
+        clear_until(chunk.index);
+        std::memcpy(memory.data() + offset, data.data(), size);
+        snapshot = snapshot.subspan(chunk.compressed_size);
+        next_index = chunk.index + 1;
+    }
+    clear_until(total_chunks);
+    return true;
+}
+
+} // namespace Core::Memory
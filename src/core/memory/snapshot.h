@@ -0,0 +1,37 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace Core::Memory {
+
+/// Granularity at which guest memory is checked for content and compressed
+constexpr std::size_t SnapshotChunkSize = 256 * 1024;
+
+/**
+ * Serializes a guest memory image into a sparse snapshot. Chunks that are entirely zero are
+ * omitted, the rest are compressed individually with Zstandard.
+ *
+ * @param memory The memory image to serialize, usually the emulated DRAM backing.
+ *
+ * @return The serialized snapshot.
+ */
+[[nodiscard]] std::vector<u8> SerializeMemorySnapshot(std::span<const u8> memory);
+
+/**
+ * Restores a memory image from a snapshot produced by SerializeMemorySnapshot. Chunks missing
+ * from the snapshot are cleared.
+ *
+ * @param snapshot The serialized snapshot.
+ * @param memory   The memory image to restore into. Must be as large as the original image.
+ *
+ * @return True on success, false when the snapshot is malformed or does not fit the image.
+ */
+[[nodiscard]] bool DeserializeMemorySnapshot(std::span<const u8> snapshot, std::span<u8> memory);
+
+} // namespace Core::Memory
@@ -99,6 +99,21 @@ double PerfStats::GetMeanFrametime() const {
     return sum / static_cast<double>(current_index - IgnoreFrames);
 }
 
+std::size_t PerfStats::GetFrameCount() const {
+    std::scoped_lock lock{object_mutex};
+
+    return current_index;
+}
+
+std::vector<double> PerfStats::GetFrametimes(std::size_t first_frame) const {
+    std::scoped_lock lock{object_mutex};
+
+    if (first_frame >= current_index) {
+        return {};
+    }
+    return {perf_history.begin() + first_frame, perf_history.begin() + current_index};
+}
+
 PerfStatsResults PerfStats::GetAndResetStats(microseconds current_system_time_us) {
     std::scoped_lock lock{object_mutex};
 
@@ -8,6 +8,7 @@
 #include <chrono>
 #include <cstddef>
 #include <mutex>
+#include <vector>
 #include "common/common_types.h"
 
 namespace Core {
@@ -21,6 +22,16 @@ struct PerfStatsResults {
     double frametime;
     /// Ratio of walltime / emulated time elapsed
     double emulation_speed;
+    /// Walltime per audio renderer frame, in seconds, excluding the waits for the sink
+    double audio_frametime{};
+    /// Number of times the audio sink ran out of samples
+    u32 audio_underruns{};
+    /// Number of rendered audio buffers waiting in the sink
+    u32 audio_queue_depth{};
+    /// Walltime from a host input change to it reaching the guest, in seconds
+    double input_latency{};
+    /// Walltime from a host input change to the next presented frame, in seconds
+    double input_present_latency{};
 };
 
 /**
@@ -45,6 +56,13 @@ public:
      */
     double GetMeanFrametime() const;
 
+    /// Returns the number of frames stored in the performance history.
+    std::size_t GetFrameCount() const;
+
+    /// Returns the frametimes, in milliseconds, stored in the performance history from the given
+    /// frame on.
+    std::vector<double> GetFrametimes(std::size_t first_frame) const;
+
     /**
      * Gets the ratio between walltime and the emulated time of the previous system frame. This is
      * useful for scaling inputs or outputs moving between the two time domains.
@@ -8,9 +8,11 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include <chrono>
+#include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <regex>
 #include <string>
 #include <thread>
@@ -28,6 +30,7 @@
 #include "common/fs/fs.h"
 #include "common/fs/path_util.h"
 #include "common/logging.h"
+#include "common/polyfill_thread.h"
 #include "common/scm_rev.h"
 #include "common/settings.h"
 #include "common/string_util.h"
@@ -66,6 +69,7 @@ static void PrintHelp(const char* argv0) {
              "-a, --web-api-url       yuzu Web API url\n"
              "-b, --ban-list-file     The file for storing the room ban list\n"
              "-l, --log-file          The file for storing the room log\n"
+             "-r, --metrics-file      The file for exporting the room metrics to Prometheus\n"
              "-h, --help              Display this help and exit\n"
              "-v, --version           Output version information and exit\n",
              argv0);
@@ -148,6 +152,28 @@ static Network::Room::BanList LoadBanList(const std::string& path) {
     return {username_ban_list, ip_ban_list};
 }
 
+/// Interval between two exports of the room metrics
+static constexpr std::chrono::seconds MetricsInterval{10};
+
+static void SaveMetrics(const Network::Room& room, const std::string& path) {
+    // Written next to the file and moved over it, so a collector never reads a partial export
+    const std::string temp_path = path + ".tmp";
+    {
+        std::ofstream file;
+        Common::FS::OpenFileStream(file, temp_path, std::ios_base::out);
+        if (!file) {
+            LOG_ERROR(Network, "Could not save metrics!");
+            return;
+        }
+        file << room.GetMetrics();
+    }
+    std::error_code ec;
+    std::filesystem::rename(temp_path, path, ec);
+    if (ec) {
+        LOG_ERROR(Network, "Could not save metrics: {}", ec.message());
+    }
+}
+
 static void SaveBanList(const Network::Room::BanList& ban_list, const std::string& path) {
     std::ofstream file;
     Common::FS::OpenFileStream(file, path, std::ios_base::out);
@@ -189,6 +215,7 @@ void LaunchRoom(int argc, char** argv, bool called_by_option) {
     std::string web_api_url;
     std::string ban_list_file;
     std::string log_file = "eden-room.log";
+    std::string metrics_file;
     std::string bind_address;
     u64 preferred_game_id = 0;
     u32 port = Network::DefaultRoomPort;
@@ -208,6 +235,7 @@ void LaunchRoom(int argc, char** argv, bool called_by_option) {
         {"web-api-url", required_argument, 0, 'a'},
         {"ban-list-file", required_argument, 0, 'b'},
         {"log-file", required_argument, 0, 'l'},
+        {"metrics-file", required_argument, 0, 'r'},
         {"help", no_argument, 0, 'h'},
         {"version", no_argument, 0, 'v'},
         // Entry option
@@ -220,7 +248,7 @@ void LaunchRoom(int argc, char** argv, bool called_by_option) {
     Common::Log::Start();
 
     while (optind < argc) {
-        int arg = getopt_long(argc, argv, "n:d:s:p:m:w:g:u:t:a:i:l:hv", long_options, &option_index);
+        int arg = getopt_long(argc, argv, "n:d:s:p:m:w:g:u:t:a:i:l:r:hv", long_options, &option_index);
         if (arg != -1) {
             char carg = static_cast<char>(arg);
 
@@ -264,6 +292,9 @@ void LaunchRoom(int argc, char** argv, bool called_by_option) {
             case 'l':
                 log_file.assign(optarg);
                 break;
+            case 'r':
+                metrics_file.assign(optarg);
+                break;
             case 'h':
                 PrintHelp(argv[0]);
                 std::exit(0);
@@ -371,6 +402,14 @@ void LaunchRoom(int argc, char** argv, bool called_by_option) {
         if (announce) {
             announce_session->Start();
         }
+        std::optional<std::jthread> metrics_thread;
+        if (!metrics_file.empty()) {
+            metrics_thread.emplace([&room, &metrics_file](std::stop_token stop_token) {
+                while (Common::StoppableTimedWait(stop_token, MetricsInterval)) {
+                    SaveMetrics(*room, metrics_file);
+                }
+            });
+        }
         while (room->GetState() == Network::Room::State::Open) {
             std::string in;
             std::cin >> in;
@@ -379,6 +418,7 @@ void LaunchRoom(int argc, char** argv, bool called_by_option) {
             }
             std::this_thread::sleep_for(std::chrono::milliseconds(100));
         }
+        metrics_thread.reset();
         if (announce) {
             announce_session->Stop();
         }
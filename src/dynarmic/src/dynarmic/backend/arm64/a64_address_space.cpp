@@ -333,7 +333,11 @@ A64AddressSpace::A64AddressSpace(const A64::UserConfig& conf)
 void A64AddressSpace::GenerateIR(IR::Block& ir_block, IR::LocationDescriptor descriptor) const {
     ir_block.Reset(descriptor);
     const auto get_code = [this](u64 vaddr) { return conf.callbacks->MemoryReadCode(vaddr); };
-    A64::Translate(ir_block, A64::LocationDescriptor{descriptor}, get_code, {conf.define_unpredictable_behaviour, conf.wall_clock_cntpct});
+    A64::Translate(ir_block, A64::LocationDescriptor{descriptor}, get_code, {
+        .define_unpredictable_behaviour = conf.define_unpredictable_behaviour,
+        .wall_clock_cntpct = conf.wall_clock_cntpct,
+        .merge_unconditional_branches = conf.HasOptimization(OptimizationFlag::BlockMerging),
+    });
     Optimization::Optimize(ir_block, conf, {});
 }
 
@@ -578,6 +582,11 @@ EmitConfig A64AddressSpace::GetEmitConfig() {
     };
 }
 
+bool A64AddressSpace::ShouldPrecompile(IR::LocationDescriptor descriptor) const {
+    const A64::LocationDescriptor arch_descriptor{descriptor};
+    return conf.precompile_successors && !arch_descriptor.SingleStepping() && conf.callbacks->MemoryReadCode(arch_descriptor.PC());
+}
+
 void A64AddressSpace::RegisterNewBasicBlock(const IR::Block& block, const EmittedBlockInfo&) {
     const A64::LocationDescriptor descriptor{block.Location()};
     const A64::LocationDescriptor end_location{block.EndLocation()};
@@ -29,6 +29,7 @@ protected:
 
     void EmitPrelude();
     EmitConfig GetEmitConfig() override;
+    bool ShouldPrecompile(IR::LocationDescriptor descriptor) const override;
     void RegisterNewBasicBlock(const IR::Block& block, const EmittedBlockInfo& block_info) override;
 
     const A64::UserConfig conf;
@@ -17,6 +17,7 @@
 #include "dynarmic/backend/arm64/a64_core.h"
 #include "dynarmic/backend/arm64/a64_jitstate.h"
 #include "dynarmic/common/atomic.h"
+#include "dynarmic/frontend/A64/a64_location_descriptor.h"
 #include "dynarmic/interface/A64/a64.h"
 #include "dynarmic/interface/A64/config.h"
 
@@ -62,6 +63,34 @@ struct Jit::Impl final {
         HaltExecution(HaltReason::CacheInvalidation);
     }
 
+    std::vector<std::uint64_t> GetCachedBlockLocations() const {
+        std::vector<std::uint64_t> locations;
+        for (const IR::LocationDescriptor location : current_address_space.GetBlockLocations()) {
+            // Single stepping blocks are only useful to the debugger
+            if (!A64::LocationDescriptor{location}.SingleStepping()) {
+                locations.push_back(location.Value());
+            }
+        }
+        return locations;
+    }
+
+    std::vector<Jit::BlockProfile> GetBlockProfile() const {
+        // Block profiling is not implemented on this backend
+        return {};
+    }
+
+    void Precompile(std::span<const std::uint64_t> locations) {
+        ASSERT(!is_executing);
+        PerformRequestedCacheInvalidation(static_cast<HaltReason>(Atomic::Load(&halt_reason)));
+        for (const std::uint64_t location : locations) {
+            const A64::LocationDescriptor descriptor{IR::LocationDescriptor{location}};
+            if (descriptor.SingleStepping() || !conf.callbacks->MemoryReadCode(descriptor.PC())) {
+                continue;
+            }
+            current_address_space.GetOrEmit(descriptor);
+        }
+    }
+
     void Reset() {
         current_state = {};
     }
@@ -201,6 +230,18 @@ void Jit::InvalidateCacheRange(std::uint64_t start_address, std::size_t length)
     impl->InvalidateCacheRange(start_address, length);
 }
 
+std::vector<std::uint64_t> Jit::GetCachedBlockLocations() const {
+    return impl->GetCachedBlockLocations();
+}
+
+std::vector<Jit::BlockProfile> Jit::GetBlockProfile() const {
+    return impl->GetBlockProfile();
+}
+
+void Jit::Precompile(std::span<const std::uint64_t> locations) {
+    impl->Precompile(locations);
+}
+
 void Jit::Reset() {
     impl->Reset();
 }
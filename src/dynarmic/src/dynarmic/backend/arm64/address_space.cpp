@@ -10,6 +10,9 @@
 
 #include <bit>
 
+#include <boost/container/static_vector.hpp>
+#include <fmt/format.h>
+
 #include "dynarmic/backend/arm64/a64_address_space.h"
 #include "dynarmic/backend/arm64/a64_jitstate.h"
 #include "dynarmic/backend/arm64/abi.h"
@@ -19,6 +22,7 @@
 #include "dynarmic/common/cast_util.h"
 #include "dynarmic/common/fp/fpcr.h"
 #include "dynarmic/common/llvm_disassemble.h"
+#include "dynarmic/common/perf_map.h"
 #include "dynarmic/interface/exclusive_monitor.h"
 #include "dynarmic/ir/location_descriptor.h"
 
@@ -71,10 +75,41 @@ CodePtr AddressSpace::GetOrEmit(IR::LocationDescriptor descriptor) {
         return block_entry;
     }
     GenerateIR(ir_block, descriptor);
+    const IR::Terminal terminal = ir_block.GetTerminal();
     const EmittedBlockInfo block_info = Emit(std::move(ir_block));
+    PrecompileSuccessors(terminal);
     return block_info.entry_point;
 }
 
+void AddressSpace::PrecompileSuccessors(const IR::Terminal& terminal) {
+    constexpr std::size_t MAX_SUCCESSORS = 4;
+    boost::container::static_vector<IR::LocationDescriptor, MAX_SUCCESSORS> successors;
+    IR::Term::ForEachLinkTarget(terminal, [&](IR::LocationDescriptor next) {
+        if (successors.size() < MAX_SUCCESSORS && !Get(next) && ShouldPrecompile(next)) {
+            successors.push_back(next);
+        }
+    });
+    for (const IR::LocationDescriptor successor : successors) {
+        // Emit evacuates the cache when it runs low, that would free the block about to run
+        if (GetRemainingSize() < 2 * 1024 * 1024) {
+            break;
+        }
+        if (!Get(successor)) {
+            GenerateIR(ir_block, successor);
+            Emit(std::move(ir_block));
+        }
+    }
+}
+
+std::vector<IR::LocationDescriptor> AddressSpace::GetBlockLocations() const {
+    std::vector<IR::LocationDescriptor> locations;
+    locations.reserve(block_entries.size());
+    for (const auto& [location, entry_point] : block_entries) {
+        locations.push_back(location);
+    }
+    return locations;
+}
+
 void AddressSpace::InvalidateBasicBlocks(const ankerl::unordered_dense::set<IR::LocationDescriptor>& descriptors) {
     UnprotectCodeMemory();
 
@@ -100,6 +135,7 @@ void AddressSpace::ClearCache() {
     block_infos.clear();
     block_references.clear();
     code.set_offset(prelude_info.end_of_prelude);
+    Common::PerfMapClear();
 }
 
 std::size_t AddressSpace::GetRemainingSize() {
@@ -126,6 +162,7 @@ EmittedBlockInfo AddressSpace::Emit(IR::Block block) {
     ProtectCodeMemory();
 
     RegisterNewBasicBlock(block, block_info);
+    Common::PerfMapRegister(block_info.entry_point, block_info.entry_point + block_info.size, fmt::format("arm64_{:016X}", block.Location().Value()));
 
     return block_info;
 }
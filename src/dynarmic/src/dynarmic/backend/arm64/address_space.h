@@ -10,6 +10,7 @@
 
 #include <map>
 #include <optional>
+#include <vector>
 
 #include "common/common_types.h"
 #include <oaknut/code_block.hpp>
@@ -41,11 +42,15 @@ public:
 
     CodePtr GetOrEmit(IR::LocationDescriptor descriptor);
 
+    std::vector<IR::LocationDescriptor> GetBlockLocations() const;
+
     void InvalidateBasicBlocks(const ankerl::unordered_dense::set<IR::LocationDescriptor>& descriptors);
 
     void ClearCache();
 protected:
     virtual EmitConfig GetEmitConfig() = 0;
+    /// Returns true when the block at this location should be compiled ahead of its execution
+    virtual bool ShouldPrecompile(IR::LocationDescriptor) const { return false; }
     virtual void RegisterNewBasicBlock(const IR::Block& block, const EmittedBlockInfo& block_info) = 0;
 
     void ProtectCodeMemory() {
@@ -65,6 +70,7 @@ protected:
     void Link(EmittedBlockInfo& block);
     void LinkBlockLinks(const CodePtr entry_point, const CodePtr target_ptr, const std::vector<BlockRelocation>& block_relocations_list);
     void RelinkForDescriptor(IR::LocationDescriptor target_descriptor, CodePtr target_ptr);
+    void PrecompileSuccessors(const IR::Terminal& terminal);
 
     FakeCall FastmemCallback(u64 host_pc);
 
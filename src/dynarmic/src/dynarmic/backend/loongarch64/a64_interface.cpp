@@ -33,6 +33,16 @@ struct Jit::Impl final {
         HaltExecution(HaltReason::CacheInvalidation);
     }
 
+    std::vector<std::uint64_t> GetCachedBlockLocations() const {
+        return {};
+    }
+
+    std::vector<Jit::BlockProfile> GetBlockProfile() const {
+        return {};
+    }
+
+    void Precompile(std::span<const std::uint64_t>) {}
+
     void Reset() {
         regs = {};
         vectors = {};
@@ -169,6 +179,18 @@ void Jit::InvalidateCacheRange(u64 start_address, std::size_t length) {
     impl->InvalidateCacheRange(start_address, length);
 }
 
+std::vector<std::uint64_t> Jit::GetCachedBlockLocations() const {
+    return impl->GetCachedBlockLocations();
+}
+
+std::vector<Jit::BlockProfile> Jit::GetBlockProfile() const {
+    return impl->GetBlockProfile();
+}
+
+void Jit::Precompile(std::span<const std::uint64_t> locations) {
+    impl->Precompile(locations);
+}
+
 void Jit::Reset() {
     impl->Reset();
 }
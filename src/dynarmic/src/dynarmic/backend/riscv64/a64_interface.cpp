@@ -50,6 +50,16 @@ struct Jit::Impl final {
         HaltExecution(HaltReason::CacheInvalidation);
     }
 
+    std::vector<std::uint64_t> GetCachedBlockLocations() const {
+        return {};
+    }
+
+    std::vector<Jit::BlockProfile> GetBlockProfile() const {
+        return {};
+    }
+
+    void Precompile(std::span<const std::uint64_t>) {}
+
     void Reset() {
         ASSERT(!is_executing);
         //jit_state = {};
@@ -196,6 +206,18 @@ void Jit::InvalidateCacheRange(u64 start_address, size_t length) {
     impl->InvalidateCacheRange(start_address, length);
 }
 
+std::vector<std::uint64_t> Jit::GetCachedBlockLocations() const {
+    return impl->GetCachedBlockLocations();
+}
+
+std::vector<Jit::BlockProfile> Jit::GetBlockProfile() const {
+    return impl->GetBlockProfile();
+}
+
+void Jit::Precompile(std::span<const std::uint64_t> locations) {
+    impl->Precompile(locations);
+}
+
 void Jit::Reset() {
     impl->Reset();
 }
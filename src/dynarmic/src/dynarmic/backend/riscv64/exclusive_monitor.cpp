@@ -3,52 +3,41 @@
 
 #include "dynarmic/interface/exclusive_monitor.h"
 
-#include <algorithm>
+#include "common/assert.h"
 
 namespace Dynarmic {
 
 ExclusiveMonitor::ExclusiveMonitor(std::size_t processor_count)
-        : exclusive_addresses(processor_count, INVALID_EXCLUSIVE_ADDRESS), exclusive_values(processor_count) {}
-
-size_t ExclusiveMonitor::GetProcessorCount() const {
-    return exclusive_addresses.size();
-}
-
-void ExclusiveMonitor::Lock() {
-    lock.Lock();
+        : processor_count{processor_count} {
+    ASSERT(processor_count <= MAX_NUM_CPU_CORES);
+    for (auto& address : exclusive_addresses) {
+        address.store(INVALID_EXCLUSIVE_ADDRESS, std::memory_order_relaxed);
+    }
+    static_assert(sizeof(std::atomic<std::uint64_t>) == sizeof(std::uint64_t) && std::atomic<std::uint64_t>::is_always_lock_free);
 }
 
-void ExclusiveMonitor::Unlock() {
-    lock.Unlock();
+size_t ExclusiveMonitor::GetProcessorCount() const {
+    return processor_count;
 }
 
-bool ExclusiveMonitor::CheckAndClear(size_t processor_id, VAddr address) {
+bool ExclusiveMonitor::CheckAndClear(std::size_t processor_id, VAddr address) {
     const VAddr masked_address = address & RESERVATION_GRANULE_MASK;
-
-    Lock();
-    if (exclusive_addresses[processor_id] != masked_address) {
-        Unlock();
+    if (exclusive_addresses[processor_id].exchange(INVALID_EXCLUSIVE_ADDRESS, std::memory_order_relaxed) != masked_address) {
         return false;
     }
-
-    for (VAddr& other_address : exclusive_addresses) {
-        if (other_address == masked_address) {
-            other_address = INVALID_EXCLUSIVE_ADDRESS;
-        }
-    }
-    return true;
+    // Bumping the version of the line fails the reservations of every other processor on it
+    std::uint64_t expected = exclusive_versions[processor_id];
+    return LineVersion(masked_address).compare_exchange_strong(expected, expected + 1, std::memory_order_acq_rel);
 }
 
 void ExclusiveMonitor::Clear() {
-    Lock();
-    std::fill(exclusive_addresses.begin(), exclusive_addresses.end(), INVALID_EXCLUSIVE_ADDRESS);
-    Unlock();
+    for (size_t i = 0; i < processor_count; i++) {
+        exclusive_addresses[i].store(INVALID_EXCLUSIVE_ADDRESS, std::memory_order_relaxed);
+    }
 }
 
 void ExclusiveMonitor::ClearProcessor(size_t processor_id) {
-    Lock();
-    exclusive_addresses[processor_id] = INVALID_EXCLUSIVE_ADDRESS;
-    Unlock();
+    exclusive_addresses[processor_id].store(INVALID_EXCLUSIVE_ADDRESS, std::memory_order_relaxed);
 }
 
 }  // namespace Dynarmic
@@ -8,6 +8,8 @@
 
 #include "dynarmic/backend/x64/a64_emit_x64.h"
 
+#include <bit>
+
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 #include "common/assert.h"
@@ -21,8 +23,8 @@
 #include "dynarmic/backend/x64/devirtualize.h"
 #include "dynarmic/backend/x64/emit_x64.h"
 #include "dynarmic/backend/x64/nzcv_util.h"
-#include "dynarmic/backend/x64/perf_map.h"
 #include "dynarmic/backend/x64/stack_layout.h"
+#include "dynarmic/common/perf_map.h"
 #include "dynarmic/frontend/A64/a64_location_descriptor.h"
 #include "dynarmic/frontend/A64/a64_types.h"
 #include "dynarmic/ir/basic_block.h"
@@ -79,7 +81,7 @@ A64EmitX64::BlockDescriptor A64EmitX64::Emit(IR::Block& block) noexcept {
     code.EnableWriting();
     new (&this->reg_alloc) RegAlloc{[this] {
         std::bitset<32> gprs = any_gpr;
-        if (conf.fastmem_pointer)
+        if (conf.fastmem_pointer && *conf.fastmem_pointer != 0)
             gprs.reset(size_t(HostLoc::R13));
         if (conf.page_table)
             gprs.reset(size_t(HostLoc::R14));
@@ -91,6 +93,15 @@ A64EmitX64::BlockDescriptor A64EmitX64::Emit(IR::Block& block) noexcept {
     // Start emitting.
     code.align();
     const auto* const entrypoint = code.getCurr();
+    if (conf.enable_block_profiling) {
+        auto& profile = block_profile[block.Location().Value()];
+        profile.pc = A64::LocationDescriptor{block.Location()}.PC();
+        profile.end_pc = A64::LocationDescriptor{block.EndLocation()}.PC();
+        profile.cycles = block.CycleCount();
+        // rax and flags are dead on block entry
+        code.mov(rax, std::bit_cast<u64>(&profile.executions));
+        code.inc(code.qword[rax]);
+    }
     code.mov(code.qword[rsp + ABI_SHADOW_SPACE + offsetof(StackLayout, abi_base_pointer)], rbp);
     code.lea(rbp, code.ptr[rsp + ABI_SHADOW_SPACE + offsetof(StackLayout, abi_base_pointer) - 8]);
 
@@ -167,6 +178,17 @@ finish_this_inst:
     return bdesc;
 }
 
+std::vector<A64::Jit::BlockProfile> A64EmitX64::GetBlockProfile() const {
+    std::vector<A64::Jit::BlockProfile> profile;
+    profile.reserve(block_profile.size());
+    for (const auto& [location, entry] : block_profile) {
+        if (entry.executions != 0) {
+            profile.push_back(entry);
+        }
+    }
+    return profile;
+}
+
 void A64EmitX64::ClearCache() {
     EmitX64::ClearCache();
     block_ranges.ClearCache();
@@ -174,6 +196,19 @@ void A64EmitX64::ClearCache() {
     fastmem_patch_info.clear();
 }
 
+size_t A64EmitX64::EvictCodeRange(CodePtr begin, CodePtr end) {
+    const size_t evicted_blocks = EmitX64::EvictCodeRange(begin, end);
+    for (auto iter = fastmem_patch_info.begin(); iter != fastmem_patch_info.end();) {
+        const auto host_pc = std::bit_cast<CodePtr>(iter->first);
+        if (host_pc >= begin && host_pc < end) {
+            iter = fastmem_patch_info.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+    return evicted_blocks;
+}
+
 void A64EmitX64::InvalidateCacheRanges(const boost::icl::interval_set<u64>& ranges) {
     InvalidateBasicBlocks(block_ranges.InvalidateRanges(ranges));
 }
@@ -217,7 +252,7 @@ void A64EmitX64::GenTerminalHandlers() {
     }
     code.mov(rax, qword[code.ABI_JIT_PTR + offsetof(A64JitState, rsb_codeptrs) + rax * sizeof(u64)]);
     code.jmp(rax);
-    PerfMapRegister(terminal_handler_pop_rsb_hint, code.getCurr(), "a64_terminal_handler_pop_rsb_hint");
+    Common::PerfMapRegister(terminal_handler_pop_rsb_hint, code.getCurr(), "a64_terminal_handler_pop_rsb_hint");
 
     if (conf.HasOptimization(OptimizationFlag::FastDispatch)) {
         code.align();
@@ -240,7 +275,7 @@ void A64EmitX64::GenTerminalHandlers() {
         code.LookupBlock();
         code.mov(ptr[r12 + offsetof(FastDispatchEntry, code_ptr)], rax);
         code.jmp(rax);
-        PerfMapRegister(terminal_handler_fast_dispatch_hint, code.getCurr(), "a64_terminal_handler_fast_dispatch_hint");
+        Common::PerfMapRegister(terminal_handler_fast_dispatch_hint, code.getCurr(), "a64_terminal_handler_fast_dispatch_hint");
 
         code.align();
         fast_dispatch_table_lookup = code.getCurr<FastDispatchEntry& (*)(u64)>();
@@ -251,7 +286,7 @@ void A64EmitX64::GenTerminalHandlers() {
         code.and_(code.ABI_PARAM1.cvt32(), fast_dispatch_table_mask);
         code.lea(code.ABI_RETURN, code.ptr[code.ABI_PARAM2 + code.ABI_PARAM1]);
         code.ret();
-        PerfMapRegister(fast_dispatch_table_lookup, code.getCurr(), "a64_fast_dispatch_table_lookup");
+        Common::PerfMapRegister(fast_dispatch_table_lookup, code.getCurr(), "a64_fast_dispatch_table_lookup");
     }
 }
 
@@ -51,8 +51,12 @@ public:
 
     void ClearCache() override;
 
+    size_t EvictCodeRange(CodePtr begin, CodePtr end) override;
+
     void InvalidateCacheRanges(const boost::icl::interval_set<u64>& ranges);
 
+    std::vector<A64::Jit::BlockProfile> GetBlockProfile() const;
+
 //protected:
     struct FastDispatchEntry {
         u64 location_descriptor = 0xFFFF'FFFF'FFFF'FFFFull;
@@ -122,6 +126,8 @@ public:
     BlockRangeInformation<u64> block_ranges;
     std::array<FastDispatchEntry, fast_dispatch_table_size> fast_dispatch_table;
     ankerl::unordered_dense::map<u64, FastmemPatchInfo> fastmem_patch_info;
+    // Outlives the code cache, the emitted code holds pointers to the (node-stable) counters
+    std::map<u64, A64::Jit::BlockProfile> block_profile;
     ankerl::unordered_dense::map<std::tuple<bool, size_t, int, int>, void (*)()> read_fallbacks;
     ankerl::unordered_dense::map<std::tuple<bool, size_t, int, int>, void (*)()> write_fallbacks;
     ankerl::unordered_dense::map<std::tuple<bool, size_t, int, int>, void (*)()> exclusive_write_fallbacks;
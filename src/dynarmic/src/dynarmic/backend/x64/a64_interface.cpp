@@ -10,6 +10,7 @@
 #include <memory>
 #include <mutex>
 
+#include <boost/container/static_vector.hpp>
 #include <boost/icl/interval_set.hpp>
 #include "common/assert.h"
 #include "dynarmic/common/fp/fpcr.h"
@@ -45,7 +46,7 @@ static std::function<void(BlockOfCode&)> GenRCP(const A64::UserConfig& conf) {
         if (conf.page_table) {
             code.mov(code.r14, std::bit_cast<u64>(conf.page_table));
         }
-        if (conf.fastmem_pointer) {
+        if (conf.fastmem_pointer && *conf.fastmem_pointer != 0) {
             code.mov(code.r13, *conf.fastmem_pointer);
         }
     };
@@ -115,6 +116,34 @@ public:
         HaltExecution(HaltReason::CacheInvalidation);
     }
 
+    std::vector<u64> GetCachedBlockLocations() const {
+        std::vector<u64> locations;
+        for (const IR::LocationDescriptor location : emitter.GetBasicBlockLocations()) {
+            // Single stepping blocks are only useful to the debugger
+            if (!A64::LocationDescriptor{location}.SingleStepping()) {
+                locations.push_back(location.Value());
+            }
+        }
+        return locations;
+    }
+
+    std::vector<Jit::BlockProfile> GetBlockProfile() const {
+        ASSERT(!is_executing);
+        return emitter.GetBlockProfile();
+    }
+
+    void Precompile(std::span<const u64> locations) {
+        ASSERT(!is_executing);
+        PerformRequestedCacheInvalidation(static_cast<HaltReason>(Atomic::Load(&jit_state.halt_reason)));
+        for (const u64 location : locations) {
+            const A64::LocationDescriptor descriptor{IR::LocationDescriptor{location}};
+            if (descriptor.SingleStepping() || !conf.callbacks->MemoryReadCode(descriptor.PC())) {
+                continue;
+            }
+            GetBlock(descriptor);
+        }
+    }
+
     void Reset() {
         ASSERT(!is_executing);
         jit_state = {};
@@ -241,15 +270,42 @@ private:
         return GetBlock(A64::LocationDescriptor{GetCurrentLocation()}.SetSingleStepping(true));
     }
 
+    static constexpr size_t MINIMUM_REMAINING_CODESIZE = 1 * 1024 * 1024;
+
     CodePtr GetBlock(IR::LocationDescriptor descriptor) {
         if (auto block = emitter.GetBasicBlock(descriptor))
             return block->entrypoint;
 
-        constexpr size_t MINIMUM_REMAINING_CODESIZE = 1 * 1024 * 1024;
-        if (block_of_code.SpaceRemaining() < MINIMUM_REMAINING_CODESIZE) {
-            // Immediately evacuate cache
-            invalidate_entire_cache = true;
-            PerformRequestedCacheInvalidation(HaltReason::CacheInvalidation);
+        const CodePtr entrypoint = CompileBlock(descriptor);
+        if (conf.precompile_successors) {
+            PrecompileSuccessors(ir_block.GetTerminal());
+        }
+        return entrypoint;
+    }
+
+    void PrecompileSuccessors(const IR::Terminal& terminal) {
+        constexpr size_t MAX_SUCCESSORS = 4;
+        boost::container::static_vector<IR::LocationDescriptor, MAX_SUCCESSORS> successors;
+        IR::Term::ForEachLinkTarget(terminal, [&](IR::LocationDescriptor next) {
+            if (successors.size() < MAX_SUCCESSORS && !emitter.GetBasicBlock(next)) {
+                successors.push_back(next);
+            }
+        });
+        for (const IR::LocationDescriptor successor : successors) {
+            // Reclaiming code space now could free the block that is about to run
+            if (CodeSpaceRemaining() < 2 * MINIMUM_REMAINING_CODESIZE) {
+                break;
+            }
+            const A64::LocationDescriptor arch_successor{successor};
+            if (!arch_successor.SingleStepping() && !emitter.GetBasicBlock(successor) && conf.callbacks->MemoryReadCode(arch_successor.PC())) {
+                CompileBlock(successor);
+            }
+        }
+    }
+
+    CodePtr CompileBlock(IR::LocationDescriptor descriptor) {
+        if (CodeSpaceRemaining() < MINIMUM_REMAINING_CODESIZE) {
+            ReclaimCodeSpace();
         }
         block_of_code.EnsureMemoryCommitted(MINIMUM_REMAINING_CODESIZE);
 
@@ -258,11 +314,52 @@ private:
         // LocationDescriptor ctor() does important ops (like tflags) do not skip
         auto const arch_descriptor = A64::LocationDescriptor{descriptor};
         ir_block.Reset(arch_descriptor);
-        A64::Translate(ir_block, arch_descriptor, get_code, {conf.define_unpredictable_behaviour, conf.wall_clock_cntpct});
+        A64::Translate(ir_block, arch_descriptor, get_code, {
+            .define_unpredictable_behaviour = conf.define_unpredictable_behaviour,
+            .wall_clock_cntpct = conf.wall_clock_cntpct,
+            .merge_unconditional_branches = conf.HasOptimization(OptimizationFlag::BlockMerging),
+        });
         Optimization::Optimize(ir_block, conf, polyfill_options);
         return emitter.Emit(ir_block).entrypoint;
     }
 
+    static constexpr size_t CODE_CACHE_REGIONS = 8;
+
+    /// Space left before the code pointer runs into a live region of the cache.
+    size_t CodeSpaceRemaining() const {
+        if (!eviction_limit) {
+            return block_of_code.SpaceRemaining();
+        }
+        const u8* const current_ptr = block_of_code.getCurr<const u8*>();
+        return current_ptr < eviction_limit ? size_t(eviction_limit - current_ptr) : 0;
+    }
+
+    void ReclaimCodeSpace() {
+        const u8* const cache_begin = static_cast<const u8*>(block_of_code.GetCodeBegin());
+        const u8* const cache_end = block_of_code.getCode<const u8*>() + block_of_code.GetTotalCodeSize();
+        const size_t region_size = size_t(cache_end - cache_begin) / CODE_CACHE_REGIONS;
+        if (!conf.code_cache_eviction || region_size < 4 * MINIMUM_REMAINING_CODESIZE) {
+            // Immediately evacuate cache
+            invalidate_entire_cache = true;
+            PerformRequestedCacheInvalidation(HaltReason::CacheInvalidation);
+            return;
+        }
+
+        // The cache is filled front to back, so the region after the code pointer holds the code
+        // emitted the longest time ago. Once the end is reached the code pointer wraps around.
+        const bool wrap_around = !eviction_limit || eviction_limit == cache_end;
+        const u8* const region_begin = wrap_around ? cache_begin : eviction_limit;
+        const u8* const region_end = size_t(cache_end - region_begin) < 2 * region_size ? cache_end : region_begin + region_size;
+
+        jit_state.ResetRSB();
+        const size_t evicted_blocks = emitter.EvictCodeRange(region_begin, region_end);
+        if (wrap_around) {
+            block_of_code.SetCodePtr(region_begin);
+        }
+        eviction_limit = region_end;
+        conf.callbacks->CodeCacheEvicted(evicted_blocks, size_t(region_end - region_begin));
+    }
+
     void PerformRequestedCacheInvalidation(HaltReason hr) {
         if (Has(hr, HaltReason::CacheInvalidation)) {
             std::unique_lock lock{invalidation_mutex};
@@ -277,6 +374,7 @@ private:
             if (invalidate_entire_cache) {
                 block_of_code.ClearCache();
                 emitter.ClearCache();
+                eviction_limit = nullptr;
             } else {
                 emitter.InvalidateCacheRanges(invalid_cache_ranges);
             }
@@ -293,6 +391,8 @@ private:
     Optimization::PolyfillOptions polyfill_options;
     bool is_executing = false;
     bool invalidate_entire_cache = false;
+    /// End of the last evicted region, null until the code cache fills up for the first time
+    const u8* eviction_limit = nullptr;
     boost::icl::interval_set<u64> invalid_cache_ranges;
     std::mutex invalidation_mutex;
 };
@@ -318,6 +418,18 @@ void Jit::InvalidateCacheRange(u64 start_address, size_t length) {
     impl->InvalidateCacheRange(start_address, length);
 }
 
+std::vector<u64> Jit::GetCachedBlockLocations() const {
+    return impl->GetCachedBlockLocations();
+}
+
+std::vector<Jit::BlockProfile> Jit::GetBlockProfile() const {
+    return impl->GetBlockProfile();
+}
+
+void Jit::Precompile(std::span<const u64> locations) {
+    impl->Precompile(locations);
+}
+
 void Jit::Reset() {
     impl->Reset();
 }
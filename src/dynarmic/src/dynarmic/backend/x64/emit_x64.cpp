@@ -18,9 +18,9 @@
 
 #include "dynarmic/backend/x64/block_of_code.h"
 #include "dynarmic/backend/x64/nzcv_util.h"
-#include "dynarmic/backend/x64/perf_map.h"
 #include "dynarmic/backend/x64/stack_layout.h"
 #include "dynarmic/backend/x64/verbose_debugging_output.h"
+#include "dynarmic/common/perf_map.h"
 #include "dynarmic/ir/basic_block.h"
 #include "dynarmic/ir/microinstruction.h"
 #include "dynarmic/ir/opcodes.h"
@@ -55,6 +55,15 @@ std::optional<EmitX64::BlockDescriptor> EmitX64::GetBasicBlock(IR::LocationDescr
     return iter->second;
 }
 
+std::vector<IR::LocationDescriptor> EmitX64::GetBasicBlockLocations() const {
+    std::vector<IR::LocationDescriptor> locations;
+    locations.reserve(block_descriptors.size());
+    for (const auto& [location, block] : block_descriptors) {
+        locations.push_back(location);
+    }
+    return locations;
+}
+
 void EmitX64::EmitInvalid(EmitContext&, IR::Inst* inst) {
     UNREACHABLE();
 }
@@ -348,7 +357,7 @@ Xbyak::Label EmitX64::EmitCond(IR::Cond cond) {
 }
 
 EmitX64::BlockDescriptor EmitX64::RegisterBlock(const IR::LocationDescriptor& descriptor, CodePtr entrypoint, size_t size) {
-    PerfMapRegister(entrypoint, code.getCurr(), LocationDescriptorToFriendlyName(descriptor));
+    Common::PerfMapRegister(entrypoint, code.getCurr(), LocationDescriptorToFriendlyName(descriptor));
     Patch(descriptor, entrypoint);
 
     BlockDescriptor block_desc{entrypoint, size};
@@ -393,7 +402,7 @@ void EmitX64::ClearCache() {
     block_descriptors.clear();
     patch_information.clear();
 
-    PerfMapClear();
+    Common::PerfMapClear();
 }
 
 void EmitX64::InvalidateBasicBlocks(const ankerl::unordered_dense::set<IR::LocationDescriptor>& locations) {
@@ -407,4 +416,34 @@ void EmitX64::InvalidateBasicBlocks(const ankerl::unordered_dense::set<IR::Locat
     code.DisableWriting();
 }
 
+size_t EmitX64::EvictCodeRange(CodePtr begin, CodePtr end) {
+    const auto in_range = [begin, end](CodePtr ptr) {
+        return ptr >= begin && ptr < end;
+    };
+
+    ankerl::unordered_dense::set<IR::LocationDescriptor> locations;
+    for (const auto& [location, block] : block_descriptors) {
+        if (in_range(block.entrypoint)) {
+            locations.insert(location);
+        }
+    }
+    // Unlinks the callers of the evicted blocks, wherever they are
+    InvalidateBasicBlocks(locations);
+
+    // Patch locations within the range are about to be overwritten, they must never be patched again
+    for (auto iter = patch_information.begin(); iter != patch_information.end();) {
+        PatchInformation& patch_info = iter->second;
+        patch_info.jg.erase(std::remove_if(patch_info.jg.begin(), patch_info.jg.end(), in_range), patch_info.jg.end());
+        patch_info.jz.erase(std::remove_if(patch_info.jz.begin(), patch_info.jz.end(), in_range), patch_info.jz.end());
+        patch_info.jmp.erase(std::remove_if(patch_info.jmp.begin(), patch_info.jmp.end(), in_range), patch_info.jmp.end());
+        patch_info.mov_rcx.erase(std::remove_if(patch_info.mov_rcx.begin(), patch_info.mov_rcx.end(), in_range), patch_info.mov_rcx.end());
+        if (patch_info.jg.empty() && patch_info.jz.empty() && patch_info.jmp.empty() && patch_info.mov_rcx.empty()) {
+            iter = patch_information.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+    return locations.size();
+}
+
 }  // namespace Dynarmic::Backend::X64
@@ -84,12 +84,19 @@ public:
     /// Looks up an emitted host block in the cache.
     std::optional<BlockDescriptor> GetBasicBlock(IR::LocationDescriptor descriptor) const;
 
+    /// Returns the locations of all the emitted host blocks in the cache.
+    std::vector<IR::LocationDescriptor> GetBasicBlockLocations() const;
+
     /// Empties the entire cache.
     virtual void ClearCache();
 
     /// Invalidates a selection of basic blocks.
     void InvalidateBasicBlocks(const ankerl::unordered_dense::set<IR::LocationDescriptor>& locations);
 
+    /// Evicts the blocks whose entrypoint lies within [begin, end) so new code can be emitted over them.
+    /// Returns the number of evicted blocks.
+    virtual size_t EvictCodeRange(CodePtr begin, CodePtr end);
+
 //protected:
     // Microinstruction emitters
 #define OPCODE(name, type, ...) void Emit##name(EmitContext& ctx, IR::Inst* inst);
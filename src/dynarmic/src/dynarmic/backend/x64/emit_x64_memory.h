@@ -14,7 +14,6 @@
 #include "dynarmic/backend/x64/a32_emit_x64.h"
 #include "dynarmic/backend/x64/a64_emit_x64.h"
 #include "dynarmic/backend/x64/exclusive_monitor_friend.h"
-#include "dynarmic/common/spin_lock_x64.h"
 #include "dynarmic/interface/exclusive_monitor.h"
 #include "dynarmic/ir/acc_type.h"
 
@@ -167,9 +166,13 @@ template<>
 
 template<>
 [[maybe_unused]] Xbyak::RegExp EmitFastmemVAddr<A64EmitContext>(BlockOfCode& code, A64EmitContext& ctx, Xbyak::Label& abort, Xbyak::Reg64 vaddr, bool& require_abort_handling, std::optional<Xbyak::Reg64> tmp) {
+    // A null arena maps guest addresses to the same host addresses, no base is needed
+    auto const base = [&](Xbyak::Reg64 offset) -> Xbyak::RegExp {
+        return *ctx.conf.fastmem_pointer == 0 ? Xbyak::RegExp{offset} : r13 + offset;
+    };
     auto const unused_top_bits = 64 - ctx.conf.fastmem_address_space_bits;
     if (unused_top_bits == 0) {
-        return r13 + vaddr;
+        return base(vaddr);
     } else if (ctx.conf.silently_mirror_fastmem) {
         if (!tmp) {
             tmp = ctx.reg_alloc.ScratchGpr(code);
@@ -184,7 +187,7 @@ template<>
             code.mov(tmp->cvt32(), vaddr.cvt32());
             code.and_(*tmp, u32((1 << ctx.conf.fastmem_address_space_bits) - 1));
         }
-        return r13 + *tmp;
+        return base(*tmp);
     } else {
         if (ctx.conf.fastmem_address_space_bits < 32) {
             code.test(vaddr, u32(-(1 << ctx.conf.fastmem_address_space_bits)));
@@ -200,7 +203,7 @@ template<>
             code.jnz(abort, code.T_NEAR);
             require_abort_handling = true;
         }
-        return r13 + vaddr;
+        return base(vaddr);
     }
 }
 
@@ -344,44 +347,44 @@ const void* EmitWriteMemoryMov(BlockOfCode& code, const Xbyak::RegExp& addr, int
 }
 
 template<typename UserConfig>
-void EmitExclusiveLock(BlockOfCode& code, const UserConfig& conf, Xbyak::Reg64 pointer, Xbyak::Reg32 tmp) {
-    if (conf.HasOptimization(OptimizationFlag::Unsafe_IgnoreGlobalMonitor)) {
-        return;
-    }
-
-    code.mov(pointer, std::bit_cast<u64>(GetExclusiveMonitorLockPointer(conf.global_monitor)));
-    EmitSpinLockLock(code, pointer, tmp, code.HasHostFeature(HostFeature::WAITPKG));
+void EmitExclusiveLineVersionAddress(BlockOfCode& code, const UserConfig& conf, Xbyak::Reg64 vaddr, Xbyak::Reg64 pointer, Xbyak::Reg64 index) {
+    code.mov(index, vaddr);
+    code.shr(index, static_cast<int>(ExclusiveMonitor::LINE_SIZE_BITS));
+    code.and_(index.cvt32(), static_cast<u32>(ExclusiveMonitor::LINE_VERSION_COUNT - 1));
+    code.mov(pointer, std::bit_cast<u64>(GetExclusiveMonitorLineVersionsPointer(conf.global_monitor)));
 }
 
+/// Snapshots the version of the cache line containing vaddr into this processor's reservation.
+/// Must precede the read of the value.
 template<typename UserConfig>
-void EmitExclusiveUnlock(BlockOfCode& code, const UserConfig& conf, Xbyak::Reg64 pointer, Xbyak::Reg32 tmp) {
+void EmitExclusiveMarkVersion(BlockOfCode& code, const UserConfig& conf, Xbyak::Reg64 vaddr, Xbyak::Reg64 pointer, Xbyak::Reg64 tmp) {
     if (conf.HasOptimization(OptimizationFlag::Unsafe_IgnoreGlobalMonitor)) {
         return;
     }
 
-    code.mov(pointer, std::bit_cast<u64>(GetExclusiveMonitorLockPointer(conf.global_monitor)));
-    EmitSpinLockUnlock(code, pointer, tmp);
+    EmitExclusiveLineVersionAddress(code, conf, vaddr, pointer, tmp);
+    code.mov(tmp, qword[pointer + tmp * 8]);
+    code.mov(pointer, std::bit_cast<u64>(GetExclusiveMonitorVersionPointer(conf.global_monitor, conf.processor_id)));
+    code.mov(qword[pointer], tmp);
 }
 
+/// Bumps the version of the cache line containing vaddr if it still matches this processor's
+/// reservation, failing the reservations of every other processor on that line.
+/// Jumps to fail with status set to 1 if another processor got there first. Clobbers rax.
 template<typename UserConfig>
-void EmitExclusiveTestAndClear(BlockOfCode& code, const UserConfig& conf, Xbyak::Reg64 vaddr, Xbyak::Reg64 pointer, Xbyak::Reg64 tmp) {
+void EmitExclusiveClaimLine(BlockOfCode& code, const UserConfig& conf, Xbyak::Reg64 vaddr, Xbyak::Reg32 status, Xbyak::Reg64 pointer, Xbyak::Reg64 tmp, Xbyak::Label& fail) {
     if (conf.HasOptimization(OptimizationFlag::Unsafe_IgnoreGlobalMonitor)) {
         return;
     }
 
-    code.mov(tmp, 0xDEAD'DEAD'DEAD'DEAD);
-    const size_t processor_count = GetExclusiveMonitorProcessorCount(conf.global_monitor);
-    for (size_t processor_index = 0; processor_index < processor_count; processor_index++) {
-        if (processor_index == conf.processor_id) {
-            continue;
-        }
-        Xbyak::Label ok;
-        code.mov(pointer, std::bit_cast<u64>(GetExclusiveMonitorAddressPointer(conf.global_monitor, processor_index)));
-        code.cmp(qword[pointer], vaddr);
-        code.jne(ok, code.T_NEAR);
-        code.mov(qword[pointer], tmp);
-        code.L(ok);
-    }
+    code.mov(pointer, std::bit_cast<u64>(GetExclusiveMonitorVersionPointer(conf.global_monitor, conf.processor_id)));
+    code.mov(rax, qword[pointer]);
+    code.lea(status.cvt64(), ptr[rax + 1]);
+    EmitExclusiveLineVersionAddress(code, conf, vaddr, pointer, tmp);
+    code.lock();
+    code.cmpxchg(qword[pointer + tmp * 8], status.cvt64());
+    code.mov(status, u32(1));
+    code.jne(fail, code.T_NEAR);
 }
 
 inline bool IsOrdered(IR::AccType acctype) {
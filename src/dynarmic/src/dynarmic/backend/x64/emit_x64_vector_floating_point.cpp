@@ -222,6 +222,40 @@ void DenormalsAreZero(BlockOfCode& code, FP::FPCR fpcr, std::initializer_list<Xb
     }
 }
 
+/// x86 has no rounding mode for ties away from zero. Rounds the magnitude towards zero and adds one
+/// whenever the discarded fraction is at least a half, then restores the sign. Every step is exact,
+/// the truncation is the only instruction that reports an inexact result.
+/// Requires SSE4.1, and SSE4.2 when fsize == 64.
+template<size_t fsize>
+void EmitRoundTieAway(BlockOfCode& code, EmitContext& ctx, const Xbyak::Xmm& result, const Xbyak::Xmm& operand) {
+    using FPT = mcl::unsigned_integer_of_size<fsize>;
+    // Every value of at least this magnitude is already integral
+    constexpr int integral_exponent = static_cast<int>(FP::FPInfo<FPT>::explicit_mantissa_width);
+    constexpr FPT largest_below_half = FP::FPValue<FPT, false, -1, 1>() - 1;
+
+    const Xbyak::Xmm fraction = xmm0;
+    const Xbyak::Xmm sign = ctx.reg_alloc.ScratchXmm(code);
+    const Xbyak::Xmm truncated = ctx.reg_alloc.ScratchXmm(code);
+
+    code.movaps(sign, GetNegativeZeroVector<fsize>(code));
+    code.andps(sign, operand);
+    code.movaps(fraction, GetNonSignMaskVector<fsize>(code));
+    code.andps(fraction, operand);
+    FCODE(roundp)(result, fraction, u8(0b11));
+
+    // Clamping both sides keeps infinities and NaNs from reaching the subtraction, their fraction is zero
+    code.movaps(truncated, result);
+    FCODE(minp)(truncated, GetVectorOf<fsize, false, integral_exponent, 1>(code));
+    FCODE(minp)(fraction, GetVectorOf<fsize, false, integral_exponent, 1>(code));
+    FCODE(subp)(fraction, truncated);
+
+    // The fraction is a non-negative value (or negative zero), compare its bits as integers
+    ICODE(pcmpgt)(fraction, GetVectorOf<fsize, largest_below_half>(code));
+    code.andps(fraction, GetVectorOf<fsize, false, 0, 1>(code));
+    FCODE(addp)(result, fraction);
+    code.orps(result, sign);
+}
+
 template<typename T>
 struct DefaultIndexer {
     std::tuple<T> operator()(size_t i, const VectorArray<T>& a) {
@@ -1656,13 +1690,20 @@ void EmitFPVectorRoundInt(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
     const bool exact = inst->GetArg(2).GetU1();
 
     if constexpr (fsize != 16) {
-        if (code.HasHostFeature(HostFeature::SSE41) && rounding != FP::RoundingMode::ToNearest_TieAwayFromZero && !exact) {
+        // roundp reports inexact results through the precision flag, which is all exact adds
+        if (code.HasHostFeature(HostFeature::SSE41) && rounding != FP::RoundingMode::ToNearest_TieAwayFromZero) {
             const auto round_imm = ConvertRoundingModeToX64Immediate(rounding);
             EmitTwoOpVectorOperation<fsize, DefaultIndexer, 3>(code, ctx, inst, [&](const Xbyak::Xmm& result, const Xbyak::Xmm& xmm_a) {
                 FCODE(roundp)(result, xmm_a, *round_imm);
             });
             return;
         }
+        if (code.HasHostFeature(fsize == 32 ? HostFeature::SSE41 : HostFeature::SSE42)) {
+            EmitTwoOpVectorOperation<fsize, DefaultIndexer, 3>(code, ctx, inst, [&](const Xbyak::Xmm& result, const Xbyak::Xmm& xmm_a) {
+                EmitRoundTieAway<fsize>(code, ctx, result, xmm_a);
+            });
+            return;
+        }
     }
 
     // Do not make a LUT out of this, let the compiler do it's thing
@@ -1988,7 +2029,8 @@ void EmitFPVectorToFixed(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
     const auto rounding = FP::RoundingMode(inst->GetArg(2).GetU8());
     [[maybe_unused]] const bool fpcr_controlled = inst->GetArg(3).GetU1();
 
-    if (code.HasHostFeature(HostFeature::SSE41) && fsize != 16 && rounding != FP::RoundingMode::ToNearest_TieAwayFromZero) {
+    const bool supports_rounding = rounding != FP::RoundingMode::ToNearest_TieAwayFromZero || fsize == 32 || code.HasHostFeature(HostFeature::SSE42);
+    if (code.HasHostFeature(HostFeature::SSE41) && fsize != 16 && supports_rounding) {
         auto args = ctx.reg_alloc.GetArgumentInfo(inst);
         const Xbyak::Xmm src = ctx.reg_alloc.UseScratchXmm(code, args[0]);
         MaybeStandardFPSCRValue(code, ctx, fpcr_controlled, [&] {
@@ -2024,7 +2066,11 @@ void EmitFPVectorToFixed(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
                 FCODE(mulp)(src, GetVectorOf<fsize>(code, scale_factor));
             }
 
-            FCODE(roundp)(src, src, u8(*round_imm));
+            if (rounding == FP::RoundingMode::ToNearest_TieAwayFromZero) {
+                EmitRoundTieAway<fsize>(code, ctx, src, src);
+            } else {
+                FCODE(roundp)(src, src, u8(*round_imm));
+            }
             const Xbyak::Xmm nan_mask = xmm0;
             if (code.HasHostFeature(HostFeature::AVX512_OrthoFloat)) {
                 static constexpr u32 nan_to_zero = FixupLUT(FpFixup::PosZero, FpFixup::PosZero);
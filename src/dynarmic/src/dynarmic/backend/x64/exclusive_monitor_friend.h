@@ -9,15 +9,11 @@
 
 namespace Dynarmic {
 
-inline volatile int* GetExclusiveMonitorLockPointer(ExclusiveMonitor* monitor) {
-    return &monitor->lock.storage;
-}
-
 inline size_t GetExclusiveMonitorProcessorCount(ExclusiveMonitor* monitor) {
-    return monitor->exclusive_addresses.size();
+    return monitor->processor_count;
 }
 
-inline VAddr* GetExclusiveMonitorAddressPointer(ExclusiveMonitor* monitor, size_t index) {
+inline std::atomic<VAddr>* GetExclusiveMonitorAddressPointer(ExclusiveMonitor* monitor, size_t index) {
     return monitor->exclusive_addresses.data() + index;
 }
 
@@ -25,4 +21,12 @@ inline Vector* GetExclusiveMonitorValuePointer(ExclusiveMonitor* monitor, size_t
     return monitor->exclusive_values.data() + index;
 }
 
+inline std::uint64_t* GetExclusiveMonitorVersionPointer(ExclusiveMonitor* monitor, size_t index) {
+    return monitor->exclusive_versions.data() + index;
+}
+
+inline std::atomic<std::uint64_t>* GetExclusiveMonitorLineVersionsPointer(ExclusiveMonitor* monitor) {
+    return monitor->line_versions.data();
+}
+
 }  // namespace Dynarmic
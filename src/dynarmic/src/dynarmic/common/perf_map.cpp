@@ -10,7 +10,7 @@
 #include <string>
 #include <fmt/format.h>
 
-#include "dynarmic/backend/x64/perf_map.h"
+#include "dynarmic/common/perf_map.h"
 #include "common/common_types.h"
 #if defined(__linux__) && !defined(__ANDROID__)
 #    include <cstdio>
@@ -19,7 +19,7 @@
 #    include <sys/types.h>
 #    include <unistd.h>
 
-namespace Dynarmic::Backend::X64 {
+namespace Dynarmic::Common {
 
 namespace {
 std::mutex mutex;
@@ -77,6 +77,6 @@ void PerfMapClear() {
     OpenFile();
 }
 
-}  // namespace Dynarmic::Backend::X64
+}  // namespace Dynarmic::Common
 
 #endif
@@ -12,7 +12,7 @@
 
 #include <bit>
 
-namespace Dynarmic::Backend::X64 {
+namespace Dynarmic::Common {
 
 #if defined(__linux__) && !defined(__ANDROID__)
 namespace detail {
@@ -29,4 +29,4 @@ template<typename T> inline void PerfMapRegister(T, const void*, std::string_vie
 inline void PerfMapClear() noexcept {}
 #endif
 
-}  // namespace Dynarmic::Backend::X64
+}  // namespace Dynarmic::Common
@@ -38,6 +38,10 @@ struct TranslationOptions {
     /// If this is false, we treat the instruction as a NOP.
     /// If this is true, we emit an ExceptionRaised instruction.
     bool hook_hint_instructions = true;
+
+    /// This tells the translator to continue through short unconditional forward branches
+    /// instead of ending the block on them.
+    bool merge_unconditional_branches = false;
 };
 
 /**
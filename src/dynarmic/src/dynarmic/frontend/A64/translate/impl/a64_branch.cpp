@@ -28,6 +28,16 @@ bool TranslatorVisitor::B_uncond(Imm<26> imm26) {
         ir.SetTerm(IR::Term::LinkBlock{ir.current_location->SetPC(target)});
         return false;
     }
+    // Merge short forward jumps into the block, the block range then still covers every
+    // translated instruction and invalidation of the skipped ones is merely conservative
+    static constexpr u64 MAX_MERGE_DISTANCE = 256;
+    static constexpr size_t MAX_MERGED_BRANCHES = 4;
+    if (options.merge_unconditional_branches && !ir.current_location->SingleStepping() && target > ir.PC() && target - ir.PC() <= MAX_MERGE_DISTANCE && merged_branches < MAX_MERGED_BRANCHES) {
+        ++merged_branches;
+        // The translation loop advances past this instruction
+        ir.current_location = ir.current_location->SetPC(target - 4);
+        return true;
+    }
     ir.SetTerm(IR::Term::LinkBlockFast{ir.current_location->SetPC(target)});
     return false;
 }
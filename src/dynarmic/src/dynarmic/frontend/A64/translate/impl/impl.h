@@ -26,6 +26,7 @@ struct TranslatorVisitor final {
 
     A64::IREmitter ir;
     TranslationOptions options;
+    size_t merged_branches = 0;
 
     bool UnpredictableInstruction();
     bool DecodeError();
@@ -12,6 +12,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -51,6 +52,33 @@ public:
      */
     void InvalidateCacheRange(std::uint64_t start_address, std::size_t length);
 
+    /**
+     * Returns the location of every block currently in the code cache.
+     * Locations are opaque and only meaningful to Precompile, they can be persisted across runs.
+     */
+    std::vector<std::uint64_t> GetCachedBlockLocations() const;
+
+    /**
+     * Compile the blocks at the given locations ahead of their execution.
+     * Locations whose code cannot be read are skipped. Cannot be called from a callback.
+     * @param locations Locations previously returned by GetCachedBlockLocations.
+     */
+    void Precompile(std::span<const std::uint64_t> locations);
+
+    struct BlockProfile {
+        std::uint64_t pc;          ///< Guest address of the first instruction of the block.
+        std::uint64_t end_pc;      ///< Guest address one past the last instruction of the block.
+        std::uint64_t cycles;      ///< Guest cycles of a single execution of the block.
+        std::uint64_t executions;  ///< Number of times the block was entered.
+    };
+
+    /**
+     * Returns the execution counts of every block compiled since the Jit was created,
+     * including blocks that have since been evicted from the code cache.
+     * Empty unless UserConfig::enable_block_profiling is set. Cannot be called from a callback.
+     */
+    std::vector<BlockProfile> GetBlockProfile() const;
+
     /**
      * Reset CPU state to state at startup. Does not clear code cache.
      * Cannot be called from a callback.
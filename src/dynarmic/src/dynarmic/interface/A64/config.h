@@ -126,6 +126,9 @@ struct UserCallbacks {
     virtual void InstructionCacheOperationRaised(InstructionCacheOperation /*op*/, VAddr /*value*/) {}
     virtual void InstructionSynchronizationBarrierRaised() {}
 
+    // This callback is called whenever blocks are evicted to make room in a full code cache.
+    virtual void CodeCacheEvicted(std::size_t /*evicted_blocks*/, std::size_t /*evicted_bytes*/) {}
+
     // Timing-related callbacks
     // ticks ticks have passed
     virtual void AddTicks(std::uint64_t ticks) = 0;
@@ -141,6 +144,8 @@ struct UserConfig {
     /// address space which is in arranged just like what you wish for emulated memory to
     /// be. If the host page faults on an address, the JIT will fallback to calling the
     /// MemoryRead*/MemoryWrite* callbacks.
+    /// A pointer of zero means guest addresses are host addresses; on x64 this frees the
+    /// register otherwise holding the base and shortens the encoding of every access.
     std::optional<std::uintptr_t> fastmem_pointer = std::nullopt;
 
     UserCallbacks* callbacks;
@@ -206,6 +211,21 @@ struct UserConfig {
     // Maximum size is limited by the maximum length of a x86_64 / arm64 jump.
     std::uint32_t code_cache_size = 128 * 1024 * 1024;  // bytes
 
+    /// When a block misses the code cache, also compile the blocks it directly links to.
+    /// The thread is already stalled on the compilation, and the successors are then linked
+    /// right away instead of missing on their first execution.
+    bool precompile_successors = false;
+
+    /// When the code cache fills, only evict the blocks in its oldest region instead of clearing
+    /// it entirely. The callers of the evicted blocks are unlinked, the rest of the cache is kept.
+    /// Only supported on x64 hosts, other hosts always clear the entire cache.
+    bool code_cache_eviction = false;
+
+    /// Count the executions of every compiled block, see Jit::GetBlockProfile.
+    /// Each block entry increments a counter in memory, so this has a small runtime cost.
+    /// Only supported on x64 hosts, other hosts report an empty profile.
+    bool enable_block_profiling = false;
+
     /// Determines if we should detect memory accesses via page_table that straddle are
     /// misaligned. Accesses that straddle page boundaries will fallback to the relevant
     /// memory callback.
@@ -9,18 +9,21 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
-#include <boost/container/static_vector.hpp>
-
-#include <dynarmic/common/spin_lock.h>
+#include <type_traits>
 
 namespace Dynarmic {
 
 using VAddr = std::uint64_t;
 using Vector = std::array<std::uint64_t, 2>;
 
+/// Global exclusive monitor shared by all processors.
+/// Every cache line hashes to a version counter. A reservation remembers the version of its
+/// line, and an exclusive write only succeeds if it is the first to bump that version. This
+/// needs no lock: contention is limited to processors touching lines of the same bucket.
 class ExclusiveMonitor {
 public:
     /// @param processor_count Maximum number of processors using this global
@@ -37,11 +40,12 @@ public:
         static_assert(std::is_trivially_copyable_v<T>);
         const VAddr masked_address = address & RESERVATION_GRANULE_MASK;
 
-        Lock();
-        exclusive_addresses[processor_id] = masked_address;
+        // The version is observed before the value, so a write racing with the read fails
+        // the reservation instead of being missed.
+        exclusive_versions[processor_id] = LineVersion(masked_address).load(std::memory_order_acquire);
+        exclusive_addresses[processor_id].store(masked_address, std::memory_order_relaxed);
         const T value = op();
         std::memcpy(exclusive_values[processor_id].data(), &value, sizeof(T));
-        Unlock();
         return value;
     }
 
@@ -49,6 +53,8 @@ public:
     /// specified region. If it does, executes the operation then clears
     /// the exclusive state for processors if their exclusive region(s)
     /// contain [address, address+size).
+    /// op must store with a compare-exchange against the value it is given: the line version is
+    /// bumped before the store lands, so a reservation taken in between still sees the old value.
     template<typename T, typename Function>
         requires std::is_trivially_copyable_v<T>
     bool DoExclusiveOperation(size_t processor_id, VAddr address, Function op) {
@@ -58,10 +64,7 @@ public:
 
         T saved_value;
         std::memcpy(&saved_value, exclusive_values[processor_id].data(), sizeof(T));
-        const bool result = op(saved_value);
-
-        Unlock();
-        return result;
+        return op(saved_value);
     }
 
     /// Unmark everything.
@@ -72,20 +75,29 @@ public:
 private:
     bool CheckAndClear(size_t processor_id, VAddr address);
 
-    void Lock();
-    void Unlock();
+    std::atomic<std::uint64_t>& LineVersion(VAddr address) {
+        return line_versions[(address >> LINE_SIZE_BITS) % LINE_VERSION_COUNT];
+    }
 
-    friend volatile int* GetExclusiveMonitorLockPointer(ExclusiveMonitor*);
     friend size_t GetExclusiveMonitorProcessorCount(ExclusiveMonitor*);
-    friend VAddr* GetExclusiveMonitorAddressPointer(ExclusiveMonitor*, size_t index);
+    friend std::atomic<VAddr>* GetExclusiveMonitorAddressPointer(ExclusiveMonitor*, size_t index);
     friend Vector* GetExclusiveMonitorValuePointer(ExclusiveMonitor*, size_t index);
+    friend std::uint64_t* GetExclusiveMonitorVersionPointer(ExclusiveMonitor*, size_t index);
+    friend std::atomic<std::uint64_t>* GetExclusiveMonitorLineVersionsPointer(ExclusiveMonitor*);
 
+public:
     static constexpr VAddr RESERVATION_GRANULE_MASK = 0xFFFF'FFFF'FFFF'FFFFull;
     static constexpr VAddr INVALID_EXCLUSIVE_ADDRESS = 0xDEAD'DEAD'DEAD'DEADull;
+    static constexpr size_t LINE_SIZE_BITS = 6;
+    static constexpr size_t LINE_VERSION_COUNT = 4096;
+
+private:
     static constexpr size_t MAX_NUM_CPU_CORES = 4; // Sync with src/core/hardware_properties
-    boost::container::static_vector<VAddr, MAX_NUM_CPU_CORES> exclusive_addresses;
-    boost::container::static_vector<Vector, MAX_NUM_CPU_CORES> exclusive_values;
-    SpinLock lock;
+    size_t processor_count;
+    std::array<std::atomic<VAddr>, MAX_NUM_CPU_CORES> exclusive_addresses;
+    std::array<std::uint64_t, MAX_NUM_CPU_CORES> exclusive_versions{};
+    std::array<Vector, MAX_NUM_CPU_CORES> exclusive_values{};
+    alignas(64) std::array<std::atomic<std::uint64_t>, LINE_VERSION_COUNT> line_versions{};
 };
 
 }  // namespace Dynarmic
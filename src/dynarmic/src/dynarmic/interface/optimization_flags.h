@@ -39,6 +39,11 @@ enum class OptimizationFlag : std::uint32_t {
     CodeSpeed = 0x00000040,
     /// Disable verification passes
     DisableVerification = 0x00000080,
+    /// This optimization continues translation through short unconditional forward branches,
+    /// merging the destination into the current basic block. This avoids a block link and
+    /// lets the IR optimizations work across both sides of the branch.
+    /// This is a safe optimization.
+    BlockMerging = 0x00000100,
 
     /// This is an UNSAFE optimization that reduces accuracy of fused multiply-add operations.
     /// This unfuses fused instructions to improve performance on host CPUs without FMA support.
@@ -35,8 +35,7 @@ namespace Dynarmic::Optimization {
 static void ConstantMemoryReads(IR::Block& block, A32::UserCallbacks* cb) {
     for (auto& inst : block.instructions) {
         switch (inst.GetOpcode()) {
-        case IR::Opcode::A32ReadMemory8:
-        case IR::Opcode::A64ReadMemory8: {
+        case IR::Opcode::A32ReadMemory8: {
             if (inst.AreAllArgsImmediates()) {
                 const u32 vaddr = inst.GetArg(1).GetU32();
                 if (cb->IsReadOnlyMemory(vaddr)) {
@@ -46,8 +45,7 @@ static void ConstantMemoryReads(IR::Block& block, A32::UserCallbacks* cb) {
             }
             break;
         }
-        case IR::Opcode::A32ReadMemory16:
-        case IR::Opcode::A64ReadMemory16: {
+        case IR::Opcode::A32ReadMemory16: {
             if (inst.AreAllArgsImmediates()) {
                 const u32 vaddr = inst.GetArg(1).GetU32();
                 if (cb->IsReadOnlyMemory(vaddr)) {
@@ -57,8 +55,7 @@ static void ConstantMemoryReads(IR::Block& block, A32::UserCallbacks* cb) {
             }
             break;
         }
-        case IR::Opcode::A32ReadMemory32:
-        case IR::Opcode::A64ReadMemory32: {
+        case IR::Opcode::A32ReadMemory32: {
             if (inst.AreAllArgsImmediates()) {
                 const u32 vaddr = inst.GetArg(1).GetU32();
                 if (cb->IsReadOnlyMemory(vaddr)) {
@@ -68,8 +65,7 @@ static void ConstantMemoryReads(IR::Block& block, A32::UserCallbacks* cb) {
             }
             break;
         }
-        case IR::Opcode::A32ReadMemory64:
-        case IR::Opcode::A64ReadMemory64: {
+        case IR::Opcode::A32ReadMemory64: {
             if (inst.AreAllArgsImmediates()) {
                 const u32 vaddr = inst.GetArg(1).GetU32();
                 if (cb->IsReadOnlyMemory(vaddr)) {
@@ -85,6 +81,41 @@ static void ConstantMemoryReads(IR::Block& block, A32::UserCallbacks* cb) {
     }
 }
 
+/// Returns true if any read was folded, in which case another constant propagation pass may
+/// simplify the block further.
+static bool A64ConstantMemoryReads(IR::Block& block, A64::UserCallbacks* cb) {
+    bool folded = false;
+    const auto fold = [&](IR::Inst& inst, auto read) {
+        if (!inst.AreAllArgsImmediates()) {
+            return;
+        }
+        const u64 vaddr = inst.GetArg(1).GetU64();
+        if (cb->IsReadOnlyMemory(vaddr)) {
+            inst.ReplaceUsesWith(IR::Value{read(vaddr)});
+            folded = true;
+        }
+    };
+    for (auto& inst : block.instructions) {
+        switch (inst.GetOpcode()) {
+        case IR::Opcode::A64ReadMemory8:
+            fold(inst, [cb](u64 vaddr) { return cb->MemoryRead8(vaddr); });
+            break;
+        case IR::Opcode::A64ReadMemory16:
+            fold(inst, [cb](u64 vaddr) { return cb->MemoryRead16(vaddr); });
+            break;
+        case IR::Opcode::A64ReadMemory32:
+            fold(inst, [cb](u64 vaddr) { return cb->MemoryRead32(vaddr); });
+            break;
+        case IR::Opcode::A64ReadMemory64:
+            fold(inst, [cb](u64 vaddr) { return cb->MemoryRead64(vaddr); });
+            break;
+        default:
+            break;
+        }
+    }
+    return folded;
+}
+
 static void FlagsPass(IR::Block& block) {
     using Iterator = typename std::reverse_iterator<IR::Block::iterator>;
 
@@ -544,6 +575,20 @@ static void A64GetSetElimination(IR::Block& block) {
                 ir.SetInsertionPointBefore(&*get_inst);
                 get_inst->ReplaceUsesWith(ir.LeastSignificantWord(IR::U64{info.register_value}));
             }
+        } else if (!info.register_value.IsEmpty()
+            && info.set_instruction_present
+            && tracking_type == TrackingType::X
+            && info.tracking_type == TrackingType::W) {
+            // A sequence like
+            // SetW r1 -> GetX r1, reads the zero extended value written by the 32-bit set.
+            // This does not apply to a tracked GetW, its upper half is unknown.
+            if (info.register_value.IsImmediate()) {
+                ReplaceUsesWith(*get_inst, false, u32(info.register_value.GetImmediateAsU64()));
+            } else {
+                A64::IREmitter ir{block};
+                ir.SetInsertionPointBefore(&*get_inst);
+                get_inst->ReplaceUsesWith(ir.ZeroExtendWordToLong(IR::U32{info.register_value}));
+            }
         } else {
             info = {};
             info.register_value = IR::Value(&*get_inst);
@@ -1470,7 +1515,11 @@ void Optimize(IR::Block& block, const A64::UserConfig& conf, const Optimization:
         Optimization::DeadCodeElimination(block);
     }
     if (conf.HasOptimization(OptimizationFlag::ConstProp)) {
+        // Propagate first so that ADRP + LDR sequences end up with an immediate address
         Optimization::ConstantPropagation(block);
+        if (Optimization::A64ConstantMemoryReads(block, conf.callbacks)) {
+            Optimization::ConstantPropagation(block);
+        }
         Optimization::DeadCodeElimination(block);
     }
     Optimization::IdentityRemovalPass(block);
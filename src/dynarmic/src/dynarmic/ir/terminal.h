@@ -115,6 +115,24 @@ struct CheckHalt {
     Terminal else_;
 };
 
+/// Calls func with the location of every block the terminal links to directly.
+template<typename Func>
+void ForEachLinkTarget(const Terminal& terminal, Func&& func) {
+    if (const auto* link = boost::get<LinkBlock>(&terminal)) {
+        func(link->next);
+    } else if (const auto* link_fast = boost::get<LinkBlockFast>(&terminal)) {
+        func(link_fast->next);
+    } else if (const auto* if_ = boost::get<If>(&terminal)) {
+        ForEachLinkTarget(if_->then_, func);
+        ForEachLinkTarget(if_->else_, func);
+    } else if (const auto* check_bit = boost::get<CheckBit>(&terminal)) {
+        ForEachLinkTarget(check_bit->then_, func);
+        ForEachLinkTarget(check_bit->else_, func);
+    } else if (const auto* check_halt = boost::get<CheckHalt>(&terminal)) {
+        ForEachLinkTarget(check_halt->else_, func);
+    }
+}
+
 }  // namespace Term
 
 using Term::Terminal;
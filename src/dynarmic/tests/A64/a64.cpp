@@ -2632,3 +2632,26 @@ TEST_CASE("A64: Rounding", "[a64]") {
     CHECK(jit.GetVector(5) == Vector{0x4000000040000000, 0x4000000040000000});
     CHECK(jit.GetVector(6) == Vector{0x4000000040000000, 0x4000000040000000});
 }
+
+TEST_CASE("A64: Rounding ties away from zero", "[a64]") {
+    A64TestEnv env;
+    A64::UserConfig jit_user_config{};
+    jit_user_config.callbacks = &env;
+    A64::Jit jit{jit_user_config};
+
+    oaknut::VectorCodeGenerator code{env.code_mem, nullptr};
+
+    code.FRINTA(V2.S4(), V0.S4());
+    code.FRINTA(V3.D2(), V1.D2());
+    code.FCVTAS(V4.S4(), V0.S4());
+
+    jit.SetPC(0);
+    jit.SetVector(0, {0xc020000040200000, 0x7f800000be800000});  // 2.5, -2.5, -0.25, +inf
+    jit.SetVector(1, {0x3fe0000000000000, 0xbff8000000000000});  // 0.5, -1.5
+    env.ticks_left = env.code_mem.size();
+    CheckedRun([&]() { jit.Run(); });
+
+    CHECK(jit.GetVector(2) == Vector{0xc040000040400000, 0x7f80000080000000});  // 3.0, -3.0, -0.0, +inf
+    CHECK(jit.GetVector(3) == Vector{0x3ff0000000000000, 0xc000000000000000});  // 1.0, -2.0
+    CHECK(jit.GetVector(4) == Vector{0xfffffffd00000003, 0x7fffffff00000000});  // 3, -3, 0, INT32_MAX
+}
@@ -115,3 +115,33 @@ TEST_CASE("ensure fast dispatch entry is cleared even when a block does not have
     CheckedRun([&]() { jit.Run(); });
     REQUIRE(jit.GetRegister(0) == 69);
 }
+
+TEST_CASE("ensure invalidating the destination of a merged branch recompiles the block", "[a64]") {
+    A64TestEnv env;
+    A64::UserConfig conf{};
+    conf.callbacks = &env;
+    A64::Jit jit{conf};
+
+    REQUIRE(conf.HasOptimization(OptimizationFlag::BlockMerging));
+
+    env.code_mem.emplace_back(0xd2800020);  // MOV X0, 1
+    env.code_mem.emplace_back(0x14000002);  // B +8
+    env.code_mem.emplace_back(0xd2800040);  // MOV X0, 2
+    env.code_mem.emplace_back(0x91000400);  // ADD X0, X0, 1
+    env.code_mem.emplace_back(0x14000000);  // B .
+
+    jit.SetPC(0);
+    env.ticks_left = 4;
+    CheckedRun([&]() { jit.Run(); });
+    REQUIRE(jit.GetRegister(0) == 2);
+    REQUIRE(jit.GetPC() == 16);
+
+    env.code_mem[3] = 0x91000800;  // ADD X0, X0, 2
+    jit.InvalidateCacheRange(12, 4);
+
+    jit.SetPC(0);
+    env.ticks_left = 4;
+    CheckedRun([&]() { jit.Run(); });
+    REQUIRE(jit.GetRegister(0) == 3);
+    REQUIRE(jit.GetPC() == 16);
+}
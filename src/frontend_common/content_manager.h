@@ -143,22 +143,12 @@ inline InstallResult InstallNSP(Core::System& system, FileSys::VfsFilesystem& vf
         if (src == nullptr || dest == nullptr) {
             return false;
         }
-        if (!dest->Resize(src->GetSize())) {
-            return false;
-        }
-
-        using namespace Common::Literals;
-        std::vector<u8> buffer(1_MiB);
 
-        for (std::size_t i = 0; i < src->GetSize(); i += buffer.size()) {
-            if (callback(src->GetSize(), i)) {
-                dest->Resize(0);
-                return false;
-            }
-            const auto read = src->Read(buffer.data(), buffer.size(), i);
-            dest->Write(buffer.data(), read, i);
-        }
-        return true;
+        const auto size = src->GetSize();
+        return FileSys::VfsPipelinedCopy(src, dest, block_size,
+                                         [&callback, size](std::size_t copied) {
+                                             return callback(size, copied);
+                                         });
     };
 
     std::shared_ptr<FileSys::NSP> nsp;
@@ -209,22 +199,12 @@ inline InstallResult InstallNCA(FileSys::VfsFilesystem& vfs, const std::string&
         if (src == nullptr || dest == nullptr) {
             return false;
         }
-        if (!dest->Resize(src->GetSize())) {
-            return false;
-        }
-
-        using namespace Common::Literals;
-        std::vector<u8> buffer(1_MiB);
 
-        for (std::size_t i = 0; i < src->GetSize(); i += buffer.size()) {
-            if (callback(src->GetSize(), i)) {
-                dest->Resize(0);
-                return false;
-            }
-            const auto read = src->Read(buffer.data(), buffer.size(), i);
-            dest->Write(buffer.data(), read, i);
-        }
-        return true;
+        const auto size = src->GetSize();
+        return FileSys::VfsPipelinedCopy(src, dest, block_size,
+                                         [&callback, size](std::size_t copied) {
+                                             return callback(size, copied);
+                                         });
     };
 
     const auto nca =
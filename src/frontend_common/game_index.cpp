@@ -0,0 +1,212 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <cstring>
+#include <system_error>
+
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/logging.h"
+#include "frontend_common/game_index.h"
+
+namespace FrontendCommon {
+
+namespace {
+
+constexpr u32 IndexMagic = 0x58444947; // GIDX
+constexpr u32 IndexVersion = 1;
+
+class Writer {
+public:
+    template <typename T>
+    void Put(const T& value) {
+        const auto offset = data.size();
+        data.resize(offset + sizeof(T));
+        std::memcpy(data.data() + offset, &value, sizeof(T));
+    }
+
+    void PutBytes(const void* bytes, size_t size) {
+        Put(static_cast<u32>(size));
+        const auto offset = data.size();
+        data.resize(offset + size);
+        if (size != 0) {
+            std::memcpy(data.data() + offset, bytes, size);
+        }
+    }
+
+    std::vector<u8> data;
+};
+
+class Reader {
+public:
+    explicit Reader(const std::vector<u8>& data_) : data{data_} {}
+
+    template <typename T>
+    bool Get(T& value) {
+        if (data.size() - offset < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&value, data.data() + offset, sizeof(T));
+        offset += sizeof(T);
+        return true;
+    }
+
+    template <typename Container>
+    bool GetBytes(Container& out) {
+        u32 size{};
+        if (!Get(size) || data.size() - offset < size) {
+            return false;
+        }
+        out.resize(size);
+        if (size != 0) {
+            std::memcpy(out.data(), data.data() + offset, size);
+        }
+        offset += size;
+        return true;
+    }
+
+private:
+    const std::vector<u8>& data;
+    size_t offset{};
+};
+
+} // Anonymous namespace
+
+GameIndex::GameIndex(std::filesystem::path path_) : path{std::move(path_)} {}
+
+GameIndex::~GameIndex() = default;
+
+void GameIndex::Load() {
+    std::scoped_lock lk{mutex};
+    records.clear();
+
+    if (!Common::FS::Exists(path)) {
+        return;
+    }
+
+    Common::FS::IOFile file{path, Common::FS::FileAccessMode::Read,
+                            Common::FS::FileType::BinaryFile};
+    if (!file.IsOpen()) {
+        LOG_ERROR(Frontend, "Failed to open game index: {}", Common::FS::PathToUTF8String(path));
+        return;
+    }
+
+    std::vector<u8> data(file.GetSize());
+    if (file.ReadSpan<u8>(data) != data.size()) {
+        return;
+    }
+
+    Reader reader{data};
+    u32 magic{};
+    u32 version{};
+    u32 num_records{};
+    if (!reader.Get(magic) || !reader.Get(version) || !reader.Get(num_records) ||
+        magic != IndexMagic || version != IndexVersion) {
+        return;
+    }
+
+    records.reserve(num_records);
+    for (u32 i = 0; i < num_records; ++i) {
+        std::string file_path;
+        Entry entry;
+        u32 file_type{};
+        u8 multi_program{};
+        u32 num_programs{};
+        if (!reader.GetBytes(file_path) || !reader.Get(entry.size) ||
+            !reader.Get(entry.modified_time) || !reader.Get(file_type) ||
+            !reader.Get(multi_program) || !reader.Get(num_programs)) {
+            LOG_WARNING(Frontend, "Game index is truncated, discarding it");
+            records.clear();
+            return;
+        }
+        entry.file_type = static_cast<Loader::FileType>(file_type);
+        entry.multi_program = multi_program != 0;
+
+        entry.programs.resize(num_programs);
+        for (auto& program : entry.programs) {
+            if (!reader.Get(program.program_id) || !reader.GetBytes(program.name) ||
+                !reader.GetBytes(program.icon)) {
+                LOG_WARNING(Frontend, "Game index is truncated, discarding it");
+                records.clear();
+                return;
+            }
+        }
+        records.insert_or_assign(std::move(file_path), Record{std::move(entry), false});
+    }
+}
+
+bool GameIndex::Save() {
+    Writer writer;
+    {
+        std::scoped_lock lk{mutex};
+
+        u32 num_records{};
+        for (const auto& [file_path, record] : records) {
+            num_records += record.seen ? 1 : 0;
+        }
+
+        writer.Put(IndexMagic);
+        writer.Put(IndexVersion);
+        writer.Put(num_records);
+        for (const auto& [file_path, record] : records) {
+            if (!record.seen) {
+                continue;
+            }
+            const auto& entry = record.entry;
+            writer.PutBytes(file_path.data(), file_path.size());
+            writer.Put(entry.size);
+            writer.Put(entry.modified_time);
+            writer.Put(static_cast<u32>(entry.file_type));
+            writer.Put(static_cast<u8>(entry.multi_program ? 1 : 0));
+            writer.Put(static_cast<u32>(entry.programs.size()));
+            for (const auto& program : entry.programs) {
+                writer.Put(program.program_id);
+                writer.PutBytes(program.name.data(), program.name.size());
+                writer.PutBytes(program.icon.data(), program.icon.size());
+            }
+        }
+    }
+
+    void(Common::FS::CreateParentDirs(path));
+
+    Common::FS::IOFile file{path, Common::FS::FileAccessMode::Write,
+                            Common::FS::FileType::BinaryFile};
+    if (!file.IsOpen()) {
+        LOG_ERROR(Frontend, "Failed to open game index: {}", Common::FS::PathToUTF8String(path));
+        return false;
+    }
+
+    return file.WriteSpan<u8>(writer.data) == writer.data.size();
+}
+
+std::optional<GameIndex::Entry> GameIndex::Find(const std::string& file_path, u64 size,
+                                                s64 modified_time) {
+    std::scoped_lock lk{mutex};
+    const auto it = records.find(file_path);
+    if (it == records.end()) {
+        return std::nullopt;
+    }
+    auto& record = it->second;
+    if (record.entry.size != size || record.entry.modified_time != modified_time) {
+        return std::nullopt;
+    }
+    record.seen = true;
+    return record.entry;
+}
+
+void GameIndex::Store(const std::string& file_path, Entry entry) {
+    std::scoped_lock lk{mutex};
+    records.insert_or_assign(file_path, Record{std::move(entry), true});
+}
+
+s64 GameIndex::GetModifiedTime(const std::filesystem::path& file_path) {
+    std::error_code ec;
+    const auto time = std::filesystem::last_write_time(file_path, ec);
+    if (ec) {
+        return 0;
+    }
+    return static_cast<s64>(time.time_since_epoch().count());
+}
+
+} // namespace FrontendCommon
@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <ankerl/unordered_dense.h>
+
+#include "common/common_funcs.h"
+#include "common/common_types.h"
+#include "core/loader/loader.h"
+
+namespace FrontendCommon {
+
+/**
+ * Persistent record of the metadata read from the game files found in the game directories.
+ * Entries are keyed by path and only trusted while the size and modification time of the file
+ * are unchanged, so a scan only has to parse the files that are new or were modified.
+ * Lookups and stores may be done from several threads at once.
+ */
+class GameIndex {
+public:
+    struct Program {
+        u64 program_id{};
+        std::string name;
+        std::vector<u8> icon;
+    };
+
+    struct Entry {
+        u64 size{};
+        s64 modified_time{};
+        Loader::FileType file_type{Loader::FileType::Unknown};
+        /// Whether the programs were read by selecting each one of a multi-program container
+        bool multi_program{};
+        std::vector<Program> programs;
+    };
+
+    explicit GameIndex(std::filesystem::path path_);
+    ~GameIndex();
+
+    YUZU_NON_COPYABLE(GameIndex);
+    YUZU_NON_MOVEABLE(GameIndex);
+
+    /// Reads the index from disk, an unreadable or outdated index is discarded
+    void Load();
+
+    /// Writes the entries looked up or stored since the last Load, dropping the files not seen
+    bool Save();
+
+    /// Returns the entry of the file if it is indexed and unchanged since it was indexed
+    std::optional<Entry> Find(const std::string& file_path, u64 size, s64 modified_time);
+
+    void Store(const std::string& file_path, Entry entry);
+
+    /// Returns the modification time of the file used to validate its entry
+    static s64 GetModifiedTime(const std::filesystem::path& file_path);
+
+private:
+    struct Record {
+        Entry entry;
+        bool seen{};
+    };
+
+    std::filesystem::path path;
+    mutable std::mutex mutex;
+    ankerl::unordered_dense::map<std::string, Record> records;
+};
+
+} // namespace FrontendCommon
@@ -0,0 +1,180 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Prints what the GPU was asked to do in each frame of a capture made with the
+// gpu_capture_frames setting
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <span>
+#include <unordered_map>
+
+#include <fmt/format.h>
+
+#include "common/common_types.h"
+#include "video_core/command_capture.h"
+#include "video_core/dma_pusher.h"
+#include "video_core/engines/puller.h"
+
+namespace {
+
+using namespace Tegra::CommandCaptureFormat;
+using Tegra::CommandHeader;
+using Tegra::EngineID;
+using Tegra::SubmissionMode;
+
+constexpr u32 NonPullerMethods = static_cast<u32>(Tegra::BufferMethods::NonPullerMethods);
+constexpr u32 BindObjectMethod = static_cast<u32>(Tegra::BufferMethods::BindObject);
+constexpr u32 MacroRegistersStart = 0xE00;
+constexpr u32 LoadMmeInstructionMethod = 0x0114 / 4 + 1;
+
+enum Engine : size_t {
+    Puller,
+    Fermi2D,
+    Maxwell3D,
+    KeplerCompute,
+    KeplerMemory,
+    MaxwellDMA,
+    Unbound,
+    NumEngines,
+};
+
+constexpr std::array<const char*, NumEngines> EngineNames{
+    "Puller", "Fermi2D", "Maxwell3D", "KeplerCompute", "KeplerMemory", "MaxwellDMA", "Unbound",
+};
+
+Engine ToEngine(EngineID id) {
+    switch (id) {
+    case EngineID::FERMI_TWOD_A:
+        return Fermi2D;
+    case EngineID::MAXWELL_B:
+        return Maxwell3D;
+    case EngineID::KEPLER_COMPUTE_B:
+        return KeplerCompute;
+    case EngineID::KEPLER_INLINE_TO_MEMORY_B:
+        return KeplerMemory;
+    case EngineID::MAXWELL_DMA_COPY_A:
+        return MaxwellDMA;
+    default:
+        return Unbound;
+    }
+}
+
+struct FrameStats {
+    u64 command_lists{};
+    u64 words{};
+    std::array<u64, NumEngines> method_calls{};
+    u64 macro_calls{};
+    u64 macro_upload_words{};
+};
+
+/// Walks the command stream of a pushbuffer the same way the DMA pusher does
+class Decoder {
+public:
+    void Decode(std::span<const u32> words, FrameStats& stats) {
+        stats.words += words.size();
+        for (size_t i = 0; i < words.size();) {
+            const CommandHeader header{words[i++]};
+            switch (header.mode) {
+            case SubmissionMode::Increasing:
+            case SubmissionMode::NonIncreasing:
+            case SubmissionMode::IncreaseOnce: {
+                const size_t count = (std::min<size_t>)(header.method_count, words.size() - i);
+                for (size_t arg = 0; arg < count; ++arg) {
+                    u32 method = header.method;
+                    if (header.mode == SubmissionMode::Increasing) {
+                        method += static_cast<u32>(arg);
+                    } else if (header.mode == SubmissionMode::IncreaseOnce && arg > 0) {
+                        ++method;
+                    }
+                    CallMethod(method, header.subchannel, words[i + arg], stats);
+                }
+                i += count;
+                break;
+            }
+            case SubmissionMode::Inline:
+                CallMethod(header.method, header.subchannel, header.arg_count, stats);
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+private:
+    void CallMethod(u32 method, u32 subchannel, u32 argument, FrameStats& stats) {
+        if (method < NonPullerMethods) {
+            if (method == BindObjectMethod) {
+                bound_engines[subchannel] = ToEngine(static_cast<EngineID>(argument & 0xFFFF));
+            }
+            ++stats.method_calls[Puller];
+            return;
+        }
+        const Engine engine = bound_engines[subchannel];
+        ++stats.method_calls[engine];
+        if (engine != Maxwell3D) {
+            return;
+        }
+        if (method >= MacroRegistersStart) {
+            // Only the first argument of a macro starts it, the rest are its parameters
+            if ((method - MacroRegistersStart) % 2 == 0) {
+                ++stats.macro_calls;
+            }
+        } else if (method == LoadMmeInstructionMethod) {
+            ++stats.macro_upload_words;
+        }
+    }
+
+    std::array<Engine, 8> bound_engines{Unbound, Unbound, Unbound, Unbound,
+                                        Unbound, Unbound, Unbound, Unbound};
+};
+
+void PrintFrame(u64 frame, std::chrono::nanoseconds timestamp, const FrameStats& stats) {
+    fmt::print("frame {} at {:.3f} ms: {} command lists, {} words, {} macro calls, "
+               "{} macro upload words\n",
+               frame, static_cast<double>(timestamp.count()) / 1e6, stats.command_lists,
+               stats.words, stats.macro_calls, stats.macro_upload_words);
+    for (size_t engine = 0; engine < NumEngines; ++engine) {
+        if (stats.method_calls[engine] != 0) {
+            fmt::print("  {:<14} {} method calls\n", EngineNames[engine],
+                       stats.method_calls[engine]);
+        }
+    }
+}
+
+} // Anonymous namespace
+
+int main(int argc, char* argv[]) {
+    if (argc != 2) {
+        fmt::print(stderr, "Usage: {} <capture.gcap>\n", argv[0]);
+        return 1;
+    }
+    Tegra::CommandCaptureReader reader;
+    if (!reader.Open(argv[1])) {
+        fmt::print(stderr, "{} is not a GPU capture this version can read\n", argv[1]);
+        return 1;
+    }
+    // Channels keep their bound engines across command lists
+    std::unordered_map<s32, Decoder> decoders;
+    FrameStats stats{};
+    u64 frame = 0;
+    while (const std::optional<Record> record = reader.Next()) {
+        if (const auto* list = std::get_if<CommandListRecord>(&*record)) {
+            Decoder& decoder = decoders[list->channel];
+            ++stats.command_lists;
+            for (const Pushbuffer& pushbuffer : list->pushbuffers) {
+                decoder.Decode(pushbuffer.words, stats);
+            }
+            decoder.Decode(list->prefetch_words, stats);
+        } else {
+            PrintFrame(frame++, std::get<FrameRecord>(*record).timestamp, stats);
+            stats = {};
+        }
+    }
+    if (stats.command_lists != 0) {
+        fmt::print("{} command lists after the last frame, the capture may be truncated\n",
+                   stats.command_lists);
+    }
+    return 0;
+}
@@ -1875,7 +1875,24 @@ NpadColor EmulatedController::GetNpadColor(u32 color) {
     };
 }
 
+std::optional<std::chrono::steady_clock::time_point> EmulatedController::TakeInputChangeTime() {
+    const s64 time = input_change_time.exchange(0, std::memory_order_relaxed);
+    if (time == 0) {
+        return std::nullopt;
+    }
+    return std::chrono::steady_clock::time_point{std::chrono::steady_clock::duration{time}};
+}
+
 void EmulatedController::TriggerOnChange(ControllerTriggerType type, bool is_npad_service_update) {
+    if (is_npad_service_update &&
+        (type == ControllerTriggerType::Button || type == ControllerTriggerType::Stick ||
+         type == ControllerTriggerType::Trigger)) {
+        s64 expected = 0;
+        input_change_time.compare_exchange_strong(
+            expected, std::chrono::steady_clock::now().time_since_epoch().count(),
+            std::memory_order_relaxed);
+    }
+
     std::unique_lock lock{callback_mutex};
     for (auto const& p : callback_list) {
         auto const& poller = p.second;
@@ -7,9 +7,11 @@
 #pragma once
 
 #include <array>
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <shared_mutex>
 #include <vector>
 #include <atomic>
@@ -475,6 +477,12 @@ public:
     /// Swaps the state of the turbo buttons and updates motion input
     void StatusUpdate();
 
+    /**
+     * Returns the time at which the oldest input change not taken yet was reported, and marks the
+     * changes as taken. Used to measure the latency of the input reaching the npad.
+     */
+    std::optional<std::chrono::steady_clock::time_point> TakeInputChangeTime();
+
 private:
     /// creates input devices from params
     void LoadDevices();
@@ -597,6 +605,8 @@ private:
     std::atomic<bool> is_configuring{false};
     std::atomic<bool> is_initialized{false};
     std::atomic<bool> system_buttons_enabled{true};
+    /// Steady clock time of the oldest input change not taken yet, zero if there is none
+    std::atomic<s64> input_change_time{0};
 
     ButtonParams button_params;
     StickParams stick_params;
@@ -10,6 +10,7 @@
 
 #include "common/common_funcs.h"
 #include "hid_core/hid_types.h"
+#include "hid_core/input_latency.h"
 
 namespace Kernel {
 class KernelCore;
@@ -73,6 +74,11 @@ public:
     /// Removes all callbacks from input common
     void UnloadInputDevices();
 
+    /// Returns the latencies of the host input reaching the guest
+    InputLatency& GetInputLatency() {
+        return input_latency;
+    }
+
     /// Number of emulated controllers
     static constexpr std::size_t available_controllers{10};
 
@@ -91,6 +97,7 @@ public:
     Kernel::KernelCore& kernel;
     NpadStyleTag supported_style_tag{NpadStyleSet::All};
     NpadIdType last_active_controller{NpadIdType::Handheld};
+    InputLatency input_latency;
 };
 
 } // namespace Core::HID
@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+
+#include "common/common_types.h"
+
+namespace Core::HID {
+
+/**
+ * Host input latencies gathered since the last reset.
+ * They count from the moment an input driver reported a change to the emulated controller.
+ */
+struct InputLatencyResults {
+    struct Timing {
+        /// Number of measurements
+        u64 count;
+        /// Sum of the measurements
+        std::chrono::nanoseconds total;
+        /// Longest measurement
+        std::chrono::nanoseconds max;
+
+        std::chrono::nanoseconds Average() const {
+            return count == 0 ? std::chrono::nanoseconds{} : total / static_cast<s64>(count);
+        }
+    };
+
+    /// Time until the change was written to the npad shared memory of the guest
+    Timing sample;
+    /// Time until the next frame of the guest was presented by the host
+    Timing present;
+};
+
+/**
+ * Gathers the host input latencies. Measurements may be added from any thread.
+ * Kept in the header, so the video core can report the presented frames without linking hid_core.
+ */
+class InputLatency {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * Record that an input change was written to the npad shared memory.
+     *
+     * @param input_time - Time at which the input driver reported the change.
+     */
+    void OnInputSampled(Clock::time_point input_time) {
+        sample.Add(Clock::now() - input_time);
+
+        // Keep the oldest change, the frame that presents it presents the later ones as well
+        s64 expected{};
+        pending_present.compare_exchange_strong(expected, input_time.time_since_epoch().count(),
+                                                std::memory_order_relaxed);
+    }
+
+    /// Record that a frame of the guest was presented by the host
+    void OnFramePresented() {
+        const s64 input_time{pending_present.exchange(0, std::memory_order_relaxed)};
+        if (input_time != 0) {
+            present.Add(Clock::now() - Clock::time_point{Clock::duration{input_time}});
+        }
+    }
+
+    /**
+     * Get the latencies gathered since the last call, and reset them.
+     *
+     * @return The gathered latencies.
+     */
+    InputLatencyResults GetAndReset() {
+        return {
+            .sample = sample.GetAndReset(),
+            .present = present.GetAndReset(),
+        };
+    }
+
+private:
+    struct Counter {
+        void Add(std::chrono::nanoseconds time) {
+            const auto ns{static_cast<u64>(std::max<s64>(time.count(), 0))};
+            count.fetch_add(1, std::memory_order_relaxed);
+            total_ns.fetch_add(ns, std::memory_order_relaxed);
+            auto current_max{max_ns.load(std::memory_order_relaxed)};
+            while (current_max < ns &&
+                   !max_ns.compare_exchange_weak(current_max, ns, std::memory_order_relaxed)) {
+            }
+        }
+
+        InputLatencyResults::Timing GetAndReset() {
+            return {
+                .count = count.exchange(0, std::memory_order_relaxed),
+                .total = std::chrono::nanoseconds{
+                    static_cast<s64>(total_ns.exchange(0, std::memory_order_relaxed))},
+                .max = std::chrono::nanoseconds{
+                    static_cast<s64>(max_ns.exchange(0, std::memory_order_relaxed))},
+            };
+        }
+
+        std::atomic<u64> count{};
+        std::atomic<u64> total_ns{};
+        std::atomic<u64> max_ns{};
+    };
+
+    Counter sample;
+    Counter present;
+    /// Input time of the oldest sampled change not presented yet, zero if there is none
+    std::atomic<s64> pending_present{};
+};
+
+} // namespace Core::HID
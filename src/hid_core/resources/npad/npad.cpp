@@ -431,6 +431,10 @@ void NPad::RequestPadStateUpdate(Kernel::KernelCore& kernel, u64 aruid, Core::HI
     // This function is unique to yuzu for the turbo buttons and motion to work properly
     controller.device->StatusUpdate();
 
+    if (const auto input_time = controller.device->TakeInputChangeTime()) {
+        hid_core.GetInputLatency().OnInputSampled(*input_time);
+    }
+
     auto& pad_entry = controller.npad_pad_state;
     auto& trigger_entry = controller.npad_trigger_state;
     const auto button_state = controller.device->GetNpadButtons();
@@ -691,11 +691,11 @@ SDLDriver::SDLDriver(std::string input_engine_) : InputEngine(std::move(input_en
 
     initialized = true;
     if (start_thread) {
-        vibration_thread = std::thread([this] {
+        vibration_thread = std::jthread([this](std::stop_token token) {
             Common::SetCurrentThreadName("SDL_Vibration");
             using namespace std::chrono_literals;
-            while (initialized) {
-                SendVibrations();
+            while (!token.stop_requested()) {
+                SendVibrations(token);
                 std::this_thread::sleep_for(250ms); // 4 TPS
             }
         });
@@ -718,6 +718,7 @@ SDLDriver::~SDLDriver() {
 
     initialized = false;
     if (start_thread) {
+        vibration_thread.request_stop();
         vibration_thread.join();
         SDL_QuitSubSystem(SDL_INIT_JOYSTICK | SDL_INIT_GAMEPAD);
     }
@@ -845,8 +846,12 @@ bool SDLDriver::IsVibrationEnabled(const PadIdentifier& identifier) {
     return true;
 }
 
-void SDLDriver::SendVibrations() {
-    std::vector<VibrationRequest> filtered_vibrations{};
+void SDLDriver::SendVibrations(std::stop_token token) {
+    // Sleep until a vibration is requested rather than polling the queue while idle.
+    std::vector<VibrationRequest> filtered_vibrations{vibration_queue.PopWait(token)};
+    if (token.stop_requested()) {
+        return;
+    }
     while (!vibration_queue.Empty()) {
         VibrationRequest request;
         vibration_queue.Pop(request);
@@ -8,6 +8,7 @@
 
 #include <atomic>
 #include <mutex>
+#include <stop_token>
 #include <thread>
 #include <ankerl/unordered_dense.h>
 
@@ -76,8 +77,9 @@ private:
     /// Needs to be called before SDL_QuitSubSystem.
     void CloseJoysticks();
 
-    /// Takes all vibrations from the queue and sends the command to the controller
-    void SendVibrations();
+    /// Waits for a vibration request, then takes all vibrations from the queue and sends the
+    /// command to the controller
+    void SendVibrations(std::stop_token token);
 
     Common::ParamPackage BuildAnalogParamPackageForButton(int port, const Common::UUID& guid,
                                                           s32 axis, float value = 0.1f) const;
@@ -114,7 +116,7 @@ private:
     bool IsButtonOnLeftSide(Settings::NativeButton::Values button) const;
 
     /// Queue of vibration request to controllers
-    Common::SPSCQueue<VibrationRequest> vibration_queue;
+    Common::SPSCQueue<VibrationRequest, true> vibration_queue;
 
     /// Map of GUID of a list of corresponding virtual Joysticks
     ankerl::unordered_dense::map<Common::UUID, std::vector<std::shared_ptr<SDLJoystick>>> joystick_map;
@@ -123,6 +125,6 @@ private:
     bool start_thread = false;
     std::atomic<bool> initialized = false;
 
-    std::thread vibration_thread;
+    std::jthread vibration_thread;
 };
 } // namespace InputCommon
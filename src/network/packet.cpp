@@ -7,7 +7,9 @@
 #include <arpa/inet.h>
 #endif
 #include <cstring>
+#include <mutex>
 #include <string>
+#include <enet/enet.h>
 #include "network/packet.h"
 
 namespace Network {
@@ -24,29 +26,107 @@ static u64 ntohll(u64 x) {
 }
 #endif
 
+namespace {
+
+/// Maximum number of free buffers kept around for new packets
+constexpr std::size_t MaxPooledBuffers = 64;
+/// Buffers that grew larger than this are freed rather than pooled
+constexpr std::size_t MaxPooledBufferCapacity = 64 * 1024;
+
+std::mutex buffer_pool_mutex;
+std::vector<std::unique_ptr<std::vector<char>>> buffer_pool;
+
+std::unique_ptr<std::vector<char>> AcquireBuffer() {
+    {
+        std::scoped_lock lock{buffer_pool_mutex};
+        if (!buffer_pool.empty()) {
+            auto buffer = std::move(buffer_pool.back());
+            buffer_pool.pop_back();
+            return buffer;
+        }
+    }
+    return std::make_unique<std::vector<char>>();
+}
+
+} // Anonymous namespace
+
+void Packet::BufferDeleter::operator()(std::vector<char>* buffer) const {
+    std::unique_ptr<std::vector<char>> owned{buffer};
+    if (owned->capacity() > MaxPooledBufferCapacity) {
+        return;
+    }
+    owned->clear();
+    std::scoped_lock lock{buffer_pool_mutex};
+    if (buffer_pool.size() < MaxPooledBuffers) {
+        buffer_pool.push_back(std::move(owned));
+    }
+}
+
+Packet::Packet(const void* in_data, std::size_t size_in_bytes)
+    : view{static_cast<const char*>(in_data), in_data ? size_in_bytes : 0} {}
+
+std::span<const char> Packet::Bytes() const {
+    if (data) {
+        return *data;
+    }
+    return view;
+}
+
+std::vector<char>& Packet::WritableData() {
+    if (!data) {
+        data = Buffer{AcquireBuffer().release()};
+        data->assign(view.begin(), view.end());
+        view = {};
+    }
+    return *data;
+}
+
 void Packet::Append(const void* in_data, std::size_t size_in_bytes) {
     if (in_data && (size_in_bytes > 0)) {
-        std::size_t start = data.size();
-        data.resize(start + size_in_bytes);
-        std::memcpy(&data[start], in_data, size_in_bytes);
+        auto& buffer = WritableData();
+        std::size_t start = buffer.size();
+        buffer.resize(start + size_in_bytes);
+        std::memcpy(&buffer[start], in_data, size_in_bytes);
     }
 }
 
 void Packet::Read(void* out_data, std::size_t size_in_bytes) {
     if (out_data && CheckSize(size_in_bytes)) {
-        std::memcpy(out_data, &data[read_pos], size_in_bytes);
+        std::memcpy(out_data, Bytes().data() + read_pos, size_in_bytes);
         read_pos += size_in_bytes;
     }
 }
 
 void Packet::Clear() {
-    data.clear();
+    if (data) {
+        data->clear();
+    }
+    view = {};
     read_pos = 0;
     is_valid = true;
 }
 
 const void* Packet::GetData() const {
-    return !data.empty() ? &data[0] : nullptr;
+    const auto bytes = Bytes();
+    return !bytes.empty() ? bytes.data() : nullptr;
+}
+
+ENetPacket* Packet::ToENetPacket(u32 flags) {
+    if (!data || data->empty()) {
+        // Nothing was written to the packet, there is no buffer to hand over
+        return enet_packet_create(GetData(), GetDataSize(), flags);
+    }
+    ENetPacket* enet_packet = enet_packet_create(data->data(), data->size(),
+                                                 flags | ENET_PACKET_FLAG_NO_ALLOCATE);
+    if (!enet_packet) {
+        return nullptr;
+    }
+    enet_packet->userData = data.release();
+    enet_packet->freeCallback = [](ENetPacket* packet) {
+        BufferDeleter{}(static_cast<std::vector<char>*>(packet->userData));
+    };
+    Clear();
+    return enet_packet;
 }
 
 void Packet::IgnoreBytes(u32 length) {
@@ -54,11 +134,11 @@ void Packet::IgnoreBytes(u32 length) {
 }
 
 std::size_t Packet::GetDataSize() const {
-    return data.size();
+    return Bytes().size();
 }
 
 bool Packet::EndOfPacket() const {
-    return read_pos >= data.size();
+    return read_pos >= Bytes().size();
 }
 
 Packet::operator bool() const {
@@ -142,7 +222,7 @@ Packet& Packet::Read(char* out_data) {
 
     if ((length > 0) && CheckSize(length)) {
         // Then extract characters
-        std::memcpy(out_data, &data[read_pos], length);
+        std::memcpy(out_data, Bytes().data() + read_pos, length);
         out_data[length] = '\0';
 
         // Update reading position
@@ -160,7 +240,7 @@ Packet& Packet::Read(std::string& out_data) {
     out_data.clear();
     if ((length > 0) && CheckSize(length)) {
         // Then extract characters
-        out_data.assign(&data[read_pos], length);
+        out_data.assign(Bytes().data() + read_pos, length);
 
         // Update reading position
         read_pos += length;
@@ -254,7 +334,7 @@ Packet& Packet::Write(const std::string& in_data) {
 }
 
 bool Packet::CheckSize(std::size_t size) {
-    is_valid = is_valid && (read_pos + size <= data.size());
+    is_valid = is_valid && (read_pos + size <= Bytes().size());
 
     return is_valid;
 }
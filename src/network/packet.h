@@ -4,17 +4,34 @@
 #pragma once
 
 #include <array>
+#include <memory>
+#include <span>
+#include <type_traits>
 #include <vector>
 #include "common/common_types.h"
 
+typedef struct _ENetPacket ENetPacket;
+
 namespace Network {
 
 /// A class that serializes data for network transfer. It also handles endianness
 class Packet {
 public:
     Packet() = default;
+
+    /**
+     * Create a packet that reads received data in place, without copying it.
+     * The data must outlive the packet, it is only copied if something is appended to the packet.
+     * @param data        Pointer to the received bytes
+     * @param size_in_bytes Number of received bytes
+     */
+    Packet(const void* data, std::size_t size_in_bytes);
+
     ~Packet() = default;
 
+    Packet(Packet&&) noexcept = default;
+    Packet& operator=(Packet&&) noexcept = default;
+
     /**
      * Append data to the end of the packet
      * @param data        Pointer to the sequence of bytes to append
@@ -63,6 +80,15 @@ public:
 
     explicit operator bool() const;
 
+    /**
+     * Create an ENet packet out of the data of this packet.
+     * The buffer of the packet is handed to ENet without copying it, and goes back to the pool
+     * of buffers once ENet destroys the packet. The packet is empty afterwards.
+     * @param flags ENet packet flags
+     * @return The created ENet packet, or nullptr if it could not be allocated
+     */
+    ENetPacket* ToENetPacket(u32 flags);
+
     /// Overloads of read function to read data from the packet
     Packet& Read(bool& out_data);
     Packet& Read(s8& out_data);
@@ -110,10 +136,26 @@ private:
      */
     bool CheckSize(std::size_t size);
 
+    /// Get the bytes of the packet, whether it owns them or reads them in place
+    std::span<const char> Bytes() const;
+
+    /// Get the buffer of the packet for writing, taking one from the pool if needed
+    std::vector<char>& WritableData();
+
+    /// Returns the buffers of the packets to the pool instead of freeing them
+    struct BufferDeleter {
+        void operator()(std::vector<char>* buffer) const;
+    };
+    using Buffer = std::unique_ptr<std::vector<char>, BufferDeleter>;
+
+    template <typename T>
+    static constexpr bool IsByte = std::is_same_v<T, u8> || std::is_same_v<T, s8>;
+
     // Member data
-    std::vector<char> data;   ///< Data stored in the packet
-    std::size_t read_pos = 0; ///< Current reading position in the packet
-    bool is_valid = true;     ///< Reading state of the packet
+    Buffer data;                ///< Data written to the packet
+    std::span<const char> view; ///< Received data the packet reads in place
+    std::size_t read_pos = 0;   ///< Current reading position in the packet
+    bool is_valid = true;       ///< Reading state of the packet
 };
 
 template <typename T>
@@ -123,7 +165,11 @@ Packet& Packet::Read(std::vector<T>& out_data) {
     Read(size);
     out_data.resize(size);
 
-    // Then extract the data
+    // Then extract the data, bytes need no conversion so they are read in one go
+    if constexpr (IsByte<T>) {
+        Read(out_data.data(), out_data.size());
+        return *this;
+    }
     for (std::size_t i = 0; i < out_data.size(); ++i) {
         T character;
         Read(character);
@@ -147,7 +193,11 @@ Packet& Packet::Write(const std::vector<T>& in_data) {
     // First insert the size
     Write(static_cast<u32>(in_data.size()));
 
-    // Then insert the data
+    // Then insert the data, bytes need no conversion so they are appended in one go
+    if constexpr (IsByte<T>) {
+        Append(in_data.data(), in_data.size());
+        return *this;
+    }
     for (std::size_t i = 0; i < in_data.size(); ++i) {
         Write(in_data[i]);
     }
@@ -4,14 +4,22 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <array>
 #include <atomic>
+#include <chrono>
+#include <cstring>
 #include <iomanip>
+#include <iterator>
+#include <list>
 #include <mutex>
 #include <random>
 #include <regex>
 #include <shared_mutex>
 #include <sstream>
 #include <thread>
+#include <unordered_map>
+#include <fmt/format.h>
+#include "common/assert.h"
 #include "common/polyfill_thread.h"
 #include "common/logging.h"
 #include "enet/enet.h"
@@ -40,15 +48,59 @@ public:
         /// Data of the user, often including authenticated forum username.
         VerifyUser::UserData user_data;
         ENetPeer* peer; ///< The remote peer.
+        bool direct_connect = false; ///< Whether the member accepts direct connections
+        bool delta_updates = false;  ///< Whether the member understands member list deltas
     };
-    using MemberList = std::vector<Member>;
+    using MemberList = std::list<Member>;
     MemberList members;                     ///< Information about the members of this room
-    mutable std::shared_mutex member_mutex; ///< Mutex for locking the members list
+    mutable std::shared_mutex member_mutex; ///< Mutex for locking the members list and lookups
+
+    struct IPv4AddressHash {
+        std::size_t operator()(const IPv4Address& address) const noexcept {
+            u32 value;
+            std::memcpy(&value, address.data(), sizeof(value));
+            return std::hash<u32>{}(value);
+        }
+    };
+
+    /// Lookups of the members by peer, fake ip and nickname, kept in sync with members
+    std::unordered_map<const ENetPeer*, MemberList::iterator> members_by_peer;
+    std::unordered_map<IPv4Address, MemberList::iterator, IPv4AddressHash> members_by_ip;
+    std::unordered_map<std::string, MemberList::iterator> members_by_nickname;
+
+    /// Sequence number of the member list, bumped on every change (guarded by member_mutex)
+    u32 member_list_sequence = 0;
 
     UsernameBanList username_ban_list; ///< List of banned usernames
     IPBanList ip_ban_list;             ///< List of banned IP addresses
     mutable std::mutex ban_list_mutex; ///< Mutex for the ban lists
 
+    /// Counters of the received packets of one message type, only updated by the room thread
+    struct MessageStats {
+        std::atomic<u64> packets{};
+        std::atomic<u64> bytes{};
+        std::atomic<u64> handler_ns{};
+    };
+    std::array<MessageStats, 256> message_stats; ///< Counters by message id
+
+    /// Totals of the ENet host, including the protocol overhead and the acknowledgements
+    std::atomic<u64> sent_bytes{};
+    std::atomic<u64> sent_datagrams{};
+    std::atomic<u64> received_bytes{};
+    std::atomic<u64> received_datagrams{};
+
+    /// Connection state of a member as seen by ENet
+    struct MemberStats {
+        std::string nickname;
+        u32 round_trip_time;        ///< Mean round trip time in milliseconds
+        u32 round_trip_variance;    ///< Variance of the round trip time in milliseconds
+        u32 packet_loss;            ///< Packet loss scaled by ENET_PEER_PACKET_LOSS_SCALE
+        u32 reliable_data_in_flight; ///< Bytes of reliable data not acknowledged yet
+    };
+    std::vector<MemberStats> member_stats;      ///< Latest state of the members
+    mutable std::mutex member_stats_mutex;      ///< Mutex for member_stats
+    std::chrono::steady_clock::time_point last_stats_update{};
+
     RoomImpl() {}
 
     /// Thread that receives and dispatches network packets
@@ -59,6 +111,32 @@ public:
 
     void StartLoop();
 
+    /**
+     * Moves the ENet host counters into the room totals, and gathers the state of the members
+     * about once a second. Only called by the room thread.
+     */
+    void UpdateStats();
+
+    /**
+     * Adds a member to the members list and its lookups. member_mutex must be held.
+     */
+    void AddMember(Member&& member);
+
+    /**
+     * Removes a member from the members list and its lookups. member_mutex must be held.
+     */
+    void RemoveMember(MemberList::iterator member);
+
+    /**
+     * Finds a member in one of the lookups. member_mutex must be held.
+     * @return The member, or members.end() if there is none with the given key.
+     */
+    template <typename Lookup, typename Key>
+    MemberList::iterator FindMember(const Lookup& lookup, const Key& key) {
+        const auto it = lookup.find(key);
+        return it == lookup.end() ? members.end() : it->second;
+    }
+
     /**
      * Parses and answers a room join request from a client.
      * Validates the uniqueness of the username and assigns the MAC address
@@ -181,8 +259,8 @@ public:
                            const std::string& username, const std::string& ip);
 
     /**
-     * Sends the information about the room, along with the list of members
-     * to every connected client in the room.
+     * Writes the information about the room, along with the list of members.
+     * The member_mutex has to be held by the caller.
      * The packet has the structure:
      * <MessageID>ID_ROOM_INFORMATION
      * <String> room_name
@@ -191,12 +269,37 @@ public:
      * <String> uid
      * <u16> port
      * <u32> num_members: the number of currently joined clients
-     * This is followed by the following three values for each member:
-     * <String> nickname of that member
-     * <IPv4Address> fake_ip of that member
-     * <String> game_name of that member
+     * This is followed by the values written by WriteMember for each member, and then by:
+     * <u32> member_list_sequence: Sequence number the following deltas are counted from
+     */
+    void WriteRoomInformation(Packet& packet) const;
+
+    /**
+     * Writes the information about a member:
+     * <String> nickname, <IPv4Address> fake_ip, <String> game_name, <u64> game_id,
+     * <String> game_version, <String> username, <String> display_name, <String> avatar_url
      */
-    void BroadcastRoomInformation();
+    void WriteMember(Packet& packet, const Member& member) const;
+
+    /**
+     * Sends the full room information to a client, following its request for it.
+     * The client is switched to member list deltas from then on.
+     */
+    void HandleRoomInformationRequest(const ENetEvent* event);
+
+    /**
+     * Notifies every member that the member list has changed. Members that asked for the full
+     * room information once get only the changed member, the others the full room information.
+     * The delta packet has the structure:
+     * <MessageID>ID_ROOM_MEMBER_DELTA
+     * <u32> member_list_sequence: Sequence number of the list after this change
+     * <u8> type: MemberDeltaTypes
+     * This is followed by the values written by WriteMember when a member was updated, or by
+     * the nickname of the member when it was removed.
+     * @param type Type of the change
+     * @param nickname Nickname of the changed member
+     */
+    void BroadcastMemberListChange(MemberDeltaTypes type, const std::string& nickname);
 
     /**
      * Generates a free MAC address to assign to a new client.
@@ -204,6 +307,17 @@ public:
      */
     IPv4Address GenerateFakeIPAddress();
 
+    /**
+     * Forwards a received packet as is, to all members except the sender or to a single member.
+     * The packet is queued once for every recipient, and sent with the next service of the host
+     * so that bursts of packets are coalesced.
+     * @param event The ENet event containing the data
+     * @param destination_address Fake ip of the recipient, when not broadcasting
+     * @param broadcast Whether to send the packet to every other member
+     */
+    void ForwardPacket(const ENetEvent* event, const IPv4Address& destination_address,
+                       bool broadcast);
+
     /**
      * Broadcasts this packet to all members except the sender.
      * @param event The ENet event containing the data
@@ -222,6 +336,18 @@ public:
      */
     void HandleChatPacket(const ENetEvent* event);
 
+    /**
+     * Marks the sender as accepting direct connections, and exchanges its public endpoint with
+     * the ones of the other members that accept them.
+     * @param event The ENet event that was received.
+     */
+    void HandleDirectEndpointPacket(const ENetEvent* event);
+
+    /**
+     * Sends the public endpoint of a member to another member.
+     */
+    void SendDirectEndpoint(ENetPeer* client, const Member& member);
+
     /**
      * Extracts the game name from a received ENet packet and broadcasts it.
      * @param event The ENet event that was received.
@@ -236,14 +362,31 @@ public:
 };
 
 // RoomImpl
+void Room::RoomImpl::AddMember(Member&& member) {
+    const auto it = members.insert(members.end(), std::move(member));
+    members_by_peer.emplace(it->peer, it);
+    members_by_ip.emplace(it->fake_ip, it);
+    members_by_nickname.emplace(it->nickname, it);
+}
+
+void Room::RoomImpl::RemoveMember(MemberList::iterator member) {
+    members_by_peer.erase(member->peer);
+    members_by_ip.erase(member->fake_ip);
+    members_by_nickname.erase(member->nickname);
+    members.erase(member);
+}
+
 void Room::RoomImpl::StartLoop() {
     room_thread.emplace([&](std::stop_token stoken) {
         while (state != State::Closed) {
             ENetEvent event;
             if (enet_host_service(server, &event, 5) > 0) {
                 switch (event.type) {
-                case ENET_EVENT_TYPE_RECEIVE:
-                    switch (event.packet->data[0]) {
+                case ENET_EVENT_TYPE_RECEIVE: {
+                    const u8 message_id = event.packet->data[0];
+                    const std::size_t message_size = event.packet->dataLength;
+                    const auto handler_start = std::chrono::steady_clock::now();
+                    switch (message_id) {
                     case IdJoinRequest:
                         HandleJoinRequest(&event);
                         break;
@@ -259,6 +402,12 @@ void Room::RoomImpl::StartLoop() {
                     case IdChatMessage:
                         HandleChatPacket(&event);
                         break;
+                    case IdDirectEndpoint:
+                        HandleDirectEndpointPacket(&event);
+                        break;
+                    case IdRoomInformationRequest:
+                        HandleRoomInformationRequest(&event);
+                        break;
                     // Moderation
                     case IdModKick:
                         HandleModKickPacket(&event);
@@ -273,8 +422,20 @@ void Room::RoomImpl::StartLoop() {
                         HandleModGetBanListPacket(&event);
                         break;
                     }
-                    enet_packet_destroy(event.packet);
+                    // Forwarded packets are destroyed by ENet once they have been sent
+                    if (event.packet->referenceCount == 0) {
+                        enet_packet_destroy(event.packet);
+                    }
+                    auto& stats = message_stats[message_id];
+                    stats.packets.fetch_add(1, std::memory_order_relaxed);
+                    stats.bytes.fetch_add(message_size, std::memory_order_relaxed);
+                    stats.handler_ns.fetch_add(
+                        static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                             std::chrono::steady_clock::now() - handler_start)
+                                             .count()),
+                        std::memory_order_relaxed);
                     break;
+                }
                 case ENET_EVENT_TYPE_DISCONNECT:
                     HandleClientDisconnection(event.peer);
                     break;
@@ -283,12 +444,47 @@ void Room::RoomImpl::StartLoop() {
                     break;
                 }
             }
+            UpdateStats();
         }
         // Close the connection to all members:
         SendCloseMessage();
     });
 }
 
+void Room::RoomImpl::UpdateStats() {
+    // ENet leaves the resetting of its counters to the application, they are only 32 bits wide
+    sent_bytes.fetch_add(std::exchange(server->totalSentData, 0), std::memory_order_relaxed);
+    sent_datagrams.fetch_add(std::exchange(server->totalSentPackets, 0),
+                             std::memory_order_relaxed);
+    received_bytes.fetch_add(std::exchange(server->totalReceivedData, 0),
+                             std::memory_order_relaxed);
+    received_datagrams.fetch_add(std::exchange(server->totalReceivedPackets, 0),
+                                 std::memory_order_relaxed);
+
+    const auto now = std::chrono::steady_clock::now();
+    if (now - last_stats_update < std::chrono::seconds{1}) {
+        return;
+    }
+    last_stats_update = now;
+
+    std::vector<MemberStats> stats;
+    {
+        std::shared_lock lock(member_mutex);
+        stats.reserve(members.size());
+        for (const auto& member : members) {
+            stats.push_back(MemberStats{
+                .nickname = member.nickname,
+                .round_trip_time = member.peer->roundTripTime,
+                .round_trip_variance = member.peer->roundTripTimeVariance,
+                .packet_loss = member.peer->packetLoss,
+                .reliable_data_in_flight = member.peer->reliableDataInTransit,
+            });
+        }
+    }
+    std::lock_guard lock(member_stats_mutex);
+    member_stats = std::move(stats);
+}
+
 void Room::RoomImpl::HandleJoinRequest(const ENetEvent* event) {
     {
         std::lock_guard lock(member_mutex);
@@ -297,8 +493,7 @@ void Room::RoomImpl::HandleJoinRequest(const ENetEvent* event) {
             return;
         }
     }
-    Packet packet;
-    packet.Append(event->packet->data, event->packet->dataLength);
+    Packet packet(event->packet->data, event->packet->dataLength);
     packet.IgnoreBytes(sizeof(u8)); // Ignore the message type
     std::string nickname;
     packet.Read(nickname);
@@ -390,11 +585,11 @@ void Room::RoomImpl::HandleJoinRequest(const ENetEvent* event) {
 
     {
         std::lock_guard lock(member_mutex);
-        members.push_back(std::move(member));
+        AddMember(std::move(member));
     }
 
     // Notify everyone that the room information has changed.
-    BroadcastRoomInformation();
+    BroadcastMemberListChange(IdMemberUpdated, nickname);
     if (HasModPermission(event->peer)) {
         SendJoinSuccessAsMod(event->peer, preferred_fake_ip);
     } else {
@@ -408,8 +603,7 @@ void Room::RoomImpl::HandleModKickPacket(const ENetEvent* event) {
         return;
     }
 
-    Packet packet;
-    packet.Append(event->packet->data, event->packet->dataLength);
+    Packet packet(event->packet->data, event->packet->dataLength);
     packet.IgnoreBytes(sizeof(u8)); // Ignore the message type
 
     std::string nickname;
@@ -418,9 +612,7 @@ void Room::RoomImpl::HandleModKickPacket(const ENetEvent* event) {
     std::string username, ip;
     {
         std::lock_guard lock(member_mutex);
-        const auto target_member =
-            std::find_if(members.begin(), members.end(),
-                         [&nickname](const auto& member) { return member.nickname == nickname; });
+        const auto target_member = FindMember(members_by_nickname, nickname);
         if (target_member == members.end()) {
             SendModNoSuchUser(event->peer);
             return;
@@ -436,12 +628,12 @@ void Room::RoomImpl::HandleModKickPacket(const ENetEvent* event) {
         ip = ip_raw.data();
 
         enet_peer_disconnect(target_member->peer, 0);
-        members.erase(target_member);
+        RemoveMember(target_member);
     }
 
     // Announce the change to all clients.
     SendStatusMessage(IdMemberKicked, nickname, username, ip);
-    BroadcastRoomInformation();
+    BroadcastMemberListChange(IdMemberRemoved, nickname);
 }
 
 void Room::RoomImpl::HandleModBanPacket(const ENetEvent* event) {
@@ -450,8 +642,7 @@ void Room::RoomImpl::HandleModBanPacket(const ENetEvent* event) {
         return;
     }
 
-    Packet packet;
-    packet.Append(event->packet->data, event->packet->dataLength);
+    Packet packet(event->packet->data, event->packet->dataLength);
     packet.IgnoreBytes(sizeof(u8)); // Ignore the message type
 
     std::string nickname;
@@ -460,9 +651,7 @@ void Room::RoomImpl::HandleModBanPacket(const ENetEvent* event) {
     std::string username, ip;
     {
         std::lock_guard lock(member_mutex);
-        const auto target_member =
-            std::find_if(members.begin(), members.end(),
-                         [&nickname](const auto& member) { return member.nickname == nickname; });
+        const auto target_member = FindMember(members_by_nickname, nickname);
         if (target_member == members.end()) {
             SendModNoSuchUser(event->peer);
             return;
@@ -479,7 +668,7 @@ void Room::RoomImpl::HandleModBanPacket(const ENetEvent* event) {
         ip = ip_raw.data();
 
         enet_peer_disconnect(target_member->peer, 0);
-        members.erase(target_member);
+        RemoveMember(target_member);
     }
 
     {
@@ -502,7 +691,7 @@ void Room::RoomImpl::HandleModBanPacket(const ENetEvent* event) {
 
     // Announce the change to all clients.
     SendStatusMessage(IdMemberBanned, nickname, username, ip);
-    BroadcastRoomInformation();
+    BroadcastMemberListChange(IdMemberRemoved, nickname);
 }
 
 void Room::RoomImpl::HandleModUnbanPacket(const ENetEvent* event) {
@@ -511,8 +700,7 @@ void Room::RoomImpl::HandleModUnbanPacket(const ENetEvent* event) {
         return;
     }
 
-    Packet packet;
-    packet.Append(event->packet->data, event->packet->dataLength);
+    Packet packet(event->packet->data, event->packet->dataLength);
     packet.IgnoreBytes(sizeof(u8)); // Ignore the message type
 
     std::string address;
@@ -558,26 +746,23 @@ bool Room::RoomImpl::IsValidNickname(const std::string& nickname) const {
     if (!std::regex_match(nickname, nickname_regex))
         return false;
 
-    std::lock_guard lock(member_mutex);
-    return std::all_of(members.begin(), members.end(),
-                       [&nickname](const auto& member) { return member.nickname != nickname; });
+    std::shared_lock lock(member_mutex);
+    return !members_by_nickname.contains(nickname);
 }
 
 bool Room::RoomImpl::IsValidFakeIPAddress(const IPv4Address& address) const {
     // An IP address is valid if it is not already taken by anybody else in the room.
-    std::lock_guard lock(member_mutex);
-    return std::all_of(members.begin(), members.end(),
-                       [&address](const auto& member) { return member.fake_ip != address; });
+    std::shared_lock lock(member_mutex);
+    return !members_by_ip.contains(address);
 }
 
 bool Room::RoomImpl::HasModPermission(const ENetPeer* client) const {
-    std::lock_guard lock(member_mutex);
-    const auto sending_member =
-        std::find_if(members.begin(), members.end(),
-                     [client](const auto& member) { return member.peer == client; });
-    if (sending_member == members.end()) {
+    std::shared_lock lock(member_mutex);
+    const auto it = members_by_peer.find(client);
+    if (it == members_by_peer.end()) {
         return false;
     }
+    const auto& sending_member = it->second;
     if (sending_member->user_data.moderator) { // Community moderator
 
         return true;
@@ -594,8 +779,7 @@ void Room::RoomImpl::SendNameCollision(ENetPeer* client) {
     Packet packet;
     packet.Write(static_cast<u8>(IdNameCollision));
 
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
+    ENetPacket* enet_packet = packet.ToENetPacket(ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
     enet_host_flush(server);
 }
@@ -604,8 +788,7 @@ void Room::RoomImpl::SendIPCollision(ENetPeer* client) {
     Packet packet;
     packet.Write(static_cast<u8>(IdIpCollision));
 
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
+    ENetPacket* enet_packet = packet.ToENetPacket(ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
     enet_host_flush(server);
 }
@@ -614,8 +797,7 @@ void Room::RoomImpl::SendWrongPassword(ENetPeer* client) {
     Packet packet;
     packet.Write(static_cast<u8>(IdWrongPassword));
 
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
+    ENetPacket* enet_packet = packet.ToENetPacket(ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
     enet_host_flush(server);
 }
@@ -624,8 +806,7 @@ void Room::RoomImpl::SendRoomIsFull(ENetPeer* client) {
     Packet packet;
     packet.Write(static_cast<u8>(IdRoomIsFull));
 
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
+    ENetPacket* enet_packet = packet.ToENetPacket(ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
     enet_host_flush(server);
 }
@@ -635,8 +816,7 @@ void Room::RoomImpl::SendVersionMismatch(ENetPeer* client) {
     packet.Write(static_cast<u8>(IdVersionMismatch));
     packet.Write(network_version);
 
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
+    ENetPacket* enet_packet = packet.ToENetPacket(ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
     enet_host_flush(server);
 }
@@ -645,8 +825,7 @@ void Room::RoomImpl::SendJoinSuccess(ENetPeer* client, IPv4Address fake_ip) {
     Packet packet;
     packet.Write(static_cast<u8>(IdJoinSuccess));
     packet.Write(fake_ip);
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
+    ENetPacket* enet_packet = packet.ToENetPacket(ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
     enet_host_flush(server);
 }
@@ -655,8 +834,7 @@ void Room::RoomImpl::SendJoinSuccessAsMod(ENetPeer* client, IPv4Address fake_ip)
     Packet packet;
     packet.Write(static_cast<u8>(IdJoinSuccessAsMod));
     packet.Write(fake_ip);
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
+    ENetPacket* enet_packet = packet.ToENetPacket(ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
     enet_host_flush(server);
 }
@@ -665,8 +843,7 @@ void Room::RoomImpl::SendUserKicked(ENetPeer* client) {
     Packet packet;
     packet.Write(static_cast<u8>(IdHostKicked));
 
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
+    ENetPacket* enet_packet = packet.ToENetPacket(ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
     enet_host_flush(server);
 }
@@ -675,8 +852,7 @@ void Room::RoomImpl::SendUserBanned(ENetPeer* client) {
     Packet packet;
     packet.Write(static_cast<u8>(IdHostBanned));
 
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
+    ENetPacket* enet_packet = packet.ToENetPacket(ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
     enet_host_flush(server);
 }
@@ -685,8 +861,7 @@ void Room::RoomImpl::SendModPermissionDenied(ENetPeer* client) {
     Packet packet;
     packet.Write(static_cast<u8>(IdModPermissionDenied));
 
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
+    ENetPacket* enet_packet = packet.ToENetPacket(ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
     enet_host_flush(server);
 }
@@ -695,8 +870,7 @@ void Room::RoomImpl::SendModNoSuchUser(ENetPeer* client) {
     Packet packet;
     packet.Write(static_cast<u8>(IdModNoSuchUser));
 
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
+    ENetPacket* enet_packet = packet.ToENetPacket(ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
     enet_host_flush(server);
 }
@@ -710,8 +884,7 @@ void Room::RoomImpl::SendModBanListResponse(ENetPeer* client) {
         packet.Write(ip_ban_list);
     }
 
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
+    ENetPacket* enet_packet = packet.ToENetPacket(ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
     enet_host_flush(server);
 }
@@ -721,8 +894,7 @@ void Room::RoomImpl::SendCloseMessage() {
     packet.Write(static_cast<u8>(IdCloseRoom));
     std::lock_guard lock(member_mutex);
     if (!members.empty()) {
-        ENetPacket* enet_packet =
-            enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
+        ENetPacket* enet_packet = packet.ToENetPacket(ENET_PACKET_FLAG_RELIABLE);
         for (auto& member : members) {
             enet_peer_send(member.peer, 0, enet_packet);
         }
@@ -742,8 +914,7 @@ void Room::RoomImpl::SendStatusMessage(StatusMessageTypes type, const std::strin
     packet.Write(username);
     std::lock_guard lock(member_mutex);
     if (!members.empty()) {
-        ENetPacket* enet_packet =
-            enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
+        ENetPacket* enet_packet = packet.ToENetPacket(ENET_PACKET_FLAG_RELIABLE);
         for (auto& member : members) {
             enet_peer_send(member.peer, 0, enet_packet);
         }
@@ -772,8 +943,7 @@ void Room::RoomImpl::SendStatusMessage(StatusMessageTypes type, const std::strin
     }
 }
 
-void Room::RoomImpl::BroadcastRoomInformation() {
-    Packet packet;
+void Room::RoomImpl::WriteRoomInformation(Packet& packet) const {
     packet.Write(static_cast<u8>(IdRoomInformation));
     packet.Write(room_information.name);
     packet.Write(room_information.description);
@@ -783,23 +953,75 @@ void Room::RoomImpl::BroadcastRoomInformation() {
     packet.Write(room_information.host_username);
 
     packet.Write(static_cast<u32>(members.size()));
+    for (const auto& member : members) {
+        WriteMember(packet, member);
+    }
+    // Appended last so older clients, which stop reading after the members, ignore it
+    packet.Write(member_list_sequence);
+}
+
+void Room::RoomImpl::WriteMember(Packet& packet, const Member& member) const {
+    packet.Write(member.nickname);
+    packet.Write(member.fake_ip);
+    packet.Write(member.game_info.name);
+    packet.Write(member.game_info.id);
+    packet.Write(member.game_info.version);
+    packet.Write(member.user_data.username);
+    packet.Write(member.user_data.display_name);
+    packet.Write(member.user_data.avatar_url);
+}
+
+void Room::RoomImpl::HandleRoomInformationRequest(const ENetEvent* event) {
+    Packet packet;
     {
         std::lock_guard lock(member_mutex);
-        for (const auto& member : members) {
-            packet.Write(member.nickname);
-            packet.Write(member.fake_ip);
-            packet.Write(member.game_info.name);
-            packet.Write(member.game_info.id);
-            packet.Write(member.game_info.version);
-            packet.Write(member.user_data.username);
-            packet.Write(member.user_data.display_name);
-            packet.Write(member.user_data.avatar_url);
+        const auto member = FindMember(members_by_peer, event->peer);
+        if (member == members.end()) {
+            return; // Only joined members get the member list
         }
+        member->delta_updates = true;
+        WriteRoomInformation(packet);
     }
 
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
-    enet_host_broadcast(server, 0, enet_packet);
+    ENetPacket* enet_packet = packet.ToENetPacket(ENET_PACKET_FLAG_RELIABLE);
+    enet_peer_send(event->peer, 0, enet_packet);
+    enet_host_flush(server);
+}
+
+void Room::RoomImpl::BroadcastMemberListChange(MemberDeltaTypes type,
+                                               const std::string& nickname) {
+    std::lock_guard lock(member_mutex);
+    ++member_list_sequence;
+
+    // Both packets are only built once they are needed, and then shared by their recipients
+    ENetPacket* full_packet = nullptr;
+    ENetPacket* delta_packet = nullptr;
+    for (const auto& member : members) {
+        if (!member.delta_updates) {
+            if (!full_packet) {
+                Packet packet;
+                WriteRoomInformation(packet);
+                full_packet = packet.ToENetPacket(ENET_PACKET_FLAG_RELIABLE);
+            }
+            enet_peer_send(member.peer, 0, full_packet);
+            continue;
+        }
+        if (!delta_packet) {
+            Packet packet;
+            packet.Write(static_cast<u8>(IdRoomMemberDelta));
+            packet.Write(member_list_sequence);
+            packet.Write(static_cast<u8>(type));
+            if (type == IdMemberUpdated) {
+                const auto changed_member = FindMember(members_by_nickname, nickname);
+                ASSERT(changed_member != members.end());
+                WriteMember(packet, *changed_member);
+            } else {
+                packet.Write(nickname);
+            }
+            delta_packet = packet.ToENetPacket(ENET_PACKET_FLAG_RELIABLE);
+        }
+        enet_peer_send(member.peer, 0, delta_packet);
+    }
     enet_host_flush(server);
 }
 
@@ -809,16 +1031,47 @@ IPv4Address Room::RoomImpl::GenerateFakeIPAddress() {
     for (u8 i = 0x01; i < 0xFF; ++i)
         for (u8 j = 0x01; j < 0xFF; ++j) {
             IPv4Address addr{192, 168, i, j};
-            if (std::all_of(members.begin(), members.end(), [&addr](auto const& member) { return member.fake_ip != addr; }))
+            if (!members_by_ip.contains(addr))
                 return addr;
         }
     LOG_ERROR(Network, "All addresses are taken");
     return IPv4Address{192, 168, 0, 0};
 }
 
+void Room::RoomImpl::ForwardPacket(const ENetEvent* event,
+                                   const IPv4Address& destination_address, bool broadcast) {
+    // The packet is sent on unmodified, so the received packet itself is queued for the
+    // destinations. Each of them holds a reference on it, and the room loop only destroys it
+    // when nobody does.
+    ENetPacket* enet_packet = event->packet;
+    enet_packet->flags |= ENET_PACKET_FLAG_RELIABLE;
+
+    std::shared_lock lock(member_mutex);
+    if (broadcast) { // Send the data to everyone except the sender
+        for (const auto& member : members) {
+            if (member.peer != event->peer) {
+                enet_peer_send(member.peer, 0, enet_packet);
+            }
+        }
+    } else { // Send the data only to the destination client
+        const auto member = members_by_ip.find(destination_address);
+        if (member != members_by_ip.end()) {
+            enet_peer_send(member->second->peer, 0, enet_packet);
+        } else {
+            LOG_ERROR(Network,
+                      "Attempting to send to unknown IP address: "
+                      "{}.{}.{}.{}",
+                      destination_address[0], destination_address[1], destination_address[2],
+                      destination_address[3]);
+        }
+    }
+    // No flush, the packets go out with the next enet_host_service call of the room loop. That
+    // happens as soon as the received packets are handled, and lets ENet send everything queued
+    // for a peer in as few datagrams as possible.
+}
+
 void Room::RoomImpl::HandleProxyPacket(const ENetEvent* event) {
-    Packet in_packet;
-    in_packet.Append(event->packet->data, event->packet->dataLength);
+    Packet in_packet(event->packet->data, event->packet->dataLength);
     in_packet.IgnoreBytes(sizeof(u8)); // Message type
 
     in_packet.IgnoreBytes(sizeof(u8));          // Domain
@@ -835,48 +1088,11 @@ void Room::RoomImpl::HandleProxyPacket(const ENetEvent* event) {
     bool broadcast;
     in_packet.Read(broadcast); // Broadcast
 
-    Packet out_packet;
-    out_packet.Append(event->packet->data, event->packet->dataLength);
-    ENetPacket* enet_packet = enet_packet_create(out_packet.GetData(), out_packet.GetDataSize(),
-                                                 ENET_PACKET_FLAG_RELIABLE);
-
-    const auto& destination_address = remote_ip;
-    if (broadcast) { // Send the data to everyone except the sender
-        std::lock_guard lock(member_mutex);
-        bool sent_packet = false;
-        for (const auto& member : members) {
-            if (member.peer != event->peer) {
-                sent_packet = true;
-                enet_peer_send(member.peer, 0, enet_packet);
-            }
-        }
-
-        if (!sent_packet) {
-            enet_packet_destroy(enet_packet);
-        }
-    } else { // Send the data only to the destination client
-        std::lock_guard lock(member_mutex);
-        auto member = std::find_if(members.begin(), members.end(),
-                                   [destination_address](const Member& member_entry) -> bool {
-                                       return member_entry.fake_ip == destination_address;
-                                   });
-        if (member != members.end()) {
-            enet_peer_send(member->peer, 0, enet_packet);
-        } else {
-            LOG_ERROR(Network,
-                      "Attempting to send to unknown IP address: "
-                      "{}.{}.{}.{}",
-                      destination_address[0], destination_address[1], destination_address[2],
-                      destination_address[3]);
-            enet_packet_destroy(enet_packet);
-        }
-    }
-    enet_host_flush(server);
+    ForwardPacket(event, remote_ip, broadcast);
 }
 
 void Room::RoomImpl::HandleLdnPacket(const ENetEvent* event) {
-    Packet in_packet;
-    in_packet.Append(event->packet->data, event->packet->dataLength);
+    Packet in_packet(event->packet->data, event->packet->dataLength);
 
     in_packet.IgnoreBytes(sizeof(u8)); // Message type
 
@@ -889,58 +1105,18 @@ void Room::RoomImpl::HandleLdnPacket(const ENetEvent* event) {
     bool broadcast;
     in_packet.Read(broadcast); // Broadcast
 
-    Packet out_packet;
-    out_packet.Append(event->packet->data, event->packet->dataLength);
-    ENetPacket* enet_packet = enet_packet_create(out_packet.GetData(), out_packet.GetDataSize(),
-                                                 ENET_PACKET_FLAG_RELIABLE);
-
-    const auto& destination_address = remote_ip;
-    if (broadcast) { // Send the data to everyone except the sender
-        std::lock_guard lock(member_mutex);
-        bool sent_packet = false;
-        for (const auto& member : members) {
-            if (member.peer != event->peer) {
-                sent_packet = true;
-                enet_peer_send(member.peer, 0, enet_packet);
-            }
-        }
-
-        if (!sent_packet) {
-            enet_packet_destroy(enet_packet);
-        }
-    } else {
-        std::lock_guard lock(member_mutex);
-        auto member = std::find_if(members.begin(), members.end(),
-                                   [destination_address](const Member& member_entry) -> bool {
-                                       return member_entry.fake_ip == destination_address;
-                                   });
-        if (member != members.end()) {
-            enet_peer_send(member->peer, 0, enet_packet);
-        } else {
-            LOG_ERROR(Network,
-                      "Attempting to send to unknown IP address: "
-                      "{}.{}.{}.{}",
-                      destination_address[0], destination_address[1], destination_address[2],
-                      destination_address[3]);
-            enet_packet_destroy(enet_packet);
-        }
-    }
-    enet_host_flush(server);
+    ForwardPacket(event, remote_ip, broadcast);
 }
 
 void Room::RoomImpl::HandleChatPacket(const ENetEvent* event) {
-    Packet in_packet;
-    in_packet.Append(event->packet->data, event->packet->dataLength);
+    Packet in_packet(event->packet->data, event->packet->dataLength);
 
     in_packet.IgnoreBytes(sizeof(u8)); // Ignore the message type
     std::string message;
     in_packet.Read(message);
-    auto CompareNetworkAddress = [event](const Member member) -> bool {
-        return member.peer == event->peer;
-    };
 
-    std::lock_guard lock(member_mutex);
-    const auto sending_member = std::find_if(members.begin(), members.end(), CompareNetworkAddress);
+    std::shared_lock lock(member_mutex);
+    const auto sending_member = FindMember(members_by_peer, event->peer);
     if (sending_member == members.end()) {
         return; // Received a chat message from a unknown sender
     }
@@ -954,8 +1130,7 @@ void Room::RoomImpl::HandleChatPacket(const ENetEvent* event) {
     out_packet.Write(sending_member->user_data.username);
     out_packet.Write(message);
 
-    ENetPacket* enet_packet = enet_packet_create(out_packet.GetData(), out_packet.GetDataSize(),
-                                                 ENET_PACKET_FLAG_RELIABLE);
+    ENetPacket* enet_packet = out_packet.ToENetPacket(ENET_PACKET_FLAG_RELIABLE);
     bool sent_packet = false;
     for (const auto& member : members) {
         if (member.peer != event->peer) {
@@ -978,9 +1153,38 @@ void Room::RoomImpl::HandleChatPacket(const ENetEvent* event) {
     }
 }
 
+void Room::RoomImpl::HandleDirectEndpointPacket(const ENetEvent* event) {
+    std::lock_guard lock(member_mutex);
+    const auto sending_member = FindMember(members_by_peer, event->peer);
+    if (sending_member == members.end() || sending_member->direct_connect) {
+        return;
+    }
+    sending_member->direct_connect = true;
+
+    // Only the members that asked for direct connections learn each other's address
+    for (const auto& member : members) {
+        if (member.peer != event->peer && member.direct_connect) {
+            SendDirectEndpoint(event->peer, member);
+            SendDirectEndpoint(member.peer, *sending_member);
+        }
+    }
+    enet_host_flush(server);
+}
+
+void Room::RoomImpl::SendDirectEndpoint(ENetPeer* client, const Member& member) {
+    // The address the room sees is the one the NAT of the member maps its client socket to
+    Packet packet;
+    packet.Write(static_cast<u8>(IdDirectEndpoint));
+    packet.Write(member.fake_ip);
+    packet.Write(member.peer->address.host);
+    packet.Write(member.peer->address.port);
+
+    ENetPacket* enet_packet = packet.ToENetPacket(ENET_PACKET_FLAG_RELIABLE);
+    enet_peer_send(client, 0, enet_packet);
+}
+
 void Room::RoomImpl::HandleGameInfoPacket(const ENetEvent* event) {
-    Packet in_packet;
-    in_packet.Append(event->packet->data, event->packet->dataLength);
+    Packet in_packet(event->packet->data, event->packet->dataLength);
 
     in_packet.IgnoreBytes(sizeof(u8)); // Ignore the message type
     GameInfo game_info;
@@ -988,14 +1192,13 @@ void Room::RoomImpl::HandleGameInfoPacket(const ENetEvent* event) {
     in_packet.Read(game_info.id);
     in_packet.Read(game_info.version);
 
+    std::string nickname;
     {
         std::lock_guard lock(member_mutex);
-        auto member = std::find_if(members.begin(), members.end(),
-                                   [event](const Member& member_entry) -> bool {
-                                       return member_entry.peer == event->peer;
-                                   });
+        const auto member = FindMember(members_by_peer, event->peer);
         if (member != members.end()) {
             member->game_info = game_info;
+            nickname = member->nickname;
 
             const std::string display_name =
                 member->user_data.username.empty()
@@ -1010,7 +1213,8 @@ void Room::RoomImpl::HandleGameInfoPacket(const ENetEvent* event) {
             }
         }
     }
-    BroadcastRoomInformation();
+    if (!nickname.empty())
+        BroadcastMemberListChange(IdMemberUpdated, nickname);
 }
 
 void Room::RoomImpl::HandleClientDisconnection(ENetPeer* client) {
@@ -1018,10 +1222,7 @@ void Room::RoomImpl::HandleClientDisconnection(ENetPeer* client) {
     std::string nickname, username, ip;
     {
         std::lock_guard lock(member_mutex);
-        auto member =
-            std::find_if(members.begin(), members.end(), [client](const Member& member_entry) {
-                return member_entry.peer == client;
-            });
+        const auto member = FindMember(members_by_peer, client);
         if (member != members.end()) {
             nickname = member->nickname;
             username = member->user_data.username;
@@ -1030,15 +1231,16 @@ void Room::RoomImpl::HandleClientDisconnection(ENetPeer* client) {
             enet_address_get_host_ip(&member->peer->address, ip_raw.data(), sizeof(ip_raw) - 1);
             ip = ip_raw.data();
 
-            members.erase(member);
+            RemoveMember(member);
         }
     }
 
     // Announce the change to all clients.
     enet_peer_disconnect(client, 0);
-    if (!nickname.empty())
+    if (!nickname.empty()) {
         SendStatusMessage(IdMemberLeave, nickname, username, ip);
-    BroadcastRoomInformation();
+        BroadcastMemberListChange(IdMemberRemoved, nickname);
+    }
 }
 
 // Room
@@ -1102,7 +1304,7 @@ Room::BanList Room::GetBanList() const {
 
 std::vector<Member> Room::GetRoomMemberList() const {
     std::vector<Member> member_list;
-    std::lock_guard lock(room_impl->member_mutex);
+    std::shared_lock lock(room_impl->member_mutex);
     for (const auto& member_impl : room_impl->members) {
         Member member;
         member.nickname = member_impl.nickname;
@@ -1125,6 +1327,138 @@ void Room::SetVerifyUID(const std::string& uid) {
     room_impl->verify_uid = uid;
 }
 
+namespace {
+
+std::string_view GetMessageTypeName(u8 message_id) {
+    switch (message_id) {
+    case IdJoinRequest:
+        return "JoinRequest";
+    case IdSetGameInfo:
+        return "SetGameInfo";
+    case IdProxyPacket:
+        return "ProxyPacket";
+    case IdLdnPacket:
+        return "LdnPacket";
+    case IdChatMessage:
+        return "ChatMessage";
+    case IdModKick:
+        return "ModKick";
+    case IdModBan:
+        return "ModBan";
+    case IdModUnban:
+        return "ModUnban";
+    case IdModGetBanList:
+        return "ModGetBanList";
+    case IdDirectEndpoint:
+        return "DirectEndpoint";
+    case IdRoomInformationRequest:
+        return "RoomInformationRequest";
+    default:
+        return {};
+    }
+}
+
+/// Escapes a label value of the Prometheus text format
+std::string EscapeLabel(std::string_view value) {
+    std::string escaped;
+    escaped.reserve(value.size());
+    for (const char c : value) {
+        switch (c) {
+        case '\\':
+            escaped += "\\\\";
+            break;
+        case '"':
+            escaped += "\\\"";
+            break;
+        case '\n':
+            escaped += "\\n";
+            break;
+        default:
+            escaped += c;
+            break;
+        }
+    }
+    return escaped;
+}
+
+void AppendHeader(std::string& out, std::string_view name, std::string_view type,
+                  std::string_view help) {
+    fmt::format_to(std::back_inserter(out), "# HELP {} {}\n# TYPE {} {}\n", name, help, name,
+                   type);
+}
+
+} // Anonymous namespace
+
+std::string Room::GetMetrics() const {
+    std::string out;
+    const auto append_by_type = [&](std::string_view name, std::string_view help, auto&& value) {
+        AppendHeader(out, name, "counter", help);
+        for (std::size_t id = 0; id < room_impl->message_stats.size(); id++) {
+            const auto& stats = room_impl->message_stats[id];
+            if (stats.packets.load(std::memory_order_relaxed) == 0) {
+                continue;
+            }
+            const auto type_name = GetMessageTypeName(static_cast<u8>(id));
+            fmt::format_to(std::back_inserter(out), "{}{{type=\"{}\"}} {}\n", name,
+                           type_name.empty() ? fmt::format("{}", id) : std::string(type_name),
+                           value(stats));
+        }
+    };
+    append_by_type("eden_room_received_packets_total", "Packets received, by message type.",
+                   [](const auto& s) { return s.packets.load(std::memory_order_relaxed); });
+    append_by_type("eden_room_received_packet_bytes_total",
+                   "Payload bytes received, by message type.",
+                   [](const auto& s) { return s.bytes.load(std::memory_order_relaxed); });
+    append_by_type("eden_room_handler_seconds_total",
+                   "Time spent handling the received packets, by message type.",
+                   [](const auto& s) {
+                       return static_cast<double>(s.handler_ns.load(std::memory_order_relaxed)) /
+                              1e9;
+                   });
+
+    const auto append_total = [&](std::string_view name, std::string_view help,
+                                  const std::atomic<u64>& value) {
+        AppendHeader(out, name, "counter", help);
+        fmt::format_to(std::back_inserter(out), "{} {}\n", name,
+                       value.load(std::memory_order_relaxed));
+    };
+    append_total("eden_room_sent_bytes_total", "Bytes sent by ENet, with its overhead.",
+                 room_impl->sent_bytes);
+    append_total("eden_room_sent_datagrams_total", "Datagrams sent by ENet.",
+                 room_impl->sent_datagrams);
+    append_total("eden_room_received_bytes_total", "Bytes received by ENet, with its overhead.",
+                 room_impl->received_bytes);
+    append_total("eden_room_received_datagrams_total", "Datagrams received by ENet.",
+                 room_impl->received_datagrams);
+
+    std::lock_guard lock(room_impl->member_stats_mutex);
+    const auto& members = room_impl->member_stats;
+    AppendHeader(out, "eden_room_members", "gauge", "Members in the room.");
+    fmt::format_to(std::back_inserter(out), "eden_room_members {}\n", members.size());
+
+    const auto append_by_member = [&](std::string_view name, std::string_view help,
+                                      auto&& value) {
+        AppendHeader(out, name, "gauge", help);
+        for (const auto& member : members) {
+            fmt::format_to(std::back_inserter(out), "{}{{member=\"{}\"}} {}\n", name,
+                           EscapeLabel(member.nickname), value(member));
+        }
+    };
+    append_by_member("eden_room_member_rtt_seconds", "Mean round trip time to the member.",
+                     [](const auto& m) { return m.round_trip_time / 1000.0; });
+    append_by_member("eden_room_member_rtt_variance_seconds",
+                     "Variance of the round trip time to the member.",
+                     [](const auto& m) { return m.round_trip_variance / 1000.0; });
+    append_by_member("eden_room_member_packet_loss_ratio", "Packet loss towards the member.",
+                     [](const auto& m) {
+                         return static_cast<double>(m.packet_loss) / ENET_PEER_PACKET_LOSS_SCALE;
+                     });
+    append_by_member("eden_room_member_unacknowledged_bytes",
+                     "Reliable data sent to the member and not acknowledged yet.",
+                     [](const auto& m) { return m.reliable_data_in_flight; });
+    return out;
+}
+
 void Room::Destroy() {
     room_impl->state = State::Closed;
     room_impl->room_thread.reset();
@@ -1137,6 +1471,9 @@ void Room::Destroy() {
     {
         std::lock_guard lock(room_impl->member_mutex);
         room_impl->members.clear();
+        room_impl->members_by_peer.clear();
+        room_impl->members_by_ip.clear();
+        room_impl->members_by_nickname.clear();
     }
     room_impl->room_information.member_slots = 0;
     room_impl->room_information.name.clear();
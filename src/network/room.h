@@ -64,6 +64,18 @@ enum RoomMessageTypes : u8 {
     IdModPermissionDenied,
     IdModNoSuchUser,
     IdJoinSuccessAsMod,
+    /// Exchange of the public endpoints of the members for direct connections
+    IdDirectEndpoint,
+    /// Change of a single member, following a full member list with a sequence number
+    IdRoomMemberDelta,
+    /// Request for the full member list, also telling the room that deltas are understood
+    IdRoomInformationRequest,
+};
+
+/// Types of member list changes sent in IdRoomMemberDelta
+enum MemberDeltaTypes : u8 {
+    IdMemberUpdated = 1, ///< A member joined or its information changed
+    IdMemberRemoved,     ///< A member left the room
 };
 
 /// Types of system status messages
@@ -143,6 +155,13 @@ public:
      */
     void Destroy();
 
+    /**
+     * Gets the load metrics of the room in the Prometheus text format: the packets, bytes and
+     * handling time by message type, the totals sent and received by ENet, and the round trip
+     * time, packet loss and unacknowledged data of each member.
+     */
+    std::string GetMetrics() const;
+
 private:
     class RoomImpl;
     std::unique_ptr<RoomImpl> room_impl;
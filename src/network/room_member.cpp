@@ -3,13 +3,18 @@
 // SPDX-FileCopyrightText: Copyright 2017 Citra Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <list>
+#include <map>
 #include <mutex>
 #include <set>
 #include <thread>
 #include "common/assert.h"
+#include "common/logging.h"
 #include "common/polyfill_thread.h"
+#include "common/settings.h"
 #include "common/socket_types.h"
 #include "enet/enet.h"
 #include "network/packet.h"
@@ -19,6 +24,58 @@ namespace Network {
 
 constexpr u32 ConnectionTimeoutMs = 5000;
 
+/// Identifies the datagrams the members send each other directly, next to the ENet traffic
+constexpr u32 DirectMagic = 0x4C444E44;
+constexpr auto DirectProbeInterval = std::chrono::milliseconds{250};
+constexpr u32 DirectProbeAttempts = 20;
+constexpr auto DirectKeepAliveInterval = std::chrono::seconds{5};
+constexpr auto DirectTimeout = std::chrono::seconds{15};
+
+enum DirectMessageTypes : u8 {
+    DirectProbe = 1,
+    DirectProbeReply,
+    DirectProxyPacket,
+};
+
+namespace {
+
+void WriteProxyPacket(Packet& packet, const ProxyPacket& proxy_packet) {
+    packet.Write(static_cast<u8>(proxy_packet.local_endpoint.family));
+    packet.Write(proxy_packet.local_endpoint.ip);
+    packet.Write(proxy_packet.local_endpoint.portno);
+
+    packet.Write(static_cast<u8>(proxy_packet.remote_endpoint.family));
+    packet.Write(proxy_packet.remote_endpoint.ip);
+    packet.Write(proxy_packet.remote_endpoint.portno);
+
+    packet.Write(static_cast<u8>(proxy_packet.protocol));
+    packet.Write(proxy_packet.broadcast);
+    packet.Write(proxy_packet.data);
+}
+
+void ReadProxyPacket(Packet& packet, ProxyPacket& proxy_packet) {
+    u8 local_family;
+    packet.Read(local_family);
+    proxy_packet.local_endpoint.family = static_cast<Domain>(local_family);
+    packet.Read(proxy_packet.local_endpoint.ip);
+    packet.Read(proxy_packet.local_endpoint.portno);
+
+    u8 remote_family;
+    packet.Read(remote_family);
+    proxy_packet.remote_endpoint.family = static_cast<Domain>(remote_family);
+    packet.Read(proxy_packet.remote_endpoint.ip);
+    packet.Read(proxy_packet.remote_endpoint.portno);
+
+    u8 protocol_type;
+    packet.Read(protocol_type);
+    proxy_packet.protocol = static_cast<Protocol>(protocol_type);
+
+    packet.Read(proxy_packet.broadcast);
+    packet.Read(proxy_packet.data);
+}
+
+} // Anonymous namespace
+
 class RoomMember::RoomMemberImpl {
 public:
     void SetState(const State new_state) noexcept {
@@ -43,6 +100,10 @@ public:
     MemberList member_information;
     /// Information about the room we're connected to.
     RoomInformation room_information;
+    /// Sequence number of member_information, as counted by the room
+    u32 member_list_sequence = 0;
+    /// Whether the full member list was requested and deltas are ignored until it arrives
+    bool member_list_requested = false;
 
     /// The current game name, id and version
     GameInfo current_game_info;
@@ -62,6 +123,18 @@ public:
     std::mutex send_list_mutex;  ///< Mutex that controls access to the `send_list` variable.
     std::vector<Packet> send_list; ///< A list that stores all packets to send the async
 
+    /// Path to another member that accepts direct connections
+    struct DirectPeer {
+        ENetAddress address{};    ///< Public endpoint of the member, as seen by the room
+        bool established = false; ///< Whether probes went through in both directions
+        u32 probes_left = DirectProbeAttempts;
+        std::chrono::steady_clock::time_point last_sent{};
+        std::chrono::steady_clock::time_point last_received{};
+    };
+    std::mutex direct_mutex;     ///< Mutex for the direct connection state
+    bool direct_connect = false; ///< Whether direct connections are used in this room
+    std::map<IPv4Address, DirectPeer> direct_peers; ///< Direct paths by fake ip
+
     template <typename T>
     using CallbackSet = std::set<CallbackHandle<T>>;
     std::mutex callback_mutex; ///< The mutex used for handling callbacks
@@ -115,6 +188,28 @@ public:
      */
     void HandleRoomInformationPacket(const ENetEvent* event);
 
+    /**
+     * Asks the room for the full member list, which also tells it that deltas are understood.
+     */
+    void RequestRoomInformation();
+
+    /**
+     * Applies a change of a single member to the member list, or asks for the full member list
+     * when a change was missed.
+     * @param event The ENet event that was received.
+     */
+    void HandleMemberDeltaPacket(const ENetEvent* event);
+
+    /**
+     * Reads the information about a member, as written by the room.
+     */
+    void ReadMember(Packet& packet, MemberInformation& member);
+
+    /**
+     * Forgets the direct paths to the members that are no longer in the room.
+     */
+    void PruneDirectPeers();
+
     /**
      * Extracts a ProxyPacket from a received ENet packet.
      * @param event The ENet event that was received.
@@ -133,6 +228,47 @@ public:
      */
     void HandleChatPacket(const ENetEvent* event);
 
+    /**
+     * Asks the room for the public endpoints of the members accepting direct connections.
+     */
+    void EnableDirectConnect();
+
+    /**
+     * Extracts the public endpoint of another member from a received ENet packet.
+     * @param event The ENet event that was received.
+     */
+    void HandleDirectEndpointPacket(const ENetEvent* event);
+
+    /**
+     * Takes the datagrams other members sent directly out of the ENet traffic.
+     * The datagrams reuse the client socket, whose public endpoint the room already knows.
+     */
+    static int ENET_CALLBACK InterceptDirectPacket(ENetHost* host, ENetEvent* event);
+
+    /**
+     * Handles a datagram another member sent directly.
+     * @param address The address the datagram came from.
+     * @param packet The datagram, read past the magic.
+     */
+    void HandleDirectPacket(const ENetAddress& address, Packet& packet);
+
+    /**
+     * Probes the direct paths that aren't established yet and keeps the others alive.
+     */
+    void UpdateDirectPeers();
+
+    /**
+     * Sends a proxy packet over the direct path to its destination.
+     * @return Whether there was an established path to send it over.
+     */
+    bool SendDirectProxyPacket(const ProxyPacket& proxy_packet);
+
+    /// Creates a datagram to send directly to another member
+    Packet MakeDirectPacket(DirectMessageTypes type) const;
+
+    /// Sends a datagram directly to another member. direct_mutex must be held.
+    void SendDirect(DirectPeer& peer, const Packet& packet);
+
     /**
      * Extracts a system message entry from a received ENet packet and adds it to the system message
      * queue.
@@ -181,9 +317,15 @@ void RoomMember::RoomMemberImpl::StartLoop() {
                     case IdStatusMessage:
                         HandleStatusMessagePacket(&event);
                         break;
+                    case IdDirectEndpoint:
+                        HandleDirectEndpointPacket(&event);
+                        break;
                     case IdRoomInformation:
                         HandleRoomInformationPacket(&event);
                         break;
+                    case IdRoomMemberDelta:
+                        HandleMemberDeltaPacket(&event);
+                        break;
                     case IdJoinSuccess:
                     case IdJoinSuccessAsMod:
                         // The join request was successful, we are now in the room.
@@ -196,6 +338,10 @@ void RoomMember::RoomMemberImpl::StartLoop() {
                         } else {
                             SetState(State::Joined);
                         }
+                        if (Settings::values.multiplayer_direct_connect.GetValue()) {
+                            EnableDirectConnect();
+                        }
+                        RequestRoomInformation();
                         break;
                     case IdModBanListResponse:
                         HandleModBanListResponsePacket(&event);
@@ -256,14 +402,14 @@ void RoomMember::RoomMemberImpl::StartLoop() {
                     break;
                 }
             }
+            UpdateDirectPeers();
             std::vector<Packet> packets;
             {
                 std::lock_guard send_lock(send_list_mutex);
                 packets.swap(send_list);
             }
-            for (auto const& packet : packets) {
-                ENetPacket* enetPacket = enet_packet_create(packet.GetData(), packet.GetDataSize(),
-                                                            ENET_PACKET_FLAG_RELIABLE);
+            for (auto& packet : packets) {
+                ENetPacket* enetPacket = packet.ToENetPacket(ENET_PACKET_FLAG_RELIABLE);
                 enet_peer_send(server, 0, enetPacket);
             }
             enet_host_flush(client);
@@ -292,8 +438,7 @@ void RoomMember::RoomMemberImpl::SendJoinRequest(const std::string& nickname_,
 }
 
 void RoomMember::RoomMemberImpl::HandleRoomInformationPacket(const ENetEvent* event) {
-    Packet packet;
-    packet.Append(event->packet->data, event->packet->dataLength);
+    Packet packet(event->packet->data, event->packet->dataLength);
 
     // Ignore the first byte, which is the message id.
     packet.IgnoreBytes(sizeof(u8)); // Ignore the message type
@@ -317,28 +462,100 @@ void RoomMember::RoomMemberImpl::HandleRoomInformationPacket(const ENetEvent* ev
     member_information.resize(num_members);
 
     for (auto& member : member_information) {
-        packet.Read(member.nickname);
-        packet.Read(member.fake_ip);
-        packet.Read(member.game_info.name);
-        packet.Read(member.game_info.id);
-        packet.Read(member.game_info.version);
-        packet.Read(member.username);
-        packet.Read(member.display_name);
-        packet.Read(member.avatar_url);
-
-        {
-            std::lock_guard lock(username_mutex);
-            if (member.nickname == nickname) {
-                username = member.username;
-            }
+        ReadMember(packet, member);
+    }
+
+    // Rooms that send deltas append the sequence number the next delta follows
+    u32 sequence{};
+    packet.Read(sequence);
+    if (packet) {
+        member_list_sequence = sequence;
+        member_list_requested = false;
+    }
+
+    PruneDirectPeers();
+    Invoke(room_information);
+}
+
+void RoomMember::RoomMemberImpl::RequestRoomInformation() {
+    member_list_requested = true;
+
+    Packet packet;
+    packet.Write(static_cast<u8>(IdRoomInformationRequest));
+    Send(std::move(packet));
+}
+
+void RoomMember::RoomMemberImpl::HandleMemberDeltaPacket(const ENetEvent* event) {
+    if (member_list_requested) {
+        // The full member list is on its way and already holds this change
+        return;
+    }
+
+    Packet packet(event->packet->data, event->packet->dataLength);
+
+    // Ignore the first byte, which is the message id.
+    packet.IgnoreBytes(sizeof(u8)); // Ignore the message type
+
+    u32 sequence{};
+    u8 type{};
+    packet.Read(sequence);
+    packet.Read(type);
+    if (!packet || sequence != member_list_sequence + 1) {
+        LOG_WARNING(Network, "Missed a member list change, requesting the full member list");
+        RequestRoomInformation();
+        return;
+    }
+
+    if (type == IdMemberUpdated) {
+        MemberInformation changed_member;
+        ReadMember(packet, changed_member);
+        const auto member = std::find_if(
+            member_information.begin(), member_information.end(),
+            [&changed_member](const auto& m) { return m.nickname == changed_member.nickname; });
+        if (member != member_information.end()) {
+            *member = std::move(changed_member);
+        } else {
+            member_information.push_back(std::move(changed_member));
         }
+    } else {
+        std::string removed_nickname;
+        packet.Read(removed_nickname);
+        std::erase_if(member_information, [&removed_nickname](const auto& member) {
+            return member.nickname == removed_nickname;
+        });
+        PruneDirectPeers();
     }
+    member_list_sequence = sequence;
     Invoke(room_information);
 }
 
+void RoomMember::RoomMemberImpl::ReadMember(Packet& packet, MemberInformation& member) {
+    packet.Read(member.nickname);
+    packet.Read(member.fake_ip);
+    packet.Read(member.game_info.name);
+    packet.Read(member.game_info.id);
+    packet.Read(member.game_info.version);
+    packet.Read(member.username);
+    packet.Read(member.display_name);
+    packet.Read(member.avatar_url);
+
+    std::lock_guard lock(username_mutex);
+    if (member.nickname == nickname) {
+        username = member.username;
+    }
+}
+
+void RoomMember::RoomMemberImpl::PruneDirectPeers() {
+    std::lock_guard lock(direct_mutex);
+    std::erase_if(direct_peers, [this](const auto& entry) {
+        return std::none_of(
+            member_information.begin(), member_information.end(),
+            [&entry](const auto& member) { return member.fake_ip == entry.first; });
+    });
+}
+
 void RoomMember::RoomMemberImpl::HandleJoinPacket(const ENetEvent* event) {
-    Packet packet;
-    packet.Append(event->packet->data, event->packet->dataLength);
+    Packet packet(event->packet->data, event->packet->dataLength);
 
     // Ignore the first byte, which is the message id.
     packet.IgnoreBytes(sizeof(u8)); // Ignore the message type
@@ -349,39 +566,20 @@ void RoomMember::RoomMemberImpl::HandleJoinPacket(const ENetEvent* event) {
 
 void RoomMember::RoomMemberImpl::HandleProxyPackets(const ENetEvent* event) {
     ProxyPacket proxy_packet{};
-    Packet packet;
-    packet.Append(event->packet->data, event->packet->dataLength);
+    Packet packet(event->packet->data, event->packet->dataLength);
 
     // Ignore the first byte, which is the message id.
     packet.IgnoreBytes(sizeof(u8)); // Ignore the message type
 
     // Parse the ProxyPacket from the packet
-    u8 local_family;
-    packet.Read(local_family);
-    proxy_packet.local_endpoint.family = static_cast<Domain>(local_family);
-    packet.Read(proxy_packet.local_endpoint.ip);
-    packet.Read(proxy_packet.local_endpoint.portno);
-
-    u8 remote_family;
-    packet.Read(remote_family);
-    proxy_packet.remote_endpoint.family = static_cast<Domain>(remote_family);
-    packet.Read(proxy_packet.remote_endpoint.ip);
-    packet.Read(proxy_packet.remote_endpoint.portno);
-
-    u8 protocol_type;
-    packet.Read(protocol_type);
-    proxy_packet.protocol = static_cast<Protocol>(protocol_type);
-
-    packet.Read(proxy_packet.broadcast);
-    packet.Read(proxy_packet.data);
+    ReadProxyPacket(packet, proxy_packet);
 
     Invoke<ProxyPacket>(proxy_packet);
 }
 
 void RoomMember::RoomMemberImpl::HandleLdnPackets(const ENetEvent* event) {
     LDNPacket ldn_packet{};
-    Packet packet;
-    packet.Append(event->packet->data, event->packet->dataLength);
+    Packet packet(event->packet->data, event->packet->dataLength);
 
     // Ignore the first byte, which is the message id.
     packet.IgnoreBytes(sizeof(u8)); // Ignore the message type
@@ -399,9 +597,165 @@ void RoomMember::RoomMemberImpl::HandleLdnPackets(const ENetEvent* event) {
     Invoke<LDNPacket>(ldn_packet);
 }
 
-void RoomMember::RoomMemberImpl::HandleChatPacket(const ENetEvent* event) {
+void RoomMember::RoomMemberImpl::EnableDirectConnect() {
+    {
+        std::lock_guard lock(direct_mutex);
+        direct_connect = true;
+    }
+    server->data = this;
+    client->intercept = &InterceptDirectPacket;
+
     Packet packet;
-    packet.Append(event->packet->data, event->packet->dataLength);
+    packet.Write(static_cast<u8>(IdDirectEndpoint));
+    Send(std::move(packet));
+}
+
+void RoomMember::RoomMemberImpl::HandleDirectEndpointPacket(const ENetEvent* event) {
+    Packet packet(event->packet->data, event->packet->dataLength);
+
+    // Ignore the first byte, which is the message id.
+    packet.IgnoreBytes(sizeof(u8));
+
+    IPv4Address member_ip;
+    ENetAddress address{};
+    packet.Read(member_ip);
+    packet.Read(address.host);
+    packet.Read(address.port);
+    if (!packet) {
+        return;
+    }
+
+    std::lock_guard lock(direct_mutex);
+    if (direct_connect) {
+        // Probing starts with the next update, the other member probes us at the same time
+        direct_peers[member_ip] = DirectPeer{.address = address};
+    }
+}
+
+int ENET_CALLBACK RoomMember::RoomMemberImpl::InterceptDirectPacket(ENetHost* host,
+                                                                    ENetEvent* event) {
+    // The client host only has the server peer, which points back to the member
+    auto* const impl = static_cast<RoomMemberImpl*>(host->peers[0].data);
+    if (impl == nullptr || host->receivedDataLength < sizeof(DirectMagic)) {
+        return 0;
+    }
+    const ENetAddress& address = host->receivedAddress;
+    if (address.host == impl->server->address.host && address.port == impl->server->address.port) {
+        return 0;
+    }
+
+    Packet packet(host->receivedData, host->receivedDataLength);
+    u32 magic{};
+    packet.Read(magic);
+    if (magic != DirectMagic) {
+        return 0;
+    }
+    impl->HandleDirectPacket(address, packet);
+    return 1;
+}
+
+void RoomMember::RoomMemberImpl::HandleDirectPacket(const ENetAddress& address, Packet& packet) {
+    u8 type{};
+    IPv4Address sender_ip{};
+    packet.Read(type);
+    packet.Read(sender_ip);
+
+    ProxyPacket proxy_packet{};
+    {
+        std::lock_guard lock(direct_mutex);
+        const auto it = direct_peers.find(sender_ip);
+        // Only the endpoint the room gave for the member may speak for it
+        if (!direct_connect || !packet || it == direct_peers.end() ||
+            it->second.address.host != address.host || it->second.address.port != address.port) {
+            return;
+        }
+        DirectPeer& peer = it->second;
+        peer.last_received = std::chrono::steady_clock::now();
+
+        switch (type) {
+        case DirectProbe:
+            SendDirect(peer, MakeDirectPacket(DirectProbeReply));
+            return;
+        case DirectProbeReply:
+        case DirectProxyPacket:
+            if (!peer.established) {
+                LOG_INFO(Network, "Direct connection to {}.{}.{}.{} established", sender_ip[0],
+                         sender_ip[1], sender_ip[2], sender_ip[3]);
+                peer.established = true;
+            }
+            if (type == DirectProbeReply) {
+                return;
+            }
+            break;
+        default:
+            return;
+        }
+    }
+
+    // The callbacks may send packets, so they are invoked without the lock
+    ReadProxyPacket(packet, proxy_packet);
+    if (packet) {
+        Invoke<ProxyPacket>(proxy_packet);
+    }
+}
+
+void RoomMember::RoomMemberImpl::UpdateDirectPeers() {
+    std::lock_guard lock(direct_mutex);
+    if (!direct_connect) {
+        return;
+    }
+    const auto now = std::chrono::steady_clock::now();
+    for (auto& [member_ip, peer] : direct_peers) {
+        if (peer.established && now - peer.last_received > DirectTimeout) {
+            LOG_INFO(Network, "Direct connection to {}.{}.{}.{} lost, relaying through the room",
+                     member_ip[0], member_ip[1], member_ip[2], member_ip[3]);
+            peer.established = false;
+            peer.probes_left = DirectProbeAttempts;
+        }
+        if (peer.established) {
+            if (now - peer.last_sent >= DirectKeepAliveInterval) {
+                SendDirect(peer, MakeDirectPacket(DirectProbe));
+            }
+        } else if (peer.probes_left > 0 && now - peer.last_sent >= DirectProbeInterval) {
+            peer.probes_left--;
+            SendDirect(peer, MakeDirectPacket(DirectProbe));
+        }
+    }
+}
+
+bool RoomMember::RoomMemberImpl::SendDirectProxyPacket(const ProxyPacket& proxy_packet) {
+    std::lock_guard lock(direct_mutex);
+    if (!direct_connect) {
+        return false;
+    }
+    const auto it = direct_peers.find(proxy_packet.remote_endpoint.ip);
+    if (it == direct_peers.end() || !it->second.established) {
+        return false;
+    }
+    Packet packet = MakeDirectPacket(DirectProxyPacket);
+    WriteProxyPacket(packet, proxy_packet);
+    SendDirect(it->second, packet);
+    return true;
+}
+
+Packet RoomMember::RoomMemberImpl::MakeDirectPacket(DirectMessageTypes type) const {
+    Packet packet;
+    packet.Write(DirectMagic);
+    packet.Write(static_cast<u8>(type));
+    packet.Write(fake_ip);
+    return packet;
+}
+
+void RoomMember::RoomMemberImpl::SendDirect(DirectPeer& peer, const Packet& packet) {
+    ENetBuffer buffer;
+    buffer.data = const_cast<void*>(packet.GetData());
+    buffer.dataLength = packet.GetDataSize();
+    enet_socket_send(client->socket, &peer.address, &buffer, 1);
+    peer.last_sent = std::chrono::steady_clock::now();
+}
+
+void RoomMember::RoomMemberImpl::HandleChatPacket(const ENetEvent* event) {
+    Packet packet(event->packet->data, event->packet->dataLength);
 
     // Ignore the first byte, which is the message id.
     packet.IgnoreBytes(sizeof(u8));
@@ -414,8 +768,7 @@ void RoomMember::RoomMemberImpl::HandleChatPacket(const ENetEvent* event) {
 }
 
 void RoomMember::RoomMemberImpl::HandleStatusMessagePacket(const ENetEvent* event) {
-    Packet packet;
-    packet.Append(event->packet->data, event->packet->dataLength);
+    Packet packet(event->packet->data, event->packet->dataLength);
 
     // Ignore the first byte, which is the message id.
     packet.IgnoreBytes(sizeof(u8));
@@ -430,8 +783,7 @@ void RoomMember::RoomMemberImpl::HandleStatusMessagePacket(const ENetEvent* even
 }
 
 void RoomMember::RoomMemberImpl::HandleModBanListResponsePacket(const ENetEvent* event) {
-    Packet packet;
-    packet.Append(event->packet->data, event->packet->dataLength);
+    Packet packet(event->packet->data, event->packet->dataLength);
 
     // Ignore the first byte, which is the message id.
     packet.IgnoreBytes(sizeof(u8));
@@ -443,7 +795,18 @@ void RoomMember::RoomMemberImpl::HandleModBanListResponsePacket(const ENetEvent*
 }
 
 void RoomMember::RoomMemberImpl::Disconnect() {
+    {
+        std::lock_guard lock(direct_mutex);
+        direct_connect = false;
+        direct_peers.clear();
+    }
+    if (client) {
+        client->intercept = nullptr;
+    }
+
     member_information.clear();
+    member_list_sequence = 0;
+    member_list_requested = false;
     room_information.member_slots = 0;
     room_information.name.clear();
 
@@ -621,20 +984,16 @@ bool RoomMember::IsConnected() const {
 }
 
 void RoomMember::SendProxyPacket(const ProxyPacket& proxy_packet) {
+    // Datagrams skip the room when their destination can be reached directly. Streams and
+    // broadcasts stay on the reliable relay.
+    if (proxy_packet.protocol == Protocol::UDP && !proxy_packet.broadcast &&
+        room_member_impl->SendDirectProxyPacket(proxy_packet)) {
+        return;
+    }
+
     Packet packet;
     packet.Write(static_cast<u8>(IdProxyPacket));
-
-    packet.Write(static_cast<u8>(proxy_packet.local_endpoint.family));
-    packet.Write(proxy_packet.local_endpoint.ip);
-    packet.Write(proxy_packet.local_endpoint.portno);
-
-    packet.Write(static_cast<u8>(proxy_packet.remote_endpoint.family));
-    packet.Write(proxy_packet.remote_endpoint.ip);
-    packet.Write(proxy_packet.remote_endpoint.portno);
-
-    packet.Write(static_cast<u8>(proxy_packet.protocol));
-    packet.Write(proxy_packet.broadcast);
-    packet.Write(proxy_packet.data);
+    WriteProxyPacket(packet, proxy_packet);
 
     room_member_impl->Send(std::move(packet));
 }
@@ -55,6 +55,10 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QObject* parent) {
     INSERT(Settings, audio_output_device_id, tr("Output Device:"), QString());
     INSERT(Settings, audio_input_device_id, tr("Input Device:"), QString());
     INSERT(Settings, audio_muted, tr("Mute audio"), QString());
+    INSERT(Settings, low_latency_audio, tr("Low latency audio"),
+           tr("Adjusts the amount of queued audio to what the output device needs, shrinking it "
+              "while playback is stable and growing it after an underrun.\nLowers the audio "
+              "latency, but may crackle briefly when the emulation speed drops."));
     INSERT(Settings, volume, tr("Volume:"), QString());
     INSERT(Settings, dump_audio_commands, QString(), QString());
     INSERT(UISettings, mute_when_in_background, tr("Mute audio when in background"), QString());
@@ -67,6 +71,14 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QObject* parent) {
            tr("Increases the amount of emulated RAM.\nDoesn't affect performance/stability but may "
               "allow HD texture "
               "mods to load."));
+    INSERT(Settings, use_huge_pages, tr("Use huge pages for emulated RAM"),
+           tr("Asks the host to back the emulated RAM with 2 MiB pages, reducing TLB misses "
+              "on memory-heavy games.\nOnly has an effect on Linux with transparent huge pages "
+              "enabled for shared memory."));
+    INSERT(Settings, thread_placement, tr("Thread placement:"),
+           tr("Decides which host cores the emulated CPU cores, the GPU thread and the renderer run "
+              "on.\nPrefer big cores keeps them off the efficiency cores of hybrid CPUs, Pin also "
+              "gives each emulated CPU core a host core of its own."));
     INSERT(Settings, use_speed_limit, QString(), QString());
     INSERT(Settings, current_speed_mode, QString(), QString());
     INSERT(Settings, speed_limit, tr("Limit Speed Percent"),
@@ -91,6 +103,10 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QObject* parent) {
     INSERT(Settings, cpu_accuracy, tr("Accuracy:"),
            tr("Change the accuracy of the emulated CPU (for debugging only)."));
     INSERT(Settings, cpu_backend, tr("Backend:"), QString());
+    INSERT(Settings, cpu_jit_profiling, tr("Profile guest code"),
+           tr("Counts how often each block of guest code runs and writes a flame graph of the "
+              "hottest guest functions to the log directory when the game closes.\nThis "
+              "slightly reduces performance."));
 
     INSERT(Settings, fast_cpu_time, tr("CPU Overclock"),
            tr("Overclocks the emulated CPU to remove some FPS limiters. Weaker CPUs may see "
@@ -103,6 +119,10 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QObject* parent) {
     INSERT(Settings, cpu_ticks, tr("Custom CPU Ticks"),
            tr("Set a custom value of CPU ticks. Higher values can increase performance, but may "
               "cause deadlocks. A range of 77-21000 is recommended."));
+    INSERT(Settings, cpu_jit_block_cache, tr("Precompile CPU code on boot"),
+           tr("Remembers the guest code translated by the CPU JIT and precompiles it the next "
+              "time the game boots.\nBoot becomes slower, but stutters from code being "
+              "translated for the first time are reduced."));
     INSERT(Settings, cpu_backend, tr("Backend:"), QString());
 
     // Cpu Debug
@@ -132,6 +152,11 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QObject* parent) {
     INSERT(Settings, cpuopt_unsafe_fastmem_check, tr("Disable address space checks"),
            tr("This option improves speed by eliminating a safety check before every memory "
               "operation.\nDisabling it may allow arbitrary code execution."));
+    INSERT(Settings, cpuopt_unsafe_direct_fastmem, tr("Map guest memory at its own address"),
+           tr("This option improves speed by placing guest memory at the same host addresses "
+              "the game uses, so memory operations no longer add a base address.\nOnly "
+              "available on x86-64 Linux, the game falls back to regular fastmem if the host "
+              "address range is taken."));
     INSERT(
         Settings, cpuopt_unsafe_ignore_global_monitor, tr("Ignore global monitor"),
         tr("This option improves speed by relying only on the semantics of cmpxchg to ensure "
@@ -147,6 +172,11 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QObject* parent) {
            tr("Forces to render at a different resolution.\n"
               "Higher resolutions require more VRAM and bandwidth.\n"
               "Options lower than 1X can cause artifacts."));
+    INSERT(Settings, dynamic_resolution, tr("Dynamic resolution (Vulkan only)"),
+           tr("Lowers the resolution while the GPU can't keep up and raises it again when it has "
+              "headroom,\nbetween the minimum and maximum resolutions below."));
+    INSERT(Settings, dynamic_resolution_min, tr("Minimum dynamic resolution:"), QString());
+    INSERT(Settings, dynamic_resolution_max, tr("Maximum dynamic resolution:"), QString());
     INSERT(Settings, scaling_filter, tr("Window Adapting Filter:"), QString());
     INSERT(Settings, fsr_sharpening_slider, tr("FSR Sharpness:"),
            tr("Determines how sharpened the image will look using FSR's or SGSR's dynamic contrast."));
@@ -178,6 +208,10 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QObject* parent) {
               "GPU: Use the GPU's compute shaders to decode ASTC textures (recommended).\n"
               "CPU Asynchronously: Use the CPU to decode ASTC textures on demand. Eliminates"
               "ASTC decoding\nstuttering but may present artifacts."));
+    INSERT(Settings, accelerate_bcn, tr("GPU BCn Decoding (Vulkan only)"),
+           tr("Decodes BC1 to BC5 textures with compute shaders on GPUs that lack native BCn "
+              "support,\nsuch as most mobile GPUs. BC6H and BC7 textures are still decoded on "
+              "the CPU."));
     INSERT(Settings, astc_recompression, tr("ASTC Recompression Method:"),
            tr("Most GPUs lack support for ASTC textures and must decompress to an"
               "intermediate format: RGBA8.\n"
@@ -186,6 +220,15 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QObject* parent) {
     INSERT(Settings, frame_pacing_mode, tr("Frame Pacing Mode (Vulkan only)"),
            tr("Controls how the emulator manages frame pacing to reduce stuttering and make the "
               "frame rate smoother and more consistent."));
+    INSERT(Settings, frame_interpolation, tr("Frame Interpolation (Vulkan only)"),
+           tr("Shows a frame estimated from the motion between frames in between the frames of "
+              "games that run at half the frame pacing rate or less, such as 30 FPS titles shown "
+              "at 60 Hz.\nAdds a frame of latency and can cause artifacts around moving "
+              "objects."));
+    INSERT(Settings, max_frames_in_flight, tr("Maximum Frames In Flight (Vulkan only)"),
+           tr("Limits how many frames may be waiting to be displayed. Lower values reduce the "
+              "input latency at the cost of some performance.\n0 disables the limit. The emulation "
+              "is only throttled to the display on devices supporting VK_KHR_present_wait."));
     INSERT(Settings, vram_usage_mode, tr("VRAM Usage Mode:"),
            tr("Selects whether the emulator should prefer to conserve memory or make maximum usage "
               "of available video memory for performance.\nAggressive mode may impact performance "
@@ -230,6 +273,10 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QObject* parent) {
            tr("Preserves GPU-modified data by reading it back before uploading.\nSome games require this to render certain effects properly."));
     INSERT(Settings, use_asynchronous_shaders, tr("Enable asynchronous shader compilation"),
            tr("May reduce shader stutter."));
+    INSERT(Settings, async_query_readback, tr("Asynchronous query readback"),
+           tr("Returns the previous result of occlusion and transform feedback queries instead of "
+              "waiting for the GPU.\nImproves performance in titles that poll queries every "
+              "frame, results are one frame late."));
     INSERT(Settings, fast_gpu_time, tr("Fast GPU Time"),
            tr("Overclocks the emulated GPU to increase dynamic resolution and render "
               "distance.\nUse 256 for maximal performance and 512 for maximal graphics fidelity."));
@@ -287,6 +334,11 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QObject* parent) {
     INSERT(Settings, vertex_input_dynamic_state, tr("Vertex Input Dynamic State"),
            tr("Enables vertex input dynamic state feature for better quality and performance."));
 
+    INSERT(Settings, dynamic_rendering, tr("Dynamic Rendering"),
+           tr("Records draws with VK_KHR_dynamic_rendering instead of render pass and framebuffer "
+              "objects.\nLowers the CPU cost of switching render targets and avoids stutters "
+              "when new render target combinations appear."));
+
     INSERT(
         Settings, sample_shading, tr("Sample Shading"),
         tr("Allows the fragment shader to execute per sample in a multi-sampled fragment "
@@ -457,6 +509,12 @@ std::unique_ptr<ComboboxTranslationMap> ComboboxEnumeration(QObject* parent) {
                               PAIR(CpuBackend, Dynarmic, tr("Dynarmic")),
                               PAIR(CpuBackend, Nce, tr("NCE")),
                           }});
+    translations->insert({Settings::EnumMetadata<Settings::ThreadPlacement>::Index(),
+                          {
+                              PAIR(ThreadPlacement, System, tr("Let the OS decide")),
+                              PAIR(ThreadPlacement, PreferBigCores, tr("Prefer big cores")),
+                              PAIR(ThreadPlacement, Pin, tr("Pin to big cores")),
+                          }});
     translations->insert({Settings::EnumMetadata<Settings::FullscreenMode>::Index(),
                           {
                               PAIR(FullscreenMode, Borderless, tr("Borderless Windowed")),
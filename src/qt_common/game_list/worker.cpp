@@ -4,9 +4,11 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <filesystem>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -18,6 +20,7 @@
 #include "common/fs/fs.h"
 #include "common/fs/path_util.h"
 #include "common/settings.h"
+#include "common/thread_worker.h"
 #include "core/core.h"
 #include "core/file_sys/card_image.h"
 #include "core/file_sys/content_archive.h"
@@ -28,6 +31,7 @@
 #include "core/file_sys/registered_cache.h"
 #include "core/file_sys/submission_package.h"
 #include "core/loader/loader.h"
+#include "frontend_common/game_index.h"
 
 #include "qt_common/config/uisettings.h"
 #include "qt_common/qt_common.h"
@@ -201,16 +205,14 @@ QString FormatPatchNameVersions(const FileSys::PatchManager& patch_manager,
 
 QList<QStandardItem*> MakeGameListEntry(const std::string& path, const std::string& name,
                                         const std::size_t size, const std::vector<u8>& icon,
-                                        Loader::AppLoader& loader, u64 program_id,
+                                        Loader::FileType file_type, u64 program_id,
                                         const PlayTime::PlayTimeManager& play_time_manager,
-                                        const FileSys::PatchManager& patch) {
-    auto const file_type = loader.GetFileType();
+                                        const FileSys::PatchManager& patch,
+                                        const std::function<QString()>& make_patch_versions) {
     auto const file_type_string = QString::fromStdString(Loader::GetFileTypeString(file_type));
 
-    QString patch_versions = GetGameListCachedObject(
-        fmt::format("{:016X}", patch.GetTitleID()), "pv.txt", [&patch, &loader] {
-            return FormatPatchNameVersions(patch, loader, loader.IsRomFSUpdatable());
-        });
+    QString patch_versions = GetGameListCachedObject(fmt::format("{:016X}", patch.GetTitleID()),
+                                                     "pv.txt", make_patch_versions);
 
     u64 play_time = play_time_manager.GetPlayTime(program_id);
     return QList<QStandardItem*>{
@@ -325,15 +327,130 @@ void GameListWorker::AddTitlesToGameList(GameListDir* parent_dir) {
             GetMetadataFromControlNCA(patch, *control, icon, name);
         }
 
-        auto entry = MakeGameListEntry(file->GetFullPath(), name, file->GetSize(), icon, *loader,
-                                       program_id, play_time_manager, patch);
+        auto entry = MakeGameListEntry(
+            file->GetFullPath(), name, file->GetSize(), icon, loader->GetFileType(), program_id,
+            play_time_manager, patch, [&patch, &loader] {
+                return FormatPatchNameVersions(patch, *loader, loader->IsRomFSUpdatable());
+            });
         RecordEvent([=](GameListModel* model) { model->AddEntry(entry, parent_dir); });
     }
 }
 
+void GameListWorker::AddGameFile(const std::filesystem::path& path, GameListDir* parent_dir) {
+    const auto physical_name = Common::FS::PathToUTF8String(path);
+    const u64 file_size = Common::FS::GetSize(path);
+    const s64 modified_time = FrontendCommon::GameIndex::GetModifiedTime(path);
+
+    const auto add_entry = [this, &physical_name, file_size, parent_dir](
+                               const FrontendCommon::GameIndex::Program& program,
+                               Loader::FileType file_type,
+                               const std::function<QString(const FileSys::PatchManager&)>&
+                                   make_patch_versions) {
+        const FileSys::PatchManager patch{program.program_id, system.GetFileSystemController(),
+                                          system.GetContentProvider()};
+
+        auto entry = MakeGameListEntry(physical_name, program.name, file_size, program.icon,
+                                       file_type, program.program_id, play_time_manager, patch,
+                                       [&] { return make_patch_versions(patch); });
+
+        RecordEvent([=](GameListModel* model) { model->AddEntry(entry, parent_dir); });
+    };
+
+    // Unchanged files are listed from the index, the file is only opened again if the patch list
+    // of one of its programs isn't cached.
+    if (game_index) {
+        if (const auto indexed = game_index->Find(physical_name, file_size, modified_time)) {
+            for (const auto& program : indexed->programs) {
+                add_entry(program, indexed->file_type, [&](const FileSys::PatchManager& patch) {
+                    const auto file = vfs->OpenFile(physical_name, FileSys::OpenMode::Read);
+                    const auto loader =
+                        file ? Loader::GetLoader(system, file,
+                                                 indexed->multi_program ? program.program_id : 0)
+                             : nullptr;
+                    if (!loader) {
+                        return QString{};
+                    }
+                    return FormatPatchNameVersions(patch, *loader, loader->IsRomFSUpdatable());
+                });
+            }
+            return;
+        }
+    }
+
+    const auto file = vfs->OpenFile(physical_name, FileSys::OpenMode::Read);
+    if (!file) {
+        return;
+    }
+
+    auto loader = Loader::GetLoader(system, file);
+    if (!loader) {
+        return;
+    }
+
+    const auto file_type = loader->GetFileType();
+    if (file_type == Loader::FileType::Unknown || file_type == Loader::FileType::Error) {
+        return;
+    }
+
+    if ((file_type == Loader::FileType::XCI || file_type == Loader::FileType::NSP) &&
+        !Loader::IsBootableGameContainer(file, file_type)) {
+        return;
+    }
+
+    u64 program_id = 0;
+    const auto res2 = loader->ReadProgramId(program_id);
+
+    std::vector<u64> program_ids;
+    loader->ReadProgramIds(program_ids);
+
+    FrontendCommon::GameIndex::Entry indexed{
+        .size = file_size,
+        .modified_time = modified_time,
+        .file_type = file_type,
+    };
+
+    const auto read_program = [&](std::unique_ptr<Loader::AppLoader>& app_loader, const u64 id) {
+        FrontendCommon::GameIndex::Program program{.program_id = id, .name = " "};
+        [[maybe_unused]] const auto res1 = app_loader->ReadIcon(program.icon);
+        [[maybe_unused]] const auto res3 = app_loader->ReadTitle(program.name);
+
+        add_entry(program, file_type, [&app_loader](const FileSys::PatchManager& patch) {
+            return FormatPatchNameVersions(patch, *app_loader, app_loader->IsRomFSUpdatable());
+        });
+
+        indexed.programs.push_back(std::move(program));
+    };
+
+    if (res2 == Loader::ResultStatus::Success && program_ids.size() > 1 &&
+        (file_type == Loader::FileType::XCI || file_type == Loader::FileType::NSP)) {
+        indexed.multi_program = true;
+        for (const auto id : program_ids) {
+            // dravee suggested this, only viable way to
+            // not show sub-games in qlaunch for now.
+            if ((id & 0xFFF) != 0) {
+                continue;
+            }
+            loader = Loader::GetLoader(system, file, id);
+            if (!loader) {
+                continue;
+            }
+
+            read_program(loader, id);
+        }
+    } else {
+        read_program(loader, program_id);
+    }
+
+    if (game_index && !indexed.programs.empty()) {
+        game_index->Store(physical_name, std::move(indexed));
+    }
+}
+
 void GameListWorker::ScanFileSystem(ScanTarget target, const std::string& dir_path, bool deep_scan,
                                     GameListDir* parent_dir) {
-    const auto callback = [this, target, parent_dir](const std::filesystem::path& path) -> bool {
+    std::vector<std::filesystem::path> game_files;
+
+    const auto callback = [this, target, &game_files](const std::filesystem::path& path) -> bool {
         if (stop_requested) {
             // Breaks the callback loop.
             return false;
@@ -344,6 +461,12 @@ void GameListWorker::ScanFileSystem(ScanTarget target, const std::string& dir_pa
 
         if (!is_dir &&
             (HasSupportedFileExtension(physical_name) || IsExtractedNCAMain(physical_name))) {
+            if (target == ScanTarget::PopulateGameList) {
+                // Parsed in parallel once the directory has been walked.
+                game_files.push_back(path);
+                return true;
+            }
+
             const auto file = vfs->OpenFile(physical_name, FileSys::OpenMode::Read);
             if (!file) {
                 return true;
@@ -359,66 +482,16 @@ void GameListWorker::ScanFileSystem(ScanTarget target, const std::string& dir_pa
                 return true;
             }
 
-            if (target == ScanTarget::PopulateGameList &&
-                (file_type == Loader::FileType::XCI || file_type == Loader::FileType::NSP) &&
-                !Loader::IsBootableGameContainer(file, file_type)) {
-                return true;
-            }
-
             u64 program_id = 0;
             const auto res2 = loader->ReadProgramId(program_id);
 
-            if (target == ScanTarget::FillManualContentProvider) {
-                if (res2 == Loader::ResultStatus::Success && file_type == Loader::FileType::NCA) {
-                    provider->AddEntry(FileSys::TitleType::Application,
-                                       FileSys::GetCRTypeFromNCAType(FileSys::NCA{file}.GetType()),
-                                       program_id, file);
-                } else if (Settings::values.ext_content_from_game_dirs.GetValue() &&
-                           (file_type == Loader::FileType::XCI ||
-                            file_type == Loader::FileType::NSP)) {
-                    void(provider->AddEntriesFromContainer(file));
-                }
-            } else {
-                std::vector<u64> program_ids;
-                loader->ReadProgramIds(program_ids);
-
-                const auto addEntry = [this, physical_name,
-                                       parent_dir](std::unique_ptr<Loader::AppLoader>& app_loader,
-                                                   const u64 id) {
-                    std::vector<u8> icon;
-                    [[maybe_unused]] const auto res1 = app_loader->ReadIcon(icon);
-
-                    std::string name = " ";
-                    [[maybe_unused]] const auto res3 = app_loader->ReadTitle(name);
-
-                    const FileSys::PatchManager patch{id, system.GetFileSystemController(),
-                                                      system.GetContentProvider()};
-
-                    auto entry = MakeGameListEntry(
-                        physical_name, name, Common::FS::GetSize(physical_name), icon, *app_loader,
-                        id, play_time_manager, patch);
-
-                    RecordEvent([=](GameListModel* model) { model->AddEntry(entry, parent_dir); });
-                };
-
-                if (res2 == Loader::ResultStatus::Success && program_ids.size() > 1 &&
-                    (file_type == Loader::FileType::XCI || file_type == Loader::FileType::NSP)) {
-                    for (const auto id : program_ids) {
-                        // dravee suggested this, only viable way to
-                        // not show sub-games in qlaunch for now.
-                        if ((id & 0xFFF) != 0) {
-                            continue;
-                        }
-                        loader = Loader::GetLoader(system, file, id);
-                        if (!loader) {
-                            continue;
-                        }
-
-                        addEntry(loader, id);
-                    }
-                } else {
-                    addEntry(loader, program_id);
-                }
+            if (res2 == Loader::ResultStatus::Success && file_type == Loader::FileType::NCA) {
+                provider->AddEntry(FileSys::TitleType::Application,
+                                   FileSys::GetCRTypeFromNCAType(FileSys::NCA{file}.GetType()),
+                                   program_id, file);
+            } else if (Settings::values.ext_content_from_game_dirs.GetValue() &&
+                       (file_type == Loader::FileType::XCI || file_type == Loader::FileType::NSP)) {
+                void(provider->AddEntriesFromContainer(file));
             }
         } else if (is_dir) {
             watch_list.append(QString::fromStdString(physical_name));
@@ -433,12 +506,39 @@ void GameListWorker::ScanFileSystem(ScanTarget target, const std::string& dir_pa
     } else {
         Common::FS::IterateDirEntries(dir_path, callback, Common::FS::DirEntryFilter::File);
     }
+
+    if (game_files.empty()) {
+        return;
+    }
+
+    // Parsing a container is dominated by file reads and decryption, spread it over a few threads.
+    // Entries show up in completion order, the list is sorted once populated.
+    const size_t num_workers =
+        std::clamp<size_t>(std::thread::hardware_concurrency() / 2, 1, 4);
+    Common::ThreadWorker scan_workers{(std::min)(num_workers, game_files.size()),
+                                      "GameList:Scan"};
+    for (const auto& path : game_files) {
+        scan_workers.QueueWork([this, path, parent_dir] {
+            if (!stop_requested) {
+                AddGameFile(path, parent_dir);
+            }
+        });
+    }
+    scan_workers.WaitForRequests();
 }
 
 void GameListWorker::run() {
     watch_list.clear();
     provider->ClearAllEntries();
 
+    if (UISettings::values.cache_game_list) {
+        game_index = std::make_unique<FrontendCommon::GameIndex>(
+            Common::FS::GetEdenPath(Common::FS::EdenPath::CacheDir) / "game_list" / "index.bin");
+        game_index->Load();
+    } else {
+        game_index.reset();
+    }
+
     const auto DirEntryReady = [&](GameListDir* game_list_dir) {
         RecordEvent([=](GameListModel* model) { model->AddDirEntry(game_list_dir); });
     };
@@ -478,6 +578,10 @@ void GameListWorker::run() {
         }
     }
 
+    if (game_index && !stop_requested) {
+        void(game_index->Save());
+    }
+
     RecordEvent([this](GameListModel* model) { model->DonePopulating(watch_list); });
     processing_completed.Set();
 }
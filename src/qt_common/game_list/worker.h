@@ -8,6 +8,7 @@
 
 #include <atomic>
 #include <deque>
+#include <filesystem>
 #include <memory>
 #include <string>
 
@@ -25,6 +26,10 @@ namespace Core {
 class System;
 }
 
+namespace FrontendCommon {
+class GameIndex;
+}
+
 class GameListDir;
 class GameListModel;
 class QStandardItem;
@@ -80,8 +85,12 @@ private:
     void ScanFileSystem(ScanTarget target, const std::string& dir_path, bool deep_scan,
                         GameListDir* parent_dir);
 
+    /// Adds the programs of a game file to the game list, reading them from the index if possible
+    void AddGameFile(const std::filesystem::path& path, GameListDir* parent_dir);
+
     std::shared_ptr<FileSys::VfsFilesystem> vfs;
     FileSys::ManualContentProvider* provider;
+    std::unique_ptr<FrontendCommon::GameIndex> game_index;
     QVector<UISettings::GameDir>& game_dirs;
     const PlayTime::PlayTimeManager& play_time_manager;
 
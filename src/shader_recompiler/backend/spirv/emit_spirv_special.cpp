@@ -22,8 +22,10 @@ void ConvertDepthMode(EmitContext& ctx) {
 
 void SetFixedPipelinePointSize(EmitContext& ctx) {
     if (ctx.runtime_info.fixed_state_point_size) {
-        const float point_size{*ctx.runtime_info.fixed_state_point_size};
-        ctx.OpStore(ctx.output_point_size, ctx.Const(point_size));
+        const Id point_size{Sirit::ValidId(ctx.fixed_point_size_spec)
+                                ? ctx.fixed_point_size_spec
+                                : ctx.Const(*ctx.runtime_info.fixed_state_point_size)};
+        ctx.OpStore(ctx.output_point_size, point_size);
     }
 }
 
@@ -64,12 +66,27 @@ Id ComparisonFunction(EmitContext& ctx, CompareFunction comparison, Id operand_1
     throw InvalidArgument("Comparison function {}", comparison);
 }
 
+Id SpecializedComparisonFunction(EmitContext& ctx, Id operand_1, Id operand_2) {
+    // Evaluate every comparison and pick the one selected by the specialization constant,
+    // drivers fold the selection when the pipeline is built
+    Id result{ctx.true_value};
+    for (u32 func = static_cast<u32>(CompareFunction::Never);
+         func < static_cast<u32>(CompareFunction::Always); ++func) {
+        const Id is_func{ctx.OpIEqual(ctx.U1, ctx.alpha_test_func_spec, ctx.Const(func))};
+        const Id comparison{
+            ComparisonFunction(ctx, static_cast<CompareFunction>(func), operand_1, operand_2)};
+        result = ctx.OpSelect(ctx.U1, is_func, comparison, result);
+    }
+    return result;
+}
+
 void AlphaTest(EmitContext& ctx) {
     if (!ctx.runtime_info.alpha_test_func) {
         return;
     }
+    const bool is_specialized{Sirit::ValidId(ctx.alpha_test_func_spec)};
     const auto comparison{*ctx.runtime_info.alpha_test_func};
-    if (comparison == CompareFunction::Always) {
+    if (!is_specialized && comparison == CompareFunction::Always) {
         return;
     }
     if (!Sirit::ValidId(ctx.frag_color[0])) {
@@ -82,8 +99,11 @@ void AlphaTest(EmitContext& ctx) {
 
     const Id true_label{ctx.OpLabel()};
     const Id discard_label{ctx.OpLabel()};
-    const Id alpha_reference{ctx.Const(ctx.runtime_info.alpha_test_reference)};
-    const Id condition{ComparisonFunction(ctx, comparison, alpha, alpha_reference)};
+    const Id condition{
+        is_specialized
+            ? SpecializedComparisonFunction(ctx, alpha, ctx.alpha_test_reference_spec)
+            : ComparisonFunction(ctx, comparison, alpha,
+                                 ctx.Const(ctx.runtime_info.alpha_test_reference))};
 
     ctx.OpSelectionMerge(true_label, spv::SelectionControlMask::MaskNone);
     ctx.OpBranchConditional(condition, true_label, discard_label);
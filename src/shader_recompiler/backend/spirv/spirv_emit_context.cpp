@@ -182,7 +182,9 @@ void DefineGenericOutput(EmitContext& ctx, size_t index, std::optional<u32> invo
                 ctx.Decorate(id, spv::Decoration::Stream, xfb_varying->stream);
             }
         }
-        if (num_components < 4 || element > 0) {
+        if (!ctx.profile.emit_debug_names) {
+            // Skip formatting the name
+        } else if (num_components < 4 || element > 0) {
             const std::string_view subswizzle{swizzle.substr(element, num_components)};
             ctx.Name(id, fmt::format("out_attr{}_{}", index, subswizzle));
         } else {
@@ -263,6 +265,9 @@ std::string_view StageName(Stage stage) {
 
 template <typename... Args>
 void Name(EmitContext& ctx, Id object, std::string_view format_str, Args&&... args) {
+    if (!ctx.profile.emit_debug_names) {
+        return;
+    }
     ctx.Name(object, fmt::format(fmt::runtime(format_str), StageName(ctx.stage),
                                  std::forward<Args>(args)...)
                          .c_str());
@@ -287,7 +292,9 @@ void DefineConstBuffers(EmitContext& ctx, const Info& info, Id UniformDefinition
         const Id id{ctx.AddGlobalVariable(struct_pointer_type, spv::StorageClass::Uniform)};
         ctx.Decorate(id, spv::Decoration::Binding, binding);
         ctx.Decorate(id, spv::Decoration::DescriptorSet, 0U);
-        ctx.Name(id, fmt::format("c{}", desc.index));
+        if (ctx.profile.emit_debug_names) {
+            ctx.Name(id, fmt::format("c{}", desc.index));
+        }
         for (size_t i = 0; i < desc.count; ++i) {
             ctx.cbufs[desc.index + i].*member_type = id;
         }
@@ -317,7 +324,9 @@ void DefineSsbos(EmitContext& ctx, StorageTypeDefinition& type_def,
         const Id id{ctx.AddGlobalVariable(struct_pointer, spv::StorageClass::StorageBuffer)};
         ctx.Decorate(id, spv::Decoration::Binding, binding);
         ctx.Decorate(id, spv::Decoration::DescriptorSet, 0U);
-        ctx.Name(id, fmt::format("ssbo{}", index));
+        if (ctx.profile.emit_debug_names) {
+            ctx.Name(id, fmt::format("ssbo{}", index));
+        }
         if (ctx.profile.supported_spirv >= 0x00010400) {
             ctx.interfaces.push_back(id);
         }
@@ -448,8 +457,8 @@ Id DescType(EmitContext& ctx, Id sampled_type, Id pointer_type, u32 count) {
 }
 } // Anonymous namespace
 
-void VectorTypes::Define(Sirit::Module& sirit_ctx, Id base_type, std::string_view name) {
-    defs[0] = sirit_ctx.Name(base_type, name);
+void VectorTypes::Define(EmitContext& ctx, Id base_type, std::string_view name) {
+    defs[0] = ctx.Name(base_type, name);
 
     std::array<char, 6> def_name;
     for (int i = 1; i < 4; ++i) {
@@ -457,7 +466,7 @@ void VectorTypes::Define(Sirit::Module& sirit_ctx, Id base_type, std::string_vie
             def_name.data(),
             fmt::format_to_n(def_name.data(), def_name.size(), "{}x{}", name, i + 1).size);
         defs[static_cast<size_t>(i)] =
-            sirit_ctx.Name(sirit_ctx.TypeVector(base_type, i + 1), def_name_view);
+            ctx.Name(ctx.TypeVector(base_type, i + 1), def_name_view);
     }
 }
 
@@ -474,6 +483,7 @@ EmitContext::EmitContext(const Profile& profile_, const RuntimeInfo& runtime_inf
     AddCapability(spv::Capability::Shader);
     DefineCommonTypes(program.info);
     DefineCommonConstants();
+    DefineSpecializationConstants();
     DefineInterfaces(program);
     DefineLocalMemory(program);
     DefineSharedMemory(program);
@@ -581,6 +591,27 @@ void EmitContext::DefineCommonConstants() {
     f32_zero_value = Const(0.0f);
 }
 
+void EmitContext::DefineSpecializationConstants() {
+    if (!runtime_info.specialize_fixed_state) {
+        return;
+    }
+    const auto define{[this](Id type, auto default_value, SpecializationConstant spec_id) {
+        const Id id{SpecConstant(type, default_value)};
+        Decorate(id, spv::Decoration::SpecId, static_cast<u32>(spec_id));
+        return id;
+    }};
+    if (stage == Stage::Fragment && runtime_info.alpha_test_func) {
+        alpha_test_func_spec = define(U32[1], static_cast<u32>(CompareFunction::Always),
+                                      SpecializationConstant::AlphaTestFunc);
+        alpha_test_reference_spec =
+            define(F32[1], 0.0f, SpecializationConstant::AlphaTestReference);
+    }
+    if ((stage == Stage::VertexB || stage == Stage::Geometry) &&
+        runtime_info.fixed_state_point_size) {
+        fixed_point_size_spec = define(F32[1], 1.0f, SpecializationConstant::FixedPointSize);
+    }
+}
+
 void EmitContext::DefineInterfaces(const IR::Program& program) {
     DefineInputs(program);
     DefineOutputs(program);
@@ -1335,7 +1366,9 @@ void EmitContext::DefineTextureBuffers(const Info& info, u32& binding) {
         const Id id{AddGlobalVariable(type, spv::StorageClass::UniformConstant)};
         Decorate(id, spv::Decoration::Binding, binding);
         Decorate(id, spv::Decoration::DescriptorSet, 0U);
-        Name(id, NameOf(stage, desc, "texbuf"));
+        if (profile.emit_debug_names) {
+            Name(id, NameOf(stage, desc, "texbuf"));
+        }
         texture_buffers.push_back({
             .id = id,
             .count = desc.count,
@@ -1358,7 +1391,9 @@ void EmitContext::DefineImageBuffers(const Info& info, u32& binding) {
         const Id id{AddGlobalVariable(pointer_type, spv::StorageClass::UniformConstant)};
         Decorate(id, spv::Decoration::Binding, binding);
         Decorate(id, spv::Decoration::DescriptorSet, 0U);
-        Name(id, NameOf(stage, desc, "imgbuf"));
+        if (profile.emit_debug_names) {
+            Name(id, NameOf(stage, desc, "imgbuf"));
+        }
         image_buffers.push_back({
             .id = id,
             .image_type = image_type,
@@ -1383,7 +1418,9 @@ void EmitContext::DefineTextures(const Info& info, u32& binding, u32& scaling_in
         const Id id{AddGlobalVariable(desc_type, spv::StorageClass::UniformConstant)};
         Decorate(id, spv::Decoration::Binding, binding);
         Decorate(id, spv::Decoration::DescriptorSet, 0U);
-        Name(id, NameOf(stage, desc, "tex"));
+        if (profile.emit_debug_names) {
+            Name(id, NameOf(stage, desc, "tex"));
+        }
         textures.push_back({
             .id = id,
             .sampled_type = sampled_type,
@@ -1413,7 +1450,9 @@ void EmitContext::DefineImages(const Info& info, u32& binding, u32& scaling_inde
         const Id id{AddGlobalVariable(pointer_type, spv::StorageClass::UniformConstant)};
         Decorate(id, spv::Decoration::Binding, binding);
         Decorate(id, spv::Decoration::DescriptorSet, 0U);
-        Name(id, NameOf(stage, desc, "img"));
+        if (profile.emit_debug_names) {
+            Name(id, NameOf(stage, desc, "img"));
+        }
         images.push_back({
             .id = id,
             .image_type = image_type,
@@ -1575,7 +1614,9 @@ void EmitContext::DefineInputs(const IR::Program& program) {
         const Id type{GetAttributeType(*this, input_type)};
         const Id id{DefineInput(*this, type, true)};
         Decorate(id, spv::Decoration::Location, static_cast<u32>(index));
-        Name(id, fmt::format("in_attr{}", index));
+        if (profile.emit_debug_names) {
+            Name(id, fmt::format("in_attr{}", index));
+        }
         input_generics[index] = GetAttributeInfo(*this, input_type, id);
 
         if (info.passthrough.Generic(index) && profile.support_geometry_shader_passthrough) {
@@ -23,9 +23,11 @@ static std::bitset<8> clip_distance_written;
 
 using Sirit::Id;
 
+class EmitContext;
+
 class VectorTypes {
 public:
-    void Define(Sirit::Module& sirit_ctx, Id base_type, std::string_view name);
+    void Define(EmitContext& ctx, Id base_type, std::string_view name);
 
     [[nodiscard]] Id operator[](size_t size) const noexcept {
         return defs[size - 1];
@@ -170,6 +172,15 @@ public:
 
     [[nodiscard]] Id Def(const IR::Value& value);
 
+    /// Debug names are dropped unless the profile asks for them
+    Id Name(Id target, std::string_view name) {
+        return profile.emit_debug_names ? Sirit::Module::Name(target, name) : target;
+    }
+
+    Id MemberName(Id type, u32 member, std::string_view name) {
+        return profile.emit_debug_names ? Sirit::Module::MemberName(type, member, name) : type;
+    }
+
     [[nodiscard]] Id BitOffset8(const IR::Value& offset);
     [[nodiscard]] Id BitOffset16(const IR::Value& offset);
 
@@ -233,6 +244,10 @@ public:
     Id u32_zero_value{};
     Id f32_zero_value{};
 
+    Id alpha_test_func_spec{};
+    Id alpha_test_reference_spec{};
+    Id fixed_point_size_spec{};
+
     UniformDefinitions uniform_types;
     StorageTypeDefinitions storage_types;
 
@@ -380,6 +395,7 @@ public:
 private:
     void DefineCommonTypes(const Info& info);
     void DefineCommonConstants();
+    void DefineSpecializationConstants();
     void DefineInterfaces(const IR::Program& program);
     void DefineLocalMemory(const IR::Program& program);
     void DefineSharedMemory(const IR::Program& program);
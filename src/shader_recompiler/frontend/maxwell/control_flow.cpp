@@ -256,19 +256,21 @@ void CFG::AnalyzeLabel(FunctionId function_id, Label& label) {
 bool CFG::InspectVisitedBlocks(FunctionId function_id, const Label& label) {
     const Location pc{label.address};
     Function& function{functions[function_id]};
-    const auto it{
-        std::ranges::find_if(function.blocks, [pc](auto& block) { return block.Contains(pc); })};
-    if (it == function.blocks.end()) {
+    // Visited blocks never overlap, only the last block starting before the address can contain
+    // it. This keeps the lookup logarithmic on programs with thousands of blocks.
+    auto it{function.blocks.upper_bound(pc, Compare{})};
+    if (it == function.blocks.begin() || !std::prev(it)->Contains(pc)) {
         // Address has not been visited
         return false;
     }
+    --it;
     Block* const visited_block{&*it};
     if (visited_block->begin == pc) {
         throw LogicError("Dangling block");
     }
     Block* const new_block{label.block};
     Split(visited_block, new_block, pc);
-    function.blocks.insert(it, *new_block);
+    function.blocks.insert(std::next(it), *new_block);
     return true;
 }
 
@@ -9,6 +9,7 @@
 #include <memory>
 #include <ranges>
 #include <string_view>
+#include <vector>
 
 #include "common/assert.h"
 #include "common/common_types.h"
@@ -40,12 +41,52 @@ consteval std::pair<u64, u64> MaskValueFromEncoding(const char data[20]) noexcep
     return { mask, value };
 }
 
-Opcode Decode(u64 insn) {
-#define INST(name, cute, encode) \
-    if (auto const p = MaskValueFromEncoding(encode); (insn & p.first) == p.second) \
-        return Opcode::name;
+namespace {
+struct InstEncoding {
+    u64 mask;
+    u64 value;
+    Opcode opcode;
+};
+
+constexpr std::array ENCODINGS{
+#define INST(name, cute, encode)                                                                   \
+    InstEncoding{MaskValueFromEncoding(encode).first, MaskValueFromEncoding(encode).second,        \
+                 Opcode::name},
 #include "maxwell.inc"
 #undef INST
+};
+
+/// Number of leading instruction bits used to index the lookup table
+constexpr size_t FAST_LOOKUP_BITS = 12;
+constexpr size_t FAST_LOOKUP_SHIFT = 64 - FAST_LOOKUP_BITS;
+constexpr size_t FAST_LOOKUP_SIZE = size_t(1) << FAST_LOOKUP_BITS;
+
+using FastLookupTable = std::array<std::vector<InstEncoding>, FAST_LOOKUP_SIZE>;
+
+/// Groups the encodings by the leading bits they can match, keeping their declaration order so
+/// overlapping encodings resolve the same way as a linear search
+std::unique_ptr<FastLookupTable> MakeFastLookupTable() {
+    auto table{std::make_unique<FastLookupTable>()};
+    for (size_t index = 0; index < FAST_LOOKUP_SIZE; ++index) {
+        const u64 leading_bits{static_cast<u64>(index) << FAST_LOOKUP_SHIFT};
+        for (const InstEncoding& encoding : ENCODINGS) {
+            const u64 mask{encoding.mask & (~u64(0) << FAST_LOOKUP_SHIFT)};
+            if ((leading_bits & mask) == (encoding.value & mask)) {
+                (*table)[index].push_back(encoding);
+            }
+        }
+    }
+    return table;
+}
+} // Anonymous namespace
+
+Opcode Decode(u64 insn) {
+    static const std::unique_ptr<FastLookupTable> fast_lookup_table{MakeFastLookupTable()};
+    for (const InstEncoding& encoding : (*fast_lookup_table)[insn >> FAST_LOOKUP_SHIFT]) {
+        if ((insn & encoding.mask) == encoding.value) {
+            return encoding.opcode;
+        }
+    }
     ASSERT_MSG(false, "Invalid insn 0x{:016x}", insn);
     return Opcode::NOP;
 }
@@ -10,6 +10,7 @@
 #include <queue>
 
 #include "common/settings.h"
+#include "common/trace.h"
 #include "shader_recompiler/exception.h"
 #include "shader_recompiler/frontend/ir/basic_block.h"
 #include "shader_recompiler/frontend/ir/ir_emitter.h"
@@ -22,6 +23,13 @@
 
 namespace Shader::Maxwell {
 namespace {
+/// Runs an optimization pass inside a trace event named after it
+#define RUN_PASS(pass, ...)                                                                        \
+    do {                                                                                           \
+        TRACE_SCOPE(#pass);                                                                        \
+        Optimization::pass(__VA_ARGS__);                                                           \
+    } while (false)
+
 IR::BlockList GenerateBlocks(const IR::AbstractSyntaxList& syntax_list) {
     size_t num_syntax_blocks{};
     for (const auto& node : syntax_list) {
@@ -240,7 +248,10 @@ IR::Program TranslateProgram(ObjectPool<IR::Inst>& inst_pool, ObjectPool<IR::Blo
     normalized_host_info.ApplyDescriptorLimitPolicy();
 
     IR::Program program;
-    program.syntax_list = BuildASL(inst_pool, block_pool, env, cfg, normalized_host_info);
+    {
+        TRACE_SCOPE("BuildASL");
+        program.syntax_list = BuildASL(inst_pool, block_pool, env, cfg, normalized_host_info);
+    }
     program.blocks = GenerateBlocks(program.syntax_list);
     program.post_order_blocks = PostOrder(program.syntax_list.front());
     program.stage = env.ShaderStage();
@@ -281,42 +292,46 @@ IR::Program TranslateProgram(ObjectPool<IR::Inst>& inst_pool, ObjectPool<IR::Blo
 
     // Replace instructions before the SSA rewrite
     if (!normalized_host_info.support_float64) {
-        Optimization::LowerFp64ToFp32(program);
+        RUN_PASS(LowerFp64ToFp32, program);
     }
     if (!normalized_host_info.support_float16) {
-        Optimization::LowerFp16ToFp32(program);
+        RUN_PASS(LowerFp16ToFp32, program);
     }
     if (!normalized_host_info.support_int64) {
-        Optimization::LowerInt64ToInt32(program);
+        RUN_PASS(LowerInt64ToInt32, program);
     }
     if (!normalized_host_info.support_conditional_barrier) {
-        Optimization::ConditionalBarrierPass(program);
+        RUN_PASS(ConditionalBarrierPass, program);
     }
-    Optimization::SsaRewritePass(program);
+    RUN_PASS(SsaRewritePass, program);
+    RUN_PASS(PromoteLocalMemoryPass, program);
 
-    Optimization::ConstantPropagationPass(env, program);
+    RUN_PASS(ConstantPropagationPass, env, program);
 
-    Optimization::PositionPass(env, program);
+    RUN_PASS(PositionPass, env, program);
 
-    Optimization::GlobalMemoryToStorageBufferPass(program, normalized_host_info);
-    Optimization::TexturePass(env, program, normalized_host_info);
+    RUN_PASS(GlobalMemoryToStorageBufferPass, program, normalized_host_info);
+    RUN_PASS(TexturePass, env, program, normalized_host_info);
 
     if (Settings::values.resolution_info.active || Settings::values.rescale_hack.GetValue()) {
-        Optimization::RescalingPass(program);
+        RUN_PASS(RescalingPass, program);
     }
-    Optimization::DeadCodeEliminationPass(program);
+    RUN_PASS(GlobalValueNumberingPass, program);
+    RUN_PASS(DeadCodeEliminationPass, program);
     if (Settings::values.renderer_debug) {
-        Optimization::VerificationPass(program);
+        RUN_PASS(VerificationPass, program);
     }
-    Optimization::CollectShaderInfoPass(env, program);
-    Optimization::LayerPass(program, normalized_host_info);
-    Optimization::VendorWorkaroundPass(program);
+    RUN_PASS(CollectShaderInfoPass, env, program);
+    RUN_PASS(LayerPass, program, normalized_host_info);
+    RUN_PASS(VendorWorkaroundPass, program);
 
     CollectInterpolationInfo(env, program);
     AddNVNStorageBuffers(program);
     return program;
 }
 
+#undef RUN_PASS
+
 IR::Program MergeDualVertexPrograms(IR::Program& vertex_a, IR::Program& vertex_b,
                                     Environment& env_vertex_b) {
     IR::Program result{};
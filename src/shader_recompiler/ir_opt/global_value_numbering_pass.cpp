@@ -0,0 +1,496 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Hoists loop invariant instructions into the block dominating their loop and removes
+// instructions that recompute a value already available from a dominating block.
+// Only instructions without side effects whose result depends exclusively on their arguments
+// are considered, so moving or deduplicating them never changes the program behavior.
+
+#include <array>
+#include <utility>
+#include <vector>
+
+#include <ankerl/unordered_dense.h>
+
+#include "shader_recompiler/frontend/ir/abstract_syntax_list.h"
+#include "shader_recompiler/frontend/ir/basic_block.h"
+#include "shader_recompiler/frontend/ir/value.h"
+#include "shader_recompiler/ir_opt/passes.h"
+
+namespace Shader::Optimization {
+namespace {
+constexpr size_t MAX_ARGS = 5;
+
+bool IsPure(const IR::Inst& inst) {
+    if (inst.HasAssociatedPseudoOperation()) {
+        // Pseudo operations read state produced by this exact instruction
+        return false;
+    }
+    switch (inst.GetOpcode()) {
+    case IR::Opcode::GetCbufU8:
+    case IR::Opcode::GetCbufS8:
+    case IR::Opcode::GetCbufU16:
+    case IR::Opcode::GetCbufS16:
+    case IR::Opcode::GetCbufU32:
+    case IR::Opcode::GetCbufF32:
+    case IR::Opcode::GetCbufU32x2:
+    case IR::Opcode::CompositeConstructU32x2:
+    case IR::Opcode::CompositeConstructU32x3:
+    case IR::Opcode::CompositeConstructU32x4:
+    case IR::Opcode::CompositeExtractU32x2:
+    case IR::Opcode::CompositeExtractU32x3:
+    case IR::Opcode::CompositeExtractU32x4:
+    case IR::Opcode::CompositeInsertU32x2:
+    case IR::Opcode::CompositeInsertU32x3:
+    case IR::Opcode::CompositeInsertU32x4:
+    case IR::Opcode::CompositeConstructF16x2:
+    case IR::Opcode::CompositeConstructF16x3:
+    case IR::Opcode::CompositeConstructF16x4:
+    case IR::Opcode::CompositeExtractF16x2:
+    case IR::Opcode::CompositeExtractF16x3:
+    case IR::Opcode::CompositeExtractF16x4:
+    case IR::Opcode::CompositeInsertF16x2:
+    case IR::Opcode::CompositeInsertF16x3:
+    case IR::Opcode::CompositeInsertF16x4:
+    case IR::Opcode::CompositeConstructF32x2:
+    case IR::Opcode::CompositeConstructF32x3:
+    case IR::Opcode::CompositeConstructF32x4:
+    case IR::Opcode::CompositeExtractF32x2:
+    case IR::Opcode::CompositeExtractF32x3:
+    case IR::Opcode::CompositeExtractF32x4:
+    case IR::Opcode::CompositeInsertF32x2:
+    case IR::Opcode::CompositeInsertF32x3:
+    case IR::Opcode::CompositeInsertF32x4:
+    case IR::Opcode::CompositeConstructF64x2:
+    case IR::Opcode::CompositeConstructF64x3:
+    case IR::Opcode::CompositeConstructF64x4:
+    case IR::Opcode::CompositeExtractF64x2:
+    case IR::Opcode::CompositeExtractF64x3:
+    case IR::Opcode::CompositeExtractF64x4:
+    case IR::Opcode::CompositeInsertF64x2:
+    case IR::Opcode::CompositeInsertF64x3:
+    case IR::Opcode::CompositeInsertF64x4:
+    case IR::Opcode::SelectU1:
+    case IR::Opcode::SelectU8:
+    case IR::Opcode::SelectU16:
+    case IR::Opcode::SelectU32:
+    case IR::Opcode::SelectU64:
+    case IR::Opcode::SelectF16:
+    case IR::Opcode::SelectF32:
+    case IR::Opcode::SelectF64:
+    case IR::Opcode::BitCastU16F16:
+    case IR::Opcode::BitCastU32F32:
+    case IR::Opcode::BitCastU64F64:
+    case IR::Opcode::BitCastF16U16:
+    case IR::Opcode::BitCastF32U32:
+    case IR::Opcode::BitCastF64U64:
+    case IR::Opcode::PackUint2x32:
+    case IR::Opcode::UnpackUint2x32:
+    case IR::Opcode::PackFloat2x16:
+    case IR::Opcode::UnpackFloat2x16:
+    case IR::Opcode::PackHalf2x16:
+    case IR::Opcode::UnpackHalf2x16:
+    case IR::Opcode::PackDouble2x32:
+    case IR::Opcode::UnpackDouble2x32:
+    case IR::Opcode::FPAbs16:
+    case IR::Opcode::FPAbs32:
+    case IR::Opcode::FPAbs64:
+    case IR::Opcode::FPAdd16:
+    case IR::Opcode::FPAdd32:
+    case IR::Opcode::FPAdd64:
+    case IR::Opcode::FPFma16:
+    case IR::Opcode::FPFma32:
+    case IR::Opcode::FPFma64:
+    case IR::Opcode::FPMax32:
+    case IR::Opcode::FPMax64:
+    case IR::Opcode::FPMin32:
+    case IR::Opcode::FPMin64:
+    case IR::Opcode::FPMul16:
+    case IR::Opcode::FPMul32:
+    case IR::Opcode::FPMul64:
+    case IR::Opcode::FPNeg16:
+    case IR::Opcode::FPNeg32:
+    case IR::Opcode::FPNeg64:
+    case IR::Opcode::FPRecip32:
+    case IR::Opcode::FPRecip64:
+    case IR::Opcode::FPRecipSqrt32:
+    case IR::Opcode::FPRecipSqrt64:
+    case IR::Opcode::FPSqrt:
+    case IR::Opcode::FPSin:
+    case IR::Opcode::FPExp2:
+    case IR::Opcode::FPCos:
+    case IR::Opcode::FPLog2:
+    case IR::Opcode::FPSaturate16:
+    case IR::Opcode::FPSaturate32:
+    case IR::Opcode::FPSaturate64:
+    case IR::Opcode::FPClamp16:
+    case IR::Opcode::FPClamp32:
+    case IR::Opcode::FPClamp64:
+    case IR::Opcode::FPRoundEven16:
+    case IR::Opcode::FPRoundEven32:
+    case IR::Opcode::FPRoundEven64:
+    case IR::Opcode::FPFloor16:
+    case IR::Opcode::FPFloor32:
+    case IR::Opcode::FPFloor64:
+    case IR::Opcode::FPCeil16:
+    case IR::Opcode::FPCeil32:
+    case IR::Opcode::FPCeil64:
+    case IR::Opcode::FPTrunc16:
+    case IR::Opcode::FPTrunc32:
+    case IR::Opcode::FPTrunc64:
+    case IR::Opcode::FPOrdEqual16:
+    case IR::Opcode::FPOrdEqual32:
+    case IR::Opcode::FPOrdEqual64:
+    case IR::Opcode::FPUnordEqual16:
+    case IR::Opcode::FPUnordEqual32:
+    case IR::Opcode::FPUnordEqual64:
+    case IR::Opcode::FPOrdNotEqual16:
+    case IR::Opcode::FPOrdNotEqual32:
+    case IR::Opcode::FPOrdNotEqual64:
+    case IR::Opcode::FPUnordNotEqual16:
+    case IR::Opcode::FPUnordNotEqual32:
+    case IR::Opcode::FPUnordNotEqual64:
+    case IR::Opcode::FPOrdLessThan16:
+    case IR::Opcode::FPOrdLessThan32:
+    case IR::Opcode::FPOrdLessThan64:
+    case IR::Opcode::FPUnordLessThan16:
+    case IR::Opcode::FPUnordLessThan32:
+    case IR::Opcode::FPUnordLessThan64:
+    case IR::Opcode::FPOrdGreaterThan16:
+    case IR::Opcode::FPOrdGreaterThan32:
+    case IR::Opcode::FPOrdGreaterThan64:
+    case IR::Opcode::FPUnordGreaterThan16:
+    case IR::Opcode::FPUnordGreaterThan32:
+    case IR::Opcode::FPUnordGreaterThan64:
+    case IR::Opcode::FPOrdLessThanEqual16:
+    case IR::Opcode::FPOrdLessThanEqual32:
+    case IR::Opcode::FPOrdLessThanEqual64:
+    case IR::Opcode::FPUnordLessThanEqual16:
+    case IR::Opcode::FPUnordLessThanEqual32:
+    case IR::Opcode::FPUnordLessThanEqual64:
+    case IR::Opcode::FPOrdGreaterThanEqual16:
+    case IR::Opcode::FPOrdGreaterThanEqual32:
+    case IR::Opcode::FPOrdGreaterThanEqual64:
+    case IR::Opcode::FPUnordGreaterThanEqual16:
+    case IR::Opcode::FPUnordGreaterThanEqual32:
+    case IR::Opcode::FPUnordGreaterThanEqual64:
+    case IR::Opcode::FPIsNan16:
+    case IR::Opcode::FPIsNan32:
+    case IR::Opcode::FPIsNan64:
+    case IR::Opcode::IAdd32:
+    case IR::Opcode::IAdd64:
+    case IR::Opcode::ISub32:
+    case IR::Opcode::ISub64:
+    case IR::Opcode::IMul32:
+    case IR::Opcode::INeg32:
+    case IR::Opcode::INeg64:
+    case IR::Opcode::IAbs32:
+    case IR::Opcode::IAbs64:
+    case IR::Opcode::ShiftLeftLogical32:
+    case IR::Opcode::ShiftLeftLogical64:
+    case IR::Opcode::ShiftRightLogical32:
+    case IR::Opcode::ShiftRightLogical64:
+    case IR::Opcode::ShiftRightArithmetic32:
+    case IR::Opcode::ShiftRightArithmetic64:
+    case IR::Opcode::BitwiseAnd32:
+    case IR::Opcode::BitwiseOr32:
+    case IR::Opcode::BitwiseXor32:
+    case IR::Opcode::BitFieldInsert:
+    case IR::Opcode::BitFieldSExtract:
+    case IR::Opcode::BitFieldUExtract:
+    case IR::Opcode::BitReverse32:
+    case IR::Opcode::BitCount32:
+    case IR::Opcode::BitwiseNot32:
+    case IR::Opcode::FindSMsb32:
+    case IR::Opcode::FindUMsb32:
+    case IR::Opcode::SMin32:
+    case IR::Opcode::UMin32:
+    case IR::Opcode::SMax32:
+    case IR::Opcode::UMax32:
+    case IR::Opcode::SClamp32:
+    case IR::Opcode::UClamp32:
+    case IR::Opcode::SLessThan:
+    case IR::Opcode::ULessThan:
+    case IR::Opcode::IEqual:
+    case IR::Opcode::SLessThanEqual:
+    case IR::Opcode::ULessThanEqual:
+    case IR::Opcode::SGreaterThan:
+    case IR::Opcode::UGreaterThan:
+    case IR::Opcode::INotEqual:
+    case IR::Opcode::SGreaterThanEqual:
+    case IR::Opcode::UGreaterThanEqual:
+    case IR::Opcode::LogicalOr:
+    case IR::Opcode::LogicalAnd:
+    case IR::Opcode::LogicalXor:
+    case IR::Opcode::LogicalNot:
+    case IR::Opcode::ConvertS16F16:
+    case IR::Opcode::ConvertS16F32:
+    case IR::Opcode::ConvertS16F64:
+    case IR::Opcode::ConvertS32F16:
+    case IR::Opcode::ConvertS32F32:
+    case IR::Opcode::ConvertS32F64:
+    case IR::Opcode::ConvertS64F16:
+    case IR::Opcode::ConvertS64F32:
+    case IR::Opcode::ConvertS64F64:
+    case IR::Opcode::ConvertU16F16:
+    case IR::Opcode::ConvertU16F32:
+    case IR::Opcode::ConvertU16F64:
+    case IR::Opcode::ConvertU32F16:
+    case IR::Opcode::ConvertU32F32:
+    case IR::Opcode::ConvertU32F64:
+    case IR::Opcode::ConvertU64F16:
+    case IR::Opcode::ConvertU64F32:
+    case IR::Opcode::ConvertU64F64:
+    case IR::Opcode::ConvertU64U32:
+    case IR::Opcode::ConvertU32U64:
+    case IR::Opcode::ConvertF16F32:
+    case IR::Opcode::ConvertF32F16:
+    case IR::Opcode::ConvertF32F64:
+    case IR::Opcode::ConvertF64F32:
+    case IR::Opcode::ConvertF16S8:
+    case IR::Opcode::ConvertF16S16:
+    case IR::Opcode::ConvertF16S32:
+    case IR::Opcode::ConvertF16S64:
+    case IR::Opcode::ConvertF16U8:
+    case IR::Opcode::ConvertF16U16:
+    case IR::Opcode::ConvertF16U32:
+    case IR::Opcode::ConvertF16U64:
+    case IR::Opcode::ConvertF32S8:
+    case IR::Opcode::ConvertF32S16:
+    case IR::Opcode::ConvertF32S32:
+    case IR::Opcode::ConvertF32S64:
+    case IR::Opcode::ConvertF32U8:
+    case IR::Opcode::ConvertF32U16:
+    case IR::Opcode::ConvertF32U32:
+    case IR::Opcode::ConvertF32U64:
+    case IR::Opcode::ConvertF64S8:
+    case IR::Opcode::ConvertF64S16:
+    case IR::Opcode::ConvertF64S32:
+    case IR::Opcode::ConvertF64S64:
+    case IR::Opcode::ConvertF64U8:
+    case IR::Opcode::ConvertF64U16:
+    case IR::Opcode::ConvertF64U32:
+    case IR::Opcode::ConvertF64U64:
+    case IR::Opcode::ConvertU16U32:
+    case IR::Opcode::ConvertU32U16:
+    case IR::Opcode::ConvertU8U32:
+    case IR::Opcode::ConvertU32U8:
+    case IR::Opcode::ConvertS32S8:
+    case IR::Opcode::ConvertS32S16:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/// Identifies the value computed by a pure instruction
+struct ValueKey {
+    IR::Opcode opcode{};
+    u32 flags{};
+    std::array<IR::Value, MAX_ARGS> args{};
+
+    bool operator==(const ValueKey& other) const {
+        return opcode == other.opcode && flags == other.flags && args == other.args;
+    }
+};
+
+struct ValueKeyHash {
+    size_t operator()(const ValueKey& key) const noexcept {
+        u64 hash{static_cast<u64>(key.opcode) << 32 | key.flags};
+        for (const IR::Value& arg : key.args) {
+            // Immediates only contribute their type, equality tells them apart
+            const u64 arg_hash{arg.IsImmediate() ? static_cast<u64>(arg.Type())
+                                                 : reinterpret_cast<u64>(arg.Inst())};
+            hash = (hash ^ arg_hash) * 0x9e3779b97f4a7c15ULL;
+        }
+        return static_cast<size_t>(hash);
+    }
+};
+
+ValueKey MakeKey(const IR::Inst& inst) {
+    ValueKey key{
+        .opcode = inst.GetOpcode(),
+        .flags = inst.Flags<u32>(),
+    };
+    const size_t num_args{inst.NumArgs()};
+    for (size_t i = 0; i < num_args; ++i) {
+        key.args[i] = inst.Arg(i).Resolve();
+    }
+    return key;
+}
+
+/// Computes the immediate dominator of every block with the Cooper, Harvey and Kennedy algorithm
+ankerl::unordered_dense::map<IR::Block*, IR::Block*> ComputeDominators(
+    const IR::Program& program) {
+    ankerl::unordered_dense::map<IR::Block*, size_t> post_order_index;
+    const auto& post_order{program.post_order_blocks};
+    for (size_t index = 0; index < post_order.size(); ++index) {
+        post_order_index.emplace(post_order[index], index);
+    }
+    ankerl::unordered_dense::map<IR::Block*, IR::Block*> idom;
+    IR::Block* const entry{post_order.back()};
+    idom.emplace(entry, entry);
+
+    const auto intersect{[&](IR::Block* lhs, IR::Block* rhs) {
+        while (lhs != rhs) {
+            while (post_order_index.at(lhs) < post_order_index.at(rhs)) {
+                lhs = idom.at(lhs);
+            }
+            while (post_order_index.at(rhs) < post_order_index.at(lhs)) {
+                rhs = idom.at(rhs);
+            }
+        }
+        return lhs;
+    }};
+    bool changed{true};
+    while (changed) {
+        changed = false;
+        for (auto it = post_order.rbegin() + 1; it != post_order.rend(); ++it) {
+            IR::Block* const block{*it};
+            IR::Block* new_idom{};
+            for (IR::Block* const pred : block->ImmPredecessors()) {
+                if (!idom.contains(pred)) {
+                    continue;
+                }
+                new_idom = new_idom ? intersect(pred, new_idom) : pred;
+            }
+            if (!new_idom) {
+                continue;
+            }
+            const auto [idom_it, is_new]{idom.try_emplace(block, new_idom)};
+            if (!is_new && idom_it->second != new_idom) {
+                idom_it->second = new_idom;
+                changed = true;
+            } else if (is_new) {
+                changed = true;
+            }
+        }
+    }
+    idom.erase(entry);
+    return idom;
+}
+
+void HoistLoopInvariants(IR::Program& program,
+                         const ankerl::unordered_dense::map<IR::Block*, IR::Block*>& idom) {
+    ankerl::unordered_dense::map<const IR::Inst*, IR::Block*> def_block;
+    for (IR::Block* const block : program.blocks) {
+        for (const IR::Inst& inst : block->Instructions()) {
+            def_block.emplace(&inst, block);
+        }
+    }
+    const auto& syntax_list{program.syntax_list};
+    // Walk the loops from the innermost outwards, so invariants can climb several levels
+    for (size_t loop_index = syntax_list.size(); loop_index-- > 0;) {
+        const IR::AbstractSyntaxNode& loop{syntax_list[loop_index]};
+        if (loop.type != IR::AbstractSyntaxNode::Type::Loop) {
+            continue;
+        }
+        const auto preheader_it{idom.find(loop.data.loop.body)};
+        if (preheader_it == idom.end()) {
+            continue;
+        }
+        IR::Block* const preheader{preheader_it->second};
+        std::vector<IR::Block*> loop_blocks;
+        size_t depth{0};
+        for (size_t index = loop_index + 1; index < syntax_list.size(); ++index) {
+            const IR::AbstractSyntaxNode& node{syntax_list[index]};
+            if (node.type == IR::AbstractSyntaxNode::Type::Loop) {
+                ++depth;
+            } else if (node.type == IR::AbstractSyntaxNode::Type::Repeat) {
+                if (depth == 0) {
+                    break;
+                }
+                --depth;
+            } else if (node.type == IR::AbstractSyntaxNode::Type::Block) {
+                loop_blocks.push_back(node.data.block);
+            }
+        }
+        const ankerl::unordered_dense::set<IR::Block*> loop_set(loop_blocks.begin(),
+                                                                 loop_blocks.end());
+        const auto is_invariant{[&](const IR::Inst& inst) {
+            const size_t num_args{inst.NumArgs()};
+            for (size_t i = 0; i < num_args; ++i) {
+                const IR::Value arg{inst.Arg(i).Resolve()};
+                if (arg.IsImmediate()) {
+                    continue;
+                }
+                const auto it{def_block.find(arg.Inst())};
+                if (it == def_block.end() || loop_set.contains(it->second)) {
+                    return false;
+                }
+            }
+            return true;
+        }};
+        for (IR::Block* const block : loop_blocks) {
+            auto& instructions{block->Instructions()};
+            for (auto it = instructions.begin(); it != instructions.end();) {
+                IR::Inst& inst{*it};
+                if (!IsPure(inst) || !is_invariant(inst)) {
+                    ++it;
+                    continue;
+                }
+                it = instructions.erase(it);
+                preheader->Instructions().push_back(inst);
+                def_block.insert_or_assign(&inst, preheader);
+            }
+        }
+    }
+}
+
+void NumberValues(const IR::Program& program,
+                  const ankerl::unordered_dense::map<IR::Block*, IR::Block*>& idom) {
+    ankerl::unordered_dense::map<IR::Block*, std::vector<IR::Block*>> children;
+    // Reverse post order keeps the children of every block in the order they execute
+    for (auto it = program.post_order_blocks.rbegin(); it != program.post_order_blocks.rend();
+         ++it) {
+        if (const auto idom_it{idom.find(*it)}; idom_it != idom.end()) {
+            children[idom_it->second].push_back(*it);
+        }
+    }
+    ankerl::unordered_dense::map<ValueKey, IR::Inst*, ValueKeyHash> available;
+    std::vector<ValueKey> scope_keys;
+    // Each entry is a block to visit, or a scope to close when block is null
+    std::vector<std::pair<IR::Block*, size_t>> stack{{program.post_order_blocks.back(), 0}};
+    while (!stack.empty()) {
+        const auto [block, scope_begin]{stack.back()};
+        stack.pop_back();
+        if (!block) {
+            for (size_t index = scope_begin; index < scope_keys.size(); ++index) {
+                available.erase(scope_keys[index]);
+            }
+            scope_keys.resize(scope_begin);
+            continue;
+        }
+        stack.emplace_back(nullptr, scope_keys.size());
+        for (IR::Inst& inst : block->Instructions()) {
+            if (!IsPure(inst)) {
+                continue;
+            }
+            ValueKey key{MakeKey(inst)};
+            const auto [it, is_new]{available.try_emplace(key, &inst)};
+            if (is_new) {
+                scope_keys.push_back(std::move(key));
+            } else {
+                inst.ReplaceUsesWith(IR::Value{it->second});
+            }
+        }
+        if (const auto children_it{children.find(block)}; children_it != children.end()) {
+            const auto& block_children{children_it->second};
+            for (auto it = block_children.rbegin(); it != block_children.rend(); ++it) {
+                stack.emplace_back(*it, 0);
+            }
+        }
+    }
+}
+} // Anonymous namespace
+
+void GlobalValueNumberingPass(IR::Program& program) {
+    if (program.post_order_blocks.empty()) {
+        return;
+    }
+    const auto idom{ComputeDominators(program)};
+    HoistLoopInvariants(program, idom);
+    NumberValues(program, idom);
+}
+
+} // namespace Shader::Optimization
@@ -18,6 +18,7 @@
 
 #include <deque>
 #include <map>
+#include <optional>
 #include <span>
 #include <ankerl/unordered_dense.h>
 #include <variant>
@@ -29,6 +30,7 @@
 #include "shader_recompiler/frontend/ir/reg.h"
 #include "shader_recompiler/frontend/ir/value.h"
 #include "shader_recompiler/ir_opt/passes.h"
+#include "shader_recompiler/scratch_arena.h"
 
 namespace Shader::Optimization {
 namespace {
@@ -53,9 +55,22 @@ struct IndirectBranchVariable {
     auto operator<=>(const IndirectBranchVariable&) const noexcept = default;
 };
 
-using Variant = std::variant<IR::Reg, IR::Pred, ZeroFlagTag, SignFlagTag, CarryFlagTag, OverflowFlagTag, GotoVariable, IndirectBranchVariable>;
+/// Word of local memory only accessed through constant offsets
+struct LocalWordVariable {
+    LocalWordVariable() = default;
+    explicit LocalWordVariable(u32 index_) : index{index_} {}
+
+    auto operator<=>(const LocalWordVariable&) const noexcept = default;
+
+    u32 index;
+};
+
+using Variant = std::variant<IR::Reg, IR::Pred, ZeroFlagTag, SignFlagTag, CarryFlagTag, OverflowFlagTag, GotoVariable, IndirectBranchVariable, LocalWordVariable>;
 // TODO: majority of these require stable iterators, test with XC beforehand
-using ValueMap = std::unordered_map<IR::Block*, IR::Value>;
+template <typename Key, typename Value>
+using ScratchMap = std::unordered_map<Key, Value, std::hash<Key>, std::equal_to<Key>,
+                                      ScratchAllocator<std::pair<const Key, Value>>>;
+using ValueMap = ScratchMap<IR::Block*, IR::Value>;
 
 struct DefTable {
     const IR::Value& Def(IR::Block* block, IR::Reg variable) {
@@ -86,6 +101,13 @@ struct DefTable {
         indirect_branch_var.insert_or_assign(block, value);
     }
 
+    const IR::Value& Def(IR::Block* block, LocalWordVariable variable) {
+        return local_words[variable.index][block];
+    }
+    void SetDef(IR::Block* block, LocalWordVariable variable, const IR::Value& value) {
+        local_words[variable.index].insert_or_assign(block, value);
+    }
+
     const IR::Value& Def(IR::Block* block, ZeroFlagTag) {
         return zero_flag[block];
     }
@@ -116,8 +138,9 @@ struct DefTable {
 
     std::array<ValueMap, IR::NUM_USER_PREDS> preds;
     // TODO: Requires stable iterators
-    std::unordered_map<u32, ValueMap> goto_vars;
+    ScratchMap<u32, ValueMap> goto_vars;
     ValueMap indirect_branch_var;
+    ScratchMap<u32, ValueMap> local_words;
     ValueMap zero_flag;
     ValueMap sign_flag;
     ValueMap carry_flag;
@@ -140,6 +163,10 @@ IR::Opcode UndefOpcode(IndirectBranchVariable) noexcept {
     return IR::Opcode::UndefU32;
 }
 
+IR::Opcode UndefOpcode(LocalWordVariable) noexcept {
+    return IR::Opcode::UndefU32;
+}
+
 enum class Status {
     Start,
     SetValue,
@@ -301,7 +328,9 @@ private:
     }
 
     // TODO: Windows dies with stack exhaustion?
-    std::unordered_map<IR::Block*, std::map<Variant, IR::Inst*>> incomplete_phis;
+    using PhiMap = std::map<Variant, IR::Inst*, std::less<Variant>,
+                            ScratchAllocator<std::pair<const Variant, IR::Inst*>>>;
+    ScratchMap<IR::Block*, PhiMap> incomplete_phis;
     DefTable current_def;
 };
 
@@ -375,8 +404,31 @@ void VisitBlock(Pass& pass, IR::Block* block) {
     pass.SealBlock(block);
 }
 
+/// Returns the word index of a local memory access when it is known at compile time
+std::optional<u32> LocalWordIndex(const IR::Value& word_offset) {
+    const IR::Value offset{word_offset.Resolve()};
+    if (offset.IsImmediate()) {
+        return offset.U32();
+    }
+    // Translation emits the offsets of the extra words of wide accesses as additions
+    const IR::Inst* const inst{offset.InstRecursive()};
+    if (inst->GetOpcode() == IR::Opcode::IAdd32) {
+        const IR::Value lhs{inst->Arg(0).Resolve()};
+        const IR::Value rhs{inst->Arg(1).Resolve()};
+        if (lhs.IsImmediate() && rhs.IsImmediate()) {
+            return lhs.U32() + rhs.U32();
+        }
+    }
+    return std::nullopt;
+}
+
+bool IsLocalMemoryAccess(const IR::Inst& inst) {
+    const IR::Opcode opcode{inst.GetOpcode()};
+    return opcode == IR::Opcode::LoadLocal || opcode == IR::Opcode::WriteLocal;
+}
+
 IR::Type GetConcreteType(IR::Inst* inst) {
-    std::deque<IR::Inst*> queue;
+    std::deque<IR::Inst*, ScratchAllocator<IR::Inst*>> queue;
     queue.push_back(inst);
     while (!queue.empty()) {
         IR::Inst* current = queue.front();
@@ -397,6 +449,7 @@ IR::Type GetConcreteType(IR::Inst* inst) {
 } // Anonymous namespace
 
 void SsaRewritePass(IR::Program& program) {
+    ScratchScope scratch_scope;
     Pass pass;
     const auto end{program.post_order_blocks.rend()};
     for (auto block = program.post_order_blocks.rbegin(); block != end; ++block) {
@@ -414,4 +467,46 @@ void SsaRewritePass(IR::Program& program) {
     }
 }
 
+void PromoteLocalMemoryPass(IR::Program& program) {
+    if (program.local_memory_size == 0) {
+        return;
+    }
+    // A single dynamic access may alias any word, keep the whole array in memory then
+    for (IR::Block* const block : program.blocks) {
+        for (const IR::Inst& inst : block->Instructions()) {
+            if (IsLocalMemoryAccess(inst) && !LocalWordIndex(inst.Arg(0))) {
+                return;
+            }
+        }
+    }
+    ScratchScope scratch_scope;
+    Pass pass;
+    const auto end{program.post_order_blocks.rend()};
+    for (auto it = program.post_order_blocks.rbegin(); it != end; ++it) {
+        IR::Block* const block{*it};
+        for (IR::Inst& inst : block->Instructions()) {
+            if (!IsLocalMemoryAccess(inst)) {
+                continue;
+            }
+            const LocalWordVariable variable{*LocalWordIndex(inst.Arg(0))};
+            if (inst.GetOpcode() == IR::Opcode::LoadLocal) {
+                inst.ReplaceUsesWith(pass.ReadVariable(variable, block));
+            } else {
+                pass.WriteVariable(variable, block, inst.Arg(1));
+                inst.Invalidate();
+            }
+        }
+        pass.SealBlock(block);
+    }
+    for (auto it = program.post_order_blocks.rbegin(); it != end; ++it) {
+        for (IR::Inst& inst : (*it)->Instructions()) {
+            if (inst.GetOpcode() == IR::Opcode::Phi) {
+                inst.OrderPhiArgs();
+            }
+        }
+    }
+    // Every access lives in SSA values now, backends no longer declare the array
+    program.local_memory_size = 0;
+}
+
 } // namespace Shader::Optimization
@@ -74,6 +74,13 @@ enum class TessSpacing {
     FractionalEven,
 };
 
+/// Specialization constant IDs of the state read when RuntimeInfo::specialize_fixed_state is set
+enum class SpecializationConstant : u32 {
+    AlphaTestFunc,
+    AlphaTestReference,
+    FixedPointSize,
+};
+
 struct TransformFeedbackVarying {
     u32 buffer{};
     u32 stream{};
@@ -99,6 +106,9 @@ struct RuntimeInfo {
     std::optional<float> fixed_state_point_size;
     std::optional<CompareFunction> alpha_test_func;
     float alpha_test_reference{};
+    /// Read the alpha test function and reference, and the fixed point size from
+    /// specialization constants so a single module serves every value of them
+    bool specialize_fixed_state{};
 
     /// Static Y negate value
     bool y_negate{};
@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace Shader {
+
+/// Thread local bump allocator backing the short lived containers of the recompiler passes.
+/// Allocations are never freed individually, they are reclaimed in bulk when the outermost
+/// ScratchScope of the thread ends and the memory is reused by the next compilation.
+class ScratchArena {
+public:
+    [[nodiscard]] static void* Allocate(size_t size, size_t alignment) {
+        return Instance().AllocateImpl(size, alignment);
+    }
+
+private:
+    friend class ScratchScope;
+
+    static constexpr size_t BLOCK_SIZE = 256 * 1024;
+
+    struct Block {
+        std::unique_ptr<std::byte[]> memory;
+        size_t size{};
+    };
+
+    [[nodiscard]] static ScratchArena& Instance() {
+        thread_local ScratchArena arena;
+        return arena;
+    }
+
+    [[nodiscard]] void* AllocateImpl(size_t size, size_t alignment) {
+        if (!blocks.empty()) {
+            const size_t aligned_offset{(offset + alignment - 1) & ~(alignment - 1)};
+            if (aligned_offset + size <= blocks.back().size) {
+                offset = aligned_offset + size;
+                return blocks.back().memory.get() + aligned_offset;
+            }
+        }
+        const size_t block_size{(std::max)(BLOCK_SIZE, size + alignment)};
+        Block& block{blocks.emplace_back(Block{
+            .memory = std::make_unique<std::byte[]>(block_size),
+            .size = block_size,
+        })};
+        // operator new[] alignment is enough for any type the passes store
+        offset = size;
+        return block.memory.get();
+    }
+
+    void Reset() {
+        if (blocks.size() > 1) {
+            // Squash the blocks so the next compilation fits in a single allocation
+            size_t total_size{};
+            for (const Block& block : blocks) {
+                total_size += block.size;
+            }
+            blocks.clear();
+            blocks.emplace_back(Block{
+                .memory = std::make_unique<std::byte[]>(total_size),
+                .size = total_size,
+            });
+        }
+        offset = 0;
+    }
+
+    std::vector<Block> blocks;
+    size_t offset{};
+    u32 scope_depth{};
+};
+
+/// Reclaims the scratch memory of the calling thread when the outermost scope ends.
+/// Containers using ScratchAllocator must be destroyed before their scope.
+class ScratchScope {
+public:
+    ScratchScope() noexcept {
+        ++ScratchArena::Instance().scope_depth;
+    }
+
+    ~ScratchScope() {
+        ScratchArena& arena{ScratchArena::Instance()};
+        if (--arena.scope_depth == 0) {
+            arena.Reset();
+        }
+    }
+
+    ScratchScope(const ScratchScope&) = delete;
+    ScratchScope& operator=(const ScratchScope&) = delete;
+};
+
+template <typename T>
+class ScratchAllocator {
+public:
+    using value_type = T;
+
+    ScratchAllocator() noexcept = default;
+
+    template <typename U>
+    ScratchAllocator(const ScratchAllocator<U>&) noexcept {}
+
+    [[nodiscard]] T* allocate(size_t n) {
+        return static_cast<T*>(ScratchArena::Allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, size_t) noexcept {}
+
+    template <typename U>
+    bool operator==(const ScratchAllocator<U>&) const noexcept {
+        return true;
+    }
+};
+
+} // namespace Shader
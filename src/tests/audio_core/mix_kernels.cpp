@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <random>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "audio_core/renderer/command/mix/mix_kernels.h"
+#include "common/common_types.h"
+#include "common/fixed_point.h"
+
+namespace {
+using namespace AudioCore::Renderer;
+
+std::vector<s32> RandomSamples(std::mt19937& rng, size_t count) {
+    std::uniform_int_distribution<s32> dist(-0x800000, 0x7FFFFF);
+    std::vector<s32> samples(count);
+    for (auto& sample : samples) {
+        sample = dist(rng);
+    }
+    return samples;
+}
+
+/// The scalar loop the mix commands used before the kernels
+template <size_t Q>
+void ReferenceMix(std::vector<s32>& output, const std::vector<s32>& input, f32 volume_, f32 ramp_,
+                  bool accumulate) {
+    Common::FixedPoint<64 - Q, Q> volume{volume_};
+    const Common::FixedPoint<64 - Q, Q> ramp{ramp_};
+    for (size_t i = 0; i < input.size(); i++) {
+        if (accumulate) {
+            output[i] = (output[i] + input[i] * volume).to_int();
+        } else {
+            output[i] = (input[i] * volume).to_int();
+        }
+        volume += ramp;
+    }
+}
+
+template <size_t Q>
+void CheckKernels(std::mt19937& rng, f32 volume_, f32 ramp_, u32 count) {
+    const auto input = RandomSamples(rng, count);
+    const auto initial = RandomSamples(rng, count);
+    const s64 volume = Common::FixedPoint<64 - Q, Q>{volume_}.to_raw();
+    const s64 ramp = Common::FixedPoint<64 - Q, Q>{ramp_}.to_raw();
+
+    auto expected = initial;
+    auto output = initial;
+    ReferenceMix<Q>(expected, input, volume_, ramp_, true);
+    MixSamples(output, input, volume, ramp, Q, count);
+    REQUIRE(output == expected);
+
+    ReferenceMix<Q>(expected, input, volume_, ramp_, false);
+    ScaleSamples(output, input, volume, ramp, Q, count);
+    REQUIRE(output == expected);
+}
+
+} // Anonymous namespace
+
+TEST_CASE("MixKernels[MatchFixedPoint]", "[audio_core]") {
+    std::mt19937 rng{1234};
+    for (const u32 count : {0U, 1U, 3U, 7U, 8U, 15U, 160U, 240U}) {
+        for (const f32 volume : {0.0f, 0.25f, 0.7071f, 1.0f, -1.5f, 4.0f}) {
+            for (const f32 ramp : {0.0f, 0.001f, -0.0042f}) {
+                CheckKernels<15>(rng, volume, ramp, count);
+                CheckKernels<23>(rng, volume, ramp, count);
+            }
+        }
+    }
+}
+
+TEST_CASE("MixKernels[InPlace]", "[audio_core]") {
+    std::mt19937 rng{5678};
+    auto buffer = RandomSamples(rng, 240);
+    auto expected = buffer;
+    ReferenceMix<15>(expected, std::vector<s32>(expected), 0.5f, 0.002f, true);
+
+    const s64 volume = Common::FixedPoint<49, 15>{0.5f}.to_raw();
+    const s64 ramp = Common::FixedPoint<49, 15>{0.002f}.to_raw();
+    MixSamples(buffer, buffer, volume, ramp, 15, 240);
+    REQUIRE(buffer == expected);
+}
+
+TEST_CASE("MixKernels[Benchmark]", "[audio_core][.benchmark]") {
+    std::mt19937 rng{42};
+    const auto input = RandomSamples(rng, 240);
+    auto output = RandomSamples(rng, 240);
+    const s64 volume = Common::FixedPoint<49, 15>{0.7071f}.to_raw();
+    const s64 ramp = Common::FixedPoint<49, 15>{0.0001f}.to_raw();
+
+    BENCHMARK("FixedPoint ramp") {
+        ReferenceMix<15>(output, input, 0.7071f, 0.0001f, true);
+        return output[0];
+    };
+    BENCHMARK("MixSamples ramp") {
+        MixSamples(output, input, volume, ramp, 15, 240);
+        return output[0];
+    };
+}
@@ -0,0 +1,136 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <memory>
+#include <span>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "audio_core/adsp/apps/audio_renderer/command_list_processor.h"
+#include "audio_core/renderer/command/effect/i3dl2_reverb.h"
+#include "audio_core/renderer/command/effect/reverb.h"
+#include "common/common_types.h"
+
+namespace {
+using namespace AudioCore;
+using namespace AudioCore::Renderer;
+
+constexpr u32 SampleCount = 240;
+constexpr u32 FrameCount = 64;
+
+/// Hash of every output sample, so the outputs can be compared with the reference implementation
+class OutputHash {
+public:
+    void Add(std::span<const s32> samples) {
+        for (const s32 sample : samples) {
+            hash = (hash ^ static_cast<u32>(sample)) * 0x100000001B3ULL;
+        }
+    }
+
+    u64 hash{0xCBF29CE484222325ULL};
+};
+
+/**
+ * Run the effect command over a few frames, with bursts of noise followed by silence so the tails
+ * are exercised, and the parameters being updated halfway through.
+ */
+template <typename Command, typename State>
+u64 RenderEffect(Command& command, u32 channel_count) {
+    // A fixed LCG rather than the std distributions, which differ between standard libraries
+    u32 seed{channel_count};
+    const auto next_sample = [&seed] {
+        seed = seed * 1664525 + 1013904223;
+        return static_cast<s32>(seed) >> 8;
+    };
+
+    std::vector<s32> mix_buffers(channel_count * 2 * SampleCount);
+    ADSP::AudioRenderer::CommandListProcessor processor{};
+    processor.sample_count = SampleCount;
+    processor.mix_buffers = mix_buffers;
+
+    auto state{std::make_unique<State>()};
+    command.state = reinterpret_cast<CpuAddr>(state.get());
+    command.effect_enabled = true;
+    command.parameter.channel_count = static_cast<u16>(channel_count);
+    command.parameter.channel_count_max = static_cast<u16>(channel_count);
+    for (u32 channel = 0; channel < channel_count; channel++) {
+        command.inputs[channel] = static_cast<s16>(channel);
+        command.outputs[channel] = static_cast<s16>(channel_count + channel);
+    }
+
+    OutputHash hash;
+    for (u32 frame = 0; frame < FrameCount; frame++) {
+        const bool burst{frame % 16 < 2};
+        for (u32 i = 0; i < channel_count * SampleCount; i++) {
+            mix_buffers[i] = burst ? next_sample() : 0;
+        }
+        if (frame == 0) {
+            command.parameter.state = EffectInfoBase::ParameterState::Initialized;
+        } else if (frame == FrameCount / 2) {
+            command.parameter.state = EffectInfoBase::ParameterState::Updating;
+        } else {
+            command.parameter.state = EffectInfoBase::ParameterState::Updated;
+        }
+        command.Process(processor);
+        hash.Add(std::span<const s32>(mix_buffers).subspan(channel_count * SampleCount));
+    }
+    return hash.hash;
+}
+
+u64 RenderReverb(u32 channel_count) {
+    ReverbCommand command{};
+    command.long_size_pre_delay_supported = true;
+    auto& params{command.parameter};
+    params.sample_rate = 48 << 14;
+    params.early_mode = 1;
+    params.early_gain = 0x2CCC;
+    params.pre_delay = 20 << 14;
+    params.late_mode = 1;
+    params.late_gain = 0x2CCC;
+    params.decay_time = 2 << 14;
+    params.high_freq_decay_ratio = 0x2000;
+    params.colouration = 0x1000;
+    params.base_gain = 0x3000;
+    params.wet_gain = 0x2000;
+    params.dry_gain = 0x2000;
+    return RenderEffect<ReverbCommand, ReverbInfo::State>(command, channel_count);
+}
+
+u64 RenderI3dl2Reverb(u32 channel_count) {
+    I3dl2ReverbCommand command{};
+    auto& params{command.parameter};
+    params.sample_rate = 48000;
+    params.room_HF_gain = -454.0f;
+    params.reference_HF = 5000.0f;
+    params.late_reverb_decay_time = 1.49f;
+    params.late_reverb_HF_decay_ratio = 0.83f;
+    params.room_gain = -1000.0f;
+    params.reflection_gain = -1646.0f;
+    params.reverb_gain = 53.0f;
+    params.late_reverb_diffusion = 100.0f;
+    params.reflection_delay = 0.007f;
+    params.late_reverb_delay_time = 0.011f;
+    params.late_reverb_density = 100.0f;
+    params.dry_gain = 0.5f;
+    return RenderEffect<I3dl2ReverbCommand, I3dl2ReverbInfo::State>(command, channel_count);
+}
+
+} // Anonymous namespace
+
+// The expected hashes were produced by the scalar implementation the effects started from, any
+// change to them means the output is no longer bit exact.
+
+TEST_CASE("Reverb[MatchReference]", "[audio_core]") {
+    REQUIRE(RenderReverb(1) == 0x838FF885FB8574C2ULL);
+    REQUIRE(RenderReverb(2) == 0x1A3BDE8989682CDFULL);
+    REQUIRE(RenderReverb(4) == 0x304460AD990A4370ULL);
+    REQUIRE(RenderReverb(6) == 0xC4394E5AE902036DULL);
+}
+
+TEST_CASE("I3dl2Reverb[MatchReference]", "[audio_core]") {
+    REQUIRE(RenderI3dl2Reverb(1) == 0x5B4C64FAA582D425ULL);
+    REQUIRE(RenderI3dl2Reverb(2) == 0x99CC79250F96929AULL);
+    REQUIRE(RenderI3dl2Reverb(4) == 0x9EC08D75600321F7ULL);
+    REQUIRE(RenderI3dl2Reverb(6) == 0xBD0B0B08844AF63DULL);
+}
@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <array>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include "common/bounded_threadsafe_queue.h"
+
+namespace Common {
+
+TEST_CASE("MPSCQueue: Tickets follow pop order", "[common]") {
+    MPSCQueue<int, 4> queue;
+    REQUIRE(queue.Empty());
+    REQUIRE(queue.EmplaceWait(10) == 0);
+    REQUIRE(queue.EmplaceWait(11) == 1);
+    REQUIRE(queue.TryEmplace(12));
+    REQUIRE(queue.TryEmplace(13));
+    // The queue is full
+    REQUIRE(!queue.TryEmplace(14));
+
+    int value{};
+    for (int expected = 10; expected < 14; ++expected) {
+        REQUIRE(queue.TryPop(value));
+        REQUIRE(value == expected);
+    }
+    REQUIRE(!queue.TryPop(value));
+    REQUIRE(queue.EmplaceWait(15) == 4);
+    REQUIRE(queue.PopWait() == 15);
+}
+
+TEST_CASE("MPSCQueue: Multiple producers", "[common]") {
+    constexpr int NumProducers = 4;
+    constexpr int NumValues = 10000;
+    MPSCQueue<std::pair<int, int>, 16> queue;
+
+    std::vector<std::jthread> producers;
+    for (int producer = 0; producer < NumProducers; ++producer) {
+        producers.emplace_back([&queue, producer] {
+            for (int i = 0; i < NumValues; ++i) {
+                queue.EmplaceWait(producer, i);
+            }
+        });
+    }
+    // Values from the same producer must keep their order
+    std::array<int, NumProducers> last{-1, -1, -1, -1};
+    for (int i = 0; i < NumProducers * NumValues; ++i) {
+        const auto [producer, value] = queue.PopWait();
+        REQUIRE(value == last[producer] + 1);
+        last[producer] = value;
+    }
+    producers.clear();
+    REQUIRE(queue.Empty());
+}
+
+} // namespace Common
@@ -0,0 +1,138 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <atomic>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/concurrent_lru_cache.h"
+
+namespace {
+using Cache = Common::ConcurrentLruCache<u64, u64>;
+} // Anonymous namespace
+
+TEST_CASE("ConcurrentLruCache: Find and replace", "[common]") {
+    Cache cache{1024, 1};
+    REQUIRE(cache.Find(1) == nullptr);
+    REQUIRE(cache.Insert(1, std::make_shared<u64>(10), 100));
+    REQUIRE(*cache.Find(1) == 10);
+    REQUIRE(cache.Insert(1, std::make_shared<u64>(20), 200));
+    REQUIRE(*cache.Find(1) == 20);
+    REQUIRE(cache.Size() == 1);
+    REQUIRE(cache.Cost() == 200);
+    cache.Erase(1);
+    REQUIRE(cache.Find(1) == nullptr);
+    REQUIRE(cache.Cost() == 0);
+    REQUIRE_FALSE(cache.Insert(2, nullptr, 1));
+}
+
+TEST_CASE("ConcurrentLruCache: Budget", "[common]") {
+    std::vector<u64> evicted;
+    Cache cache{1000, 1, [&](const u64& key, const Cache::ValuePtr& value) {
+                    REQUIRE(*value == key);
+                    evicted.push_back(key);
+                }};
+    REQUIRE_FALSE(cache.Insert(0, std::make_shared<u64>(0), 1001));
+    for (u64 key = 0; key < 10; ++key) {
+        REQUIRE(cache.Insert(key, std::make_shared<u64>(key), 100));
+    }
+    REQUIRE(evicted.empty());
+    REQUIRE(cache.Cost() == 1000);
+
+    // Keep the first half hot, the cold half has to go first
+    for (u64 key = 0; key < 5; ++key) {
+        REQUIRE(cache.Find(key) != nullptr);
+    }
+    REQUIRE(cache.Insert(10, std::make_shared<u64>(10), 100));
+    REQUIRE(cache.Insert(11, std::make_shared<u64>(11), 100));
+    REQUIRE(cache.Cost() == 1000);
+    REQUIRE(evicted.size() == 2);
+    for (const u64 key : evicted) {
+        REQUIRE(key >= 5);
+        REQUIRE(cache.Find(key) == nullptr);
+    }
+    for (u64 key = 0; key < 5; ++key) {
+        REQUIRE(cache.Find(key) != nullptr);
+    }
+
+    // A value that fills the whole budget evicts everything else
+    REQUIRE(cache.Insert(12, std::make_shared<u64>(12), 1000));
+    REQUIRE(cache.Size() == 1);
+    cache.Clear();
+    REQUIRE(cache.Size() == 0);
+    REQUIRE(cache.Cost() == 0);
+}
+
+TEST_CASE("ConcurrentLruCache: Threads", "[common]") {
+    std::atomic<size_t> evicted_cost{};
+    Cache cache{64 * 16, 16,
+                [&](const u64&, const Cache::ValuePtr& value) { evicted_cost += *value; }};
+    std::atomic<size_t> inserted_cost{};
+    std::atomic<size_t> wrong_values{};
+    std::vector<std::thread> threads;
+    for (u32 thread = 0; thread < 4; ++thread) {
+        threads.emplace_back([&, thread] {
+            std::mt19937 rng{thread};
+            for (u32 i = 0; i < 20000; ++i) {
+                const u64 key = rng() % 512;
+                if (const auto value = cache.Find(key)) {
+                    wrong_values += *value != key % 8 + 1 ? 1 : 0;
+                } else {
+                    cache.Insert(key, std::make_shared<u64>(key % 8 + 1), key % 8 + 1);
+                    inserted_cost += key % 8 + 1;
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    REQUIRE(wrong_values == 0);
+    REQUIRE(cache.Cost() <= 64 * 16);
+    REQUIRE(evicted_cost <= inserted_cost);
+}
+
+TEST_CASE("ConcurrentLruCache: Benchmark", "[common][.benchmark]") {
+    // Big enough that no shard evicts, every lookup hits
+    Cache cache{1 << 20, 16};
+    for (u64 key = 0; key < 4096; ++key) {
+        cache.Insert(key, std::make_shared<u64>(key), 1);
+    }
+
+    BENCHMARK("Hit") {
+        u64 sum = 0;
+        for (u64 key = 0; key < 4096; ++key) {
+            sum += *cache.Find(key);
+        }
+        return sum;
+    };
+
+    BENCHMARK("Hits from 4 threads") {
+        std::vector<std::thread> threads;
+        for (u32 thread = 0; thread < 4; ++thread) {
+            threads.emplace_back([&] {
+                for (u64 key = 0; key < 4096; ++key) {
+                    (void)cache.Find(key);
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    };
+
+    Cache full_cache{4096, 16};
+    u64 next_key = 0;
+    BENCHMARK("Insert with eviction") {
+        for (u32 i = 0; i < 4096; ++i) {
+            full_cache.Insert(next_key++, std::make_shared<u64>(i), 1);
+        }
+        return full_cache.Size();
+    };
+}
@@ -14,6 +14,7 @@
 #include <ankerl/unordered_dense.h>
 #include <vector>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include "common/common_types.h"
@@ -274,4 +275,29 @@ TEST_CASE("Fibers::StartRace", "[common]") {
     REQUIRE(test_control.value3 == 1);
 }
 
+TEST_CASE("Fibers::Benchmark", "[common][.benchmark]") {
+    auto thread_fiber = Fiber::ThreadToFiber();
+
+    // Guest programs that spawn short lived threads create and destroy a fiber for each of them
+    BENCHMARK("Create, run and destroy a fiber") {
+        std::shared_ptr<Fiber> fiber;
+        fiber = std::make_shared<Fiber>([&] { Fiber::YieldTo(fiber, *thread_fiber); });
+        Fiber::YieldTo(thread_fiber, *fiber);
+        fiber.reset();
+    };
+
+    // The cost of the scheduler switching between a guest thread and the host thread
+    std::shared_ptr<Fiber> ping_fiber;
+    ping_fiber = std::make_shared<Fiber>([&] {
+        while (true) {
+            Fiber::YieldTo(ping_fiber, *thread_fiber);
+        }
+    });
+    BENCHMARK("Switch to a fiber and back") {
+        Fiber::YieldTo(thread_fiber, *ping_fiber);
+    };
+
+    thread_fiber->Exit();
+}
+
 } // namespace Common
@@ -0,0 +1,54 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/hash.h"
+
+using namespace Common::Hash;
+
+namespace {
+std::vector<u8> MakeData(size_t size) {
+    std::vector<u8> data(size);
+    for (size_t i = 0; i < size; ++i) {
+        data[i] = static_cast<u8>(i * 31 + (i >> 8));
+    }
+    return data;
+}
+
+u64 StreamInChunks(std::span<const u8> data, size_t chunk_size) {
+    StreamHasher hasher;
+    while (!data.empty()) {
+        const size_t size = (std::min)(chunk_size, data.size());
+        hasher.Update(data.first(size));
+        data = data.subspan(size);
+    }
+    return hasher.Finalize();
+}
+} // Anonymous namespace
+
+TEST_CASE("StreamHasher: Matches StableHash64 for small inputs", "[common]") {
+    for (const size_t size : {0, 1, 100, 4095, 4096}) {
+        const std::vector<u8> data = MakeData(size);
+        REQUIRE(StreamInChunks(data, 7) == StableHash64(data));
+    }
+}
+
+TEST_CASE("StreamHasher: Independent of how the input is split", "[common]") {
+    for (const size_t size : {4097, 8192, 8193, 100000}) {
+        const std::vector<u8> data = MakeData(size);
+        const u64 expected = StreamInChunks(data, data.size());
+        for (const size_t chunk_size : {1, 13, 4095, 4096, 4097, 10000}) {
+            REQUIRE(StreamInChunks(data, chunk_size) == expected);
+        }
+    }
+}
+
+TEST_CASE("StreamHasher: Different inputs give different hashes", "[common]") {
+    std::vector<u8> data = MakeData(10000);
+    const u64 original = StreamInChunks(data, 1000);
+    data[9000] ^= 1;
+    REQUIRE(StreamInChunks(data, 1000) != original);
+}
@@ -0,0 +1,253 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <boost/icl/interval_map.hpp>
+#include <boost/icl/interval_set.hpp>
+#include <boost/icl/split_interval_map.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/range_sets.inc"
+
+namespace {
+
+/// The icl containers the range sets were implemented with before
+using IclSet = boost::icl::interval_set<u64>;
+using IclOverlapMap = boost::icl::split_interval_map<u64, s32, boost::icl::partial_enricher>;
+using IclInterval = IclSet::interval_type;
+
+using Ranges = std::vector<std::pair<u64, u64>>;
+using CountedRanges = std::vector<std::tuple<u64, u64, s32>>;
+
+Ranges Collect(const Common::RangeSet<u64>& set) {
+    Ranges ranges;
+    set.ForEach([&](u64 start, u64 end) { ranges.emplace_back(start, end); });
+    return ranges;
+}
+
+Ranges CollectInRange(const Common::RangeSet<u64>& set, u64 base, u64 size) {
+    Ranges ranges;
+    set.ForEachInRange(base, size, [&](u64 start, u64 end) { ranges.emplace_back(start, end); });
+    return ranges;
+}
+
+Ranges Collect(const IclSet& set) {
+    Ranges ranges;
+    for (const auto& interval : set) {
+        ranges.emplace_back(interval.lower(), interval.upper());
+    }
+    return ranges;
+}
+
+Ranges CollectInRange(const IclSet& set, u64 base, u64 size) {
+    Ranges ranges;
+    const IclInterval search{base, base + size};
+    for (auto it = set.lower_bound(search); it != set.end() && it->lower() < base + size; ++it) {
+        ranges.emplace_back((std::max)(it->lower(), base), (std::min)(it->upper(), base + size));
+    }
+    return ranges;
+}
+
+CountedRanges Collect(const Common::OverlapRangeSet<u64>& set) {
+    CountedRanges ranges;
+    set.ForEach([&](u64 start, u64 end, s32 count) { ranges.emplace_back(start, end, count); });
+    return ranges;
+}
+
+CountedRanges Collect(const IclOverlapMap& map) {
+    CountedRanges ranges;
+    for (const auto& [interval, count] : map) {
+        ranges.emplace_back(interval.lower(), interval.upper(), count);
+    }
+    return ranges;
+}
+
+/// Subtracts from the map the way the range sets did with icl
+template <typename Func>
+void IclSubtract(IclOverlapMap& map, u64 base, u64 size, s32 amount, Func&& on_delete) {
+    if (map.empty()) {
+        return;
+    }
+    const IclInterval interval{base, base + size};
+    map += std::make_pair(interval, -amount);
+    auto it = map.lower_bound(interval);
+    while (it != map.end() && it->first.lower() < base + size) {
+        if (it->second <= 0) {
+            if (it->second == 0) {
+                on_delete(it->first.lower(), it->first.upper());
+            }
+            map.erase(it++);
+        } else {
+            ++it;
+        }
+    }
+}
+
+struct RandomRange {
+    explicit RandomRange(u32 seed) : rng{seed} {}
+
+    std::pair<u64, u64> operator()() {
+        const u64 base = std::uniform_int_distribution<u64>{0, 4096}(rng) * 16;
+        const u64 size = std::uniform_int_distribution<u64>{1, 64}(rng) * 16;
+        return {base, size};
+    }
+
+    std::mt19937 rng;
+};
+
+} // Anonymous namespace
+
+TEST_CASE("RangeSet: Matches icl", "[common]") {
+    Common::RangeSet<u64> set;
+    IclSet reference;
+    RandomRange random{1234};
+    for (int i = 0; i < 20000; ++i) {
+        const auto [base, size] = random();
+        if (random.rng() % 3 != 0) {
+            set.Add(base, size);
+            reference.add(IclInterval{base, base + size});
+        } else {
+            set.Subtract(base, size);
+            reference.subtract(IclInterval{base, base + size});
+        }
+        if (i % 64 == 0) {
+            REQUIRE(Collect(set) == Collect(reference));
+            const auto [search_base, search_size] = random();
+            REQUIRE(CollectInRange(set, search_base, search_size) ==
+                    CollectInRange(reference, search_base, search_size));
+        }
+    }
+    REQUIRE(Collect(set) == Collect(reference));
+    REQUIRE(set.Empty() == reference.empty());
+}
+
+TEST_CASE("RangeSet: Bulk add and subtract", "[common]") {
+    RandomRange random{5678};
+    for (int round = 0; round < 200; ++round) {
+        Common::RangeSet<u64> lhs;
+        Common::RangeSet<u64> rhs;
+        IclSet lhs_reference;
+        IclSet rhs_reference;
+        for (int i = 0; i < 64; ++i) {
+            const auto [lhs_base, lhs_size] = random();
+            lhs.Add(lhs_base, lhs_size);
+            lhs_reference.add(IclInterval{lhs_base, lhs_base + lhs_size});
+            const auto [rhs_base, rhs_size] = random();
+            rhs.Add(rhs_base, rhs_size);
+            rhs_reference.add(IclInterval{rhs_base, rhs_base + rhs_size});
+        }
+        if (round % 2 == 0) {
+            lhs.Add(rhs);
+            lhs_reference += rhs_reference;
+        } else {
+            lhs.Subtract(rhs);
+            lhs_reference -= rhs_reference;
+        }
+        REQUIRE(Collect(lhs) == Collect(lhs_reference));
+    }
+}
+
+TEST_CASE("RangeSet: Move", "[common]") {
+    Common::RangeSet<u64> set;
+    set.Add(0x1000, 0x1000);
+    Common::RangeSet<u64> moved{std::move(set)};
+    REQUIRE(set.Empty());
+    REQUIRE(Collect(moved) == Ranges{{0x1000, 0x2000}});
+    set.Add(0x3000, 0x100);
+    moved = std::move(set);
+    REQUIRE(set.Empty());
+    REQUIRE(Collect(moved) == Ranges{{0x3000, 0x3100}});
+}
+
+TEST_CASE("OverlapRangeSet: Matches icl", "[common]") {
+    Common::OverlapRangeSet<u64> set;
+    IclOverlapMap reference;
+    RandomRange random{4321};
+    for (int i = 0; i < 20000; ++i) {
+        const auto [base, size] = random();
+        const u32 operation = random.rng() % 8;
+        if (operation < 4) {
+            set.Add(base, size);
+            reference += std::make_pair(IclInterval{base, base + size}, 1);
+        } else if (operation < 7) {
+            Ranges deleted;
+            Ranges reference_deleted;
+            set.Subtract(base, size, [&](u64 start, u64 end) { deleted.emplace_back(start, end); });
+            IclSubtract(reference, base, size, 1,
+                        [&](u64 start, u64 end) { reference_deleted.emplace_back(start, end); });
+            REQUIRE(deleted == reference_deleted);
+        } else {
+            set.DeleteAll(base, size);
+            IclSubtract(reference, base, size, (std::numeric_limits<s32>::max)(), [](u64, u64) {});
+        }
+        if (i % 64 == 0) {
+            REQUIRE(Collect(set) == Collect(reference));
+        }
+    }
+    REQUIRE(Collect(set) == Collect(reference));
+}
+
+TEST_CASE("RangeSet: Benchmark", "[common][.benchmark]") {
+    RandomRange random{42};
+    std::vector<std::pair<u64, u64>> operations(4096);
+    for (auto& operation : operations) {
+        operation = random();
+    }
+
+    BENCHMARK("RangeSet add and subtract") {
+        Common::RangeSet<u64> set;
+        for (size_t i = 0; i < operations.size(); ++i) {
+            const auto [base, size] = operations[i];
+            if (i % 3 != 0) {
+                set.Add(base, size);
+            } else {
+                set.Subtract(base, size);
+            }
+        }
+        return set.Empty();
+    };
+    BENCHMARK("icl interval_set add and subtract") {
+        IclSet set;
+        for (size_t i = 0; i < operations.size(); ++i) {
+            const auto [base, size] = operations[i];
+            if (i % 3 != 0) {
+                set.add(IclInterval{base, base + size});
+            } else {
+                set.subtract(IclInterval{base, base + size});
+            }
+        }
+        return set.empty();
+    };
+
+    BENCHMARK("OverlapRangeSet add and subtract") {
+        Common::OverlapRangeSet<u64> set;
+        for (size_t i = 0; i < operations.size(); ++i) {
+            const auto [base, size] = operations[i];
+            if (i % 2 == 0) {
+                set.Add(base, size);
+            } else {
+                set.Subtract(base, size, [](u64, u64) {});
+            }
+        }
+        return set.Empty();
+    };
+    BENCHMARK("icl split_interval_map add and subtract") {
+        IclOverlapMap map;
+        for (size_t i = 0; i < operations.size(); ++i) {
+            const auto [base, size] = operations[i];
+            if (i % 2 == 0) {
+                map += std::make_pair(IclInterval{base, base + size}, 1);
+            } else {
+                IclSubtract(map, base, size, 1, [](u64, u64) {});
+            }
+        }
+        return map.empty();
+    };
+}
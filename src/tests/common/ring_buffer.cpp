@@ -75,6 +75,35 @@ TEST_CASE("RingBuffer: Basic Tests", "[common]") {
     REQUIRE(buf.Size() == 0U);
 }
 
+TEST_CASE("RingBuffer: Clear", "[common]") {
+    RingBuffer<char, 4> buf;
+
+    const std::array<char, 3> values{1, 2, 3};
+    REQUIRE(buf.Push(values.data(), values.size()) == 3U);
+    buf.Clear();
+    REQUIRE(buf.Size() == 0U);
+
+    // The cleared slots are only freed once the consumer pops past them.
+    const std::array<char, 2> more{4, 5};
+    REQUIRE(buf.Push(more.data(), more.size()) == 1U);
+    REQUIRE(buf.Size() == 1U);
+    {
+        const std::vector<char> popped = buf.Pop();
+        REQUIRE(popped.size() == 1U);
+        REQUIRE(popped[0] == 4);
+    }
+
+    REQUIRE(buf.Push(more.data(), more.size()) == 2U);
+    {
+        const std::vector<char> popped = buf.Pop();
+        REQUIRE(popped.size() == 2U);
+        REQUIRE(popped[0] == 4);
+        REQUIRE(popped[1] == 5);
+    }
+
+    REQUIRE(buf.Size() == 0U);
+}
+
 TEST_CASE("RingBuffer: Threaded Test", "[common]") {
     RingBuffer<char, 8> buf;
     const char seed = 42;
@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/slot_vector.h"
+
+namespace {
+
+struct Object {
+    explicit Object(u64 address_) noexcept : address{address_} {}
+
+    u64 address;
+    u64 cold_data[16]{};
+};
+
+struct ObjectHot {
+    ObjectHot() = default;
+    explicit ObjectHot(const Object& object) : address{object.address} {}
+
+    u64 address = 0;
+    bool picked = false;
+};
+
+} // Anonymous namespace
+
+TEST_CASE("PackedSlotVector: Hot fields follow their objects", "[common]") {
+    Common::PackedSlotVector<Object, ObjectHot> slots;
+    std::vector<Common::SlotId> ids;
+    for (u64 i = 0; i < 100; ++i) {
+        ids.push_back(slots.insert(i * 0x1000));
+    }
+    REQUIRE(slots.size() == 100);
+    for (u64 i = 0; i < 100; ++i) {
+        REQUIRE(slots.GetHot(ids[i]).address == i * 0x1000);
+        REQUIRE(slots[ids[i]].address == i * 0x1000);
+    }
+    slots.GetHot(ids[5]).picked = true;
+    REQUIRE(slots.GetHot(ids[5]).picked);
+    REQUIRE_FALSE(slots.GetHot(ids[6]).picked);
+
+    // A reused slot starts from the hot fields of its new object
+    slots.erase(ids[5]);
+    const Common::SlotId reused = slots.insert(u64{0xdead000});
+    REQUIRE(reused == ids[5]);
+    REQUIRE(slots.GetHot(reused).address == 0xdead000);
+    REQUIRE_FALSE(slots.GetHot(reused).picked);
+}
+
+TEST_CASE("PackedSlotVector: Stale handles", "[common]") {
+    Common::PackedSlotVector<Object, ObjectHot> slots;
+    const Common::SlotId id = slots.insert(u64{1});
+    const Common::SlotHandle handle = slots.MakeHandle(id);
+    REQUIRE(slots.IsCurrent(handle));
+    REQUIRE(slots[handle].address == 1);
+
+    slots.erase(id);
+    REQUIRE_FALSE(slots.IsCurrent(handle));
+    const Common::SlotId reused = slots.insert(u64{2});
+    REQUIRE(reused == id);
+    REQUIRE_FALSE(slots.IsCurrent(handle));
+    REQUIRE(slots.IsCurrent(slots.MakeHandle(reused)));
+    REQUIRE_FALSE(slots.IsCurrent(Common::SlotHandle{}));
+}
@@ -139,3 +139,42 @@ TEST_CASE("CoreTiming[BasicOrderNoPausing]", "[core]") {
     printf("HostTimer No Pausing Timer Time: %.3f %.6f\n", timer_time / 1000.f,
            timer_time / 1000000.f);
 }
+
+TEST_CASE("CoreTiming[UnscheduleManyEvents]", "[core]") {
+    ScopeInit guard;
+    auto& core_timing = guard.core_timing;
+    core_timing.SyncPause(true);
+
+    constexpr std::size_t num_events = 1024;
+    std::vector<std::shared_ptr<Core::Timing::EventType>> events;
+    events.reserve(num_events);
+    for (std::size_t i = 0; i < num_events; i++) {
+        events.push_back(Core::Timing::CreateEvent("callback", HostCallbackTemplate<0>));
+    }
+
+    const u64 start = core_timing.GetGlobalTimeNs().count();
+    for (std::size_t i = 0; i < num_events; i++) {
+        const auto future_ns = std::chrono::milliseconds{static_cast<s64>(1000 + i)};
+        if (i % 2 == 0) {
+            core_timing.ScheduleEvent(future_ns, events[i]);
+        } else {
+            core_timing.ScheduleLoopingEvent(future_ns, std::chrono::milliseconds{16}, events[i]);
+        }
+    }
+    const u64 scheduled = core_timing.GetGlobalTimeNs().count();
+
+    // Unschedule in the reverse order of scheduling
+    for (std::size_t i = num_events; i-- > 0;) {
+        REQUIRE(events[i]->pending_count == 1);
+        core_timing.UnscheduleEvent(events[i], Core::Timing::UnscheduleEventType::NoWait);
+        REQUIRE(events[i]->pending_count == 0);
+    }
+    const u64 end = core_timing.GetGlobalTimeNs().count();
+
+    REQUIRE(core_timing.event_queue.empty());
+
+    printf("HostTimer Scheduling %zu Events: %.3f us\n", num_events,
+           static_cast<double>(scheduled - start) / 1000.0);
+    printf("HostTimer Unscheduling %zu Events: %.3f us\n", num_events,
+           static_cast<double>(end - scheduled) / 1000.0);
+}
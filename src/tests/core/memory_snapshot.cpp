@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include "core/memory/snapshot.h"
+
+using Core::Memory::DeserializeMemorySnapshot;
+using Core::Memory::SerializeMemorySnapshot;
+using Core::Memory::SnapshotChunkSize;
+
+TEST_CASE("MemorySnapshot[RoundTrip]", "[core]") {
+    std::vector<u8> memory(SnapshotChunkSize * 8 + 0x100);
+    for (std::size_t i = 0; i < SnapshotChunkSize; ++i) {
+        memory[SnapshotChunkSize * 2 + i] = static_cast<u8>(i * 7);
+    }
+    memory.back() = 0xAB;
+
+    const std::vector<u8> snapshot = SerializeMemorySnapshot(memory);
+    REQUIRE(snapshot.size() < memory.size());
+
+    std::vector<u8> restored(memory.size(), 0xCC);
+    REQUIRE(DeserializeMemorySnapshot(snapshot, restored));
+    REQUIRE(restored == memory);
+}
+
+TEST_CASE("MemorySnapshot[SparseEmpty]", "[core]") {
+    const std::vector<u8> memory(SnapshotChunkSize * 16);
+    const std::vector<u8> snapshot = SerializeMemorySnapshot(memory);
+    REQUIRE(snapshot.size() == 0x20);
+
+    std::vector<u8> restored(memory.size(), 0xFF);
+    REQUIRE(DeserializeMemorySnapshot(snapshot, restored));
+    REQUIRE(std::all_of(restored.begin(), restored.end(), [](u8 value) { return value == 0; }));
+}
+
+TEST_CASE("MemorySnapshot[Rejection]", "[core]") {
+    std::vector<u8> memory(SnapshotChunkSize * 2);
+    memory[0] = 1;
+    std::vector<u8> snapshot = SerializeMemorySnapshot(memory);
+
+    std::vector<u8> smaller(SnapshotChunkSize);
+    REQUIRE_FALSE(DeserializeMemorySnapshot(snapshot, smaller));
+
+    snapshot.resize(snapshot.size() - 1);
+    REQUIRE_FALSE(DeserializeMemorySnapshot(snapshot, memory));
+
+    snapshot[0] ^= 0xFF;
+    REQUIRE_FALSE(DeserializeMemorySnapshot(snapshot, memory));
+}
@@ -114,6 +114,32 @@ TEST_CASE("MemoryTracker: Large region", "[video_core]") {
     REQUIRE(memory_track->ModifiedCpuRegion(c, WORD * 32) == Range{0, 0});
 }
 
+TEST_CASE("MemoryTracker: Sparse modifications", "[video_core]") {
+    RasterizerInterface rasterizer;
+    std::optional<MemoryTracker> memory_track(rasterizer);
+    memory_track->UnmarkRegionAsCpuModified(c, WORD * 16);
+    REQUIRE(!memory_track->IsRegionCpuModified(c, WORD * 16));
+
+    memory_track->MarkRegionAsCpuModified(c + WORD * 9 + PAGE * 3, PAGE);
+    REQUIRE(memory_track->IsRegionCpuModified(c, WORD * 16));
+    REQUIRE(!memory_track->IsRegionCpuModified(c, WORD * 9 + PAGE * 3));
+    REQUIRE(memory_track->ModifiedCpuRegion(c + PAGE, WORD * 15) ==
+            Range{c + WORD * 9 + PAGE * 3, c + WORD * 9 + PAGE * 4});
+
+    memory_track->MarkRegionAsCpuModified(c + WORD * 14, PAGE);
+    REQUIRE(memory_track->ModifiedCpuRegion(c, WORD * 16) ==
+            Range{c + WORD * 9 + PAGE * 3, c + WORD * 14 + PAGE});
+
+    memory_track->MarkRegionAsGpuModified(c + WORD * 2 + PAGE * 63, PAGE * 2);
+    memory_track->MarkRegionAsGpuModified(c + WORD * 11, PAGE);
+    std::vector<Range> ranges;
+    memory_track->ForEachDownloadRange(c, WORD * 16, false, [&](u64 offset, u64 size) {
+        ranges.emplace_back(offset, size);
+    });
+    REQUIRE(ranges ==
+            std::vector<Range>{{c + WORD * 2 + PAGE * 63, PAGE * 2}, {c + WORD * 11, PAGE}});
+}
+
 TEST_CASE("MemoryTracker: Rasterizer counting", "[video_core]") {
     RasterizerInterface rasterizer;
     std::optional<MemoryTracker> memory_track(rasterizer);
@@ -129,6 +129,15 @@ public:
         write_tick = write_tick_;
     }
 
+    /// Returns a value that changes every time the contents of the buffer are written
+    [[nodiscard]] u64 ContentsVersion() const noexcept {
+        return contents_version;
+    }
+
+    void SetContentsVersion(u64 contents_version_) noexcept {
+        contents_version = contents_version_;
+    }
+
 private:
     VAddr cpu_addr = 0;
     BufferFlagBits flags{};
@@ -136,6 +145,7 @@ private:
     size_t lru_id = SIZE_MAX;
     size_t size_bytes = 0;
     u64 write_tick = 0;
+    u64 contents_version = 0;
 };
 
 } // namespace VideoCommon
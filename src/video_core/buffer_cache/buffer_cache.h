@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <memory>
 #include <numeric>
+#include <tuple>
 
 #include "common/range_sets.inc"
 #include "video_core/buffer_cache/buffer_cache_base.h"
@@ -240,6 +241,7 @@ bool BufferCache<P>::DMACopy(GPUVAddr src_address, GPUVAddr dest_address, u64 am
     src_buffer.MarkUsage(copy.src_offset, copy.size);
     dest_buffer.MarkUsage(copy.dst_offset, copy.size);
     runtime.CopyBuffer(dest_buffer, src_buffer, copies, true);
+    MarkContentsModified(dest_buffer);
     if (has_new_downloads) {
         memory_tracker.MarkRegionAsGpuModified(*cpu_dest_address, amount);
     }
@@ -250,6 +252,87 @@ bool BufferCache<P>::DMACopy(GPUVAddr src_address, GPUVAddr dest_address, u64 am
     return true;
 }
 
+template <class P>
+bool BufferCache<P>::DMACopyLines(GPUVAddr src_address, u64 src_pitch, GPUVAddr dest_address,
+                                  u64 dest_pitch, u64 line_length, u32 line_count) {
+    if (line_count == 0 || line_length == 0) {
+        return false;
+    }
+    const u64 src_size = src_pitch * (line_count - 1) + line_length;
+    const u64 dest_size = dest_pitch * (line_count - 1) + line_length;
+    const std::optional<DAddr> cpu_src_address = gpu_memory->GpuToCpuAddress(src_address);
+    const std::optional<DAddr> cpu_dest_address = gpu_memory->GpuToCpuAddress(dest_address);
+    if (!cpu_src_address || !cpu_dest_address) {
+        return false;
+    }
+    // The result of overlapping lines depends on the order they are copied in
+    if (*cpu_src_address < *cpu_dest_address + dest_size &&
+        *cpu_dest_address < *cpu_src_address + src_size) {
+        return false;
+    }
+    const bool source_dirty = IsRegionRegistered(*cpu_src_address, src_size);
+    const bool dest_dirty = IsRegionRegistered(*cpu_dest_address, dest_size);
+    if (!source_dirty && !dest_dirty) {
+        return false;
+    }
+
+    ClearDownload(*cpu_dest_address, dest_size);
+
+    BufferId buffer_a;
+    BufferId buffer_b;
+    do {
+        channel_state->has_deleted_buffers = false;
+        buffer_a = FindBuffer(*cpu_src_address, static_cast<u32>(src_size));
+        buffer_b = FindBuffer(*cpu_dest_address, static_cast<u32>(dest_size));
+    } while (channel_state->has_deleted_buffers);
+    auto& src_buffer = slot_buffers[buffer_a];
+    auto& dest_buffer = slot_buffers[buffer_b];
+    SynchronizeBuffer(src_buffer, *cpu_src_address, static_cast<u32>(src_size));
+    SynchronizeBuffer(dest_buffer, *cpu_dest_address, static_cast<u32>(dest_size));
+
+    line_copies.clear();
+    boost::container::small_vector<std::pair<DAddr, size_t>, 4> tmp_intervals;
+    for (u32 line = 0; line < line_count; ++line) {
+        const DAddr src_line = *cpu_src_address + line * src_pitch;
+        const DAddr dest_line = *cpu_dest_address + line * dest_pitch;
+        line_copies.push_back(BufferCopy{
+            .src_offset = src_buffer.Offset(src_line),
+            .dst_offset = dest_buffer.Offset(dest_line),
+            .size = line_length,
+        });
+        gpu_modified_ranges.ForEachInRange(
+            src_line, line_length, [&](DAddr base_address, DAddr base_address_end) {
+                const u64 size = base_address_end - base_address;
+                const DAddr new_base_address = dest_line + (base_address - src_line);
+                tmp_intervals.push_back({new_base_address, size});
+                uncommitted_gpu_modified_ranges.Add(new_base_address, size);
+            });
+    }
+    // The source and destination don't overlap, so the lines can be subtracted after mirroring
+    for (u32 line = 0; line < line_count; ++line) {
+        gpu_modified_ranges.Subtract(*cpu_dest_address + line * dest_pitch, line_length);
+    }
+    for (const auto& pair : tmp_intervals) {
+        gpu_modified_ranges.Add(pair.first, pair.second);
+    }
+    src_buffer.MarkUsage(line_copies.front().src_offset, src_size);
+    dest_buffer.MarkUsage(line_copies.front().dst_offset, dest_size);
+    runtime.CopyBuffer(dest_buffer, src_buffer, line_copies, true);
+    MarkContentsModified(dest_buffer);
+    // Only the lines are written, the gaps between them keep what the guest has in memory
+    for (const auto& pair : tmp_intervals) {
+        memory_tracker.MarkRegionAsGpuModified(pair.first, pair.second);
+    }
+
+    for (u32 line = 0; line < line_count; ++line) {
+        Tegra::Memory::DeviceGuestMemoryScoped<u8,
+                                               Tegra::Memory::GuestMemoryFlags::UnsafeReadWrite>
+            tmp(device_memory, *cpu_src_address + line * src_pitch, line_length, &tmp_buffer);
+        tmp.SetAddressAndSize(*cpu_dest_address + line * dest_pitch, line_length);
+    }
+    return true;
+}
+
 template <class P>
 bool BufferCache<P>::DMAClear(GPUVAddr dst_address, u64 amount, u32 value) {
     const std::optional<DAddr> cpu_dst_address = gpu_memory->GpuToCpuAddress(dst_address);
@@ -270,6 +353,7 @@ bool BufferCache<P>::DMAClear(GPUVAddr dst_address, u64 amount, u32 value) {
     const u32 offset = dest_buffer.Offset(*cpu_dst_address);
     runtime.ClearBuffer(dest_buffer, offset, size, value);
     dest_buffer.MarkUsage(offset, size);
+    MarkContentsModified(dest_buffer);
     return true;
 }
 
@@ -309,6 +393,7 @@ std::pair<typename P::Buffer*, u32> BufferCache<P>::ObtainCPUBuffer(
         const size_t new_size = device_addr_end - device_addr_start;
         ClearDownload(device_addr_start, new_size);
         gpu_modified_ranges.Subtract(device_addr_start, new_size);
+        MarkContentsModified(buffer);
         break;
     }
     default:
@@ -588,9 +673,7 @@ void BufferCache<P>::CommitAsyncFlushesHigh() {
         auto& current_intervals = *it;
         auto next_it = std::next(it);
         while (next_it != committed_gpu_modified_ranges.end()) {
-            next_it->ForEach([&current_intervals](DAddr start, DAddr end) {
-                current_intervals.Subtract(start, end - start);
-            });
+            current_intervals.Subtract(*next_it);
             next_it++;
         }
         it++;
@@ -744,6 +827,7 @@ void BufferCache<P>::BindHostIndexBuffer() {
     if (draw_state.inline_index_draw_indexes.empty()) {
         SynchronizeBuffer(buffer, channel_state->index_buffer.device_addr, size);
     } else {
+        FlushBatchedUploads();
         if constexpr (USE_MEMORY_MAPS_FOR_UPLOADS) {
             auto upload_staging = runtime.UploadStagingBuffer(size);
             std::array<BufferCopy, 1> copies{{BufferCopy{.src_offset = upload_staging.offset, .dst_offset = 0, .size = size}}};
@@ -752,11 +836,14 @@ void BufferCache<P>::BindHostIndexBuffer() {
         } else {
             buffer.ImmediateUpload(0, draw_state.inline_index_draw_indexes);
         }
+        MarkContentsModified(buffer);
     }
     if constexpr (HAS_FULL_INDEX_AND_PRIMITIVE_SUPPORT) {
         const u32 new_offset = offset + draw_state.index_buffer.first * u32(draw_state.index_buffer.FormatSizeInBytes());
         runtime.BindIndexBuffer(buffer, new_offset, size);
     } else {
+        // The index buffer may be converted on the GPU here, it has to be up to date
+        FlushBatchedUploads();
         buffer.MarkUsage(offset, size);
         runtime.BindIndexBuffer(draw_state.topology, draw_state.index_buffer.format, draw_state.index_buffer.first, draw_state.index_buffer.count, buffer, offset, size);
     }
@@ -964,6 +1051,11 @@ void BufferCache<P>::BindHostGraphicsUniformBuffer(size_t stage, u32 index, u32
         channel_state->fast_bound_uniform_buffers[stage] |= 1u << binding_index;
         channel_state->uniform_buffer_binding_sizes[stage][binding_index] = size;
         // Stream buffer path to avoid stalling on non-Nvidia drivers or Vulkan
+        if constexpr (REUSE_UNCHANGED_UNIFORM_UPLOADS) {
+            const auto span = ImmediateBufferWithData(device_addr, size);
+            runtime.BindUniformBufferData(stage, binding_index, span);
+            return;
+        }
         const std::span<u8> span = runtime.BindMappedUniformBuffer(stage, binding_index, size);
         device_memory.ReadBlockUnsafe(device_addr, span.data(), size);
         return;
@@ -1434,6 +1526,7 @@ void BufferCache<P>::MarkWrittenBuffer(BufferId buffer_id, DAddr device_addr, u3
         Buffer& buffer = slot_buffers[buffer_id];
         buffer.setWriteTick(runtime.CurrentTick());
     }
+    MarkContentsModified(slot_buffers[buffer_id]);
     memory_tracker.MarkRegionAsGpuModified(device_addr, size);
     gpu_modified_ranges.Add(device_addr, size);
     uncommitted_gpu_modified_ranges.Add(device_addr, size);
@@ -1459,10 +1552,9 @@ BufferId BufferCache<P>::FindBuffer(DAddr device_addr, u32 size) {
 template <class P>
 void BufferCache<P>::WaitForGpuFenceIfNeeded(Buffer& buffer) {
     if constexpr (!IS_OPENGL) {
-        const bool gpu_fence_accurate = Settings::IsGPUFenceBehaviorAccurate();
-        const bool gpu_fence_strict = Settings::IsGPUFenceBehaviorStrict();
-        if (gpu_fence_accurate || gpu_fence_strict) {
-            const u64 gpu_tick_delay = gpu_fence_strict ? 0 : 3;
+        const Settings::SettingsSnapshot& settings = Settings::GetSnapshot();
+        if (settings.wait_for_buffer_fences) {
+            const u64 gpu_tick_delay = settings.buffer_fence_tick_delay;
             const u64 buffer_tick = buffer.getWriteTick();
             const u64 gpu_tick = runtime.KnownGpuTick();
             if (buffer_tick > gpu_tick + gpu_tick_delay) {
@@ -1576,6 +1668,8 @@ void BufferCache<P>::JoinOverlap(BufferId new_buffer_id, BufferId overlap_id,
 
 template <class P>
 BufferId BufferCache<P>::CreateBuffer(DAddr device_addr, u32 wanted_size) {
+    // Pending uploads hold buffer references, which the slot insertion may invalidate
+    FlushBatchedUploads();
     DAddr device_addr_end = Common::AlignUp(device_addr + wanted_size, CACHING_PAGESIZE);
     device_addr = Common::AlignDown(device_addr, CACHING_PAGESIZE);
     wanted_size = static_cast<u32>(device_addr_end - device_addr);
@@ -1583,6 +1677,7 @@ BufferId BufferCache<P>::CreateBuffer(DAddr device_addr, u32 wanted_size) {
     const u32 size = static_cast<u32>(overlap.end - overlap.begin);
     const BufferId new_buffer_id = slot_buffers.insert(runtime, overlap.begin, size);
     auto& new_buffer = slot_buffers[new_buffer_id];
+    MarkContentsModified(new_buffer);
     const size_t size_bytes = new_buffer.SizeBytes();
     runtime.ClearBuffer(new_buffer, 0, size_bytes, 0);
     new_buffer.MarkUsage(0, size_bytes);
@@ -1611,9 +1706,11 @@ void BufferCache<P>::ChangeRegister(BufferId buffer_id) {
     const auto size = buffer.SizeBytes();
     if (insert) {
         total_used_memory += Common::AlignUp(size, 1024);
+        memory_account.Add(Common::AlignUp(size, 1024));
         buffer.setLRUID(lru_cache.Insert(buffer_id, frame_tick));
     } else {
         total_used_memory -= Common::AlignUp(size, 1024);
+        memory_account.Subtract(Common::AlignUp(size, 1024));
         lru_cache.Free(buffer.getLRUID());
     }
     const DAddr device_addr_begin = buffer.CpuAddr();
@@ -1644,16 +1741,38 @@ bool BufferCache<P>::SynchronizeBuffer(Buffer& buffer, DAddr device_addr, u32 si
     const DAddr buffer_start = buffer.cpu_addr_cached;
     memory_tracker.ForEachUploadRange(device_addr, size, [&](u64 device_addr_out, u64 range_size) {
         upload_copies.push_back(BufferCopy{
-            .src_offset = total_size_bytes,
+            .src_offset = 0,
             .dst_offset = device_addr_out - buffer_start,
             .size = range_size,
         });
-        total_size_bytes += range_size;
-        largest_copy = (std::max)(largest_copy, range_size);
     });
-    if (total_size_bytes == 0) {
+    if (upload_copies.empty()) {
         return true;
     }
+    // Streamed data is usually dirty in many small neighbouring ranges, fold the ones separated by
+    // small gaps into a single region. Gaps are neither CPU nor GPU modified, so uploading them
+    // again writes back what the buffer already holds.
+    size_t num_copies = 1;
+    for (size_t i = 1; i < upload_copies.size(); ++i) {
+        BufferCopy& last = upload_copies[num_copies - 1];
+        const BufferCopy& next = upload_copies[i];
+        const u64 last_end = last.dst_offset + last.size;
+        if (next.dst_offset >= last_end) {
+            const u64 gap = next.dst_offset - last_end;
+            if (gap == 0 || (gap <= UPLOAD_GAP_MERGE_THRESHOLD &&
+                             !memory_tracker.IsRegionGpuModified(buffer_start + last_end, gap))) {
+                last.size = next.dst_offset + next.size - last.dst_offset;
+                continue;
+            }
+        }
+        upload_copies[num_copies++] = next;
+    }
+    upload_copies.resize(num_copies);
+    for (BufferCopy& copy : upload_copies) {
+        copy.src_offset = total_size_bytes;
+        total_size_bytes += copy.size;
+        largest_copy = (std::max)(largest_copy, copy.size);
+    }
     const std::span<BufferCopy> copies_span(upload_copies.data(), upload_copies.size());
     UploadMemory(buffer, total_size_bytes, largest_copy, copies_span);
     any_buffer_uploaded = true;
@@ -1663,6 +1782,7 @@ bool BufferCache<P>::SynchronizeBuffer(Buffer& buffer, DAddr device_addr, u32 si
 template <class P>
 void BufferCache<P>::UploadMemory(Buffer& buffer, u64 total_size_bytes, u64 largest_copy,
                                   std::span<BufferCopy> copies) {
+    MarkContentsModified(buffer);
     if constexpr (USE_MEMORY_MAPS_FOR_UPLOADS) {
         MappedUploadMemory(buffer, total_size_bytes, copies);
     } else {
@@ -1688,7 +1808,7 @@ void BufferCache<P>::ImmediateUploadMemory([[maybe_unused]] Buffer& buffer,
                 if (immediate_buffer.empty()) {
                     immediate_buffer = ImmediateBuffer(largest_copy);
                 }
-                if (Settings::values.enable_gpu_buffer_readback.GetValue()) {
+                if (Settings::GetSnapshot().enable_gpu_buffer_readback) {
                     DownloadBufferMemory(buffer, device_addr, copy.size);
                 }
                 device_memory.ReadBlockUnsafe(device_addr, immediate_buffer.data(), copy.size);
@@ -1704,12 +1824,30 @@ void BufferCache<P>::MappedUploadMemory([[maybe_unused]] Buffer& buffer,
                                         [[maybe_unused]] u64 total_size_bytes,
                                         [[maybe_unused]] std::span<BufferCopy> copies) {
     if constexpr (USE_MEMORY_MAPS) {
+        if (is_batching_uploads && !Settings::GetSnapshot().enable_gpu_buffer_readback) {
+            // Usage is marked when binding, so whether the copy can be reordered is known now only
+            batched_uploads.push_back(BatchedUpload{
+                .buffer = &buffer,
+                .first_copy = batched_upload_copies.size(),
+                .num_copies = copies.size(),
+                .can_reorder = runtime.CanReorderUpload(buffer, copies),
+            });
+            for (const BufferCopy& copy : copies) {
+                batched_upload_copies.push_back(BufferCopy{
+                    .src_offset = batched_upload_bytes + copy.src_offset,
+                    .dst_offset = copy.dst_offset,
+                    .size = copy.size,
+                });
+            }
+            batched_upload_bytes += total_size_bytes;
+            return;
+        }
         auto upload_staging = runtime.UploadStagingBuffer(total_size_bytes);
         const std::span<u8> staging_pointer = upload_staging.mapped_span;
         for (BufferCopy& copy : copies) {
             u8* const src_pointer = staging_pointer.data() + copy.src_offset;
             const DAddr device_addr = buffer.CpuAddr() + copy.dst_offset;
-            if (Settings::values.enable_gpu_buffer_readback.GetValue()) {
+            if (Settings::GetSnapshot().enable_gpu_buffer_readback) {
                 DownloadBufferMemory(buffer, device_addr, copy.size);
             }
             device_memory.ReadBlockUnsafe(device_addr, src_pointer, copy.size);
@@ -1721,6 +1859,66 @@ void BufferCache<P>::MappedUploadMemory([[maybe_unused]] Buffer& buffer,
     }
 }
 
+template <class P>
+void BufferCache<P>::BeginUploadBatch() {
+    if constexpr (USE_MEMORY_MAPS_FOR_UPLOADS) {
+        is_batching_uploads = true;
+    }
+}
+
+template <class P>
+void BufferCache<P>::EndUploadBatch() {
+    FlushBatchedUploads();
+    is_batching_uploads = false;
+}
+
+template <class P>
+void BufferCache<P>::FlushBatchedUploads() {
+    if constexpr (USE_MEMORY_MAPS) {
+        if (batched_uploads.empty()) {
+            return;
+        }
+        auto upload_staging = runtime.UploadStagingBuffer(batched_upload_bytes);
+        u8* const staging_pointer = upload_staging.mapped_span.data();
+        for (const BatchedUpload& upload : batched_uploads) {
+            const DAddr buffer_addr = upload.buffer->CpuAddr();
+            for (size_t i = 0; i < upload.num_copies; ++i) {
+                BufferCopy& copy = batched_upload_copies[upload.first_copy + i];
+                device_memory.ReadBlockUnsafe(buffer_addr + copy.dst_offset,
+                                              staging_pointer + copy.src_offset, copy.size);
+                copy.src_offset += upload_staging.offset;
+            }
+        }
+        // Bindings often share a buffer, emit a single copy per buffer and ordering class
+        std::ranges::stable_sort(batched_uploads, [](const BatchedUpload& lhs,
+                                                     const BatchedUpload& rhs) {
+            return std::tie(lhs.buffer, lhs.can_reorder) < std::tie(rhs.buffer, rhs.can_reorder);
+        });
+        boost::container::small_vector<BufferCopy, 16> copies;
+        for (size_t begin = 0; begin < batched_uploads.size();) {
+            const BatchedUpload& first = batched_uploads[begin];
+            size_t end = begin;
+            copies.clear();
+            for (; end < batched_uploads.size(); ++end) {
+                const BatchedUpload& upload = batched_uploads[end];
+                if (upload.buffer != first.buffer || upload.can_reorder != first.can_reorder) {
+                    break;
+                }
+                const auto upload_copies_begin =
+                    batched_upload_copies.begin() + static_cast<std::ptrdiff_t>(upload.first_copy);
+                copies.insert(copies.end(), upload_copies_begin,
+                              upload_copies_begin + static_cast<std::ptrdiff_t>(upload.num_copies));
+            }
+            runtime.CopyBuffer(*first.buffer, upload_staging.buffer, FixSmallVectorADL(copies),
+                               true, first.can_reorder);
+            begin = end;
+        }
+        batched_uploads.clear();
+        batched_upload_copies.clear();
+        batched_upload_bytes = 0;
+    }
+}
+
 template <class P>
 bool BufferCache<P>::InlineMemory(DAddr dest_address, size_t copy_size,
                                   std::span<const u8> inlined_buffer) {
@@ -1748,6 +1946,7 @@ void BufferCache<P>::InlineMemoryImplementation(DAddr dest_address, size_t copy_
     BufferId buffer_id = FindBuffer(dest_address, static_cast<u32>(copy_size));
     auto& buffer = slot_buffers[buffer_id];
     SynchronizeBuffer(buffer, dest_address, static_cast<u32>(copy_size));
+    MarkContentsModified(buffer);
 
     if constexpr (USE_MEMORY_MAPS_FOR_UPLOADS) {
         auto upload_staging = runtime.UploadStagingBuffer(copy_size);
@@ -1831,6 +2030,7 @@ void BufferCache<P>::DownloadBufferMemory(Buffer& buffer, DAddr device_addr, u64
 
 template <class P>
 void BufferCache<P>::DeleteBuffer(BufferId buffer_id, bool do_not_mark) {
+    FlushBatchedUploads();
     bool dirty_index{false};
     boost::container::small_vector<u64, NUM_VERTEX_BUFFERS> dirty_vertex_buffers;
     const auto scalar_replace = [buffer_id](Binding& binding) {
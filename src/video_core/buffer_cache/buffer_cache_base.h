@@ -24,6 +24,7 @@
 #include "common/div_ceil.h"
 #include "common/literals.h"
 #include "common/lru_cache.h"
+#include "common/memory_accounting.h"
 #include "common/range_sets.h"
 #include "common/scope_exit.h"
 #include "common/settings.h"
@@ -78,6 +79,8 @@ enum class ObtainBufferOperation : u32 {
 
 static constexpr BufferId NULL_BUFFER_ID{0};
 static constexpr u32 DEFAULT_SKIP_CACHE_SIZE = static_cast<u32>(4_KiB);
+/// Clean gaps up to this size between two dirty ranges are uploaded with them as a single region
+static constexpr u64 UPLOAD_GAP_MERGE_THRESHOLD = 16_KiB;
 
 struct Binding {
     DAddr device_addr{};
@@ -180,6 +183,7 @@ class BufferCache : public VideoCommon::ChannelSetupCaches<BufferCacheChannelInf
     static constexpr bool USE_MEMORY_MAPS = P::USE_MEMORY_MAPS;
     static constexpr bool SEPARATE_IMAGE_BUFFERS_BINDINGS = P::SEPARATE_IMAGE_BUFFER_BINDINGS;
     static constexpr bool USE_MEMORY_MAPS_FOR_UPLOADS = P::USE_MEMORY_MAPS_FOR_UPLOADS;
+    static constexpr bool REUSE_UNCHANGED_UNIFORM_UPLOADS = P::REUSE_UNCHANGED_UNIFORM_UPLOADS;
 
 #ifdef YUZU_LEGACY
     static constexpr s64 TARGET_THRESHOLD = 3_GiB;
@@ -241,6 +245,12 @@ public:
 
     void BindHostComputeBuffers();
 
+    /// Defers mapped uploads until EndUploadBatch, packing them in a single staging allocation
+    void BeginUploadBatch();
+
+    /// Records the uploads deferred since BeginUploadBatch, one copy per destination buffer
+    void EndUploadBatch();
+
     void SetUniformBuffersState(const std::array<u32, NUM_STAGES>& mask,
                                 const UniformBufferSizes* sizes);
 
@@ -293,6 +303,10 @@ public:
 
     bool DMACopy(GPUVAddr src_address, GPUVAddr dest_address, u64 amount);
 
+    /// Copies line_count lines of line_length bytes between two strided regions in one batch
+    bool DMACopyLines(GPUVAddr src_address, u64 src_pitch, GPUVAddr dest_address, u64 dest_pitch,
+                      u64 line_length, u32 line_count);
+
     bool DMAClear(GPUVAddr src_address, u64 amount, u32 value);
 
     /// Return true when a CPU region is modified from the GPU
@@ -414,6 +428,11 @@ private:
 
     void MarkWrittenBuffer(BufferId buffer_id, DAddr device_addr, u32 size);
 
+    /// Gives a buffer a new contents version, so data converted from it is not reused
+    void MarkContentsModified(Buffer& buffer) noexcept {
+        buffer.SetContentsVersion(++contents_version);
+    }
+
     [[nodiscard]] BufferId FindBuffer(DAddr device_addr, u32 size);
 
     void WaitForGpuFenceIfNeeded(Buffer& buffer);
@@ -443,6 +462,8 @@ private:
 
     void MappedUploadMemory(Buffer& buffer, u64 total_size_bytes, std::span<BufferCopy> copies);
 
+    void FlushBatchedUploads();
+
     void DownloadBufferMemory(Buffer& buffer_id);
 
     void DownloadBufferMemory(Buffer& buffer_id, DAddr device_addr, u64 size);
@@ -491,6 +512,18 @@ private:
     std::array<Binding, 32> v_buffer{};
 
     boost::container::small_vector<BufferCopy, 4> upload_copies;
+    std::vector<BufferCopy> line_copies;
+
+    struct BatchedUpload {
+        Buffer* buffer;
+        size_t first_copy;
+        size_t num_copies;
+        bool can_reorder;
+    };
+    bool is_batching_uploads = false;
+    u64 batched_upload_bytes = 0;
+    std::vector<BatchedUpload> batched_uploads;
+    std::vector<BufferCopy> batched_upload_copies;
 
     MemoryTracker memory_tracker;
     Common::RangeSet<DAddr> uncommitted_gpu_modified_ranges;
@@ -514,7 +547,9 @@ private:
     };
     Common::LeastRecentlyUsedCache<LRUItemParams> lru_cache;
     u64 frame_tick = 0;
+    u64 contents_version = 0;
     u64 total_used_memory = 0;
+    Common::MemoryAccounting::Account memory_account{Common::MemoryAccounting::Tag::BufferCache};
     u64 minimum_memory = 0;
     u64 critical_memory = 0;
     BufferId inline_buffer_id;
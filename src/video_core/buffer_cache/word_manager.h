@@ -68,6 +68,15 @@ struct WordManager {
 
     template <typename Func>
     void IterateWords(size_t offset, size_t size, Func&& func) const {
+        IterateWords(offset, size, std::forward<Func>(func),
+                     [](size_t word_index, size_t) { return word_index; });
+    }
+
+    /// @brief Iterate words like above, letting skip jump over whole words of the range
+    /// @param skip Given the current word index and the end of the fully covered words, returns
+    ///             the next word index that has to be visited
+    template <typename Func, typename Skip>
+    void IterateWords(size_t offset, size_t size, Func&& func, Skip&& skip) const {
         using FuncReturn = std::invoke_result_t<Func, std::size_t, u64>;
         const size_t start = size_t(std::max<s64>(s64(offset), 0LL));
         const size_t end = size_t(std::max<s64>(s64(offset + size), 0LL));
@@ -82,6 +91,16 @@ struct WordManager {
             end_page += diff * PAGES_PER_WORD;
             constexpr u64 base_mask{~0ULL};
             for (size_t word_index = start_word; word_index < end_word; word_index++) {
+                if (start_page == 0 && end_page >= PAGES_PER_WORD) {
+                    const size_t full_end =
+                        (std::min)(end_word, word_index + end_page / PAGES_PER_WORD);
+                    const size_t next_index = skip(word_index, full_end);
+                    end_page -= (next_index - word_index) * PAGES_PER_WORD;
+                    word_index = next_index;
+                    if (word_index >= end_word) {
+                        break;
+                    }
+                }
                 const u64 mask = ExtractBits(base_mask, start_page, end_page);
                 start_page = 0;
                 end_page -= PAGES_PER_WORD;
@@ -95,6 +114,50 @@ struct WordManager {
         }
     }
 
+    /// @brief Returns the first word in [index, end) with modified pages of the given type
+    /// Words are tested four at a time so runs of clean words are skipped with few branches and
+    /// the reduction can be vectorised.
+    template <Type type>
+    size_t FindModifiedWord(size_t index, size_t end) const noexcept {
+        const u64* const state_words = Span(type).data();
+        const u64* const untracked_words = Span(Type::Untracked).data();
+        const auto word_at = [&](size_t i) {
+            if constexpr (type == Type::GPU) {
+                return state_words[i] & ~untracked_words[i];
+            } else {
+                return state_words[i];
+            }
+        };
+        for (; index + 4 <= end; index += 4) {
+            if ((word_at(index) | word_at(index + 1) | word_at(index + 2) |
+                 word_at(index + 3)) != 0) {
+                break;
+            }
+        }
+        while (index < end && word_at(index) == 0) {
+            ++index;
+        }
+        return index;
+    }
+
+    /// @brief Returns a skip function for IterateWords that jumps over clean words
+    auto ModifiedWordSkip(Type type) const noexcept {
+        return [this, type](size_t index, size_t end) {
+            switch (type) {
+            case Type::CPU:
+                return FindModifiedWord<Type::CPU>(index, end);
+            case Type::GPU:
+                return FindModifiedWord<Type::GPU>(index, end);
+            case Type::CachedCPU:
+                return FindModifiedWord<Type::CachedCPU>(index, end);
+            case Type::Preflushable:
+                return FindModifiedWord<Type::Preflushable>(index, end);
+            default:
+                return index;
+            }
+        };
+    }
+
     template <typename Func>
     void IteratePages(u64 mask, Func&& func) const {
         size_t offset = 0;
@@ -165,6 +228,10 @@ struct WordManager {
                  (pending_pointer - pending_offset) * BYTES_PER_PAGE);
         };
         std::vector<std::pair<VAddr, u64>> ranges;
+        // Clearing CPU pages also updates the untracked state of clean words, so those can't be
+        // skipped.
+        const bool can_skip = !clear || (type != Type::CPU && type != Type::CachedCPU);
+        const auto skip = ModifiedWordSkip(can_skip ? type : Type::Untracked);
         IterateWords(offset, size, [&](size_t index, u64 mask) {
             if (type == Type::GPU)
                 mask &= ~untracked_words[index];
@@ -193,7 +260,7 @@ struct WordManager {
                     pending_pointer = base_offset + pages_offset + pages_size;
                 }
             });
-        });
+        }, skip);
         if (pending) {
             release();
         }
@@ -215,7 +282,7 @@ struct WordManager {
             if (type == Type::GPU)
                 mask &= ~untracked_words[index];
             return (state_words[index] & mask) != 0 ? (result = true) : false;
-        });
+        }, ModifiedWordSkip(type));
         return result;
     }
 
@@ -238,7 +305,7 @@ struct WordManager {
                 begin = (std::min)(begin, page_index + local_page_begin);
                 end = page_index + local_page_end;
             }
-        });
+        }, ModifiedWordSkip(type));
         return begin < end ? std::make_pair<u64, u64>(begin * BYTES_PER_PAGE, end * BYTES_PER_PAGE)
             : std::make_pair<u64, u64>(0, 0);
     }
@@ -0,0 +1,150 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <fmt/format.h>
+
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/logging.h"
+#include "video_core/command_capture.h"
+#include "video_core/dma_pusher.h"
+#include "video_core/memory_manager.h"
+
+namespace Tegra {
+
+using namespace CommandCaptureFormat;
+
+bool CommandCapture::Begin(u64 program_id, u32 frames) {
+    std::scoped_lock lock{mutex};
+    if (frames == 0 || frames_left > 0) {
+        return false;
+    }
+    const auto dump_dir{Common::FS::GetEdenPath(Common::FS::EdenPath::DumpDir)};
+    if (!Common::FS::CreateDir(dump_dir)) {
+        LOG_ERROR(HW_GPU, "Failed to create dump directory");
+        return false;
+    }
+    const auto now = std::chrono::system_clock::now().time_since_epoch();
+    path = dump_dir / fmt::format("{:016x}_{}.gcap", program_id,
+                                  std::chrono::duration_cast<std::chrono::seconds>(now).count());
+    file.Open(path, Common::FS::FileAccessMode::Write);
+    if (!file.IsOpen() || file.Write(Magic) != Magic.size() || !file.WriteObject(Version)) {
+        LOG_ERROR(HW_GPU, "Failed to create GPU capture {}", Common::FS::PathToUTF8String(path));
+        file.Close();
+        return false;
+    }
+    LOG_INFO(HW_GPU, "Capturing {} frames of GPU commands into {}", frames,
+             Common::FS::PathToUTF8String(path));
+    start_time = std::chrono::steady_clock::now();
+    frames_left = frames;
+    return true;
+}
+
+void CommandCapture::RecordCommandList(s32 channel, const CommandList& list,
+                                       const MemoryManager& memory_manager) {
+    std::scoped_lock lock{mutex};
+    if (frames_left == 0) {
+        return;
+    }
+    bool ok = file.WriteObject(RecordKind::CommandList) && file.WriteObject(channel) &&
+              file.WriteObject(static_cast<u32>(list.command_lists.size()));
+    for (const CommandListHeader& header : list.command_lists) {
+        words.resize(header.size);
+        memory_manager.ReadBlockUnsafe(header.addr, words.data(), words.size() * sizeof(u32));
+        ok = ok && file.WriteObject(header.raw) &&
+             file.WriteObject(static_cast<u32>(words.size())) &&
+             file.Write(words) == words.size();
+    }
+    words.clear();
+    for (const CommandHeader& command : list.prefetch_command_list) {
+        words.push_back(command.argument);
+    }
+    ok = ok && file.WriteObject(static_cast<u32>(words.size())) &&
+         file.Write(words) == words.size();
+    if (!ok) {
+        LOG_ERROR(HW_GPU, "Failed to write to GPU capture, stopping it");
+        End();
+    }
+}
+
+void CommandCapture::RecordFrame() {
+    std::scoped_lock lock{mutex};
+    if (frames_left == 0) {
+        return;
+    }
+    const auto timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start_time);
+    if (!file.WriteObject(RecordKind::Frame) || !file.WriteObject(timestamp.count())) {
+        LOG_ERROR(HW_GPU, "Failed to write to GPU capture, stopping it");
+        End();
+        return;
+    }
+    if (frames_left.fetch_sub(1) == 1) {
+        LOG_INFO(HW_GPU, "Finished GPU capture {}", Common::FS::PathToUTF8String(path));
+        End();
+    }
+}
+
+void CommandCapture::End() {
+    frames_left = 0;
+    file.Close();
+    words = {};
+}
+
+bool CommandCaptureReader::Open(const std::filesystem::path& path) {
+    file.Open(path, Common::FS::FileAccessMode::Read);
+    std::array<char, Magic.size()> magic{};
+    u32 version{};
+    if (!file.IsOpen() || file.Read(magic) != magic.size() || magic != Magic ||
+        !file.ReadObject(version) || version != Version) {
+        file.Close();
+        return false;
+    }
+    return true;
+}
+
+std::optional<Record> CommandCaptureReader::Next() {
+    const auto read_words = [this](std::vector<u32>& out) {
+        u32 count{};
+        if (!file.ReadObject(count)) {
+            return false;
+        }
+        out.resize(count);
+        return file.Read(out) == count;
+    };
+
+    RecordKind kind{};
+    if (!file.IsOpen() || !file.ReadObject(kind)) {
+        return std::nullopt;
+    }
+    switch (kind) {
+    case RecordKind::CommandList: {
+        CommandListRecord record{};
+        u32 count{};
+        if (!file.ReadObject(record.channel) || !file.ReadObject(count)) {
+            return std::nullopt;
+        }
+        record.pushbuffers.resize(count);
+        for (Pushbuffer& pushbuffer : record.pushbuffers) {
+            if (!file.ReadObject(pushbuffer.header) || !read_words(pushbuffer.words)) {
+                return std::nullopt;
+            }
+        }
+        if (!read_words(record.prefetch_words)) {
+            return std::nullopt;
+        }
+        return record;
+    }
+    case RecordKind::Frame: {
+        s64 timestamp{};
+        if (!file.ReadObject(timestamp)) {
+            return std::nullopt;
+        }
+        return FrameRecord{std::chrono::nanoseconds{timestamp}};
+    }
+    }
+    LOG_ERROR(HW_GPU, "Unknown GPU capture record {}", static_cast<u32>(kind));
+    return std::nullopt;
+}
+
+} // namespace Tegra
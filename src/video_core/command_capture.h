@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <variant>
+#include <vector>
+
+#include "common/common_types.h"
+#include "common/fs/file.h"
+
+namespace Tegra {
+
+struct CommandList;
+class MemoryManager;
+
+namespace CommandCaptureFormat {
+
+constexpr std::array<char, 8> Magic{'E', 'D', 'E', 'N', 'G', 'C', 'A', 'P'};
+constexpr u32 Version = 1;
+
+enum class RecordKind : u8 {
+    /// A command list submitted to a channel, with the words of every pushbuffer it points to
+    CommandList = 0,
+    /// A frame was presented
+    Frame = 1,
+};
+
+struct Pushbuffer {
+    /// Raw CommandListHeader of the entry
+    u64 header;
+    /// Words of the pushbuffer, as they were in guest memory when the list was submitted
+    std::vector<u32> words;
+};
+
+struct CommandListRecord {
+    s32 channel;
+    std::vector<Pushbuffer> pushbuffers;
+    std::vector<u32> prefetch_words;
+};
+
+struct FrameRecord {
+    /// Time since the capture started
+    std::chrono::nanoseconds timestamp;
+};
+
+using Record = std::variant<CommandListRecord, FrameRecord>;
+
+} // namespace CommandCaptureFormat
+
+/**
+ * Records the command lists the guest submits to the GPU, along with the contents of the
+ * pushbuffers they point to, so the command stream of a stretch of frames can be studied without
+ * the game. Macro uploads are part of the recorded pushbuffers.
+ */
+class CommandCapture {
+public:
+    /// Starts recording the given number of frames into a new file in the dump directory
+    bool Begin(u64 program_id, u32 frames);
+
+    [[nodiscard]] bool IsActive() const noexcept {
+        return frames_left.load(std::memory_order_relaxed) > 0;
+    }
+
+    /// Records a command list before it is submitted to the channel
+    void RecordCommandList(s32 channel, const CommandList& list, const MemoryManager& memory_manager);
+
+    /// Marks the end of a frame, the capture is finished after the last one
+    void RecordFrame();
+
+private:
+    void End();
+
+    std::mutex mutex;
+    Common::FS::IOFile file;
+    std::filesystem::path path;
+    std::chrono::steady_clock::time_point start_time;
+    std::atomic<u32> frames_left = 0;
+    std::vector<u32> words;
+};
+
+/// Reads the records of a command capture file in order
+class CommandCaptureReader {
+public:
+    /// Opens a capture, fails when the file isn't a capture of a supported version
+    bool Open(const std::filesystem::path& path);
+
+    /// Reads the next record, returns nothing at the end of the capture or on a truncated record
+    std::optional<CommandCaptureFormat::Record> Next();
+
+private:
+    Common::FS::IOFile file;
+};
+
+} // namespace Tegra
@@ -22,6 +22,15 @@ public:
         elements[index].clear();
     }
 
+    /// Like Tick, but hands the expired objects to func instead of destroying them
+    template <typename Func>
+    void Tick(Func&& func) {
+        index = (index + 1) % TICKS_TO_DESTROY;
+        if (!elements[index].empty()) {
+            func(std::exchange(elements[index], {}));
+        }
+    }
+
     void Push(T&& object) {
         elements[index].push_back(std::move(object));
     }
@@ -5,6 +5,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "common/settings.h"
+#include "common/trace.h"
 #include "core/core.h"
 #include "video_core/dma_pusher.h"
 #include "video_core/engines/maxwell_3d.h"
@@ -29,6 +30,7 @@ DmaPusher::DmaPusher(Core::System& system_, MemoryManager& memory_manager_, Cont
 DmaPusher::~DmaPusher() = default;
 
 void DmaPusher::DispatchCalls() {
+    TRACE_SCOPE("DMA dispatch");
     dma_pushbuffer_subindex = 0;
     dma_state.is_last_call = true;
     while (system.IsPoweredOn()) {
@@ -41,24 +43,24 @@ void DmaPusher::DispatchCalls() {
 }
 
 bool DmaPusher::Step() {
-    if (!ib_enable || dma_pushbuffer.empty()) {
+    if (!ib_enable || dma_pushbuffer_head == dma_pushbuffer.size()) {
         return false;
     }
 
-    CommandList& command_list = dma_pushbuffer.front();
+    CommandList& command_list = dma_pushbuffer[dma_pushbuffer_head];
 
     const size_t prefetch_size = command_list.prefetch_command_list.size();
     const size_t command_list_size = command_list.command_lists.size();
 
     if (prefetch_size == 0 && command_list_size == 0) {
-        dma_pushbuffer.pop();
+        PopCommandList();
         dma_pushbuffer_subindex = 0;
         return true;
     }
 
     if (prefetch_size > 0) {
         ProcessCommands(command_list.prefetch_command_list);
-        dma_pushbuffer.pop();
+        PopCommandList();
         return true;
     }
 
@@ -67,6 +69,8 @@ bool DmaPusher::Step() {
     dma_state.dma_get = header.addr;
 
     if (signal_sync && !synced) {
+        // The fence may still be waiting for its command buffer to be submitted
+        rasterizer->FlushCommands();
         std::unique_lock lk(sync_mutex);
         sync_cv.wait(lk, [this]() { return synced; });
         signal_sync = false;
@@ -78,8 +82,7 @@ bool DmaPusher::Step() {
     }
 
     if (header.size > 0) {
-        const bool use_safe = Settings::IsDMALevelDefault() ? Settings::IsGPULevelHigh() : Settings::IsDMALevelSafe();
-        if (use_safe) {
+        if (Settings::GetSnapshot().use_safe_dma) {
             Tegra::Memory::GpuGuestMemory<Tegra::CommandHeader, Tegra::Memory::GuestMemoryFlags::SafeRead>headers(memory_manager, dma_state.dma_get, header.size, &command_headers);
             ProcessCommands(headers);
         } else {
@@ -89,10 +92,10 @@ bool DmaPusher::Step() {
     }
 
     if (++dma_pushbuffer_subindex >= command_list_size) {
-        dma_pushbuffer.pop();
+        PopCommandList();
         dma_pushbuffer_subindex = 0;
     } else {
-        signal_sync = command_list.command_lists[dma_pushbuffer_subindex].sync && Settings::values.sync_memory_operations.GetValue();
+        signal_sync = command_list.command_lists[dma_pushbuffer_subindex].sync && Settings::GetSnapshot().sync_memory_operations;
     }
 
     if (signal_sync) {
@@ -106,6 +109,13 @@ bool DmaPusher::Step() {
     return true;
 }
 
+void DmaPusher::PopCommandList() {
+    if (++dma_pushbuffer_head == dma_pushbuffer.size()) {
+        dma_pushbuffer.clear();
+        dma_pushbuffer_head = 0;
+    }
+}
+
 void DmaPusher::ProcessCommands(std::span<const CommandHeader> commands) {
     for (size_t index = 0; index < commands.size();) {
         // Data word of methods command
@@ -117,6 +127,19 @@ void DmaPusher::ProcessCommands(std::span<const CommandHeader> commands) {
             dma_state.method_count -= max_write;
             dma_state.is_last_call = true;
             index += max_write;
+        } else if (auto* const engine = dma_state.method >= non_puller_methods ? subchannels[dma_state.subchannel] : nullptr;
+                   dma_state.method_count && !dma_increment_once && engine &&
+                   dma_state.method >= engine->bulk_port_range.first &&
+                   dma_state.method < engine->bulk_port_range.second) {
+            // Increasing run over a data port, e.g. const buffer updates, forward it in one call
+            const u32 max_write = u32(std::min<std::size_t>({dma_state.method_count,
+                commands.size() - index, engine->bulk_port_range.second - dma_state.method}));
+            dma_state.dma_word_offset = u32(index * sizeof(u32));
+            CallMultiMethod(&commands[index].argument, max_write);
+            dma_state.method += max_write;
+            dma_state.method_count -= max_write;
+            dma_state.is_last_call = true;
+            index += max_write;
         } else if (dma_state.method_count) {
             auto const command_header = commands[index]; //can copy
             dma_state.dma_word_offset = u32(index * sizeof(u32));
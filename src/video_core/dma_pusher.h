@@ -11,7 +11,6 @@
 #include <span>
 #include <vector>
 #include <boost/container/small_vector.hpp>
-#include <queue>
 
 #include "common/bit_field.h"
 #include "common/common_types.h"
@@ -127,7 +126,7 @@ public:
     ~DmaPusher();
 
     void Push(CommandList&& entries) {
-        dma_pushbuffer.push(std::move(entries));
+        dma_pushbuffer.push_back(std::move(entries));
     }
 
     void DispatchCalls();
@@ -143,6 +142,7 @@ private:
     static constexpr u32 non_puller_methods = 0x40;
     static constexpr u32 max_subchannels = 8;
     bool Step();
+    void PopCommandList();
     void ProcessCommands(std::span<const CommandHeader> commands);
 
     void SetState(const CommandHeader& command_header);
@@ -153,8 +153,11 @@ private:
 public:
     Common::ScratchBuffer<CommandHeader> command_headers; ///< Buffer for list of commands fetched at once
 
-    std::queue<CommandList> dma_pushbuffer; ///< Queue of command lists to be processed
-    std::size_t dma_pushbuffer_subindex{};  ///< Index within a command list within the pushbuffer
+    /// Queue of command lists to be processed. The storage is kept once the queue drains, so
+    /// pushing a list doesn't allocate.
+    std::vector<CommandList> dma_pushbuffer;
+    std::size_t dma_pushbuffer_head{};     ///< Index of the command list being processed
+    std::size_t dma_pushbuffer_subindex{}; ///< Index within a command list within the pushbuffer
 
     struct DmaState {
         u32 method;            ///< Current method
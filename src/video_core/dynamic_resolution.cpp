@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <utility>
+
+#include "common/settings.h"
+#include "video_core/dynamic_resolution.h"
+
+namespace VideoCore {
+
+namespace {
+
+using namespace std::chrono_literals;
+
+/// The load is averaged over windows of this length before deciding anything
+constexpr auto WindowLength = 500ms;
+/// Windows longer than this happen while nothing is presented, such as loading screens
+constexpr auto MaxWindowLength = 2s;
+/// Share of the time the GPU can be busy before the resolution is lowered
+constexpr f64 HighLoad = 0.92;
+/// Share of the time the GPU may be busy after raising the resolution
+constexpr f64 TargetLoad = 0.80;
+/// Consecutive busy windows before the resolution is lowered
+constexpr u32 HighWindows = 2;
+/// Consecutive windows with headroom before the resolution is raised
+constexpr u32 LowWindows = 6;
+/// Windows ignored after a change, while the render targets are scaled to the new resolution
+constexpr u32 SettleWindows = 2;
+
+f64 ScaleFactor(Settings::ResolutionSetup setup) {
+    Settings::ResolutionScalingInfo info{};
+    Settings::TranslateResolutionInfo(setup, info);
+    return static_cast<f64>(info.up_factor);
+}
+
+Settings::ResolutionSetup Step(Settings::ResolutionSetup setup, int direction) {
+    return static_cast<Settings::ResolutionSetup>(static_cast<int>(setup) + direction);
+}
+
+} // Anonymous namespace
+
+DynamicResolution::DynamicResolution(Settings::ResolutionSetup min_, Settings::ResolutionSetup max_,
+                                     Settings::ResolutionSetup initial)
+    : min{(std::min)(min_, max_)}, max{(std::max)(min_, max_)},
+      current{std::clamp(initial, min, max)} {}
+
+std::optional<Settings::ResolutionSetup> DynamicResolution::OnFrame(
+    std::chrono::nanoseconds gpu_busy, Clock::time_point now) {
+    if (!window_start) {
+        window_start = now;
+        window_busy = {};
+        return std::nullopt;
+    }
+    window_busy += gpu_busy;
+    const auto elapsed = now - *window_start;
+    if (elapsed < WindowLength) {
+        return std::nullopt;
+    }
+    const auto busy = std::exchange(window_busy, {});
+    window_start = now;
+    if (elapsed > MaxWindowLength) {
+        high_windows = 0;
+        low_windows = 0;
+        return std::nullopt;
+    }
+    if (settle_windows > 0) {
+        --settle_windows;
+        return std::nullopt;
+    }
+
+    const f64 load = std::chrono::duration<f64>(busy) / std::chrono::duration<f64>(elapsed);
+    if (load > HighLoad) {
+        low_windows = 0;
+        ++high_windows;
+    } else {
+        high_windows = 0;
+        // Assume the GPU time grows with the number of pixels at the next resolution
+        const bool has_headroom = [&] {
+            if (current >= max) {
+                return false;
+            }
+            const f64 ratio = ScaleFactor(Step(current, 1)) / ScaleFactor(current);
+            return load * ratio * ratio < TargetLoad;
+        }();
+        low_windows = has_headroom ? low_windows + 1 : 0;
+    }
+
+    std::optional<Settings::ResolutionSetup> change;
+    if (high_windows >= HighWindows && current > min) {
+        change = Step(current, -1);
+    } else if (low_windows >= LowWindows) {
+        change = Step(current, 1);
+    }
+    if (change) {
+        current = *change;
+        high_windows = 0;
+        low_windows = 0;
+        settle_windows = SettleWindows;
+    }
+    return change;
+}
+
+} // namespace VideoCore
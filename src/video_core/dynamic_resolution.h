@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <optional>
+
+#include "common/common_types.h"
+#include "common/settings_enums.h"
+
+namespace VideoCore {
+
+/**
+ * Picks the resolution to render at from how busy the GPU is. The resolution is lowered while the
+ * GPU is the bottleneck and raised again while it has enough headroom for the next step, so GPU
+ * bound scenes keep their frame rate and light ones render sharper.
+ */
+class DynamicResolution {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @param min     Lowest resolution to pick
+     * @param max     Highest resolution to pick
+     * @param initial Resolution to start at, clamped to the bounds
+     */
+    explicit DynamicResolution(Settings::ResolutionSetup min, Settings::ResolutionSetup max,
+                               Settings::ResolutionSetup initial);
+
+    /**
+     * Account the GPU time of a presented frame.
+     * @param gpu_busy Time the GPU spent executing work since the previous frame
+     * @param now      Time the frame was presented
+     * @return The resolution to switch to, when it has to change
+     */
+    std::optional<Settings::ResolutionSetup> OnFrame(std::chrono::nanoseconds gpu_busy,
+                                                     Clock::time_point now);
+
+    /// Resolution currently picked
+    [[nodiscard]] Settings::ResolutionSetup Current() const noexcept {
+        return current;
+    }
+
+private:
+    Settings::ResolutionSetup min;
+    Settings::ResolutionSetup max;
+    Settings::ResolutionSetup current;
+
+    std::optional<Clock::time_point> window_start;
+    std::chrono::nanoseconds window_busy{};
+    u32 high_windows = 0;
+    u32 low_windows = 0;
+    u32 settle_windows = 0;
+};
+
+} // namespace VideoCore
@@ -4,6 +4,7 @@
 // SPDX-FileCopyrightText: Copyright 2022 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <cstring>
 
 #include "common/settings.h"
@@ -228,6 +229,49 @@ void Maxwell3D::DrawManager::DrawIndexSmall(Maxwell3D& maxwell3d, u32 argument)
     ProcessDraw(maxwell3d, true, 1);
 }
 
+void Maxwell3D::DrawManager::DrawIndexSmallBatch(Maxwell3D& maxwell3d, const u32* base_start, u32 amount) {
+    // A run of small index draws can't change any state between its draws, they only carry their
+    // index range and topology. Draws of the same topology are dispatched together.
+    u32 begin = 0;
+    while (begin < amount) {
+        const auto topology = Maxwell3D::Regs::IndexBufferSmall{base_start[begin]}.topology.Value();
+        u32 end = begin + 1;
+        while (end < amount && Maxwell3D::Regs::IndexBufferSmall{base_start[end]}.topology == topology) {
+            ++end;
+        }
+        draw_state.topology = topology;
+        UpdateTopology(maxwell3d);
+        // Quads are drawn through an index buffer generated for each draw
+        const bool is_quads = draw_state.topology == Maxwell3D::Regs::PrimitiveTopology::Quads || draw_state.topology == Maxwell3D::Regs::PrimitiveTopology::QuadStrip;
+        if (end - begin == 1 || is_quads) {
+            for (u32 i = begin; i < end; ++i) {
+                DrawIndexSmall(maxwell3d, base_start[i]);
+            }
+            begin = end;
+            continue;
+        }
+        auto& draws = draw_state.batched_draws;
+        u32 index_end = 0;
+        for (u32 i = begin; i < end; ++i) {
+            const Maxwell3D::Regs::IndexBufferSmall index_small_params{base_start[i]};
+            draws.push_back(IndexedDraw{index_small_params.first, index_small_params.count});
+            index_end = (std::max)(index_end, index_small_params.first + index_small_params.count);
+        }
+        draw_state.base_instance = maxwell3d.regs.global_base_instance_index;
+        draw_state.base_index = maxwell3d.regs.global_base_vertex_index;
+        draw_state.index_buffer = maxwell3d.regs.index_buffer;
+        draw_state.index_buffer.first = 0;
+        draw_state.index_buffer.count = index_end;
+        maxwell3d.dirty.flags[VideoCommon::Dirty::IndexBuffer] = true;
+        LOG_TRACE(HW_GPU, "called, topology={}, draws={}", draw_state.topology, draws.size());
+        if (maxwell3d.ShouldExecute()) {
+            maxwell3d.rasterizer->DrawIndexedBatch();
+        }
+        draws.clear();
+        begin = end;
+    }
+}
+
 void Maxwell3D::DrawManager::DrawTexture(Maxwell3D& maxwell3d) {
     draw_texture_state.dst_x0 = f32(maxwell3d.regs.draw_texture.dst_x0) / 4096.f;
     draw_texture_state.dst_y0 = f32(maxwell3d.regs.draw_texture.dst_y0) / 4096.f;
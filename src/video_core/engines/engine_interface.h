@@ -44,6 +44,9 @@ public:
     }
 
     std::bitset<(std::numeric_limits<u16>::max)()> execution_mask{};
+    /// Registers [first, second) alias a single data port, an increasing write over them is
+    /// equivalent to a non increasing one and can be dispatched in bulk.
+    std::pair<u32, u32> bulk_port_range{};
     std::vector<std::pair<u32, u32>> method_sink{};
     GPUVAddr current_dma_segment;
     bool current_dirty{};
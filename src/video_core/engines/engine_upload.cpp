@@ -4,6 +4,7 @@
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <cstring>
 
 #include "common/algorithm.h"
@@ -44,11 +45,28 @@ void State::ProcessData(const u32 data, const bool is_last_call) {
 
 void State::ProcessData(const u32* data, size_t num_data) {
     std::span<const u8> read_buffer(reinterpret_cast<const u8*>(data), num_data * sizeof(u32));
-    ProcessData(read_buffer);
+    if (write_offset == 0 && read_buffer.size() >= copy_size) {
+        // The whole upload is in a single run of words, use it in place
+        ProcessData(read_buffer);
+        return;
+    }
+    // Runs split across pushbuffer segments are gathered until the upload is complete
+    const u32 sub_copy_size =
+        static_cast<u32>((std::min<size_t>)(read_buffer.size(), copy_size - write_offset));
+    std::memcpy(&inner_buffer[write_offset], read_buffer.data(), sub_copy_size);
+    write_offset += sub_copy_size;
+    if (write_offset == copy_size) {
+        ProcessData(inner_buffer);
+    }
 }
 
 void State::ProcessData(std::span<const u8> read_buffer) {
     const GPUVAddr address{regs.dest.Address()};
+    if (is_linear && (regs.line_count == 1 || regs.dest.pitch == regs.line_length_in)) {
+        // Lines are contiguous, write them at once
+        rasterizer->AccelerateInlineToMemory(address, copy_size, read_buffer.first(copy_size));
+        return;
+    }
     if (is_linear) {
         for (size_t line = 0; line < regs.line_count; ++line) {
             const GPUVAddr dest_line = address + line * regs.dest.pitch;
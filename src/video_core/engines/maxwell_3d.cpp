@@ -25,10 +25,17 @@ namespace Tegra::Engines {
 /// First register id that is actually a Macro call.
 constexpr u32 MacroRegistersStart = 0xE00;
 
+/// Register holding the code offset of the given graphics program
+constexpr u32 PipelineOffsetRegister(size_t index) {
+    using Pipeline = Maxwell3D::Regs::Pipeline;
+    return static_cast<u32>(MAXWELL3D_REG_INDEX(pipelines) +
+                            (index * sizeof(Pipeline) + offsetof(Pipeline, offset)) / sizeof(u32));
+}
+
 Maxwell3D::Maxwell3D(MemoryManager& memory_manager_)
     : draw_manager()
     , memory_manager{memory_manager_}
-#ifdef ARCHITECTURE_x86_64
+#if defined(ARCHITECTURE_x86_64) || defined(ARCHITECTURE_arm64)
     , macro_engine(bool(Settings::values.disable_macro_jit))
 #else
     , macro_engine(true)
@@ -40,6 +47,9 @@ Maxwell3D::Maxwell3D(MemoryManager& memory_manager_)
     execution_mask.reset();
     for (size_t i = 0; i < execution_mask.size(); i++)
         execution_mask[i] = IsMethodExecutable(u32(i));
+    // Every const buffer data register appends to the bound buffer at its current offset
+    bulk_port_range = {MAXWELL3D_REG_INDEX(const_buffer.buffer),
+                       MAXWELL3D_REG_INDEX(const_buffer.buffer) + 16};
 }
 
 Maxwell3D::~Maxwell3D() = default;
@@ -183,6 +193,12 @@ bool Maxwell3D::IsMethodExecutable(u32 method) {
     case MAXWELL3D_REG_INDEX(bind_groups[2].raw_config):
     case MAXWELL3D_REG_INDEX(bind_groups[3].raw_config):
     case MAXWELL3D_REG_INDEX(bind_groups[4].raw_config):
+    case PipelineOffsetRegister(0):
+    case PipelineOffsetRegister(1):
+    case PipelineOffsetRegister(2):
+    case PipelineOffsetRegister(3):
+    case PipelineOffsetRegister(4):
+    case PipelineOffsetRegister(5):
     case MAXWELL3D_REG_INDEX(topology_override):
     case MAXWELL3D_REG_INDEX(clear_surface):
     case MAXWELL3D_REG_INDEX(report_semaphore.query):
@@ -346,6 +362,18 @@ void Maxwell3D::ProcessMethodCall(u32 method, u32 argument, u32 nonshadow_argume
         return ProcessCBBind(3);
     case MAXWELL3D_REG_INDEX(bind_groups[4].raw_config):
         return ProcessCBBind(4);
+    case PipelineOffsetRegister(0):
+        return rasterizer->PrefetchShaderProgram(0);
+    case PipelineOffsetRegister(1):
+        return rasterizer->PrefetchShaderProgram(1);
+    case PipelineOffsetRegister(2):
+        return rasterizer->PrefetchShaderProgram(2);
+    case PipelineOffsetRegister(3):
+        return rasterizer->PrefetchShaderProgram(3);
+    case PipelineOffsetRegister(4):
+        return rasterizer->PrefetchShaderProgram(4);
+    case PipelineOffsetRegister(5):
+        return rasterizer->PrefetchShaderProgram(5);
     case MAXWELL3D_REG_INDEX(report_semaphore.query):
         return ProcessQueryGet();
     case MAXWELL3D_REG_INDEX(render_enable.mode):
@@ -436,6 +464,20 @@ void Maxwell3D::CallMultiMethod(Core::System& system, u32 method, const u32* bas
         upload_state.ProcessData(base_start, amount);
         return;
     }
+    case MAXWELL3D_REG_INDEX(index_buffer32_first):
+    case MAXWELL3D_REG_INDEX(index_buffer16_first):
+    case MAXWELL3D_REG_INDEX(index_buffer8_first):
+        if (amount > 1 && shadow_state.shadow_ram_control != Regs::ShadowRamControl::Replay) {
+            for (u32 i = 0; i < amount; i++) {
+                ProcessDirtyRegisters(method, ProcessShadowRam(method, base_start[i]));
+            }
+            draw_manager.DrawIndexSmallBatch(*this, base_start, amount);
+            break;
+        }
+        for (u32 i = 0; i < amount; i++) {
+            CallMethod(system, method, base_start[i], methods_pending - i <= 1);
+        }
+        break;
     case MAXWELL3D_REG_INDEX(draw_inline_index):
     case MAXWELL3D_REG_INDEX(inline_index_2x16.even):
     case MAXWELL3D_REG_INDEX(inline_index_4x8.index0):
@@ -3035,6 +3035,10 @@ public:
 
     struct DrawManager {
         enum class DrawMode : u32 { General = 0, Instance, InlineIndex };
+        struct IndexedDraw {
+            u32 first;
+            u32 count;
+        };
         struct State {
             Maxwell3D::Regs::PrimitiveTopology topology{};
             DrawMode draw_mode{};
@@ -3045,6 +3049,9 @@ public:
             u32 base_instance{};
             u32 instance_count{};
             std::vector<u8> inline_index_draw_indexes;
+            /// Index ranges of the draws dispatched by DrawIndexedBatch, the index buffer state
+            /// covers all of them
+            std::vector<IndexedDraw> batched_draws;
         };
         struct DrawTextureState {
             f32 dst_x0;
@@ -3081,6 +3088,7 @@ public:
         void DrawBegin(Maxwell3D& maxwell3d);
         void DrawEnd(Maxwell3D& maxwell3d, u32 instance_count = 1, bool force_draw = false);
         void DrawIndexSmall(Maxwell3D& maxwell3d, u32 argument);
+        void DrawIndexSmallBatch(Maxwell3D& maxwell3d, const u32* base_start, u32 amount);
         void DrawTexture(Maxwell3D& maxwell3d);
         void UpdateTopology(Maxwell3D& maxwell3d);
         void ProcessDraw(Maxwell3D& maxwell3d, bool draw_indexed, u32 instance_count);
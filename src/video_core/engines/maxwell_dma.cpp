@@ -76,12 +76,31 @@ void MaxwellDMA::Launch() {
         }
 
         if (is_src_pitch && is_dst_pitch) {
-            for (u32 line = 0; line < regs.line_count; ++line) {
-                const GPUVAddr source_line =
-                    regs.offset_in + static_cast<size_t>(line) * regs.pitch_in;
-                const GPUVAddr dest_line =
-                    regs.offset_out + static_cast<size_t>(line) * regs.pitch_out;
-                memory_manager.CopyBlock(dest_line, source_line, regs.line_length_in);
+            auto& accelerate = rasterizer->AccessAccelerateDMA();
+            const bool is_forward = regs.pitch_in >= 0 && regs.pitch_out >= 0;
+            const size_t packed_size = static_cast<size_t>(regs.line_length_in) * regs.line_count;
+            const GPUVAddr src_address = regs.offset_in;
+            const GPUVAddr dst_address = regs.offset_out;
+            // Copying overlapping lines one at a time can read lines that were just written
+            const bool is_packed = regs.pitch_in == regs.pitch_out &&
+                                   static_cast<u32>(regs.pitch_in) == regs.line_length_in &&
+                                   (src_address + packed_size <= dst_address ||
+                                    dst_address + packed_size <= src_address);
+            if (is_forward &&
+                accelerate.BufferCopyLines(src_address, static_cast<u32>(regs.pitch_in),
+                                           dst_address, static_cast<u32>(regs.pitch_out),
+                                           regs.line_length_in, regs.line_count)) {
+                // All lines were copied in a single batch
+            } else if (is_packed) {
+                memory_manager.CopyBlock(dst_address, src_address, packed_size);
+            } else {
+                for (u32 line = 0; line < regs.line_count; ++line) {
+                    const GPUVAddr source_line =
+                        regs.offset_in + static_cast<size_t>(line) * regs.pitch_in;
+                    const GPUVAddr dest_line =
+                        regs.offset_out + static_cast<size_t>(line) * regs.pitch_out;
+                    memory_manager.CopyBlock(dest_line, source_line, regs.line_length_in);
+                }
             }
         } else {
             if (!is_src_pitch && is_dst_pitch) {
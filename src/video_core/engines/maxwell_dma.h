@@ -83,6 +83,10 @@ public:
     /// Write the value to the register identified by method.
     virtual bool BufferCopy(GPUVAddr src_address, GPUVAddr dest_address, u64 amount) = 0;
 
+    /// Copies line_count lines of line_length bytes between two pitch linear regions
+    virtual bool BufferCopyLines(GPUVAddr src_address, u64 src_pitch, GPUVAddr dest_address,
+                                 u64 dest_pitch, u64 line_length, u32 line_count) = 0;
+
     virtual bool BufferClear(GPUVAddr src_address, u64 amount, u32 value) = 0;
 
     virtual bool ImageToBuffer(const DMA::ImageCopy& copy_info, const DMA::ImageOperand& src,
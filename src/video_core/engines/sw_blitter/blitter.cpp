@@ -3,9 +3,13 @@
 
 #include <algorithm>
 #include <cmath>
+#include <optional>
+#include <thread>
 #include <vector>
 
+#include "common/div_ceil.h"
 #include "common/scratch_buffer.h"
+#include "common/thread_worker.h"
 #include "video_core/engines/sw_blitter/blitter.h"
 #include "video_core/engines/sw_blitter/converter.h"
 #include "video_core/guest_memory.h"
@@ -28,12 +32,21 @@ namespace {
 
 constexpr size_t ir_components = 4;
 
+/// Blits with fewer rows than this per worker are processed on the calling thread alone
+constexpr u32 MIN_ROWS_PER_CHUNK = 64;
+
+size_t GetNumRowWorkers() {
+    // Blits run on the GPU thread while the CPU cores and the shader workers are busy, so only
+    // take a few threads even on big machines.
+    return std::clamp<size_t>(std::thread::hardware_concurrency() / 4, 1, 3);
+}
+
 void NearestNeighbor(std::span<const u8> input, std::span<u8> output, u32 src_width, u32 src_height,
-                     u32 dst_width, u32 dst_height, size_t bpp) {
+                     u32 dst_width, u32 dst_height, size_t bpp, u32 first_row, u32 last_row) {
     const size_t dx_du = std::llround((static_cast<f64>(src_width) / dst_width) * (1ULL << 32));
     const size_t dy_dv = std::llround((static_cast<f64>(src_height) / dst_height) * (1ULL << 32));
-    size_t src_y = 0;
-    for (u32 y = 0; y < dst_height; y++) {
+    size_t src_y = first_row * dy_dv;
+    for (u32 y = first_row; y < last_row; y++) {
         size_t src_x = 0;
         for (u32 x = 0; x < dst_width; x++) {
             const size_t read_from = ((src_y * src_width + src_x) >> 32) * bpp;
@@ -47,11 +60,12 @@ void NearestNeighbor(std::span<const u8> input, std::span<u8> output, u32 src_wi
 }
 
 void NearestNeighborFast(std::span<const f32> input, std::span<f32> output, u32 src_width,
-                         u32 src_height, u32 dst_width, u32 dst_height) {
+                         u32 src_height, u32 dst_width, u32 dst_height, u32 first_row,
+                         u32 last_row) {
     const size_t dx_du = std::llround((static_cast<f64>(src_width) / dst_width) * (1ULL << 32));
     const size_t dy_dv = std::llround((static_cast<f64>(src_height) / dst_height) * (1ULL << 32));
-    size_t src_y = 0;
-    for (u32 y = 0; y < dst_height; y++) {
+    size_t src_y = first_row * dy_dv;
+    for (u32 y = first_row; y < last_row; y++) {
         size_t src_x = 0;
         for (u32 x = 0; x < dst_width; x++) {
             const size_t read_from = ((src_y * src_width + src_x) >> 32) * ir_components;
@@ -65,7 +79,8 @@ void NearestNeighborFast(std::span<const f32> input, std::span<f32> output, u32
 }
 
 void Bilinear(std::span<const f32> input, std::span<f32> output, size_t src_width,
-              size_t src_height, size_t dst_width, size_t dst_height) {
+              size_t src_height, size_t dst_width, size_t dst_height, u32 first_row,
+              u32 last_row) {
     const auto bilinear_sample = [](std::span<const f32> x0_y0, std::span<const f32> x1_y0,
                                     std::span<const f32> x0_y1, std::span<const f32> x1_y1,
                                     f32 weight_x, f32 weight_y) {
@@ -81,7 +96,7 @@ void Bilinear(std::span<const f32> input, std::span<f32> output, size_t src_widt
         dst_width > 1 ? static_cast<f32>(src_width - 1) / static_cast<f32>(dst_width - 1) : 0.f;
     const f32 dy_dv =
         dst_height > 1 ? static_cast<f32>(src_height - 1) / static_cast<f32>(dst_height - 1) : 0.f;
-    for (u32 y = 0; y < dst_height; y++) {
+    for (u32 y = first_row; y < last_row; y++) {
         for (u32 x = 0; x < dst_width; x++) {
             const f32 x_low = std::floor(static_cast<f32>(x) * dx_du);
             const f32 y_low = std::floor(static_cast<f32>(y) * dy_dv);
@@ -92,7 +107,7 @@ void Bilinear(std::span<const f32> input, std::span<f32> output, size_t src_widt
 
             const auto read_src = [&](f32 in_x, f32 in_y) {
                 const size_t read_from =
-                    ((static_cast<size_t>(in_x) * src_width + static_cast<size_t>(in_y)) >> 32) *
+                    (static_cast<size_t>(in_y) * src_width + static_cast<size_t>(in_x)) *
                     ir_components;
                 return std::span<const f32>(&input[read_from], ir_components);
             };
@@ -128,12 +143,38 @@ void ProcessPitchLinear(std::span<const u8> input, std::span<u8> output, size_t
 } // namespace
 
 struct SoftwareBlitEngine::BlitEngineImpl {
+    /// Calls func(first_row, last_row) over [0, rows), split between the calling thread and the
+    /// row workers
+    template <typename Func>
+    void ForEachRowRange(u32 rows, Func&& func) {
+        const size_t num_row_workers = GetNumRowWorkers();
+        const u32 num_chunks =
+            std::clamp<u32>(rows / MIN_ROWS_PER_CHUNK, 1, static_cast<u32>(num_row_workers) + 1);
+        if (num_chunks == 1) {
+            func(0, rows);
+            return;
+        }
+        if (!row_workers) {
+            // Most channels never fall back to software blits, only spawn the workers when needed
+            row_workers.emplace(num_row_workers, "BlitRowWorker");
+        }
+        const u32 chunk_rows = Common::DivCeil(rows, num_chunks);
+        for (u32 first = chunk_rows; first < rows; first += chunk_rows) {
+            const u32 last = (std::min)(first + chunk_rows, rows);
+            row_workers->QueueWork([&func, first, last] { func(first, last); },
+                                   Common::WorkPriority::High);
+        }
+        func(0, chunk_rows);
+        row_workers->WaitForRequests();
+    }
+
     Common::ScratchBuffer<u8> tmp_buffer;
     Common::ScratchBuffer<u8> src_buffer;
     Common::ScratchBuffer<u8> dst_buffer;
     Common::ScratchBuffer<f32> intermediate_src;
     Common::ScratchBuffer<f32> intermediate_dst;
     ConverterFactory converter_factory;
+    std::optional<Common::ThreadWorker> row_workers;
 };
 
 SoftwareBlitEngine::SoftwareBlitEngine(MemoryManager& memory_manager_)
@@ -174,28 +215,51 @@ bool SoftwareBlitEngine::Blit(Fermi2D::Surface& src, Fermi2D::Surface& dst,
         src.format != dst.format || src_extent_x != dst_extent_x || src_extent_y != dst_extent_y;
 
     const auto conversion_phase_same_format = [&]() {
-        NearestNeighbor(impl->src_buffer, impl->dst_buffer, src_extent_x, src_extent_y,
-                        dst_extent_x, dst_extent_y, dst_bytes_per_pixel);
+        impl->ForEachRowRange(dst_extent_y, [&](u32 first_row, u32 last_row) {
+            NearestNeighbor(impl->src_buffer, impl->dst_buffer, src_extent_x, src_extent_y,
+                            dst_extent_x, dst_extent_y, dst_bytes_per_pixel, first_row, last_row);
+        });
     };
 
     const auto conversion_phase_ir = [&]() {
+        // Converters are built on first use, fetch them before the rows are split
         auto* input_converter = impl->converter_factory.GetFormatConverter(src.format);
+        auto* output_converter = impl->converter_factory.GetFormatConverter(dst.format);
         impl->intermediate_src.resize_destructive((src_copy_size / src_bytes_per_pixel) *
                                                   ir_components);
         impl->intermediate_dst.resize_destructive((dst_copy_size / dst_bytes_per_pixel) *
                                                   ir_components);
-        input_converter->ConvertTo(impl->src_buffer, impl->intermediate_src);
-
-        if (config.filter != Fermi2D::Filter::Bilinear) {
-            NearestNeighborFast(impl->intermediate_src, impl->intermediate_dst, src_extent_x,
-                                src_extent_y, dst_extent_x, dst_extent_y);
-        } else {
-            Bilinear(impl->intermediate_src, impl->intermediate_dst, src_extent_x, src_extent_y,
-                     dst_extent_x, dst_extent_y);
-        }
 
-        auto* output_converter = impl->converter_factory.GetFormatConverter(dst.format);
-        output_converter->ConvertFrom(impl->intermediate_dst, impl->dst_buffer);
+        const std::span<const u8> src_bytes{impl->src_buffer};
+        const std::span<f32> src_ir{impl->intermediate_src};
+        const size_t src_row_size = src_extent_x * src_bytes_per_pixel;
+        const size_t src_row_ir = src_extent_x * ir_components;
+        impl->ForEachRowRange(src_extent_y, [&](u32 first_row, u32 last_row) {
+            const size_t rows = last_row - first_row;
+            input_converter->ConvertTo(src_bytes.subspan(first_row * src_row_size,
+                                                         rows * src_row_size),
+                                       src_ir.subspan(first_row * src_row_ir, rows * src_row_ir));
+        });
+
+        const std::span<const f32> dst_ir{impl->intermediate_dst};
+        const std::span<u8> dst_bytes{impl->dst_buffer};
+        const size_t dst_row_size = dst_extent_x * dst_bytes_per_pixel;
+        const size_t dst_row_ir = dst_extent_x * ir_components;
+        impl->ForEachRowRange(dst_extent_y, [&](u32 first_row, u32 last_row) {
+            if (config.filter != Fermi2D::Filter::Bilinear) {
+                NearestNeighborFast(impl->intermediate_src, impl->intermediate_dst, src_extent_x,
+                                    src_extent_y, dst_extent_x, dst_extent_y, first_row,
+                                    last_row);
+            } else {
+                Bilinear(impl->intermediate_src, impl->intermediate_dst, src_extent_x,
+                         src_extent_y, dst_extent_x, dst_extent_y, first_row, last_row);
+            }
+            // Each range only reads the intermediate rows it has just filtered
+            const size_t rows = last_row - first_row;
+            output_converter->ConvertFrom(
+                dst_ir.subspan(first_row * dst_row_ir, rows * dst_row_ir),
+                dst_bytes.subspan(first_row * dst_row_size, rows * dst_row_size));
+        });
     };
 
     // Do actual Blit
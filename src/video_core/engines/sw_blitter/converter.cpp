@@ -10,11 +10,16 @@
 #include <ankerl/unordered_dense.h>
 #include <bit>
 #include <numeric>
+#include <utility>
 #include "common/assert.h"
 #include "video_core/engines/sw_blitter/converter.h"
 #include "video_core/surface.h"
 #include "video_core/textures/decoders.h"
 
+#if defined(ARCHITECTURE_x86_64)
+#include <emmintrin.h>
+#endif
+
 #ifdef _MSC_VER
 #define FORCE_INLINE __forceinline
 #else
@@ -684,6 +689,148 @@ private:
 
     static constexpr std::array<u32, num_components> component_mask = GetComponentsMask();
 
+    /// UNORM formats packed in a single 16 or 32 bits word, e.g. RGBA8, BGRA8 and RGB565
+    static constexpr bool IsPackedUnorm() {
+        if (total_words_per_pixel != 1 || (total_bytes_per_pixel != 2 && total_bytes_per_pixel != 4)) {
+            return false;
+        }
+        for (size_t i = 0; i < num_components; i++) {
+            if (component_types[i] != ComponentType::UNORM || component_sizes[i] > 16) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Four 32 bits float components, e.g. RGBA32F
+    static constexpr bool IsFloat32x4() {
+        if (num_components != 4) {
+            return false;
+        }
+        for (size_t i = 0; i < num_components; i++) {
+            if (component_types[i] != ComponentType::FLOAT || component_sizes[i] != 32) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static constexpr bool has_packed_unorm_path = IsPackedUnorm();
+    static constexpr bool has_float32x4_path = IsFloat32x4();
+
+#if defined(ARCHITECTURE_x86_64)
+    /// Converts groups of four pixels with SSE2, returns the number of pixels converted
+    static size_t ConvertToSSE2(std::span<const u8> input, std::span<f32> output,
+                                size_t num_pixels) {
+        const size_t num_simd_pixels = num_pixels & ~size_t{3};
+        for (size_t pixel = 0; pixel < num_simd_pixels; pixel += 4) {
+            // One register per IR component, holding that component of the four pixels
+            __m128 ir[components_per_ir_rep]{};
+            if constexpr (has_packed_unorm_path) {
+                __m128i words;
+                if constexpr (total_bytes_per_pixel == 4) {
+                    words = _mm_loadu_si128(
+                        reinterpret_cast<const __m128i*>(&input[pixel * total_bytes_per_pixel]));
+                } else {
+                    words = _mm_unpacklo_epi16(
+                        _mm_loadl_epi64(reinterpret_cast<const __m128i*>(
+                            &input[pixel * total_bytes_per_pixel])),
+                        _mm_setzero_si128());
+                }
+                [&]<size_t... i>(std::index_sequence<i...>) {
+                    (
+                        [&] {
+                            if constexpr (component_swizzle[i] != Swizzle::None) {
+                                constexpr u32 max = static_cast<u32>((1ULL << component_sizes[i]) - 1ULL);
+                                const __m128i value = _mm_and_si128(
+                                    _mm_srli_epi32(words, static_cast<int>(bound_offsets[i])),
+                                    _mm_set1_epi32(static_cast<int>(max)));
+                                ir[static_cast<size_t>(component_swizzle[i])] =
+                                    _mm_div_ps(_mm_cvtepi32_ps(value),
+                                               _mm_set1_ps(static_cast<f32>(max)));
+                            }
+                        }(),
+                        ...);
+                }(std::make_index_sequence<num_components>{});
+            } else {
+                __m128 values[num_components];
+                for (size_t i = 0; i < 4; i++) {
+                    values[i] = _mm_loadu_ps(
+                        reinterpret_cast<const f32*>(&input[(pixel + i) * total_bytes_per_pixel]));
+                }
+                _MM_TRANSPOSE4_PS(values[0], values[1], values[2], values[3]);
+                for (size_t i = 0; i < num_components; i++) {
+                    if (component_swizzle[i] != Swizzle::None) {
+                        ir[static_cast<size_t>(component_swizzle[i])] = values[i];
+                    }
+                }
+            }
+            _MM_TRANSPOSE4_PS(ir[0], ir[1], ir[2], ir[3]);
+            for (size_t i = 0; i < 4; i++) {
+                _mm_storeu_ps(&output[(pixel + i) * components_per_ir_rep], ir[i]);
+            }
+        }
+        return num_simd_pixels;
+    }
+
+    /// Converts groups of four pixels with SSE2, returns the number of pixels converted
+    static size_t ConvertFromSSE2(std::span<const f32> input, std::span<u8> output,
+                                  size_t num_pixels) {
+        const size_t num_simd_pixels = num_pixels & ~size_t{3};
+        for (size_t pixel = 0; pixel < num_simd_pixels; pixel += 4) {
+            __m128 ir[components_per_ir_rep];
+            for (size_t i = 0; i < 4; i++) {
+                ir[i] = _mm_loadu_ps(&input[(pixel + i) * components_per_ir_rep]);
+            }
+            _MM_TRANSPOSE4_PS(ir[0], ir[1], ir[2], ir[3]);
+            if constexpr (has_packed_unorm_path) {
+                __m128i words = _mm_setzero_si128();
+                [&]<size_t... i>(std::index_sequence<i...>) {
+                    (
+                        [&] {
+                            if constexpr (component_swizzle[i] != Swizzle::None) {
+                                constexpr u32 max = static_cast<u32>((1ULL << component_sizes[i]) - 1ULL);
+                                // Truncates like the scalar path
+                                const __m128i value = _mm_cvttps_epi32(
+                                    _mm_mul_ps(ir[static_cast<size_t>(component_swizzle[i])],
+                                               _mm_set1_ps(static_cast<f32>(max))));
+                                words = _mm_or_si128(
+                                    words, _mm_and_si128(
+                                               _mm_slli_epi32(value, static_cast<int>(bound_offsets[i])),
+                                               _mm_set1_epi32(static_cast<int>(component_mask[i]))));
+                            }
+                        }(),
+                        ...);
+                }(std::make_index_sequence<num_components>{});
+                if constexpr (total_bytes_per_pixel == 4) {
+                    _mm_storeu_si128(
+                        reinterpret_cast<__m128i*>(&output[pixel * total_bytes_per_pixel]), words);
+                } else {
+                    // Sign extend the low halves so the saturating pack keeps them as they are
+                    const __m128i halves = _mm_srai_epi32(_mm_slli_epi32(words, 16), 16);
+                    _mm_storel_epi64(
+                        reinterpret_cast<__m128i*>(&output[pixel * total_bytes_per_pixel]),
+                        _mm_packs_epi32(halves, halves));
+                }
+            } else {
+                __m128 values[num_components];
+                for (size_t i = 0; i < num_components; i++) {
+                    values[i] = component_swizzle[i] != Swizzle::None
+                                    ? ir[static_cast<size_t>(component_swizzle[i])]
+                                    : _mm_setzero_ps();
+                }
+                _MM_TRANSPOSE4_PS(values[0], values[1], values[2], values[3]);
+                for (size_t i = 0; i < 4; i++) {
+                    _mm_storeu_ps(
+                        reinterpret_cast<f32*>(&output[(pixel + i) * total_bytes_per_pixel]),
+                        values[i]);
+                }
+            }
+        }
+        return num_simd_pixels;
+    }
+#endif
+
     // We are forcing inline so the compiler can SIMD the conversations, since it may do 4 function
     // calls, it may fail to detect the benefit of inlining.
     template <size_t which_component>
@@ -835,7 +982,13 @@ private:
 public:
     void ConvertTo(std::span<const u8> input, std::span<f32> output) override {
         const size_t num_pixels = output.size() / components_per_ir_rep;
-        for (size_t pixel = 0; pixel < num_pixels; pixel++) {
+        size_t pixel = 0;
+#if defined(ARCHITECTURE_x86_64)
+        if constexpr (has_packed_unorm_path || has_float32x4_path) {
+            pixel = ConvertToSSE2(input, output, num_pixels);
+        }
+#endif
+        for (; pixel < num_pixels; pixel++) {
             std::array<u32, total_words_per_pixel> words{};
 
             std::memcpy(words.data(), &input[pixel * total_bytes_per_pixel], total_bytes_per_pixel);
@@ -885,7 +1038,13 @@ public:
 
     void ConvertFrom(std::span<const f32> input, std::span<u8> output) override {
         const size_t num_pixels = output.size() / total_bytes_per_pixel;
-        for (size_t pixel = 0; pixel < num_pixels; pixel++) {
+        size_t pixel = 0;
+#if defined(ARCHITECTURE_x86_64)
+        if constexpr (has_packed_unorm_path || has_float32x4_path) {
+            pixel = ConvertFromSSE2(input, output, num_pixels);
+        }
+#endif
+        for (; pixel < num_pixels; pixel++) {
             std::span<const f32> old_components(&input[pixel * components_per_ir_rep],
                                                 components_per_ir_rep);
             std::array<u32, total_words_per_pixel> words{};
@@ -45,6 +45,7 @@ class FenceManager {
     using TBufferCache = typename Traits::BufferCacheType;
     using TQueryCache = typename Traits::QueryCacheType;
     static constexpr bool can_async_check = Traits::HAS_ASYNC_CHECK;
+    static constexpr bool defers_submit = Traits::DEFERS_FENCE_SUBMIT;
 
 public:
     /// Notify the fence manager about a new frame
@@ -72,7 +73,7 @@ public:
     }
 
     void SignalFence(std::function<void()>&& func) {
-        const bool delay_fence = Settings::IsGPUFenceBehaviorDefault() ? Settings::IsGPULevelHigh() : Settings::IsGPUFenceBehaviorBalanced() || Settings::IsGPUFenceBehaviorAccurate() || Settings::IsGPUFenceBehaviorStrict();
+        const bool delay_fence = Settings::GetSnapshot().delay_fences;
         const bool should_flush = ShouldFlush();
         if constexpr (!can_async_check) {
             TryReleasePendingFences<false>();
@@ -91,7 +92,9 @@ public:
             func();
         }
         fences.push(std::move(new_fence));
-        if (should_flush) {
+        // Backends that defer the submission share one submission between all the fences of a
+        // command list, they are submitted by FlushCommands at its end or before any wait.
+        if (should_flush && !defers_submit) {
             rasterizer.FlushCommands();
         }
         if constexpr (can_async_check) {
@@ -112,6 +115,9 @@ public:
             TryReleasePendingFences<true>();
         } else {
             if (!force) {
+                if constexpr (defers_submit) {
+                    rasterizer.FlushCommands();
+                }
                 return;
             }
             std::mutex wait_mutex;
@@ -123,6 +129,9 @@ public:
                 wait_cv.notify_all();
             });
             SignalFence(std::move(func));
+            if constexpr (defers_submit) {
+                rasterizer.FlushCommands();
+            }
             std::unique_lock lk(wait_mutex);
             wait_cv.wait(
                 lk, [&wait_finished] { return wait_finished.load(std::memory_order_relaxed); });
@@ -196,8 +205,8 @@ private:
         Common::SetCurrentThreadName("GPUFencingThread");
         Common::SetCurrentThreadPriority(Common::ThreadPriority::High);
 
-        TFence current_fence;
-        std::deque<std::function<void()>> current_operations;
+        std::queue<TFence> current_fences;
+        std::deque<std::deque<std::function<void()>>> current_operations;
         while (!stop_token.stop_requested()) {
             {
                 std::unique_lock lock(guard);
@@ -205,21 +214,25 @@ private:
                 if (stop_token.stop_requested()) [[unlikely]] {
                     return;
                 }
-                current_fence = std::move(fences.front());
-                current_operations = std::move(pending_operations.front());
-                fences.pop();
-                pending_operations.pop_front();
+                // Take every queued fence, fences of the same submission are released together
+                std::swap(current_fences, fences);
+                std::swap(current_operations, pending_operations);
             }
-            if (!current_fence->IsStubbed()) {
-                WaitFence(current_fence);
-            }
-            PopAsyncFlushes();
-            for (auto& operation : current_operations) {
-                operation();
-            }
-            {
-                std::unique_lock lock(ring_guard);
-                delayed_destruction_ring.Push(std::move(current_fence));
+            while (!current_fences.empty()) {
+                TFence& current_fence = current_fences.front();
+                if (!current_fence->IsStubbed() && !IsFenceSignaled(current_fence)) {
+                    WaitFence(current_fence);
+                }
+                PopAsyncFlushes();
+                for (auto& operation : current_operations.front()) {
+                    operation();
+                }
+                current_operations.pop_front();
+                {
+                    std::unique_lock lock(ring_guard);
+                    delayed_destruction_ring.Push(std::move(current_fence));
+                }
+                current_fences.pop();
             }
         }
     }
@@ -20,7 +20,9 @@
 #include "core/frontend/graphics_context.h"
 #include "core/hle/service/nvdrv/nvdata.h"
 #include "core/perf_stats.h"
+#include "hid_core/hid_core.h"
 #include "video_core/cdma_pusher.h"
+#include "video_core/command_capture.h"
 #include "video_core/control/channel_state.h"
 #include "video_core/control/scheduler.h"
 #include "video_core/dma_pusher.h"
@@ -99,16 +101,31 @@ struct GPU::Impl {
 
     /// Synchronizes CPU writes with Host GPU memory.
     void InvalidateGPUCache() {
-        std::function<void(PAddr, size_t)> callback_writes([this](PAddr address, size_t size) {
-            renderer->ReadRasterizer()->OnCacheInvalidation(address, size);
+        std::vector<std::pair<DAddr, std::size_t>> dirty_ranges;
+        std::function<void(PAddr, size_t)> callback_writes([&dirty_ranges](PAddr address, size_t size) {
+            if (address == 0 || size == 0) {
+                return;
+            }
+            // Writes are collected per page, merge the runs that continue each other
+            if (!dirty_ranges.empty()) {
+                auto& [last_address, last_size] = dirty_ranges.back();
+                if (last_address + last_size == address) {
+                    last_size += size;
+                    return;
+                }
+            }
+            dirty_ranges.emplace_back(address, size);
         });
         system.GatherGPUDirtyMemory(callback_writes);
+        if (!dirty_ranges.empty()) {
+            renderer->ReadRasterizer()->OnCacheInvalidationBatch(dirty_ranges);
+        }
     }
 
     /// Signal the ending of command list.
     void OnCommandListEnd() {
         renderer->ReadRasterizer()->ReleaseFences(false);
-        Settings::UpdateGPUAccuracy();
+        Settings::UpdateSnapshot();
     }
 
     /// Request a host GPU memory flush from the CPU.
@@ -157,14 +174,18 @@ struct GPU::Impl {
 
     void RendererFrameEndNotify() {
         system.GetPerfStats().EndGameFrame();
+        system.HIDCore().GetInputLatency().OnFramePresented();
     }
 
     /// Performs any additional setup necessary in order to begin GPU emulation.
     /// This can be used to launch any necessary threads and register any necessary
     /// core timing events.
     void Start() {
-        Settings::UpdateGPUAccuracy();
+        Settings::UpdateSnapshot();
         gpu_thread.StartThread(*renderer, renderer->Context(), scheduler);
+        if (const u16 frames = Settings::values.gpu_capture_frames.GetValue(); frames > 0) {
+            command_capture.Begin(Settings::GetCurrentProgramID(), frames);
+        }
     }
 
     void NotifyShutdown() {
@@ -188,6 +209,12 @@ struct GPU::Impl {
 
     /// Push GPU command entries to be processed
     void PushGPUEntries(s32 channel, Tegra::CommandList&& entries) {
+        if (command_capture.IsActive()) [[unlikely]] {
+            if (const auto it = channels.find(channel);
+                it != channels.end() && it->second->memory_manager) {
+                command_capture.RecordCommandList(channel, entries, *it->second->memory_manager);
+            }
+        }
         gpu_thread.SubmitList(channel, std::move(entries), is_async);
     }
 
@@ -225,6 +252,7 @@ struct GPU::Impl {
     }
 
     void RequestComposite(std::vector<Tegra::FramebufferConfig>&& layers, std::vector<Service::Nvidia::NvFence>&& fences) {
+        command_capture.RecordFrame();
         size_t num_fences{fences.size()};
         size_t current_request_counter{};
         {
@@ -308,6 +336,8 @@ struct GPU::Impl {
     Tegra::Control::ChannelState* current_channel;
     s32 bound_channel{-1};
 
+    CommandCapture command_capture;
+
     std::deque<size_t> free_swap_counters;
     std::deque<size_t> request_swap_counters;
     std::mutex request_swap_mutex;
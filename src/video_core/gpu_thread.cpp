@@ -29,11 +29,12 @@ void ThreadManager::StartThread(VideoCore::RendererBase& renderer, Core::Fronten
     rasterizer = renderer.ReadRasterizer();
     thread = std::jthread([&](std::stop_token stop_token) {
         Common::SetCurrentThreadName("GPU");
-        Common::SetCurrentThreadPriority(Common::ThreadPriority::Critical);
+        Common::SetCurrentThreadRole(Common::ThreadRole::Gpu);
         system.RegisterHostThread();
 
         auto current_context = context.Acquire();
         CommandDataContainer next;
+        u64 fence{};
         while (!stop_token.stop_requested()) {
             state.queue.PopWait(next, stop_token);
             if (stop_token.stop_requested()) {
@@ -50,11 +51,12 @@ void ThreadManager::StartThread(VideoCore::RendererBase& renderer, Core::Fronten
             } else {
                 ASSERT(false);
             }
-            state.signaled_fence.store(next.fence);
+            ++fence;
             if (next.block) {
-                // We have to lock the write_lock to ensure that the condition_variable wait not get a
+                // We have to lock the signal_lock to ensure that the condition_variable wait not get a
                 // race between the check and the lock itself.
-                std::scoped_lock lk{state.write_lock};
+                std::scoped_lock lk{state.signal_lock};
+                state.signaled_fence.store(fence, std::memory_order_relaxed);
                 state.cv.notify_all();
             }
         }
@@ -100,11 +102,10 @@ u64 ThreadManager::PushCommand(CommandData&& command_data, bool block, bool is_a
         block = true;
     }
 
-    std::unique_lock lk(state.write_lock);
-    const u64 fence{++state.last_fence};
-    state.queue.EmplaceWait(std::move(command_data), fence, block);
+    const u64 fence{state.queue.EmplaceWait(std::move(command_data), block) + 1};
 
     if (block) {
+        std::unique_lock lk(state.signal_lock);
         state.cv.wait(lk, thread.get_stop_token(), [this, fence] {
             return fence <= state.signaled_fence.load(std::memory_order_relaxed);
         });
@@ -83,21 +83,22 @@ using CommandData =
 struct CommandDataContainer {
     CommandDataContainer() = default;
 
-    explicit CommandDataContainer(CommandData&& data_, u64 next_fence_, bool block_)
-        : data{std::move(data_)}, fence{next_fence_}, block(block_) {}
+    explicit CommandDataContainer(CommandData&& data_, bool block_)
+        : data{std::move(data_)}, block(block_) {}
 
     CommandData data;
-    u64 fence{};
     bool block{};
 };
 
 /// Struct used to synchronize the GPU thread
 struct SynchState final {
-    using CommandQueue = Common::SPSCQueue<CommandDataContainer>;
-    std::mutex write_lock;
+    /// Commands are popped in the order their tickets were handed out, the fence of a command is
+    /// its ticket plus one, so producers never need to serialize on a lock to get one.
+    using CommandQueue = Common::MPSCQueue<CommandDataContainer>;
     CommandQueue queue;
-    u64 last_fence{};
+    /// Only updated for blocking commands, nothing else waits on fences.
     std::atomic<u64> signaled_fence{};
+    std::mutex signal_lock;
     std::condition_variable_any cv;
 };
 
@@ -18,7 +18,10 @@ Decoder::Decoder(Host1x::Host1x& host1x_, s32 id_, const Host1x::NvdecCommon::Nv
     , id{id_}
 {}
 
-Decoder::~Decoder() = default;
+Decoder::~Decoder() {
+    // Queued frames are still counted as pending by the frame queue, let them finish
+    decode_worker.WaitForRequests();
+}
 
 void Decoder::SetFrameDimensions(s32 width, s32 height) {
     if (width <= 0 || height <= 0) {
@@ -44,8 +47,21 @@ void Decoder::Decode() {
         std::tie(offsets.luma, std::ignore) = GetProgressiveOffsets();
     }
 
+    // The guest is free to reuse the bitstream and the registers once the method returns, so
+    // everything the decode needs is captured here. VIC waits for pending decodes before it looks
+    // up frames, which keeps the output the same as decoding in place.
+    host1x.frame_queue.BeginDecode();
+    decode_worker.QueueWork([this, packet = std::vector<u8>(packet_data.begin(), packet_data.end()),
+                             offsets, dimensions = GetFrameDimensions()] {
+        DecodeFrame(packet, offsets, dimensions);
+        host1x.frame_queue.EndDecode();
+    });
+}
+
+void Decoder::DecodeFrame(std::span<const u8> packet_data, const FFmpeg::FrameOffsets& offsets,
+                          std::optional<FFmpeg::FrameDimensions> dimensions) {
     // Send assembled bitstream to decoder.
-    if (!decode_api.SendPacket(packet_data, offsets, GetFrameDimensions())) {
+    if (!decode_api.SendPacket(packet_data, offsets, dimensions)) {
         return;
     }
 
@@ -9,12 +9,15 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <span>
 #include <string_view>
 #include <tuple>
+#include <vector>
 #include <ankerl/unordered_dense.h>
 #include <queue>
 
 #include "common/common_types.h"
+#include "common/thread_worker.h"
 #include "video_core/host1x/ffmpeg.h"
 #include "video_core/host1x/nvdec_common.h"
 
@@ -29,7 +32,7 @@ class Decoder {
 public:
     virtual ~Decoder();
 
-    /// Call decoders to construct headers, decode AVFrame with ffmpeg
+    /// Call decoders to construct headers, the AVFrame is decoded with ffmpeg asynchronously
     void Decode();
 
     bool UsingDecodeOrder() const {
@@ -43,6 +46,10 @@ protected:
     explicit Decoder(Host1x::Host1x& host1x, s32 id, const Host1x::NvdecCommon::NvdecRegisters& regs);
 
     virtual std::span<const u8> ComposeFrame() = 0;
+
+    /// Sends a composed frame to ffmpeg and queues the decoded frames, runs on the decode worker
+    void DecodeFrame(std::span<const u8> packet_data, const FFmpeg::FrameOffsets& offsets,
+                     std::optional<FFmpeg::FrameDimensions> dimensions);
     virtual std::tuple<u64, u64> GetProgressiveOffsets() = 0;
     virtual std::tuple<u64, u64, u64, u64> GetInterlacedOffsets() = 0;
     virtual bool IsInterlaced() = 0;
@@ -60,6 +67,10 @@ protected:
     bool initialized : 1 = false;
     bool vp9_hidden_frame : 1 = false;
     std::optional<FFmpeg::FrameDimensions> frame_dimensions;
+
+    /// Decodes the composed frames in order, so the channel doesn't wait for ffmpeg. Declared
+    /// last so that it is destroyed before the state its work uses.
+    Common::ThreadWorker decode_worker{1, "NvdecDecode"};
 };
 
 } // namespace Tegra
@@ -23,6 +23,7 @@ extern "C" {
 #endif
 
 #include <libavutil/hwcontext.h>
+#include <libavutil/imgutils.h>
 }
 
 namespace FFmpeg {
@@ -31,6 +32,8 @@ namespace {
 
 constexpr AVPixelFormat PreferredGpuFormat = AV_PIX_FMT_NV12;
 constexpr AVPixelFormat PreferredCpuFormat = AV_PIX_FMT_YUV420P;
+/// Line alignment of downloaded frames, VIC reads them with aligned SSE loads
+constexpr int TransferFrameAlignment = 64;
 constexpr std::array PreferredGpuDecoders = {
 #if defined(_WIN32)
     AV_HWDEVICE_TYPE_CUDA,
@@ -288,6 +291,8 @@ DecoderContext::DecoderContext(const Decoder& decoder) : m_decoder{decoder} {
 }
 
 DecoderContext::~DecoderContext() {
+    // Buffers still referenced by queued frames keep the pool alive until they are released.
+    av_buffer_pool_uninit(&m_transfer_pool);
     av_buffer_unref(&m_codec_context->hw_device_ctx);
     avcodec_free_context(&m_codec_context);
 }
@@ -347,6 +352,8 @@ std::shared_ptr<Frame> DecoderContext::ReceiveFrame() {
     m_final_frame = std::make_shared<Frame>();
     if (m_codec_context->hw_device_ctx) {
         m_final_frame->SetFormat(PreferredGpuFormat);
+        // Without a pooled buffer the transfer allocates the destination itself.
+        AllocateTransferFrame(*m_final_frame, intermediate_frame->GetWidth(), intermediate_frame->GetHeight());
         if (const int ret = av_hwframe_transfer_data(m_final_frame->GetFrame(), intermediate_frame->GetFrame(), 0); ret < 0) {
             LOG_ERROR(HW_GPU, "av_hwframe_transfer_data error: {}", AVError(ret));
             return {};
@@ -358,6 +365,34 @@ std::shared_ptr<Frame> DecoderContext::ReceiveFrame() {
     return std::move(m_final_frame);
 }
 
+bool DecoderContext::AllocateTransferFrame(Frame& frame, int width, int height) {
+    const int size = av_image_get_buffer_size(PreferredGpuFormat, width, height, TransferFrameAlignment);
+    if (size <= 0) {
+        return false;
+    }
+    if (!m_transfer_pool || size != m_transfer_pool_size) {
+        av_buffer_pool_uninit(&m_transfer_pool);
+        m_transfer_pool = av_buffer_pool_init(size, nullptr);
+        m_transfer_pool_size = size;
+        if (!m_transfer_pool) {
+            return false;
+        }
+    }
+    AVBufferRef* buffer = av_buffer_pool_get(m_transfer_pool);
+    if (!buffer) {
+        return false;
+    }
+    AVFrame* const av_frame = frame.GetFrame();
+    if (av_image_fill_arrays(av_frame->data, av_frame->linesize, buffer->data, PreferredGpuFormat, width, height, TransferFrameAlignment) < 0) {
+        av_buffer_unref(&buffer);
+        return false;
+    }
+    av_frame->buf[0] = buffer;
+    av_frame->width = width;
+    av_frame->height = height;
+    return true;
+}
+
 void DecodeApi::Reset() {
     m_hardware_context.reset();
     m_decoder_context.reset();
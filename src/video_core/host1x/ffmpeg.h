@@ -24,6 +24,7 @@ extern "C" {
 
 #include <libavcodec/avcodec.h>
 #include <libavcodec/codec.h>
+#include <libavutil/buffer.h>
 #include <libavutil/opt.h>
 #include <libavutil/pixdesc.h>
 
@@ -192,9 +193,15 @@ public:
     }
 
 private:
+    /// Backs a frame with a buffer from the transfer pool, so hardware frames are downloaded into
+    /// memory that is already mapped instead of a fresh allocation per frame.
+    bool AllocateTransferFrame(Frame& frame, int width, int height);
+
     const Decoder& m_decoder;
     AVCodecContext* m_codec_context{};
     std::shared_ptr<Frame> m_final_frame{};
+    AVBufferPool* m_transfer_pool{};
+    int m_transfer_pool_size{};
     bool m_decode_order{};
 };
 
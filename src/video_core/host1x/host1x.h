@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <mutex>
 #include <ankerl/unordered_dense.h>
 #include <unordered_map>
 #include <variant>
@@ -84,6 +86,27 @@ public:
         }
     }
 
+    /// Counts a frame that is being decoded asynchronously
+    void BeginDecode() {
+        std::scoped_lock l{m_mutex};
+        ++m_pending_decodes;
+    }
+
+    /// Marks a frame counted by `BeginDecode` as decoded, after its output has been pushed
+    void EndDecode() {
+        {
+            std::scoped_lock l{m_mutex};
+            --m_pending_decodes;
+        }
+        m_decode_cv.notify_all();
+    }
+
+    /// Waits until the frames submitted so far have been decoded
+    void WaitForPendingDecodes() {
+        std::unique_lock l{m_mutex};
+        m_decode_cv.wait(l, [this] { return m_pending_decodes == 0; });
+    }
+
     std::shared_ptr<FFmpeg::Frame> GetFrame(s32 fd, u64 offset) {
         if (fd != -1) {
             std::scoped_lock l{m_mutex};
@@ -118,6 +141,8 @@ private:
     }
 
     std::mutex m_mutex{};
+    std::condition_variable m_decode_cv;
+    size_t m_pending_decodes{};
     ankerl::unordered_dense::map<s32, FrameDevice> m_frame_devices;
 
     static constexpr size_t MAX_PRESENT_QUEUE = 100;
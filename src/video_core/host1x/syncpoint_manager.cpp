@@ -11,93 +11,97 @@ namespace Tegra {
 namespace Host1x {
 
 SyncpointManager::ActionHandle SyncpointManager::RegisterAction(
-    std::atomic<u32>& syncpoint, std::list<RegisteredAction>& action_storage, u32 expected_value,
-    std::function<void()>&& action) {
-    if (syncpoint.load(std::memory_order_acquire) >= expected_value) {
+    Syncpoint& syncpoint, u32 expected_value, std::function<void()>&& action) {
+    if (syncpoint.value.load(std::memory_order_acquire) >= expected_value) {
         action();
         return {};
     }
 
-    std::scoped_lock lk(guard);
-    if (syncpoint.load(std::memory_order_relaxed) >= expected_value) {
+    std::scoped_lock lk(syncpoint.guard);
+    // Announce the action before checking the value again, so either this check sees a racing
+    // increment or that increment sees the action and waits for the lock
+    syncpoint.num_actions.fetch_add(1, std::memory_order_seq_cst);
+    if (syncpoint.value.load(std::memory_order_seq_cst) >= expected_value) {
+        syncpoint.num_actions.fetch_sub(1, std::memory_order_relaxed);
         action();
         return {};
     }
-    auto it = action_storage.begin();
-    while (it != action_storage.end()) {
+    auto it = syncpoint.actions.begin();
+    while (it != syncpoint.actions.end()) {
         if (it->expected_value >= expected_value) {
             break;
         }
         ++it;
     }
-    return action_storage.emplace(it, expected_value, std::move(action));
+    return syncpoint.actions.emplace(it, expected_value, std::move(action));
 }
 
-void SyncpointManager::DeregisterAction(std::list<RegisteredAction>& action_storage,
-                                        const ActionHandle& handle) {
-    std::scoped_lock lk(guard);
+void SyncpointManager::DeregisterAction(Syncpoint& syncpoint, const ActionHandle& handle) {
+    std::scoped_lock lk(syncpoint.guard);
 
     // We want to ensure the iterator still exists prior to erasing it
     // Otherwise, if an invalid iterator was passed in then it could lead to UB
     // It is important to avoid UB in that case since the deregister isn't called from a locked
     // context
-    for (auto it = action_storage.begin(); it != action_storage.end(); it++) {
+    for (auto it = syncpoint.actions.begin(); it != syncpoint.actions.end(); it++) {
         if (it == handle) {
-            action_storage.erase(it);
+            syncpoint.actions.erase(it);
+            syncpoint.num_actions.fetch_sub(1, std::memory_order_relaxed);
             return;
         }
     }
 }
 
 void SyncpointManager::DeregisterGuestAction(u32 syncpoint_id, const ActionHandle& handle) {
-    DeregisterAction(guest_action_storage[syncpoint_id], handle);
+    DeregisterAction(syncpoints_guest[syncpoint_id], handle);
 }
 
 void SyncpointManager::DeregisterHostAction(u32 syncpoint_id, const ActionHandle& handle) {
-    DeregisterAction(host_action_storage[syncpoint_id], handle);
+    DeregisterAction(syncpoints_host[syncpoint_id], handle);
 }
 
 void SyncpointManager::IncrementGuest(u32 syncpoint_id) {
-    Increment(syncpoints_guest[syncpoint_id], wait_guest_cv, guest_action_storage[syncpoint_id]);
+    Increment(syncpoints_guest[syncpoint_id]);
 }
 
 void SyncpointManager::IncrementHost(u32 syncpoint_id) {
-    Increment(syncpoints_host[syncpoint_id], wait_host_cv, host_action_storage[syncpoint_id]);
+    Increment(syncpoints_host[syncpoint_id]);
 }
 
 void SyncpointManager::WaitGuest(u32 syncpoint_id, u32 expected_value) {
-    Wait(syncpoints_guest[syncpoint_id], wait_guest_cv, expected_value);
+    Wait(syncpoints_guest[syncpoint_id], expected_value);
 }
 
 void SyncpointManager::WaitHost(u32 syncpoint_id, u32 expected_value) {
-    Wait(syncpoints_host[syncpoint_id], wait_host_cv, expected_value);
+    Wait(syncpoints_host[syncpoint_id], expected_value);
 }
 
-void SyncpointManager::Increment(std::atomic<u32>& syncpoint, std::condition_variable& wait_cv,
-                                 std::list<RegisteredAction>& action_storage) {
-    auto new_value{syncpoint.fetch_add(1, std::memory_order_acq_rel) + 1};
+void SyncpointManager::Increment(Syncpoint& syncpoint) {
+    const u32 new_value{syncpoint.value.fetch_add(1, std::memory_order_seq_cst) + 1};
+    // Wakes the threads blocked in Wait, this is a futex or WaitOnAddress on the common hosts
+    syncpoint.value.notify_all();
 
-    std::scoped_lock lk(guard);
-    auto it = action_storage.begin();
-    while (it != action_storage.end()) {
+    if (syncpoint.num_actions.load(std::memory_order_seq_cst) == 0) {
+        return;
+    }
+    std::scoped_lock lk(syncpoint.guard);
+    auto it = syncpoint.actions.begin();
+    while (it != syncpoint.actions.end()) {
         if (it->expected_value > new_value) {
             break;
         }
         it->action();
-        it = action_storage.erase(it);
+        it = syncpoint.actions.erase(it);
+        syncpoint.num_actions.fetch_sub(1, std::memory_order_relaxed);
     }
-    wait_cv.notify_all();
 }
 
-void SyncpointManager::Wait(std::atomic<u32>& syncpoint, std::condition_variable& wait_cv,
-                            u32 expected_value) {
-    const auto pred = [&]() { return syncpoint.load(std::memory_order_acquire) >= expected_value; };
-    if (pred()) {
-        return;
+void SyncpointManager::Wait(Syncpoint& syncpoint, u32 expected_value) {
+    u32 current = syncpoint.value.load(std::memory_order_acquire);
+    while (current < expected_value) {
+        syncpoint.value.wait(current, std::memory_order_acquire);
+        current = syncpoint.value.load(std::memory_order_acquire);
     }
-
-    std::unique_lock lk(guard);
-    wait_cv.wait(lk, pred);
 }
 
 } // namespace Host1x
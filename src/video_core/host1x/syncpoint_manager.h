@@ -5,7 +5,6 @@
 
 #include <array>
 #include <atomic>
-#include <condition_variable>
 #include <functional>
 #include <list>
 #include <mutex>
@@ -19,11 +18,11 @@ namespace Host1x {
 class SyncpointManager {
 public:
     u32 GetGuestSyncpointValue(u32 id) const {
-        return syncpoints_guest[id].load(std::memory_order_acquire);
+        return syncpoints_guest[id].value.load(std::memory_order_acquire);
     }
 
     u32 GetHostSyncpointValue(u32 id) const {
-        return syncpoints_host[id].load(std::memory_order_acquire);
+        return syncpoints_host[id].value.load(std::memory_order_acquire);
     }
 
     struct RegisteredAction {
@@ -36,14 +35,12 @@ public:
 
     template <typename Func>
     ActionHandle RegisterGuestAction(u32 syncpoint_id, u32 expected_value, Func&& action) {
-        return RegisterAction(syncpoints_guest[syncpoint_id], guest_action_storage[syncpoint_id],
-                              expected_value, std::move(action));
+        return RegisterAction(syncpoints_guest[syncpoint_id], expected_value, std::move(action));
     }
 
     template <typename Func>
     ActionHandle RegisterHostAction(u32 syncpoint_id, u32 expected_value, Func&& action) {
-        return RegisterAction(syncpoints_host[syncpoint_id], host_action_storage[syncpoint_id],
-                              expected_value, std::move(action));
+        return RegisterAction(syncpoints_host[syncpoint_id], expected_value, std::move(action));
     }
 
     void DeregisterGuestAction(u32 syncpoint_id, const ActionHandle& handle);
@@ -59,36 +56,37 @@ public:
     void WaitHost(u32 syncpoint_id, u32 expected_value);
 
     bool IsReadyGuest(u32 syncpoint_id, u32 expected_value) const {
-        return syncpoints_guest[syncpoint_id].load(std::memory_order_acquire) >= expected_value;
+        return syncpoints_guest[syncpoint_id].value.load(std::memory_order_acquire) >=
+               expected_value;
     }
 
     bool IsReadyHost(u32 syncpoint_id, u32 expected_value) const {
-        return syncpoints_host[syncpoint_id].load(std::memory_order_acquire) >= expected_value;
+        return syncpoints_host[syncpoint_id].value.load(std::memory_order_acquire) >=
+               expected_value;
     }
 
 private:
-    void Increment(std::atomic<u32>& syncpoint, std::condition_variable& wait_cv,
-                   std::list<RegisteredAction>& action_storage);
+    struct Syncpoint {
+        std::atomic<u32> value{};
+        /// Lets increments skip the lock when no action is registered
+        std::atomic<u32> num_actions{};
+        std::mutex guard;
+        std::list<RegisteredAction> actions;
+    };
+
+    void Increment(Syncpoint& syncpoint);
 
-    ActionHandle RegisterAction(std::atomic<u32>& syncpoint,
-                                std::list<RegisteredAction>& action_storage, u32 expected_value,
+    ActionHandle RegisterAction(Syncpoint& syncpoint, u32 expected_value,
                                 std::function<void()>&& action);
 
-    void DeregisterAction(std::list<RegisteredAction>& action_storage, const ActionHandle& handle);
+    void DeregisterAction(Syncpoint& syncpoint, const ActionHandle& handle);
 
-    void Wait(std::atomic<u32>& syncpoint, std::condition_variable& wait_cv, u32 expected_value);
+    void Wait(Syncpoint& syncpoint, u32 expected_value);
 
     static constexpr size_t NUM_MAX_SYNCPOINTS = 192;
 
-    std::array<std::atomic<u32>, NUM_MAX_SYNCPOINTS> syncpoints_guest{};
-    std::array<std::atomic<u32>, NUM_MAX_SYNCPOINTS> syncpoints_host{};
-
-    std::array<std::list<RegisteredAction>, NUM_MAX_SYNCPOINTS> guest_action_storage;
-    std::array<std::list<RegisteredAction>, NUM_MAX_SYNCPOINTS> host_action_storage;
-
-    std::mutex guard;
-    std::condition_variable wait_guest_cv;
-    std::condition_variable wait_host_cv;
+    std::array<Syncpoint, NUM_MAX_SYNCPOINTS> syncpoints_guest{};
+    std::array<Syncpoint, NUM_MAX_SYNCPOINTS> syncpoints_host{};
 };
 
 } // namespace Host1x
@@ -10,6 +10,7 @@
 
 #include "common/common_types.h"
 #include "common/scratch_buffer.h"
+#include "common/thread_worker.h"
 #include "video_core/cdma_pusher.h"
 #include "video_core/host1x/ffmpeg.h"
 
@@ -618,6 +619,10 @@ private:
     void WriteY8__V8U8_N420(const OutputSurfaceConfig& output_surface_config) noexcept;
     void WriteABGR(const OutputSurfaceConfig& output_surface_config, VideoPixelFormat format) noexcept;
 
+    /// Calls func(first_row, last_row) over the rows [begin, end), split across the row workers.
+    template <typename Func>
+    void ForEachRowRange(u32 begin, u32 end, Func&& func) noexcept;
+
     VicRegisters regs{};
 
     Common::ScratchBuffer<u8> swizzle_scratch;
@@ -630,6 +635,9 @@ private:
     s32 nvdec_id{-1};
     bool has_decoded_frame{};
     u32 syncpoint;
+
+    size_t num_row_workers;
+    Common::ThreadWorker row_workers;
 };
 
 } // namespace Tegra::Host1x
@@ -0,0 +1,40 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Draws the frame halfway between the previous and the current frame, moving both halfway along
+// the motion estimated for their blocks.
+
+#version 450
+
+layout(binding = 0) uniform sampler2D prev_frame;
+layout(binding = 1) uniform sampler2D cur_frame;
+layout(binding = 2) uniform sampler2D motion_field;
+
+layout(location = 0) out vec4 color;
+
+const float BLOCK_SIZE = 16.0;
+// Blocks that matched worse than this are treated as not found in the previous frame
+const float MAX_BLOCK_COST = 0.08;
+
+float Luma(vec3 value) {
+    return dot(value, vec3(0.299, 0.587, 0.114));
+}
+
+void main() {
+    const vec2 pos = gl_FragCoord.xy;
+    const vec2 inv_size = 1.0 / vec2(textureSize(cur_frame, 0));
+    // The motion of a block is stored for its center, filter it between the neighbouring blocks
+    const vec2 motion_size = vec2(textureSize(motion_field, 0)) * BLOCK_SIZE;
+    const vec4 motion = textureLod(motion_field, pos / motion_size, 0);
+    const vec2 half_motion = motion.xy * 0.5;
+
+    const vec4 from_prev = textureLod(prev_frame, (pos + half_motion) * inv_size, 0);
+    const vec4 from_cur = textureLod(cur_frame, (pos - half_motion) * inv_size, 0);
+    const vec4 interpolated = mix(from_prev, from_cur, 0.5);
+
+    // Where the motion is unreliable the current frame looks better than a ghosted blend
+    const float block_mismatch = smoothstep(0.5 * MAX_BLOCK_COST, MAX_BLOCK_COST, motion.z);
+    const float pixel_mismatch = smoothstep(0.1, 0.3, Luma(abs(from_prev.rgb - from_cur.rgb)));
+    const vec4 current = textureLod(cur_frame, pos * inv_size, 0);
+    color = mix(interpolated, current, max(block_mismatch, pixel_mismatch));
+}
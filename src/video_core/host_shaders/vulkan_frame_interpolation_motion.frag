@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Estimates the motion of each block of the current frame from the previous frame, with a
+// logarithmic search over the luma of the two frames. Each fragment is one block.
+
+#version 450
+
+layout(binding = 0) uniform sampler2D prev_frame;
+layout(binding = 1) uniform sampler2D cur_frame;
+
+layout(location = 0) out vec4 motion;
+
+const float BLOCK_SIZE = 16.0;
+// Distance between the points of a block that are compared, each one averages 2x2 texels
+const float SAMPLE_SPACING = 4.0;
+const int SAMPLES_PER_SIDE = 4;
+const int NUM_SAMPLES = SAMPLES_PER_SIDE * SAMPLES_PER_SIDE;
+// Largest search step in pixels, the search covers twice as far
+const float FIRST_STEP = 16.0;
+// Keeps still blocks with flat contents from picking a random motion
+const float ZERO_MOTION_BIAS = 0.002;
+
+float Luma(vec3 color) {
+    return dot(color, vec3(0.299, 0.587, 0.114));
+}
+
+float cur_luma[NUM_SAMPLES];
+
+float BlockCost(vec2 origin, vec2 offset, vec2 inv_size) {
+    float cost = 0.0;
+    for (int i = 0; i < NUM_SAMPLES; i++) {
+        const vec2 point = origin + vec2(i % SAMPLES_PER_SIDE, i / SAMPLES_PER_SIDE) *
+                                        SAMPLE_SPACING + SAMPLE_SPACING * 0.5;
+        cost += abs(cur_luma[i] - Luma(textureLod(prev_frame, (point + offset) * inv_size, 0).rgb));
+    }
+    return cost / float(NUM_SAMPLES);
+}
+
+void main() {
+    const vec2 inv_size = 1.0 / vec2(textureSize(cur_frame, 0));
+    const vec2 origin = floor(gl_FragCoord.xy) * BLOCK_SIZE;
+    for (int i = 0; i < NUM_SAMPLES; i++) {
+        const vec2 point = origin + vec2(i % SAMPLES_PER_SIDE, i / SAMPLES_PER_SIDE) *
+                                        SAMPLE_SPACING + SAMPLE_SPACING * 0.5;
+        cur_luma[i] = Luma(textureLod(cur_frame, point * inv_size, 0).rgb);
+    }
+
+    vec2 best_offset = vec2(0.0);
+    float best_cost = BlockCost(origin, best_offset, inv_size) - ZERO_MOTION_BIAS;
+    for (float step_size = FIRST_STEP; step_size >= 1.0; step_size *= 0.5) {
+        const vec2 center = best_offset;
+        for (int y = -1; y <= 1; y++) {
+            for (int x = -1; x <= 1; x++) {
+                if (x == 0 && y == 0) {
+                    continue;
+                }
+                const vec2 offset = center + vec2(x, y) * step_size;
+                const float cost = BlockCost(origin, offset, inv_size);
+                if (cost < best_cost) {
+                    best_cost = cost;
+                    best_offset = offset;
+                }
+            }
+        }
+    }
+    // Offset from the current frame to the previous one, and how well the block matched there
+    motion = vec4(best_offset, max(best_cost, 0.0), 1.0);
+}
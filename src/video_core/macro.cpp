@@ -4,6 +4,7 @@
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <cstring>
 #include <fstream>
 #include <optional>
@@ -15,12 +16,18 @@
 #ifdef ARCHITECTURE_x86_64
 #include "common/x64/xbyak.h"
 #endif
+#ifdef ARCHITECTURE_arm64
+#include <oaknut/code_block.hpp>
+#include <oaknut/oaknut.hpp>
+#include "common/alignment.h"
+#endif
 
 #include "common/assert.h"
 #include "common/scope_exit.h"
 #include "common/fs/fs.h"
 #include "common/fs/path_util.h"
 #include "common/settings.h"
+#include "common/trace.h"
 #include "common/container_hash.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/engines/maxwell_3d.h"
@@ -37,6 +44,10 @@ namespace Tegra {
 
 using Maxwell3D = Engines::Maxwell3D;
 
+/// Versioned per-title list of uploaded macro code, precompiled on the next boot.
+constexpr u32 MACRO_CACHE_VERSION = 1;
+constexpr std::array<char, 8> MACRO_CACHE_MAGIC_NUMBER{'y', 'u', 'z', 'u', 'm', 'a', 'c', 'r'};
+
 namespace {
 
 bool IsTopologySafe(Maxwell3D::Regs::PrimitiveTopology topology) {
@@ -328,6 +339,7 @@ void HLE_BindShader::Execute(Core::System& system, Engines::Maxwell3D& maxwell3d
     maxwell3d.dirty.flags[VideoCommon::Dirty::Shaders] = true;
     regs.shadow_scratch[28 + index] = parameters[1];
     regs.shadow_scratch[34 + index] = parameters[2];
+    maxwell3d.Rasterizer().PrefetchShaderProgram(index & 0xF);
 
     const u32 address = parameters[4];
     auto& const_buffer = regs.const_buffer;
@@ -1327,6 +1339,404 @@ Macro::Opcode MacroJITx64Impl::GetOpCode() const {
 } // Anonymous namespace
 #endif
 
+#ifdef ARCHITECTURE_arm64
+namespace {
+using namespace oaknut::util;
+
+// All of these are callee saved, so they survive the calls into Maxwell3D
+constexpr oaknut::XReg STATE = X19;
+constexpr oaknut::XReg PARAMETERS = X20;
+constexpr oaknut::XReg MAX_PARAMETER = X21;
+constexpr oaknut::WReg METHOD_ADDRESS = W22;
+constexpr oaknut::WReg CARRY = W23;
+constexpr oaknut::WReg RESULT = W24;
+// Scratch registers, clobbered by calls
+constexpr oaknut::WReg SCRATCH0 = W8;
+constexpr oaknut::WReg SCRATCH1 = W9;
+constexpr oaknut::XReg CALL_TARGET = X16;
+
+// Upper bound of host instructions emitted for a single macro instruction, a macro instruction
+// may be emitted up to three times when it sits in the delay slot of a branch with the exit bit.
+constexpr size_t MAX_HOST_INSTRUCTIONS_PER_OP = 64 * 3;
+
+static void MacroJITArm64_SendThunk(Core::System* system, Engines::Maxwell3D* maxwell3d, u32 method_address, u32 value) {
+    maxwell3d->CallMethod(*system, Macro::MethodAddress{method_address}.address, value, true);
+}
+
+static void MacroJITArm64_ErrorThunk(uintptr_t parameter, uintptr_t max_parameter) {
+    LOG_CRITICAL(HW_GPU, "Macro JIT: invalid parameter access 0x{:x} (0x{:x} is the last parameter)", parameter, max_parameter - sizeof(u32));
+}
+
+/// @brief AArch64 code generator for GPU macros, mirrors the semantics of MacroInterpreterImpl.
+/// Delay slots are handled statically: the instruction following a taken branch (or an exit) is
+/// emitted again inline on that path, so no runtime branch holder is needed.
+struct MacroJITArm64Impl final : public DynamicCachedMacro {
+    explicit MacroJITArm64Impl(std::span<const u32> code_)
+        : mem{Common::AlignUp((code_.size() + 16) * MAX_HOST_INSTRUCTIONS_PER_OP * sizeof(u32), 4096)}
+        , c{mem.ptr(), mem.ptr()}
+        , code{code_}
+    {
+        Compile();
+    }
+
+    void Execute(Core::System& system, Engines::Maxwell3D& maxwell3d, std::span<const u32> parameters, u32 method) override;
+
+    void Compile();
+    void Compile_Instruction(u32 index, bool is_delay_slot);
+    void Compile_ALU(Macro::Opcode opcode);
+    void Compile_AddImmediate(Macro::Opcode opcode);
+    void Compile_ExtractInsert(Macro::Opcode opcode);
+    void Compile_ExtractShiftLeftImmediate(Macro::Opcode opcode);
+    void Compile_ExtractShiftLeftRegister(Macro::Opcode opcode);
+    void Compile_Read(Macro::Opcode opcode);
+    void Compile_Branch(u32 index, Macro::Opcode opcode);
+    void Compile_ProcessResult(Macro::ResultOperation operation, u32 reg);
+    void Compile_Send(oaknut::WReg value);
+    oaknut::WReg Compile_FetchParameter();
+    oaknut::WReg Compile_GetRegister(u32 index, oaknut::WReg dst);
+    void Compile_SetRegister(u32 index, oaknut::WReg src);
+    /// Emits RESULT = $src + immediate
+    void Compile_SourcePlusImmediate(u32 src_index, s32 immediate);
+
+    struct JITState {
+        Engines::Maxwell3D* maxwell3d = nullptr;
+        Core::System* system = nullptr;
+        std::array<u32, Macro::NUM_MACRO_REGISTERS> registers{};
+    };
+    using ProgramType = void (*)(JITState*, const u32*, const u32*);
+
+    oaknut::CodeBlock mem;
+    oaknut::CodeGenerator c;
+    std::unique_ptr<oaknut::Label[]> labels;
+    oaknut::Label end_of_code;
+    std::span<const u32> code;
+    ProgramType program{nullptr};
+    bool can_skip_carry{};
+};
+
+void MacroJITArm64Impl::Execute(Core::System& system, Engines::Maxwell3D& maxwell3d, std::span<const u32> parameters, u32 method) {
+    ASSERT_OR_EXECUTE(program != nullptr, { return; });
+    JITState state{};
+    state.maxwell3d = &maxwell3d;
+    state.system = &system;
+    program(&state, parameters.data(), parameters.data() + parameters.size());
+}
+
+void MacroJITArm64Impl::Compile() {
+    // The carry flag only needs to be materialized if something consumes it
+    can_skip_carry = std::ranges::none_of(code, [](u32 raw) {
+        const Macro::Opcode op{raw};
+        return op.operation == Macro::Operation::ALU &&
+               (op.alu_operation == Macro::ALUOperation::AddWithCarry ||
+                op.alu_operation == Macro::ALUOperation::SubtractWithBorrow);
+    });
+    labels = std::make_unique<oaknut::Label[]>(code.size());
+
+    mem.unprotect();
+    program = c.xptr<ProgramType>();
+    c.STP(X29, X30, SP, PRE_INDEXED, -64);
+    c.STP(STATE, PARAMETERS, SP, 16);
+    c.STP(MAX_PARAMETER, X22, SP, 32);
+    c.STP(X23, X24, SP, 48);
+    c.MOV(STATE, X0);
+    c.MOV(PARAMETERS, X1);
+    c.MOV(MAX_PARAMETER, X2);
+    c.MOV(METHOD_ADDRESS, WZR);
+    c.MOV(CARRY, WZR);
+    c.MOV(RESULT, WZR);
+    // $r1 always starts with the first parameter
+    Compile_SetRegister(1, Compile_FetchParameter());
+
+    for (u32 i = 0; i < u32(code.size()); ++i) {
+        c.l(labels[i]);
+        Compile_Instruction(i, false);
+    }
+
+    c.l(end_of_code);
+    c.LDP(X23, X24, SP, 48);
+    c.LDP(MAX_PARAMETER, X22, SP, 32);
+    c.LDP(STATE, PARAMETERS, SP, 16);
+    c.LDP(X29, X30, SP, POST_INDEXED, 64);
+    c.RET();
+    mem.protect();
+    mem.invalidate_all();
+}
+
+void MacroJITArm64Impl::Compile_Instruction(u32 index, bool is_delay_slot) {
+    const Macro::Opcode opcode{code[index]};
+    switch (opcode.operation) {
+    case Macro::Operation::ALU:
+        Compile_ALU(opcode);
+        break;
+    case Macro::Operation::AddImmediate:
+        Compile_AddImmediate(opcode);
+        break;
+    case Macro::Operation::ExtractInsert:
+        Compile_ExtractInsert(opcode);
+        break;
+    case Macro::Operation::ExtractShiftLeftImmediate:
+        Compile_ExtractShiftLeftImmediate(opcode);
+        break;
+    case Macro::Operation::ExtractShiftLeftRegister:
+        Compile_ExtractShiftLeftRegister(opcode);
+        break;
+    case Macro::Operation::Read:
+        Compile_Read(opcode);
+        break;
+    case Macro::Operation::Branch:
+        ASSERT_MSG(!is_delay_slot, "Executing a branch in a delay slot is not valid");
+        Compile_Branch(index, opcode);
+        break;
+    default:
+        UNIMPLEMENTED_MSG("Unimplemented opcode {}", opcode.operation.Value());
+        break;
+    }
+    // An instruction with the exit flag doesn't exit when it's inside a delay slot
+    if (opcode.is_exit && !is_delay_slot) {
+        // Exit has a delay slot, execute the next instruction
+        if (index + 1 < code.size()) {
+            Compile_Instruction(index + 1, true);
+        }
+        c.B(end_of_code);
+    }
+}
+
+void MacroJITArm64Impl::Compile_ALU(Macro::Opcode opcode) {
+    const auto src_a = Compile_GetRegister(opcode.src_a, RESULT);
+    const auto src_b = Compile_GetRegister(opcode.src_b, SCRATCH0);
+    switch (opcode.alu_operation) {
+    case Macro::ALUOperation::Add:
+        if (can_skip_carry) {
+            c.ADD(RESULT, src_a, src_b);
+        } else {
+            c.ADDS(RESULT, src_a, src_b);
+            c.CSET(CARRY, CS);
+        }
+        break;
+    case Macro::ALUOperation::AddWithCarry:
+        // Sets the host carry flag when CARRY is non-zero
+        c.CMP(CARRY, 1);
+        c.ADCS(RESULT, src_a, src_b);
+        c.CSET(CARRY, CS);
+        break;
+    case Macro::ALUOperation::Subtract:
+        // The host carry flag is the inverse of borrow, same as the macro carry flag
+        if (can_skip_carry) {
+            c.SUB(RESULT, src_a, src_b);
+        } else {
+            c.SUBS(RESULT, src_a, src_b);
+            c.CSET(CARRY, CS);
+        }
+        break;
+    case Macro::ALUOperation::SubtractWithBorrow:
+        c.CMP(CARRY, 1);
+        c.SBCS(RESULT, src_a, src_b);
+        c.CSET(CARRY, CS);
+        break;
+    case Macro::ALUOperation::Xor:
+        c.EOR(RESULT, src_a, src_b);
+        break;
+    case Macro::ALUOperation::Or:
+        c.ORR(RESULT, src_a, src_b);
+        break;
+    case Macro::ALUOperation::And:
+        c.AND(RESULT, src_a, src_b);
+        break;
+    case Macro::ALUOperation::AndNot:
+        c.BIC(RESULT, src_a, src_b);
+        break;
+    case Macro::ALUOperation::Nand:
+        c.AND(RESULT, src_a, src_b);
+        c.MVN(RESULT, RESULT);
+        break;
+    default:
+        UNIMPLEMENTED_MSG("Unimplemented ALU operation {}", opcode.alu_operation.Value());
+        break;
+    }
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void MacroJITArm64Impl::Compile_AddImmediate(Macro::Opcode opcode) {
+    // Games tend to use this as an exit instruction placeholder, nothing to emit.
+    if (opcode.result_operation == Macro::ResultOperation::Move && opcode.dst == 0) {
+        return;
+    }
+    Compile_SourcePlusImmediate(opcode.src_a, opcode.immediate);
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void MacroJITArm64Impl::Compile_ExtractInsert(Macro::Opcode opcode) {
+    const auto dst = Compile_GetRegister(opcode.src_a, RESULT);
+    const auto src = Compile_GetRegister(opcode.src_b, SCRATCH0);
+    const u32 mask = opcode.GetBitfieldMask();
+    // dst = (dst & ~(mask << dst_bit)) | (((src >> src_bit) & mask) << dst_bit)
+    c.LSR(SCRATCH0, src, u32(opcode.bf_src_bit));
+    c.MOV(SCRATCH1, mask);
+    c.AND(SCRATCH0, SCRATCH0, SCRATCH1);
+    c.MOV(SCRATCH1, mask << opcode.bf_dst_bit);
+    c.BIC(RESULT, dst, SCRATCH1);
+    c.ORR(RESULT, RESULT, SCRATCH0, LSL, u32(opcode.bf_dst_bit));
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void MacroJITArm64Impl::Compile_ExtractShiftLeftImmediate(Macro::Opcode opcode) {
+    const auto dst = Compile_GetRegister(opcode.src_a, SCRATCH0);
+    const auto src = Compile_GetRegister(opcode.src_b, RESULT);
+    c.LSR(RESULT, src, dst);
+    c.MOV(SCRATCH1, opcode.GetBitfieldMask());
+    c.AND(RESULT, RESULT, SCRATCH1);
+    c.LSL(RESULT, RESULT, u32(opcode.bf_dst_bit));
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void MacroJITArm64Impl::Compile_ExtractShiftLeftRegister(Macro::Opcode opcode) {
+    const auto dst = Compile_GetRegister(opcode.src_a, SCRATCH0);
+    const auto src = Compile_GetRegister(opcode.src_b, RESULT);
+    c.LSR(RESULT, src, u32(opcode.bf_src_bit));
+    c.MOV(SCRATCH1, opcode.GetBitfieldMask());
+    c.AND(RESULT, RESULT, SCRATCH1);
+    c.LSL(RESULT, RESULT, dst);
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void MacroJITArm64Impl::Compile_Read(Macro::Opcode opcode) {
+    Compile_SourcePlusImmediate(opcode.src_a, opcode.immediate);
+    // Equivalent to Engines::Maxwell3D::GetRegisterValue
+    c.LDR(X8, STATE, offsetof(JITState, maxwell3d));
+    c.MOV(X9, offsetof(Engines::Maxwell3D, regs) + offsetof(Engines::Maxwell3D::Regs, reg_array));
+    c.ADD(X8, X8, X9);
+    c.LDR(RESULT, X8, RESULT, oaknut::IndexExt::UXTW, 2);
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void MacroJITArm64Impl::Compile_Branch(u32 index, Macro::Opcode opcode) {
+    const s32 jump_address = s32(index) + s32(opcode.GetBranchTarget() / sizeof(s32));
+    ASSERT_MSG(jump_address >= 0 && u32(jump_address) <= code.size(), "Macro branch out of bounds");
+    oaknut::Label& target = u32(jump_address) < code.size() ? labels[jump_address] : end_of_code;
+    const auto value = Compile_GetRegister(opcode.src_a, SCRATCH0);
+    if (opcode.branch_annul) {
+        // No delay slot, branch straight to the target
+        if (opcode.branch_condition == Macro::BranchCondition::Zero) {
+            c.CBZ(value, target);
+        } else {
+            c.CBNZ(value, target);
+        }
+        return;
+    }
+    oaknut::Label not_taken;
+    if (opcode.branch_condition == Macro::BranchCondition::Zero) {
+        c.CBNZ(value, not_taken);
+    } else {
+        c.CBZ(value, not_taken);
+    }
+    if (index + 1 < code.size()) {
+        Compile_Instruction(index + 1, true);
+    }
+    c.B(target);
+    c.l(not_taken);
+}
+
+void MacroJITArm64Impl::Compile_ProcessResult(Macro::ResultOperation operation, u32 reg) {
+    switch (operation) {
+    case Macro::ResultOperation::IgnoreAndFetch:
+        Compile_SetRegister(reg, Compile_FetchParameter());
+        break;
+    case Macro::ResultOperation::Move:
+        Compile_SetRegister(reg, RESULT);
+        break;
+    case Macro::ResultOperation::MoveAndSetMethod:
+        Compile_SetRegister(reg, RESULT);
+        c.MOV(METHOD_ADDRESS, RESULT);
+        break;
+    case Macro::ResultOperation::FetchAndSend:
+        Compile_SetRegister(reg, Compile_FetchParameter());
+        Compile_Send(RESULT);
+        break;
+    case Macro::ResultOperation::MoveAndSend:
+        Compile_SetRegister(reg, RESULT);
+        Compile_Send(RESULT);
+        break;
+    case Macro::ResultOperation::FetchAndSetMethod:
+        Compile_SetRegister(reg, Compile_FetchParameter());
+        c.MOV(METHOD_ADDRESS, RESULT);
+        break;
+    case Macro::ResultOperation::MoveAndSetMethodFetchAndSend:
+        Compile_SetRegister(reg, RESULT);
+        c.MOV(METHOD_ADDRESS, RESULT);
+        Compile_Send(Compile_FetchParameter());
+        break;
+    case Macro::ResultOperation::MoveAndSetMethodSend:
+        Compile_SetRegister(reg, RESULT);
+        c.MOV(METHOD_ADDRESS, RESULT);
+        c.UBFX(RESULT, RESULT, 12, 6);
+        Compile_Send(RESULT);
+        break;
+    default:
+        UNIMPLEMENTED_MSG("Unimplemented macro operation {}", operation);
+        break;
+    }
+}
+
+void MacroJITArm64Impl::Compile_Send(oaknut::WReg value) {
+    c.MOV(W3, value);
+    c.MOV(W2, METHOD_ADDRESS);
+    c.LDR(X1, STATE, offsetof(JITState, maxwell3d));
+    c.LDR(X0, STATE, offsetof(JITState, system));
+    c.MOV(CALL_TARGET, reinterpret_cast<u64>(&MacroJITArm64_SendThunk));
+    c.BLR(CALL_TARGET);
+    // Increment the method address by the method increment, wrapping within its 12 bits
+    c.UBFX(SCRATCH0, METHOD_ADDRESS, 12, 6);
+    c.ADD(SCRATCH0, METHOD_ADDRESS, SCRATCH0);
+    c.BFI(METHOD_ADDRESS, SCRATCH0, 0, 12);
+}
+
+oaknut::WReg MacroJITArm64Impl::Compile_FetchParameter() {
+    oaknut::Label parameter_ok;
+    c.CMP(PARAMETERS, MAX_PARAMETER);
+    c.B(LO, parameter_ok);
+    c.MOV(X0, PARAMETERS);
+    c.MOV(X1, MAX_PARAMETER);
+    c.MOV(CALL_TARGET, reinterpret_cast<u64>(&MacroJITArm64_ErrorThunk));
+    c.BLR(CALL_TARGET);
+    c.l(parameter_ok);
+    c.LDR(SCRATCH1, PARAMETERS, POST_INDEXED, 4);
+    return SCRATCH1;
+}
+
+oaknut::WReg MacroJITArm64Impl::Compile_GetRegister(u32 index, oaknut::WReg dst) {
+    if (index == 0) {
+        // Register 0 is always zero
+        return WZR;
+    }
+    c.LDR(dst, STATE, offsetof(JITState, registers) + index * sizeof(u32));
+    return dst;
+}
+
+void MacroJITArm64Impl::Compile_SetRegister(u32 index, oaknut::WReg src) {
+    // Register 0 is hardwired as the zero register, NOP is implemented as a store to it
+    if (index != 0) {
+        c.STR(src, STATE, offsetof(JITState, registers) + index * sizeof(u32));
+    }
+}
+
+void MacroJITArm64Impl::Compile_SourcePlusImmediate(u32 src_index, s32 immediate) {
+    if (src_index == 0) {
+        c.MOV(RESULT, u32(immediate));
+        return;
+    }
+    const auto src = Compile_GetRegister(src_index, RESULT);
+    if (immediate > 0 && immediate < 0x1000) {
+        c.ADD(RESULT, src, u32(immediate));
+    } else if (immediate < 0 && -immediate < 0x1000) {
+        c.SUB(RESULT, src, u32(-immediate));
+    } else if (immediate != 0) {
+        c.MOV(SCRATCH1, u32(immediate));
+        c.ADD(RESULT, src, SCRATCH1);
+    }
+}
+} // Anonymous namespace
+#endif
+
 static void Dump(u64 hash, std::span<const u32> code, bool decompiled = false) {
     const auto dump_dir{Common::FS::GetEdenPath(Common::FS::EdenPath::DumpDir)};
     if (!Common::FS::CreateDir(dump_dir)) {
@@ -1346,6 +1756,7 @@ static void Dump(u64 hash, std::span<const u32> code, bool decompiled = false) {
 }
 
 void MacroEngine::Execute(Core::System& system, Engines::Maxwell3D& maxwell3d, u32 method, std::span<const u32> parameters) {
+    TRACE_SCOPE("Macro");
     auto const execute_variant = [&system, &maxwell3d, &parameters, method](AnyCachedMacro& acm) {
         if (auto a = std::get_if<HLE_DrawArraysIndirect>(&acm))
             return a->Execute(system, maxwell3d, parameters, method);
@@ -1373,7 +1784,7 @@ void MacroEngine::Execute(Core::System& system, Engines::Maxwell3D& maxwell3d, u
             return a->Execute(system, maxwell3d, parameters, method);
         if (auto a = std::get_if<MacroInterpreterImpl>(&acm))
             return a->Execute(system, maxwell3d, parameters, method);
-        if (auto a = std::get_if<std::unique_ptr<DynamicCachedMacro>>(&acm))
+        if (auto a = std::get_if<std::shared_ptr<DynamicCachedMacro>>(&acm))
             return a->get()->Execute(system, maxwell3d, parameters, method);
     };
     if (auto const it = macro_cache.find(method); it != macro_cache.end()) {
@@ -1397,6 +1808,9 @@ void MacroEngine::Execute(Core::System& system, Engines::Maxwell3D& maxwell3d, u
                 return;
             }
         }
+        if (!disk_cache_loaded) {
+            LoadDiskCache(system, maxwell3d);
+        }
         auto& ci = macro_cache[method];
         if (mid_method) {
             const auto& macro_cached = uploaded_macro_code[mid_method.value()];
@@ -1405,14 +1819,12 @@ void MacroEngine::Execute(Core::System& system, Engines::Maxwell3D& maxwell3d, u
             code.resize(macro_cached.size() - rebased_method);
             std::memcpy(code.data(), macro_cached.data() + rebased_method, code.size() * sizeof(u32));
             ci.hash = Common::HashValue(code);
-            ci.program = Compile(system, maxwell3d, code);
+            ci.program = GetProgram(system, maxwell3d, code, ci.hash);
         } else {
-            ci.program = Compile(system, maxwell3d, macro_code->second);
             ci.hash = Common::HashValue(macro_code->second);
+            ci.program = GetProgram(system, maxwell3d, macro_code->second, ci.hash);
         }
-        if (CanBeHLEProgram(ci.hash) && !Settings::values.disable_macro_hle) {
-            ci.program = GetHLEProgram(ci.hash);
-        } else {
+        if (!CanBeHLEProgram(ci.hash) || Settings::values.disable_macro_hle) {
             maxwell3d.RefreshParameters();
         }
         execute_variant(ci.program);
@@ -1425,9 +1837,108 @@ void MacroEngine::Execute(Core::System& system, Engines::Maxwell3D& maxwell3d, u
 AnyCachedMacro MacroEngine::Compile(Core::System& system, Engines::Maxwell3D& maxwell3d, std::span<const u32> code) {
 #ifdef ARCHITECTURE_x86_64
     if (!is_interpreted)
-        return std::make_unique<MacroJITx64Impl>(system, code);
+        return std::make_shared<MacroJITx64Impl>(system, code);
+#elif defined(ARCHITECTURE_arm64)
+    if (!is_interpreted)
+        return std::make_shared<MacroJITArm64Impl>(code);
 #endif
     return MacroInterpreterImpl(code);
 }
 
+AnyCachedMacro MacroEngine::GetProgram(Core::System& system, Engines::Maxwell3D& maxwell3d, std::span<const u32> code, u64 hash) {
+    // HLE programs don't need the code compiled at all
+    if (CanBeHLEProgram(hash) && !Settings::values.disable_macro_hle)
+        return GetHLEProgram(hash);
+    if (auto const it = compiled_programs.find(hash); it != compiled_programs.end())
+        return it->second;
+    AnyCachedMacro program = Compile(system, maxwell3d, code);
+    if (auto const jit = std::get_if<std::shared_ptr<DynamicCachedMacro>>(&program)) {
+        compiled_programs.emplace(hash, *jit);
+        SaveToDiskCache(hash, code);
+    }
+    return program;
+}
+
+void MacroEngine::LoadDiskCache(Core::System& system, Engines::Maxwell3D& maxwell3d) try {
+    disk_cache_loaded = true;
+    const u64 title_id = Settings::GetCurrentProgramID();
+    if (is_interpreted || title_id == 0 || !Settings::values.use_disk_shader_cache.GetValue()) {
+        return;
+    }
+    const auto shader_dir{Common::FS::GetEdenPath(Common::FS::EdenPath::ShaderDir)};
+    const auto base_dir{shader_dir / fmt::format("{:016x}", title_id)};
+    if (!Common::FS::CreateDir(shader_dir) || !Common::FS::CreateDir(base_dir)) {
+        LOG_ERROR(Common_Filesystem, "Failed to create macro cache directories");
+        return;
+    }
+    disk_cache_filename = base_dir / "macros.bin";
+
+    std::ifstream file(disk_cache_filename, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return;
+    }
+    file.exceptions(std::ifstream::failbit);
+    const auto end{file.tellg()};
+    file.seekg(0, std::ios::beg);
+
+    std::array<char, 8> magic_number;
+    u32 cache_version;
+    file.read(magic_number.data(), magic_number.size())
+        .read(reinterpret_cast<char*>(&cache_version), sizeof(cache_version));
+    if (magic_number != MACRO_CACHE_MAGIC_NUMBER || cache_version != MACRO_CACHE_VERSION) {
+        file.close();
+        LOG_INFO(Common_Filesystem, "Deleting old macro cache");
+        Common::FS::RemoveFile(disk_cache_filename);
+        return;
+    }
+    std::vector<u32> code;
+    while (file.tellg() != end) {
+        u64 hash{};
+        u32 code_size{};
+        file.read(reinterpret_cast<char*>(&hash), sizeof(hash))
+            .read(reinterpret_cast<char*>(&code_size), sizeof(code_size));
+        code.resize(code_size);
+        file.read(reinterpret_cast<char*>(code.data()), code.size() * sizeof(u32));
+        if (Common::HashValue(code) != hash || compiled_programs.contains(hash)) {
+            continue;
+        }
+        AnyCachedMacro program = Compile(system, maxwell3d, code);
+        if (auto const jit = std::get_if<std::shared_ptr<DynamicCachedMacro>>(&program)) {
+            compiled_programs.emplace(hash, *jit);
+        }
+    }
+    LOG_INFO(HW_GPU, "Precompiled {} macros from disk cache", compiled_programs.size());
+} catch (const std::ios_base::failure& e) {
+    LOG_ERROR(Common_Filesystem, "{}", e.what());
+    if (!Common::FS::RemoveFile(disk_cache_filename)) {
+        LOG_ERROR(Common_Filesystem, "Failed to delete macro cache file {}",
+                  Common::FS::PathToUTF8String(disk_cache_filename));
+    }
+}
+
+void MacroEngine::SaveToDiskCache(u64 hash, std::span<const u32> code) try {
+    if (disk_cache_filename.empty()) {
+        return;
+    }
+    std::ofstream file(disk_cache_filename, std::ios::binary | std::ios::ate | std::ios::app);
+    file.exceptions(std::ifstream::failbit);
+    if (!file.is_open()) {
+        LOG_ERROR(Common_Filesystem, "Failed to open macro cache file {}",
+                  Common::FS::PathToUTF8String(disk_cache_filename));
+        return;
+    }
+    if (file.tellp() == 0) {
+        file.write(MACRO_CACHE_MAGIC_NUMBER.data(), MACRO_CACHE_MAGIC_NUMBER.size())
+            .write(reinterpret_cast<const char*>(&MACRO_CACHE_VERSION), sizeof(MACRO_CACHE_VERSION));
+    }
+    const u32 code_size = static_cast<u32>(code.size());
+    file.write(reinterpret_cast<const char*>(&hash), sizeof(hash))
+        .write(reinterpret_cast<const char*>(&code_size), sizeof(code_size))
+        .write(reinterpret_cast<const char*>(code.data()), code.size_bytes());
+} catch (const std::ios_base::failure& e) {
+    LOG_ERROR(Common_Filesystem, "{}", e.what());
+    Common::FS::RemoveFile(disk_cache_filename);
+    disk_cache_filename.clear();
+}
+
 } // namespace Tegra
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <filesystem>
 #include <memory>
 #include <span>
 #include <variant>
@@ -215,8 +216,8 @@ using AnyCachedMacro = std::variant<
     HLE_TransformFeedbackSetup,
     HLE_DrawIndirectByteCount,
     MacroInterpreterImpl,
-    // Used for JIT x86 macro
-    std::unique_ptr<DynamicCachedMacro>
+    // Used for JIT x86 macro, shared between methods uploading the same code
+    std::shared_ptr<DynamicCachedMacro>
 >;
 
 struct MacroEngine {
@@ -233,12 +234,22 @@ struct MacroEngine {
     // Compiles the macro if its not in the cache, and executes the compiled macro
     void Execute(Core::System& system, Engines::Maxwell3D& maxwell3d, u32 method, std::span<const u32> parameters);
     AnyCachedMacro Compile(Core::System& system, Engines::Maxwell3D& maxwell3d, std::span<const u32> code);
+    /// @brief Returns the program for the given code, reusing a previous compilation of the same
+    /// code when possible and recording new code in the per-title disk cache.
+    AnyCachedMacro GetProgram(Core::System& system, Engines::Maxwell3D& maxwell3d, std::span<const u32> code, u64 hash);
+    /// @brief Precompiles every macro recorded for the current title in a previous session.
+    void LoadDiskCache(Core::System& system, Engines::Maxwell3D& maxwell3d);
+    void SaveToDiskCache(u64 hash, std::span<const u32> code);
     struct CacheInfo {
         AnyCachedMacro program;
         u64 hash{};
     };
     ankerl::unordered_dense::map<u32, CacheInfo> macro_cache;
     ankerl::unordered_dense::map<u32, std::vector<u32>> uploaded_macro_code;
+    /// Compiled programs keyed by the hash of their code, titles re-upload the same macros often.
+    ankerl::unordered_dense::map<u64, std::shared_ptr<DynamicCachedMacro>> compiled_programs;
+    std::filesystem::path disk_cache_filename;
+    bool disk_cache_loaded = false;
     bool is_interpreted;
 };
 
@@ -25,6 +25,8 @@ namespace Tegra {
 using Tegra::Memory::GuestMemoryFlags;
 
 std::atomic<size_t> MemoryManager::unique_identifier_generator{};
+std::atomic<u64> MemoryManager::tlb_generation{};
+thread_local std::array<MemoryManager::TlbEntry, MemoryManager::TLB_SIZE> MemoryManager::tlb{};
 
 MemoryManager::MemoryManager(Core::System& system_, MaxwellDeviceMemoryManager& memory_, u64 address_space_bits_, GPUVAddr split_address_, u64 big_page_bits_, u64 page_bits_)
     : system{system_}, memory{memory_}, address_space_bits{address_space_bits_}
@@ -126,6 +128,8 @@ GPUVAddr MemoryManager::PageTableOp(GPUVAddr gpu_addr, [[maybe_unused]] DAddr de
         }
         remaining_size -= page_size;
     }
+    // Bumped after the update, so translations cached while it was in flight are dropped too
+    tlb_generation.fetch_add(1, std::memory_order_release);
     kind_map.Map(gpu_addr, gpu_addr + size, kind);
     return gpu_addr;
 }
@@ -164,6 +168,7 @@ GPUVAddr MemoryManager::BigPageTableOp(GPUVAddr gpu_addr, [[maybe_unused]] DAddr
         }
         remaining_size -= big_page_size;
     }
+    tlb_generation.fetch_add(1, std::memory_order_release);
     {
         std::unique_lock<std::mutex> lock(guard);
         kind_map.Map(gpu_addr, gpu_addr + size, kind);
@@ -206,6 +211,13 @@ std::optional<DAddr> MemoryManager::GpuToCpuAddress(GPUVAddr gpu_addr) const {
     if (!IsWithinGPUAddressRange(gpu_addr)) [[unlikely]] {
         return std::nullopt;
     }
+    const u64 big_page_index = gpu_addr >> big_page_bits;
+    const u64 generation = tlb_generation.load(std::memory_order_acquire);
+    TlbEntry& entry = tlb[big_page_index % TLB_SIZE];
+    if (entry.big_page_index == big_page_index && entry.manager_id == unique_identifier &&
+        entry.generation == generation) [[likely]] {
+        return entry.dev_addr_base + (gpu_addr & big_page_mask);
+    }
     if (GetEntry(gpu_addr, true) != EntryType::Mapped) [[unlikely]] {
         if (GetEntry(gpu_addr, false) != EntryType::Mapped)
             return std::nullopt;
@@ -213,6 +225,12 @@ std::optional<DAddr> MemoryManager::GpuToCpuAddress(GPUVAddr gpu_addr) const {
         return dev_addr_base + (gpu_addr & page_mask);
     }
     const DAddr dev_addr_base = DAddr(big_page_table_dev[PageEntryIndex(gpu_addr, true)]) << cpu_page_bits;
+    entry = TlbEntry{
+        .manager_id = unique_identifier,
+        .generation = generation,
+        .big_page_index = big_page_index,
+        .dev_addr_base = dev_addr_base,
+    };
     return dev_addr_base + (gpu_addr & big_page_mask);
 }
 
@@ -441,52 +459,20 @@ void MemoryManager::WriteBlockCached(GPUVAddr gpu_dest_addr, const void* src_buf
 
 void MemoryManager::FlushRegion(GPUVAddr gpu_addr, size_t size,
                                 VideoCommon::CacheType which) const {
-    auto do_nothing = [&]([[maybe_unused]] std::size_t page_index,
-                          [[maybe_unused]] std::size_t offset,
-                          [[maybe_unused]] std::size_t copy_amount) {};
-
-    auto mapped_normal = [&](std::size_t page_index, std::size_t offset, std::size_t copy_amount) {
-        const DAddr dev_addr_base = (DAddr(page_table[page_index]) << cpu_page_bits) + offset;
-        rasterizer->FlushRegion(dev_addr_base, copy_amount, which);
-    };
-    auto mapped_big = [&](std::size_t page_index, std::size_t offset, std::size_t copy_amount) {
-        const DAddr dev_addr_base = (DAddr(big_page_table_dev[page_index]) << cpu_page_bits) + offset;
-        rasterizer->FlushRegion(dev_addr_base, copy_amount, which);
-    };
-    auto flush_short_pages = [&](std::size_t page_index, std::size_t offset, std::size_t copy_amount) {
-        GPUVAddr base = (page_index << big_page_bits) + offset;
-        MemoryOperation(base, copy_amount, false, mapped_normal, do_nothing, do_nothing);
-    };
-    MemoryOperation(gpu_addr, size, true, mapped_big, do_nothing, flush_short_pages);
+    // Flush whole device ranges instead of every page, each call takes the rasterizer locks.
+    for (const auto& [dev_addr, dev_size] : GetDeviceRanges(gpu_addr, size)) {
+        rasterizer->FlushRegion(dev_addr, dev_size, which);
+    }
 }
 
 bool MemoryManager::IsMemoryDirty(GPUVAddr gpu_addr, size_t size,
                                   VideoCommon::CacheType which) const {
-    bool result = false;
-    auto do_nothing = [&]([[maybe_unused]] std::size_t page_index,
-                          [[maybe_unused]] std::size_t offset,
-                          [[maybe_unused]] std::size_t copy_amount) { return false; };
-
-    auto mapped_normal = [&](std::size_t page_index, std::size_t offset, std::size_t copy_amount) {
-        const DAddr dev_addr_base =
-            (static_cast<DAddr>(page_table[page_index]) << cpu_page_bits) + offset;
-        result |= rasterizer->MustFlushRegion(dev_addr_base, copy_amount, which);
-        return result;
-    };
-    auto mapped_big = [&](std::size_t page_index, std::size_t offset, std::size_t copy_amount) {
-        const DAddr dev_addr_base =
-            (static_cast<DAddr>(big_page_table_dev[page_index]) << cpu_page_bits) + offset;
-        result |= rasterizer->MustFlushRegion(dev_addr_base, copy_amount, which);
-        return result;
-    };
-    auto check_short_pages = [&](std::size_t page_index, std::size_t offset,
-                                 std::size_t copy_amount) {
-        GPUVAddr base = (page_index << big_page_bits) + offset;
-        MemoryOperation(base, copy_amount, false, mapped_normal, do_nothing, do_nothing);
-        return result;
-    };
-    MemoryOperation(gpu_addr, size, true, mapped_big, do_nothing, check_short_pages);
-    return result;
+    for (const auto& [dev_addr, dev_size] : GetDeviceRanges(gpu_addr, size)) {
+        if (rasterizer->MustFlushRegion(dev_addr, dev_size, which)) {
+            return true;
+        }
+    }
+    return false;
 }
 
 size_t MemoryManager::MaxContinuousRange(GPUVAddr gpu_addr, size_t size) const {
@@ -536,23 +522,9 @@ size_t MemoryManager::GetMemoryLayoutSize(GPUVAddr gpu_addr, size_t max_size) co
 
 void MemoryManager::InvalidateRegion(GPUVAddr gpu_addr, size_t size,
                                      VideoCommon::CacheType which) const {
-    auto do_nothing = [&]([[maybe_unused]] std::size_t page_index,
-                          [[maybe_unused]] std::size_t offset,
-                          [[maybe_unused]] std::size_t copy_amount) {};
-
-    auto mapped_normal = [&](std::size_t page_index, std::size_t offset, std::size_t copy_amount) {
-        const DAddr dev_addr_base = (DAddr(page_table[page_index]) << cpu_page_bits) + offset;
-        rasterizer->InvalidateRegion(dev_addr_base, copy_amount, which);
-    };
-    auto mapped_big = [&](std::size_t page_index, std::size_t offset, std::size_t copy_amount) {
-        const DAddr dev_addr_base = (DAddr(big_page_table_dev[page_index]) << cpu_page_bits) + offset;
-        rasterizer->InvalidateRegion(dev_addr_base, copy_amount, which);
-    };
-    auto invalidate_short_pages = [&](std::size_t page_index, std::size_t offset, std::size_t copy_amount) {
-        GPUVAddr base = (page_index << big_page_bits) + offset;
-        MemoryOperation(base, copy_amount, false, mapped_normal, do_nothing, do_nothing);
-    };
-    MemoryOperation(gpu_addr, size, true, mapped_big, do_nothing, invalidate_short_pages);
+    for (const auto& [dev_addr, dev_size] : GetDeviceRanges(gpu_addr, size)) {
+        rasterizer->InvalidateRegion(dev_addr, dev_size, which);
+    }
 }
 
 void MemoryManager::CopyBlock(GPUVAddr gpu_dest_addr, GPUVAddr gpu_src_addr, std::size_t size,
@@ -643,6 +615,59 @@ MemoryManager::GetSubmappedRange(GPUVAddr gpu_addr, std::size_t size) const {
     return result;
 }
 
+boost::container::small_vector<std::pair<DAddr, std::size_t>, 32>
+MemoryManager::GetDeviceRanges(GPUVAddr gpu_addr, std::size_t size) const {
+    boost::container::small_vector<std::pair<DAddr, std::size_t>, 32> result{};
+    GetSubmappedRangeImpl<false>(gpu_addr, size, result);
+    return result;
+}
+
+std::optional<DAddr> MemoryManager::GetContinuousDeviceAddress(GPUVAddr gpu_addr,
+                                                               std::size_t size) const {
+    std::optional<DAddr> base_addr{};
+    std::optional<DAddr> old_page_addr{};
+    bool result{true};
+    auto fail = [&]([[maybe_unused]] std::size_t page_index, [[maybe_unused]] std::size_t offset,
+                    [[maybe_unused]] std::size_t copy_amount) {
+        result = false;
+        return true;
+    };
+    auto extend = [&](DAddr dev_addr_base, std::size_t copy_amount) {
+        if (old_page_addr && *old_page_addr != dev_addr_base) {
+            result = false;
+            return true;
+        }
+        if (!base_addr) {
+            base_addr = dev_addr_base;
+        }
+        old_page_addr = {dev_addr_base + copy_amount};
+        return false;
+    };
+    auto short_check = [&](std::size_t page_index, std::size_t offset, std::size_t copy_amount) {
+        return extend((static_cast<DAddr>(page_table[page_index]) << cpu_page_bits) + offset,
+                      copy_amount);
+    };
+    auto big_check = [&](std::size_t page_index, std::size_t offset, std::size_t copy_amount) {
+        return extend((static_cast<DAddr>(big_page_table_dev[page_index]) << cpu_page_bits) + offset,
+                      copy_amount);
+    };
+    auto check_short_pages = [&](std::size_t page_index, std::size_t offset,
+                                 std::size_t copy_amount) {
+        GPUVAddr base = (page_index << big_page_bits) + offset;
+        MemoryOperation(base, copy_amount, false, short_check, fail, fail);
+        return !result;
+    };
+    MemoryOperation(gpu_addr, size, true, big_check, fail, check_short_pages);
+    if (!result) {
+        return std::nullopt;
+    }
+    if (!base_addr) {
+        // Empty regions are trivially continuous
+        return GpuToCpuAddress(gpu_addr);
+    }
+    return base_addr;
+}
+
 template <bool is_gpu_address>
 void MemoryManager::GetSubmappedRangeImpl(GPUVAddr gpu_addr, std::size_t size, boost::container::small_vector<std::pair<std::conditional_t<is_gpu_address, GPUVAddr, DAddr>, std::size_t>, 32>& result)
     const {
@@ -719,22 +744,14 @@ void MemoryManager::FlushCaching() {
 }
 
 const u8* MemoryManager::GetSpan(const GPUVAddr src_addr, const std::size_t size) const {
-    if (!IsContinuousRange(src_addr, size)) {
-        return nullptr;
-    }
-    auto dev_addr = GpuToCpuAddress(src_addr);
-    if (dev_addr) {
+    if (const auto dev_addr = GetContinuousDeviceAddress(src_addr, size)) {
         return memory.GetSpan(*dev_addr, size);
     }
     return nullptr;
 }
 
 u8* MemoryManager::GetSpan(const GPUVAddr src_addr, const std::size_t size) {
-    if (!IsContinuousRange(src_addr, size)) {
-        return nullptr;
-    }
-    auto dev_addr = GpuToCpuAddress(src_addr);
-    if (dev_addr) {
+    if (const auto dev_addr = GetContinuousDeviceAddress(src_addr, size)) {
         return memory.GetSpan(*dev_addr, size);
     }
     return nullptr;
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <map>
 #include <mutex>
@@ -125,6 +126,20 @@ public:
     boost::container::small_vector<std::pair<GPUVAddr, std::size_t>, 32> GetSubmappedRange(
         GPUVAddr gpu_addr, std::size_t size) const;
 
+    /**
+     * Returns the device address ranges mapped beneath a gpu region, found in a single page table
+     * walk. Pages backed by adjacent device memory are merged into a single range.
+     */
+    boost::container::small_vector<std::pair<DAddr, std::size_t>, 32> GetDeviceRanges(
+        GPUVAddr gpu_addr, std::size_t size) const;
+
+    /**
+     * Returns the device address of a gpu region if it is mapped by a single range of device
+     * addresses, found in a single page table walk.
+     */
+    [[nodiscard]] std::optional<DAddr> GetContinuousDeviceAddress(GPUVAddr gpu_addr,
+                                                                  std::size_t size) const;
+
     GPUVAddr Map(GPUVAddr gpu_addr, DAddr dev_addr, std::size_t size,
                  PTEKind kind = PTEKind::INVALID, bool is_big_pages = true);
     GPUVAddr MapSparse(GPUVAddr gpu_addr, std::size_t size, bool is_big_pages = true);
@@ -212,6 +227,20 @@ private:
     inline EntryType GetEntry(size_t position, bool is_big_page) const;
     inline void SetEntry(size_t position, EntryType entry, bool is_big_page);
 
+    /// Cached big page translation, valid while its generation matches tlb_generation
+    struct TlbEntry {
+        size_t manager_id = ~size_t{};
+        u64 generation{};
+        u64 big_page_index{};
+        DAddr dev_addr_base{};
+    };
+    static constexpr size_t TLB_SIZE = 16;
+
+    /// Bumped whenever any page table changes, invalidating every cached translation
+    static std::atomic<u64> tlb_generation;
+    /// Translations are cached per thread, the GPU thread and the CPU threads translate concurrently
+    static thread_local std::array<TlbEntry, TLB_SIZE> tlb;
+
     Common::MultiLevelPageTable<u32> page_table;
     Common::RangeMap<GPUVAddr, PTEKind> kind_map;
     Common::VirtualBuffer<u32> big_page_table_dev;
@@ -260,9 +260,9 @@ void QueryCacheBase<Traits>::CounterReport(GPUVAddr addr, QueryType counter_type
     };
     u8* pointer = impl->device_memory.template GetPointer<u8>(cpu_addr);
     u8* pointer_timestamp = impl->device_memory.template GetPointer<u8>(cpu_addr + 8);
-    bool is_synced = (Settings::IsGPUFenceBehaviorDefault() ? !Settings::IsGPULevelHigh() : !Settings::IsGPUFenceBehaviorBalanced() && !Settings::IsGPUFenceBehaviorAccurate() && !Settings::IsGPUFenceBehaviorStrict()) && is_fence;
+    bool is_synced = !Settings::GetSnapshot().delay_fences && is_fence;
     std::function<void()> operation([this, is_synced, streamer, query_base = query, query_location,
-                                     pointer, pointer_timestamp] {
+                                     cpu_addr, pointer, pointer_timestamp] {
         if (True(query_base->flags & QueryFlagBits::IsInvalidated)) {
             if (!is_synced) [[likely]] {
                 impl->pending_unregister.push_back(query_location);
@@ -279,6 +279,7 @@ void QueryCacheBase<Traits>::CounterReport(GPUVAddr addr, QueryType counter_type
         }
         query_base->value += streamer->GetAmendValue();
         streamer->SetAccumulationValue(query_base->value);
+        RecordResolvedValue(cpu_addr, query_base->value);
         if (True(query_base->flags & QueryFlagBits::HasTimestamp)) {
             u64 timestamp = impl->gpu.GetTicks();
             std::memcpy(pointer_timestamp, &timestamp, sizeof(timestamp));
@@ -575,8 +576,53 @@ bool QueryCacheBase<Traits>::SemiFlushQueryDirty(QueryCacheBase<Traits>::QueryLo
         std::memcpy(ptr, &value_l, sizeof(value_l));
         return false;
     }
-    return True(query_base->flags & QueryFlagBits::IsHostManaged) &&
-           False(query_base->flags & QueryFlagBits::IsGuestSynced);
+    const bool is_dirty = True(query_base->flags & QueryFlagBits::IsHostManaged) &&
+                          False(query_base->flags & QueryFlagBits::IsGuestSynced);
+    if (is_dirty && Settings::values.async_query_readback.GetValue() &&
+        WriteSpeculativeValue(query_base)) {
+        // The guest sees the previous result, the pending one lands once its fence signals
+        return false;
+    }
+    return is_dirty;
+}
+
+template <typename Traits>
+bool QueryCacheBase<Traits>::WriteSpeculativeValue(QueryBase* query) {
+    u64 value;
+    {
+        std::scoped_lock lock(resolved_mutex);
+        const auto it = resolved_values.find(query->guest_address);
+        if (it == resolved_values.end()) {
+            // Nothing resolved for this address yet, only the first read has to wait
+            return false;
+        }
+        value = it->second;
+    }
+    auto* ptr = impl->device_memory.template GetPointer<u8>(query->guest_address);
+    if (!ptr) [[unlikely]] {
+        return false;
+    }
+    if (True(query->flags & QueryFlagBits::HasTimestamp)) {
+        std::memcpy(ptr, &value, sizeof(value));
+    } else {
+        const u32 value_l = static_cast<u32>(value);
+        std::memcpy(ptr, &value_l, sizeof(value_l));
+    }
+    return true;
+}
+
+template <typename Traits>
+void QueryCacheBase<Traits>::RecordResolvedValue(VAddr addr, u64 value) {
+    if (!Settings::values.async_query_readback.GetValue()) {
+        return;
+    }
+    // Guest query addresses are few and reused every frame, the limit only guards odd titles
+    static constexpr size_t MAX_RESOLVED_VALUES = 1ULL << 16;
+    std::scoped_lock lock(resolved_mutex);
+    if (resolved_values.size() >= MAX_RESOLVED_VALUES) {
+        resolved_values.clear();
+    }
+    resolved_values.insert_or_assign(addr, value);
 }
 
 template <typename Traits>
@@ -165,12 +165,18 @@ protected:
     void InvalidateQuery(QueryLocation location);
     bool IsQueryDirty(QueryLocation location);
     bool SemiFlushQueryDirty(QueryLocation location);
+    bool WriteSpeculativeValue(QueryBase* query);
+    void RecordResolvedValue(VAddr addr, u64 value);
     void RequestGuestHostSync();
     void UnregisterPending();
 
     ankerl::unordered_dense::map<u64, ankerl::unordered_dense::map<u32, QueryLocation>> cached_queries;
     std::mutex cache_mutex;
 
+    /// Last value resolved for each guest query address, handed out while a newer one is pending
+    ankerl::unordered_dense::map<VAddr, u64> resolved_values;
+    std::mutex resolved_mutex;
+
     struct QueryCacheBaseImpl;
     friend struct QueryCacheBaseImpl;
     friend RuntimeType;
@@ -42,6 +42,9 @@ public:
     /// Dispatches a draw invocation
     virtual void Draw(bool is_indexed, u32 instance_count) = 0;
 
+    /// Dispatches the indexed draws of the draw state batch, they share everything but the range
+    virtual void DrawIndexedBatch() = 0;
+
     /// Dispatches an indirect draw invocation
     virtual void DrawIndirect() {}
 
@@ -111,6 +114,13 @@ public:
     /// Notify rasterizer that any caches of the specified region are desync with guest
     virtual void OnCacheInvalidation(PAddr addr, u64 size) = 0;
 
+    /// Notify rasterizer that any caches of the specified regions are desync with guest
+    virtual void OnCacheInvalidationBatch(std::span<const std::pair<DAddr, std::size_t>> sequences) {
+        for (const auto& [addr, size] : sequences) {
+            OnCacheInvalidation(addr, size);
+        }
+    }
+
     virtual bool OnCPUWrite(PAddr addr, u64 size) = 0;
 
     /// Sync memory between guest and host.
@@ -171,6 +181,9 @@ public:
     /// Register the address as a Transform Feedback Object
     virtual void RegisterTransformFeedback(GPUVAddr tfb_object_addr) {}
 
+    /// Notify the rasterizer that a graphics program was bound, ahead of the draw using it
+    virtual void PrefetchShaderProgram(size_t index) {}
+
     /// Returns true when the rasterizer has Draw Transform Feedback capabilities
     virtual bool HasDrawTransformFeedback() {
         return false;
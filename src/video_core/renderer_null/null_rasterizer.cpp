@@ -2,10 +2,12 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "common/alignment.h"
+#include "common/settings.h"
 #include "video_core/control/channel_state.h"
 #include "video_core/host1x/host1x.h"
 #include "video_core/memory_manager.h"
 #include "video_core/renderer_null/null_rasterizer.h"
+#include "video_core/renderer_null/null_shader_cache.h"
 
 namespace Null {
 
@@ -14,17 +16,39 @@ AccelerateDMA::AccelerateDMA() = default;
 bool AccelerateDMA::BufferCopy(GPUVAddr start_address, GPUVAddr end_address, u64 amount) {
     return true;
 }
+bool AccelerateDMA::BufferCopyLines(GPUVAddr src_address, u64 src_pitch, GPUVAddr dest_address,
+                                    u64 dest_pitch, u64 line_length, u32 line_count) {
+    return true;
+}
 bool AccelerateDMA::BufferClear(GPUVAddr src_address, u64 amount, u32 value) {
     return true;
 }
 
-RasterizerNull::RasterizerNull(Tegra::GPU& gpu) : m_gpu{gpu} {}
+RasterizerNull::RasterizerNull(Tegra::MaxwellDeviceMemoryManager& device_memory, Tegra::GPU& gpu)
+    : m_gpu{gpu} {
+    if (Settings::values.null_renderer_translate_shaders.GetValue()) {
+        m_shader_cache = std::make_unique<ShaderCache>(device_memory);
+    }
+}
 RasterizerNull::~RasterizerNull() = default;
 
-void RasterizerNull::Draw(bool is_indexed, u32 instance_count) {}
+void RasterizerNull::Draw(bool is_indexed, u32 instance_count) {
+    if (m_shader_cache) {
+        m_shader_cache->PrepareGraphics();
+    }
+}
+void RasterizerNull::DrawIndexedBatch() {
+    if (m_shader_cache) {
+        m_shader_cache->PrepareGraphics();
+    }
+}
 void RasterizerNull::DrawTexture() {}
 void RasterizerNull::Clear(u32 layer_count) {}
-void RasterizerNull::DispatchCompute() {}
+void RasterizerNull::DispatchCompute() {
+    if (m_shader_cache) {
+        m_shader_cache->PrepareCompute();
+    }
+}
 void RasterizerNull::ResetCounter(VideoCommon::QueryType type) {}
 void RasterizerNull::Query(GPUVAddr gpu_addr, VideoCommon::QueryType type,
                            VideoCommon::QueryPropertiesFlags flags, u32 payload, u32 subreport) {
@@ -47,11 +71,22 @@ void RasterizerNull::FlushRegion(DAddr addr, u64 size, VideoCommon::CacheType) {
 bool RasterizerNull::MustFlushRegion(DAddr addr, u64 size, VideoCommon::CacheType) {
     return false;
 }
-void RasterizerNull::InvalidateRegion(DAddr addr, u64 size, VideoCommon::CacheType) {}
+void RasterizerNull::InvalidateRegion(DAddr addr, u64 size, VideoCommon::CacheType which) {
+    if (m_shader_cache && True(which & VideoCommon::CacheType::ShaderCache)) {
+        m_shader_cache->InvalidateRegion(addr, size);
+    }
+}
 bool RasterizerNull::OnCPUWrite(PAddr addr, u64 size) {
+    if (m_shader_cache) {
+        m_shader_cache->InvalidateRegion(addr, size);
+    }
     return false;
 }
-void RasterizerNull::OnCacheInvalidation(PAddr addr, u64 size) {}
+void RasterizerNull::OnCacheInvalidation(PAddr addr, u64 size) {
+    if (m_shader_cache) {
+        m_shader_cache->InvalidateRegion(addr, size);
+    }
+}
 VideoCore::RasterizerDownloadArea RasterizerNull::GetFlushArea(PAddr addr, u64 size) {
     VideoCore::RasterizerDownloadArea new_area{
         .start_address = Common::AlignDown(addr, Core::DEVICE_PAGESIZE),
@@ -61,7 +96,11 @@ VideoCore::RasterizerDownloadArea RasterizerNull::GetFlushArea(PAddr addr, u64 s
     return new_area;
 }
 void RasterizerNull::InvalidateGPUCache() {}
-void RasterizerNull::UnmapMemory(DAddr addr, u64 size) {}
+void RasterizerNull::UnmapMemory(DAddr addr, u64 size) {
+    if (m_shader_cache) {
+        m_shader_cache->OnCacheInvalidation(addr, size);
+    }
+}
 void RasterizerNull::ModifyGPUMemory(size_t as_id, GPUVAddr addr, u64 size) {}
 void RasterizerNull::SignalFence(std::function<void()>&& func) {
     func();
@@ -76,7 +115,10 @@ void RasterizerNull::SignalSyncPoint(u32 value) {
 }
 void RasterizerNull::SignalReference() {}
 void RasterizerNull::ReleaseFences(bool) {}
-void RasterizerNull::FlushAndInvalidateRegion(DAddr addr, u64 size, VideoCommon::CacheType) {}
+void RasterizerNull::FlushAndInvalidateRegion(DAddr addr, u64 size,
+                                              VideoCommon::CacheType which) {
+    InvalidateRegion(addr, size, which);
+}
 void RasterizerNull::WaitForIdle() {}
 void RasterizerNull::FragmentBarrier() {}
 void RasterizerNull::TiledCacheBarrier() {}
@@ -91,17 +133,35 @@ bool RasterizerNull::AccelerateSurfaceCopy(const Tegra::Engines::Fermi2D::Surfac
     return true;
 }
 void RasterizerNull::AccelerateInlineToMemory(GPUVAddr address, size_t copy_size,
-                                              std::span<const u8> memory) {}
+                                              std::span<const u8> memory) {
+    if (!m_shader_cache || !gpu_memory) {
+        return;
+    }
+    // Games upload shaders inline, they have to reach memory to be translated
+    gpu_memory->WriteBlock(address, memory.data(), copy_size);
+    if (const auto cpu_addr = gpu_memory->GpuToCpuAddress(address)) {
+        m_shader_cache->InvalidateRegion(*cpu_addr, copy_size);
+    }
+}
 void RasterizerNull::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
                                        const VideoCore::DiskResourceLoadCallback& callback) {}
 void RasterizerNull::InitializeChannel(Tegra::Control::ChannelState& channel) {
     CreateChannel(channel);
+    if (m_shader_cache) {
+        m_shader_cache->CreateChannel(channel);
+    }
 }
 void RasterizerNull::BindChannel(Tegra::Control::ChannelState& channel) {
     BindToChannel(channel.bind_id);
+    if (m_shader_cache) {
+        m_shader_cache->BindToChannel(channel.bind_id);
+    }
 }
 void RasterizerNull::ReleaseChannel(s32 channel_id) {
     EraseChannel(channel_id);
+    if (m_shader_cache) {
+        m_shader_cache->EraseChannel(channel_id);
+    }
 }
 
 } // namespace Null
@@ -3,9 +3,12 @@
 
 #pragma once
 
+#include <memory>
+
 #include "common/common_types.h"
 #include "video_core/control/channel_state_cache.h"
 #include "video_core/engines/maxwell_dma.h"
+#include "video_core/host1x/gpu_device_memory_manager.h"
 #include "video_core/rasterizer_interface.h"
 
 namespace Core {
@@ -15,11 +18,14 @@ class System;
 namespace Null {
 
 class RasterizerNull;
+class ShaderCache;
 
 class AccelerateDMA : public Tegra::Engines::AccelerateDMAInterface {
 public:
     explicit AccelerateDMA();
     bool BufferCopy(GPUVAddr start_address, GPUVAddr end_address, u64 amount) override;
+    bool BufferCopyLines(GPUVAddr src_address, u64 src_pitch, GPUVAddr dest_address,
+                         u64 dest_pitch, u64 line_length, u32 line_count) override;
     bool BufferClear(GPUVAddr src_address, u64 amount, u32 value) override;
     bool ImageToBuffer(const Tegra::DMA::ImageCopy& copy_info, const Tegra::DMA::ImageOperand& src,
                        const Tegra::DMA::BufferOperand& dst) override {
@@ -34,10 +40,11 @@ public:
 class RasterizerNull final : public VideoCore::RasterizerInterface,
                              protected VideoCommon::ChannelSetupCaches<VideoCommon::ChannelInfo> {
 public:
-    explicit RasterizerNull(Tegra::GPU& gpu);
+    explicit RasterizerNull(Tegra::MaxwellDeviceMemoryManager& device_memory, Tegra::GPU& gpu);
     ~RasterizerNull() override;
 
     void Draw(bool is_indexed, u32 instance_count) override;
+    void DrawIndexedBatch() override;
     void DrawTexture() override;
     void Clear(u32 layer_count) override;
     void DispatchCompute() override;
@@ -86,6 +93,8 @@ public:
 private:
     Tegra::GPU& m_gpu;
     AccelerateDMA m_accelerate_dma;
+    /// Only created when the shaders are translated
+    std::unique_ptr<ShaderCache> m_shader_cache;
 };
 
 } // namespace Null
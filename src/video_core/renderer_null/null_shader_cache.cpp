@@ -0,0 +1,143 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "common/hash.h"
+#include "common/logging.h"
+#include "shader_recompiler/backend/spirv/emit_spirv.h"
+#include "shader_recompiler/exception.h"
+#include "shader_recompiler/frontend/ir/program.h"
+#include "shader_recompiler/frontend/maxwell/translate_program.h"
+#include "shader_recompiler/program_header.h"
+#include "shader_recompiler/runtime_info.h"
+#include "video_core/engines/kepler_compute.h"
+#include "video_core/engines/maxwell_3d.h"
+#include "video_core/renderer_null/null_shader_cache.h"
+#include "video_core/shader_environment.h"
+
+namespace Null {
+
+using Shader::Backend::SPIRV::EmitSPIRV;
+using Shader::Maxwell::ConvertLegacyToGeneric;
+using Shader::Maxwell::MergeDualVertexPrograms;
+using Shader::Maxwell::TranslateProgram;
+using Maxwell = Tegra::Engines::Maxwell3D::Regs;
+
+ShaderCache::ShaderCache(Tegra::MaxwellDeviceMemoryManager& device_memory_)
+    : VideoCommon::ShaderCache{device_memory_} {
+    // Roughly what a desktop Vulkan driver exposes, so the common emission paths are taken
+    profile = Shader::Profile{
+        .supported_spirv = 0x00010300,
+        .unified_descriptor_binding = true,
+        .support_descriptor_aliasing = true,
+        .support_int8 = true,
+        .support_uniform_and_storage_buffer_8bit = true,
+        .support_storage_buffer_8bit = true,
+        .support_int16 = true,
+        .support_uniform_and_storage_buffer_16bit = true,
+        .support_storage_buffer_16bit = true,
+        .support_int64 = true,
+        .support_float_controls = true,
+        .support_vote = true,
+        .support_viewport_index_layer_non_geometry = true,
+        .support_typeless_image_loads = true,
+        .support_demote_to_helper_invocation = true,
+        .support_int64_atomics = true,
+        .support_derivative_control = true,
+        .support_native_ndc = true,
+        .support_scaled_attributes = true,
+        .support_multi_viewport = true,
+        .support_geometry_streams = true,
+        .min_ssbo_alignment = 64,
+        .max_user_clip_distances = 8,
+    };
+    host_info = Shader::HostTranslateInfo{
+        .min_ssbo_alignment = 64,
+        .support_float64 = true,
+        .support_float16 = true,
+        .support_int64 = true,
+        .support_snorm_render_buffer = true,
+        .support_viewport_index_layer = true,
+        .support_conditional_barrier = true,
+    };
+    host_info.ApplyDescriptorLimitPolicy();
+}
+
+ShaderCache::~ShaderCache() = default;
+
+void ShaderCache::PrepareGraphics() {
+    if (!RefreshStages(unique_hashes)) {
+        return;
+    }
+    const u64 key = Common::Hash::HashObject(unique_hashes);
+    if (!translated_graphics.insert(key).second) {
+        return;
+    }
+    GraphicsEnvironments environments;
+    GetGraphicsEnvironments(environments, unique_hashes);
+
+    inst_pool.ReleaseContents();
+    block_pool.ReleaseContents();
+    flow_block_pool.ReleaseContents();
+    try {
+        std::array<Shader::IR::Program, Maxwell::MaxShaderProgram> programs;
+        const bool uses_vertex_a = unique_hashes[0] != 0;
+        const bool uses_vertex_b = unique_hashes[1] != 0;
+        size_t env_index{};
+        for (size_t index = 0; index < Maxwell::MaxShaderProgram; ++index) {
+            if (unique_hashes[index] == 0) {
+                continue;
+            }
+            Shader::Environment& env{*environments.Span()[env_index++]};
+            const u32 cfg_offset{
+                static_cast<u32>(env.StartAddress() + sizeof(Shader::ProgramHeader))};
+            Shader::Maxwell::Flow::CFG cfg(env, flow_block_pool, cfg_offset, index == 0);
+            if (!uses_vertex_a || index != 1) {
+                programs[index] = TranslateProgram(inst_pool, block_pool, env, cfg, host_info);
+            } else {
+                auto program_vb{TranslateProgram(inst_pool, block_pool, env, cfg, host_info)};
+                programs[index] = MergeDualVertexPrograms(programs[0], program_vb, env);
+            }
+        }
+        // Without pipeline state the stages are emitted with the default runtime info
+        Shader::Backend::Bindings binding;
+        for (size_t index = uses_vertex_a && uses_vertex_b ? 1 : 0;
+             index < Maxwell::MaxShaderProgram; ++index) {
+            if (unique_hashes[index] == 0) {
+                continue;
+            }
+            Shader::IR::Program& program{programs[index]};
+            const Shader::RuntimeInfo runtime_info{};
+            ConvertLegacyToGeneric(program, runtime_info);
+            void(EmitSPIRV(profile, runtime_info, program, binding));
+        }
+    } catch (const Shader::Exception& exception) {
+        LOG_ERROR(Render, "Failed to translate graphics shaders 0x{:016x}: {}", key,
+                  exception.what());
+    }
+}
+
+void ShaderCache::PrepareCompute() {
+    const VideoCommon::ShaderInfo* const shader{ComputeShader()};
+    if (!shader || !translated_compute.insert(shader->unique_hash).second) {
+        return;
+    }
+    const GPUVAddr program_base{kepler_compute->regs.code_loc.Address()};
+    const auto& qmd{kepler_compute->launch_description};
+    VideoCommon::ComputeEnvironment env{*kepler_compute, *gpu_memory, program_base,
+                                        qmd.program_start};
+    env.SetCachedSize(shader->size_bytes);
+
+    inst_pool.ReleaseContents();
+    block_pool.ReleaseContents();
+    flow_block_pool.ReleaseContents();
+    try {
+        Shader::Maxwell::Flow::CFG cfg{env, flow_block_pool, env.StartAddress()};
+        auto program{TranslateProgram(inst_pool, block_pool, env, cfg, host_info)};
+        void(EmitSPIRV(profile, program));
+    } catch (const Shader::Exception& exception) {
+        LOG_ERROR(Render, "Failed to translate compute shader 0x{:016x}: {}",
+                  shader->unique_hash, exception.what());
+    }
+}
+
+} // namespace Null
@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <array>
+
+#include <ankerl/unordered_dense.h>
+
+#include "common/common_types.h"
+#include "shader_recompiler/frontend/ir/basic_block.h"
+#include "shader_recompiler/frontend/maxwell/control_flow.h"
+#include "shader_recompiler/host_translate_info.h"
+#include "shader_recompiler/object_pool.h"
+#include "shader_recompiler/profile.h"
+#include "video_core/shader_cache.h"
+
+namespace Null {
+
+/**
+ * Translates the shaders used by draws and dispatches to SPIR-V and throws the result away, so the
+ * null renderer can be used to profile the CPU cost of the shader recompiler.
+ */
+class ShaderCache final : public VideoCommon::ShaderCache {
+public:
+    explicit ShaderCache(Tegra::MaxwellDeviceMemoryManager& device_memory_);
+    ~ShaderCache();
+
+    /// Translates the shaders of the current draw that have not been seen in this combination
+    void PrepareGraphics();
+
+    /// Translates the shader of the current dispatch if it has not been seen
+    void PrepareCompute();
+
+private:
+    Shader::ObjectPool<Shader::IR::Inst> inst_pool{8192};
+    Shader::ObjectPool<Shader::IR::Block> block_pool{32};
+    Shader::ObjectPool<Shader::Maxwell::Flow::Block> flow_block_pool{32};
+
+    Shader::Profile profile;
+    Shader::HostTranslateInfo host_info;
+
+    std::array<u64, 6> unique_hashes{};
+    ankerl::unordered_dense::set<u64> translated_graphics;
+    ankerl::unordered_dense::set<u64> translated_compute;
+};
+
+} // namespace Null
@@ -7,7 +7,7 @@
 #include <cstring>
 #include <bit>
 #include <numeric>
-#include "common/cityhash.h"
+#include "common/hash.h"
 #include "common/settings.h"
 #include "video_core/renderer_opengl/gl_compute_pipeline.h"
 #include "video_core/renderer_opengl/gl_shader_manager.h"
@@ -23,8 +23,7 @@ constexpr u32 MAX_TEXTURES = 64;
 constexpr u32 MAX_IMAGES = 16;
 
 size_t ComputePipelineKey::Hash() const noexcept {
-    return static_cast<size_t>(
-        Common::CityHash64(reinterpret_cast<const char*>(this), sizeof *this));
+    return static_cast<size_t>(Common::Hash::HashObject(*this));
 }
 
 bool ComputePipelineKey::operator==(const ComputePipelineKey& rhs) const noexcept {
@@ -179,6 +179,10 @@ public:
         return vendor_name == "Intel";
     }
 
+    bool HasParallelShaderCompile() const {
+        return has_parallel_shader_compile;
+    }
+
     bool CanReportMemoryUsage() const {
         return can_report_memory;
     }
@@ -237,6 +241,7 @@ private:
     bool need_fastmath_off{};
     bool has_cbuf_ftou_bug{};
     bool has_bool_ref_bug{};
+    bool has_parallel_shader_compile{};
     bool can_report_memory{};
     bool strict_context_required{};
     bool supports_conditional_barriers{};
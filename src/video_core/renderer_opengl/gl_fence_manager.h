@@ -38,6 +38,7 @@ struct FenceManagerParams {
     using QueryCacheType = QueryCache;
 
     static constexpr bool HAS_ASYNC_CHECK = false;
+    static constexpr bool DEFERS_FENCE_SUBMIT = false;
 };
 
 using GenericFenceManager = VideoCommon::FenceManager<FenceManagerParams>;
@@ -235,6 +235,10 @@ GraphicsPipeline::GraphicsPipeline(const Device& device, TextureCache& texture_c
         GenerateTransformFeedbackState();
     }
     const bool in_parallel = thread_worker != nullptr;
+    // With parallel compilation the driver links in the background, don't report the pipeline as
+    // built to asynchronous shader users until it's done. GLASM programs are compiled synchronously.
+    check_link_completion = in_parallel && device.HasParallelShaderCompile() &&
+                            backend != Settings::RendererBackend::OpenGL_GLASM;
     auto func{[this, sources_ = std::move(sources), sources_spirv_ = std::move(sources_spirv),
                shader_notify, backend, in_parallel,
                force_context_flush](ShaderContext::Context*) mutable {
@@ -270,7 +274,7 @@ GraphicsPipeline::GraphicsPipeline(const Device& device, TextureCache& texture_c
         }
     }};
     if (thread_worker) {
-        thread_worker->QueueWork(std::move(func));
+        thread_worker->QueueWork(std::move(func), Common::WorkPriority::High);
     } else {
         func(nullptr);
     }
@@ -638,8 +642,17 @@ bool GraphicsPipeline::IsBuilt() noexcept {
     if (built_fence.handle == 0) {
         return false;
     }
-    is_built = built_fence.IsSignaled();
+    is_built = built_fence.IsSignaled() && AreProgramsLinked();
     return is_built;
 }
 
+bool GraphicsPipeline::AreProgramsLinked() const {
+    if (!check_link_completion) {
+        return true;
+    }
+    return std::ranges::all_of(source_programs, [](const OGLProgram& program) {
+        return program.handle == 0 || IsProgramLinkComplete(program.handle);
+    });
+}
+
 } // namespace OpenGL
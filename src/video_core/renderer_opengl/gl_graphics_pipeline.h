@@ -12,8 +12,8 @@
 #include <utility>
 
 #include "common/bit_field.h"
-#include "common/cityhash.h"
 #include "common/common_types.h"
+#include "common/hash.h"
 #include "shader_recompiler/shader_info.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/renderer_opengl/gl_buffer_cache.h"
@@ -49,7 +49,8 @@ struct GraphicsPipelineKey {
     VideoCommon::TransformFeedbackState xfb_state;
 
     size_t Hash() const noexcept {
-        return static_cast<size_t>(Common::CityHash64(reinterpret_cast<const char*>(this), Size()));
+        return static_cast<size_t>(
+            Common::Hash::Hash64(std::span(reinterpret_cast<const u8*>(this), Size())));
     }
 
     bool operator==(const GraphicsPipelineKey& rhs) const noexcept {
@@ -129,6 +130,9 @@ private:
 
     void WaitForBuild();
 
+    /// Returns false while the driver is still linking any of the source programs
+    bool AreProgramsLinked() const;
+
     TextureCache& texture_cache;
     BufferCache& buffer_cache;
     Tegra::MemoryManager* gpu_memory;
@@ -164,6 +168,7 @@ private:
     std::condition_variable built_condvar;
     OGLSync built_fence{};
     bool is_built{false};
+    bool check_link_completion{false};
 };
 
 } // namespace OpenGL
@@ -301,6 +301,32 @@ void RasterizerOpenGL::Draw(bool is_indexed, u32 instance_count) {
     });
 }
 
+void RasterizerOpenGL::DrawIndexedBatch() {
+    PrepareDraw(true, [this](GLenum primitive_mode) {
+        const auto& draw_state = maxwell3d->draw_manager.draw_state;
+        const GLenum format = MaxwellToGL::IndexFormat(draw_state.index_buffer.format);
+        const uintptr_t index_offset = reinterpret_cast<uintptr_t>(buffer_cache_runtime.IndexOffset());
+        const size_t index_size = draw_state.index_buffer.FormatSizeInBytes();
+        const GLint base_vertex = GLint(draw_state.base_index);
+        const GLuint base_instance = GLuint(draw_state.base_instance);
+        if (base_instance != 0) {
+            for (const auto& draw : draw_state.batched_draws) {
+                const auto* const offset = reinterpret_cast<const GLvoid*>(index_offset + draw.first * index_size);
+                glDrawElementsInstancedBaseVertexBaseInstance(primitive_mode, GLsizei(draw.count), format, offset, 1, base_vertex, base_instance);
+            }
+            return;
+        }
+        batch_counts.clear();
+        batch_offsets.clear();
+        for (const auto& draw : draw_state.batched_draws) {
+            batch_counts.push_back(GLsizei(draw.count));
+            batch_offsets.push_back(reinterpret_cast<const GLvoid*>(index_offset + draw.first * index_size));
+        }
+        batch_base_vertices.assign(batch_counts.size(), base_vertex);
+        glMultiDrawElementsBaseVertex(primitive_mode, batch_counts.data(), format, batch_offsets.data(), GLsizei(batch_counts.size()), batch_base_vertices.data());
+    });
+}
+
 void RasterizerOpenGL::DrawIndirect() {
     const auto& params = maxwell3d->draw_manager.indirect_state;
     buffer_cache.SetDrawIndirect(&params);
@@ -584,6 +610,25 @@ void RasterizerOpenGL::OnCacheInvalidation(DAddr addr, u64 size) {
     shader_cache.InvalidateRegion(addr, size);
 }
 
+void RasterizerOpenGL::OnCacheInvalidationBatch(
+    std::span<const std::pair<DAddr, std::size_t>> sequences) {
+    {
+        std::scoped_lock lock{texture_cache.mutex};
+        for (const auto& [addr, size] : sequences) {
+            texture_cache.WriteMemory(addr, size);
+        }
+    }
+    {
+        std::scoped_lock lock{buffer_cache.mutex};
+        for (const auto& [addr, size] : sequences) {
+            buffer_cache.WriteMemory(addr, size);
+        }
+    }
+    for (const auto& [addr, size] : sequences) {
+        shader_cache.InvalidateRegion(addr, size);
+    }
+}
+
 void RasterizerOpenGL::InvalidateGPUCache() {
     gpu.InvalidateGPUCache();
 }
@@ -1393,6 +1438,10 @@ void RasterizerOpenGL::ReleaseChannel(s32 channel_id) {
     query_cache.EraseChannel(channel_id);
 }
 
+void RasterizerOpenGL::PrefetchShaderProgram(size_t index) {
+    shader_cache.PrefetchProgram(index);
+}
+
 void RasterizerOpenGL::RegisterTransformFeedback(GPUVAddr tfb_object_addr) {
     buffer_cache_runtime.BindTransformFeedbackObject(tfb_object_addr);
 }
@@ -1405,6 +1454,13 @@ bool AccelerateDMA::BufferCopy(GPUVAddr src_address, GPUVAddr dest_address, u64
     return buffer_cache.DMACopy(src_address, dest_address, amount);
 }
 
+bool AccelerateDMA::BufferCopyLines(GPUVAddr src_address, u64 src_pitch, GPUVAddr dest_address,
+                                    u64 dest_pitch, u64 line_length, u32 line_count) {
+    std::scoped_lock lock{buffer_cache.mutex};
+    return buffer_cache.DMACopyLines(src_address, src_pitch, dest_address, dest_pitch,
+                                     line_length, line_count);
+}
+
 bool AccelerateDMA::BufferClear(GPUVAddr src_address, u64 amount, u32 value) {
     std::scoped_lock lock{buffer_cache.mutex};
     return buffer_cache.DMAClear(src_address, amount, value);
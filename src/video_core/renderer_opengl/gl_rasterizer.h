@@ -6,6 +6,7 @@
 #include <array>
 #include <cstddef>
 #include <optional>
+#include <vector>
 
 #include <boost/container/static_vector.hpp>
 
@@ -54,6 +55,9 @@ public:
 
     bool BufferCopy(GPUVAddr src_address, GPUVAddr dest_address, u64 amount) override;
 
+    bool BufferCopyLines(GPUVAddr src_address, u64 src_pitch, GPUVAddr dest_address,
+                         u64 dest_pitch, u64 line_length, u32 line_count) override;
+
     bool BufferClear(GPUVAddr src_address, u64 amount, u32 value) override;
 
     bool ImageToBuffer(const Tegra::DMA::ImageCopy& copy_info, const Tegra::DMA::ImageOperand& src,
@@ -82,6 +86,7 @@ public:
     ~RasterizerOpenGL() override;
 
     void Draw(bool is_indexed, u32 instance_count) override;
+    void DrawIndexedBatch() override;
     void DrawIndirect() override;
     void DrawTexture() override;
     void Clear(u32 layer_count) override;
@@ -100,6 +105,7 @@ public:
     void InvalidateRegion(DAddr addr, u64 size,
                           VideoCommon::CacheType which = VideoCommon::CacheType::All) override;
     void OnCacheInvalidation(PAddr addr, u64 size) override;
+    void OnCacheInvalidationBatch(std::span<const std::pair<DAddr, std::size_t>> sequences) override;
     bool OnCPUWrite(PAddr addr, u64 size) override;
     void InvalidateGPUCache() override;
     void UnmapMemory(DAddr addr, u64 size) override;
@@ -137,6 +143,8 @@ public:
 
     void ReleaseChannel(s32 channel_id) override;
 
+    void PrefetchShaderProgram(size_t index) override;
+
     void RegisterTransformFeedback(GPUVAddr tfb_object_addr) override;
 
     bool HasDrawTransformFeedback() override {
@@ -261,6 +269,11 @@ private:
     std::array<GLuint, MAX_TEXTURES> texture_handles{};
     std::array<GLuint, MAX_IMAGES> image_handles{};
 
+    /// Arguments of the last batched draw, kept to reuse their allocation
+    std::vector<GLsizei> batch_counts;
+    std::vector<const GLvoid*> batch_offsets;
+    std::vector<GLint> batch_base_vertices;
+
     /// Number of commands queued to the OpenGL driver. Reset on flush.
     size_t num_queued_commands = 0;
     bool has_written_global_memory = false;
@@ -54,7 +54,7 @@ using VideoCommon::LoadPipelines;
 using VideoCommon::SerializePipeline;
 using Context = ShaderContext::Context;
 
-constexpr u32 CACHE_VERSION = 15;
+constexpr u32 CACHE_VERSION = 17;
 
 template <typename Container>
 auto MakeSpan(Container& container) {
@@ -243,6 +243,7 @@ ShaderCache::ShaderCache(Tegra::MaxwellDeviceMemoryManager& device_memory_,
           // host that reports a different count from under- or over-running that array.
           .max_user_clip_distances =
               std::min<u32>(device.GetMaxUserClipDistances(), Maxwell::Regs::NumClipDistances),
+          .emit_debug_names = Settings::values.renderer_debug.GetValue(),
       },
       host_info{
         .min_ssbo_alignment = static_cast<u32>(device.GetShaderStorageBufferAlignment()),
@@ -270,6 +271,9 @@ ShaderCache::ShaderCache(Tegra::MaxwellDeviceMemoryManager& device_memory_,
         .support_conditional_barrier = device.SupportsConditionalBarriers(),
       } {
     host_info.ApplyDescriptorLimitPolicy();
+    if (device.HasParallelShaderCompile()) {
+        EnableParallelShaderCompile();
+    }
     if (use_asynchronous_shaders) {
         workers = CreateWorkers();
     }
@@ -295,7 +299,7 @@ void ShaderCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
     }
     std::optional<Context> strict_context;
     if (strict_context_required) {
-        strict_context.emplace(emu_window);
+        strict_context.emplace(emu_window, device.HasParallelShaderCompile());
     }
 
     struct {
@@ -309,10 +313,10 @@ void ShaderCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
         if (strict_context_required) {
             work(&strict_context.value());
         } else {
-            workers->QueueWork(std::move(work));
+            workers->QueueWork(std::move(work), Common::WorkPriority::Low);
         }
     }};
-    const auto load_compute{[&](std::ifstream& file, FileEnvironment env) {
+    const auto load_compute{[&](std::istream& file, FileEnvironment env) {
         ComputePipelineKey key;
         file.read(reinterpret_cast<char*>(&key), sizeof(key));
         queue_work([this, key, env_ = std::move(env), &state, &callback](Context* ctx) mutable {
@@ -329,7 +333,7 @@ void ShaderCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
         });
         ++state.total;
     }};
-    const auto load_graphics{[&](std::ifstream& file, std::vector<FileEnvironment> envs) {
+    const auto load_graphics{[&](std::istream& file, std::vector<FileEnvironment> envs) {
         GraphicsPipelineKey key;
         file.read(reinterpret_cast<char*>(&key), sizeof(key));
         queue_work([this, key, envs_ = std::move(envs), &state, &callback](Context* ctx) mutable {
@@ -350,6 +354,7 @@ void ShaderCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
         });
         ++state.total;
     }};
+    VideoCommon::ImportPendingPipelineManifest(shader_cache_filename, CACHE_VERSION);
     LoadPipelines(stop_loading, shader_cache_filename, CACHE_VERSION, load_compute, load_graphics);
 
     LOG_INFO(Render_OpenGL, "Total Pipeline Count: {}", state.total);
@@ -626,7 +631,10 @@ std::unique_ptr<ComputePipeline> ShaderCache::CreateComputePipeline(
 std::unique_ptr<ShaderWorker> ShaderCache::CreateWorkers() const {
     return std::make_unique<ShaderWorker>((std::max)(std::thread::hardware_concurrency(), 2U) - 1,
                                           "GlShaderBuilder",
-                                          [this] { return Context{emu_window}; });
+                                          [this] {
+                                              return Context{emu_window,
+                                                             device.HasParallelShaderCompile()};
+                                          });
 }
 
 } // namespace OpenGL
@@ -111,4 +111,19 @@ OGLAssemblyProgram CompileProgram(std::string_view code, GLenum target) {
     return program;
 }
 
+void EnableParallelShaderCompile() {
+    // 0xFFFFFFFF leaves the thread count up to the implementation
+    if (GLAD_GL_KHR_parallel_shader_compile) {
+        glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+    } else if (GLAD_GL_ARB_parallel_shader_compile) {
+        glMaxShaderCompilerThreadsARB(0xFFFFFFFF);
+    }
+}
+
+bool IsProgramLinkComplete(GLuint program) {
+    GLint status{GL_TRUE};
+    glGetProgramiv(program, GL_COMPLETION_STATUS_KHR, &status);
+    return status != GL_FALSE;
+}
+
 } // namespace OpenGL
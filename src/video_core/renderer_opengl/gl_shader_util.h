@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: 2014 Citra Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -18,4 +21,10 @@ OGLProgram CreateProgram(std::span<const u32> code, GLenum stage);
 
 OGLAssemblyProgram CompileProgram(std::string_view code, GLenum target);
 
+/// Lets the driver compile and link programs of the current context on its own threads
+void EnableParallelShaderCompile();
+
+/// Returns true when the program has finished linking, without waiting for it
+bool IsProgramLinkComplete(GLuint program);
+
 } // namespace OpenGL
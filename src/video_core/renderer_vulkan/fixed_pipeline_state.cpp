@@ -9,8 +9,8 @@
 #include <bit>
 #include <numeric>
 #include <ranges>
-#include "common/cityhash.h"
 #include "common/common_types.h"
+#include "common/hash.h"
 #include "common/settings.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/renderer_vulkan/fixed_pipeline_state.h"
@@ -379,7 +379,7 @@ void FixedPipelineState::DynamicState::Refresh3(const Maxwell& regs,
 }
 
 size_t FixedPipelineState::Hash() const noexcept {
-    const u64 hash = Common::CityHash64(reinterpret_cast<const char*>(this), Size());
+    const u64 hash = Common::Hash::Hash64(std::span(reinterpret_cast<const u8*>(this), Size()));
     return static_cast<size_t>(hash);
 }
 
@@ -280,6 +280,16 @@ FormatInfo SurfaceFormat(const Device& device, FormatType format_type, bool with
         } else {
             tuple.format = VK_FORMAT_A8B8G8R8_UNORM_PACK32;
         }
+        // BC1 to BC5 can be decoded by a compute shader straight into the image
+        const bool is_gpu_decodable = pixel_format != PixelFormat::BC6H_SFLOAT &&
+                                      pixel_format != PixelFormat::BC6H_UFLOAT &&
+                                      pixel_format != PixelFormat::BC7_UNORM &&
+                                      pixel_format != PixelFormat::BC7_SRGB;
+        if (is_gpu_decodable && !is_srgb && Settings::values.accelerate_bcn.GetValue() &&
+            device.IsFormatSupported(tuple.format, VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT,
+                                     FormatType::Optimal)) {
+            tuple.usage |= usage_storage;
+        }
     } else if (!device.IsOptimalEtc2Supported() && VideoCore::Surface::IsPixelFormatETC2(pixel_format)) {
         // Transcode on hardware that doesn't support ETC2 natively
         if (pixel_format == PixelFormat::EAC_R11_SNORM) {
@@ -0,0 +1,260 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "common/div_ceil.h"
+
+#include "video_core/host_shaders/vulkan_frame_interpolation_blend_frag_spv.h"
+#include "video_core/host_shaders/vulkan_frame_interpolation_motion_frag_spv.h"
+#include "video_core/host_shaders/vulkan_frame_interpolation_vert_spv.h"
+#include "video_core/renderer_vulkan/present/frame_interpolation.h"
+#include "video_core/renderer_vulkan/present/util.h"
+#include "video_core/renderer_vulkan/vk_scheduler.h"
+#include "video_core/vulkan_common/vulkan_device.h"
+
+namespace Vulkan {
+
+namespace {
+
+/// Size of the blocks the motion is estimated for, must match the shaders
+constexpr u32 BLOCK_SIZE = 16;
+
+/// Motion in pixels, and how well the block matched
+constexpr VkFormat MOTION_FORMAT = VK_FORMAT_R16G16B16A16_SFLOAT;
+
+/// Creates an image for kept frames, which are only copied to and sampled. Unlike the wrapped
+/// images they can't have storage usage, swapchain formats such as sRGB don't support it.
+vk::Image CreateFrameImage(MemoryAllocator& allocator, VkExtent2D extent, VkFormat format) {
+    return allocator.CreateImage(VkImageCreateInfo{
+        .sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+        .imageType = VK_IMAGE_TYPE_2D,
+        .format = format,
+        .extent = {.width = extent.width, .height = extent.height, .depth = 1},
+        .mipLevels = 1,
+        .arrayLayers = 1,
+        .samples = VK_SAMPLE_COUNT_1_BIT,
+        .tiling = VK_IMAGE_TILING_OPTIMAL,
+        .usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+        .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+        .queueFamilyIndexCount = 0,
+        .pQueueFamilyIndices = nullptr,
+        .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+    });
+}
+
+VkImageMemoryBarrier MakeImageBarrier(VkImage image, VkAccessFlags src_access,
+                                      VkAccessFlags dst_access, VkImageLayout old_layout) {
+    return VkImageMemoryBarrier{
+        .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+        .pNext = nullptr,
+        .srcAccessMask = src_access,
+        .dstAccessMask = dst_access,
+        .oldLayout = old_layout,
+        .newLayout = VK_IMAGE_LAYOUT_GENERAL,
+        .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .image = image,
+        .subresourceRange{
+            .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+            .baseMipLevel = 0,
+            .levelCount = 1,
+            .baseArrayLayer = 0,
+            .layerCount = 1,
+        },
+    };
+}
+
+} // Anonymous namespace
+
+FrameInterpolation::FrameInterpolation(const Device& device, MemoryAllocator& allocator,
+                                       VkExtent2D extent, VkFormat format)
+    : m_extent{extent}, m_motion_extent{Common::DivCeil(extent.width, BLOCK_SIZE),
+                                        Common::DivCeil(extent.height, BLOCK_SIZE)},
+      m_format{format} {
+    CreateImages(device, allocator);
+    CreateRenderPasses(device);
+    CreateSampler(device);
+    CreateShaders(device);
+    CreateDescriptorPool(device);
+    CreateDescriptorSetLayouts(device);
+    CreateDescriptorSets(device);
+    CreatePipelineLayouts(device);
+    CreatePipelines(device);
+    UpdateDescriptorSets(device);
+}
+
+FrameInterpolation::~FrameInterpolation() = default;
+
+bool FrameInterpolation::IsCompatible(VkExtent2D extent, VkFormat format) const noexcept {
+    return extent.width == m_extent.width && extent.height == m_extent.height &&
+           format == m_format;
+}
+
+void FrameInterpolation::CreateImages(const Device& device, MemoryAllocator& allocator) {
+    for (size_t i = 0; i < m_frames.size(); i++) {
+        m_frames[i] = CreateFrameImage(allocator, m_extent, m_format);
+        m_frame_views[i] = CreateWrappedImageView(device, m_frames[i], m_format);
+    }
+    m_motion_image = CreateWrappedImage(allocator, m_motion_extent, MOTION_FORMAT);
+    m_motion_view = CreateWrappedImageView(device, m_motion_image, MOTION_FORMAT);
+}
+
+void FrameInterpolation::CreateRenderPasses(const Device& device) {
+    // Both passes overwrite their whole target
+    m_motion_renderpass =
+        CreateWrappedRenderPass(device, MOTION_FORMAT, VK_IMAGE_LAYOUT_UNDEFINED);
+    m_blend_renderpass = CreateWrappedRenderPass(device, m_format, VK_IMAGE_LAYOUT_UNDEFINED);
+    m_motion_framebuffer =
+        CreateWrappedFramebuffer(device, m_motion_renderpass, m_motion_view, m_motion_extent);
+}
+
+void FrameInterpolation::CreateSampler(const Device& device) {
+    m_sampler = CreateWrappedSampler(device);
+}
+
+void FrameInterpolation::CreateShaders(const Device& device) {
+    m_vertex_shader = CreateWrappedShaderModule(device, VULKAN_FRAME_INTERPOLATION_VERT_SPV);
+    m_motion_shader =
+        CreateWrappedShaderModule(device, VULKAN_FRAME_INTERPOLATION_MOTION_FRAG_SPV);
+    m_blend_shader = CreateWrappedShaderModule(device, VULKAN_FRAME_INTERPOLATION_BLEND_FRAG_SPV);
+}
+
+void FrameInterpolation::CreateDescriptorPool(const Device& device) {
+    // 2 motion sets of 2 descriptors and 2 blend sets of 3 descriptors
+    m_descriptor_pool = CreateWrappedDescriptorPool(device, 10, 4);
+}
+
+void FrameInterpolation::CreateDescriptorSetLayouts(const Device& device) {
+    m_motion_descriptor_set_layout =
+        CreateWrappedDescriptorSetLayout(device, {VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                                                  VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER});
+    m_blend_descriptor_set_layout =
+        CreateWrappedDescriptorSetLayout(device, {VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                                                  VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                                                  VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER});
+}
+
+void FrameInterpolation::CreateDescriptorSets(const Device& device) {
+    const VkDescriptorSetLayout motion_layout = *m_motion_descriptor_set_layout;
+    const VkDescriptorSetLayout blend_layout = *m_blend_descriptor_set_layout;
+    m_motion_descriptor_sets =
+        CreateWrappedDescriptorSets(m_descriptor_pool, {motion_layout, motion_layout});
+    m_blend_descriptor_sets =
+        CreateWrappedDescriptorSets(m_descriptor_pool, {blend_layout, blend_layout});
+}
+
+void FrameInterpolation::CreatePipelineLayouts(const Device& device) {
+    m_motion_pipeline_layout = CreateWrappedPipelineLayout(device, m_motion_descriptor_set_layout);
+    m_blend_pipeline_layout = CreateWrappedPipelineLayout(device, m_blend_descriptor_set_layout);
+}
+
+void FrameInterpolation::CreatePipelines(const Device& device) {
+    m_motion_pipeline = CreateWrappedPipeline(device, m_motion_renderpass, m_motion_pipeline_layout,
+                                              std::tie(m_vertex_shader, m_motion_shader));
+    m_blend_pipeline = CreateWrappedPipeline(device, m_blend_renderpass, m_blend_pipeline_layout,
+                                             std::tie(m_vertex_shader, m_blend_shader));
+}
+
+void FrameInterpolation::UpdateDescriptorSets(const Device& device) {
+    std::vector<VkDescriptorImageInfo> image_infos;
+    std::vector<VkWriteDescriptorSet> updates;
+    image_infos.reserve(10);
+
+    for (u32 newest = 0; newest < 2; newest++) {
+        const VkImageView prev_view = *m_frame_views[newest ^ 1];
+        const VkImageView cur_view = *m_frame_views[newest];
+        const VkDescriptorSet motion_set = m_motion_descriptor_sets[newest];
+        const VkDescriptorSet blend_set = m_blend_descriptor_sets[newest];
+        updates.push_back(CreateWriteDescriptorSet(image_infos, *m_sampler, prev_view, motion_set, 0));
+        updates.push_back(CreateWriteDescriptorSet(image_infos, *m_sampler, cur_view, motion_set, 1));
+        updates.push_back(CreateWriteDescriptorSet(image_infos, *m_sampler, prev_view, blend_set, 0));
+        updates.push_back(CreateWriteDescriptorSet(image_infos, *m_sampler, cur_view, blend_set, 1));
+        updates.push_back(
+            CreateWriteDescriptorSet(image_infos, *m_sampler, *m_motion_view, blend_set, 2));
+    }
+
+    device.GetLogical().UpdateDescriptorSets(updates, {});
+}
+
+void FrameInterpolation::KeepFrame(Scheduler& scheduler, VkImage image) {
+    m_newest_frame ^= 1;
+    m_kept_frames = (std::min)(m_kept_frames + 1, 2U);
+
+    const VkImage kept_image = *m_frames[m_newest_frame];
+    const VkExtent2D extent = m_extent;
+
+    scheduler.RequestOutsideRenderPassOperationContext();
+    scheduler.Record([=](vk::CommandBuffer cmdbuf) {
+        // The kept image is overwritten, its contents from two frames ago are not needed
+        const std::array pre_barriers{
+            MakeImageBarrier(image,
+                             VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT,
+                             VK_ACCESS_TRANSFER_READ_BIT, VK_IMAGE_LAYOUT_GENERAL),
+            MakeImageBarrier(kept_image, VK_ACCESS_SHADER_READ_BIT, VK_ACCESS_TRANSFER_WRITE_BIT,
+                             VK_IMAGE_LAYOUT_UNDEFINED),
+        };
+        const VkImageMemoryBarrier post_barrier = MakeImageBarrier(
+            kept_image, VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT,
+            VK_IMAGE_LAYOUT_GENERAL);
+        const VkImageSubresourceLayers subresource{
+            .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+            .mipLevel = 0,
+            .baseArrayLayer = 0,
+            .layerCount = 1,
+        };
+        const VkImageCopy copy{
+            .srcSubresource = subresource,
+            .srcOffset = {0, 0, 0},
+            .dstSubresource = subresource,
+            .dstOffset = {0, 0, 0},
+            .extent = {extent.width, extent.height, 1},
+        };
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT,
+                               VK_PIPELINE_STAGE_TRANSFER_BIT, 0, {}, {}, pre_barriers);
+        cmdbuf.CopyImage(image, VK_IMAGE_LAYOUT_GENERAL, kept_image, VK_IMAGE_LAYOUT_GENERAL,
+                         copy);
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT,
+                               VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, post_barrier);
+    });
+}
+
+void FrameInterpolation::Draw(Scheduler& scheduler, VkImage dst_image,
+                              VkFramebuffer dst_framebuffer) {
+    const VkImage motion_image = *m_motion_image;
+    const VkFramebuffer motion_framebuffer = *m_motion_framebuffer;
+    const VkRenderPass motion_renderpass = *m_motion_renderpass;
+    const VkRenderPass blend_renderpass = *m_blend_renderpass;
+    const VkPipeline motion_pipeline = *m_motion_pipeline;
+    const VkPipeline blend_pipeline = *m_blend_pipeline;
+    const VkPipelineLayout motion_layout = *m_motion_pipeline_layout;
+    const VkPipelineLayout blend_layout = *m_blend_pipeline_layout;
+    const VkDescriptorSet motion_set = m_motion_descriptor_sets[m_newest_frame];
+    const VkDescriptorSet blend_set = m_blend_descriptor_sets[m_newest_frame];
+    const VkExtent2D motion_extent = m_motion_extent;
+    const VkExtent2D extent = m_extent;
+
+    scheduler.RequestOutsideRenderPassOperationContext();
+    scheduler.Record([=](vk::CommandBuffer cmdbuf) {
+        BeginRenderPass(cmdbuf, motion_renderpass, motion_framebuffer, motion_extent);
+        cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, motion_pipeline);
+        cmdbuf.BindDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS, motion_layout, 0, motion_set,
+                                  {});
+        cmdbuf.Draw(3, 1, 0, 0);
+        cmdbuf.EndRenderPass();
+        TransitionImageLayout(cmdbuf, motion_image, VK_IMAGE_LAYOUT_GENERAL);
+
+        BeginRenderPass(cmdbuf, blend_renderpass, dst_framebuffer, extent);
+        cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, blend_pipeline);
+        cmdbuf.BindDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS, blend_layout, 0, blend_set, {});
+        cmdbuf.Draw(3, 1, 0, 0);
+        cmdbuf.EndRenderPass();
+        TransitionImageLayout(cmdbuf, dst_image, VK_IMAGE_LAYOUT_GENERAL);
+    });
+}
+
+} // namespace Vulkan
@@ -0,0 +1,96 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <array>
+
+#include "common/common_types.h"
+#include "video_core/vulkan_common/vulkan_memory_allocator.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace Vulkan {
+
+class Device;
+class Scheduler;
+
+/**
+ * Draws the frame halfway between two presented frames. The motion of each block of the frame is
+ * estimated from the previous one, and both frames are moved halfway along it before they are
+ * blended, so moving content doesn't ghost. Where no good match is found the newest frame is used.
+ */
+class FrameInterpolation {
+public:
+    explicit FrameInterpolation(const Device& device, MemoryAllocator& allocator,
+                                VkExtent2D extent, VkFormat format);
+    ~FrameInterpolation();
+
+    [[nodiscard]] VkExtent2D GetExtent() const noexcept {
+        return m_extent;
+    }
+
+    /// Whether frames of this size and view format can be interpolated
+    [[nodiscard]] bool IsCompatible(VkExtent2D extent, VkFormat format) const noexcept;
+
+    /// Whether a frame is kept to interpolate the next one from
+    [[nodiscard]] bool HasFrame() const noexcept {
+        return m_kept_frames > 0;
+    }
+
+    /// Keeps a copy of a frame image in the general layout, of the size of the pass. The image
+    /// must hold texels of the view format of the pass.
+    void KeepFrame(Scheduler& scheduler, VkImage image);
+
+    /// Draws the frame halfway between the last two kept frames into a framebuffer of the size
+    /// and view format of the pass
+    void Draw(Scheduler& scheduler, VkImage dst_image, VkFramebuffer dst_framebuffer);
+
+    /// Forgets the kept frames
+    void Reset() noexcept {
+        m_kept_frames = 0;
+    }
+
+private:
+    void CreateImages(const Device& device, MemoryAllocator& allocator);
+    void CreateRenderPasses(const Device& device);
+    void CreateSampler(const Device& device);
+    void CreateShaders(const Device& device);
+    void CreateDescriptorPool(const Device& device);
+    void CreateDescriptorSetLayouts(const Device& device);
+    void CreateDescriptorSets(const Device& device);
+    void CreatePipelineLayouts(const Device& device);
+    void CreatePipelines(const Device& device);
+    void UpdateDescriptorSets(const Device& device);
+
+    const VkExtent2D m_extent;
+    const VkExtent2D m_motion_extent;
+    const VkFormat m_format;
+
+    // The kept frames alternate between the two images, the descriptor sets are indexed by the
+    // image kept last
+    std::array<vk::Image, 2> m_frames{};
+    std::array<vk::ImageView, 2> m_frame_views{};
+    u32 m_newest_frame{};
+    u32 m_kept_frames{};
+
+    vk::Image m_motion_image{};
+    vk::ImageView m_motion_view{};
+    vk::Framebuffer m_motion_framebuffer{};
+    vk::RenderPass m_motion_renderpass{};
+    vk::RenderPass m_blend_renderpass{};
+    vk::Sampler m_sampler{};
+    vk::ShaderModule m_vertex_shader{};
+    vk::ShaderModule m_motion_shader{};
+    vk::ShaderModule m_blend_shader{};
+    vk::DescriptorPool m_descriptor_pool{};
+    vk::DescriptorSetLayout m_motion_descriptor_set_layout{};
+    vk::DescriptorSetLayout m_blend_descriptor_set_layout{};
+    vk::DescriptorSets m_motion_descriptor_sets{};
+    vk::DescriptorSets m_blend_descriptor_sets{};
+    vk::PipelineLayout m_motion_pipeline_layout{};
+    vk::PipelineLayout m_blend_pipeline_layout{};
+    vk::Pipeline m_motion_pipeline{};
+    vk::Pipeline m_blend_pipeline{};
+};
+
+} // namespace Vulkan
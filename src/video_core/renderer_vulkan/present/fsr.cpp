@@ -9,11 +9,8 @@
 #include "common/settings.h"
 
 #include "video_core/fsr.h"
-#include "video_core/host_shaders/vulkan_fidelityfx_fsr_easu_fp16_frag_spv.h"
-#include "video_core/host_shaders/vulkan_fidelityfx_fsr_easu_fp32_frag_spv.h"
-#include "video_core/host_shaders/vulkan_fidelityfx_fsr_rcas_fp16_frag_spv.h"
-#include "video_core/host_shaders/vulkan_fidelityfx_fsr_rcas_fp32_frag_spv.h"
-#include "video_core/host_shaders/vulkan_fidelityfx_fsr_vert_spv.h"
+#include "video_core/host_shaders/vulkan_fidelityfx_fsr_fused_fp16_comp_spv.h"
+#include "video_core/host_shaders/vulkan_fidelityfx_fsr_fused_fp32_comp_spv.h"
 #include "video_core/renderer_vulkan/present/fsr.h"
 #include "video_core/renderer_vulkan/present/util.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
@@ -23,7 +20,10 @@
 namespace Vulkan {
 using namespace FSR;
 
-using PushConstants = std::array<u32, 4 * 4>;
+// EASU constants followed by the RCAS constants
+using PushConstants = std::array<u32, 4 * 5>;
+
+constexpr u32 TILE_SIZE = 8;
 
 FSR::FSR(const Device& device, MemoryAllocator& memory_allocator, size_t image_count, VkExtent2D extent)
     : m_memory_allocator{memory_allocator}
@@ -31,7 +31,6 @@ FSR::FSR(const Device& device, MemoryAllocator& memory_allocator, size_t image_c
     , m_extent{extent}
 {
     CreateImages(device);
-    CreateRenderPasses(device);
     CreateSampler(device);
     CreateShaders(device);
     CreateDescriptorPool(device);
@@ -44,18 +43,8 @@ FSR::FSR(const Device& device, MemoryAllocator& memory_allocator, size_t image_c
 void FSR::CreateImages(const Device& device) {
     m_dynamic_images.resize(m_image_count);
     for (auto& images : m_dynamic_images) {
-        images.images[Easu] = CreateWrappedImage(m_memory_allocator, m_extent, VK_FORMAT_R16G16B16A16_SFLOAT);
-        images.images[Rcas] = CreateWrappedImage(m_memory_allocator, m_extent, VK_FORMAT_R16G16B16A16_SFLOAT);
-        images.image_views[Easu] = CreateWrappedImageView(device, images.images[Easu], VK_FORMAT_R16G16B16A16_SFLOAT);
-        images.image_views[Rcas] = CreateWrappedImageView(device, images.images[Rcas], VK_FORMAT_R16G16B16A16_SFLOAT);
-    }
-}
-
-void FSR::CreateRenderPasses(const Device& device) {
-    m_renderpass = CreateWrappedRenderPass(device, VK_FORMAT_R16G16B16A16_SFLOAT);
-    for (auto& images : m_dynamic_images) {
-        images.framebuffers[Easu] = CreateWrappedFramebuffer(device, m_renderpass, images.image_views[Easu], m_extent);
-        images.framebuffers[Rcas] = CreateWrappedFramebuffer(device, m_renderpass, images.image_views[Rcas], m_extent);
+        images.image = CreateWrappedImage(m_memory_allocator, m_extent, VK_FORMAT_R16G16B16A16_SFLOAT);
+        images.image_view = CreateWrappedImageView(device, images.image, VK_FORMAT_R16G16B16A16_SFLOAT);
     }
 }
 
@@ -64,37 +53,35 @@ void FSR::CreateSampler(const Device& device) {
 }
 
 void FSR::CreateShaders(const Device& device) {
-    m_vert_shader = BuildShader(device, VULKAN_FIDELITYFX_FSR_VERT_SPV);
-
     if (device.IsFloat16Supported()) {
-        m_easu_shader = BuildShader(device, VULKAN_FIDELITYFX_FSR_EASU_FP16_FRAG_SPV);
-        m_rcas_shader = BuildShader(device, VULKAN_FIDELITYFX_FSR_RCAS_FP16_FRAG_SPV);
+        m_shader = BuildShader(device, VULKAN_FIDELITYFX_FSR_FUSED_FP16_COMP_SPV);
     } else {
-        m_easu_shader = BuildShader(device, VULKAN_FIDELITYFX_FSR_EASU_FP32_FRAG_SPV);
-        m_rcas_shader = BuildShader(device, VULKAN_FIDELITYFX_FSR_RCAS_FP32_FRAG_SPV);
+        m_shader = BuildShader(device, VULKAN_FIDELITYFX_FSR_FUSED_FP32_COMP_SPV);
     }
 }
 
 void FSR::CreateDescriptorPool(const Device& device) {
-    // EASU: 1 descriptor
-    // RCAS: 1 descriptor
-    // 2 descriptors, 2 descriptor sets per invocation
-    m_descriptor_pool = CreateWrappedDescriptorPool(device, 2 * m_image_count, 2 * m_image_count);
+    // EASU input and RCAS output, 1 descriptor set per invocation
+    m_descriptor_pool = CreateWrappedDescriptorPool(
+        device, m_image_count, m_image_count,
+        {VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE});
 }
 
 void FSR::CreateDescriptorSetLayout(const Device& device) {
-    m_descriptor_set_layout = CreateWrappedDescriptorSetLayout(device, {VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER});
+    m_descriptor_set_layout = CreateWrappedDescriptorSetLayout(
+        device, {VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE},
+        VK_SHADER_STAGE_COMPUTE_BIT);
 }
 
 void FSR::CreateDescriptorSets(const Device& device) {
-    std::vector<VkDescriptorSetLayout> layouts(MaxFsrStage, *m_descriptor_set_layout);
+    std::vector<VkDescriptorSetLayout> layouts(1, *m_descriptor_set_layout);
     for (auto& images : m_dynamic_images)
         images.descriptor_sets = CreateWrappedDescriptorSets(m_descriptor_pool, layouts);
 }
 
 void FSR::CreatePipelineLayouts(const Device& device) {
     const VkPushConstantRange range{
-        .stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT,
+        .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
         .offset = 0,
         .size = sizeof(PushConstants),
     };
@@ -112,10 +99,23 @@ void FSR::CreatePipelineLayouts(const Device& device) {
 }
 
 void FSR::CreatePipelines(const Device& device) {
-    m_easu_pipeline = CreateWrappedPipeline(device, m_renderpass, m_pipeline_layout,
-                                            std::tie(m_vert_shader, m_easu_shader));
-    m_rcas_pipeline = CreateWrappedPipeline(device, m_renderpass, m_pipeline_layout,
-                                            std::tie(m_vert_shader, m_rcas_shader));
+    m_pipeline = device.GetLogical().CreateComputePipeline(VkComputePipelineCreateInfo{
+        .sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+        .stage{
+            .sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .stage = VK_SHADER_STAGE_COMPUTE_BIT,
+            .module = *m_shader,
+            .pName = "main",
+            .pSpecializationInfo = nullptr,
+        },
+        .layout = *m_pipeline_layout,
+        .basePipelineHandle = {},
+        .basePipelineIndex = 0,
+    });
 }
 
 void FSR::UpdateDescriptorSets(const Device& device, VkImageView image_view, size_t image_index) {
@@ -123,9 +123,11 @@ void FSR::UpdateDescriptorSets(const Device& device, VkImageView image_view, siz
     std::vector<VkDescriptorImageInfo> image_infos;
     image_infos.reserve(2);
     std::vector<VkWriteDescriptorSet> updates{
-        CreateWriteDescriptorSet(image_infos, *m_sampler, image_view, images.descriptor_sets[Easu], 0),
-        CreateWriteDescriptorSet(image_infos, *m_sampler, *images.image_views[Easu], images.descriptor_sets[Rcas], 0)
+        CreateWriteDescriptorSet(image_infos, *m_sampler, image_view, images.descriptor_sets[0], 0),
+        CreateWriteDescriptorSet(image_infos, VK_NULL_HANDLE, *images.image_view,
+                                 images.descriptor_sets[0], 1),
     };
+    updates[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
     device.GetLogical().UpdateDescriptorSets(updates, {});
 }
 
@@ -134,8 +136,7 @@ void FSR::UploadImages(const Device& device, Scheduler& scheduler) {
         m_images_ready = true;
         scheduler.Record([&](vk::CommandBuffer cmdbuf) {
             for (auto& image : m_dynamic_images) {
-                ClearColorImage(cmdbuf, *image.images[Easu]);
-                ClearColorImage(cmdbuf, *image.images[Rcas]);
+                ClearColorImage(cmdbuf, *image.image);
             }
         });
         scheduler.Finish();
@@ -147,16 +148,10 @@ VkImageView FSR::Draw(const Device& device, Scheduler& scheduler, size_t image_i
                       const Common::Rectangle<f32>& crop_rect) {
     Images& images = m_dynamic_images[image_index];
 
-    VkImage easu_image = *images.images[Easu];
-    VkImage rcas_image = *images.images[Rcas];
-    VkDescriptorSet easu_descriptor_set = images.descriptor_sets[Easu];
-    VkDescriptorSet rcas_descriptor_set = images.descriptor_sets[Rcas];
-    VkFramebuffer easu_framebuffer = *images.framebuffers[Easu];
-    VkFramebuffer rcas_framebuffer = *images.framebuffers[Rcas];
-    VkPipeline easu_pipeline = *m_easu_pipeline;
-    VkPipeline rcas_pipeline = *m_rcas_pipeline;
+    VkImage image = *images.image;
+    VkDescriptorSet descriptor_set = images.descriptor_sets[0];
+    VkPipeline pipeline = *m_pipeline;
     VkPipelineLayout pipeline_layout = *m_pipeline_layout;
-    VkRenderPass renderpass = *m_renderpass;
     VkExtent2D extent = m_extent;
 
     const f32 input_image_width = static_cast<f32>(input_image_extent.width);
@@ -168,16 +163,15 @@ VkImageView FSR::Draw(const Device& device, Scheduler& scheduler, size_t image_i
     const f32 viewport_height = (crop_rect.bottom - crop_rect.top) * input_image_height;
     const f32 viewport_y = crop_rect.top * input_image_height;
 
-    PushConstants easu_con{};
-    PushConstants rcas_con{};
-    FsrEasuConOffset(easu_con.data() + 0, easu_con.data() + 4, easu_con.data() + 8,
-                     easu_con.data() + 12, viewport_width, viewport_height, input_image_width,
-                     input_image_height, output_image_width, output_image_height, viewport_x,
-                     viewport_y);
+    PushConstants push_constants{};
+    FsrEasuConOffset(push_constants.data() + 0, push_constants.data() + 4,
+                     push_constants.data() + 8, push_constants.data() + 12, viewport_width,
+                     viewport_height, input_image_width, input_image_height, output_image_width,
+                     output_image_height, viewport_x, viewport_y);
 
     const float sharpening =
         static_cast<float>(Settings::values.fsr_sharpening_slider.GetValue()) / 100.0f;
-    FsrRcasCon(rcas_con.data(), sharpening);
+    FsrRcasCon(push_constants.data() + 16, sharpening);
 
     UploadImages(device, scheduler);
     UpdateDescriptorSets(device, source_image_view, image_index);
@@ -185,29 +179,17 @@ VkImageView FSR::Draw(const Device& device, Scheduler& scheduler, size_t image_i
     scheduler.RequestOutsideRenderPassOperationContext();
     scheduler.Record([=](vk::CommandBuffer cmdbuf) {
         TransitionImageLayout(cmdbuf, source_image, VK_IMAGE_LAYOUT_GENERAL);
-        TransitionImageLayout(cmdbuf, easu_image, VK_IMAGE_LAYOUT_GENERAL);
-        BeginRenderPass(cmdbuf, renderpass, easu_framebuffer, extent);
-        cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, easu_pipeline);
-        cmdbuf.BindDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout, 0,
-                                  easu_descriptor_set, {});
-        cmdbuf.PushConstants(pipeline_layout, VK_SHADER_STAGE_FRAGMENT_BIT, easu_con);
-        cmdbuf.Draw(3, 1, 0, 0);
-        cmdbuf.EndRenderPass();
-
-        TransitionImageLayout(cmdbuf, easu_image, VK_IMAGE_LAYOUT_GENERAL);
-        TransitionImageLayout(cmdbuf, rcas_image, VK_IMAGE_LAYOUT_GENERAL);
-        BeginRenderPass(cmdbuf, renderpass, rcas_framebuffer, extent);
-        cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, rcas_pipeline);
-        cmdbuf.BindDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout, 0,
-                                  rcas_descriptor_set, {});
-        cmdbuf.PushConstants(pipeline_layout, VK_SHADER_STAGE_FRAGMENT_BIT, rcas_con);
-        cmdbuf.Draw(3, 1, 0, 0);
-        cmdbuf.EndRenderPass();
-
-        TransitionImageLayout(cmdbuf, rcas_image, VK_IMAGE_LAYOUT_GENERAL);
+        TransitionImageLayout(cmdbuf, image, VK_IMAGE_LAYOUT_GENERAL);
+        cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
+        cmdbuf.BindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, pipeline_layout, 0,
+                                  descriptor_set, {});
+        cmdbuf.PushConstants(pipeline_layout, VK_SHADER_STAGE_COMPUTE_BIT, push_constants);
+        cmdbuf.Dispatch(Common::DivCeil(extent.width, TILE_SIZE),
+                        Common::DivCeil(extent.height, TILE_SIZE), 1);
+        TransitionImageLayout(cmdbuf, image, VK_IMAGE_LAYOUT_GENERAL);
     });
 
-    return *images.image_views[Rcas];
+    return *images.image_view;
 }
 
 } // namespace Vulkan
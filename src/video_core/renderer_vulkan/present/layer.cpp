@@ -22,6 +22,7 @@
 #include "video_core/renderer_vulkan/present/smaa.h"
 #include "video_core/renderer_vulkan/present/util.h"
 #include "video_core/renderer_vulkan/vk_blit_screen.h"
+#include "video_core/renderer_vulkan/vk_present_manager.h"
 #include "video_core/textures/decoders.h"
 
 namespace Vulkan {
@@ -136,6 +137,143 @@ void Layer::ConfigureDraw(const Device& device, PresentPushConstants* out_push_c
     *out_descriptor_set = descriptor_sets[image_index];
 }
 
+bool Layer::CopyToFrame(const Device& device, RasterizerVulkan& rasterizer, size_t image_index,
+                        const Tegra::FramebufferConfig& framebuffer, Frame* dst) {
+    using Service::android::BufferTransformFlags;
+
+    if (!std::holds_alternative<std::monostate>(sr_filter)) {
+        return false;
+    }
+    const auto flips = BufferTransformFlags::FlipH | BufferTransformFlags::FlipV;
+    if (True(framebuffer.transform_flags & ~flips)) {
+        return false;
+    }
+    Common::Rectangle<int> crop = framebuffer.crop_rect;
+    if (crop.IsEmpty()) {
+        crop = {0, 0, static_cast<int>(framebuffer.width), static_cast<int>(framebuffer.height)};
+    }
+    if (crop.left < 0 || crop.top < 0 || crop.GetWidth() != static_cast<int>(dst->width) ||
+        crop.GetHeight() != static_cast<int>(dst->height)) {
+        return false;
+    }
+
+    const auto texture_info = rasterizer.AccelerateDisplay(
+        framebuffer, framebuffer.address + framebuffer.offset, framebuffer.stride);
+    const u32 texture_width = texture_info ? texture_info->width : framebuffer.width;
+    const u32 texture_height = texture_info ? texture_info->height : framebuffer.height;
+    if (static_cast<u32>(crop.right) > texture_width ||
+        static_cast<u32>(crop.bottom) > texture_height) {
+        return false;
+    }
+    if (texture_info && (texture_info->scaled_width != texture_info->width ||
+                         texture_info->scaled_height != texture_info->height)) {
+        return false;
+    }
+    const VkFormat format = texture_info ? texture_info->format : GetFormat(framebuffer);
+    if (format == VK_FORMAT_UNDEFINED ||
+        !device.IsFormatSupported(format, VK_FORMAT_FEATURE_BLIT_SRC_BIT, FormatType::Optimal)) {
+        return false;
+    }
+
+    RefreshResources(device, framebuffer);
+
+    scheduler.RequestOutsideRenderPassOperationContext();
+    scheduler.Wait(resource_ticks[image_index]);
+    SCOPE_EXIT {
+        resource_ticks[image_index] = scheduler.CurrentTick();
+    };
+
+    if (!texture_info) {
+        UpdateRawImage(framebuffer, image_index);
+    }
+
+    // Flips are done by swapping the corners of the source region
+    VkOffset3D src_begin{crop.left, crop.top, 0};
+    VkOffset3D src_end{crop.right, crop.bottom, 1};
+    if (True(framebuffer.transform_flags & BufferTransformFlags::FlipH)) {
+        std::swap(src_begin.x, src_end.x);
+    }
+    if (True(framebuffer.transform_flags & BufferTransformFlags::FlipV)) {
+        std::swap(src_begin.y, src_end.y);
+    }
+    static constexpr VkImageSubresourceLayers subresource{
+        .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+        .mipLevel = 0,
+        .baseArrayLayer = 0,
+        .layerCount = 1,
+    };
+    const VkImageBlit blit{
+        .srcSubresource = subresource,
+        .srcOffsets = {src_begin, src_end},
+        .dstSubresource = subresource,
+        .dstOffsets =
+            {
+                VkOffset3D{0, 0, 0},
+                VkOffset3D{static_cast<s32>(dst->width), static_cast<s32>(dst->height), 1},
+            },
+    };
+
+    const VkImage source_image = texture_info ? texture_info->image : *raw_images[image_index];
+    const VkImage frame_image = *dst->image;
+    scheduler.Record([source_image, frame_image, blit](vk::CommandBuffer cmdbuf) {
+        static constexpr VkImageSubresourceRange range{
+            .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+            .baseMipLevel = 0,
+            .levelCount = 1,
+            .baseArrayLayer = 0,
+            .layerCount = 1,
+        };
+        const std::array pre_barriers{
+            VkImageMemoryBarrier{
+                .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+                .pNext = nullptr,
+                .srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT |
+                                 VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT |
+                                 VK_ACCESS_TRANSFER_WRITE_BIT,
+                .dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT,
+                .oldLayout = VK_IMAGE_LAYOUT_GENERAL,
+                .newLayout = VK_IMAGE_LAYOUT_GENERAL,
+                .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                .image = source_image,
+                .subresourceRange = range,
+            },
+            VkImageMemoryBarrier{
+                .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+                .pNext = nullptr,
+                .srcAccessMask = 0,
+                .dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+                .oldLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+                .newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                .image = frame_image,
+                .subresourceRange = range,
+            },
+        };
+        // The presentation expects the frame in the layout the render pass leaves it in
+        const VkImageMemoryBarrier post_barrier{
+            .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+            .pNext = nullptr,
+            .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+            .dstAccessMask = VK_ACCESS_MEMORY_READ_BIT,
+            .oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            .newLayout = VK_IMAGE_LAYOUT_GENERAL,
+            .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .image = frame_image,
+            .subresourceRange = range,
+        };
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                               0, {}, {}, pre_barriers);
+        cmdbuf.BlitImage(source_image, VK_IMAGE_LAYOUT_GENERAL, frame_image,
+                         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, blit, VK_FILTER_NEAREST);
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                               0, post_barrier);
+    });
+    return true;
+}
+
 void Layer::CreateDescriptorPool(const Device& device) {
     descriptor_pool = CreateWrappedDescriptorPool(device, image_count, image_count);
 }
@@ -191,15 +329,19 @@ void Layer::RefreshResources(const Device& device, const Tegra::FramebufferConfi
 }
 
 void Layer::SetAntiAliasPass(const Device& device) {
-    if (!std::holds_alternative<std::monostate>(anti_alias) && anti_alias_setting == filters.get_anti_aliasing())
-        return;
-
-    anti_alias_setting = filters.get_anti_aliasing();
-
+    // The resolution can change while running with dynamic resolution
     const VkExtent2D render_area{
         .width = Settings::values.resolution_info.ScaleUp(raw_width),
         .height = Settings::values.resolution_info.ScaleUp(raw_height),
     };
+    if (!std::holds_alternative<std::monostate>(anti_alias) &&
+        anti_alias_setting == filters.get_anti_aliasing() &&
+        anti_alias_extent.width == render_area.width &&
+        anti_alias_extent.height == render_area.height)
+        return;
+
+    anti_alias_setting = filters.get_anti_aliasing();
+    anti_alias_extent = render_area;
 
     switch (anti_alias_setting) {
     case Settings::AntiAliasing::Fxaa:
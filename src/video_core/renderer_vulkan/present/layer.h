@@ -39,6 +39,7 @@ namespace Vulkan {
 
 class AntiAliasPass;
 class Device;
+struct Frame;
 class MemoryAllocator;
 struct PresentPushConstants;
 class RasterizerVulkan;
@@ -58,6 +59,13 @@ public:
                        const Tegra::FramebufferConfig& framebuffer,
                        const Layout::FramebufferLayout& layout);
 
+    /**
+     * Copy the layer straight into a frame it fills pixel for pixel, without drawing it.
+     * @return False when the layer can't be copied and has to be drawn instead
+     */
+    bool CopyToFrame(const Device& device, RasterizerVulkan& rasterizer, size_t image_index,
+                     const Tegra::FramebufferConfig& framebuffer, Frame* dst);
+
 private:
     void CreateDescriptorPool(const Device& device);
     void CreateDescriptorSets(const Device& device, VkDescriptorSetLayout layout);
@@ -93,6 +101,7 @@ private:
     Service::android::PixelFormat pixel_format{};
 
     Settings::AntiAliasing anti_alias_setting{};
+    VkExtent2D anti_alias_extent{};
     std::variant<std::monostate, FXAA, SMAA> anti_alias{};
     std::variant<std::monostate, SGSR, FSR> sr_filter{};
     std::vector<u64> resource_ticks{};
@@ -21,6 +21,7 @@
 #include "core/core_timing.h"
 #include "core/frontend/graphics_context.h"
 #include "video_core/capture.h"
+#include "video_core/framebuffer_config.h"
 #include "video_core/gpu.h"
 #include "video_core/present.h"
 #include "video_core/renderer_vulkan/present/util.h"
@@ -87,6 +88,34 @@ std::string BuildCommaSeparatedExtensions(
     return fmt::format("{}", fmt::join(available_extensions, ","));
 }
 
+/// Frames are interpolated when the guest shows them for at least twice the frame pacing period,
+/// e.g. a 30 FPS title paced at 60 Hz
+bool ShouldInterpolateFrame(std::span<const Tegra::FramebufferConfig> framebuffers) {
+    if (!Settings::values.frame_interpolation.GetValue() || framebuffers.empty()) {
+        return false;
+    }
+    s32 swap_interval = framebuffers.front().swap_interval;
+    for (const auto& framebuffer : framebuffers) {
+        swap_interval = (std::min)(swap_interval, framebuffer.swap_interval);
+    }
+    const u32 pacing_rate = [] {
+        switch (Settings::values.frame_pacing_mode.GetValue()) {
+        case Settings::FramePacingMode::Target_30:
+            return 30;
+        case Settings::FramePacingMode::Target_90:
+            return 90;
+        case Settings::FramePacingMode::Target_120:
+            return 120;
+        case Settings::FramePacingMode::Target_Auto:
+        case Settings::FramePacingMode::Target_60:
+        default:
+            return 60;
+        }
+    }();
+    // The guest frame rate assumes a 60 Hz display
+    return swap_interval > 0 && 2 * 60 / static_cast<u32>(swap_interval) <= pacing_rate;
+}
+
 } // Anonymous namespace
 
 Device CreateDevice(const vk::Instance& instance, const vk::InstanceDispatch& dld, VkSurfaceKHR surface) {
@@ -162,6 +191,18 @@ try
         scheduler.RegisterOnSubmit([this] { turbo_mode->QueueSubmitted(); });
     }
 
+    if (Settings::values.dynamic_resolution.GetValue()) {
+        if (device.SupportsTimestamps()) {
+            dynamic_resolution.emplace(Settings::values.dynamic_resolution_min.GetValue(),
+                                       Settings::values.dynamic_resolution_max.GetValue(),
+                                       Settings::values.resolution_setup.GetValue());
+            Settings::TranslateResolutionInfo(dynamic_resolution->Current(),
+                                              Settings::values.resolution_info);
+        } else {
+            LOG_WARNING(Render_Vulkan, "Dynamic resolution needs timestamp queries, ignoring it");
+        }
+    }
+
     Report();
 } catch (const vk::Exception& exception) {
     LOG_ERROR(Render_Vulkan, "Vulkan initialization failed with error: {}", exception.what());
@@ -186,15 +227,57 @@ void RendererVulkan::Composite(std::span<const Tegra::FramebufferConfig> framebu
 
     RenderScreenshot(framebuffers);
     Frame* frame = present_manager.GetRenderFrame();
+    // The interpolated frame needs a second presentation frame while this one is held
+    const bool interpolate =
+        ShouldInterpolateFrame(framebuffers) && present_manager.GetFrameCount() > 1;
 
     scheduler.RequestOutsideRenderPassOperationContext();
+    // The alpha of the frame is ignored once presented, and a copy into the frame doesn't convert
+    // to sRGB like the views the render passes write through, so it can only be used here
+    const bool allow_direct_copy = swapchain.GetImageFormat() == swapchain.GetImageViewFormat();
     blit_swapchain.DrawToFrame(device, rasterizer, frame, framebuffers,
                                render_window.GetFramebufferLayout(), swapchain.GetImageCount(),
-                               swapchain.GetImageViewFormat());
+                               swapchain.GetImageViewFormat(), allow_direct_copy);
+
+    if (!interpolate) {
+        blit_swapchain.ResetInterpolation();
+    } else {
+        const bool can_interpolate = blit_swapchain.CanInterpolateFrame(*frame);
+        blit_swapchain.KeepFrameForInterpolation(device, *frame);
+        if (can_interpolate) {
+            // Shown before the frame, halfway between it and the frame shown before
+            Frame* interpolated_frame = present_manager.GetRenderFrame();
+            blit_swapchain.DrawInterpolatedFrame(interpolated_frame);
+            scheduler.Flush(*interpolated_frame->render_ready);
+            present_manager.Present(interpolated_frame);
+
+            // The frame is signaled by the next submission, which would otherwise be empty and
+            // not wait for the work of this one
+            scheduler.RequestOutsideRenderPassOperationContext();
+            scheduler.Record([](vk::CommandBuffer cmdbuf) {
+                const VkMemoryBarrier barrier{
+                    .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+                    .pNext = nullptr,
+                    .srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT,
+                    .dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT,
+                };
+                cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                       VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, barrier);
+            });
+        }
+    }
     scheduler.Flush(*frame->render_ready);
 
     present_manager.Present(frame);
 
+    if (dynamic_resolution) {
+        const std::chrono::nanoseconds gpu_busy{scheduler.GetAndResetGpuBusyTime()};
+        const auto now = VideoCore::DynamicResolution::Clock::now();
+        if (const auto setup = dynamic_resolution->OnFrame(gpu_busy, now)) {
+            rasterizer.ChangeResolution(*setup);
+        }
+    }
+
     gpu.RendererFrameEndNotify();
     rasterizer.TickFrame();
 }
@@ -11,6 +11,7 @@
 #include <variant>
 
 #include "common/dynamic_library.h"
+#include "video_core/dynamic_resolution.h"
 #include "video_core/host1x/gpu_device_memory_manager.h"
 #include "video_core/renderer_base.h"
 #include "video_core/renderer_vulkan/vk_blit_screen.h"
@@ -96,6 +97,7 @@ private:
     BlitScreen blit_applet;
     RasterizerVulkan rasterizer;
     std::optional<TurboMode> turbo_mode;
+    std::optional<VideoCore::DynamicResolution> dynamic_resolution;
 
     Frame applet_frame;
 };
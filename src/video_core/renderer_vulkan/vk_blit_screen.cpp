@@ -15,6 +15,7 @@
 #include "video_core/renderer_vulkan/vk_blit_screen.h"
 #include "video_core/renderer_vulkan/vk_present_manager.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
+#include "video_core/vulkan_common/vulkan_device.h"
 
 namespace Vulkan {
 
@@ -89,7 +90,8 @@ void BlitScreen::DrawToFrame(const Device& device, RasterizerVulkan& rasterizer,
                              std::span<const Tegra::FramebufferConfig> framebuffers,
                              const Layout::FramebufferLayout& layout,
                              size_t current_swapchain_image_count,
-                             VkFormat current_swapchain_view_format) {
+                             VkFormat current_swapchain_view_format,
+                             bool allow_direct_copy) {
     bool resource_update_required = false;
     bool presentation_recreate_required = false;
 
@@ -134,13 +136,75 @@ void BlitScreen::DrawToFrame(const Device& device, RasterizerVulkan& rasterizer,
         }
     }
 
-    window_adapt->Draw(device, rasterizer, scheduler, image_index, layers, framebuffers, layout, frame);
+    const bool copied = allow_direct_copy && CanCopyDirectly(device, framebuffers, layout) &&
+                        layers.front().CopyToFrame(device, rasterizer, image_index,
+                                                   framebuffers.front(), frame);
+    if (!copied) {
+        window_adapt->Draw(device, rasterizer, scheduler, image_index, layers, framebuffers,
+                           layout, frame);
+    }
 
     if (++image_index >= image_count) {
         image_index = 0;
     }
 }
 
+bool BlitScreen::CanCopyDirectly(const Device& device,
+                                 std::span<const Tegra::FramebufferConfig> framebuffers,
+                                 const Layout::FramebufferLayout& layout) const {
+    // A single opaque layer shown 1:1 looks the same whether it is drawn or copied
+    if (framebuffers.size() != 1 || framebuffers.front().blending != Tegra::BlendMode::Opaque) {
+        return false;
+    }
+    if (scaling_filter != Settings::ScalingFilter::Bilinear &&
+        scaling_filter != Settings::ScalingFilter::NearestNeighbor) {
+        return false;
+    }
+    if (filters.get_anti_aliasing() != Settings::AntiAliasing::None ||
+        Settings::values.resolution_info.active) {
+        return false;
+    }
+    const auto& screen = layout.screen;
+    if (screen.left != 0 || screen.top != 0 || screen.GetWidth() != layout.width ||
+        screen.GetHeight() != layout.height) {
+        return false;
+    }
+    return device.IsFormatSupported(swapchain_view_format, VK_FORMAT_FEATURE_BLIT_DST_BIT,
+                                    FormatType::Optimal);
+}
+
+bool BlitScreen::CanInterpolateFrame(const Frame& frame) const {
+    return frame_interpolation && frame_interpolation->HasFrame() &&
+           frame_interpolation->IsCompatible({frame.width, frame.height}, swapchain_view_format);
+}
+
+void BlitScreen::KeepFrameForInterpolation(const Device& device, const Frame& frame) {
+    const VkExtent2D extent{frame.width, frame.height};
+    if (!frame_interpolation || !frame_interpolation->IsCompatible(extent, swapchain_view_format)) {
+        if (frame_interpolation) {
+            WaitIdle(device);
+        }
+        frame_interpolation.emplace(device, memory_allocator, extent, swapchain_view_format);
+    }
+    frame_interpolation->KeepFrame(scheduler, *frame.image);
+}
+
+void BlitScreen::DrawInterpolatedFrame(Frame* frame) {
+    const VkExtent2D extent = frame_interpolation->GetExtent();
+    if (frame->width != extent.width || frame->height != extent.height) {
+        // The frame is free, its previous presentation has finished
+        present_manager.RecreateFrame(frame, extent.width, extent.height, swapchain_view_format,
+                                      window_adapt->GetRenderPass());
+    }
+    frame_interpolation->Draw(scheduler, *frame->image, *frame->framebuffer);
+}
+
+void BlitScreen::ResetInterpolation() {
+    if (frame_interpolation) {
+        frame_interpolation->Reset();
+    }
+}
+
 vk::Framebuffer BlitScreen::CreateFramebuffer(const Device& device, const Layout::FramebufferLayout& layout,
                                               VkImageView image_view,
                                               VkFormat current_view_format) {
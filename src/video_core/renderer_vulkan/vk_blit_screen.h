@@ -8,9 +8,11 @@
 
 #include <list>
 #include <memory>
+#include <optional>
 
 #include "core/frontend/framebuffer_layout.h"
 #include "video_core/host1x/gpu_device_memory_manager.h"
+#include "video_core/renderer_vulkan/present/frame_interpolation.h"
 #include "video_core/renderer_vulkan/present/layer.h"
 #include "video_core/vulkan_common/vulkan_memory_allocator.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
@@ -46,6 +48,8 @@ struct FramebufferTextureInfo {
     u32 height{};
     u32 scaled_width{};
     u32 scaled_height{};
+    /// Format of the image, undefined when the view reinterprets it as another format
+    VkFormat format{};
 };
 
 class BlitScreen {
@@ -58,15 +62,30 @@ public:
     void DrawToFrame(const Device& device, RasterizerVulkan& rasterizer, Frame* frame,
                      std::span<const Tegra::FramebufferConfig> framebuffers,
                      const Layout::FramebufferLayout& layout, size_t current_swapchain_image_count,
-                     VkFormat current_swapchain_view_format);
+                     VkFormat current_swapchain_view_format, bool allow_direct_copy = false);
 
     [[nodiscard]] vk::Framebuffer CreateFramebuffer(const Device& device, const Layout::FramebufferLayout& layout,
                                                     VkImageView image_view,
                                                     VkFormat current_view_format);
 
+    /// Whether a frame halfway between the kept frame and this one can be drawn once it is kept
+    [[nodiscard]] bool CanInterpolateFrame(const Frame& frame) const;
+
+    /// Keeps a frame drawn by DrawToFrame to interpolate the next frames from
+    void KeepFrameForInterpolation(const Device& device, const Frame& frame);
+
+    /// Draws the frame halfway between the last two kept frames into a presentation frame
+    void DrawInterpolatedFrame(Frame* frame);
+
+    /// Forgets the kept frames, the next frame is not interpolated
+    void ResetInterpolation();
+
 private:
     void WaitIdle(const Device& device);
     void SetWindowAdaptPass(const Device& device);
+    bool CanCopyDirectly(const Device& device,
+                         std::span<const Tegra::FramebufferConfig> framebuffers,
+                         const Layout::FramebufferLayout& layout) const;
     vk::Framebuffer CreateFramebuffer(const Device& device, const VkImageView& image_view, VkExtent2D extent,
                                       VkRenderPass render_pass);
 
@@ -82,6 +101,7 @@ private:
     Settings::ScalingFilter scaling_filter{};
     std::unique_ptr<WindowAdaptPass> window_adapt{};
     std::list<Layer> layers{};
+    std::optional<FrameInterpolation> frame_interpolation{};
 };
 
 } // namespace Vulkan
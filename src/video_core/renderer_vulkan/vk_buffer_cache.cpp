@@ -24,6 +24,11 @@
 
 namespace Vulkan {
 namespace {
+/// Memory budget of the index conversions kept for unchanged sources
+constexpr u64 MAX_CONVERTED_INDICES_SIZE = 64ULL << 20;
+/// Frames an index conversion is kept without being used
+constexpr u64 CONVERTED_INDICES_MAX_AGE = 120;
+
 VkBufferCopy MakeBufferCopy(const VideoCommon::BufferCopy& copy) {
     return VkBufferCopy{
         .srcOffset = copy.src_offset,
@@ -69,7 +74,7 @@ vk::Buffer CreateBuffer(const Device& device, const MemoryAllocator& memory_allo
     if (device.IsExtConditionalRendering()) {
         flags |= VK_BUFFER_USAGE_CONDITIONAL_RENDERING_BIT_EXT;
     }
-    const VkBufferCreateInfo buffer_ci = {
+    VkBufferCreateInfo buffer_ci = {
         .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
         .pNext = nullptr,
         .flags = 0,
@@ -79,6 +84,13 @@ vk::Buffer CreateBuffer(const Device& device, const MemoryAllocator& memory_allo
         .queueFamilyIndexCount = 0,
         .pQueueFamilyIndices = nullptr,
     };
+    // Reordered uploads are copied into these buffers on the transfer queue
+    const std::array queue_families{device.GetGraphicsFamily(), device.GetTransferFamily()};
+    if (device.HasAsyncTransferQueue()) {
+        buffer_ci.sharingMode = VK_SHARING_MODE_CONCURRENT;
+        buffer_ci.queueFamilyIndexCount = static_cast<u32>(queue_families.size());
+        buffer_ci.pQueueFamilyIndices = queue_families.data();
+    }
     return memory_allocator.CreateBuffer(buffer_ci, MemoryUsage::DeviceLocal);
 }
 } // Anonymous namespace
@@ -394,6 +406,16 @@ void BufferCacheRuntime::TickFrame(Common::SlotVector<Buffer>& slot_buffers) noe
             it->ResetUsageTracking();
         }
     }
+    ++frame_number;
+    converted_indices_destruction_ring.Tick();
+    for (auto it = converted_indices.begin(); it != converted_indices.end();) {
+        if (it->second.last_used_frame + CONVERTED_INDICES_MAX_AGE < frame_number) {
+            ReleaseConvertedIndices(it->second);
+            it = converted_indices.erase(it);
+        } else {
+            ++it;
+        }
+    }
 }
 
 u64 BufferCacheRuntime::CurrentTick() {
@@ -523,21 +545,83 @@ void BufferCacheRuntime::ClearBuffer(VkBuffer dest_buffer, u32 offset, size_t si
     });
 }
 
+std::pair<VkBuffer, VkDeviceSize> BufferCacheRuntime::ConvertIndices(
+    const ConvertedIndicesKey& key, u64 contents_version, u32 output_size, auto&& assemble) {
+    if (output_size == 0) {
+        return assemble(VK_NULL_HANDLE);
+    }
+    const auto [it, is_new] = converted_indices.try_emplace(key);
+    ConvertedIndices& converted = it->second;
+    converted.last_used_frame = frame_number;
+    if (is_new || converted.contents_version != contents_version) {
+        // Earlier draws may still read the previous conversion, leave it to them
+        ReleaseConvertedIndices(converted);
+        converted.contents_version = contents_version;
+        return assemble(VK_NULL_HANDLE);
+    }
+    if (converted.buffer) {
+        return {*converted.buffer, 0};
+    }
+    // Converting the same contents twice means the source is static, keep the next conversion
+    if (converted_indices_size + output_size > MAX_CONVERTED_INDICES_SIZE) {
+        return assemble(VK_NULL_HANDLE);
+    }
+    converted.buffer = memory_allocator.CreateBuffer(
+        VkBufferCreateInfo{
+            .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .size = output_size,
+            .usage = VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+            .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+            .queueFamilyIndexCount = 0,
+            .pQueueFamilyIndices = nullptr,
+        },
+        MemoryUsage::DeviceLocal);
+    converted.size = output_size;
+    converted_indices_size += output_size;
+    return assemble(*converted.buffer);
+}
+
+void BufferCacheRuntime::ReleaseConvertedIndices(ConvertedIndices& converted) {
+    if (!converted.buffer) {
+        return;
+    }
+    converted_indices_size -= converted.size;
+    converted_indices_destruction_ring.Push(std::move(converted.buffer));
+}
+
 void BufferCacheRuntime::BindIndexBuffer(PrimitiveTopology topology, IndexFormat index_format,
-                                         u32 base_vertex, u32 num_indices, VkBuffer buffer,
+                                         u32 base_vertex, u32 num_indices, const Buffer& buffer,
                                          u32 offset, [[maybe_unused]] u32 size) {
     VkIndexType vk_index_type = MaxwellToVK::IndexFormat(index_format);
     VkDeviceSize vk_offset = offset;
     VkBuffer vk_buffer = buffer;
+    const ConvertedIndicesKey key{
+        .src_buffer = buffer,
+        .src_offset = offset,
+        .num_indices = num_indices,
+        .base_vertex = base_vertex,
+        .index_format = index_format,
+        .topology = topology,
+    };
     if (topology == PrimitiveTopology::Quads || topology == PrimitiveTopology::QuadStrip) {
         vk_index_type = VK_INDEX_TYPE_UINT32;
-        std::tie(vk_buffer, vk_offset) =
-            quad_index_pass.Assemble(index_format, num_indices, base_vertex, buffer, offset,
-                                     topology == PrimitiveTopology::QuadStrip);
+        const bool is_strip = topology == PrimitiveTopology::QuadStrip;
+        std::tie(vk_buffer, vk_offset) = ConvertIndices(
+            key, buffer.ContentsVersion(), QuadIndexedPass::OutputSize(num_indices, is_strip),
+            [&](VkBuffer dst_buffer) {
+                return quad_index_pass.Assemble(index_format, num_indices, base_vertex, buffer,
+                                                offset, is_strip, dst_buffer);
+            });
     } else if (vk_index_type == VK_INDEX_TYPE_UINT8_EXT && !device.IsExtIndexTypeUint8Supported()) {
         vk_index_type = VK_INDEX_TYPE_UINT16;
         if (uint8_pass) {
-            std::tie(vk_buffer, vk_offset) = uint8_pass->Assemble(num_indices, buffer, offset);
+            std::tie(vk_buffer, vk_offset) = ConvertIndices(
+                key, buffer.ContentsVersion(), Uint8Pass::OutputSize(num_indices),
+                [&](VkBuffer dst_buffer) {
+                    return uint8_pass->Assemble(num_indices, buffer, offset, dst_buffer);
+                });
         } else if (device.GetDriverID() == VK_DRIVER_ID_QUALCOMM_PROPRIETARY) {
             ReserveNullBuffer();
             vk_buffer = *null_buffer;
@@ -648,6 +732,24 @@ void BufferCacheRuntime::BindTransformFeedbackBuffer(u32 index, VkBuffer buffer,
     });
 }
 
+void BufferCacheRuntime::BindUniformBufferData(size_t stage, u32 binding_index,
+                                               std::span<const u8> data) {
+    UniformUpload& last = uniform_uploads[stage][binding_index];
+    const u32 size = static_cast<u32>(data.size());
+    const u64 tick = scheduler.CurrentTick();
+    if (last.tick == tick && std::ranges::equal(last.data, data)) {
+        BindBuffer(last.buffer, last.offset, size);
+        return;
+    }
+    const StagingBufferRef ref = staging_pool.Request(size, MemoryUsage::Upload);
+    std::memcpy(ref.mapped_span.data(), data.data(), size);
+    last.tick = tick;
+    last.buffer = ref.buffer;
+    last.offset = static_cast<u32>(ref.offset);
+    last.data.assign(data.begin(), data.end());
+    BindBuffer(last.buffer, last.offset, size);
+}
+
 void BufferCacheRuntime::BindTransformFeedbackBuffers(VideoCommon::HostBindings<Buffer>& bindings) {
     if (!device.IsExtTransformFeedbackSupported()) {
         // Already logged in the rasterizer
@@ -6,11 +6,18 @@
 
 #pragma once
 
+#include <array>
 #include <limits>
+#include <span>
+#include <vector>
 
+#include <ankerl/unordered_dense.h>
+
+#include "common/hash.h"
 #include "video_core/buffer_cache/buffer_cache_base.h"
 #include "video_core/buffer_cache/memory_tracker_base.h"
 #include "video_core/buffer_cache/usage_tracker.h"
+#include "video_core/delayed_destruction_ring.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/renderer_vulkan/vk_compute_pass.h"
 #include "video_core/renderer_vulkan/vk_staging_buffer_pool.h"
@@ -129,7 +136,7 @@ public:
     void ClearBuffer(VkBuffer dest_buffer, u32 offset, size_t size, u32 value);
 
     void BindIndexBuffer(PrimitiveTopology topology, IndexFormat index_format, u32 num_indices,
-                         u32 base_vertex, VkBuffer buffer, u32 offset, u32 size);
+                         u32 base_vertex, const Buffer& buffer, u32 offset, u32 size);
 
     void BindQuadIndexBuffer(PrimitiveTopology topology, u32 first, u32 count);
 
@@ -149,6 +156,9 @@ public:
         return ref.mapped_span;
     }
 
+    /// Binds a small uniform buffer, reusing the previous upload if its contents did not change
+    void BindUniformBufferData(size_t stage, u32 binding_index, std::span<const u8> data);
+
     void BindUniformBuffer(VkBuffer buffer, u32 offset, u32 size) {
         BindBuffer(buffer, offset, size);
     }
@@ -180,6 +190,46 @@ private:
         }
     }
 
+    /// Index conversion of a source buffer range, kept while the source contents don't change
+    struct ConvertedIndicesKey {
+        VkBuffer src_buffer;
+        u32 src_offset;
+        u32 num_indices;
+        u32 base_vertex;
+        IndexFormat index_format;
+        PrimitiveTopology topology;
+
+        bool operator==(const ConvertedIndicesKey&) const = default;
+    };
+
+    struct ConvertedIndicesKeyHash {
+        u64 operator()(const ConvertedIndicesKey& key) const noexcept {
+            return Common::Hash::HashObject(key);
+        }
+    };
+
+    struct ConvertedIndices {
+        u64 contents_version{};
+        u64 last_used_frame{};
+        /// Only allocated once the same contents are converted a second time
+        vk::Buffer buffer;
+        u32 size{};
+    };
+
+    /// Converts indices the host can't consume, reusing the result for unchanged sources
+    std::pair<VkBuffer, VkDeviceSize> ConvertIndices(const ConvertedIndicesKey& key,
+                                                     u64 contents_version, u32 output_size,
+                                                     auto&& assemble);
+
+    void ReleaseConvertedIndices(ConvertedIndices& converted);
+
+    struct UniformUpload {
+        u64 tick = 0;
+        VkBuffer buffer{};
+        u32 offset = 0;
+        std::vector<u8> data;
+    };
+
     void ReserveNullBuffer();
     vk::Buffer CreateNullBuffer();
 
@@ -197,6 +247,17 @@ private:
     std::unique_ptr<Uint8Pass> uint8_pass;
     QuadIndexedPass quad_index_pass;
 
+    ankerl::unordered_dense::map<ConvertedIndicesKey, ConvertedIndices, ConvertedIndicesKeyHash>
+        converted_indices;
+    VideoCommon::DelayedDestructionRing<vk::Buffer, 8> converted_indices_destruction_ring;
+    u64 converted_indices_size = 0;
+    u64 frame_number = 0;
+
+    /// Last staging upload of each fast uniform buffer, only valid on the tick it was requested
+    std::array<std::array<UniformUpload, VideoCommon::NUM_GRAPHICS_UNIFORM_BUFFERS>,
+               VideoCommon::NUM_STAGES>
+        uniform_uploads;
+
     bool limit_dynamic_storage_buffers = false;
     u32 max_dynamic_storage_buffers = (std::numeric_limits<u32>::max)();
 };
@@ -215,6 +276,7 @@ struct BufferCacheParams {
     static constexpr bool USE_MEMORY_MAPS = true;
     static constexpr bool SEPARATE_IMAGE_BUFFER_BINDINGS = false;
     static constexpr bool USE_MEMORY_MAPS_FOR_UPLOADS = true;
+    static constexpr bool REUSE_UNCHANGED_UNIFORM_UPLOADS = true;
 };
 
 using BufferCache = VideoCommon::BufferCache<BufferCacheParams>;
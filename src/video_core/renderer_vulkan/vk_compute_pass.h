@@ -14,6 +14,7 @@
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/renderer_vulkan/vk_descriptor_pool.h"
 #include "video_core/renderer_vulkan/vk_update_descriptor.h"
+#include "video_core/surface.h"
 #include "video_core/texture_cache/types.h"
 #include "video_core/vulkan_common/vulkan_memory_allocator.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
@@ -64,8 +65,13 @@ public:
 
     /// Assemble uint8 indices into an uint16 index buffer
     /// Returns a pair with the staging buffer, and the offset where the assembled data is
+    /// @param dst_buffer Buffer to write the indices to, a staging buffer is used when null
     std::pair<VkBuffer, VkDeviceSize> Assemble(u32 num_vertices, VkBuffer src_buffer,
-                                               u32 src_offset);
+                                               u32 src_offset,
+                                               VkBuffer dst_buffer = VK_NULL_HANDLE);
+
+    /// Size in bytes of the indices assembled from the given number of vertices
+    [[nodiscard]] static u32 OutputSize(u32 num_vertices) noexcept;
 
 private:
     Scheduler& scheduler;
@@ -81,9 +87,14 @@ public:
                              ComputePassDescriptorQueue& compute_pass_descriptor_queue_);
     ~QuadIndexedPass();
 
+    /// @param dst_buffer Buffer to write the indices to, a staging buffer is used when null
     std::pair<VkBuffer, VkDeviceSize> Assemble(
         Tegra::Engines::Maxwell3D::Regs::IndexFormat index_format, u32 num_vertices,
-        u32 base_vertex, VkBuffer src_buffer, u32 src_offset, bool is_strip);
+        u32 base_vertex, VkBuffer src_buffer, u32 src_offset, bool is_strip,
+        VkBuffer dst_buffer = VK_NULL_HANDLE);
+
+    /// Size in bytes of the triangle indices assembled from the given number of quad vertices
+    [[nodiscard]] static u32 OutputSize(u32 num_vertices, bool is_strip) noexcept;
 
 private:
     Scheduler& scheduler;
@@ -137,6 +148,25 @@ private:
     MemoryAllocator& memory_allocator;
 };
 
+/// Decodes BC1 to BC5 images on hosts without native BCn support, BC6H and BC7 stay on the CPU
+class BCnDecoderPass final : public ComputePass {
+public:
+    explicit BCnDecoderPass(const Device& device_, Scheduler& scheduler_,
+                            DescriptorPool& descriptor_pool_,
+                            ComputePassDescriptorQueue& compute_pass_descriptor_queue_);
+    ~BCnDecoderPass();
+
+    /// Returns true when images of the format can be decoded by the pass
+    [[nodiscard]] static bool IsSupported(VideoCore::Surface::PixelFormat format);
+
+    void Assemble(Image& image, const StagingBufferRef& map,
+                  std::span<const VideoCommon::SwizzleParameters> swizzles);
+
+private:
+    Scheduler& scheduler;
+    ComputePassDescriptorQueue& compute_pass_descriptor_queue;
+};
+
 class BlockLinearUnswizzle3DPass final : public ComputePass {
 public:
     explicit BlockLinearUnswizzle3DPass(const Device& device_, Scheduler& scheduler_,
@@ -5,6 +5,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <cstring>
 #include <vector>
 
 #include <boost/container/small_vector.hpp>
@@ -119,7 +120,7 @@ ComputePipeline::ComputePipeline(const Device& device_, Scheduler& scheduler, vk
         }
     }};
     if (thread_worker) {
-        thread_worker->QueueWork(std::move(func));
+        thread_worker->QueueWork(std::move(func), Common::WorkPriority::High);
     } else {
         func();
     }
@@ -222,8 +223,10 @@ void ComputePipeline::Configure(Tegra::Engines::KeplerCompute& kepler_compute,
     std::ranges::for_each(info.texture_buffer_descriptors, add_buffer);
     std::ranges::for_each(info.image_buffer_descriptors, add_buffer);
 
+    buffer_cache.BeginUploadBatch();
     buffer_cache.UpdateComputeBuffers();
     buffer_cache.BindHostComputeBuffers();
+    buffer_cache.EndUploadBatch();
     if (buffer_cache.any_buffer_uploaded) {
         buffer_cache.runtime.PostCopyBarrier();
         buffer_cache.any_buffer_uploaded = false;
@@ -251,12 +254,27 @@ void ComputePipeline::Configure(Tegra::Engines::KeplerCompute& kepler_compute,
 
     const void* const descriptor_data{guest_descriptor_queue.UpdateData()};
     const bool is_rescaling = !info.texture_descriptors.empty() || !info.image_descriptors.empty();
-    scheduler.Record([this, descriptor_data, is_rescaling,
+
+    // Back to back dispatches of the same pipeline often use the same resources, keep the bound
+    // pipeline and descriptors in that case
+    const size_t descriptor_data_size = num_descriptor_entries * sizeof(DescriptorUpdateEntry);
+    const bool pipeline_changed = scheduler.UpdateComputePipeline(this);
+    const bool descriptors_changed =
+        pipeline_changed || (descriptor_data_size != 0 &&
+                             std::memcmp(bound_descriptor_data.data(), descriptor_data,
+                                         descriptor_data_size) != 0);
+    if (descriptors_changed) {
+        bound_descriptor_data.resize(num_descriptor_entries);
+        std::memcpy(bound_descriptor_data.data(), descriptor_data, descriptor_data_size);
+    }
+    scheduler.Record([this, descriptor_data, is_rescaling, pipeline_changed, descriptors_changed,
                       rescaling_data = rescaling.Data()](vk::CommandBuffer cmdbuf) {
         if (!pipeline) {
             return;
         }
-        cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, *pipeline);
+        if (pipeline_changed) {
+            cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, *pipeline);
+        }
         if (!descriptor_set_layout) {
             return;
         }
@@ -265,6 +283,9 @@ void ComputePipeline::Configure(Tegra::Engines::KeplerCompute& kepler_compute,
                                  RESCALING_LAYOUT_WORDS_OFFSET, sizeof(rescaling_data),
                                  rescaling_data.data());
         }
+        if (!descriptors_changed) {
+            return;
+        }
         if (uses_push_descriptor) {
             cmdbuf.PushDescriptorSetWithTemplateKHR(*descriptor_update_template, *pipeline_layout,
                                                     0, descriptor_data);
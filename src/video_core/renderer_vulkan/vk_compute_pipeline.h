@@ -9,6 +9,7 @@
 #include <atomic>
 #include <condition_variable>
 #include <mutex>
+#include <vector>
 
 #include "common/common_types.h"
 #include "common/thread_worker.h"
@@ -70,6 +71,9 @@ private:
     vk::DescriptorUpdateTemplate descriptor_update_template;
     vk::Pipeline pipeline;
 
+    /// Descriptors of the last dispatch, valid while this is the bound compute pipeline
+    std::vector<DescriptorUpdateEntry> bound_descriptor_data;
+
     std::condition_variable build_condvar;
     std::mutex build_mutex;
     std::atomic_bool is_built{false};
@@ -21,9 +21,8 @@ void InnerFence::Queue() {
     if (is_stubbed) {
         return;
     }
-    // Get the current tick so we can wait for it
+    // Fences of the same command buffer share its tick, the submission is left to FlushCommands
     wait_tick = scheduler.CurrentTick();
-    scheduler.Flush();
 }
 
 bool InnerFence::IsSignaled() const {
@@ -37,7 +36,9 @@ void InnerFence::Wait() {
     if (is_stubbed) {
         return;
     }
-    scheduler.Wait(wait_tick);
+    // Called from the fence thread, which can't submit. The tick may still be recording, the
+    // master semaphore wait also covers ticks that haven't been submitted yet.
+    scheduler.GetMasterSemaphore().Wait(wait_tick);
 }
 
 FenceManager::FenceManager(VideoCore::RasterizerInterface& rasterizer_, Tegra::GPU& gpu_,
@@ -52,6 +53,13 @@ Fence FenceManager::CreateFence(bool is_stubbed) {
 
 void FenceManager::QueueFence(Fence& fence) {
     fence->Queue();
+    if (!fence->IsStubbed()) {
+        last_fence_tick = fence->WaitTick();
+    }
+}
+
+bool FenceManager::HasUnsubmittedFences() const {
+    return last_fence_tick >= scheduler.CurrentTick();
 }
 
 bool FenceManager::IsFenceSignaled(Fence& fence) const {
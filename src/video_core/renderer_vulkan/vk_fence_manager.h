@@ -32,6 +32,10 @@ public:
 
     bool IsSignaled() const;
 
+    [[nodiscard]] u64 WaitTick() const noexcept {
+        return wait_tick;
+    }
+
     void Wait();
 
 private:
@@ -47,6 +51,7 @@ struct FenceManagerParams {
     using QueryCacheType = QueryCache;
 
     static constexpr bool HAS_ASYNC_CHECK = true;
+    static constexpr bool DEFERS_FENCE_SUBMIT = true;
 };
 
 using GenericFenceManager = VideoCommon::FenceManager<FenceManagerParams>;
@@ -57,6 +62,9 @@ public:
                           TextureCache& texture_cache, BufferCache& buffer_cache,
                           QueryCache& query_cache, const Device& device, Scheduler& scheduler);
 
+    /// Returns true when a queued fence waits on the command buffer that is being recorded
+    [[nodiscard]] bool HasUnsubmittedFences() const;
+
 protected:
     Fence CreateFence(bool is_stubbed) override;
     void QueueFence(Fence& fence) override;
@@ -65,6 +73,7 @@ protected:
 
 private:
     Scheduler& scheduler;
+    u64 last_fence_tick = 0;
 };
 
 } // namespace Vulkan
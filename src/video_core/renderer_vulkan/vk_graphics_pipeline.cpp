@@ -5,6 +5,8 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <cstddef>
+#include <cstring>
 #include <iostream>
 #include <span>
 
@@ -15,6 +17,7 @@
 #include "video_core/renderer_vulkan/pipeline_helper.h"
 
 #include "common/bit_field.h"
+#include "shader_recompiler/runtime_info.h"
 #include "video_core/renderer_vulkan/maxwell_to_vk.h"
 #include "video_core/renderer_vulkan/pipeline_statistics.h"
 #include "video_core/renderer_vulkan/vk_buffer_cache.h"
@@ -252,19 +255,20 @@ GraphicsPipeline::GraphicsPipeline(
     const Device& device_, DescriptorPool& descriptor_pool,
     GuestDescriptorQueue& guest_descriptor_queue_, Common::ThreadWorker* worker_thread,
     PipelineStatistics* pipeline_statistics, RenderPassCache& render_pass_cache,
-    const GraphicsPipelineCacheKey& key_, std::array<vk::ShaderModule, NUM_STAGES> stages,
-    const std::array<const Shader::Info*, NUM_STAGES>& infos)
+    const GraphicsPipelineCacheKey& key_, std::shared_ptr<const GraphicsShaders> shaders_,
+    const GraphicsSpecializationData& specialization_data_)
     : key{key_}, device{device_}, texture_cache{texture_cache_}, buffer_cache{buffer_cache_},
       pipeline_cache(pipeline_cache_), scheduler{scheduler_},
-      guest_descriptor_queue{guest_descriptor_queue_}, spv_modules{std::move(stages)} {
+      guest_descriptor_queue{guest_descriptor_queue_}, shaders{std::move(shaders_)},
+      specialization_data{specialization_data_} {
     if (shader_notify) {
         shader_notify->MarkShaderBuilding();
     }
     for (size_t stage = 0; stage < NUM_STAGES; ++stage) {
-        const Shader::Info* const info{infos[stage]};
-        if (!info) {
+        if (!shaders->modules[stage]) {
             continue;
         }
+        const Shader::Info* const info{&shaders->infos[stage]};
         stage_infos[stage] = *info;
         enabled_uniform_buffer_masks[stage] = info->constant_buffer_mask;
         std::ranges::copy(info->constant_buffer_used_sizes, uniform_buffer_sizes[stage].begin());
@@ -276,7 +280,8 @@ GraphicsPipeline::GraphicsPipeline(
         num_descriptor_entries += NumDescriptorEntries(*info);
     }
     fragment_has_color0_output = stage_infos[NUM_STAGES - 1].stores_frag_color[0];
-    auto func{[this, shader_notify, &render_pass_cache, &descriptor_pool, pipeline_statistics] {
+    auto func{[this, shader_notify, &render_pass_cache, &descriptor_pool, pipeline_statistics,
+                worker_thread] {
         DescriptorLayoutBuilder builder{MakeBuilder(device, stage_infos)};
         uses_push_descriptor = builder.CanUsePushDescriptor();
         descriptor_set_layout = builder.CreateDescriptorSetLayout(uses_push_descriptor);
@@ -290,10 +295,28 @@ GraphicsPipeline::GraphicsPipeline(
         descriptor_update_template =
             builder.CreateTemplate(set_layout, *pipeline_layout, uses_push_descriptor);
 
-        const VkRenderPass render_pass{render_pass_cache.Get(MakeRenderPassKey(key.state, device))};
+        // Pipelines drawn with dynamic rendering aren't tied to a render pass. Render targets that
+        // resolve MSAA color keep their render pass, matching Framebuffer.
+        const RenderPassKey render_pass_key{MakeRenderPassKey(key.state, device)};
+        const bool use_dynamic_rendering{device.IsKhrDynamicRenderingEnabled() &&
+                                         !render_pass_key.resolve_color};
+        const VkRenderPass render_pass{
+            use_dynamic_rendering ? VK_NULL_HANDLE : render_pass_cache.Get(render_pass_key)};
         Validate();
+        // Pipelines built while the game is running are first compiled without driver
+        // optimizations to unblock the draw waiting on them, the optimized pipeline replaces it
+        // once it has been built in the background.
+        const bool build_baseline{worker_thread != nullptr};
+        // With graphics pipeline libraries the baseline is a fast link of the pipeline parts,
+        // linking them again with link time optimizations produces the optimized pipeline.
+        const bool use_libraries{build_baseline && device.IsExtGraphicsPipelineLibrarySupported()};
         try {
-            MakePipeline(render_pass);
+            if (use_libraries) {
+                BuildLibraries(render_pass);
+                pipeline = LinkLibraries(false);
+            } else {
+                pipeline = MakePipeline(render_pass, build_baseline);
+            }
         } catch (const vk::Exception& exception) {
             LOG_CRITICAL(Render_Vulkan, "Graphics pipeline build failed: {}", exception.what());
             std::scoped_lock lock{build_mutex};
@@ -308,19 +331,39 @@ GraphicsPipeline::GraphicsPipeline(
             pipeline_statistics->Collect(device, *pipeline);
         }
 
-        std::scoped_lock lock{build_mutex};
-        is_built = true;
-        build_condvar.notify_one();
+        {
+            std::scoped_lock lock{build_mutex};
+            is_built = true;
+            build_condvar.notify_one();
+        }
         if (shader_notify) {
             shader_notify->MarkShaderComplete();
         }
+        if (build_baseline) {
+            worker_thread->QueueWork(
+                [this, render_pass, use_libraries] {
+                    try {
+                        optimized_pipeline = use_libraries ? LinkLibraries(true)
+                                                           : MakePipeline(render_pass, false);
+                    } catch (const vk::Exception& exception) {
+                        LOG_WARNING(Render_Vulkan, "Optimized graphics pipeline build failed: {}",
+                                    exception.what());
+                        return;
+                    }
+                    // Linked pipelines do not reference their libraries
+                    libraries = {};
+                    is_optimized.store(true, std::memory_order::release);
+                },
+                Common::WorkPriority::Low);
+        }
     }};
     if (worker_thread) {
-        worker_thread->QueueWork(std::move(func));
+        // Built while the game is running, the current draw is waiting on it
+        worker_thread->QueueWork(std::move(func), Common::WorkPriority::High);
     } else {
         func();
     }
-    configure_func = ConfigureFunc(spv_modules, stage_infos);
+    configure_func = ConfigureFunc(shaders->modules, stage_infos);
 }
 
 void GraphicsPipeline::AddTransition(GraphicsPipeline* transition) {
@@ -493,6 +536,7 @@ bool GraphicsPipeline::ConfigureImpl(bool is_indexed) {
         scheduler.RequestOutsideRenderPassOperationContext();
     }
 
+    buffer_cache.BeginUploadBatch();
     buffer_cache.UpdateGraphicsBuffers(is_indexed);
     buffer_cache.BindHostGeometryBuffers(is_indexed);
 
@@ -528,6 +572,7 @@ bool GraphicsPipeline::ConfigureImpl(bool is_indexed) {
     if constexpr (Spec::enabled_stages[4]) {
         prepare_stage(4);
     }
+    buffer_cache.EndUploadBatch();
     if (buffer_cache.any_buffer_uploaded) {
         buffer_cache.runtime.PostCopyBarrier();
         buffer_cache.any_buffer_uploaded = false;
@@ -545,7 +590,7 @@ bool GraphicsPipeline::ConfigureImpl(bool is_indexed) {
 
 void GraphicsPipeline::ConfigureDraw(const RescalingPushConstant& rescaling,
                                      const RenderAreaPushConstant& render_area) {
-    scheduler.RequestRenderpass(texture_cache.GetFramebuffer());
+    scheduler.RequestRendering(texture_cache.GetFramebuffer());
     if (!is_built.load(std::memory_order::relaxed)) {
         // Wait for the pipeline to be built
         scheduler.Record([this](vk::CommandBuffer) {
@@ -565,15 +610,18 @@ void GraphicsPipeline::ConfigureDraw(const RescalingPushConstant& rescaling,
     }
 
     const void* const descriptor_data{guest_descriptor_queue.UpdateData()};
-    scheduler.Record([this, descriptor_data, bind_pipeline, rescaling_data = rescaling.Data(),
-                      is_rescaling, update_rescaling,
+    const bool update_descriptors{UpdateBoundDescriptors(bind_pipeline)};
+    scheduler.Record([this, descriptor_data, bind_pipeline, update_descriptors,
+                      rescaling_data = rescaling.Data(), is_rescaling, update_rescaling,
                       uses_render_area = render_area.uses_render_area,
                       render_area_data = render_area.words](vk::CommandBuffer cmdbuf) {
         if (bind_pipeline) {
             if (!pipeline) {
                 return;
             }
-            cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, *pipeline);
+            const bool use_optimized{is_optimized.load(std::memory_order::acquire)};
+            cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS,
+                                use_optimized ? *optimized_pipeline : *pipeline);
         }
         cmdbuf.PushConstants(*pipeline_layout, VK_SHADER_STAGE_ALL_GRAPHICS,
                              RESCALING_LAYOUT_WORDS_OFFSET, sizeof(rescaling_data),
@@ -590,7 +638,7 @@ void GraphicsPipeline::ConfigureDraw(const RescalingPushConstant& rescaling,
                                  RENDERAREA_LAYOUT_OFFSET, sizeof(render_area_data),
                                  &render_area_data);
         }
-        if (!descriptor_set_layout) {
+        if (!descriptor_set_layout || !update_descriptors) {
             return;
         }
         if (uses_push_descriptor) {
@@ -606,7 +654,24 @@ void GraphicsPipeline::ConfigureDraw(const RescalingPushConstant& rescaling,
     });
 }
 
-void GraphicsPipeline::MakePipeline(VkRenderPass render_pass) {
+bool GraphicsPipeline::UpdateBoundDescriptors(bool bind_pipeline) {
+    if (!descriptor_set_layout) {
+        return false;
+    }
+    const DescriptorUpdateEntry* const data{guest_descriptor_queue.UpdateData()};
+    const size_t size{guest_descriptor_queue.UpdateSize()};
+    // The scheduler rebinds the pipeline whenever the command buffer or the graphics bind point
+    // state changed, so the set from our previous draw is still bound when it does not.
+    if (!bind_pipeline && bound_descriptors.size() == size &&
+        std::memcmp(bound_descriptors.data(), data, size * sizeof(DescriptorUpdateEntry)) == 0) {
+        return false;
+    }
+    bound_descriptors.assign(data, data + size);
+    return true;
+}
+
+vk::Pipeline GraphicsPipeline::MakePipeline(VkRenderPass render_pass, bool disable_optimization,
+                                            VkGraphicsPipelineLibraryFlagsEXT library_flags) {
     FixedPipelineState::DynamicState dynamic{};
     if (!key.state.extended_dynamic_state) {
         dynamic = key.state.dynamic_state;
@@ -668,7 +733,7 @@ void GraphicsPipeline::MakePipeline(VkRenderPass render_pass) {
     if (!vertex_binding_divisors.empty()) {
         vertex_input_ci.pNext = &input_divisor_ci;
     }
-    const bool has_tess_stages = spv_modules[1] || spv_modules[2];
+    const bool has_tess_stages = shaders->modules[1] || shaders->modules[2];
     auto input_assembly_topology = MaxwellToVK::PrimitiveTopology(device, key.state.topology);
     if (input_assembly_topology == VK_PRIMITIVE_TOPOLOGY_PATCH_LIST) {
         if (!has_tess_stages) {
@@ -975,9 +1040,49 @@ void GraphicsPipeline::MakePipeline(VkRenderPass render_pass) {
         .pNext = nullptr,
         .requiredSubgroupSize = GuestWarpSize,
     };
+    static constexpr std::array specialization_entries{
+        VkSpecializationMapEntry{
+            .constantID = static_cast<u32>(Shader::SpecializationConstant::AlphaTestFunc),
+            .offset = offsetof(GraphicsSpecializationData, alpha_test_func),
+            .size = sizeof(GraphicsSpecializationData::alpha_test_func),
+        },
+        VkSpecializationMapEntry{
+            .constantID = static_cast<u32>(Shader::SpecializationConstant::AlphaTestReference),
+            .offset = offsetof(GraphicsSpecializationData, alpha_test_reference),
+            .size = sizeof(GraphicsSpecializationData::alpha_test_reference),
+        },
+        VkSpecializationMapEntry{
+            .constantID = static_cast<u32>(Shader::SpecializationConstant::FixedPointSize),
+            .offset = offsetof(GraphicsSpecializationData, fixed_point_size),
+            .size = sizeof(GraphicsSpecializationData::fixed_point_size),
+        },
+    };
+    // Entries of constants a module does not declare are ignored by the driver
+    const VkSpecializationInfo specialization_info{
+        .mapEntryCount = static_cast<u32>(specialization_entries.size()),
+        .pMapEntries = specialization_entries.data(),
+        .dataSize = sizeof(specialization_data),
+        .pData = &specialization_data,
+    };
+    // Libraries only take the state of the parts they build, monolithic pipelines take all of it
+    const auto has_part{[library_flags](VkGraphicsPipelineLibraryFlagBitsEXT part) {
+        return library_flags == 0 || (library_flags & part) != 0;
+    }};
+    const bool has_vertex_input{
+        has_part(VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT)};
+    const bool has_pre_rasterization{
+        has_part(VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT)};
+    const bool has_fragment_shader{has_part(VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT)};
+    const bool has_fragment_output{
+        has_part(VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT)};
+
     static_vector<VkPipelineShaderStageCreateInfo, 5> shader_stages;
     for (size_t stage = 0; stage < Maxwell::MaxShaderStage; ++stage) {
-        if (!spv_modules[stage]) {
+        if (!shaders->modules[stage]) {
+            continue;
+        }
+        const bool is_fragment_stage{stage == Maxwell::MaxShaderStage - 1};
+        if (is_fragment_stage ? !has_fragment_shader : !has_pre_rasterization) {
             continue;
         }
         [[maybe_unused]] auto& stage_ci =
@@ -986,32 +1091,52 @@ void GraphicsPipeline::MakePipeline(VkRenderPass render_pass) {
                 .pNext = nullptr,
                 .flags = 0,
                 .stage = MaxwellToVK::ShaderStage(Shader::StageFromIndex(stage)),
-                .module = *spv_modules[stage],
+                .module = *shaders->modules[stage],
                 .pName = "main",
-                .pSpecializationInfo = nullptr,
+                .pSpecializationInfo = &specialization_info,
             });
     }
     VkPipelineCreateFlags flags{};
     if (device.IsKhrPipelineExecutablePropertiesEnabled() && Settings::values.renderer_debug.GetValue()) {
         flags |= VK_PIPELINE_CREATE_CAPTURE_STATISTICS_BIT_KHR;
     }
+    if (disable_optimization) {
+        flags |= VK_PIPELINE_CREATE_DISABLE_OPTIMIZATION_BIT;
+    }
+    std::array<VkFormat, 8> rendering_color_formats{};
+    VkPipelineRenderingCreateInfo rendering_ci{};
+    const void* rendering_next{};
+    if (render_pass == VK_NULL_HANDLE) {
+        rendering_ci = MakePipelineRenderingInfo(device, MakeRenderPassKey(key.state, device),
+                                                 rendering_color_formats);
+        rendering_next = &rendering_ci;
+    }
+    const VkGraphicsPipelineLibraryCreateInfoEXT library_ci{
+        .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT,
+        .pNext = rendering_next,
+        .flags = library_flags,
+    };
+    if (library_flags != 0) {
+        flags |= VK_PIPELINE_CREATE_LIBRARY_BIT_KHR |
+                 VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT;
+    }
 
-    pipeline = device.GetLogical().CreateGraphicsPipeline({
+    vk::Pipeline result = device.GetLogical().CreateGraphicsPipeline({
         .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
-        .pNext = nullptr,
+        .pNext = library_flags != 0 ? &library_ci : rendering_next,
         .flags = flags,
         .stageCount = static_cast<u32>(shader_stages.size()),
         .pStages = shader_stages.data(),
-        .pVertexInputState = &vertex_input_ci,
-        .pInputAssemblyState = &input_assembly_ci,
-        .pTessellationState = &tessellation_ci,
-        .pViewportState = &viewport_ci,
-        .pRasterizationState = &rasterization_ci,
-        .pMultisampleState = &multisample_ci,
-        .pDepthStencilState = &depth_stencil_ci,
-        .pColorBlendState = &color_blend_ci,
+        .pVertexInputState = has_vertex_input ? &vertex_input_ci : nullptr,
+        .pInputAssemblyState = has_vertex_input ? &input_assembly_ci : nullptr,
+        .pTessellationState = has_pre_rasterization ? &tessellation_ci : nullptr,
+        .pViewportState = has_pre_rasterization ? &viewport_ci : nullptr,
+        .pRasterizationState = has_pre_rasterization ? &rasterization_ci : nullptr,
+        .pMultisampleState = has_fragment_shader || has_fragment_output ? &multisample_ci : nullptr,
+        .pDepthStencilState = has_fragment_shader ? &depth_stencil_ci : nullptr,
+        .pColorBlendState = has_fragment_output ? &color_blend_ci : nullptr,
         .pDynamicState = &dynamic_state_ci,
-        .layout = *pipeline_layout,
+        .layout = has_pre_rasterization || has_fragment_shader ? *pipeline_layout : VK_NULL_HANDLE,
         .renderPass = render_pass,
         .subpass = 0,
         .basePipelineHandle = nullptr,
@@ -1027,6 +1152,59 @@ void GraphicsPipeline::MakePipeline(VkRenderPass render_pass) {
         );
         GPU::Logging::GPULogger::GetInstance().LogPipelineStateChange(pipeline_info);
     }
+    return result;
+}
+
+void GraphicsPipeline::BuildLibraries(VkRenderPass render_pass) {
+    static constexpr std::array<VkGraphicsPipelineLibraryFlagsEXT, NUM_LIBRARIES> parts{
+        VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT,
+        VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT,
+        VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT,
+        VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT,
+    };
+    for (size_t index = 0; index < NUM_LIBRARIES; ++index) {
+        libraries[index] = MakePipeline(render_pass, false, parts[index]);
+    }
+}
+
+vk::Pipeline GraphicsPipeline::LinkLibraries(bool optimize) {
+    std::array<VkPipeline, NUM_LIBRARIES> handles;
+    std::ranges::transform(libraries, handles.begin(),
+                           [](const vk::Pipeline& library) { return *library; });
+    const VkPipelineLibraryCreateInfoKHR library_ci{
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR,
+        .pNext = nullptr,
+        .libraryCount = static_cast<u32>(handles.size()),
+        .pLibraries = handles.data(),
+    };
+    VkPipelineCreateFlags flags{};
+    if (device.IsKhrPipelineExecutablePropertiesEnabled() && Settings::values.renderer_debug.GetValue()) {
+        flags |= VK_PIPELINE_CREATE_CAPTURE_STATISTICS_BIT_KHR;
+    }
+    if (optimize) {
+        flags |= VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT;
+    }
+    return device.GetLogical().CreateGraphicsPipeline({
+        .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+        .pNext = &library_ci,
+        .flags = flags,
+        .stageCount = 0,
+        .pStages = nullptr,
+        .pVertexInputState = nullptr,
+        .pInputAssemblyState = nullptr,
+        .pTessellationState = nullptr,
+        .pViewportState = nullptr,
+        .pRasterizationState = nullptr,
+        .pMultisampleState = nullptr,
+        .pDepthStencilState = nullptr,
+        .pColorBlendState = nullptr,
+        .pDynamicState = nullptr,
+        .layout = *pipeline_layout,
+        .renderPass = VK_NULL_HANDLE,
+        .subpass = 0,
+        .basePipelineHandle = nullptr,
+        .basePipelineIndex = 0,
+    }, *pipeline_cache);
 }
 
 void GraphicsPipeline::Validate() {
@@ -10,8 +10,10 @@
 #include <array>
 #include <atomic>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <type_traits>
+#include <vector>
 
 #include "common/thread_worker.h"
 #include "shader_recompiler/shader_info.h"
@@ -20,6 +22,7 @@
 #include "video_core/renderer_vulkan/vk_buffer_cache.h"
 #include "video_core/renderer_vulkan/vk_descriptor_pool.h"
 #include "video_core/renderer_vulkan/vk_texture_cache.h"
+#include "video_core/renderer_vulkan/vk_update_descriptor.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
 
 namespace VideoCore {
@@ -61,6 +64,22 @@ struct hash<Vulkan::GraphicsPipelineCacheKey> {
 
 namespace Vulkan {
 
+/// Shader modules of a pipeline, shared with the pipelines that only differ in the state passed
+/// through specialization constants
+struct GraphicsShaders {
+    static constexpr size_t NUM_STAGES = Tegra::Engines::Maxwell3D::Regs::MaxShaderStage;
+
+    std::array<vk::ShaderModule, NUM_STAGES> modules;
+    std::array<Shader::Info, NUM_STAGES> infos;
+};
+
+/// Values of the specialization constants read by the shader modules of a pipeline
+struct GraphicsSpecializationData {
+    u32 alpha_test_func;
+    f32 alpha_test_reference;
+    f32 fixed_point_size;
+};
+
 class Device;
 class PipelineStatistics;
 class RenderPassCache;
@@ -70,6 +89,7 @@ class Scheduler;
 
 class GraphicsPipeline {
     static constexpr size_t NUM_STAGES = Tegra::Engines::Maxwell3D::Regs::MaxShaderStage;
+    static constexpr size_t NUM_LIBRARIES = 4;
 
 public:
     explicit GraphicsPipeline(
@@ -78,8 +98,8 @@ public:
         const Device& device, DescriptorPool& descriptor_pool,
         GuestDescriptorQueue& guest_descriptor_queue, Common::ThreadWorker* worker_thread,
         PipelineStatistics* pipeline_statistics, RenderPassCache& render_pass_cache,
-        const GraphicsPipelineCacheKey& key, std::array<vk::ShaderModule, NUM_STAGES> stages,
-        const std::array<const Shader::Info*, NUM_STAGES>& infos);
+        const GraphicsPipelineCacheKey& key, std::shared_ptr<const GraphicsShaders> shaders,
+        const GraphicsSpecializationData& specialization_data);
 
     bool HasDynamicVertexInput() const noexcept { return key.state.dynamic_vertex_input; }
     bool SupportsAlphaToCoverage() const noexcept {
@@ -135,7 +155,19 @@ private:
     void ConfigureDraw(const RescalingPushConstant& rescaling,
                        const RenderAreaPushConstant& render_are);
 
-    void MakePipeline(VkRenderPass render_pass);
+    /// Returns true when the descriptors of this draw differ from the ones already bound
+    bool UpdateBoundDescriptors(bool bind_pipeline);
+
+    /// Builds a monolithic pipeline, or a pipeline library of the given parts when flags are set.
+    /// Without a render pass the pipeline is built for dynamic rendering.
+    vk::Pipeline MakePipeline(VkRenderPass render_pass, bool disable_optimization,
+                              VkGraphicsPipelineLibraryFlagsEXT library_flags = 0);
+
+    /// Builds the vertex input, pre-rasterization, fragment shader and fragment output libraries
+    void BuildLibraries(VkRenderPass render_pass);
+
+    /// Links the pipeline libraries, optionally with link time optimizations
+    vk::Pipeline LinkLibraries(bool optimize);
 
     void Validate();
 
@@ -154,7 +186,8 @@ private:
     std::vector<GraphicsPipelineCacheKey> transition_keys;
     std::vector<GraphicsPipeline*> transitions;
 
-    std::array<vk::ShaderModule, NUM_STAGES> spv_modules;
+    std::shared_ptr<const GraphicsShaders> shaders;
+    GraphicsSpecializationData specialization_data;
 
     std::array<Shader::Info, NUM_STAGES> stage_infos;
     std::array<u32, 5> enabled_uniform_buffer_masks{};
@@ -169,10 +202,18 @@ private:
     vk::PipelineLayout pipeline_layout;
     vk::DescriptorUpdateTemplate descriptor_update_template;
     vk::Pipeline pipeline;
+    /// Replaces the baseline pipeline once built, the baseline is kept alive for in-flight draws
+    vk::Pipeline optimized_pipeline;
+    /// Pipeline libraries linked into the baseline and optimized pipelines
+    std::array<vk::Pipeline, NUM_LIBRARIES> libraries;
+
+    /// Payload of the descriptor set bound by the last draw of this pipeline
+    std::vector<DescriptorUpdateEntry> bound_descriptors;
 
     std::condition_variable build_condvar;
     std::mutex build_mutex;
     std::atomic_bool is_built{false};
+    std::atomic_bool is_optimized{false};
     bool uses_push_descriptor{false};
 };
 
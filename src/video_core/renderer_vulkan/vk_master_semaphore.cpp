@@ -39,6 +39,9 @@ MasterSemaphore::MasterSemaphore(const Device& device_) : device(device_) {
         .flags = 0,
     };
     semaphore = device.GetLogical().CreateSemaphore(semaphore_ci);
+    if (device.HasAsyncTransferQueue()) {
+        upload_semaphore = device.GetLogical().CreateSemaphore(semaphore_ci);
+    }
 
     if (!Settings::values.renderer_debug) {
         return;
@@ -130,6 +133,17 @@ VkResult MasterSemaphore::SubmitQueueTimeline(vk::CommandBuffer& cmdbuf,
                                               VkSemaphore wait_semaphore, u64 host_tick) {
     const VkSemaphore timeline_semaphore = *semaphore;
 
+    // Uploads on the transfer queue overlap with the previous submissions of the graphics queue,
+    // which only has to wait for them before this one starts.
+    const bool is_async_upload = static_cast<bool>(upload_semaphore);
+    if (is_async_upload) {
+        if (const VkResult result = SubmitUploadQueue(upload_cmdbuf, host_tick);
+            result != VK_SUCCESS) {
+            return result;
+        }
+    }
+    const u32 first_cmdbuf = is_async_upload ? 1 : 0;
+
     if (device.HasSynchronization2()) {
         const std::array<VkCommandBufferSubmitInfo, 2> cmdbuffer_infos{{
             {
@@ -170,24 +184,37 @@ VkResult MasterSemaphore::SubmitQueueTimeline(vk::CommandBuffer& cmdbuf,
             num_signal_semaphores = 2;
         }
 
-        const u32 num_wait_semaphores = wait_semaphore ? 1 : 0;
-        const VkSemaphoreSubmitInfo wait_info{
-            .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
-            .pNext = nullptr,
-            .semaphore = wait_semaphore,
-            .value = 0,
-            .stageMask = static_cast<VkPipelineStageFlags2>(wait_stage_mask),
-            .deviceIndex = 0,
-        };
+        std::array<VkSemaphoreSubmitInfo, 2> wait_infos{};
+        u32 num_wait_semaphores = 0;
+        if (wait_semaphore) {
+            wait_infos[num_wait_semaphores++] = VkSemaphoreSubmitInfo{
+                .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+                .pNext = nullptr,
+                .semaphore = wait_semaphore,
+                .value = 0,
+                .stageMask = static_cast<VkPipelineStageFlags2>(wait_stage_mask),
+                .deviceIndex = 0,
+            };
+        }
+        if (is_async_upload) {
+            wait_infos[num_wait_semaphores++] = VkSemaphoreSubmitInfo{
+                .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+                .pNext = nullptr,
+                .semaphore = *upload_semaphore,
+                .value = host_tick,
+                .stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+                .deviceIndex = 0,
+            };
+        }
 
         const VkSubmitInfo2 submit_info2{
             .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
             .pNext = nullptr,
             .flags = 0,
             .waitSemaphoreInfoCount = num_wait_semaphores,
-            .pWaitSemaphoreInfos = num_wait_semaphores ? &wait_info : nullptr,
-            .commandBufferInfoCount = static_cast<u32>(cmdbuffer_infos.size()),
-            .pCommandBufferInfos = cmdbuffer_infos.data(),
+            .pWaitSemaphoreInfos = num_wait_semaphores ? wait_infos.data() : nullptr,
+            .commandBufferInfoCount = static_cast<u32>(cmdbuffer_infos.size()) - first_cmdbuf,
+            .pCommandBufferInfos = cmdbuffer_infos.data() + first_cmdbuf,
             .signalSemaphoreInfoCount = num_signal_semaphores,
             .pSignalSemaphoreInfos = signal_infos.data(),
         };
@@ -200,20 +227,33 @@ VkResult MasterSemaphore::SubmitQueueTimeline(vk::CommandBuffer& cmdbuf,
 
     const std::array cmdbuffers{*upload_cmdbuf, *cmdbuf};
 
-    const u32 num_wait_semaphores = wait_semaphore ? 1 : 0;
+    // Binary semaphores ignore their wait value
+    std::array<VkSemaphore, 2> wait_semaphores{};
+    std::array<VkPipelineStageFlags, 2> wait_masks{};
+    std::array<u64, 2> wait_values{};
+    u32 num_wait_semaphores = 0;
+    if (wait_semaphore) {
+        wait_semaphores[num_wait_semaphores] = wait_semaphore;
+        wait_masks[num_wait_semaphores] = wait_stage_mask;
+        ++num_wait_semaphores;
+    }
+    if (is_async_upload) {
+        wait_semaphores[num_wait_semaphores] = *upload_semaphore;
+        wait_masks[num_wait_semaphores] = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+        wait_values[num_wait_semaphores] = host_tick;
+        ++num_wait_semaphores;
+    }
     // Pointers must be null when the count is zero (best-practices)
-    const VkSemaphore* p_wait_sems =
-        (num_wait_semaphores > 0) ? &wait_semaphore : nullptr;
+    const VkSemaphore* p_wait_sems = (num_wait_semaphores > 0) ? wait_semaphores.data() : nullptr;
     const VkPipelineStageFlags* p_wait_masks =
-        (num_wait_semaphores > 0) ? &wait_stage_mask : nullptr;
+        (num_wait_semaphores > 0) ? wait_masks.data() : nullptr;
     const VkSemaphore* p_signal_sems =
         (num_signal_semaphores > 0) ? signal_semaphores.data() : nullptr;
-    const u64 wait_zero = 0; // dummy for binary wait
     const VkTimelineSemaphoreSubmitInfo timeline_si{
         .sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
         .pNext = nullptr,
         .waitSemaphoreValueCount = num_wait_semaphores,
-        .pWaitSemaphoreValues    = num_wait_semaphores ? &wait_zero : nullptr,
+        .pWaitSemaphoreValues = num_wait_semaphores ? wait_values.data() : nullptr,
         .signalSemaphoreValueCount = num_signal_semaphores,
         .pSignalSemaphoreValues = signal_values.data(),
     };
@@ -223,8 +263,8 @@ VkResult MasterSemaphore::SubmitQueueTimeline(vk::CommandBuffer& cmdbuf,
         .waitSemaphoreCount = num_wait_semaphores,
         .pWaitSemaphores = p_wait_sems,
         .pWaitDstStageMask = p_wait_masks,
-        .commandBufferCount = static_cast<u32>(cmdbuffers.size()),
-        .pCommandBuffers = cmdbuffers.data(),
+        .commandBufferCount = static_cast<u32>(cmdbuffers.size()) - first_cmdbuf,
+        .pCommandBuffers = cmdbuffers.data() + first_cmdbuf,
         .signalSemaphoreCount = num_signal_semaphores,
         .pSignalSemaphores = p_signal_sems,
     };
@@ -232,6 +272,31 @@ VkResult MasterSemaphore::SubmitQueueTimeline(vk::CommandBuffer& cmdbuf,
     return device.GetGraphicsQueue().Submit(submit_info);
 }
 
+VkResult MasterSemaphore::SubmitUploadQueue(vk::CommandBuffer& upload_cmdbuf, u64 host_tick) {
+    const VkSemaphore signal_semaphore = *upload_semaphore;
+    const VkCommandBuffer cmdbuf_handle = *upload_cmdbuf;
+    const VkTimelineSemaphoreSubmitInfo timeline_si{
+        .sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
+        .pNext = nullptr,
+        .waitSemaphoreValueCount = 0,
+        .pWaitSemaphoreValues = nullptr,
+        .signalSemaphoreValueCount = 1,
+        .pSignalSemaphoreValues = &host_tick,
+    };
+    const VkSubmitInfo submit_info{
+        .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+        .pNext = &timeline_si,
+        .waitSemaphoreCount = 0,
+        .pWaitSemaphores = nullptr,
+        .pWaitDstStageMask = nullptr,
+        .commandBufferCount = 1,
+        .pCommandBuffers = &cmdbuf_handle,
+        .signalSemaphoreCount = 1,
+        .pSignalSemaphores = &signal_semaphore,
+    };
+    return device.GetTransferQueue().Submit(submit_info);
+}
+
 VkResult MasterSemaphore::SubmitQueueFence(vk::CommandBuffer& cmdbuf,
                                            vk::CommandBuffer& upload_cmdbuf,
                                            VkSemaphore signal_semaphore, VkSemaphore wait_semaphore,
@@ -62,6 +62,10 @@ private:
     VkResult SubmitQueueTimeline(vk::CommandBuffer& cmdbuf, vk::CommandBuffer& upload_cmdbuf,
                                  VkSemaphore signal_semaphore, VkSemaphore wait_semaphore,
                                  u64 host_tick);
+
+    /// Submits the upload command buffer to the transfer queue, signalling the upload semaphore
+    VkResult SubmitUploadQueue(vk::CommandBuffer& upload_cmdbuf, u64 host_tick);
+
     VkResult SubmitQueueFence(vk::CommandBuffer& cmdbuf, vk::CommandBuffer& upload_cmdbuf,
                               VkSemaphore signal_semaphore, VkSemaphore wait_semaphore,
                               u64 host_tick);
@@ -73,6 +77,7 @@ private:
 private:
     const Device& device;             ///< Device.
     vk::Semaphore semaphore;          ///< Timeline semaphore.
+    vk::Semaphore upload_semaphore;   ///< Timeline semaphore of the transfer queue uploads.
     std::atomic<u64> gpu_tick{0};     ///< Current known GPU tick.
     std::atomic<u64> current_tick{1}; ///< Current logical tick.
     std::mutex wait_mutex;
@@ -5,6 +5,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <fstream>
 #include <iostream>
@@ -14,9 +15,9 @@
 #include <vector>
 #include <bit>
 #include <numeric>
-#include "common/cityhash.h"
 #include "common/fs/fs.h"
 #include "common/fs/path_util.h"
+#include "common/hash.h"
 #include "common/thread_worker.h"
 #include "core/core.h"
 #include "shader_recompiler/backend/spirv/emit_spirv.h"
@@ -62,9 +63,14 @@ using VideoCommon::FileEnvironment;
 using VideoCommon::GenericEnvironment;
 using VideoCommon::GraphicsEnvironment;
 
-constexpr u32 CACHE_VERSION = 18;
+constexpr u32 CACHE_VERSION = 20;
 constexpr std::array<char, 8> VULKAN_CACHE_MAGIC_NUMBER{'y', 'u', 'z', 'u', 'v', 'k', 'c', 'h'};
 
+/// New pipelines after which the driver pipeline cache is saved in the background
+constexpr size_t VULKAN_CACHE_SAVE_PIPELINES = 64;
+/// Time after which the driver pipeline cache is saved when it has any new pipelines
+constexpr auto VULKAN_CACHE_SAVE_INTERVAL = std::chrono::minutes{1};
+
 template <typename Container>
 auto MakeSpan(Container& container) {
     return std::span(container.data(), container.size());
@@ -112,6 +118,26 @@ Shader::CompareFunction MaxwellToCompareFunction(Maxwell::ComparisonOp compariso
     return {};
 }
 
+/// Returns the key of the shader modules of a pipeline, state passed through specialization
+/// constants is cleared so their variants share the same modules
+GraphicsPipelineCacheKey MakeGraphicsShadersKey(const GraphicsPipelineCacheKey& key) {
+    GraphicsPipelineCacheKey shaders_key{key};
+    shaders_key.state.alpha_test_func.Assign(0);
+    shaders_key.state.alpha_test_ref = 0;
+    shaders_key.state.point_size = 0;
+    return shaders_key;
+}
+
+GraphicsSpecializationData MakeSpecializationData(const GraphicsPipelineCacheKey& key) {
+    const auto alpha_test_func{
+        MaxwellToCompareFunction(key.state.UnpackComparisonOp(key.state.alpha_test_func.Value()))};
+    return GraphicsSpecializationData{
+        .alpha_test_func = static_cast<u32>(alpha_test_func),
+        .alpha_test_reference = std::bit_cast<f32>(key.state.alpha_test_ref),
+        .fixed_point_size = std::bit_cast<f32>(key.state.point_size),
+    };
+}
+
 Shader::AttributeType CastAttributeType(const FixedPipelineState::VertexAttribute& attr) {
     if (attr.enabled == 0) {
         return Shader::AttributeType::Disabled;
@@ -156,6 +182,7 @@ Shader::RuntimeInfo MakeRuntimeInfo(std::span<const Shader::IR::Program> program
                                     const Shader::IR::Program* previous_program,
                                     const Vulkan::Device& device) {
     Shader::RuntimeInfo info;
+    info.specialize_fixed_state = true;
     if (previous_program) {
         info.previous_stage_stores = previous_program->info.stores;
         info.previous_stage_legacy_stores_mapping = previous_program->info.legacy_stores_mapping;
@@ -319,7 +346,7 @@ size_t GetTotalPipelineWorkers() {
 } // Anonymous namespace
 
 size_t ComputePipelineCacheKey::Hash() const noexcept {
-    const u64 hash = Common::CityHash64(reinterpret_cast<const char*>(this), sizeof *this);
+    const u64 hash = Common::Hash::HashObject(*this);
     return static_cast<size_t>(hash);
 }
 
@@ -328,7 +355,7 @@ bool ComputePipelineCacheKey::operator==(const ComputePipelineCacheKey& rhs) con
 }
 
 size_t GraphicsPipelineCacheKey::Hash() const noexcept {
-    const u64 hash = Common::CityHash64(reinterpret_cast<const char*>(this), Size());
+    const u64 hash = Common::Hash::Hash64(std::span(reinterpret_cast<const u8*>(this), Size()));
     return static_cast<size_t>(hash);
 }
 
@@ -446,7 +473,10 @@ PipelineCache::PipelineCache(Tegra::MaxwellDeviceMemoryManager& device_memory_,
         .has_broken_robust =
             device.IsNvidia() && device.GetNvidiaArch() <= NvidiaArchitecture::Arch_Pascal,
         .min_ssbo_alignment = device.GetStorageBufferAlignment(),
-        .max_user_clip_distances = device.GetMaxUserClipDistances()
+        .max_user_clip_distances = device.GetMaxUserClipDistances(),
+        .emit_debug_names = device.HasDebuggingToolAttached() ||
+                            Settings::values.renderer_debug.GetValue() ||
+                            Settings::values.gpu_log_shader_dumps.GetValue(),
     };
 
     host_info = Shader::HostTranslateInfo{
@@ -536,7 +566,9 @@ PipelineCache::PipelineCache(Tegra::MaxwellDeviceMemoryManager& device_memory_,
 }
 
 PipelineCache::~PipelineCache() {
-    if (use_vulkan_pipeline_cache && !vulkan_pipeline_cache_filename.empty()) {
+    // Pipelines covered by a background save don't need another multi-megabyte write here.
+    if (use_vulkan_pipeline_cache && !vulkan_pipeline_cache_filename.empty() &&
+        unsaved_vulkan_pipelines > 0) {
         SerializeVulkanPipelineCache(vulkan_pipeline_cache_filename, vulkan_pipeline_cache,
                                      CACHE_VERSION);
     }
@@ -611,7 +643,7 @@ void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading
     if (device.IsKhrPipelineExecutablePropertiesEnabled()) {
         state.statistics = std::make_unique<PipelineStatistics>(device);
     }
-    const auto load_compute{[&](std::ifstream& file, FileEnvironment env) {
+    const auto load_compute{[&](std::istream& file, FileEnvironment env) {
         ComputePipelineCacheKey key;
         file.read(reinterpret_cast<char*>(&key), sizeof(key));
 
@@ -626,10 +658,10 @@ void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading
             if (state.has_loaded) {
                 callback(VideoCore::LoadCallbackStage::Build, state.built, state.total);
             }
-        });
+        }, Common::WorkPriority::Low);
         ++state.total;
     }};
-    const auto load_graphics{[&](std::ifstream& file, std::vector<FileEnvironment> envs) {
+    const auto load_graphics{[&](std::istream& file, std::vector<FileEnvironment> envs) {
         GraphicsPipelineCacheKey key;
         file.read(reinterpret_cast<char*>(&key), sizeof(key));
 
@@ -678,9 +710,10 @@ void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading
             if (state.has_loaded) {
                 callback(VideoCore::LoadCallbackStage::Build, state.built, state.total);
             }
-        });
+        }, Common::WorkPriority::Low);
         ++state.total;
     }};
+    VideoCommon::ImportPendingPipelineManifest(pipeline_cache_filename, CACHE_VERSION);
     VideoCommon::LoadPipelines(stop_loading, pipeline_cache_filename, CACHE_VERSION, load_compute,
                                load_graphics);
 
@@ -691,6 +724,10 @@ void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading
     state.has_loaded = true;
     lock.unlock();
 
+    if (stop_loading.stop_requested()) {
+        // Don't build pipelines from the disk cache that nobody is going to wait for
+        workers.CancelWork(Common::WorkPriority::Low);
+    }
     workers.WaitForRequests(stop_loading);
 
     if (use_vulkan_pipeline_cache) {
@@ -742,6 +779,23 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline(
     bool build_in_parallel) try {
     auto hash = key.Hash();
     LOG_INFO(Render_Vulkan, "0x{:016x}", hash);
+    Common::ThreadWorker* const thread_worker{build_in_parallel ? &workers : nullptr};
+    const GraphicsPipelineCacheKey shaders_key{MakeGraphicsShadersKey(key)};
+    std::shared_ptr<const GraphicsShaders> cached_shaders;
+    {
+        std::scoped_lock lock{graphics_shaders_mutex};
+        const auto it{graphics_shaders.find(shaders_key)};
+        if (it != graphics_shaders.end()) {
+            cached_shaders = it->second;
+        }
+    }
+    if (cached_shaders) {
+        // Only the specialized state differs from an existing pipeline, reuse its modules
+        return std::make_unique<GraphicsPipeline>(
+            scheduler, buffer_cache, texture_cache, vulkan_pipeline_cache, &shader_notify, device,
+            descriptor_pool, guest_descriptor_queue, thread_worker, statistics, render_pass_cache,
+            key, std::move(cached_shaders), MakeSpecializationData(key));
+    }
     size_t env_index{0};
     std::array<Shader::IR::Program, Maxwell::MaxShaderProgram> programs;
     const bool uses_vertex_a{key.unique_hashes[0] != 0};
@@ -786,7 +840,7 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline(
         }
     }
     std::array<const Shader::Info*, Maxwell::MaxShaderStage> infos{};
-    std::array<vk::ShaderModule, Maxwell::MaxShaderStage> modules;
+    auto shaders{std::make_shared<GraphicsShaders>()};
 
     const Shader::IR::Program* previous_stage{};
     Shader::Backend::Bindings binding;
@@ -807,7 +861,7 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline(
         ConvertLegacyToGeneric(program, runtime_info);
         const std::vector<u32> code{EmitSPIRV(profile, runtime_info, program, binding)};
         device.SaveShader(code);
-        modules[stage_index] = BuildShader(device, code);
+        shaders->modules[stage_index] = BuildShader(device, code);
 
         // Text log + .spv dump. Text log is gated by gpu_log_level != Off; .spv dump
         // is independent and gated only by gpu_log_shader_dumps.
@@ -829,15 +883,23 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline(
 
         if (device.HasDebuggingToolAttached()) {
             const std::string name{fmt::format("Shader {:016x}", key.unique_hashes[index])};
-            modules[stage_index].SetObjectNameEXT(name.c_str());
+            shaders->modules[stage_index].SetObjectNameEXT(name.c_str());
         }
         previous_stage = &program;
     }
-    Common::ThreadWorker* const thread_worker{build_in_parallel ? &workers : nullptr};
+    for (size_t stage = 0; stage < Maxwell::MaxShaderStage; ++stage) {
+        if (infos[stage]) {
+            shaders->infos[stage] = *infos[stage];
+        }
+    }
+    {
+        std::scoped_lock lock{graphics_shaders_mutex};
+        graphics_shaders.try_emplace(shaders_key, shaders);
+    }
     return std::make_unique<GraphicsPipeline>(
         scheduler, buffer_cache, texture_cache, vulkan_pipeline_cache, &shader_notify, device,
         descriptor_pool, guest_descriptor_queue, thread_worker, statistics, render_pass_cache, key,
-        std::move(modules), infos);
+        std::move(shaders), MakeSpecializationData(key));
 
 } catch (const Shader::Exception& exception) {
     auto hash = key.Hash();
@@ -877,6 +939,7 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline() {
         }
         SerializePipeline(key, env_ptrs, pipeline_cache_filename, CACHE_VERSION);
     });
+    QueueVulkanPipelineCacheSave();
     return pipeline;
 }
 
@@ -896,6 +959,7 @@ std::unique_ptr<ComputePipeline> PipelineCache::CreateComputePipeline(
         SerializePipeline(key, std::array<const GenericEnvironment*, 1>{&env_},
                           pipeline_cache_filename, CACHE_VERSION);
     });
+    QueueVulkanPipelineCacheSave();
     return pipeline;
 }
 
@@ -966,16 +1030,9 @@ std::unique_ptr<ComputePipeline> PipelineCache::CreateComputePipeline(
     return nullptr;
 }
 
-void PipelineCache::SerializeVulkanPipelineCache(const std::filesystem::path& filename,
-                                                 const vk::PipelineCache& pipeline_cache,
-                                                 u32 cache_version) try {
-    std::ofstream file(filename, std::ios::binary);
-    file.exceptions(std::ifstream::failbit);
-    if (!file.is_open()) {
-        LOG_ERROR(Common_Filesystem, "Failed to open Vulkan driver pipeline cache file {}",
-                  Common::FS::PathToUTF8String(filename));
-        return;
-    }
+namespace {
+void WriteVulkanPipelineCache(std::ofstream& file, const vk::PipelineCache& pipeline_cache,
+                              u32 cache_version) {
     file.write(VULKAN_CACHE_MAGIC_NUMBER.data(), VULKAN_CACHE_MAGIC_NUMBER.size())
         .write(reinterpret_cast<const char*>(&cache_version), sizeof(cache_version));
 
@@ -987,16 +1044,62 @@ void PipelineCache::SerializeVulkanPipelineCache(const std::filesystem::path& fi
         pipeline_cache.Read(&cache_size, cache_data.data());
     }
     file.write(cache_data.data(), cache_size);
+}
+} // Anonymous namespace
 
-    LOG_INFO(Render_Vulkan, "Vulkan driver pipelines cached at: {}",
-             Common::FS::PathToUTF8String(filename));
+void PipelineCache::QueueVulkanPipelineCacheSave() {
+    if (!use_vulkan_pipeline_cache || vulkan_pipeline_cache_filename.empty()) {
+        return;
+    }
+    ++unsaved_vulkan_pipelines;
+    const auto now = std::chrono::steady_clock::now();
+    if (unsaved_vulkan_pipelines < VULKAN_CACHE_SAVE_PIPELINES &&
+        now - last_vulkan_pipeline_cache_save < VULKAN_CACHE_SAVE_INTERVAL) {
+        return;
+    }
+    unsaved_vulkan_pipelines = 0;
+    last_vulkan_pipeline_cache_save = now;
+    serialization_thread.QueueWork([this] {
+        SerializeVulkanPipelineCache(vulkan_pipeline_cache_filename, vulkan_pipeline_cache,
+                                     CACHE_VERSION);
+    });
+}
+
+void PipelineCache::SerializeVulkanPipelineCache(const std::filesystem::path& filename,
+                                                 const vk::PipelineCache& pipeline_cache,
+                                                 u32 cache_version) {
+    // Write to a temporary file and swap it in, so a crash or a kill mid-write never leaves a
+    // truncated cache behind.
+    std::scoped_lock lock{vulkan_pipeline_cache_save_mutex};
+    auto temp_filename = filename;
+    temp_filename += ".tmp";
+    try {
+        std::ofstream file(temp_filename, std::ios::binary);
+        file.exceptions(std::ifstream::failbit);
+        if (!file.is_open()) {
+            LOG_ERROR(Common_Filesystem, "Failed to open Vulkan driver pipeline cache file {}",
+                      Common::FS::PathToUTF8String(temp_filename));
+            return;
+        }
+        WriteVulkanPipelineCache(file, pipeline_cache, cache_version);
+    } catch (const std::ios_base::failure& e) {
+        LOG_ERROR(Common_Filesystem, "{}", e.what());
+        if (!Common::FS::RemoveFile(temp_filename)) {
+            LOG_ERROR(Common_Filesystem, "Failed to delete Vulkan driver pipeline cache file {}",
+                      Common::FS::PathToUTF8String(temp_filename));
+        }
+        return;
+    }
 
-} catch (const std::ios_base::failure& e) {
-    LOG_ERROR(Common_Filesystem, "{}", e.what());
-    if (!Common::FS::RemoveFile(filename)) {
-        LOG_ERROR(Common_Filesystem, "Failed to delete Vulkan driver pipeline cache file {}",
-                  Common::FS::PathToUTF8String(filename));
+    std::error_code ec;
+    std::filesystem::rename(temp_filename, filename, ec);
+    if (ec) {
+        LOG_ERROR(Common_Filesystem, "Failed to replace Vulkan driver pipeline cache file {}: {}",
+                  Common::FS::PathToUTF8String(filename), ec.message());
+        return;
     }
+    LOG_INFO(Render_Vulkan, "Vulkan driver pipelines cached at: {}",
+             Common::FS::PathToUTF8String(filename));
 }
 
 vk::PipelineCache PipelineCache::LoadVulkanPipelineCache(const std::filesystem::path& filename,
@@ -7,9 +7,11 @@
 #pragma once
 
 #include <array>
+#include <chrono>
 #include <cstddef>
 #include <filesystem>
 #include <memory>
+#include <mutex>
 #include <type_traits>
 #include <ankerl/unordered_dense.h>
 #include <vector>
@@ -137,6 +139,10 @@ private:
                                                            PipelineStatistics* statistics,
                                                            bool build_in_parallel);
 
+    /// Counts a newly built pipeline and saves the driver pipeline cache in the background once
+    /// enough pipelines or time have accumulated since the last save.
+    void QueueVulkanPipelineCacheSave();
+
     void SerializeVulkanPipelineCache(const std::filesystem::path& filename,
                                       const vk::PipelineCache& pipeline_cache, u32 cache_version);
 
@@ -160,6 +166,11 @@ private:
     ankerl::unordered_dense::map<ComputePipelineCacheKey, std::unique_ptr<ComputePipeline>> compute_cache;
     ankerl::unordered_dense::map<GraphicsPipelineCacheKey, std::unique_ptr<GraphicsPipeline>> graphics_cache;
 
+    /// Shader modules indexed by pipeline keys stripped of the specialized state
+    std::mutex graphics_shaders_mutex;
+    ankerl::unordered_dense::map<GraphicsPipelineCacheKey, std::shared_ptr<const GraphicsShaders>>
+        graphics_shaders;
+
     ShaderPools main_pools;
 
     Shader::Profile profile;
@@ -169,6 +180,10 @@ private:
 
     std::filesystem::path vulkan_pipeline_cache_filename;
     vk::PipelineCache vulkan_pipeline_cache;
+    std::mutex vulkan_pipeline_cache_save_mutex;
+    size_t unsaved_vulkan_pipelines{};
+    std::chrono::steady_clock::time_point last_vulkan_pipeline_cache_save{
+        std::chrono::steady_clock::now()};
 
     Common::ThreadWorker workers;
     Common::ThreadWorker serialization_thread;
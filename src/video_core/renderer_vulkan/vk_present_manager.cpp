@@ -111,9 +111,15 @@ PresentManager::PresentManager(const vk::Instance& instance_,
     , surface{surface_}
     , blit_supported{CanBlitToSwapchain(device.GetPhysical(), swapchain.GetImageViewFormat())}
     , use_present_thread{Settings::values.async_presentation.GetValue()}
+    , max_frames_in_flight{Settings::values.max_frames_in_flight.GetValue()}
 {
     SetImageCount();
 
+    // With a limit, fewer frames can be queued for presentation ahead of the display as well
+    const std::size_t frame_count =
+        max_frames_in_flight != 0 ? std::min<std::size_t>(image_count, max_frames_in_flight)
+                                  : image_count;
+
     auto& dld = device.GetLogical();
     cmdpool = dld.CreateCommandPool({
         .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
@@ -122,9 +128,9 @@ PresentManager::PresentManager(const vk::Instance& instance_,
             VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,
         .queueFamilyIndex = device.GetGraphicsFamily(),
     });
-    auto cmdbuffers = cmdpool.Allocate(image_count);
+    auto cmdbuffers = cmdpool.Allocate(frame_count);
 
-    frames.resize(image_count);
+    frames.resize(frame_count);
     for (u32 i = 0; i < frames.size(); i++) {
         Frame& frame = frames[i];
         frame.cmdbuf = vk::CommandBuffer{cmdbuffers[i], device.GetDispatchLoader()};
@@ -202,7 +208,8 @@ void PresentManager::RecreateFrame(Frame* frame, u32 width, u32 height, VkFormat
         .arrayLayers = 1,
         .samples = VK_SAMPLE_COUNT_1_BIT,
         .tiling = VK_IMAGE_TILING_OPTIMAL,
-        .usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT,
+        .usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT |
+                 VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT,
         .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
         .queueFamilyIndexCount = 0,
         .pQueueFamilyIndices = nullptr,
@@ -266,6 +273,7 @@ void PresentManager::WaitPresent() {
 
 void PresentManager::PresentThread(std::stop_token token) {
     Common::SetCurrentThreadName("VulkanPresent");
+    Common::SetCurrentThreadRole(Common::ThreadRole::Render);
     while (!token.stop_requested()) {
         std::unique_lock lock{queue_mutex};
         // Wait for presentation frames
@@ -280,6 +288,10 @@ void PresentManager::PresentThread(std::stop_token token) {
             // before the queue lock goes out of scope. This way the swapchain
             // lock in WaitPresent is guaranteed to occur after here.
             std::exchange(lock, std::unique_lock{swapchain_mutex});
+
+            // The frame was queued right after its submission was recorded, make sure it
+            // reached the queue before waiting on its semaphore.
+            scheduler.WaitSubmissions();
             CopyToSwapchain(frame);
 
             // Free the frame for reuse
@@ -338,7 +350,8 @@ void PresentManager::CopyToSwapchainImpl(Frame* frame) {
         RecreateSwapchain(frame);
     }
 
-    while (swapchain.AcquireNextImage()) {
+    // A suboptimal swapchain can still be presented to, it's recreated before the next frame
+    while (swapchain.AcquireNextImage() && swapchain.IsOutDated()) {
         RecreateSwapchain(frame);
     }
 
@@ -487,6 +500,10 @@ void PresentManager::CopyToSwapchainImpl(Frame* frame) {
 
     // Present
     swapchain.Present(render_semaphore);
+
+    // Hold the frames back until the display caught up, this throttles the emulation to the
+    // actual display timing.
+    swapchain.WaitForPresent(max_frames_in_flight);
 }
 
 } // namespace Vulkan
@@ -60,6 +60,11 @@ public:
     /// Waits for the present thread to finish presenting all queued frames.
     void WaitPresent();
 
+    /// Returns the number of presentation frames
+    [[nodiscard]] std::size_t GetFrameCount() const noexcept {
+        return frames.size();
+    }
+
 private:
     void PresentThread(std::stop_token token);
 
@@ -91,6 +96,7 @@ private:
     std::jthread present_thread;
     bool blit_supported;
     bool use_present_thread;
+    u32 max_frames_in_flight;
     std::size_t image_count{};
 };
 
@@ -1538,11 +1538,9 @@ bool QueryCacheRuntime::HostConditionalRenderingCompareValues(VideoCommon::Looku
         }
     }
 
-    if (!is_gpu_high) {
-        EndHostConditionalRendering();
-        return true;
-    }
-
+    // Values written by the GPU are compared by the resolve pass at every accuracy level, so the
+    // predicate never has to be read back. Host query results that were not written to guest
+    // memory yet can't be compared there, render unconditionally for those.
     if (!is_in_bc[0] && !is_in_bc[1]) {
         EndHostConditionalRendering();
         return true;
@@ -8,6 +8,7 @@
 #include <array>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -17,6 +18,7 @@
 #include "common/logging.h"
 #include "common/scope_exit.h"
 #include "common/settings.h"
+#include "common/trace.h"
 #include "video_core/buffer_cache/buffer_cache.h"
 #include "video_core/gpu_logging/gpu_logging.h"
 #include "video_core/control/channel_state.h"
@@ -194,6 +196,20 @@ bool IsPrimitiveRestartSupported(const Device& device, VkPrimitiveTopology topol
             (topology == VK_PRIMITIVE_TOPOLOGY_PATCH_LIST &&
              device.IsPatchListPrimitiveRestartSupported()));
 }
+
+/// Every dirty flag read by RasterizerVulkan::UpdateDynamicStates
+const Tegra::Engines::Maxwell3D::DirtyState::Flags DYNAMIC_STATE_FLAGS = [] {
+    Tegra::Engines::Maxwell3D::DirtyState::Flags flags;
+    for (size_t index = Dirty::VertexInput; index < Dirty::Last; ++index) {
+        flags[index] = true;
+    }
+    flags[VideoCommon::Dirty::RescaleViewports] = true;
+    flags[VideoCommon::Dirty::RescaleScissors] = true;
+    flags[VideoCommon::Dirty::VertexBuffers] = true;
+    flags[VideoCommon::Dirty::DepthBiasGlobal] = true;
+    return flags;
+}();
+
 } // Anonymous namespace
 
 RasterizerVulkan::RasterizerVulkan(Core::Frontend::EmuWindow& emu_window_, Tegra::GPU& gpu_,
@@ -230,6 +246,7 @@ RasterizerVulkan::~RasterizerVulkan() {
 
 template <typename Func>
 void RasterizerVulkan::PrepareDraw(bool is_indexed, Func&& draw_func) {
+    TRACE_SCOPE("Draw");
 
     SCOPE_EXIT {
         gpu.TickWork();
@@ -237,15 +254,22 @@ void RasterizerVulkan::PrepareDraw(bool is_indexed, Func&& draw_func) {
     FlushWork();
     gpu_memory->FlushCaching();
 
-    GraphicsPipeline* const pipeline{pipeline_cache.CurrentGraphicsPipeline()};
+    GraphicsPipeline* pipeline;
+    {
+        TRACE_SCOPE("Pipeline lookup");
+        pipeline = pipeline_cache.CurrentGraphicsPipeline();
+    }
     if (!pipeline) {
         return;
     }
     std::scoped_lock lock{buffer_cache.mutex, texture_cache.mutex};
     // update engine as channel may be different.
     pipeline->SetEngine(maxwell3d, gpu_memory);
-    if (!pipeline->Configure(is_indexed))
-        return;
+    {
+        TRACE_SCOPE("Pipeline configure");
+        if (!pipeline->Configure(is_indexed))
+            return;
+    }
 
     UpdateDynamicStates();
 
@@ -288,6 +312,41 @@ void RasterizerVulkan::Draw(bool is_indexed, u32 instance_count) {
     });
 }
 
+void RasterizerVulkan::DrawIndexedBatch() {
+    PrepareDraw(true, [this] {
+        const auto& draw_state = maxwell3d->draw_manager.draw_state;
+        const auto& draws = draw_state.batched_draws;
+        const u32 base_vertex = draw_state.base_index;
+        const u32 base_instance = draw_state.base_instance;
+        if (!device.IsExtMultiDrawSupported()) {
+            scheduler.Record([draws, base_vertex, base_instance](vk::CommandBuffer cmdbuf) {
+                for (const auto& draw : draws) {
+                    cmdbuf.DrawIndexed(draw.count, 1, draw.first, base_vertex, base_instance);
+                }
+            });
+            return;
+        }
+        std::vector<VkMultiDrawIndexedInfoEXT> index_info(draws.size());
+        for (size_t i = 0; i < draws.size(); ++i) {
+            index_info[i] = VkMultiDrawIndexedInfoEXT{
+                .firstIndex = draws[i].first,
+                .indexCount = draws[i].count,
+                .vertexOffset = static_cast<s32>(base_vertex),
+            };
+        }
+        const size_t max_draws = device.GetMaxMultiDrawCount();
+        scheduler.Record([index_info = std::move(index_info), base_instance,
+                          max_draws](vk::CommandBuffer cmdbuf) {
+            for (size_t offset = 0; offset < index_info.size(); offset += max_draws) {
+                const size_t count = (std::min)(max_draws, index_info.size() - offset);
+                cmdbuf.DrawMultiIndexedEXT(
+                    vk::Span<VkMultiDrawIndexedInfoEXT>(index_info.data() + offset, count), 1,
+                    base_instance);
+            }
+        });
+    });
+}
+
 void RasterizerVulkan::DrawIndirect() {
     const auto& params = maxwell3d->draw_manager.indirect_state;
     buffer_cache.SetDrawIndirect(&params);
@@ -425,7 +484,7 @@ void RasterizerVulkan::Clear(u32 layer_count) {
                                  !scheduler.IsRenderPassActive() &&
                                  (!use_color || color_full_channels) && ds_deferrable;
     if (!can_defer_clear) {
-        scheduler.RequestRenderpass(framebuffer);
+        scheduler.RequestRendering(framebuffer);
     }
 
     query_cache.NotifySegment(true);
@@ -575,6 +634,7 @@ void RasterizerVulkan::Clear(u32 layer_count) {
 }
 
 void RasterizerVulkan::DispatchCompute() {
+    TRACE_SCOPE("Dispatch");
     FlushWork();
     gpu_memory->FlushCaching();
 
@@ -787,6 +847,25 @@ void RasterizerVulkan::OnCacheInvalidation(DAddr addr, u64 size) {
     pipeline_cache.InvalidateRegion(addr, size);
 }
 
+void RasterizerVulkan::OnCacheInvalidationBatch(
+    std::span<const std::pair<DAddr, std::size_t>> sequences) {
+    {
+        std::scoped_lock lock{texture_cache.mutex};
+        for (const auto& [addr, size] : sequences) {
+            texture_cache.WriteMemory(addr, size);
+        }
+    }
+    {
+        std::scoped_lock lock{buffer_cache.mutex};
+        for (const auto& [addr, size] : sequences) {
+            buffer_cache.WriteMemory(addr, size);
+        }
+    }
+    for (const auto& [addr, size] : sequences) {
+        pipeline_cache.InvalidateRegion(addr, size);
+    }
+}
+
 void RasterizerVulkan::InvalidateGPUCache() {
     gpu.InvalidateGPUCache();
 }
@@ -871,7 +950,7 @@ void RasterizerVulkan::TiledCacheBarrier() {
 }
 
 void RasterizerVulkan::FlushCommands() {
-    if (draw_counter == 0) {
+    if (draw_counter == 0 && !fence_manager.HasUnsubmittedFences()) {
         return;
     }
     draw_counter = 0;
@@ -959,9 +1038,27 @@ std::optional<FramebufferTextureInfo> RasterizerVulkan::AccelerateDisplay(
     info.height = image_view->size.height;
     info.scaled_width = scaled ? resolution.ScaleUp(info.width) : info.width;
     info.scaled_height = scaled ? resolution.ScaleUp(info.height) : info.height;
+    const auto& image = texture_cache.GetImage(image_view->image_id);
+    if (image.info.format == image_view->format && image_view->Samples() == VK_SAMPLE_COUNT_1_BIT) {
+        info.format =
+            MaxwellToVK::SurfaceFormat(device, FormatType::Optimal, false, image.info.format)
+                .format;
+    }
     return info;
 }
 
+void RasterizerVulkan::ChangeResolution(Settings::ResolutionSetup setup) {
+    std::scoped_lock lock{texture_cache.mutex};
+    // Scaled copies have the size of the current resolution. They are copied back to the original
+    // images and freed, and the images are scaled up again at the new resolution when rendered to.
+    texture_cache.ScaleDownImages();
+    scheduler.Finish();
+    texture_cache.ReleaseScaledImages();
+    Settings::TranslateResolutionInfo(setup, Settings::values.resolution_info);
+    LOG_INFO(Render_Vulkan, "Dynamic resolution changed to {:.2f}x",
+             Settings::values.resolution_info.up_factor);
+}
+
 void RasterizerVulkan::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
                                          const VideoCore::DiskResourceLoadCallback& callback) {
     pipeline_cache.LoadDiskResources(title_id, stop_loading, callback);
@@ -1002,6 +1099,13 @@ bool AccelerateDMA::BufferCopy(GPUVAddr src_address, GPUVAddr dest_address, u64
     return buffer_cache.DMACopy(src_address, dest_address, amount);
 }
 
+bool AccelerateDMA::BufferCopyLines(GPUVAddr src_address, u64 src_pitch, GPUVAddr dest_address,
+                                    u64 dest_pitch, u64 line_length, u32 line_count) {
+    std::scoped_lock lock{buffer_cache.mutex};
+    return buffer_cache.DMACopyLines(src_address, src_pitch, dest_address, dest_pitch,
+                                     line_length, line_count);
+}
+
 template <bool IS_IMAGE_UPLOAD>
 bool AccelerateDMA::DmaBufferImageCopy(const Tegra::DMA::ImageCopy& copy_info,
                                        const Tegra::DMA::BufferOperand& buffer_operand,
@@ -1057,6 +1161,11 @@ void RasterizerVulkan::UpdateDynamicStates() {
         flags[Dirty::PrimitiveRestartEnable] = true;
     }
 
+    // Most draws don't touch any dynamic state, skip testing each flag individually for those.
+    if (!topology_changed && (flags & DYNAMIC_STATE_FLAGS).none()) {
+        return;
+    }
+
     UpdateViewportsState(regs);
     UpdateScissorsState(regs);
     UpdateDepthBias(regs);
@@ -1964,4 +2073,8 @@ void RasterizerVulkan::ReleaseChannel(s32 channel_id) {
     query_cache.EraseChannel(channel_id);
 }
 
+void RasterizerVulkan::PrefetchShaderProgram(size_t index) {
+    pipeline_cache.PrefetchProgram(index);
+}
+
 } // namespace Vulkan
@@ -171,4 +171,43 @@ VkRenderPass RenderPassCache::Get(const RenderPassKey& key) {
     return *pair->second;
 }
 
+VkPipelineRenderingCreateInfo MakePipelineRenderingInfo(const Device& device,
+                                                        const RenderPassKey& key,
+                                                        std::array<VkFormat, 8>& color_formats) {
+    using MaxwellToVK::SurfaceFormat;
+
+    u32 num_attachments{};
+    for (size_t index = 0; index < key.color_formats.size(); ++index) {
+        const PixelFormat format{key.color_formats[index]};
+        if (format == PixelFormat::Invalid) {
+            color_formats[index] = VK_FORMAT_UNDEFINED;
+            continue;
+        }
+        color_formats[index] = SurfaceFormat(device, FormatType::Optimal, true, format).format;
+        num_attachments = static_cast<u32>(index + 1);
+    }
+    VkFormat depth_format{VK_FORMAT_UNDEFINED};
+    VkFormat stencil_format{VK_FORMAT_UNDEFINED};
+    if (key.depth_format != PixelFormat::Invalid) {
+        const VkFormat format{
+            SurfaceFormat(device, FormatType::Optimal, true, key.depth_format).format};
+        const SurfaceType surface_type{GetSurfaceType(key.depth_format)};
+        if (surface_type != SurfaceType::Stencil) {
+            depth_format = format;
+        }
+        if (surface_type == SurfaceType::DepthStencil || surface_type == SurfaceType::Stencil) {
+            stencil_format = format;
+        }
+    }
+    return {
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO,
+        .pNext = nullptr,
+        .viewMask = 0,
+        .colorAttachmentCount = num_attachments,
+        .pColorAttachmentFormats = color_formats.data(),
+        .depthAttachmentFormat = depth_format,
+        .stencilAttachmentFormat = stencil_format,
+    };
+}
+
 } // namespace Vulkan
@@ -62,4 +62,11 @@ private:
     std::mutex mutex;
 };
 
+/**
+ * Describes the attachments of a render pass key to a pipeline used with dynamic rendering.
+ * The returned structure points into color_formats, which has to outlive it.
+ */
+[[nodiscard]] VkPipelineRenderingCreateInfo MakePipelineRenderingInfo(
+    const Device& device, const RenderPassKey& key, std::array<VkFormat, 8>& color_formats);
+
 } // namespace Vulkan
@@ -4,6 +4,7 @@
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
 #include <thread>
@@ -15,6 +16,7 @@
 
 #include "common/settings.h"
 #include "common/thread.h"
+#include "common/trace.h"
 #include "video_core/gpu_logging/gpu_logging.h"
 #include "video_core/renderer_vulkan/vk_command_pool.h"
 #include "video_core/renderer_vulkan/vk_graphics_pipeline.h"
@@ -45,10 +47,27 @@ void Scheduler::CommandChunk::ExecuteAll(vk::CommandBuffer cmdbuf,
 Scheduler::Scheduler(const Device& device_, StateTracker& state_tracker_)
     : device{device_}, state_tracker{state_tracker_},
       master_semaphore{std::make_unique<MasterSemaphore>(device)},
-      command_pool{std::make_unique<CommandPool>(*master_semaphore, device)} {
+      command_pool{
+          std::make_unique<CommandPool>(*master_semaphore, device, device.GetGraphicsFamily())} {
+    if (device.HasAsyncTransferQueue()) {
+        upload_command_pool =
+            std::make_unique<CommandPool>(*master_semaphore, device, device.GetTransferFamily());
+    }
 
+    measure_gpu_time = Settings::values.dynamic_resolution.GetValue() && device.SupportsTimestamps();
+    if ((Common::Trace::IsEnabled() || measure_gpu_time) && device.SupportsTimestamps()) {
+        timestamp_pool = device.GetLogical().CreateQueryPool({
+            .sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .queryType = VK_QUERY_TYPE_TIMESTAMP,
+            .queryCount = TIMESTAMP_BATCHES * 2,
+            .pipelineStatistics = 0,
+        });
+    }
     AcquireNewChunk();
     AllocateWorkerCommandBuffer();
+    submit_thread = std::jthread([this](std::stop_token token) { SubmitThread(token); });
     worker_thread = std::jthread([this](std::stop_token token) { WorkerThread(token); });
 }
 
@@ -79,7 +98,16 @@ void Scheduler::WaitWorker() {
     }
 
     // Now wait for execution to finish.
-    std::scoped_lock el{execution_mutex};
+    {
+        std::scoped_lock el{execution_mutex};
+    }
+
+    WaitSubmissions();
+}
+
+void Scheduler::WaitSubmissions() {
+    std::unique_lock lk{submit_queue_mutex};
+    submit_cv.wait(lk, [this] { return submit_queue.empty() && !is_submitting; });
 }
 
 void Scheduler::DispatchWork() {
@@ -134,12 +162,83 @@ void Scheduler::BeginRenderPassImpl(const Framebuffer* framebuffer, VkRenderPass
     renderpass_image_ranges = framebuffer->ImageRanges();
 }
 
+void Scheduler::BeginRenderingImpl(const Framebuffer* framebuffer, const DeferredClear* clear) {
+    const VkExtent2D render_area = framebuffer->RenderArea();
+    state.rendering_id = framebuffer->Id();
+    state.render_area = render_area;
+
+    if (GPU::Logging::IsActive() && Settings::values.gpu_log_vulkan_calls.GetValue()) {
+        const std::string render_pass_info =
+            fmt::format("renderArea={}x{}, numImages={}, dynamic", render_area.width,
+                        render_area.height, framebuffer->NumImages());
+        GPU::Logging::GPULogger::GetInstance().LogRenderPassBegin(render_pass_info);
+    }
+
+    const auto make_attachment = [](VkImageView view, bool is_clear, const VkClearValue& value) {
+        return VkRenderingAttachmentInfo{
+            .sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO,
+            .pNext = nullptr,
+            .imageView = view,
+            .imageLayout = VK_IMAGE_LAYOUT_GENERAL,
+            .resolveMode = VK_RESOLVE_MODE_NONE,
+            .resolveImageView = VK_NULL_HANDLE,
+            .resolveImageLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+            .loadOp = is_clear ? VK_ATTACHMENT_LOAD_OP_CLEAR : VK_ATTACHMENT_LOAD_OP_LOAD,
+            .storeOp = VK_ATTACHMENT_STORE_OP_STORE,
+            .clearValue = value,
+        };
+    };
+    const u32 num_colors = framebuffer->NumColorAttachments();
+    std::array<VkRenderingAttachmentInfo, 8> color_attachments{};
+    for (u32 slot = 0; slot < num_colors; ++slot) {
+        const bool is_clear = clear && (clear->color_clear_mask & (1u << slot)) != 0;
+        color_attachments[slot] =
+            make_attachment(framebuffer->ColorViews()[slot], is_clear,
+                            is_clear ? clear->color_values[slot] : VkClearValue{});
+    }
+    const bool is_depth_stencil_clear = clear && clear->depth_stencil;
+    const VkRenderingAttachmentInfo depth_stencil_attachment =
+        make_attachment(framebuffer->DepthStencilView(), is_depth_stencil_clear,
+                        is_depth_stencil_clear ? clear->depth_stencil_value : VkClearValue{});
+    const bool has_depth = framebuffer->HasAspectDepthBit();
+    const bool has_stencil = framebuffer->HasAspectStencilBit();
+    const u32 num_layers = framebuffer->NumLayers();
+    Record([color_attachments, depth_stencil_attachment, num_colors, has_depth, has_stencil,
+            render_area, num_layers](vk::CommandBuffer cmdbuf) {
+        const VkRenderingInfo rendering_info{
+            .sType = VK_STRUCTURE_TYPE_RENDERING_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .renderArea =
+                {
+                    .offset = {.x = 0, .y = 0},
+                    .extent = render_area,
+                },
+            .layerCount = num_layers,
+            .viewMask = 0,
+            .colorAttachmentCount = num_colors,
+            .pColorAttachments = color_attachments.data(),
+            .pDepthAttachment = has_depth ? &depth_stencil_attachment : nullptr,
+            .pStencilAttachment = has_stencil ? &depth_stencil_attachment : nullptr,
+        };
+        cmdbuf.BeginRendering(rendering_info);
+    });
+    num_renderpass_images = framebuffer->NumImages();
+    renderpass_images = framebuffer->Images();
+    renderpass_image_ranges = framebuffer->ImageRanges();
+}
+
 void Scheduler::RealizeDeferredClear() {
     if (deferred_clear.framebuffer == nullptr) {
         return;
     }
     const DeferredClear dc = deferred_clear;
     deferred_clear = {};
+    if (dc.framebuffer->UsesDynamicRendering()) {
+        EndRenderPass();
+        BeginRenderingImpl(dc.framebuffer, &dc);
+        return;
+    }
 
     std::array<VkClearValue, 9> clear_values{};
     u32 count = 0;
@@ -191,7 +290,9 @@ bool Scheduler::DeferDepthStencilClear(const Framebuffer* framebuffer, const VkC
 }
 
 void Scheduler::RequestRenderpass(const Framebuffer* framebuffer) {
-    if (deferred_clear.framebuffer == framebuffer) {
+    // A deferred clear of a framebuffer drawn with dynamic rendering is realized as dynamic
+    // rendering, ending the pass below realizes it
+    if (deferred_clear.framebuffer == framebuffer && !framebuffer->UsesDynamicRendering()) {
         RealizeDeferredClear();
         return;
     }
@@ -208,6 +309,25 @@ void Scheduler::RequestRenderpass(const Framebuffer* framebuffer) {
     BeginRenderPassImpl(framebuffer, renderpass, nullptr, 0);
 }
 
+void Scheduler::RequestRendering(const Framebuffer* framebuffer) {
+    if (!framebuffer->UsesDynamicRendering()) {
+        RequestRenderpass(framebuffer);
+        return;
+    }
+    if (deferred_clear.framebuffer == framebuffer) {
+        RealizeDeferredClear();
+        return;
+    }
+    const VkExtent2D render_area = framebuffer->RenderArea();
+    if (framebuffer->Id() == state.rendering_id && render_area.width == state.render_area.width &&
+        render_area.height == state.render_area.height) {
+        return;
+    }
+    // Ends any active pass and realizes a deferred clear
+    EndRenderPass();
+    BeginRenderingImpl(framebuffer, nullptr);
+}
+
 void Scheduler::RequestOutsideRenderPassOperationContext() {
     EndRenderPass();
 }
@@ -238,6 +358,14 @@ bool Scheduler::UpdateGraphicsPipeline(GraphicsPipeline* pipeline) {
     return true;
 }
 
+bool Scheduler::UpdateComputePipeline(ComputePipeline* pipeline) {
+    if (state.compute_pipeline == pipeline) {
+        return false;
+    }
+    state.compute_pipeline = pipeline;
+    return true;
+}
+
 bool Scheduler::UpdateRescaling(bool is_rescaling) {
     if (state.rescaling_defined && is_rescaling == state.is_rescaling) {
         return false;
@@ -249,6 +377,7 @@ bool Scheduler::UpdateRescaling(bool is_rescaling) {
 
 void Scheduler::WorkerThread(std::stop_token stop_token) {
     Common::SetCurrentThreadName("VulkanWorker");
+    Common::SetCurrentThreadRole(Common::ThreadRole::Render);
 
     const auto TryPopQueue{[this](auto& work) -> bool {
         if (work_queue.empty()) {
@@ -283,7 +412,10 @@ void Scheduler::WorkerThread(std::stop_token stop_token) {
             // Perform the work, tracking whether the chunk was a submission
             // before executing.
             const bool has_submit = work->HasSubmit();
-            work->ExecuteAll(current_cmdbuf, current_upload_cmdbuf);
+            {
+                TRACE_SCOPE("Record chunk");
+                work->ExecuteAll(current_cmdbuf, current_upload_cmdbuf);
+            }
 
             // If the chunk was a submission, reallocate the command buffer.
             if (has_submit) {
@@ -300,6 +432,57 @@ void Scheduler::WorkerThread(std::stop_token stop_token) {
     }
 }
 
+void Scheduler::SubmitThread(std::stop_token stop_token) {
+    Common::SetCurrentThreadName("VulkanSubmit");
+    Common::SetCurrentThreadRole(Common::ThreadRole::Render);
+
+    while (true) {
+        PendingSubmit submit;
+        {
+            std::unique_lock lk{submit_queue_mutex};
+            submit_cv.wait(lk, stop_token, [this] { return !submit_queue.empty(); });
+            if (submit_queue.empty()) {
+                // Only reached when stopping, everything recorded has been submitted.
+                return;
+            }
+            submit = std::move(submit_queue.front());
+            submit_queue.pop();
+            is_submitting = true;
+        }
+        SubmitPending(submit);
+        {
+            std::scoped_lock lk{submit_queue_mutex};
+            is_submitting = false;
+        }
+        submit_cv.notify_all();
+    }
+}
+
+void Scheduler::SubmitPending(PendingSubmit& submit) {
+    TRACE_SCOPE("vkQueueSubmit");
+    if (on_submit) {
+        on_submit();
+    }
+
+    std::scoped_lock lock{submit_mutex};
+    switch (const VkResult result = master_semaphore->SubmitQueue(
+                submit.cmdbuf, submit.upload_cmdbuf, submit.signal_semaphore,
+                submit.wait_semaphore, submit.signal_value)) {
+    case VK_SUCCESS:
+        // Log successful queue submission
+        if (GPU::Logging::IsActive() && Settings::values.gpu_log_vulkan_calls.GetValue()) {
+            GPU::Logging::GPULogger::GetInstance().LogVulkanCall("vkQueueSubmit", "", VK_SUCCESS);
+        }
+        break;
+    case VK_ERROR_DEVICE_LOST:
+        device.ReportLoss();
+        [[fallthrough]];
+    default:
+        vk::Check(result);
+        break;
+    }
+}
+
 void Scheduler::AllocateWorkerCommandBuffer() {
     current_cmdbuf = vk::CommandBuffer(command_pool->Commit(), device.GetDispatchLoader());
     current_cmdbuf.Begin({
@@ -308,13 +491,65 @@ void Scheduler::AllocateWorkerCommandBuffer() {
         .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
         .pInheritanceInfo = nullptr,
     });
-    current_upload_cmdbuf = vk::CommandBuffer(command_pool->Commit(), device.GetDispatchLoader());
+    CommandPool& upload_pool = upload_command_pool ? *upload_command_pool : *command_pool;
+    current_upload_cmdbuf = vk::CommandBuffer(upload_pool.Commit(), device.GetDispatchLoader());
     current_upload_cmdbuf.Begin({
         .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
         .pNext = nullptr,
         .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
         .pInheritanceInfo = nullptr,
     });
+
+    current_timestamp_query = NO_TIMESTAMP;
+    if (timestamp_pool && (Common::Trace::IsEnabled() || measure_gpu_time) &&
+        timestamp_batches.size() < TIMESTAMP_BATCHES) {
+        current_timestamp_query = timestamp_cursor * 2;
+        timestamp_cursor = (timestamp_cursor + 1) % TIMESTAMP_BATCHES;
+        current_cmdbuf.ResetQueryPool(*timestamp_pool, current_timestamp_query, 2);
+        current_cmdbuf.WriteTimestamp(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, *timestamp_pool,
+                                      current_timestamp_query);
+    }
+}
+
+void Scheduler::EndTimestampBatch(vk::CommandBuffer cmdbuf, u64 signal_value) {
+    if (current_timestamp_query == NO_TIMESTAMP) {
+        return;
+    }
+    cmdbuf.WriteTimestamp(VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, *timestamp_pool,
+                          current_timestamp_query + 1);
+    timestamp_batches.push_back(TimestampBatch{
+        .tick = signal_value,
+        .query = current_timestamp_query,
+        .submit_ns = Common::Trace::Now(),
+    });
+    current_timestamp_query = NO_TIMESTAMP;
+}
+
+void Scheduler::CollectTimestamps() {
+    const double period = static_cast<double>(device.GetTimestampPeriod());
+    while (!timestamp_batches.empty() && master_semaphore->IsFree(timestamp_batches.front().tick)) {
+        const TimestampBatch batch = timestamp_batches.front();
+        timestamp_batches.pop_front();
+
+        std::array<u64, 2> ticks{};
+        if (device.GetLogical().GetQueryResults(*timestamp_pool, batch.query, 2, sizeof(ticks),
+                                                ticks.data(), sizeof(u64),
+                                                VK_QUERY_RESULT_64_BIT) != VK_SUCCESS) {
+            continue;
+        }
+        const s64 gpu_begin = static_cast<s64>(static_cast<double>(ticks[0]) * period);
+        const s64 gpu_end = static_cast<s64>(static_cast<double>(ticks[1]) * period);
+        if (measure_gpu_time) {
+            gpu_busy_ns.fetch_add(static_cast<u64>((std::max<s64>)(gpu_end - gpu_begin, 0)),
+                                  std::memory_order_relaxed);
+        }
+        // The GPU clock has an unknown origin. A batch cannot start before it was handed to the
+        // driver, so the tightest of these bounds seen so far is used to place it on the CPU clock.
+        gpu_time_offset = (std::max)(gpu_time_offset, static_cast<s64>(batch.submit_ns) - gpu_begin);
+        Common::Trace::AddEvent("GPU submission", static_cast<u64>(gpu_begin + gpu_time_offset),
+                                static_cast<u64>((std::max)(gpu_begin, gpu_end) + gpu_time_offset),
+                                Common::Trace::Track::Gpu);
+    }
 }
 
 u64 Scheduler::SubmitExecution(VkSemaphore signal_semaphore, VkSemaphore wait_semaphore) {
@@ -332,30 +567,25 @@ u64 Scheduler::SubmitExecution(VkSemaphore signal_semaphore, VkSemaphore wait_se
         };
         upload_cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, WRITE_BARRIER);
         upload_cmdbuf.End();
+        EndTimestampBatch(cmdbuf, signal_value);
         cmdbuf.End();
-
-        if (on_submit) {
-            on_submit();
+        if (timestamp_pool) {
+            CollectTimestamps();
         }
 
-        std::scoped_lock lock{submit_mutex};
-        switch (const VkResult result = master_semaphore->SubmitQueue(
-                    cmdbuf, upload_cmdbuf, signal_semaphore, wait_semaphore, signal_value)) {
-        case VK_SUCCESS:
-            // Log successful queue submission
-            if (GPU::Logging::IsActive() &&
-                Settings::values.gpu_log_vulkan_calls.GetValue()) {
-                GPU::Logging::GPULogger::GetInstance().LogVulkanCall(
-                    "vkQueueSubmit", "", VK_SUCCESS);
-            }
-            break;
-        case VK_ERROR_DEVICE_LOST:
-            device.ReportLoss();
-            [[fallthrough]];
-        default:
-            vk::Check(result);
-            break;
+        // Hand the finished command buffers over, the worker keeps recording the next chunks
+        // into fresh ones while the driver processes the submission.
+        {
+            std::scoped_lock lock{submit_queue_mutex};
+            submit_queue.push(PendingSubmit{
+                .cmdbuf = cmdbuf,
+                .upload_cmdbuf = upload_cmdbuf,
+                .signal_semaphore = signal_semaphore,
+                .wait_semaphore = wait_semaphore,
+                .signal_value = signal_value,
+            });
         }
+        submit_cv.notify_all();
     });
     chunk->MarkSubmit();
     DispatchWork();
@@ -368,6 +598,7 @@ void Scheduler::AllocateNewContext() {
 
 void Scheduler::InvalidateState() {
     state.graphics_pipeline = nullptr;
+    state.compute_pipeline = nullptr;
     state.rescaling_defined = false;
     state_tracker.InvalidateCommandBufferState();
 }
@@ -380,7 +611,7 @@ void Scheduler::EndPendingOperations() {
 void Scheduler::EndRenderPass()
     {
         RealizeDeferredClear();
-        if (!state.renderpass) {
+        if (!state.renderpass && state.rendering_id == 0) {
             return;
         }
 
@@ -398,7 +629,8 @@ void Scheduler::EndRenderPass()
         Record([num_images = num_renderpass_images,
                        images = renderpass_images,
                        ranges = renderpass_image_ranges,
-                       has_transform_feedback = device.IsExtTransformFeedbackSupported()](
+                       has_transform_feedback = device.IsExtTransformFeedbackSupported(),
+                       is_dynamic_rendering = state.rendering_id != 0](
                           vk::CommandBuffer cmdbuf) {
             std::array<VkImageMemoryBarrier, 9> barriers;
             for (size_t i = 0; i < num_images; ++i) {
@@ -435,7 +667,11 @@ void Scheduler::EndRenderPass()
                         .subresourceRange = range,
                 };
             }
-            cmdbuf.EndRenderPass();
+            if (is_dynamic_rendering) {
+                cmdbuf.EndRendering();
+            } else {
+                cmdbuf.EndRenderPass();
+            }
             cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT |
                                    VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, vk::PIPELINE_STAGE_GRAPHICS_COMPUTE,
                                    0, nullptr, nullptr, vk::Span(barriers.data(), num_images));
@@ -453,6 +689,7 @@ void Scheduler::EndRenderPass()
         });
 
         state.renderpass = VkRenderPass{};
+        state.rendering_id = 0;
         num_renderpass_images = 0;
     }
 
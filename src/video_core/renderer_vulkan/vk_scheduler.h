@@ -6,9 +6,12 @@
 
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <cstddef>
+#include <deque>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <thread>
 #include <utility>
@@ -29,6 +32,7 @@ class QueryCacheBase;
 namespace Vulkan {
 
 class CommandPool;
+class ComputePipeline;
 class Device;
 class Framebuffer;
 class GraphicsPipeline;
@@ -53,12 +57,19 @@ public:
     /// safe to touch worker resources.
     void WaitWorker();
 
+    /// Waits for the command buffers finished by the worker thread to be submitted to the queue.
+    void WaitSubmissions();
+
     /// Sends currently recorded work to the worker thread.
     void DispatchWork();
 
     /// Requests to begin a renderpass.
     void RequestRenderpass(const Framebuffer* framebuffer);
 
+    /// Requests to begin rendering for draws with the pipelines of the pipeline cache. Uses dynamic
+    /// rendering when the framebuffer supports it, and a render pass otherwise.
+    void RequestRendering(const Framebuffer* framebuffer);
+
     /// Defers a full-attachment color clear so it becomes the next render pass.
     bool DeferColorClear(const Framebuffer* framebuffer, u32 rt_slot, const VkClearValue& value);
 
@@ -71,12 +82,25 @@ public:
 
     /// Returns true when a render pass is currently active in the scheduler state.
     bool IsRenderPassActive() const {
-        return state.renderpass != VK_NULL_HANDLE;
+        return state.renderpass != VK_NULL_HANDLE || state.rendering_id != 0;
+    }
+
+    /// Returns true when a dynamic rendering instance is currently active in the scheduler state.
+    bool IsDynamicRenderingActive() const {
+        return state.rendering_id != 0;
     }
 
     /// Update the pipeline to the current execution context.
     bool UpdateGraphicsPipeline(GraphicsPipeline* pipeline);
 
+    /// Update the compute pipeline. Returns true when it differs from the bound one.
+    bool UpdateComputePipeline(ComputePipeline* pipeline);
+
+    /// Forgets the bound compute pipeline, for commands that bind their own compute pipelines
+    void InvalidateComputePipeline() {
+        state.compute_pipeline = nullptr;
+    }
+
     /// Update the rescaling state. Returns true if the state has to be updated.
     bool UpdateRescaling(bool is_rescaling);
 
@@ -88,6 +112,12 @@ public:
         query_cache = &query_cache_;
     }
 
+    /// Returns the time the GPU spent executing the submissions completed since the last call.
+    /// It is only measured when dynamic resolution is enabled and the device has timestamps.
+    u64 GetAndResetGpuBusyTime() {
+        return gpu_busy_ns.exchange(0, std::memory_order_relaxed);
+    }
+
     // Registers a callback to perform on queue submission.
     void RegisterOnSubmit(std::function<void()>&& func) {
         on_submit = std::move(func);
@@ -250,13 +280,24 @@ private:
     struct State {
         VkRenderPass renderpass{};
         VkFramebuffer framebuffer{};
+        /// Id of the framebuffer of the active dynamic rendering instance, zero when there's none
+        u64 rendering_id{};
         VkExtent2D render_area = {0, 0};
         GraphicsPipeline* graphics_pipeline = nullptr;
+        ComputePipeline* compute_pipeline = nullptr;
         bool is_rescaling = false;
         bool rescaling_defined = false;
         bool needs_state_enable_refresh = false;
     };
 
+    struct PendingSubmit {
+        vk::CommandBuffer cmdbuf;
+        vk::CommandBuffer upload_cmdbuf;
+        VkSemaphore signal_semaphore;
+        VkSemaphore wait_semaphore;
+        u64 signal_value;
+    };
+
     struct DeferredClear {
         const Framebuffer* framebuffer = nullptr;
         u32 color_clear_mask = 0;
@@ -269,13 +310,27 @@ private:
     void BeginRenderPassImpl(const Framebuffer* framebuffer, VkRenderPass renderpass,
                              const VkClearValue* clear_values, u32 clear_value_count);
 
+    /// Begins dynamic rendering into the given framebuffer, clearing the attachments of a
+    /// deferred clear.
+    void BeginRenderingImpl(const Framebuffer* framebuffer, const DeferredClear* clear);
+
     /// If a deferred clear is pending.
     void RealizeDeferredClear();
 
     void WorkerThread(std::stop_token stop_token);
 
+    void SubmitThread(std::stop_token stop_token);
+
+    void SubmitPending(PendingSubmit& submit);
+
     void AllocateWorkerCommandBuffer();
 
+    /// Writes the timestamp closing the current command buffer, called on the worker thread.
+    void EndTimestampBatch(vk::CommandBuffer cmdbuf, u64 signal_value);
+
+    /// Emits the GPU time of the submissions that have finished executing.
+    void CollectTimestamps();
+
     u64 SubmitExecution(VkSemaphore signal_semaphore, VkSemaphore wait_semaphore);
 
     void AllocateNewContext();
@@ -291,12 +346,31 @@ private:
 
     std::unique_ptr<MasterSemaphore> master_semaphore;
     std::unique_ptr<CommandPool> command_pool;
+    /// Pool of the dedicated transfer queue, upload command buffers come from it when present
+    std::unique_ptr<CommandPool> upload_command_pool;
 
     VideoCommon::QueryCacheBase<QueryCacheParams>* query_cache = nullptr;
 
     vk::CommandBuffer current_cmdbuf;
     vk::CommandBuffer current_upload_cmdbuf;
 
+    /// Written at both ends of every submission while hot path tracing or GPU time measurement is
+    /// enabled
+    struct TimestampBatch {
+        u64 tick;
+        u32 query;
+        u64 submit_ns;
+    };
+    static constexpr u32 TIMESTAMP_BATCHES = 64;
+    static constexpr u32 NO_TIMESTAMP = ~0U;
+    vk::QueryPool timestamp_pool;
+    std::deque<TimestampBatch> timestamp_batches;
+    u32 timestamp_cursor = 0;
+    u32 current_timestamp_query = NO_TIMESTAMP;
+    s64 gpu_time_offset = (std::numeric_limits<s64>::min)();
+    bool measure_gpu_time = false;
+    std::atomic<u64> gpu_busy_ns{};
+
     DeferredClear deferred_clear;
 
     std::unique_ptr<CommandChunk> chunk;
@@ -314,6 +388,13 @@ private:
     std::mutex reserve_mutex;
     std::mutex queue_mutex;
     std::condition_variable_any event_cv;
+
+    std::queue<PendingSubmit> submit_queue;
+    std::mutex submit_queue_mutex;
+    std::condition_variable_any submit_cv;
+    bool is_submitting = false;
+    std::jthread submit_thread;
+
     std::jthread worker_thread;
 
     std::chrono::steady_clock::duration frame_interval{};
@@ -5,6 +5,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include <algorithm>
+#include <array>
 #include <utility>
 #include <vector>
 
@@ -39,9 +40,30 @@ constexpr VkDeviceSize MAX_STREAM_BUFFER_SIZE = 256_MiB;
 constexpr VkDeviceSize MAX_STREAM_BUFFER_SIZE = 128_MiB;
 #endif
 
+// With resizable BAR the whole VRAM is host visible, the stream buffer can then be large enough to
+// take texture streaming bursts without falling back to dedicated staging allocations.
+constexpr VkDeviceSize REBAR_STREAM_BUFFER_SIZE = 512_MiB;
+
+size_t GetRebarStreamBufferSize(const Device& device) {
+#ifdef __ANDROID__
+    // Memory is unified, every heap is device local and host visible
+    return 0;
+#else
+    VkDeviceSize heap_size{0};
+    ForEachDeviceLocalHostVisibleHeap(device, [&heap_size](size_t index, VkMemoryHeap& heap) {
+        heap_size = (std::max)(heap_size, heap.size);
+    });
+    // Small device local host visible heaps are the 256MiB BAR window without rebar
+    if (heap_size <= 256_MiB) {
+        return 0;
+    }
+    return (std::min)(REBAR_STREAM_BUFFER_SIZE, Common::AlignUp(heap_size / 8, MAX_ALIGNMENT));
+#endif
+}
+
 size_t GetStreamBufferSize(const Device& device) {
     if (!device.HasDebuggingToolAttached()) {
-        return MAX_STREAM_BUFFER_SIZE;
+        return (std::max)(MAX_STREAM_BUFFER_SIZE, GetRebarStreamBufferSize(device));
     }
 
     VkDeviceSize size{0};
@@ -68,8 +90,10 @@ size_t GetStreamBufferSize(const Device& device) {
 StagingBufferPool::StagingBufferPool(const Device& device_, MemoryAllocator& memory_allocator_,
                                      Scheduler& scheduler_)
     : device{device_}, memory_allocator{memory_allocator_}, scheduler{scheduler_},
-      stream_buffer_size{GetStreamBufferSize(device)}, region_size{stream_buffer_size /
-                                                                   StagingBufferPool::NUM_SYNCS} {
+      stream_buffer_size{GetStreamBufferSize(device)},
+      stream_memory_account{Common::MemoryAccounting::Tag::StagingBuffers, stream_buffer_size},
+      region_size{stream_buffer_size / StagingBufferPool::NUM_SYNCS},
+      max_stream_request{stream_buffer_size / 4} {
     VkBufferCreateInfo stream_ci = {
         .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
         .pNext = nullptr,
@@ -84,6 +108,13 @@ StagingBufferPool::StagingBufferPool(const Device& device_, MemoryAllocator& mem
     if (device.IsExtTransformFeedbackSupported()) {
         stream_ci.usage |= VK_BUFFER_USAGE_TRANSFORM_FEEDBACK_BUFFER_BIT_EXT;
     }
+    // Reordered buffer uploads read from the stream buffer on the transfer queue
+    const std::array queue_families{device.GetGraphicsFamily(), device.GetTransferFamily()};
+    if (device.HasAsyncTransferQueue()) {
+        stream_ci.sharingMode = VK_SHARING_MODE_CONCURRENT;
+        stream_ci.queueFamilyIndexCount = static_cast<u32>(queue_families.size());
+        stream_ci.pQueueFamilyIndices = queue_families.data();
+    }
     stream_buffer = memory_allocator.CreateBuffer(stream_ci, MemoryUsage::Stream);
     if (device.HasDebuggingToolAttached()) {
         stream_buffer.SetObjectNameEXT("Stream Buffer");
@@ -95,7 +126,7 @@ StagingBufferPool::StagingBufferPool(const Device& device_, MemoryAllocator& mem
 StagingBufferPool::~StagingBufferPool() = default;
 
 StagingBufferRef StagingBufferPool::Request(size_t size, MemoryUsage usage, bool deferred) {
-    if (!deferred && usage == MemoryUsage::Upload && size <= region_size) {
+    if (!deferred && usage == MemoryUsage::Upload && size <= max_stream_request) {
         return GetStreamBuffer(size);
     }
     return GetStagingBuffer(size, usage, deferred);
@@ -226,6 +257,8 @@ StagingBufferRef StagingBufferPool::CreateStagingBuffer(size_t size, MemoryUsage
         .index = unique_ids++,
         .tick = deferred ? (std::numeric_limits<u64>::max)() : scheduler.CurrentTick(),
         .deferred = deferred,
+        .memory_account = Common::MemoryAccounting::Account{
+            Common::MemoryAccounting::Tag::StagingBuffers, 1ULL << log2_size},
     });
     return entry.Ref();
 }
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2022 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
@@ -7,6 +10,7 @@
 #include <vector>
 
 #include "common/common_types.h"
+#include "common/memory_accounting.h"
 
 #include "video_core/vulkan_common/vulkan_memory_allocator.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
@@ -27,7 +31,7 @@ struct StagingBufferRef {
 
 class StagingBufferPool {
 public:
-    static constexpr size_t NUM_SYNCS = 16;
+    static constexpr size_t NUM_SYNCS = 64;
 
     explicit StagingBufferPool(const Device& device, MemoryAllocator& memory_allocator,
                                Scheduler& scheduler);
@@ -56,6 +60,7 @@ private:
         u64 index;
         u64 tick = 0;
         bool deferred{};
+        Common::MemoryAccounting::Account memory_account;
 
         StagingBufferRef Ref() const noexcept {
             return {
@@ -105,7 +110,10 @@ private:
     vk::Buffer stream_buffer;
     std::span<u8> stream_pointer;
     VkDeviceSize stream_buffer_size;
+    Common::MemoryAccounting::Account stream_memory_account;
     VkDeviceSize region_size;
+    /// Uploads up to this size are sub-allocated from the stream buffer
+    VkDeviceSize max_stream_request;
 
     size_t iterator = 0;
     size_t used_iterator = 0;
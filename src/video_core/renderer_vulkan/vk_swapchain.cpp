@@ -138,6 +138,7 @@ void Swapchain::Create(
     is_suboptimal = false;
     width = width_;
     height = height_;
+    const bool same_surface = surface == surface_;
     surface = surface_;
 
     const auto physical_device = device.GetPhysical();
@@ -146,10 +147,18 @@ void Swapchain::Create(
         return;
     }
 
-    Destroy();
+    // The old swapchain is handed over to the new one, so images the presentation engine still
+    // holds from it are shown while it is retired instead of waiting for them
+    if (same_surface && swapchain) {
+        Retire();
+    } else {
+        ReleaseRetired(true);
+        Destroy();
+    }
 
     CreateSwapchain(capabilities);
     CreateSemaphores();
+    present_id = 0;
 
     resource_ticks.clear();
     resource_ticks.resize(image_count);
@@ -213,9 +222,17 @@ bool Swapchain::AcquireNextImage() {
 
 void Swapchain::Present(VkSemaphore render_semaphore) {
     const auto present_queue{device.GetPresentQueue()};
+    const bool use_present_id = device.IsKhrPresentWaitSupported();
+    const u64 next_present_id = present_id + 1;
+    const VkPresentIdKHR present_id_info{
+        .sType = VK_STRUCTURE_TYPE_PRESENT_ID_KHR,
+        .pNext = nullptr,
+        .swapchainCount = 1,
+        .pPresentIds = &next_present_id,
+    };
     const VkPresentInfoKHR present_info{
         .sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR,
-        .pNext = nullptr,
+        .pNext = use_present_id ? &present_id_info : nullptr,
         .waitSemaphoreCount = render_semaphore ? 1U : 0U,
         .pWaitSemaphores = &render_semaphore,
         .swapchainCount = 1,
@@ -224,11 +241,14 @@ void Swapchain::Present(VkSemaphore render_semaphore) {
         .pResults = nullptr,
     };
     std::scoped_lock lock{scheduler.submit_mutex};
+    ReleaseRetired(false);
     switch (const VkResult result = present_queue.Present(present_info)) {
     case VK_SUCCESS:
+        present_id = next_present_id;
         break;
     case VK_SUBOPTIMAL_KHR:
         LOG_DEBUG(Render_Vulkan, "Suboptimal swapchain");
+        present_id = next_present_id;
         break;
     case VK_ERROR_OUT_OF_DATE_KHR:
         is_outdated = true;
@@ -246,6 +266,35 @@ void Swapchain::Present(VkSemaphore render_semaphore) {
     }
 }
 
+void Swapchain::WaitForPresent(u64 frames_in_flight) {
+    if (!device.IsKhrPresentWaitSupported() || frames_in_flight == 0 ||
+        present_id < frames_in_flight) {
+        return;
+    }
+    // Compositors may never display the images of hidden windows, so don't wait forever
+    static constexpr u64 PresentWaitTimeoutNs = 100'000'000;
+
+    // Once this image is displayed, only the ones presented after it are left in flight
+    const u64 wait_present_id = present_id - frames_in_flight + 1;
+    switch (const VkResult result = device.GetLogical().WaitForPresentKHR(
+                *swapchain, wait_present_id, PresentWaitTimeoutNs)) {
+    case VK_SUCCESS:
+    case VK_TIMEOUT:
+    case VK_SUBOPTIMAL_KHR:
+        break;
+    case VK_ERROR_OUT_OF_DATE_KHR:
+        is_outdated = true;
+        break;
+    case VK_ERROR_SURFACE_LOST_KHR:
+        vk::Check(result);
+        break;
+    default:
+        LOG_ERROR(Render_Vulkan, "Failed to wait for present with error {}",
+                  string_VkResult(result));
+        break;
+    }
+}
+
 void Swapchain::CreateSwapchain(const VkSurfaceCapabilitiesKHR& capabilities) {
     const auto physical_device{device.GetPhysical()};
     const auto formats{physical_device.GetSurfaceFormatsKHR(VkSurfaceKHR(surface))};
@@ -297,7 +346,7 @@ void Swapchain::CreateSwapchain(const VkSurfaceCapabilitiesKHR& capabilities) {
         .compositeAlpha = alpha_flags,
         .presentMode = present_mode,
         .clipped = VK_FALSE,
-        .oldSwapchain = VkSwapchainKHR{},
+        .oldSwapchain = retired.empty() ? VkSwapchainKHR{} : *retired.back().swapchain,
     };
     const u32 graphics_family{device.GetGraphicsFamily()};
     const u32 present_family{device.GetPresentFamily()};
@@ -355,6 +404,36 @@ void Swapchain::CreateSemaphores() {
                           [this] { return device.GetLogical().CreateSemaphore(); });
 }
 
+void Swapchain::Retire() {
+    // Wait for the images of the old swapchain to cycle through the presentation engine twice,
+    // by then the presents and the copies into them have completed
+    retired.push_back({
+        .swapchain = std::move(swapchain),
+        .present_semaphores = std::move(present_semaphores),
+        .render_semaphores = std::move(render_semaphores),
+        .tick = scheduler.CurrentTick(),
+        .presents_left = image_count * 2,
+    });
+    frame_index = 0;
+    present_semaphores.clear();
+    render_semaphores.clear();
+}
+
+void Swapchain::ReleaseRetired(bool force) {
+    if (force) {
+        retired.clear();
+        return;
+    }
+    for (RetiredSwapchain& old : retired) {
+        if (old.presents_left > 0) {
+            --old.presents_left;
+        }
+    }
+    std::erase_if(retired, [this](const RetiredSwapchain& old) {
+        return old.presents_left == 0 && scheduler.IsFree(old.tick);
+    });
+}
+
 void Swapchain::Destroy() {
     frame_index = 0;
     present_semaphores.clear();
@@ -42,6 +42,10 @@ public:
     /// Presents the rendered image to the swapchain.
     void Present(VkSemaphore render_semaphore);
 
+    /// Waits until at most the given number of presented images are waiting to be displayed.
+    /// Does nothing when the device can't wait for presentation.
+    void WaitForPresent(u64 frames_in_flight);
+
     /// Returns true when the swapchain needs to be recreated.
     bool NeedsRecreation() const {
         return IsSubOptimal() || NeedsPresentModeUpdate();
@@ -114,6 +118,12 @@ private:
     void CreateSemaphores();
     void CreateImageViews();
 
+    /// Keeps the current swapchain alive until the presentation engine is done with it
+    void Retire();
+
+    /// Destroys the retired swapchains that are no longer in use, or all of them when forced
+    void ReleaseRetired(bool force);
+
     void Destroy();
 
     bool NeedsPresentModeUpdate() const;
@@ -125,6 +135,15 @@ private:
 
     vk::SwapchainKHR swapchain;
 
+    struct RetiredSwapchain {
+        vk::SwapchainKHR swapchain;
+        std::vector<vk::Semaphore> present_semaphores;
+        std::vector<vk::Semaphore> render_semaphores;
+        u64 tick;                  ///< Last scheduler tick that could use its images
+        std::size_t presents_left; ///< Presents on newer swapchains before it can be destroyed
+    };
+    std::vector<RetiredSwapchain> retired;
+
     std::size_t image_count{};
     std::vector<VkImage> images;
     std::vector<u64> resource_ticks;
@@ -136,6 +155,7 @@ private:
 
     u32 image_index{};
     u32 frame_index{};
+    u64 present_id{}; ///< Identifier of the last present, when present waits are supported
 
     VkFormat image_view_format{};
     VkExtent2D extent{};
@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <optional>
 #include <span>
 #include <memory>
@@ -48,6 +49,7 @@ using VideoCommon::SubresourceRange;
 using VideoCore::Surface::BytesPerBlock;
 using VideoCore::Surface::HasAlpha;
 using VideoCore::Surface::IsPixelFormatASTC;
+using VideoCore::Surface::IsPixelFormatBCn;
 using VideoCore::Surface::IsPixelFormatInteger;
 using VideoCore::Surface::SurfaceType;
 
@@ -144,6 +146,18 @@ constexpr VkBorderColor ConvertBorderColor(const std::array<float, 4>& color) {
           info.size.depth == 1;
 }
 
+[[nodiscard]] bool WillUseAcceleratedBcnDecode(const Device& device, const ImageInfo& info) {
+    if (!IsPixelFormatBCn(info.format) || device.IsOptimalBcnSupported()) {
+        return false;
+    }
+    if (!Settings::values.accelerate_bcn.GetValue() || !BCnDecoderPass::IsSupported(info.format)) {
+        return false;
+    }
+    // 3D images go through the block linear 3D unswizzle instead
+    return info.type != ImageType::e3D &&
+           MaxwellToVK::SurfaceFormat(device, FormatType::Optimal, false, info.format).storage;
+}
+
 [[nodiscard]] bool WillUseWidenedAstcFormat(const Device& device, const ImageInfo& info) {
     return WillUseAcceleratedAstcDecode(device, info) &&
            !VideoCore::Surface::IsPixelFormatSRGB(info.format);
@@ -912,6 +926,10 @@ TextureCacheRuntime::TextureCacheRuntime(const Device& device_, Scheduler& sched
         astc_decoder_pass.emplace(device, scheduler, descriptor_pool, staging_buffer_pool,
                                   compute_pass_descriptor_queue, memory_allocator);
     }
+    if (Settings::values.accelerate_bcn.GetValue() && !device.IsOptimalBcnSupported()) {
+        bcn_decoder_pass.emplace(device, scheduler, descriptor_pool,
+                                 compute_pass_descriptor_queue);
+    }
     if (!device.IsKhrImageFormatListSupported()) {
         return;
     }
@@ -1065,7 +1083,27 @@ void TextureCacheRuntime::EraseResolveShadow(VkImage msaa_image) {
 }
 
 void TextureCacheRuntime::BarrierFeedbackLoop() {
-    scheduler.RequestOutsideRenderPassOperationContext();
+    if (!scheduler.IsDynamicRenderingActive() ||
+        !device.IsKhrDynamicRenderingLocalReadSupported()) {
+        scheduler.RequestOutsideRenderPassOperationContext();
+        return;
+    }
+    // Local read allows a framebuffer local barrier inside the rendering, so the draw that samples
+    // its own attachments doesn't have to split it
+    scheduler.Record([](vk::CommandBuffer cmdbuf) {
+        static constexpr VkMemoryBarrier FEEDBACK_LOOP_BARRIER{
+            .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+            .pNext = nullptr,
+            .srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT |
+                             VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT,
+            .dstAccessMask = VK_ACCESS_SHADER_READ_BIT,
+        };
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT |
+                                   VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT |
+                                   VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT,
+                               VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_DEPENDENCY_BY_REGION_BIT,
+                               FEEDBACK_LOOP_BARRIER);
+    });
 }
 
 void TextureCacheRuntime::ReinterpretImage(Image& dst, Image& src,
@@ -1761,6 +1799,10 @@ u64 TextureCacheRuntime::GetDeviceMemoryUsage() const {
     return device.GetDeviceMemoryUsage();
 }
 
+u64 TextureCacheRuntime::GetDeviceMemoryBudget() const {
+    return device.GetDeviceMemoryBudget();
+}
+
 bool TextureCacheRuntime::CanReportMemoryUsage() const {
     return device.CanReportMemoryUsage();
 }
@@ -1775,6 +1817,25 @@ void TextureCacheRuntime::TickFrame() {
     });
 }
 
+void TextureCacheRuntime::DestroyInBackground(std::vector<Image>&& images) {
+    // Shadows are keyed by handle, erase them before the handle can be reused by the driver
+    for (Image& image : images) {
+        image.DetachFromRuntime();
+    }
+    // The objects are destroyed along with the task once the worker is done with it
+    destruction_worker.QueueWork([images = std::move(images)] {}, Common::WorkPriority::Low);
+}
+
+void TextureCacheRuntime::DestroyInBackground(std::vector<ImageView>&& image_views) {
+    destruction_worker.QueueWork([image_views = std::move(image_views)] {},
+                                 Common::WorkPriority::Low);
+}
+
+void TextureCacheRuntime::DestroyInBackground(std::vector<Framebuffer>&& framebuffers) {
+    destruction_worker.QueueWork([framebuffers = std::move(framebuffers)] {},
+                                 Common::WorkPriority::Low);
+}
+
 Image::Image(TextureCacheRuntime& runtime_, const ImageInfo& info_, GPUVAddr gpu_addr_,
              VAddr cpu_addr_)
     : VideoCommon::ImageBase(info_, gpu_addr_, cpu_addr_), scheduler{&runtime_.scheduler},
@@ -1804,6 +1865,13 @@ Image::Image(TextureCacheRuntime& runtime_, const ImageInfo& info_, GPUVAddr gpu
         flags |= VideoCommon::ImageFlagBits::CostlyLoad;
     }
     if (IsPixelFormatBCn(info.format) && !runtime->device.IsOptimalBcnSupported()) {
+        if (runtime->bcn_decoder_pass && WillUseAcceleratedBcnDecode(runtime->device, info)) {
+            flags |= VideoCommon::ImageFlagBits::AcceleratedUpload;
+        } else if (Settings::values.accelerate_astc.GetValue() ==
+                   Settings::AstcDecodeMode::CpuAsynchronous) {
+            // Asynchronous CPU decoding applies to every compressed format we have to convert
+            flags |= VideoCommon::ImageFlagBits::AsynchronousDecode;
+        }
         flags |= VideoCommon::ImageFlagBits::Converted;
         flags |= VideoCommon::ImageFlagBits::CostlyLoad;
     }
@@ -1829,6 +1897,10 @@ Image::Image(TextureCacheRuntime& runtime_, const ImageInfo& info_, GPUVAddr gpu
 Image::Image(const VideoCommon::NullImageParams& params) : VideoCommon::ImageBase{params} {}
 
 Image::~Image() {
+    DetachFromRuntime();
+}
+
+void Image::DetachFromRuntime() {
     if (ENABLE_MSAA_RESOLVE_CONSUME && runtime != nullptr) {
         if (original_image) {
             runtime->EraseResolveShadow(*original_image);
@@ -1837,6 +1909,7 @@ Image::~Image() {
             runtime->EraseResolveShadow(*scaled_image);
         }
     }
+    runtime = nullptr;
 }
 
 void Image::AllocateComputeUnswizzleBuffer(u32 max_slices) {
@@ -2207,6 +2280,11 @@ VkImageView Image::StorageImageView(s32 level) noexcept {
             format_info.format = WillUseWidenedAstcFormat(runtime->device, info)
                                      ? VK_FORMAT_R32G32B32A32_SFLOAT
                                      : VK_FORMAT_A8B8G8R8_UNORM_PACK32;
+        } else if (True(flags & ImageFlagBits::AcceleratedUpload) &&
+                   IsPixelFormatBCn(info.format)) {
+            // sRGB formats can't be storage images, decode through the linear format
+            format_info =
+                MaxwellToVK::SurfaceFormat(runtime->device, FormatType::Optimal, false, info.format);
         }
         view = MakeStorageView(runtime->device.GetLogical(), level, *(this->*current_image),
                                format_info.format);
@@ -2280,6 +2358,20 @@ bool Image::ScaleDown(bool ignore) {
     return true;
 }
 
+void Image::ReleaseScaled() {
+    ASSERT(False(flags & ImageFlagBits::Rescaled));
+    if (ENABLE_MSAA_RESOLVE_CONSUME && scaled_image) {
+        runtime->EraseResolveShadow(*scaled_image);
+    }
+    // The helper framebuffers are sized for both the original and the scaled image
+    scale_framebuffer.reset();
+    normal_framebuffer.reset();
+    scale_view.reset();
+    normal_view.reset();
+    scaled_image = vk::Image{};
+    has_scaled = false;
+}
+
 bool Image::BlitScaleHelper(bool scale_up) {
     using namespace VideoCommon;
     static constexpr auto BLIT_OPERATION = Tegra::Engines::Fermi2D::Operation::SrcCopy;
@@ -2683,7 +2775,7 @@ Framebuffer::Framebuffer(TextureCacheRuntime& runtime, std::span<ImageView*, NUM
           .height = key.size.height,
       }} {
     CreateFramebuffer(runtime, color_buffers, depth_buffer, key.is_rescaled);
-    if (runtime.device.HasDebuggingToolAttached()) {
+    if (runtime.device.HasDebuggingToolAttached() && framebuffer) {
         framebuffer.SetObjectNameEXT(VideoCommon::Name(key).c_str());
     }
 }
@@ -2702,8 +2794,11 @@ void Framebuffer::CreateFramebuffer(TextureCacheRuntime& runtime,
                                     ImageView* depth_buffer, bool is_rescaled_) {
     boost::container::small_vector<VkImageView, NUM_RT + 1> attachments;
     RenderPassKey renderpass_key{};
-    s32 num_layers = 1;
+    s32 max_layers = 1;
 
+    static std::atomic<u64> next_id{1};
+    id = next_id.fetch_add(1, std::memory_order_relaxed);
+    device = &runtime.device;
     is_rescaled = is_rescaled_;
     const auto& resolution = runtime.resolution;
 
@@ -2720,8 +2815,10 @@ void Framebuffer::CreateFramebuffer(TextureCacheRuntime& runtime,
         height = (std::min)(height, is_rescaled ? resolution.ScaleUp(color_buffer->size.height)
                                               : color_buffer->size.height);
         attachments.push_back(color_buffer->RenderTarget());
+        color_views[index] = color_buffer->RenderTarget();
+        num_color_attachments = static_cast<u32>(index + 1);
         renderpass_key.color_formats[index] = color_buffer->format;
-        num_layers = (std::max)(num_layers, color_buffer->range.extent.layers);
+        max_layers = (std::max)(max_layers, color_buffer->range.extent.layers);
         images[num_images] = color_buffer->ImageHandle();
         image_ranges[num_images] = MakeSubresourceRange(color_buffer);
         rt_map[index] = num_images;
@@ -2735,8 +2832,9 @@ void Framebuffer::CreateFramebuffer(TextureCacheRuntime& runtime,
         height = (std::min)(height, is_rescaled ? resolution.ScaleUp(depth_buffer->size.height)
                                               : depth_buffer->size.height);
         attachments.push_back(depth_buffer->RenderTarget());
+        depth_stencil_view = depth_buffer->RenderTarget();
         renderpass_key.depth_format = depth_buffer->format;
-        num_layers = (std::max)(num_layers, depth_buffer->range.extent.layers);
+        max_layers = (std::max)(max_layers, depth_buffer->range.extent.layers);
         images[num_images] = depth_buffer->ImageHandle();
         const VkImageSubresourceRange subresource_range = MakeSubresourceRange(depth_buffer);
         image_ranges[num_images] = subresource_range;
@@ -2755,14 +2853,23 @@ void Framebuffer::CreateFramebuffer(TextureCacheRuntime& runtime,
     discard_msaa_color =
         ENABLE_MSAA_RESOLVE_CONSUME && ENABLE_MSAA_COLOR_DISCARD && do_resolve_color;
 
-    renderpass = runtime.render_pass_cache.Get(renderpass_key);
+    // Resolving MSAA color needs the resolve attachments of a render pass
+    uses_dynamic_rendering = runtime.device.IsKhrDynamicRenderingEnabled() && !do_resolve_color;
+    num_layers = static_cast<u32>((std::max)(max_layers, 1));
+
     render_pass_key = renderpass_key;
     render_pass_cache = &runtime.render_pass_cache;
     render_area.width = (std::min)(render_area.width, width);
     render_area.height = (std::min)(render_area.height, height);
+    num_color_buffers = static_cast<u32>(num_colors);
+    if (uses_dynamic_rendering) {
+        // Only the blit helpers draw into these with a render pass, they create it on demand
+        return;
+    }
+    renderpass = runtime.render_pass_cache.Get(renderpass_key);
 
     if (do_resolve_color) {
-        const u32 layers = static_cast<u32>((std::max)(num_layers, 1));
+        const u32 layers = num_layers;
         for (size_t index = 0; index < NUM_RT; ++index) {
             const PixelFormat format = renderpass_key.color_formats[index];
             if (format == PixelFormat::Invalid) {
@@ -2818,7 +2925,6 @@ void Framebuffer::CreateFramebuffer(TextureCacheRuntime& runtime,
         }
     }
 
-    num_color_buffers = static_cast<u32>(num_colors);
     framebuffer = runtime.device.GetLogical().CreateFramebuffer({
         .sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO,
         .pNext = nullptr,
@@ -2828,7 +2934,34 @@ void Framebuffer::CreateFramebuffer(TextureCacheRuntime& runtime,
         .pAttachments = attachments.data(),
         .width = render_area.width,
         .height = render_area.height,
-        .layers = static_cast<u32>((std::max)(num_layers, 1)),
+        .layers = num_layers,
+    });
+}
+
+void Framebuffer::CreateRenderPassHandles() const {
+    if (framebuffer) {
+        return;
+    }
+    boost::container::small_vector<VkImageView, NUM_RT + 1> attachments;
+    for (const VkImageView view : color_views) {
+        if (view != VK_NULL_HANDLE) {
+            attachments.push_back(view);
+        }
+    }
+    if (depth_stencil_view != VK_NULL_HANDLE) {
+        attachments.push_back(depth_stencil_view);
+    }
+    renderpass = render_pass_cache->Get(render_pass_key);
+    framebuffer = device->GetLogical().CreateFramebuffer({
+        .sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+        .renderPass = renderpass,
+        .attachmentCount = static_cast<u32>(attachments.size()),
+        .pAttachments = attachments.data(),
+        .width = render_area.width,
+        .height = render_area.height,
+        .layers = num_layers,
     });
 }
 
@@ -2853,6 +2986,10 @@ void TextureCacheRuntime::AccelerateImageUpload(
         return astc_decoder_pass->Assemble(image, map, swizzles);
     }
 
+    if (IsPixelFormatBCn(image.info.format) && image.info.type != ImageType::e3D) {
+        return bcn_decoder_pass->Assemble(image, map, swizzles);
+    }
+
     if (!Settings::values.gpu_unswizzle_enabled.GetValue() || !bl3d_unswizzle_pass) {
         if (IsPixelFormatBCn(image.info.format) && image.info.type == ImageType::e3D) {
             ASSERT(false && "GPU unswizzle is disabled for BCn 3D texture");
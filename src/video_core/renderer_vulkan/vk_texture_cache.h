@@ -60,10 +60,18 @@ public:
 
     void TickFrame();
 
+    /// Destroys objects retired by the texture cache on a low priority thread, some drivers take
+    /// milliseconds to free images and views.
+    void DestroyInBackground(std::vector<Image>&& images);
+    void DestroyInBackground(std::vector<ImageView>&& image_views);
+    void DestroyInBackground(std::vector<Framebuffer>&& framebuffers);
+
     u64 GetDeviceLocalMemory() const;
 
     u64 GetDeviceMemoryUsage() const;
 
+    u64 GetDeviceMemoryBudget() const;
+
     bool CanReportMemoryUsage() const;
 
     std::optional<size_t> GetSamplerHeapBudget() const;
@@ -147,6 +155,7 @@ public:
     BlitImageHelper& blit_image_helper;
     RenderPassCache& render_pass_cache;
     std::optional<ASTCDecoderPass> astc_decoder_pass;
+    std::optional<BCnDecoderPass> bcn_decoder_pass;
 
     std::optional<BlockLinearUnswizzle3DPass> bl3d_unswizzle_pass;
     const Settings::ResolutionScalingInfo& resolution;
@@ -156,6 +165,8 @@ public:
     std::array<vk::Buffer, indexing_slots> buffers{};
     std::vector<std::pair<u64, vk::Image>> pending_msaa_images;
     ankerl::unordered_dense::map<VkImage, ResolveShadow> resolve_shadows;
+
+    Common::ThreadWorker destruction_worker{1, "VulkanDestroyer"};
 };
 
 class Framebuffer {
@@ -178,14 +189,45 @@ public:
                            std::span<ImageView*, NUM_RT> color_buffers, ImageView* depth_buffer,
                            bool is_rescaled = false);
 
-    [[nodiscard]] VkFramebuffer Handle() const noexcept {
+    /// Framebuffers drawn with dynamic rendering create their handle on first use
+    [[nodiscard]] VkFramebuffer Handle() const {
+        CreateRenderPassHandles();
         return *framebuffer;
     }
 
-    [[nodiscard]] VkRenderPass RenderPass() const noexcept {
+    [[nodiscard]] VkRenderPass RenderPass() const {
+        CreateRenderPassHandles();
         return renderpass;
     }
 
+    /// Returns true when draws into the framebuffer are recorded with dynamic rendering
+    [[nodiscard]] bool UsesDynamicRendering() const noexcept {
+        return uses_dynamic_rendering;
+    }
+
+    /// Identifies the attachments of the framebuffer, unique among all framebuffers
+    [[nodiscard]] u64 Id() const noexcept {
+        return id;
+    }
+
+    /// Number of color attachments, including the unused slots before the last used one
+    [[nodiscard]] u32 NumColorAttachments() const noexcept {
+        return num_color_attachments;
+    }
+
+    /// Color attachment views by render target slot, null for unused slots
+    [[nodiscard]] const std::array<VkImageView, NUM_RT>& ColorViews() const noexcept {
+        return color_views;
+    }
+
+    [[nodiscard]] VkImageView DepthStencilView() const noexcept {
+        return depth_stencil_view;
+    }
+
+    [[nodiscard]] u32 NumLayers() const noexcept {
+        return num_layers;
+    }
+
     [[nodiscard]] const RenderPassKey& RenderPassKeyBase() const noexcept {
         return render_pass_key;
     }
@@ -246,8 +288,17 @@ public:
     }
 
 private:
-    vk::Framebuffer framebuffer;
-    VkRenderPass renderpass{};
+    void CreateRenderPassHandles() const;
+
+    const Device* device{};
+    mutable vk::Framebuffer framebuffer;
+    mutable VkRenderPass renderpass{};
+    u64 id{};
+    bool uses_dynamic_rendering{};
+    u32 num_color_attachments{};
+    u32 num_layers{1};
+    std::array<VkImageView, NUM_RT> color_views{};
+    VkImageView depth_stencil_view{};
     VkExtent2D render_area{};
     VkSampleCountFlagBits samples = VK_SAMPLE_COUNT_1_BIT;
     u32 num_color_buffers = 0;
@@ -273,6 +324,9 @@ public:
 
     ~Image();
 
+    /// Drops the state the runtime keeps for this image so it can be destroyed on another thread
+    void DetachFromRuntime();
+
     Image(const Image&) = delete;
     Image& operator=(const Image&) = delete;
 
@@ -321,6 +375,10 @@ public:
 
     bool ScaleDown(bool ignore = false);
 
+    /// Free the scaled copy of an image that is not rescaled, so it is created again on the next
+    /// scale up with the resolution at that time
+    void ReleaseScaled();
+
     u64 allocation_tick;
 
     friend class BlockLinearUnswizzle3DPass;
@@ -487,6 +545,7 @@ struct TextureCacheParams {
     static constexpr bool HAS_EMULATED_COPIES = false;
     static constexpr bool HAS_DEVICE_MEMORY_INFO = true;
     static constexpr bool IMPLEMENTS_ASYNC_DOWNLOADS = true;
+    static constexpr bool HAS_BACKGROUND_DESTRUCTION = true;
 
     using Runtime = Vulkan::TextureCacheRuntime;
     using Image = Vulkan::Image;
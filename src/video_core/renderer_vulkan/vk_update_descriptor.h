@@ -44,6 +44,10 @@ public:
         return upload_start;
     }
 
+    size_t UpdateSize() const noexcept {
+        return static_cast<size_t>(payload_cursor - upload_start);
+    }
+
     void AddSampledImage(VkImageView image_view, VkSampler sampler) {
         *(payload_cursor++) = VkDescriptorImageInfo{
             .sampler = sampler,
@@ -83,6 +83,24 @@ bool ShaderCache::RefreshStages(std::array<u64, 6>& unique_hashes) {
     return true;
 }
 
+void ShaderCache::PrefetchProgram(size_t index) {
+    if (!maxwell3d || !gpu_memory || index >= NUM_PROGRAMS ||
+        !maxwell3d->regs.IsShaderConfigEnabled(index)) {
+        return;
+    }
+    const GPUVAddr base_addr{maxwell3d->regs.program_region.Address()};
+    const u32 start_address{maxwell3d->regs.pipelines[index].offset};
+    const std::optional<VAddr> cpu_shader_addr{
+        gpu_memory->GpuToCpuAddress(base_addr + start_address)};
+    // Invalid addresses are reported by RefreshStages if the program is still bound at draw time
+    if (!cpu_shader_addr || TryGet(*cpu_shader_addr)) {
+        return;
+    }
+    const auto program{static_cast<Tegra::Engines::Maxwell3D::Regs::ShaderType>(index)};
+    GraphicsEnvironment env{*maxwell3d, *gpu_memory, program, base_addr, start_address};
+    MakeShaderInfo(env, *cpu_shader_addr);
+}
+
 const ShaderInfo* ShaderCache::ComputeShader() {
     const GPUVAddr program_base{kepler_compute->regs.code_loc.Address()};
     const auto& qmd{kepler_compute->launch_description};
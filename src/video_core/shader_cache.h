@@ -71,6 +71,11 @@ public:
     /// @brief Flushes delayed removal operations
     void SyncGuestHost();
 
+    /// @brief Looks up or hashes the code of a graphics program as soon as it is bound
+    /// @note The draw using it then finds the shader in the lookup cache
+    /// @param index Index of the program in the Maxwell3D pipelines
+    void PrefetchProgram(size_t index);
+
 protected:
     struct GraphicsEnvironments {
         std::array<GraphicsEnvironment, NUM_PROGRAMS> envs;
@@ -5,20 +5,24 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <sstream>
 #include <utility>
 
 #include "common/assert.h"
-#include "common/cityhash.h"
 #include "common/common_types.h"
 #include "common/div_ceil.h"
 #include "common/fs/fs.h"
 #include "common/fs/path_util.h"
+#include "common/hash.h"
 #include "common/logging.h"
 #include "common/settings.h"
+#include "common/zstd_compression.h"
 #include <ranges>
 #include "shader_recompiler/environment.h"
 #include "video_core/engines/kepler_compute.h"
@@ -33,6 +37,90 @@ constexpr std::array<char, 8> MAGIC_NUMBER{'y', 'u', 'z', 'u', 'c', 'a', 'c', 'h
 
 constexpr size_t INST_SIZE = sizeof(u64);
 
+/// Every record of a pipeline cache file is compressed on its own. Code blobs and environment
+/// data are shared by all the pipelines that use them and are always written before the first
+/// pipeline using them. Both start with the hash they are referenced by.
+enum class CacheRecordType : u32 {
+    CodeBlob,
+    Pipeline,
+    EnvironmentData,
+};
+
+struct CacheRecordHeader {
+    CacheRecordType type;
+    u32 uncompressed_size;
+    u32 compressed_size;
+};
+
+/// Hashes of the shared records already present in a cache file
+struct WrittenSharedRecords {
+    ankerl::unordered_dense::set<u64> code;
+    ankerl::unordered_dense::set<u64> environment_data;
+};
+
+/// Shared records already present in each cache file, so they are only written once.
+struct WrittenCodeBlobs {
+    std::mutex mutex;
+    ankerl::unordered_dense::map<std::string, WrittenSharedRecords> files;
+};
+
+static WrittenCodeBlobs& GetWrittenCodeBlobs() {
+    static WrittenCodeBlobs written_code_blobs;
+    return written_code_blobs;
+}
+
+static void ForgetCodeBlobs(const std::filesystem::path& filename) {
+    auto& written = GetWrittenCodeBlobs();
+    std::scoped_lock lock{written.mutex};
+    written.files.erase(Common::FS::PathToUTF8String(filename));
+}
+
+template <typename Map>
+static void WriteSortedTable(std::ostream& file, const Map& map) {
+    std::vector<std::pair<typename Map::key_type, typename Map::mapped_type>> entries(map.begin(),
+                                                                                     map.end());
+    std::ranges::sort(entries, {}, [](const auto& entry) { return entry.first; });
+    const u64 num_entries{static_cast<u64>(entries.size())};
+    file.write(reinterpret_cast<const char*>(&num_entries), sizeof(num_entries));
+    for (const auto& [key, value] : entries) {
+        file.write(reinterpret_cast<const char*>(&key), sizeof(key))
+            .write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+}
+
+template <typename Key, typename Value>
+static void ReadSortedTable(std::istream& file, std::vector<std::pair<Key, Value>>& table) {
+    u64 num_entries{};
+    file.read(reinterpret_cast<char*>(&num_entries), sizeof(num_entries));
+    table.resize(num_entries);
+    for (auto& [key, value] : table) {
+        file.read(reinterpret_cast<char*>(&key), sizeof(key))
+            .read(reinterpret_cast<char*>(&value), sizeof(value));
+    }
+    if (!std::ranges::is_sorted(table, {}, [](const auto& entry) { return entry.first; })) {
+        throw std::ios_base::failure("Unsorted environment data in pipeline cache");
+    }
+}
+
+template <typename Key, typename Value>
+static const Value* FindInSortedTable(const std::vector<std::pair<Key, Value>>& table, Key key) {
+    const auto it = std::ranges::lower_bound(table, key, {},
+                                             [](const auto& entry) { return entry.first; });
+    return it != table.end() && it->first == key ? &it->second : nullptr;
+}
+
+static void WriteCacheRecord(std::ofstream& file, CacheRecordType type, const std::string& payload) {
+    const std::vector<u8> compressed = Common::Compression::CompressDataZSTDDefault(
+        reinterpret_cast<const u8*>(payload.data()), payload.size());
+    const CacheRecordHeader header{
+        .type = type,
+        .uncompressed_size = static_cast<u32>(payload.size()),
+        .compressed_size = static_cast<u32>(compressed.size()),
+    };
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header))
+        .write(reinterpret_cast<const char*>(compressed.data()), compressed.size());
+}
+
 using Maxwell = Tegra::Engines::Maxwell3D::Regs;
 
 static u64 MakeCbufKey(u32 index, u32 offset) {
@@ -160,7 +248,7 @@ std::optional<u64> GenericEnvironment::Analyze() {
     }
     cached_lowest = start_address;
     cached_highest = start_address + static_cast<u32>(*size);
-    return Common::CityHash64(reinterpret_cast<const char*>(code.data()), *size);
+    return Common::Hash::StableHash64(std::span(reinterpret_cast<const u8*>(code.data()), *size));
 }
 
 void GenericEnvironment::SetCachedSize(size_t size_bytes) {
@@ -188,29 +276,40 @@ bool GenericEnvironment::CanBeSerialized() const noexcept {
 
 u64 GenericEnvironment::CalculateHash() const {
     const size_t size{ReadSizeBytes()};
-    const auto data{std::make_unique<char[]>(size)};
+    const auto data{std::make_unique<u8[]>(size)};
     gpu_memory->ReadBlock(program_base + read_lowest, data.get(), size);
-    return Common::CityHash64(data.get(), size);
+    return Common::Hash::StableHash64(std::span(data.get(), size));
 }
 
 void GenericEnvironment::Dump(u64 pipeline_hash, u64 shader_hash) {
     DumpImpl(pipeline_hash, shader_hash, code, read_highest, read_lowest, initial_offset, stage);
 }
 
-void GenericEnvironment::Serialize(std::ofstream& file) const {
+u64 GenericEnvironment::CodeHash() const {
+    const std::span<const char> cached_code{CachedCode()};
+    return Common::Hash::StableHash64(
+        std::span(reinterpret_cast<const u8*>(cached_code.data()), cached_code.size()));
+}
+
+std::span<const char> GenericEnvironment::CachedCode() const noexcept {
+    return std::span(reinterpret_cast<const char*>(code.data()), CachedSizeBytes());
+}
+
+std::string GenericEnvironment::SerializedData() const {
+    // Tables are sorted, so identical environments always serialize to the same bytes
+    std::ostringstream data;
+    WriteSortedTable(data, texture_types);
+    WriteSortedTable(data, texture_pixel_formats);
+    WriteSortedTable(data, cbuf_values);
+    WriteSortedTable(data, cbuf_replacements);
+    return std::move(data).str();
+}
+
+void GenericEnvironment::Serialize(std::ostream& file, u64 data_hash) const {
     const u64 code_size{static_cast<u64>(CachedSizeBytes())};
-    const u64 num_texture_types{static_cast<u64>(texture_types.size())};
-    const u64 num_texture_pixel_formats{static_cast<u64>(texture_pixel_formats.size())};
-    const u64 num_cbuf_values{static_cast<u64>(cbuf_values.size())};
-    const u64 num_cbuf_replacement_values{static_cast<u64>(cbuf_replacements.size())};
+    const u64 code_hash{CodeHash()};
 
     file.write(reinterpret_cast<const char*>(&code_size), sizeof(code_size))
-        .write(reinterpret_cast<const char*>(&num_texture_types), sizeof(num_texture_types))
-        .write(reinterpret_cast<const char*>(&num_texture_pixel_formats),
-               sizeof(num_texture_pixel_formats))
-        .write(reinterpret_cast<const char*>(&num_cbuf_values), sizeof(num_cbuf_values))
-        .write(reinterpret_cast<const char*>(&num_cbuf_replacement_values),
-               sizeof(num_cbuf_replacement_values))
         .write(reinterpret_cast<const char*>(&local_memory_size), sizeof(local_memory_size))
         .write(reinterpret_cast<const char*>(&texture_bound), sizeof(texture_bound))
         .write(reinterpret_cast<const char*>(&start_address), sizeof(start_address))
@@ -219,23 +318,8 @@ void GenericEnvironment::Serialize(std::ofstream& file) const {
         .write(reinterpret_cast<const char*>(&viewport_transform_state),
                sizeof(viewport_transform_state))
         .write(reinterpret_cast<const char*>(&stage), sizeof(stage))
-        .write(reinterpret_cast<const char*>(code.data()), code_size);
-    for (const auto& [key, type] : texture_types) {
-        file.write(reinterpret_cast<const char*>(&key), sizeof(key))
-            .write(reinterpret_cast<const char*>(&type), sizeof(type));
-    }
-    for (const auto& [key, format] : texture_pixel_formats) {
-        file.write(reinterpret_cast<const char*>(&key), sizeof(key))
-            .write(reinterpret_cast<const char*>(&format), sizeof(format));
-    }
-    for (const auto& [key, type] : cbuf_values) {
-        file.write(reinterpret_cast<const char*>(&key), sizeof(key))
-            .write(reinterpret_cast<const char*>(&type), sizeof(type));
-    }
-    for (const auto& [key, type] : cbuf_replacements) {
-        file.write(reinterpret_cast<const char*>(&key), sizeof(key))
-            .write(reinterpret_cast<const char*>(&type), sizeof(type));
-    }
+        .write(reinterpret_cast<const char*>(&code_hash), sizeof(code_hash))
+        .write(reinterpret_cast<const char*>(&data_hash), sizeof(data_hash));
     if (stage == Shader::Stage::Compute) {
         file.write(reinterpret_cast<const char*>(&workgroup_size), sizeof(workgroup_size))
             .write(reinterpret_cast<const char*>(&shared_memory_size), sizeof(shared_memory_size));
@@ -458,56 +542,31 @@ u32 ComputeEnvironment::ReadViewportTransformState() {
     return viewport_transform_state;
 }
 
-void FileEnvironment::Deserialize(std::ifstream& file) {
+void FileEnvironment::Deserialize(std::istream& file, const ShaderCodeBlobs& code_blobs,
+                                  const ShaderEnvironmentDataTable& environment_data) {
     u64 code_size{};
-    u64 num_texture_types{};
-    u64 num_texture_pixel_formats{};
-    u64 num_cbuf_values{};
-    u64 num_cbuf_replacement_values{};
+    u64 code_hash{};
+    u64 data_hash{};
     file.read(reinterpret_cast<char*>(&code_size), sizeof(code_size))
-        .read(reinterpret_cast<char*>(&num_texture_types), sizeof(num_texture_types))
-        .read(reinterpret_cast<char*>(&num_texture_pixel_formats),
-              sizeof(num_texture_pixel_formats))
-        .read(reinterpret_cast<char*>(&num_cbuf_values), sizeof(num_cbuf_values))
-        .read(reinterpret_cast<char*>(&num_cbuf_replacement_values),
-              sizeof(num_cbuf_replacement_values))
         .read(reinterpret_cast<char*>(&local_memory_size), sizeof(local_memory_size))
         .read(reinterpret_cast<char*>(&texture_bound), sizeof(texture_bound))
         .read(reinterpret_cast<char*>(&start_address), sizeof(start_address))
         .read(reinterpret_cast<char*>(&read_lowest), sizeof(read_lowest))
         .read(reinterpret_cast<char*>(&read_highest), sizeof(read_highest))
         .read(reinterpret_cast<char*>(&viewport_transform_state), sizeof(viewport_transform_state))
-        .read(reinterpret_cast<char*>(&stage), sizeof(stage));
-    code.resize(Common::DivCeil(code_size, sizeof(u64)));
-    file.read(reinterpret_cast<char*>(code.data()), code_size);
-    for (size_t i = 0; i < num_texture_types; ++i) {
-        u32 key;
-        Shader::TextureType type;
-        file.read(reinterpret_cast<char*>(&key), sizeof(key))
-            .read(reinterpret_cast<char*>(&type), sizeof(type));
-        texture_types.emplace(key, type);
-    }
-    for (size_t i = 0; i < num_texture_pixel_formats; ++i) {
-        u32 key;
-        Shader::TexturePixelFormat format;
-        file.read(reinterpret_cast<char*>(&key), sizeof(key))
-            .read(reinterpret_cast<char*>(&format), sizeof(format));
-        texture_pixel_formats.emplace(key, format);
-    }
-    for (size_t i = 0; i < num_cbuf_values; ++i) {
-        u64 key;
-        u32 value;
-        file.read(reinterpret_cast<char*>(&key), sizeof(key))
-            .read(reinterpret_cast<char*>(&value), sizeof(value));
-        cbuf_values.emplace(key, value);
-    }
-    for (size_t i = 0; i < num_cbuf_replacement_values; ++i) {
-        u64 key;
-        Shader::ReplaceConstant value;
-        file.read(reinterpret_cast<char*>(&key), sizeof(key))
-            .read(reinterpret_cast<char*>(&value), sizeof(value));
-        cbuf_replacements.emplace(key, value);
-    }
+        .read(reinterpret_cast<char*>(&stage), sizeof(stage))
+        .read(reinterpret_cast<char*>(&code_hash), sizeof(code_hash))
+        .read(reinterpret_cast<char*>(&data_hash), sizeof(data_hash));
+    const auto blob = code_blobs.find(code_hash);
+    if (blob == code_blobs.end() || blob->second.size() != Common::DivCeil(code_size, sizeof(u64))) {
+        throw std::ios_base::failure("Missing shader code in pipeline cache");
+    }
+    code = blob->second;
+    const auto env_data = environment_data.find(data_hash);
+    if (env_data == environment_data.end()) {
+        throw std::ios_base::failure("Missing environment data in pipeline cache");
+    }
+    data = env_data->second;
     if (stage == Shader::Stage::Compute) {
         file.read(reinterpret_cast<char*>(&workgroup_size), sizeof(workgroup_size))
             .read(reinterpret_cast<char*>(&shared_memory_size), sizeof(shared_memory_size));
@@ -534,27 +593,29 @@ u64 FileEnvironment::ReadInstruction(u32 address) {
 }
 
 u32 FileEnvironment::ReadCbufValue(u32 cbuf_index, u32 cbuf_offset) {
-    const auto it{cbuf_values.find(MakeCbufKey(cbuf_index, cbuf_offset))};
-    if (it == cbuf_values.end()) {
+    const u32* const value{
+        FindInSortedTable(data->cbuf_values, MakeCbufKey(cbuf_index, cbuf_offset))};
+    if (!value) {
         throw Shader::LogicError("Uncached read texture type");
     }
-    return it->second;
+    return *value;
 }
 
 Shader::TextureType FileEnvironment::ReadTextureType(u32 handle) {
-    const auto it{texture_types.find(handle)};
-    if (it == texture_types.end()) {
+    const Shader::TextureType* const type{FindInSortedTable(data->texture_types, handle)};
+    if (!type) {
         throw Shader::LogicError("Uncached read texture type");
     }
-    return it->second;
+    return *type;
 }
 
 Shader::TexturePixelFormat FileEnvironment::ReadTexturePixelFormat(u32 handle) {
-    const auto it{texture_pixel_formats.find(handle)};
-    if (it == texture_pixel_formats.end()) {
+    const Shader::TexturePixelFormat* const format{
+        FindInSortedTable(data->texture_pixel_formats, handle)};
+    if (!format) {
         throw Shader::LogicError("Uncached read texture pixel format");
     }
-    return it->second;
+    return *format;
 }
 
 bool FileEnvironment::IsTexturePixelFormatInteger(u32 handle) {
@@ -585,11 +646,12 @@ std::array<u32, 3> FileEnvironment::WorkgroupSize() const {
 std::optional<Shader::ReplaceConstant> FileEnvironment::GetReplaceConstBuffer(u32 bank,
                                                                               u32 offset) {
     const u64 key = (static_cast<u64>(bank) << 32) | static_cast<u64>(offset);
-    auto it = cbuf_replacements.find(key);
-    if (it == cbuf_replacements.end()) {
+    const Shader::ReplaceConstant* const replacement{
+        FindInSortedTable(data->cbuf_replacements, key)};
+    if (!replacement) {
         return std::nullopt;
     }
-    return it->second;
+    return *replacement;
 }
 
 void SerializePipeline(std::span<const char> key, std::span<const GenericEnvironment* const> envs,
@@ -601,23 +663,53 @@ void SerializePipeline(std::span<const char> key, std::span<const GenericEnviron
                   Common::FS::PathToUTF8String(filename));
         return;
     }
+    auto& written = GetWrittenCodeBlobs();
+    std::scoped_lock lock{written.mutex};
+    auto& written_records = written.files[Common::FS::PathToUTF8String(filename)];
     if (file.tellp() == 0) {
         // Write header
         file.write(MAGIC_NUMBER.data(), MAGIC_NUMBER.size())
             .write(reinterpret_cast<const char*>(&cache_version), sizeof(cache_version));
+        written_records = {};
     }
     if (!std::ranges::all_of(envs, &GenericEnvironment::CanBeSerialized)) {
         return;
     }
-    const u32 num_envs{static_cast<u32>(envs.size())};
-    file.write(reinterpret_cast<const char*>(&num_envs), sizeof(num_envs));
+    std::vector<u64> data_hashes;
+    data_hashes.reserve(envs.size());
     for (const GenericEnvironment* const env : envs) {
-        env->Serialize(file);
+        const std::string data{env->SerializedData()};
+        const u64 data_hash{Common::Hash::StableHash64(
+            std::span(reinterpret_cast<const u8*>(data.data()), data.size()))};
+        data_hashes.push_back(data_hash);
+        if (written_records.environment_data.insert(data_hash).second) {
+            std::ostringstream record;
+            record.write(reinterpret_cast<const char*>(&data_hash), sizeof(data_hash))
+                .write(data.data(), data.size());
+            WriteCacheRecord(file, CacheRecordType::EnvironmentData, record.str());
+        }
+        const u64 code_hash{env->CodeHash()};
+        if (!written_records.code.insert(code_hash).second) {
+            continue;
+        }
+        const std::span<const char> code{env->CachedCode()};
+        std::ostringstream blob;
+        blob.write(reinterpret_cast<const char*>(&code_hash), sizeof(code_hash))
+            .write(code.data(), code.size());
+        WriteCacheRecord(file, CacheRecordType::CodeBlob, blob.str());
     }
-    file.write(key.data(), key.size_bytes());
+    std::ostringstream pipeline;
+    const u32 num_envs{static_cast<u32>(envs.size())};
+    pipeline.write(reinterpret_cast<const char*>(&num_envs), sizeof(num_envs));
+    for (size_t i = 0; i < envs.size(); ++i) {
+        envs[i]->Serialize(pipeline, data_hashes[i]);
+    }
+    pipeline.write(key.data(), key.size_bytes());
+    WriteCacheRecord(file, CacheRecordType::Pipeline, pipeline.str());
 
 } catch (const std::ios_base::failure& e) {
     LOG_ERROR(Common_Filesystem, "{}", e.what());
+    ForgetCodeBlobs(filename);
     if (!Common::FS::RemoveFile(filename)) {
         LOG_ERROR(Common_Filesystem, "Failed to delete pipeline cache file {}",
                   Common::FS::PathToUTF8String(filename));
@@ -626,8 +718,9 @@ void SerializePipeline(std::span<const char> key, std::span<const GenericEnviron
 
 void LoadPipelines(
     std::stop_token stop_loading, const std::filesystem::path& filename, u32 expected_cache_version,
-    Common::UniqueFunction<void, std::ifstream&, FileEnvironment> load_compute,
-    Common::UniqueFunction<void, std::ifstream&, std::vector<FileEnvironment>> load_graphics) try {
+    Common::UniqueFunction<void, std::istream&, FileEnvironment> load_compute,
+    Common::UniqueFunction<void, std::istream&, std::vector<FileEnvironment>> load_graphics) try {
+    ForgetCodeBlobs(filename);
     std::ifstream file(filename, std::ios::binary | std::ios::ate);
     if (!file.is_open()) {
         return;
@@ -656,29 +749,197 @@ void LoadPipelines(
         }
         return;
     }
+    ShaderCodeBlobs code_blobs;
+    ShaderEnvironmentDataTable environment_data;
+    std::vector<u8> compressed;
     while (file.tellg() != end) {
         if (stop_loading.stop_requested()) {
             return;
         }
+        CacheRecordHeader header{};
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        compressed.resize(header.compressed_size);
+        file.read(reinterpret_cast<char*>(compressed.data()), compressed.size());
+        const std::vector<u8> payload = Common::Compression::DecompressDataZSTD(compressed);
+        if (payload.size() != header.uncompressed_size) {
+            throw std::ios_base::failure("Corrupted pipeline cache record");
+        }
+        std::istringstream record(std::string(payload.begin(), payload.end()));
+        record.exceptions(std::ifstream::failbit);
+
+        if (header.type == CacheRecordType::CodeBlob) {
+            u64 code_hash{};
+            record.read(reinterpret_cast<char*>(&code_hash), sizeof(code_hash));
+            const size_t code_size{payload.size() - sizeof(code_hash)};
+            std::vector<u64> code(Common::DivCeil(code_size, sizeof(u64)));
+            record.read(reinterpret_cast<char*>(code.data()), code_size);
+            code_blobs.insert_or_assign(code_hash, std::move(code));
+            continue;
+        }
+        if (header.type == CacheRecordType::EnvironmentData) {
+            u64 data_hash{};
+            record.read(reinterpret_cast<char*>(&data_hash), sizeof(data_hash));
+            auto data{std::make_shared<ShaderEnvironmentData>()};
+            ReadSortedTable(record, data->texture_types);
+            ReadSortedTable(record, data->texture_pixel_formats);
+            ReadSortedTable(record, data->cbuf_values);
+            ReadSortedTable(record, data->cbuf_replacements);
+            environment_data.insert_or_assign(data_hash, std::move(data));
+            continue;
+        }
         u32 num_envs{};
-        file.read(reinterpret_cast<char*>(&num_envs), sizeof(num_envs));
+        record.read(reinterpret_cast<char*>(&num_envs), sizeof(num_envs));
         std::vector<FileEnvironment> envs(num_envs);
         for (FileEnvironment& env : envs) {
-            env.Deserialize(file);
+            env.Deserialize(record, code_blobs, environment_data);
         }
         if (envs.front().ShaderStage() == Shader::Stage::Compute) {
-            load_compute(file, std::move(envs.front()));
+            load_compute(record, std::move(envs.front()));
         } else {
-            load_graphics(file, std::move(envs));
+            load_graphics(record, std::move(envs));
         }
     }
+    // Let later serializations know which code and data are already in the file
+    auto& written = GetWrittenCodeBlobs();
+    std::scoped_lock lock{written.mutex};
+    auto& written_records = written.files[Common::FS::PathToUTF8String(filename)];
+    for (const auto& [code_hash, code] : code_blobs) {
+        written_records.code.insert(code_hash);
+    }
+    for (const auto& [data_hash, data] : environment_data) {
+        written_records.environment_data.insert(data_hash);
+    }
 
 } catch (const std::ios_base::failure& e) {
     LOG_ERROR(Common_Filesystem, "{}", e.what());
+    ForgetCodeBlobs(filename);
     if (!Common::FS::RemoveFile(filename)) {
         LOG_ERROR(Common_Filesystem, "Failed to delete pipeline cache file {}",
                   Common::FS::PathToUTF8String(filename));
     }
 }
 
+/// Reads the header of a pipeline cache file, leaving the stream at the first record.
+static bool ReadPipelineCacheHeader(std::ifstream& file, u32 expected_cache_version) {
+    std::array<char, 8> magic_number;
+    u32 cache_version;
+    file.read(magic_number.data(), magic_number.size())
+        .read(reinterpret_cast<char*>(&cache_version), sizeof(cache_version));
+    return magic_number == MAGIC_NUMBER && cache_version == expected_cache_version;
+}
+
+size_t ImportPipelineCache(const std::filesystem::path& source,
+                           const std::filesystem::path& destination, u32 cache_version) try {
+    std::ifstream source_file(source, std::ios::binary | std::ios::ate);
+    if (!source_file.is_open()) {
+        return 0;
+    }
+    source_file.exceptions(std::ifstream::failbit);
+    const auto source_end{source_file.tellg()};
+    source_file.seekg(0, std::ios::beg);
+    if (!ReadPipelineCacheHeader(source_file, cache_version)) {
+        LOG_WARNING(Common_Filesystem, "Pipeline manifest {} was made by another version",
+                    Common::FS::PathToUTF8String(source));
+        return 0;
+    }
+
+    ankerl::unordered_dense::set<u64> code_hashes;
+    ankerl::unordered_dense::set<u64> data_hashes;
+    ankerl::unordered_dense::set<u64> pipeline_hashes;
+    // Shared records start with the hash they are referenced by
+    const auto shared_record_hash = [](std::span<const u8> compressed) {
+        const std::vector<u8> payload = Common::Compression::DecompressDataZSTD(compressed);
+        u64 code_hash{};
+        std::memcpy(&code_hash, payload.data(), std::min(payload.size(), sizeof(code_hash)));
+        return code_hash;
+    };
+    const auto pipeline_hash = [](std::span<const u8> compressed) {
+        return Common::Hash::StableHash64(compressed);
+    };
+    std::vector<u8> compressed;
+    const auto read_record = [&compressed](std::ifstream& file, CacheRecordHeader& header) {
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        compressed.resize(header.compressed_size);
+        file.read(reinterpret_cast<char*>(compressed.data()), compressed.size());
+    };
+
+    // Collect what the destination already has
+    if (std::ifstream destination_file(destination, std::ios::binary | std::ios::ate);
+        destination_file.is_open()) {
+        destination_file.exceptions(std::ifstream::failbit);
+        const auto destination_end{destination_file.tellg()};
+        destination_file.seekg(0, std::ios::beg);
+        if (ReadPipelineCacheHeader(destination_file, cache_version)) {
+            while (destination_file.tellg() != destination_end) {
+                CacheRecordHeader header{};
+                read_record(destination_file, header);
+                if (header.type == CacheRecordType::CodeBlob) {
+                    code_hashes.insert(shared_record_hash(compressed));
+                } else if (header.type == CacheRecordType::EnvironmentData) {
+                    data_hashes.insert(shared_record_hash(compressed));
+                } else {
+                    pipeline_hashes.insert(pipeline_hash(compressed));
+                }
+            }
+        } else {
+            destination_file.close();
+            Common::FS::RemoveFile(destination);
+        }
+    }
+    ForgetCodeBlobs(destination);
+
+    std::ofstream destination_file(destination, std::ios::binary | std::ios::ate | std::ios::app);
+    destination_file.exceptions(std::ifstream::failbit);
+    if (destination_file.tellp() == 0) {
+        destination_file.write(MAGIC_NUMBER.data(), MAGIC_NUMBER.size())
+            .write(reinterpret_cast<const char*>(&cache_version), sizeof(cache_version));
+    }
+    // Records are self contained, copy the missing ones as they are
+    size_t num_imported{};
+    while (source_file.tellg() != source_end) {
+        CacheRecordHeader header{};
+        read_record(source_file, header);
+        bool is_new{};
+        switch (header.type) {
+        case CacheRecordType::CodeBlob:
+            is_new = code_hashes.insert(shared_record_hash(compressed)).second;
+            break;
+        case CacheRecordType::EnvironmentData:
+            is_new = data_hashes.insert(shared_record_hash(compressed)).second;
+            break;
+        case CacheRecordType::Pipeline:
+            is_new = pipeline_hashes.insert(pipeline_hash(compressed)).second;
+            break;
+        }
+        if (!is_new) {
+            continue;
+        }
+        destination_file.write(reinterpret_cast<const char*>(&header), sizeof(header))
+            .write(reinterpret_cast<const char*>(compressed.data()), compressed.size());
+        if (header.type == CacheRecordType::Pipeline) {
+            ++num_imported;
+        }
+    }
+    LOG_INFO(Common_Filesystem, "Imported {} pipelines from {}", num_imported,
+             Common::FS::PathToUTF8String(source));
+    return num_imported;
+
+} catch (const std::ios_base::failure& e) {
+    LOG_ERROR(Common_Filesystem, "Failed to import pipeline manifest {}: {}",
+              Common::FS::PathToUTF8String(source), e.what());
+    return 0;
+}
+
+void ImportPendingPipelineManifest(const std::filesystem::path& filename, u32 cache_version) {
+    const auto manifest{filename.parent_path() / "import" / filename.filename()};
+    if (!Common::FS::IsFile(manifest)) {
+        return;
+    }
+    ImportPipelineCache(manifest, filename, cache_version);
+    if (!Common::FS::RemoveFile(manifest)) {
+        LOG_ERROR(Common_Filesystem, "Failed to delete pipeline manifest {}",
+                  Common::FS::PathToUTF8String(manifest));
+    }
+}
+
 } // namespace VideoCommon
@@ -13,7 +13,9 @@
 #include <memory>
 #include <optional>
 #include <span>
+#include <string>
 #include <type_traits>
+#include <utility>
 #include <ankerl/unordered_dense.h>
 #include <vector>
 
@@ -63,7 +65,15 @@ public:
 
     void Dump(u64 pipeline_hash, u64 shader_hash) override;
 
-    void Serialize(std::ofstream& file) const;
+    /// Hash of the cached code, the code itself is stored once per cache file.
+    [[nodiscard]] u64 CodeHash() const;
+
+    [[nodiscard]] std::span<const char> CachedCode() const noexcept;
+
+    /// Constant buffer and texture tables, stored once per cache file for all identical shaders.
+    [[nodiscard]] std::string SerializedData() const;
+
+    void Serialize(std::ostream& file, u64 data_hash) const;
 
     bool HasHLEMacroState() const override {
         return has_hle_engine_state;
@@ -157,6 +167,22 @@ private:
     Tegra::Engines::KeplerCompute* kepler_compute{};
 };
 
+/// Shader code blobs of a pipeline cache file, keyed by GenericEnvironment::CodeHash
+using ShaderCodeBlobs = ankerl::unordered_dense::map<u64, std::vector<u64>>;
+
+/// Constant buffer values and texture queries a shader was built with, sorted by key
+struct ShaderEnvironmentData {
+    std::vector<std::pair<u32, Shader::TextureType>> texture_types;
+    std::vector<std::pair<u32, Shader::TexturePixelFormat>> texture_pixel_formats;
+    std::vector<std::pair<u64, u32>> cbuf_values;
+    std::vector<std::pair<u64, Shader::ReplaceConstant>> cbuf_replacements;
+};
+
+/// Environment data of a pipeline cache file, keyed by the hash of GenericEnvironment::SerializedData.
+/// Environments loaded from the file share these tables.
+using ShaderEnvironmentDataTable =
+    ankerl::unordered_dense::map<u64, std::shared_ptr<const ShaderEnvironmentData>>;
+
 class FileEnvironment final : public Shader::Environment {
 public:
     FileEnvironment() = default;
@@ -168,7 +194,8 @@ public:
     FileEnvironment& operator=(const FileEnvironment&) = delete;
     FileEnvironment(const FileEnvironment&) = delete;
 
-    void Deserialize(std::ifstream& file);
+    void Deserialize(std::istream& file, const ShaderCodeBlobs& code_blobs,
+                     const ShaderEnvironmentDataTable& environment_data);
 
     [[nodiscard]] u64 ReadInstruction(u32 address) override;
 
@@ -194,17 +221,14 @@ public:
                                                                                u32 offset) override;
 
     [[nodiscard]] bool HasHLEMacroState() const override {
-        return cbuf_replacements.size() != 0;
+        return data && !data->cbuf_replacements.empty();
     }
 
     void Dump(u64 pipeline_hash, u64 shader_hash) override;
 
 private:
     std::vector<u64> code;
-    ankerl::unordered_dense::map<u32, Shader::TextureType> texture_types;
-    ankerl::unordered_dense::map<u32, Shader::TexturePixelFormat> texture_pixel_formats;
-    ankerl::unordered_dense::map<u64, u32> cbuf_values;
-    ankerl::unordered_dense::map<u64, Shader::ReplaceConstant> cbuf_replacements;
+    std::shared_ptr<const ShaderEnvironmentData> data;
     std::array<u32, 3> workgroup_size{};
     u32 local_memory_size{};
     u32 shared_memory_size{};
@@ -225,8 +249,18 @@ void SerializePipeline(const Key& key, const Envs& envs, const std::filesystem::
     SerializePipeline(std::span(reinterpret_cast<const char*>(&key), sizeof(key)), std::span(envs.data(), envs.size()), filename, cache_version);
 }
 
+/// @brief Appends the pipelines and shader code of a cache file that are missing in another one.
+/// The transferable cache holds no driver specific data, so a cache file taken from any machine
+/// works as a pipeline manifest. Importing into a missing destination writes a compacted copy.
+/// @returns The number of imported pipelines
+size_t ImportPipelineCache(const std::filesystem::path& source,
+                           const std::filesystem::path& destination, u32 cache_version);
+
+/// Imports and removes the manifest dropped in the "import" directory next to the given cache.
+void ImportPendingPipelineManifest(const std::filesystem::path& filename, u32 cache_version);
+
 void LoadPipelines(std::stop_token stop_loading, const std::filesystem::path& filename, u32 expected_cache_version,
-    Common::UniqueFunction<void, std::ifstream&, FileEnvironment> load_compute,
-    Common::UniqueFunction<void, std::ifstream&, std::vector<FileEnvironment>> load_graphics);
+    Common::UniqueFunction<void, std::istream&, FileEnvironment> load_compute,
+    Common::UniqueFunction<void, std::istream&, std::vector<FileEnvironment>> load_graphics);
 
 } // namespace VideoCommon
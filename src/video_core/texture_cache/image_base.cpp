@@ -108,6 +108,58 @@ std::optional<SubresourceBase> ImageBase::TryFindBase(GPUVAddr other_addr) const
     }
 }
 
+SubresourceRange ImageBase::FindSubresourceRange(u32 offset, u32 size) const noexcept {
+    const s32 num_levels = info.resources.levels;
+    const s32 num_layers = info.resources.layers;
+    const SubresourceRange full{
+        .base{},
+        .extent{
+            .levels = num_levels,
+            .layers = num_layers,
+        },
+    };
+    const u32 end = (std::min)(offset + size, guest_size_bytes);
+    if (info.type != ImageType::e2D || info.layer_stride == 0 || offset >= end) {
+        return full;
+    }
+    const s32 first_layer = static_cast<s32>(offset / info.layer_stride);
+    const s32 last_layer =
+        (std::min)(static_cast<s32>((end - 1) / info.layer_stride), num_layers - 1);
+    if (first_layer > last_layer) {
+        return full;
+    }
+    SubresourceRange range{
+        .base{
+            .level = 0,
+            .layer = first_layer,
+        },
+        .extent{
+            .levels = num_levels,
+            .layers = last_layer - first_layer + 1,
+        },
+    };
+    if (first_layer != last_layer) {
+        return range;
+    }
+    // The levels of a layer are stored one after the other
+    const u32 layer_offset = static_cast<u32>(first_layer) * info.layer_stride;
+    const u32 begin_in_layer = offset - layer_offset;
+    const u32 end_in_layer = end - layer_offset;
+    s32 first_level = 0;
+    s32 last_level = 0;
+    for (s32 level = 0; level < num_levels; ++level) {
+        if (mip_level_offsets[level] <= begin_in_layer) {
+            first_level = level;
+        }
+        if (mip_level_offsets[level] < end_in_layer) {
+            last_level = level;
+        }
+    }
+    range.base.level = first_level;
+    range.extent.levels = last_level - first_level + 1;
+    return range;
+}
+
 ImageViewId ImageBase::FindView(const ImageViewInfo& view_info) const noexcept {
     const auto it = std::ranges::find(image_view_infos, view_info);
     if (it == image_view_infos.end()) {
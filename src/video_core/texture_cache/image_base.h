@@ -24,7 +24,6 @@ enum class ImageFlagBits : u32 {
     Tracked = 1 << 4,     ///< Writes and reads are being hooked from the CPU JIT
     Strong = 1 << 5,      ///< Exists in the image table, the dimensions are can be trusted
     Registered = 1 << 6,  ///< True when the image is registered
-    Picked = 1 << 7,      ///< Temporary flag to mark the image as picked
     Remapped = 1 << 8,    ///< Image has been remapped.
     Sparse = 1 << 9,      ///< Image has non continuous submemory.
 
@@ -42,6 +41,7 @@ enum class ImageFlagBits : u32 {
 
     AsynchronousDecode = 1 << 16,
     IsDecoding = 1 << 17, ///< Is currently being decoded asynchronously.
+    DownloadQueued = 1 << 18, ///< Has an asynchronous download waiting for the next fence
 };
 DECLARE_ENUM_FLAG_OPERATORS(ImageFlagBits)
 
@@ -60,6 +60,14 @@ struct ImageBase {
 
     [[nodiscard]] std::optional<SubresourceBase> TryFindBase(GPUVAddr other_addr) const noexcept;
 
+    /// Returns the levels and layers stored in a range of the guest memory of the image.
+    /// The whole image is returned when its subresources can't be told apart.
+    [[nodiscard]] SubresourceRange FindSubresourceRange(u32 offset, u32 size) const noexcept;
+
+    [[nodiscard]] bool HasPartialCpuModification() const noexcept {
+        return cpu_dirty_end != 0;
+    }
+
     [[nodiscard]] ImageViewId FindView(const ImageViewInfo& view_info) const noexcept;
 
     void InsertView(const ImageViewInfo& view_info, ImageViewId image_view_id);
@@ -104,6 +112,11 @@ struct ImageBase {
     u64 modification_tick = 0;
     size_t lru_index = SIZE_MAX;
 
+    /// Page aligned CPU range written since the last upload, when the image is only partially
+    /// modified. These pages are untracked while the rest of the image stays tracked.
+    VAddr cpu_dirty_begin = 0;
+    VAddr cpu_dirty_end = 0;
+
     std::array<u32, MAX_MIP_LEVELS> mip_level_offsets{};
 
     std::vector<ImageViewInfo> image_view_infos;
@@ -117,6 +130,23 @@ struct ImageBase {
     ImageMapId map_view_id{};
 };
 
+/// Fields of an image read by the region queries, kept packed apart from the images
+struct ImageHotFields {
+    ImageHotFields() = default;
+    explicit ImageHotFields(const ImageBase& image)
+        : gpu_addr{image.gpu_addr}, gpu_addr_end{image.gpu_addr + image.guest_size_bytes} {}
+
+    [[nodiscard]] bool OverlapsGPU(GPUVAddr overlap_gpu_addr, size_t overlap_size) const noexcept {
+        const GPUVAddr overlap_end = overlap_gpu_addr + overlap_size;
+        return gpu_addr < overlap_end && overlap_gpu_addr < gpu_addr_end;
+    }
+
+    GPUVAddr gpu_addr = 0;
+    GPUVAddr gpu_addr_end = 0;
+    /// Marks the image as visited during a region query
+    bool picked = false;
+};
+
 struct ImageMapView {
     explicit ImageMapView(GPUVAddr gpu_addr, VAddr cpu_addr, size_t size, ImageId image_id);
 
@@ -139,6 +169,19 @@ struct ImageMapView {
     bool picked{};
 };
 
+/// Entry of the CPU page table. Duplicates the range of its map view so region queries can reject
+/// maps that don't overlap without loading the view.
+struct ImageMapPageEntry {
+    [[nodiscard]] bool Overlaps(VAddr overlap_cpu_addr, size_t overlap_size) const noexcept {
+        return cpu_addr < overlap_cpu_addr + overlap_size && overlap_cpu_addr < cpu_addr_end;
+    }
+
+    ImageMapId map_id;
+    ImageId image_id;
+    VAddr cpu_addr;
+    VAddr cpu_addr_end;
+};
+
 struct ImageAllocBase {
     std::vector<ImageId> images;
 };
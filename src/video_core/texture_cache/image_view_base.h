@@ -17,7 +17,6 @@ struct ImageInfo;
 struct NullImageViewParams {};
 
 enum class ImageViewFlagBits : u16 {
-    PreemtiveDownload = 1 << 0,
     Strong = 1 << 1,
     Slice = 1 << 2,
 };
@@ -58,19 +58,7 @@ TextureCache<P>::TextureCache(Runtime& runtime_, Tegra::MaxwellDeviceMemoryManag
     void(slot_samplers.insert(runtime, sampler_descriptor));
 
     if constexpr (HAS_DEVICE_MEMORY_INFO) {
-        const s64 device_local_memory = static_cast<s64>(runtime.GetDeviceLocalMemory());
-        const s64 min_spacing_expected = device_local_memory - 1_GiB;
-        const s64 min_spacing_critical = device_local_memory - 512_MiB;
-        const s64 mem_threshold = (std::min)(device_local_memory, TARGET_THRESHOLD);
-        const s64 min_vacancy_expected = (6 * mem_threshold) / 10;
-        const s64 min_vacancy_critical = (2 * mem_threshold) / 10;
-        expected_memory = static_cast<u64>(
-            (std::max)((std::min)(device_local_memory - min_vacancy_expected, min_spacing_expected),
-                     DEFAULT_EXPECTED_MEMORY));
-        critical_memory = static_cast<u64>(
-            (std::max)((std::min)(device_local_memory - min_vacancy_critical, min_spacing_critical),
-                     DEFAULT_CRITICAL_MEMORY));
-        minimum_memory = static_cast<u64>((device_local_memory - mem_threshold) / 2);
+        ConfigureMemoryThresholds(runtime.GetDeviceLocalMemory());
     } else {
         expected_memory = DEFAULT_EXPECTED_MEMORY + 512_MiB;
         critical_memory = DEFAULT_CRITICAL_MEMORY + 1_GiB;
@@ -113,47 +101,92 @@ TextureCache<P>::TextureCache(Runtime& runtime_, Tegra::MaxwellDeviceMemoryManag
     }
 }
 
+template <class P>
+void TextureCache<P>::ConfigureMemoryThresholds(u64 memory_budget) {
+    const s64 device_local_memory = static_cast<s64>(memory_budget);
+    const s64 min_spacing_expected = device_local_memory - 1_GiB;
+    const s64 min_spacing_critical = device_local_memory - 512_MiB;
+    const s64 mem_threshold = (std::min)(device_local_memory, TARGET_THRESHOLD);
+    const s64 min_vacancy_expected = (6 * mem_threshold) / 10;
+    const s64 min_vacancy_critical = (2 * mem_threshold) / 10;
+    expected_memory = static_cast<u64>(
+        (std::max)((std::min)(device_local_memory - min_vacancy_expected, min_spacing_expected),
+                 DEFAULT_EXPECTED_MEMORY));
+    critical_memory = static_cast<u64>(
+        (std::max)((std::min)(device_local_memory - min_vacancy_critical, min_spacing_critical),
+                 DEFAULT_CRITICAL_MEMORY));
+    minimum_memory = static_cast<u64>((device_local_memory - mem_threshold) / 2);
+    memory_budget_tracked = memory_budget;
+}
+
 template <class P>
 void TextureCache<P>::RunGarbageCollector() {
     bool high_priority_mode = false;
     bool aggressive_mode = false;
     u64 ticks_to_destroy = 0;
     size_t num_iterations = 0;
+    // Memory that will be released once the queued eviction downloads are written back
+    u64 pending_release = 0;
+    // Download traffic allowed this frame, the rest of the pressure is handled on the next ones
+    u64 download_budget = 0;
+    const auto UsedMemory = [&] {
+        return total_used_memory > pending_release ? total_used_memory - pending_release : 0;
+    };
     const auto Configure = [&](bool allow_aggressive) {
-        high_priority_mode = total_used_memory >= expected_memory;
-        aggressive_mode = allow_aggressive && total_used_memory >= critical_memory;
+        high_priority_mode = UsedMemory() >= expected_memory;
+        aggressive_mode = allow_aggressive && UsedMemory() >= critical_memory;
         ticks_to_destroy = aggressive_mode ? 10ULL : high_priority_mode ? 25ULL : 50ULL;
         num_iterations = aggressive_mode ? 40 : (high_priority_mode ? 20 : 10);
+        download_budget = aggressive_mode ? EVICTION_DOWNLOAD_BUDGET_CRITICAL
+                                          : EVICTION_DOWNLOAD_BUDGET;
     };
-    const auto Cleanup = [this, &num_iterations, &high_priority_mode, &aggressive_mode](ImageId image_id) {
+    const auto Cleanup = [&](ImageId image_id) {
         if (num_iterations == 0) {
             return true;
         }
         --num_iterations;
         auto& image = slot_images[image_id];
-        if (True(image.flags & ImageFlagBits::IsDecoding)) {
+        if (True(image.flags & ImageFlagBits::IsDecoding) ||
+            False(image.flags & ImageFlagBits::Registered)) {
             return false;
         }
         const bool must_download = image.IsSafeDownload() && False(image.flags & ImageFlagBits::BadOverlap);
         if ((!aggressive_mode && True(image.flags & ImageFlagBits::CostlyLoad)) || (!high_priority_mode && must_download)) {
             return false;
         }
+        if (must_download && image.unswizzled_size_bytes > download_budget) {
+            return false;
+        }
+        const bool immediate_delete = image.scale_tick > frame_tick + 5;
         if (must_download) {
-            auto map = runtime.DownloadStagingBuffer(image.unswizzled_size_bytes);
-            const auto copies = FixSmallVectorADL(FullDownloadCopies(image.info));
-            image.DownloadMemory(map, copies);
-            runtime.Finish();
-            SwizzleImage(*gpu_memory, image.gpu_addr, image.info, copies, map.mapped_span, swizzle_data_buffer);
+            // Record the download now and write it back after the whole pass, so evicting many
+            // dirty images costs a single wait instead of one per image.
+            const auto copies = FullDownloadCopies(image.info);
+            PendingEviction& eviction = pending_evictions.emplace_back(PendingEviction{
+                .image_id = image_id,
+                .staging_buffer = runtime.DownloadStagingBuffer(image.unswizzled_size_bytes, true),
+                .copies = std::vector<BufferImageCopy>(copies.begin(), copies.end()),
+                .immediate_delete = immediate_delete,
+            });
+            image.DownloadMemory(eviction.staging_buffer, eviction.copies);
+            download_budget -= image.unswizzled_size_bytes;
+            pending_release += Common::AlignUp(
+                (std::max)(image.guest_size_bytes, image.unswizzled_size_bytes), 1024);
+            ++eviction_stats.downloads;
+            eviction_stats.download_bytes += image.unswizzled_size_bytes;
         }
         if (True(image.flags & ImageFlagBits::Tracked)) {
             UntrackImage(image, image_id);
         }
         UnregisterImage(image_id);
-        DeleteImage(image_id, image.scale_tick > frame_tick + 5);
-        if (aggressive_mode && total_used_memory < critical_memory) {
+        if (!must_download) {
+            DeleteImage(image_id, immediate_delete);
+        }
+        ++eviction_stats.images;
+        if (aggressive_mode && UsedMemory() < critical_memory) {
             num_iterations >>= 2;
             aggressive_mode = false;
-        } else if (high_priority_mode && total_used_memory < expected_memory) {
+        } else if (high_priority_mode && UsedMemory() < expected_memory) {
             num_iterations >>= 1;
             high_priority_mode = false;
         }
@@ -161,10 +194,27 @@ void TextureCache<P>::RunGarbageCollector() {
     };
     Configure(false);
     lru_cache.ForEachItemBelow(frame_tick - ticks_to_destroy, Cleanup);
-    if (total_used_memory >= critical_memory) {
+    if (UsedMemory() >= critical_memory) {
         Configure(true);
         lru_cache.ForEachItemBelow(frame_tick - ticks_to_destroy, Cleanup);
     }
+    FinishPendingEvictions();
+}
+
+template <class P>
+void TextureCache<P>::FinishPendingEvictions() {
+    if (pending_evictions.empty()) {
+        return;
+    }
+    runtime.Finish();
+    for (PendingEviction& eviction : pending_evictions) {
+        const ImageBase& image = slot_images[eviction.image_id];
+        SwizzleImage(*gpu_memory, image.gpu_addr, image.info, eviction.copies,
+                     eviction.staging_buffer.mapped_span, swizzle_data_buffer);
+        runtime.FreeDeferredStagingBuffer(eviction.staging_buffer);
+        DeleteImage(eviction.image_id, eviction.immediate_delete);
+    }
+    pending_evictions.clear();
 }
 
 template <class P>
@@ -172,13 +222,37 @@ void TextureCache<P>::TickFrame() {
     // If we can obtain the memory info, use it instead of the estimate.
     if (runtime.CanReportMemoryUsage()) {
         total_used_memory = runtime.GetDeviceMemoryUsage();
+        if constexpr (HAS_DEVICE_MEMORY_INFO) {
+            // The driver budget shrinks when other applications claim video memory, follow it
+            const u64 memory_budget = runtime.GetDeviceMemoryBudget();
+            const u64 budget_delta = memory_budget > memory_budget_tracked
+                                         ? memory_budget - memory_budget_tracked
+                                         : memory_budget_tracked - memory_budget;
+            if (memory_budget != 0 && budget_delta >= MEMORY_BUDGET_GRANULARITY) {
+                ConfigureMemoryThresholds(memory_budget);
+            }
+        }
     }
+    eviction_stats = {};
     if (total_used_memory > minimum_memory) {
         RunGarbageCollector();
     }
-    sentenced_images.Tick();
-    sentenced_framebuffers.Tick();
-    sentenced_image_view.Tick();
+    if (eviction_stats.images != 0) {
+        LOG_DEBUG(HW_GPU, "Evicted {} images, {} written back ({} KiB)", eviction_stats.images,
+                  eviction_stats.downloads, eviction_stats.download_bytes / 1_KiB);
+    }
+    if constexpr (HAS_BACKGROUND_DESTRUCTION) {
+        const auto destroy = [this](auto&& objects) {
+            runtime.DestroyInBackground(std::move(objects));
+        };
+        sentenced_images.Tick(destroy);
+        sentenced_framebuffers.Tick(destroy);
+        sentenced_image_view.Tick(destroy);
+    } else {
+        sentenced_images.Tick();
+        sentenced_framebuffers.Tick();
+        sentenced_image_view.Tick();
+    }
     TickAsyncDecode();
     TickAsyncUnswizzle();
 
@@ -193,6 +267,11 @@ void TextureCache<P>::TickFrame() {
     }
 }
 
+template <class P>
+const typename P::Image& TextureCache<P>::GetImage(ImageId id) const noexcept {
+    return slot_images[id];
+}
+
 template <class P>
 const typename P::ImageView& TextureCache<P>::GetImageView(ImageViewId id) const noexcept {
     return slot_image_views[id];
@@ -212,7 +291,7 @@ typename P::ImageView& TextureCache<P>::GetImageView(u32 index) noexcept {
 
 template <class P>
 void TextureCache<P>::MarkModification(ImageId id) noexcept {
-    MarkModification(slot_images[id]);
+    MarkModification(id, slot_images[id]);
 }
 
 template <class P>
@@ -458,6 +537,32 @@ bool TextureCache<P>::RescaleRenderTargets() {
     return rescaled;
 }
 
+template <class P>
+void TextureCache<P>::ScaleDownImages() {
+    if (!maxwell3d) {
+        return;
+    }
+    for (auto [image_id, image] : slot_images) {
+        ScaleDown(*image);
+    }
+    // The viewports of render targets that stay rescaled depend on the scale factor too
+    auto& flags = maxwell3d->dirty.flags;
+    flags[Dirty::RescaleViewports] = true;
+    flags[Dirty::RescaleScissors] = true;
+}
+
+template <class P>
+void TextureCache<P>::ReleaseScaledImages() {
+    for (auto [image_id, image] : slot_images) {
+        if (!image->HasScaled()) {
+            continue;
+        }
+        total_used_memory -= GetScaledImageSizeBytes(*image);
+        memory_account.Subtract(GetScaledImageSizeBytes(*image));
+        image->ReleaseScaled();
+    }
+}
+
 template <class P>
 void TextureCache<P>::UpdateRenderTargets(bool is_clear) {
     using namespace VideoCommon::Dirty;
@@ -583,13 +688,44 @@ FramebufferId TextureCache<P>::GetFramebufferId(const RenderTargets& key) {
 
 template <class P>
 void TextureCache<P>::WriteMemory(DAddr cpu_addr, size_t size) {
-    ForEachImageInRegion(cpu_addr, size, [this](ImageId image_id, Image& image) {
-        if (True(image.flags & ImageFlagBits::CpuModified)) {
+    ForEachImageInRegion(cpu_addr, size, [this, cpu_addr, size](ImageId image_id, Image& image) {
+        if (True(image.flags & ImageFlagBits::CpuModified) && !image.HasPartialCpuModification()) {
             return;
         }
         image.flags |= ImageFlagBits::CpuModified;
-        if (True(image.flags & ImageFlagBits::Tracked)) {
+        if (False(image.flags & ImageFlagBits::Tracked)) {
+            return;
+        }
+        if (!CanTrackPartialWrites(image)) {
             UntrackImage(image, image_id);
+            return;
+        }
+        // Only stop tracking the written pages, so the next refresh can skip the levels and
+        // layers that are still the same as in guest memory
+        const VAddr begin =
+            (std::max)(Common::AlignDown(cpu_addr, Core::DEVICE_PAGESIZE), image.cpu_addr);
+        const VAddr end =
+            (std::min)(Common::AlignUp(cpu_addr + size, Core::DEVICE_PAGESIZE), image.cpu_addr_end);
+        if (!image.HasPartialCpuModification()) {
+            device_memory.UpdatePagesCachedCount(begin, end - begin, -1);
+            image.cpu_dirty_begin = begin;
+            image.cpu_dirty_end = end;
+        } else {
+            if (begin < image.cpu_dirty_begin) {
+                device_memory.UpdatePagesCachedCount(begin, image.cpu_dirty_begin - begin, -1);
+                image.cpu_dirty_begin = begin;
+            }
+            if (end > image.cpu_dirty_end) {
+                device_memory.UpdatePagesCachedCount(image.cpu_dirty_end, end - image.cpu_dirty_end,
+                                                     -1);
+                image.cpu_dirty_end = end;
+            }
+        }
+        if (image.cpu_dirty_begin == image.cpu_addr && image.cpu_dirty_end == image.cpu_addr_end) {
+            // Every page is untracked already
+            image.flags &= ~ImageFlagBits::Tracked;
+            image.cpu_dirty_begin = 0;
+            image.cpu_dirty_end = 0;
         }
     });
 }
@@ -637,10 +773,6 @@ std::optional<VideoCore::RasterizerDownloadArea> TextureCache<P>::GetFlushArea(D
         }
         area->start_address = (std::min)(area->start_address, image.cpu_addr);
         area->end_address = (std::max)(area->end_address, image.cpu_addr_end);
-        for (auto image_view_id : image.image_view_ids) {
-            auto& image_view = slot_image_views[image_view_id];
-            image_view.flags |= ImageViewFlagBits::PreemtiveDownload;
-        }
         area->preemtive &= image.info.forced_flushed;
         image.info.forced_flushed = true;
     });
@@ -668,7 +800,7 @@ void TextureCache<P>::UnmapGPUMemory(size_t as_id, GPUVAddr gpu_addr, size_t siz
                             [&](ImageId id, Image&) { deleted_images.push_back(id); });
     for (const ImageId id : deleted_images) {
         Image& image = slot_images[id];
-        if (False(image.flags & ImageFlagBits::CpuModified)) {
+        if (False(image.flags & ImageFlagBits::CpuModified) || image.HasPartialCpuModification()) {
             image.flags |= ImageFlagBits::CpuModified;
             if (True(image.flags & ImageFlagBits::Tracked)) {
                 UntrackImage(image, id);
@@ -787,18 +919,17 @@ std::pair<typename P::ImageView*, bool> TextureCache<P>::TryFindFramebufferImage
     if (it == page_table.end()) {
         return {};
     }
-    const auto& image_map_ids = it->second;
+    const auto& entries = it->second;
     boost::container::small_vector<ImageId, 4> valid_image_ids;
-    for (const ImageMapId map_id : image_map_ids) {
-        const ImageMapView& map = slot_map_views[map_id];
-        const ImageBase& image = slot_images[map.image_id];
+    for (const ImageMapPageEntry& entry : entries) {
+        const ImageBase& image = slot_images[entry.image_id];
         if (image.cpu_addr != cpu_addr) {
             continue;
         }
         if (image.image_view_ids.empty()) {
             continue;
         }
-        valid_image_ids.push_back(map.image_id);
+        valid_image_ids.push_back(entry.image_id);
     }
 
     const auto view_format = [&]() {
@@ -850,6 +981,13 @@ bool TextureCache<P>::ShouldWaitAsyncFlushes() const noexcept {
 
 template <class P>
 void TextureCache<P>::CommitAsyncFlushes() {
+    for (PendingDownload& download_info : uncommitted_downloads) {
+        if (download_info.is_swizzle) {
+            ImageBase& image = slot_images[download_info.object_id];
+            image.flags &= ~ImageFlagBits::DownloadQueued;
+            download_info.modification_tick = image.modification_tick;
+        }
+    }
     // This is intentionally passing the value by copy
     if constexpr (IMPLEMENTS_ASYNC_DOWNLOADS) {
         auto& download_ids = uncommitted_downloads;
@@ -909,12 +1047,13 @@ void TextureCache<P>::PopAsyncFlushes() {
             auto& download_info = download_ids[i - 1];
             auto& download_buffer = download_map[download_info.async_buffer_id];
             if (download_info.is_swizzle) {
-                const ImageBase& image = slot_images[download_info.object_id];
+                ImageBase& image = slot_images[download_info.object_id];
                 const auto copies = FixSmallVectorADL(FullDownloadCopies(image.info));
                 download_buffer.offset -= Common::AlignUp(image.unswizzled_size_bytes, 64);
                 std::span<u8> download_span =
                     download_buffer.mapped_span.subspan(download_buffer.offset);
                 SwizzleImage(*gpu_memory, image.gpu_addr, image.info, copies, download_span, swizzle_data_buffer);
+                MarkDownloaded(image, download_info.modification_tick);
             } else {
                 const BufferDownload& buffer_info = slot_buffer_downloads[download_info.object_id];
                 std::span<u8> download_span =
@@ -960,9 +1099,10 @@ void TextureCache<P>::PopAsyncFlushes() {
             if (!download_info.is_swizzle) {
                 continue;
             }
-            const ImageBase& image = slot_images[download_info.object_id];
+            ImageBase& image = slot_images[download_info.object_id];
             const auto copies = FixSmallVectorADL(FullDownloadCopies(image.info));
             SwizzleImage(*gpu_memory, image.gpu_addr, image.info, copies, download_span, swizzle_data_buffer);
+            MarkDownloaded(image, download_info.modification_tick);
             download_map.offset += image.unswizzled_size_bytes;
             download_span = download_span.subspan(image.unswizzled_size_bytes);
         }
@@ -1102,9 +1242,23 @@ void TextureCache<P>::RefreshContents(Image& image, ImageId image_id) {
         return;
     }
 
-    image.flags &= ~ImageFlagBits::CpuModified;
+    if (image.HasPartialCpuModification()) {
+        const VAddr begin = image.cpu_dirty_begin;
+        const VAddr end = image.cpu_dirty_end;
+        device_memory.UpdatePagesCachedCount(begin, end - begin, 1);
+        image.cpu_dirty_begin = 0;
+        image.cpu_dirty_end = 0;
+        image.flags &= ~ImageFlagBits::CpuModified;
 
-    TrackImage(image, image_id);
+        const SubresourceRange range = image.FindSubresourceRange(
+            static_cast<u32>(begin - image.cpu_addr), static_cast<u32>(end - begin));
+        if (UploadImageSubresources(image, range)) {
+            return;
+        }
+    } else {
+        image.flags &= ~ImageFlagBits::CpuModified;
+        TrackImage(image, image_id);
+    }
 
     if (image.info.num_samples > 1 && !runtime.CanUploadMSAA()) {
         LOG_WARNING(HW_GPU, "MSAA image uploads are not implemented");
@@ -1161,6 +1315,50 @@ void TextureCache<P>::UploadImageContents(Image& image, StagingBuffer& staging)
     }
 }
 
+template <class P>
+bool TextureCache<P>::CanTrackPartialWrites(const ImageBase& image) const noexcept {
+    constexpr auto whole_image_uploads = ImageFlagBits::Sparse | ImageFlagBits::Converted |
+                                         ImageFlagBits::AcceleratedUpload |
+                                         ImageFlagBits::AsynchronousDecode;
+    if (True(image.flags & whole_image_uploads)) {
+        return false;
+    }
+    if (image.info.type != ImageType::e2D || image.info.num_samples != 1) {
+        return false;
+    }
+    if (image.info.resources.levels == 1 && image.info.resources.layers == 1) {
+        return false;
+    }
+    return image.cpu_addr < ~(1ULL << 40);
+}
+
+template <class P>
+bool TextureCache<P>::UploadImageSubresources(Image& image, const SubresourceRange& range) {
+    const ImageInfo& info = image.info;
+    if (range.extent.levels == info.resources.levels &&
+        range.extent.layers == info.resources.layers) {
+        return false;
+    }
+    if (True(image.flags & ImageFlagBits::Rescaled) ||
+        info.layer_stride != CalculateLayerStride(info)) {
+        // Rescaled images are scaled down as a whole before an upload
+        return false;
+    }
+    const u32 guest_offset = static_cast<u32>(range.base.layer) * info.layer_stride;
+    const u32 guest_size = (std::min)(static_cast<u32>(range.extent.layers) * info.layer_stride,
+                                      image.guest_size_bytes - guest_offset);
+
+    // The staging buffer keeps the size of a full upload, some runtimes flush all of it
+    auto staging = runtime.UploadStagingBuffer(MapSizeBytes(image));
+    Tegra::Memory::GpuGuestMemory<u8, Tegra::Memory::GuestMemoryFlags::UnsafeRead> swizzle_data(
+        *gpu_memory, image.gpu_addr + guest_offset, guest_size, &swizzle_data_buffer);
+    const auto copies =
+        FixSmallVectorADL(UnswizzleSubresources(info, range, swizzle_data, staging.mapped_span));
+    image.UploadMemory(staging, copies);
+    runtime.InsertUploadMemoryBarrier();
+    return true;
+}
+
 template <class P>
 ImageViewId TextureCache<P>::CreateImageView(const TICEntry& config) {
     const ImageInfo info(config);
@@ -1336,14 +1534,38 @@ void TextureCache<P>::QueueAsyncDecode(Image& image, ImageId image_id) {
     decode->image_id = image_id;
     async_decodes.push_back(std::move(decode));
 
+    // Only snapshot guest memory on the GPU thread, linear images are read straight into the
+    // unswizzled buffer. Unswizzling and decoding happen on the worker.
+    const bool is_linear = image.info.type == ImageType::Linear;
+    std::vector<u8> guest_data(is_linear ? 0 : image.guest_size_bytes);
     std::vector<u8> local_unswizzle_data_buffer(image.unswizzled_size_bytes, 0);
-    Tegra::Memory::GpuGuestMemory<u8, Tegra::Memory::GuestMemoryFlags::UnsafeRead> swizzle_data(*gpu_memory, image.gpu_addr, image.guest_size_bytes, &swizzle_data_buffer);
-    auto copies = UnswizzleImage(*gpu_memory, image.gpu_addr, image.info, swizzle_data, local_unswizzle_data_buffer);
+    boost::container::small_vector<BufferImageCopy, 16> copies;
+    if (is_linear) {
+        Tegra::Memory::GpuGuestMemory<u8, Tegra::Memory::GuestMemoryFlags::UnsafeRead>
+            swizzle_data(*gpu_memory, image.gpu_addr, image.guest_size_bytes,
+                         &swizzle_data_buffer);
+        copies = UnswizzleImage(*gpu_memory, image.gpu_addr, image.info, swizzle_data,
+                                local_unswizzle_data_buffer);
+    } else {
+        gpu_memory->ReadBlockUnsafe(image.gpu_addr, guest_data.data(), guest_data.size());
+    }
     const size_t out_size = MapSizeBytes(image);
 
-    auto func = [out_size, copies, info = image.info,
+    auto func = [out_size, copies = std::move(copies), info = image.info,
+                 guest_data = std::move(guest_data),
                  input = std::move(local_unswizzle_data_buffer),
                  async_decode = decode_ptr]() mutable {
+        if (info.type != ImageType::Linear) {
+            copies = UnswizzleSubresources(info,
+                                           SubresourceRange{
+                                               .base{},
+                                               .extent{
+                                                   .levels = info.resources.levels,
+                                                   .layers = info.resources.layers,
+                                               },
+                                           },
+                                           guest_data, input);
+        }
         async_decode->decoded_data.resize_destructive(out_size);
         std::span copies_span{copies.data(), copies.size()};
         ConvertImage(input, info, async_decode->decoded_data, copies_span);
@@ -1481,6 +1703,7 @@ bool TextureCache<P>::ScaleUp(Image& image) {
     }
     if (!has_copy) {
         total_used_memory += GetScaledImageSizeBytes(image);
+        memory_account.Add(GetScaledImageSizeBytes(image));
     }
     InvalidateScale(image);
     return true;
@@ -2015,28 +2238,29 @@ void TextureCache<P>::ForEachImageInRegion(DAddr cpu_addr, size_t size, Func&& f
                 return;
             }
         }
-        for (const ImageMapId map_id : it->second) {
-            ImageMapView& map = slot_map_views[map_id];
-            if (map.picked) {
+        for (const ImageMapPageEntry& entry : it->second) {
+            if (!entry.Overlaps(cpu_addr, size)) {
                 continue;
             }
-            if (!map.Overlaps(cpu_addr, size)) {
+            ImageMapView& map = slot_map_views[entry.map_id];
+            if (map.picked) {
                 continue;
             }
             map.picked = true;
-            maps.push_back(map_id);
-            Image& image = slot_images[map.image_id];
-            if (True(image.flags & ImageFlagBits::Picked)) {
+            maps.push_back(entry.map_id);
+            ImageHotFields& hot = slot_images.GetHot(entry.image_id);
+            if (hot.picked) {
                 continue;
             }
-            image.flags |= ImageFlagBits::Picked;
-            images.push_back(map.image_id);
+            hot.picked = true;
+            images.push_back(entry.image_id);
+            Image& image = slot_images[entry.image_id];
             if constexpr (BOOL_BREAK) {
-                if (func(map.image_id, image)) {
+                if (func(entry.image_id, image)) {
                     return true;
                 }
             } else {
-                func(map.image_id, image);
+                func(entry.image_id, image);
             }
         }
         if constexpr (BOOL_BREAK) {
@@ -2044,7 +2268,7 @@ void TextureCache<P>::ForEachImageInRegion(DAddr cpu_addr, size_t size, Func&& f
         }
     });
     for (const ImageId image_id : images) {
-        slot_images[image_id].flags &= ~ImageFlagBits::Picked;
+        slot_images.GetHot(image_id).picked = false;
     }
     for (const ImageMapId map_id : maps) {
         slot_map_views[map_id].picked = false;
@@ -2074,15 +2298,13 @@ void TextureCache<P>::ForEachImageInRegionGPU(size_t as_id, GPUVAddr gpu_addr, s
                            }
                        }
                        for (const ImageId image_id : it->second) {
-                           Image& image = slot_images[image_id];
-                           if (True(image.flags & ImageFlagBits::Picked)) {
-                               continue;
-                           }
-                           if (!image.OverlapsGPU(gpu_addr, size)) {
+                           ImageHotFields& hot = slot_images.GetHot(image_id);
+                           if (hot.picked || !hot.OverlapsGPU(gpu_addr, size)) {
                                continue;
                            }
-                           image.flags |= ImageFlagBits::Picked;
+                           hot.picked = true;
                            images.push_back(image_id);
+                           Image& image = slot_images[image_id];
                            if constexpr (BOOL_BREAK) {
                                if (func(image_id, image)) {
                                    return true;
@@ -2096,7 +2318,7 @@ void TextureCache<P>::ForEachImageInRegionGPU(size_t as_id, GPUVAddr gpu_addr, s
                        }
                    });
     for (const ImageId image_id : images) {
-        slot_images[image_id].flags &= ~ImageFlagBits::Picked;
+        slot_images.GetHot(image_id).picked = false;
     }
 }
 
@@ -2123,15 +2345,13 @@ void TextureCache<P>::ForEachSparseImageInRegion(size_t as_id, GPUVAddr gpu_addr
                            }
                        }
                        for (const ImageId image_id : it->second) {
-                           Image& image = slot_images[image_id];
-                           if (True(image.flags & ImageFlagBits::Picked)) {
-                               continue;
-                           }
-                           if (!image.OverlapsGPU(gpu_addr, size)) {
+                           ImageHotFields& hot = slot_images.GetHot(image_id);
+                           if (hot.picked || !hot.OverlapsGPU(gpu_addr, size)) {
                                continue;
                            }
-                           image.flags |= ImageFlagBits::Picked;
+                           hot.picked = true;
                            images.push_back(image_id);
+                           Image& image = slot_images[image_id];
                            if constexpr (BOOL_BREAK) {
                                if (func(image_id, image)) {
                                    return true;
@@ -2145,7 +2365,7 @@ void TextureCache<P>::ForEachSparseImageInRegion(size_t as_id, GPUVAddr gpu_addr
                        }
                    });
     for (const ImageId image_id : images) {
-        slot_images[image_id].flags &= ~ImageFlagBits::Picked;
+        slot_images.GetHot(image_id).picked = false;
     }
 }
 
@@ -2192,6 +2412,7 @@ void TextureCache<P>::RegisterImage(ImageId image_id) {
         tentative_size = TranscodedAstcSize(tentative_size, image.info.format);
     }
     total_used_memory += Common::AlignUp(tentative_size, 1024);
+    memory_account.Add(Common::AlignUp(tentative_size, 1024));
     image.lru_index = lru_cache.Insert(image_id, frame_tick);
 
     ForEachGPUPage(image.gpu_addr, image.guest_size_bytes, [this, image_id](u64 page) {
@@ -2200,8 +2421,7 @@ void TextureCache<P>::RegisterImage(ImageId image_id) {
     if (False(image.flags & ImageFlagBits::Sparse)) {
         auto map_id =
             slot_map_views.insert(image.gpu_addr, image.cpu_addr, image.guest_size_bytes, image_id);
-        ForEachCPUPage(image.cpu_addr, image.guest_size_bytes,
-                       [this, map_id](u64 page) { page_table[page].push_back(map_id); });
+        RegisterMapView(map_id, image_id, image.cpu_addr, image.guest_size_bytes);
         image.map_view_id = map_id;
         return;
     }
@@ -2209,8 +2429,7 @@ void TextureCache<P>::RegisterImage(ImageId image_id) {
     ForEachSparseSegment(
         image, [this, image_id, &sparse_maps](GPUVAddr gpu_addr, DAddr cpu_addr, size_t size) {
             auto map_id = slot_map_views.insert(gpu_addr, cpu_addr, size, image_id);
-            ForEachCPUPage(cpu_addr, size,
-                           [this, map_id](u64 page) { page_table[page].push_back(map_id); });
+            RegisterMapView(map_id, image_id, cpu_addr, size);
             sparse_maps.push_back(map_id);
         });
     sparse_views.emplace(image_id, std::move(sparse_maps));
@@ -2219,6 +2438,18 @@ void TextureCache<P>::RegisterImage(ImageId image_id) {
     });
 }
 
+template <class P>
+void TextureCache<P>::RegisterMapView(ImageMapId map_id, ImageId image_id, DAddr cpu_addr,
+                                      size_t size) {
+    const ImageMapPageEntry entry{
+        .map_id = map_id,
+        .image_id = image_id,
+        .cpu_addr = cpu_addr,
+        .cpu_addr_end = cpu_addr + size,
+    };
+    ForEachCPUPage(cpu_addr, size, [this, &entry](u64 page) { page_table[page].push_back(entry); });
+}
+
 template <class P>
 void TextureCache<P>::UnregisterImage(ImageId image_id) {
     Image& image = slot_images[image_id];
@@ -2254,14 +2485,14 @@ void TextureCache<P>::UnregisterImage(ImageId image_id) {
                 ASSERT_MSG(false, "Unregistering unregistered page=0x{:x}", page << YUZU_PAGEBITS);
                 return;
             }
-            std::vector<ImageMapId>& image_map_ids = page_it->second;
-            const auto vector_it = std::ranges::find(image_map_ids, map_id);
-            if (vector_it == image_map_ids.end()) {
+            std::vector<ImageMapPageEntry>& entries = page_it->second;
+            const auto vector_it = std::ranges::find(entries, map_id, &ImageMapPageEntry::map_id);
+            if (vector_it == entries.end()) {
                 ASSERT_MSG(false, "Unregistering unregistered image in page=0x{:x}",
                            page << YUZU_PAGEBITS);
                 return;
             }
-            image_map_ids.erase(vector_it);
+            entries.erase(vector_it);
         });
         slot_map_views.erase(map_id);
         return;
@@ -2282,18 +2513,18 @@ void TextureCache<P>::UnregisterImage(ImageId image_id) {
                 ASSERT_MSG(false, "Unregistering unregistered page=0x{:x}", page << YUZU_PAGEBITS);
                 return;
             }
-            std::vector<ImageMapId>& image_map_ids = page_it->second;
-            auto vector_it = image_map_ids.begin();
-            while (vector_it != image_map_ids.end()) {
-                ImageMapView& map = slot_map_views[*vector_it];
-                if (map.image_id != image_id) {
+            std::vector<ImageMapPageEntry>& entries = page_it->second;
+            auto vector_it = entries.begin();
+            while (vector_it != entries.end()) {
+                if (vector_it->image_id != image_id) {
                     vector_it++;
                     continue;
                 }
+                ImageMapView& map = slot_map_views[vector_it->map_id];
                 if (!map.picked) {
                     map.picked = true;
                 }
-                vector_it = image_map_ids.erase(vector_it);
+                vector_it = entries.erase(vector_it);
             }
         });
         slot_map_views.erase(map_view_id);
@@ -2333,6 +2564,20 @@ template <class P>
 void TextureCache<P>::UntrackImage(ImageBase& image, ImageId image_id) {
     ASSERT(True(image.flags & ImageFlagBits::Tracked));
     image.flags &= ~ImageFlagBits::Tracked;
+    if (image.HasPartialCpuModification()) {
+        // The written pages were untracked already
+        if (image.cpu_dirty_begin != image.cpu_addr) {
+            device_memory.UpdatePagesCachedCount(image.cpu_addr,
+                                                 image.cpu_dirty_begin - image.cpu_addr, -1);
+        }
+        if (image.cpu_dirty_end != image.cpu_addr_end) {
+            device_memory.UpdatePagesCachedCount(image.cpu_dirty_end,
+                                                 image.cpu_addr_end - image.cpu_dirty_end, -1);
+        }
+        image.cpu_dirty_begin = 0;
+        image.cpu_dirty_end = 0;
+        return;
+    }
     if (False(image.flags & ImageFlagBits::Sparse)) {
         if (image.cpu_addr < ~(1ULL << 40)) {
             device_memory.UpdatePagesCachedCount(image.cpu_addr, image.guest_size_bytes, -1);
@@ -2356,6 +2601,7 @@ void TextureCache<P>::DeleteImage(ImageId image_id, bool immediate_delete) {
     ImageBase& image = slot_images[image_id];
     if (image.HasScaled()) {
         total_used_memory -= GetScaledImageSizeBytes(image);
+        memory_account.Subtract(GetScaledImageSizeBytes(image));
     }
     u64 tentative_size = (std::max)(image.guest_size_bytes, image.unswizzled_size_bytes);
     if ((IsPixelFormatASTC(image.info.format) &&
@@ -2364,6 +2610,7 @@ void TextureCache<P>::DeleteImage(ImageId image_id, bool immediate_delete) {
         tentative_size = TranscodedAstcSize(tentative_size, image.info.format);
     }
     total_used_memory -= Common::AlignUp(tentative_size, 1024);
+    memory_account.Subtract(Common::AlignUp(tentative_size, 1024));
     const GPUVAddr gpu_addr = image.gpu_addr;
     const auto alloc_it = image_allocs_table.find(gpu_addr);
     if (alloc_it == image_allocs_table.end()) {
@@ -2380,6 +2627,11 @@ void TextureCache<P>::DeleteImage(ImageId image_id, bool immediate_delete) {
     }
     ASSERT_MSG(False(image.flags & ImageFlagBits::Tracked), "Image was not untracked");
     ASSERT_MSG(False(image.flags & ImageFlagBits::Registered), "Image was not unregistered");
+    if (True(image.flags & ImageFlagBits::DownloadQueued)) {
+        std::erase_if(uncommitted_downloads, [image_id](const PendingDownload& download) {
+            return download.is_swizzle && download.object_id == image_id;
+        });
+    }
 
     // Mark render targets as dirty
     auto& dirty = maxwell3d->dirty.flags;
@@ -2479,9 +2731,24 @@ void TextureCache<P>::RemoveFramebuffers(std::span<const ImageViewId> removed_vi
 }
 
 template <class P>
-void TextureCache<P>::MarkModification(ImageBase& image) noexcept {
+void TextureCache<P>::MarkModification(ImageId image_id, ImageBase& image) noexcept {
     image.flags |= ImageFlagBits::GpuModified;
     image.modification_tick = ++modification_tick;
+    // Images the CPU reads back are downloaded at the next fence, whichever way the GPU wrote
+    // them, so the read finds the contents already in guest memory.
+    if (image.info.forced_flushed && False(image.flags & ImageFlagBits::DownloadQueued) &&
+        image.IsSafeDownload()) {
+        image.flags |= ImageFlagBits::DownloadQueued;
+        uncommitted_downloads.emplace_back(PendingDownload{true, 0, image_id});
+    }
+}
+
+template <class P>
+void TextureCache<P>::MarkDownloaded(ImageBase& image, u64 download_tick) noexcept {
+    // Guest memory holds the contents now, unless the GPU wrote to the image after the download
+    if (image.modification_tick == download_tick) {
+        image.flags &= ~ImageFlagBits::GpuModified;
+    }
 }
 
 template <class P>
@@ -2541,6 +2808,12 @@ template <class P>
 void TextureCache<P>::PrepareImage(ImageId image_id, bool is_modification, bool invalidate) {
     Image& image = slot_images[image_id];
     if (invalidate) {
+        if (image.HasPartialCpuModification()) {
+            device_memory.UpdatePagesCachedCount(
+                image.cpu_dirty_begin, image.cpu_dirty_end - image.cpu_dirty_begin, 1);
+            image.cpu_dirty_begin = 0;
+            image.cpu_dirty_end = 0;
+        }
         image.flags &= ~(ImageFlagBits::CpuModified | ImageFlagBits::GpuModified);
         if (False(image.flags & ImageFlagBits::Tracked)) {
             TrackImage(image, image_id);
@@ -2552,7 +2825,7 @@ void TextureCache<P>::PrepareImage(ImageId image_id, bool is_modification, bool
         }
     }
     if (is_modification) {
-        MarkModification(image);
+        MarkModification(image_id, image);
     }
     lru_cache.Touch(image.lru_index, frame_tick);
 }
@@ -2663,13 +2936,6 @@ void TextureCache<P>::BindRenderTarget(ImageViewId* old_id, ImageViewId new_id)
     if (*old_id == new_id) {
         return;
     }
-    if (new_id) {
-        const ImageViewBase& old_view = slot_image_views[new_id];
-        if (True(old_view.flags & ImageViewFlagBits::PreemtiveDownload)) {
-            const PendingDownload new_download{true, 0, old_view.image_id};
-            uncommitted_downloads.emplace_back(new_download);
-        }
-    }
     *old_id = new_id;
 }
 
@@ -24,6 +24,7 @@
 #include "common/hash.h"
 #include "common/literals.h"
 #include "common/lru_cache.h"
+#include "common/memory_accounting.h"
 #include <ranges>
 #include "common/scratch_buffer.h"
 #include "common/slot_vector.h"
@@ -108,6 +109,8 @@ class TextureCache : public VideoCommon::ChannelSetupCaches<TextureCacheChannelI
     static constexpr bool HAS_DEVICE_MEMORY_INFO = P::HAS_DEVICE_MEMORY_INFO;
     /// True when the API can do asynchronous texture downloads.
     static constexpr bool IMPLEMENTS_ASYNC_DOWNLOADS = P::IMPLEMENTS_ASYNC_DOWNLOADS;
+    /// True when the runtime can destroy retired objects on another thread.
+    static constexpr bool HAS_BACKGROUND_DESTRUCTION = P::HAS_BACKGROUND_DESTRUCTION;
 
     static constexpr size_t UNSET_CHANNEL{(std::numeric_limits<size_t>::max)()};
 
@@ -120,6 +123,11 @@ class TextureCache : public VideoCommon::ChannelSetupCaches<TextureCacheChannelI
     static constexpr s64 DEFAULT_EXPECTED_MEMORY = 1_GiB + 125_MiB;
     static constexpr s64 DEFAULT_CRITICAL_MEMORY = 1_GiB + 625_MiB;
     static constexpr size_t GC_EMERGENCY_COUNTS = 2;
+    /// Bytes of dirty images the garbage collector may write back per frame
+    static constexpr u64 EVICTION_DOWNLOAD_BUDGET = 32_MiB;
+    static constexpr u64 EVICTION_DOWNLOAD_BUDGET_CRITICAL = 128_MiB;
+    /// Driver budget changes smaller than this do not recompute the collector thresholds
+    static constexpr u64 MEMORY_BUDGET_GRANULARITY = 64_MiB;
 
     using Runtime = typename P::Runtime;
     using Image = typename P::Image;
@@ -141,6 +149,13 @@ class TextureCache : public VideoCommon::ChannelSetupCaches<TextureCacheChannelI
         bool initialized = false;
     };
 
+    struct PendingEviction {
+        ImageId image_id;
+        AsyncBuffer staging_buffer;
+        std::vector<BufferImageCopy> copies;
+        bool immediate_delete;
+    };
+
     struct BlitImages {
         ImageId dst_id;
         ImageId src_id;
@@ -151,9 +166,23 @@ class TextureCache : public VideoCommon::ChannelSetupCaches<TextureCacheChannelI
 public:
     explicit TextureCache(Runtime&, Tegra::MaxwellDeviceMemoryManager&);
 
+    struct EvictionStats {
+        u32 images = 0;
+        u32 downloads = 0;
+        u64 download_bytes = 0;
+    };
+
     /// Notify the cache that a new frame has been queued
     void TickFrame();
 
+    /// Return what the garbage collector evicted during the last frame
+    [[nodiscard]] const EvictionStats& LastFrameEvictions() const noexcept {
+        return eviction_stats;
+    }
+
+    /// Return a constant reference to the given image id
+    [[nodiscard]] const Image& GetImage(ImageId id) const noexcept;
+
     /// Return a constant reference to the given image view id
     [[nodiscard]] const ImageView& GetImageView(ImageViewId id) const noexcept;
 
@@ -191,6 +220,12 @@ public:
     /// @retval True if the Render Targets have been rescaled.
     bool RescaleRenderTargets();
 
+    /// Scale every rescaled image back down to its original size
+    void ScaleDownImages();
+
+    /// Free the scaled copies of the images, the GPU must not be using them anymore
+    void ReleaseScaledImages();
+
     /// Update bound render targets and upload memory if necessary
     /// @param is_clear True when the render targets are being used for clears
     void UpdateRenderTargets(bool is_clear);
@@ -293,9 +328,15 @@ private:
 
     void OnGPUASRegister(size_t map_id) final override;
 
+    /// Derives the garbage collector thresholds from the available video memory
+    void ConfigureMemoryThresholds(u64 memory_budget);
+
     /// Runs the Garbage Collector.
     void RunGarbageCollector();
 
+    /// Writes back the images downloaded by the garbage collector and deletes them
+    void FinishPendingEvictions();
+
     /// Find or create an image view in the guest descriptor table
     ImageViewId VisitImageView(u32 index, bool compute);
 
@@ -309,6 +350,13 @@ private:
     template <typename StagingBuffer>
     void UploadImageContents(Image& image, StagingBuffer& staging_buffer);
 
+    /// Returns true when CPU writes to an image can be tracked by the pages they touch
+    [[nodiscard]] bool CanTrackPartialWrites(const ImageBase& image) const noexcept;
+
+    /// Upload some levels and layers of an image from guest memory
+    /// @returns False when the image has to be uploaded as a whole
+    bool UploadImageSubresources(Image& image, const SubresourceRange& range);
+
     /// Create a new image view from a guest descriptor
     [[nodiscard]] ImageViewId CreateImageView(const TICEntry& config);
 
@@ -367,6 +415,9 @@ private:
     /// Register image in the page table
     void RegisterImage(ImageId image);
 
+    /// Register a map view of an image in the CPU pages it covers
+    void RegisterMapView(ImageMapId map_id, ImageId image_id, DAddr cpu_addr, size_t size);
+
     /// Unregister image from the page table
     void UnregisterImage(ImageId image);
 
@@ -386,7 +437,10 @@ private:
     void RemoveFramebuffers(std::span<const ImageViewId> removed_views);
 
     /// Mark an image as modified from the GPU
-    void MarkModification(ImageBase& image) noexcept;
+    void MarkModification(ImageId image_id, ImageBase& image) noexcept;
+
+    /// Mark an image as synced with guest memory after an asynchronous download
+    void MarkDownloaded(ImageBase& image, u64 download_tick) noexcept;
 
     /// Synchronize image aliases, copying data if needed
     void SynchronizeAliases(ImageId image_id);
@@ -443,7 +497,8 @@ private:
     u64 last_framebuffer_serial = 0;
 
     ankerl::unordered_dense::map<RenderTargets, FramebufferId> framebuffers;
-    ankerl::unordered_dense::map<u64, std::vector<ImageMapId>, Common::IdentityHash<u64>> page_table;
+    ankerl::unordered_dense::map<u64, std::vector<ImageMapPageEntry>, Common::IdentityHash<u64>>
+        page_table;
     ankerl::unordered_dense::map<ImageId, boost::container::small_vector<ImageViewId, 16>> sparse_views;
 
     DAddr virtual_invalid_space{};
@@ -451,9 +506,13 @@ private:
     bool has_deleted_images = false;
     bool is_rescaling = false;
     u64 total_used_memory = 0;
+    Common::MemoryAccounting::Account memory_account{Common::MemoryAccounting::Tag::TextureCache};
     u64 minimum_memory;
     u64 expected_memory;
     u64 critical_memory;
+    u64 memory_budget_tracked = 0;
+    EvictionStats eviction_stats;
+    std::vector<PendingEviction> pending_evictions;
     size_t gpu_unswizzle_maxsize = 0;
     size_t swizzle_chunk_size = 0;
     u32 swizzle_slices_per_batch = 0;
@@ -467,9 +526,11 @@ private:
         bool is_swizzle;
         size_t async_buffer_id;
         Common::SlotId object_id;
+        /// Modification tick of the image when the download was recorded
+        u64 modification_tick{};
     };
 
-    Common::SlotVector<Image> slot_images;
+    Common::PackedSlotVector<Image, ImageHotFields> slot_images;
     Common::SlotVector<ImageMapView> slot_map_views;
     Common::SlotVector<ImageView> slot_image_views;
     Common::SlotVector<ImageAlloc> slot_image_allocs;
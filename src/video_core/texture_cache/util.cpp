@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
@@ -11,16 +11,24 @@
 
 #include <algorithm>
 #include <array>
+#include <cstring>
+#include <list>
+#include <mutex>
 #include <numeric>
 #include <optional>
 #include <span>
 #include <vector>
 
+#include <ankerl/unordered_dense.h>
+
 #include "common/alignment.h"
 #include "common/assert.h"
 #include "common/bit_util.h"
+#include "common/cityhash.h"
 #include "common/common_types.h"
 #include "common/div_ceil.h"
+#include "common/hash.h"
+#include "common/literals.h"
 #include "common/scratch_buffer.h"
 #include "common/settings.h"
 #include "video_core/compatible_formats.h"
@@ -293,6 +301,44 @@ template <u32 GOB_EXTENT>
     return offset;
 }
 
+struct LevelLayoutKey {
+    PixelFormat format;
+    Extent3D size;
+    Extent3D block;
+    u32 tile_width_spacing;
+    u32 num_levels;
+
+    bool operator==(const LevelLayoutKey&) const noexcept = default;
+};
+
+/// Returns the guest size of each mip level, memoised per thread as most images share a handful
+/// of shapes and the per level tile arithmetic is otherwise redone on every cache lookup
+[[nodiscard]] LevelArray CachedLevelSizes(const ImageInfo& info) {
+    struct Entry {
+        LevelLayoutKey key;
+        LevelArray sizes;
+        bool valid;
+    };
+    static constexpr size_t NUM_ENTRIES = 256;
+    thread_local std::array<Entry, NUM_ENTRIES> cache{};
+
+    const LevelLayoutKey key{
+        .format = info.format,
+        .size = info.size,
+        .block = info.block,
+        .tile_width_spacing = info.tile_width_spacing,
+        .num_levels = static_cast<u32>(info.resources.levels),
+    };
+    const u64 hash = Common::Hash::HashObject(key);
+    Entry& entry = cache[hash % NUM_ENTRIES];
+    if (!entry.valid || entry.key != key) {
+        entry.key = key;
+        entry.sizes = CalculateLevelSizes(MakeLevelInfo(info), key.num_levels);
+        entry.valid = true;
+    }
+    return entry.sizes;
+}
+
 [[nodiscard]] constexpr u32 AlignLayerSize(u32 size_bytes, Extent3D size, Extent3D block,
                                            u32 tile_size_y, u32 tile_width_spacing) {
     // https://github.com/Ryujinx/Ryujinx/blob/1c9aba6de1520aea5480c032e0ff5664ac1bb36f/Ryujinx.Graphics.Texture/SizeCalculator.cs#L134
@@ -551,7 +597,7 @@ void SwizzleBlockLinearImage(Tegra::MemoryManager& gpu_memory, GPUVAddr gpu_addr
     size_t host_offset = copy.buffer_offset;
 
     const u32 num_levels = info.resources.levels;
-    const std::array sizes = CalculateLevelSizes(level_info, num_levels);
+    const std::array sizes = CachedLevelSizes(info);
     size_t guest_offset = CalculateLevelBytes(sizes, level);
     const size_t layer_stride =
         AlignLayerSize(CalculateLevelBytes(sizes, num_levels), size, level_info.block,
@@ -638,8 +684,12 @@ u32 CalculateLayerStride(const ImageInfo& info) noexcept {
 
 u32 CalculateLayerSize(const ImageInfo& info) noexcept {
     ASSERT(info.type != ImageType::Linear);
+    const u32 num_levels = info.resources.levels;
+    if (num_levels <= MAX_MIP_LEVELS) {
+        return CalculateLevelBytes(CachedLevelSizes(info), num_levels);
+    }
     return CalculateLevelOffset(info.format, info.size, info.block, info.tile_width_spacing,
-                                info.resources.levels);
+                                num_levels);
 }
 
 LevelArray CalculateMipLevelOffsets(const ImageInfo& info) noexcept {
@@ -650,24 +700,18 @@ LevelArray CalculateMipLevelOffsets(const ImageInfo& info) noexcept {
         LOG_ERROR(HW_GPU, "Image has too many mip levels={}, maximum supported is={}", info.resources.levels, MAX_MIP_LEVELS);
         return {};
     }
-    const LevelInfo level_info = MakeLevelInfo(info);
+    const LevelArray sizes = CachedLevelSizes(info);
     LevelArray offsets{};
     u32 offset = 0;
     for (s32 level = 0; level < info.resources.levels; ++level) {
         offsets[level] = offset;
-        offset += CalculateLevelSize(level_info, level);
+        offset += sizes[level];
     }
     return offsets;
 }
 
 LevelArray CalculateMipLevelSizes(const ImageInfo& info) noexcept {
-    const u32 num_levels = info.resources.levels;
-    const LevelInfo level_info = MakeLevelInfo(info);
-    LevelArray sizes{};
-    for (u32 level = 0; level < num_levels; ++level) {
-        sizes[level] = CalculateLevelSize(level_info, level);
-    }
-    return sizes;
+    return CachedLevelSizes(info);
 }
 
 boost::container::small_vector<u32, 16> CalculateSliceOffsets(const ImageInfo& info) {
@@ -676,6 +720,7 @@ boost::container::small_vector<u32, 16> CalculateSliceOffsets(const ImageInfo& i
     offsets.reserve(NumSlices(info));
 
     const LevelInfo level_info = MakeLevelInfo(info);
+    const LevelArray level_sizes = CachedLevelSizes(info);
     u32 mip_offset = 0;
     for (s32 level = 0; level < info.resources.levels; ++level) {
         const Extent3D tile_shift = TileShift(level_info, level);
@@ -689,7 +734,7 @@ boost::container::small_vector<u32, 16> CalculateSliceOffsets(const ImageInfo& i
             const u32 z_high = slice & ~z_mask;
             offsets.push_back(mip_offset + (z_low << gob_size_shift) + (z_high * slice_size));
         }
-        mip_offset += CalculateLevelSize(level_info, level);
+        mip_offset += level_sizes[level];
     }
     return offsets;
 }
@@ -873,43 +918,66 @@ boost::container::small_vector<BufferImageCopy, 16> UnswizzleImage(Tegra::Memory
             .image_extent = size,
         }};
     }
+    return UnswizzleSubresources(info,
+                                 SubresourceRange{
+                                     .base{},
+                                     .extent{
+                                         .levels = info.resources.levels,
+                                         .layers = info.resources.layers,
+                                     },
+                                 },
+                                 input, output);
+}
+
+boost::container::small_vector<BufferImageCopy, 16> UnswizzleSubresources(
+    const ImageInfo& info, const SubresourceRange& range, std::span<const u8> input,
+    std::span<u8> output) {
+    ASSERT(info.type != ImageType::Linear);
+    const u32 bpp_log2 = BytesPerBlockLog2(info.format);
+    const Extent2D tile_size = DefaultBlockSize(info.format);
+    const Extent3D size = info.size;
     const LevelInfo level_info = MakeLevelInfo(info);
-    const s32 num_layers = info.resources.layers;
     const s32 num_levels = info.resources.levels;
-    const std::array level_sizes = CalculateLevelSizes(level_info, num_levels);
+    const std::array level_sizes = CachedLevelSizes(info);
     const Extent2D gob = GobSize(bpp_log2, info.block.height, info.tile_width_spacing);
     const u32 layer_size = CalculateLevelBytes(level_sizes, num_levels);
     const u32 layer_stride = AlignLayerSize(layer_size, size, level_info.block, tile_size.height,
                                             info.tile_width_spacing);
+    const s32 end_level = range.base.level + range.extent.levels;
     size_t guest_offset = 0;
     u32 host_offset = 0;
-    boost::container::small_vector<BufferImageCopy, 16> copies(num_levels);
+    boost::container::small_vector<BufferImageCopy, 16> copies;
+    copies.reserve(range.extent.levels);
 
-    for (s32 level = 0; level < num_levels; ++level) {
+    for (s32 level = 0; level < end_level; ++level) {
+        if (level < range.base.level) {
+            guest_offset += level_sizes[level];
+            continue;
+        }
         const Extent3D level_size = AdjustMipSize(size, level);
         const u32 num_blocks_per_layer = NumBlocks(level_size, tile_size);
         const u32 host_bytes_per_layer = num_blocks_per_layer << bpp_log2;
-        copies[level] = BufferImageCopy{
+        copies.push_back(BufferImageCopy{
             .buffer_offset = host_offset,
-            .buffer_size = static_cast<size_t>(host_bytes_per_layer) * num_layers,
+            .buffer_size = static_cast<size_t>(host_bytes_per_layer) * range.extent.layers,
             .buffer_row_length = Common::AlignUp(level_size.width, tile_size.width),
             .buffer_image_height = Common::AlignUp(level_size.height, tile_size.height),
             .image_subresource =
                 {
                     .base_level = level,
-                    .base_layer = 0,
-                    .num_layers = info.resources.layers,
+                    .base_layer = range.base.layer,
+                    .num_layers = range.extent.layers,
                 },
             .image_offset = {0, 0, 0},
             .image_extent = level_size,
-        };
+        });
         const Extent3D num_tiles = AdjustTileSize(level_size, tile_size);
         const Extent3D block =
             AdjustMipBlockSize(num_tiles, level_info.block, level, level_info.num_levels);
         const u32 stride_alignment = StrideAlignment(num_tiles, info.block, gob, bpp_log2);
         size_t guest_layer_offset = 0;
 
-        for (s32 layer = 0; layer < info.resources.layers; ++layer) {
+        for (s32 layer = 0; layer < range.extent.layers; ++layer) {
             const std::span<u8> dst = output.subspan(host_offset);
             const std::span<const u8> src = input.subspan(guest_offset + guest_layer_offset);
             UnswizzleTexture(dst, src, 1U << bpp_log2, num_tiles.width, num_tiles.height,
@@ -922,6 +990,88 @@ boost::container::small_vector<BufferImageCopy, 16> UnswizzleImage(Tegra::Memory
     return copies;
 }
 
+namespace {
+
+/// Host memory LRU of converted ASTC levels, keyed by a hash of the guest blocks.
+/// Streaming titles upload the same ASTC payloads over and over, and decoding (plus the
+/// optional BCn recompression) is far more expensive than hashing and copying the result.
+class AstcConversionCache {
+public:
+    /// Copies a cached conversion into output, returns the number of bytes written or zero
+    size_t Find(u64 key, std::span<u8> output) {
+        std::scoped_lock lock{mutex};
+        const auto it = entries.find(key);
+        if (it == entries.end() || it->second.data.size() > output.size()) {
+            return 0;
+        }
+        lru.splice(lru.end(), lru, it->second.lru_it);
+        std::memcpy(output.data(), it->second.data.data(), it->second.data.size());
+        return it->second.data.size();
+    }
+
+    void Insert(u64 key, std::span<const u8> data) {
+        const size_t budget = Budget();
+        if (data.size() > budget / 8) {
+            return;
+        }
+        std::scoped_lock lock{mutex};
+        if (entries.contains(key)) {
+            return;
+        }
+        while (used_bytes + data.size() > budget && !lru.empty()) {
+            const auto victim = entries.find(lru.front());
+            used_bytes -= victim->second.data.size();
+            entries.erase(victim);
+            lru.pop_front();
+        }
+        lru.push_back(key);
+        entries.emplace(key, Entry{
+                                 .data = std::vector<u8>(data.begin(), data.end()),
+                                 .lru_it = std::prev(lru.end()),
+                             });
+        used_bytes += data.size();
+    }
+
+private:
+    struct Entry {
+        std::vector<u8> data;
+        std::list<u64>::iterator lru_it;
+    };
+
+    static size_t Budget() {
+        using namespace Common::Literals;
+        return Settings::values.vram_usage_mode.GetValue() == Settings::VramUsageMode::Aggressive
+                   ? 512_MiB
+                   : 128_MiB;
+    }
+
+    std::mutex mutex;
+    std::list<u64> lru;
+    ankerl::unordered_dense::map<u64, Entry> entries;
+    size_t used_bytes = 0;
+};
+
+AstcConversionCache astc_conversion_cache;
+
+/// Levels smaller than this are cheaper to decode than to look up
+constexpr size_t ASTC_CACHE_MIN_INPUT_SIZE = 16 * 1024;
+
+[[nodiscard]] u64 AstcConversionKey(std::span<const u8> input, const BufferImageCopy& copy,
+                                    Extent2D tile_size,
+                                    Settings::AstcRecompression recompression) {
+    const std::array<u32, 6> params{
+        copy.image_extent.width,  copy.image_extent.height, copy.image_extent.depth,
+        copy.image_subresource.num_layers, (tile_size.width << 8) | tile_size.height,
+        static_cast<u32>(recompression),
+    };
+    const u64 seed = Common::CityHash64(reinterpret_cast<const char*>(params.data()),
+                                        sizeof(params));
+    return Common::CityHash64WithSeed(reinterpret_cast<const char*>(input.data()), input.size(),
+                                      seed);
+}
+
+} // Anonymous namespace
+
 void ConvertImage(std::span<const u8> input, const ImageInfo& info, std::span<u8> output,
                   std::span<BufferImageCopy> copies) {
     u32 output_offset = 0;
@@ -943,15 +1093,43 @@ void ConvertImage(std::span<const u8> input, const ImageInfo& info, std::span<u8
         const auto recompression_setting = Settings::values.astc_recompression.GetValue();
         const bool astc = IsPixelFormatASTC(info.format);
 
+        std::optional<u64> astc_key;
+        if (astc) {
+            const size_t astc_size = Common::DivCeil(copy.image_extent.width, tile_size.width) *
+                                     Common::DivCeil(copy.image_extent.height, tile_size.height) *
+                                     copy.image_extent.depth *
+                                     copy.image_subresource.num_layers * 16;
+            if (astc_size >= ASTC_CACHE_MIN_INPUT_SIZE && astc_size <= input_offset.size()) {
+                astc_key = AstcConversionKey(input_offset.first(astc_size), copy, tile_size,
+                                             recompression_setting);
+                const size_t cached_size =
+                    astc_conversion_cache.Find(*astc_key, output.subspan(output_offset));
+                if (cached_size != 0) {
+                    if (recompression_setting != Settings::AstcRecompression::Uncompressed) {
+                        copy.buffer_size = cached_size;
+                    }
+                    output_offset += static_cast<u32>(cached_size);
+                    copy.buffer_row_length = mip_size.width;
+                    copy.buffer_image_height = mip_size.height;
+                    continue;
+                }
+            }
+        }
+
         if (astc && recompression_setting == Settings::AstcRecompression::Uncompressed) {
             Tegra::Texture::ASTC::Decompress(
                 input_offset, copy.image_extent.width, copy.image_extent.height,
                 copy.image_subresource.num_layers * copy.image_extent.depth, tile_size.width,
                 tile_size.height, output.subspan(output_offset));
 
-            output_offset += copy.image_extent.width * copy.image_extent.height *
-                             copy.image_subresource.num_layers *
-                             BytesPerBlock(PixelFormat::A8B8G8R8_UNORM);
+            const u32 converted_size = copy.image_extent.width * copy.image_extent.height *
+                                       copy.image_subresource.num_layers *
+                                       BytesPerBlock(PixelFormat::A8B8G8R8_UNORM);
+            if (astc_key) {
+                astc_conversion_cache.Insert(*astc_key,
+                                             output.subspan(output_offset, converted_size));
+            }
+            output_offset += converted_size;
         } else if (astc) {
             // BC1 uses 0.5 bytes per texel
             // BC3 uses 1 byte per texel
@@ -981,6 +1159,10 @@ void ConvertImage(std::span<const u8> input, const ImageInfo& info, std::span<u8
             copy.buffer_size =
                 (aligned_plane_dim * copy.image_extent.depth * copy.image_subresource.num_layers) /
                 bpp_div;
+            if (astc_key) {
+                astc_conversion_cache.Insert(*astc_key,
+                                             output.subspan(output_offset, copy.buffer_size));
+            }
             output_offset += static_cast<u32>(copy.buffer_size);
         } else {
             DecompressBCn(input_offset, output.subspan(output_offset), copy, info.format);
@@ -1071,6 +1253,7 @@ boost::container::small_vector<SwizzleParameters, 16> FullUploadSwizzles(const I
     const LevelInfo level_info = MakeLevelInfo(info);
     const Extent3D size = info.size;
     const s32 num_levels = info.resources.levels;
+    const LevelArray level_sizes = CachedLevelSizes(info);
 
     u32 guest_offset = 0;
     boost::container::small_vector<SwizzleParameters, 16> params(num_levels);
@@ -1085,7 +1268,7 @@ boost::container::small_vector<SwizzleParameters, 16> FullUploadSwizzles(const I
             .buffer_offset = guest_offset,
             .level = level,
         };
-        guest_offset += CalculateLevelSize(level_info, level);
+        guest_offset += level_sizes[level];
     }
     return params;
 }
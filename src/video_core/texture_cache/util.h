@@ -69,6 +69,12 @@ struct OverlapResult {
     Tegra::MemoryManager& gpu_memory, GPUVAddr gpu_addr, const ImageInfo& info,
     std::span<const u8> input, std::span<u8> output);
 
+/// Unswizzles some levels and layers of a block linear image into a tightly packed buffer
+/// @param input Guest memory of the image, starting at the first layer of the range
+[[nodiscard]] boost::container::small_vector<BufferImageCopy, 16> UnswizzleSubresources(
+    const ImageInfo& info, const SubresourceRange& range, std::span<const u8> input,
+    std::span<u8> output);
+
 void ConvertImage(std::span<const u8> input, const ImageInfo& info, std::span<u8> output,
                   std::span<BufferImageCopy> copies);
 
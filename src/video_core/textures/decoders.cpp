@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
@@ -9,10 +9,19 @@
 #include <cstring>
 #include <span>
 
+#if defined(ARCHITECTURE_x86_64)
+#include <immintrin.h>
+#elif defined(ARCHITECTURE_arm64)
+#include <arm_neon.h>
+#endif
+
 #include "common/alignment.h"
 #include "common/assert.h"
 #include "common/bit_util.h"
 #include "common/div_ceil.h"
+#ifdef ARCHITECTURE_x86_64
+#include "common/cpu_features.h"
+#endif
 #include "video_core/gpu.h"
 #include "video_core/textures/decoders.h"
 
@@ -36,9 +45,96 @@ void incrpdep(u32& value) {
     value = ((value | ~mask) + swizzled_incr) & mask;
 }
 
+#if defined(ARCHITECTURE_x86_64) && (defined(__GNUC__) || defined(__clang__))
+#define AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define AVX2_TARGET
+#endif
+
+/// Copies one full GOB between its 512 swizzled bytes and 8 linear rows of 64 bytes.
+/// Each pair of rows is stored as 64 bytes where the 16 byte chunks of both rows interleave,
+/// the right half of the rows lives 256 bytes further.
+template <bool TO_LINEAR>
+void CopyGobGeneric(u8* dst, const u8* src, u32 pitch) {
+    for (u32 y = 0; y < GOB_SIZE_Y; ++y) {
+        for (u32 chunk = 0; chunk < 4; ++chunk) {
+            const u32 linear_offset = y * pitch + chunk * 16;
+            const u32 swizzled_offset =
+                (chunk >> 1) * 256 + (y >> 1) * 64 + (chunk & 1) * 32 + (y & 1) * 16;
+            std::memcpy(dst + (TO_LINEAR ? swizzled_offset : linear_offset),
+                        src + (TO_LINEAR ? linear_offset : swizzled_offset), 16);
+        }
+    }
+}
+
+#ifdef ARCHITECTURE_x86_64
+template <bool TO_LINEAR>
+AVX2_TARGET void CopyGobAVX2(u8* dst, const u8* src, u32 pitch) {
+    for (u32 y = 0; y < GOB_SIZE_Y; y += 2) {
+        for (u32 half = 0; half < 2; ++half) {
+            const u32 even_offset = y * pitch + half * 32;
+            const u32 odd_offset = even_offset + pitch;
+            const u32 swizzled_offset = half * 256 + (y >> 1) * 64;
+            // Exchanging the upper and lower 128-bit lanes of two rows is its own inverse, so
+            // both directions use the same permutation.
+            const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(
+                src + (TO_LINEAR ? even_offset : swizzled_offset)));
+            const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(
+                src + (TO_LINEAR ? odd_offset : swizzled_offset + 32)));
+            _mm256_storeu_si256(
+                reinterpret_cast<__m256i*>(dst + (TO_LINEAR ? swizzled_offset : even_offset)),
+                _mm256_permute2x128_si256(a, b, 0x20));
+            _mm256_storeu_si256(
+                reinterpret_cast<__m256i*>(dst + (TO_LINEAR ? swizzled_offset + 32 : odd_offset)),
+                _mm256_permute2x128_si256(a, b, 0x31));
+        }
+    }
+}
+#endif
+
+#ifdef ARCHITECTURE_arm64
+template <bool TO_LINEAR>
+void CopyGobNEON(u8* dst, const u8* src, u32 pitch) {
+    for (u32 y = 0; y < GOB_SIZE_Y; y += 2) {
+        for (u32 half = 0; half < 2; ++half) {
+            const u32 even_offset = y * pitch + half * 32;
+            const u32 odd_offset = even_offset + pitch;
+            const u32 swizzled_offset = half * 256 + (y >> 1) * 64;
+            if constexpr (TO_LINEAR) {
+                const uint8x16x2_t even = vld1q_u8_x2(src + even_offset);
+                const uint8x16x2_t odd = vld1q_u8_x2(src + odd_offset);
+                vst1q_u8_x4(dst + swizzled_offset,
+                            uint8x16x4_t{{even.val[0], odd.val[0], even.val[1], odd.val[1]}});
+            } else {
+                const uint8x16x4_t gob = vld1q_u8_x4(src + swizzled_offset);
+                vst1q_u8_x2(dst + even_offset, uint8x16x2_t{{gob.val[0], gob.val[2]}});
+                vst1q_u8_x2(dst + odd_offset, uint8x16x2_t{{gob.val[1], gob.val[3]}});
+            }
+        }
+    }
+}
+#endif
+
+using CopyGobFunc = void (*)(u8* dst, const u8* src, u32 pitch);
+
+template <bool TO_LINEAR>
+CopyGobFunc SelectCopyGob() {
+#if defined(ARCHITECTURE_x86_64)
+    if (Common::g_cpu_caps.avx2) {
+        return &CopyGobAVX2<TO_LINEAR>;
+    }
+#elif defined(ARCHITECTURE_arm64)
+    return &CopyGobNEON<TO_LINEAR>;
+#endif
+    return &CopyGobGeneric<TO_LINEAR>;
+}
+
+/// Swizzles the pixels in the [column_begin, column_end) x [line_begin, line_end) rectangle of
+/// every slice, one pixel at a time.
 template <bool TO_LINEAR, u32 BYTES_PER_PIXEL>
-void SwizzleImpl(std::span<u8> output, std::span<const u8> input, u32 width, u32 height, u32 depth,
-                 u32 block_height, u32 block_depth, u32 stride) {
+void SwizzlePixels(std::span<u8> output, std::span<const u8> input, u32 width, u32 height,
+                   u32 depth, u32 block_height, u32 block_depth, u32 stride, u32 column_begin,
+                   u32 column_end, u32 line_begin, u32 line_end) {
     // The origin of the transformation can be configured here, leave it as zero as the current API
     // doesn't expose it.
     static constexpr u32 origin_x = 0;
@@ -62,7 +158,7 @@ void SwizzleImpl(std::span<u8> output, std::span<const u8> input, u32 width, u32
         const u32 z = slice + origin_z;
         const u32 offset_z = (z >> block_depth) * slice_size +
                              ((z & block_depth_mask) << (GOB_SIZE_SHIFT + block_height));
-        for (u32 line = 0; line < height; ++line) {
+        for (u32 line = line_begin; line < line_end; ++line) {
             const u32 y = line + origin_y;
             const u32 swizzled_y = pdep<SWIZZLE_Y_BITS>(y);
 
@@ -70,8 +166,8 @@ void SwizzleImpl(std::span<u8> output, std::span<const u8> input, u32 width, u32
             const u32 offset_y = (block_y >> block_height) * block_size +
                                  ((block_y & block_height_mask) << GOB_SIZE_SHIFT);
 
-            u32 swizzled_x = pdep<SWIZZLE_X_BITS>(origin_x * BYTES_PER_PIXEL);
-            for (u32 column = 0; column < width;
+            u32 swizzled_x = pdep<SWIZZLE_X_BITS>((origin_x + column_begin) * BYTES_PER_PIXEL);
+            for (u32 column = column_begin; column < column_end;
                  ++column, incrpdep<SWIZZLE_X_BITS, BYTES_PER_PIXEL>(swizzled_x)) {
                 const u32 x = (column + origin_x) * BYTES_PER_PIXEL;
                 const u32 offset_x = (x >> GOB_SIZE_X_SHIFT) << x_shift;
@@ -91,6 +187,61 @@ void SwizzleImpl(std::span<u8> output, std::span<const u8> input, u32 width, u32
     }
 }
 
+template <bool TO_LINEAR, u32 BYTES_PER_PIXEL>
+void SwizzleImpl(std::span<u8> output, std::span<const u8> input, u32 width, u32 height, u32 depth,
+                 u32 block_height, u32 block_depth, u32 stride) {
+    // Full GOBs are copied 512 bytes at a time, the partial GOBs on the right and bottom edges
+    // fall back to the per pixel path.
+    constexpr bool whole_pixels_per_gob = GOB_SIZE_X % BYTES_PER_PIXEL == 0;
+    const u32 pitch = width * BYTES_PER_PIXEL;
+    const u32 full_gobs_x = whole_pixels_per_gob ? pitch >> GOB_SIZE_X_SHIFT : 0;
+    const u32 full_gobs_y = height >> GOB_SIZE_Y_SHIFT;
+    if (full_gobs_x == 0 || full_gobs_y == 0) {
+        SwizzlePixels<TO_LINEAR, BYTES_PER_PIXEL>(output, input, width, height, depth,
+                                                  block_height, block_depth, stride, 0, width, 0,
+                                                  height);
+        return;
+    }
+    static const CopyGobFunc copy_gob = SelectCopyGob<TO_LINEAR>();
+
+    const u32 gobs_in_x = Common::DivCeilLog2(stride, GOB_SIZE_X_SHIFT);
+    const u32 block_size = gobs_in_x << (GOB_SIZE_SHIFT + block_height + block_depth);
+    const u32 slice_size =
+        Common::DivCeilLog2(height, block_height + GOB_SIZE_Y_SHIFT) * block_size;
+    const u32 block_height_mask = (1U << block_height) - 1;
+    const u32 block_depth_mask = (1U << block_depth) - 1;
+    const u32 x_shift = GOB_SIZE_SHIFT + block_height + block_depth;
+
+    for (u32 slice = 0; slice < depth; ++slice) {
+        const u32 offset_z = (slice >> block_depth) * slice_size +
+                             ((slice & block_depth_mask) << (GOB_SIZE_SHIFT + block_height));
+        const u32 linear_slice = slice * pitch * height;
+        for (u32 gob_y = 0; gob_y < full_gobs_y; ++gob_y) {
+            const u32 offset_y = (gob_y >> block_height) * block_size +
+                                 ((gob_y & block_height_mask) << GOB_SIZE_SHIFT);
+            const u32 linear_row = linear_slice + (gob_y << GOB_SIZE_Y_SHIFT) * pitch;
+            for (u32 gob_x = 0; gob_x < full_gobs_x; ++gob_x) {
+                const u32 linear_offset = linear_row + (gob_x << GOB_SIZE_X_SHIFT);
+                const u32 swizzled_offset = offset_z + offset_y + (gob_x << x_shift);
+                copy_gob(&output[TO_LINEAR ? swizzled_offset : linear_offset],
+                         &input[TO_LINEAR ? linear_offset : swizzled_offset], pitch);
+            }
+        }
+    }
+    const u32 full_width = (full_gobs_x << GOB_SIZE_X_SHIFT) / BYTES_PER_PIXEL;
+    const u32 full_height = full_gobs_y << GOB_SIZE_Y_SHIFT;
+    if (full_width != width) {
+        SwizzlePixels<TO_LINEAR, BYTES_PER_PIXEL>(output, input, width, height, depth,
+                                                  block_height, block_depth, stride, full_width,
+                                                  width, 0, full_height);
+    }
+    if (full_height != height) {
+        SwizzlePixels<TO_LINEAR, BYTES_PER_PIXEL>(output, input, width, height, depth,
+                                                  block_height, block_depth, stride, 0, width,
+                                                  full_height, height);
+    }
+}
+
 template <bool TO_LINEAR, u32 BYTES_PER_PIXEL>
 void SwizzleSubrectImpl(std::span<u8> output, std::span<const u8> input, u32 width, u32 height,
                         u32 depth, u32 origin_x, u32 origin_y, u32 extent_x, u32 num_lines,
@@ -6,7 +6,7 @@
 
 #include <array>
 
-#include "common/cityhash.h"
+#include "common/hash.h"
 #include "common/settings.h"
 #include "video_core/textures/texture.h"
 
@@ -97,9 +97,9 @@ float TSCEntry::MaxAnisotropy() const noexcept {
 } // namespace Tegra::Texture
 
 size_t std::hash<TICEntry>::operator()(const TICEntry& tic) const noexcept {
-    return Common::CityHash64(reinterpret_cast<const char*>(&tic), sizeof tic);
+    return Common::Hash::HashObject(tic);
 }
 
 size_t std::hash<TSCEntry>::operator()(const TSCEntry& tsc) const noexcept {
-    return Common::CityHash64(reinterpret_cast<const char*>(&tsc), sizeof tsc);
+    return Common::Hash::HashObject(tsc);
 }
@@ -717,12 +717,16 @@ Device::Device(VkInstance instance_, vk::PhysicalDevice physical_, VkSurfaceKHR
 
     graphics_queue = logical.GetQueue(graphics_family);
     present_queue = logical.GetQueue(present_family);
+    if (has_async_transfer) {
+        transfer_queue = logical.GetQueue(transfer_family);
+    }
 
     VmaVulkanFunctions functions{};
     functions.vkGetInstanceProcAddr = dld.vkGetInstanceProcAddr;
     functions.vkGetDeviceProcAddr = dld.vkGetDeviceProcAddr;
 
-    VmaAllocatorCreateFlags flags = VMA_ALLOCATOR_CREATE_EXTERNALLY_SYNCHRONIZED_BIT;
+    // Not externally synchronized, the texture cache frees retired images on a worker thread
+    VmaAllocatorCreateFlags flags = 0;
     if (extensions.memory_budget) {
         flags |= VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT;
     }
@@ -1098,6 +1102,15 @@ bool Device::GetSuitability(bool requires_swapchain) {
             VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_5_PROPERTIES_KHR;
         SetNext(next, properties.maintenance5);
     }
+    if (extensions.graphics_pipeline_library) {
+        properties.graphics_pipeline_library.sType =
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT;
+        SetNext(next, properties.graphics_pipeline_library);
+    }
+    if (extensions.multi_draw) {
+        properties.multi_draw.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_PROPERTIES_EXT;
+        SetNext(next, properties.multi_draw);
+    }
 
     // Perform the property fetch.
     physical.GetProperties2(properties2);
@@ -1214,6 +1227,16 @@ void Device::RemoveUnsuitableExtensions() {
     RemoveExtensionFeatureIfUnsuitable(extensions.depth_clip_control, features.depth_clip_control,
                                        VK_EXT_DEPTH_CLIP_CONTROL_EXTENSION_NAME);
 
+    // VK_KHR_present_id, VK_KHR_present_wait
+    // Both depend on VK_KHR_swapchain, and present waits are only useful together with the ids.
+    extensions.present_id =
+        extensions.swapchain && features.present_id.presentId && features.present_wait.presentWait;
+    RemoveExtensionFeatureIfUnsuitable(extensions.present_id, features.present_id,
+                                       VK_KHR_PRESENT_ID_EXTENSION_NAME);
+    extensions.present_wait = extensions.present_id;
+    RemoveExtensionFeatureIfUnsuitable(extensions.present_wait, features.present_wait,
+                                       VK_KHR_PRESENT_WAIT_EXTENSION_NAME);
+
     // VK_EXT_extended_dynamic_state
     extensions.extended_dynamic_state = features.extended_dynamic_state.extendedDynamicState;
     RemoveExtensionFeatureIfUnsuitable(extensions.extended_dynamic_state,
@@ -1326,6 +1349,12 @@ void Device::RemoveUnsuitableExtensions() {
                                        features.subgroup_size_control,
                                        VK_EXT_SUBGROUP_SIZE_CONTROL_EXTENSION_NAME);
 
+    // VK_EXT_multi_draw
+    extensions.multi_draw =
+        features.multi_draw.multiDraw && properties.multi_draw.maxMultiDrawCount > 0;
+    RemoveExtensionFeatureIfUnsuitable(extensions.multi_draw, features.multi_draw,
+                                       VK_EXT_MULTI_DRAW_EXTENSION_NAME);
+
     // VK_EXT_transform_feedback
     extensions.transform_feedback =
         features.transform_feedback.transformFeedback &&
@@ -1340,6 +1369,19 @@ void Device::RemoveUnsuitableExtensions() {
                                        features.vertex_input_dynamic_state,
                                        VK_EXT_VERTEX_INPUT_DYNAMIC_STATE_EXTENSION_NAME);
 
+    // VK_EXT_graphics_pipeline_library
+    // Only fast linking makes libraries worth it, without it linking costs a full compile
+    extensions.graphics_pipeline_library =
+        extensions.pipeline_library &&
+        features.graphics_pipeline_library.graphicsPipelineLibrary &&
+        properties.graphics_pipeline_library.graphicsPipelineLibraryFastLinking;
+    RemoveExtensionFeatureIfUnsuitable(extensions.graphics_pipeline_library,
+                                       features.graphics_pipeline_library,
+                                       VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME);
+    if (!extensions.graphics_pipeline_library) {
+        RemoveExtension(extensions.pipeline_library, VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME);
+    }
+
     // VK_KHR_pipeline_executable_properties
     if (Settings::values.renderer_shader_feedback.GetValue()) {
         extensions.pipeline_executable_properties =
@@ -1400,6 +1442,31 @@ void Device::RemoveUnsuitableExtensions() {
     extensions.synchronization2 = features.synchronization2.synchronization2;
     RemoveExtensionFeatureIfUnsuitable(extensions.synchronization2, features.synchronization2,
                                        VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME);
+
+    // VK_KHR_dynamic_rendering
+    if (Settings::values.dynamic_rendering.GetValue()) {
+        extensions.dynamic_rendering = features.dynamic_rendering.dynamicRendering;
+        RemoveExtensionFeatureIfUnsuitable(extensions.dynamic_rendering, features.dynamic_rendering,
+                                           VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME);
+    } else {
+        RemoveExtensionFeature(extensions.dynamic_rendering, features.dynamic_rendering,
+                               VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME);
+    }
+
+    // VK_KHR_dynamic_rendering_local_read
+    extensions.dynamic_rendering_local_read =
+        extensions.dynamic_rendering &&
+        features.dynamic_rendering_local_read.dynamicRenderingLocalRead;
+    RemoveExtensionFeatureIfUnsuitable(extensions.dynamic_rendering_local_read,
+                                       features.dynamic_rendering_local_read,
+                                       VK_KHR_DYNAMIC_RENDERING_LOCAL_READ_EXTENSION_NAME);
+
+    // VK_EXT_shader_object
+    // Shader objects can only be drawn with inside dynamic rendering
+    extensions.shader_object =
+        extensions.dynamic_rendering && features.shader_object.shaderObject;
+    RemoveExtensionFeatureIfUnsuitable(extensions.shader_object, features.shader_object,
+                                       VK_EXT_SHADER_OBJECT_EXTENSION_NAME);
 }
 
 void Device::SetupFamilies(VkSurfaceKHR surface) {
@@ -1435,6 +1502,23 @@ void Device::SetupFamilies(VkSurfaceKHR surface) {
     if (present) {
         present_family = *present;
     }
+
+    // Dedicated transfer queues are the copy engines of the GPU, they run next to the graphics
+    // queue. Submissions on them are ordered with timeline semaphores.
+    if (Settings::values.disable_async_transfer_queue.GetValue() || !HasTimelineSemaphore()) {
+        return;
+    }
+    for (u32 index = 0; index < static_cast<u32>(queue_family_properties.size()); ++index) {
+        const VkQueueFamilyProperties& queue_family = queue_family_properties[index];
+        const VkQueueFlags flags = queue_family.queueFlags;
+        if (queue_family.queueCount > 0 && (flags & VK_QUEUE_TRANSFER_BIT) != 0 &&
+            (flags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT)) == 0) {
+            transfer_family = index;
+            has_async_transfer = true;
+            LOG_INFO(Render_Vulkan, "Using queue family {} for buffer uploads", index);
+            break;
+        }
+    }
 }
 
 std::optional<size_t> Device::GetSamplerHeapBudget() const {
@@ -1456,6 +1540,22 @@ u64 Device::GetDeviceMemoryUsage() const {
     return result;
 }
 
+u64 Device::GetDeviceMemoryBudget() const {
+    if (!extensions.memory_budget) {
+        return device_access_memory;
+    }
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT budget;
+    budget.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+    budget.pNext = nullptr;
+    physical.GetMemoryProperties(&budget);
+    u64 result{};
+    for (const size_t heap : valid_heap_memory) {
+        result += budget.heapBudget[heap];
+    }
+    // Never grant more than the limits derived from the settings when the device was created
+    return (std::min)(result, device_access_memory);
+}
+
 void Device::CollectPhysicalMemoryInfo() {
     // Calculate limits using memory budget
     VkPhysicalDeviceMemoryBudgetPropertiesEXT budget{};
@@ -1524,6 +1624,9 @@ std::vector<VkDeviceQueueCreateInfo> Device::GetDeviceQueueCreateInfos() const {
     static constexpr float QUEUE_PRIORITY = 1.0f;
 
     ankerl::unordered_dense::set<u32> unique_queue_families{graphics_family, present_family};
+    if (has_async_transfer) {
+        unique_queue_families.insert(transfer_family);
+    }
     std::vector<VkDeviceQueueCreateInfo> queue_cis;
     queue_cis.reserve(unique_queue_families.size());
 
@@ -222,11 +222,60 @@ namespace Vulkan {
         }
     }
 
-    MemoryAllocator::~MemoryAllocator() = default;
+    MemoryAllocator::~MemoryAllocator() {
+        for (VmaPool pool : image_pools) {
+            if (pool) {
+                vmaDestroyPool(allocator, pool);
+            }
+        }
+    }
+
+    VmaPool MemoryAllocator::GetImagePool(const VkImageCreateInfo &ci,
+                                          const VmaAllocationCreateInfo &alloc_ci) const
+    {
+        constexpr VkImageUsageFlags attachment_usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT |
+                                                       VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+        const ImagePoolClass pool_class = (ci.usage & attachment_usage) != 0
+                                          ? ImagePoolClass::RenderTarget
+                                          : ImagePoolClass::Sampled;
+        const size_t index = static_cast<size_t>(pool_class);
+
+        std::scoped_lock lk{image_pool_mutex};
+        if (image_pools[index] || image_pool_failed[index]) {
+            return image_pools[index];
+        }
+        // Pools are bound to a single memory type, pick the one VMA prefers for the first image
+        // of the class. Images that can't use it fall back to the default pools.
+        u32 memory_type_index{};
+        VmaPool pool{};
+        if (vmaFindMemoryTypeIndexForImageInfo(allocator, &ci, &alloc_ci, &memory_type_index) ==
+            VK_SUCCESS) {
+            const VmaPoolCreateInfo pool_ci = {
+                    .memoryTypeIndex = memory_type_index,
+                    .flags = 0,
+                    .blockSize = 0,
+                    .minBlockCount = 0,
+                    .maxBlockCount = 0,
+                    .priority = pool_class == ImagePoolClass::RenderTarget ? 1.f : 0.5f,
+                    .minAllocationAlignment = 0,
+                    .pMemoryAllocateNext = nullptr,
+            };
+            if (vmaCreatePool(allocator, &pool_ci, &pool) != VK_SUCCESS) {
+                pool = VK_NULL_HANDLE;
+            }
+        }
+        if (!pool) {
+            LOG_WARNING(Render_Vulkan, "Failed to create image pool {}, using default pools",
+                        index);
+            image_pool_failed[index] = true;
+        }
+        image_pools[index] = pool;
+        return pool;
+    }
 
     vk::Image MemoryAllocator::CreateImage(const VkImageCreateInfo &ci) const
     {
-        const VmaAllocationCreateInfo alloc_ci = {
+        VmaAllocationCreateInfo alloc_ci = {
                 .flags = VMA_ALLOCATION_CREATE_WITHIN_BUDGET_BIT,
                 .usage = VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE,
                 .requiredFlags = 0,
@@ -237,10 +286,19 @@ namespace Vulkan {
                 .priority = 0.f,
         };
 
+        alloc_ci.pool = GetImagePool(ci, alloc_ci);
+
         VkImage handle{};
         VmaAllocation allocation{};
         VmaAllocationInfo alloc_info{};
-        vk::Check(vmaCreateImage(allocator, &ci, &alloc_ci, &handle, &allocation, &alloc_info));
+        VkResult result = vmaCreateImage(allocator, &ci, &alloc_ci, &handle, &allocation,
+                                         &alloc_info);
+        if (result != VK_SUCCESS && alloc_ci.pool) {
+            // The pool's memory type may not suit this image, or its blocks may be exhausted.
+            alloc_ci.pool = VK_NULL_HANDLE;
+            result = vmaCreateImage(allocator, &ci, &alloc_ci, &handle, &allocation, &alloc_info);
+        }
+        vk::Check(result);
 
         // Log GPU memory allocation for images
         if (GPU::Logging::IsActive() &&
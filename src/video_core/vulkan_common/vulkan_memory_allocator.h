@@ -6,7 +6,9 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
+#include <mutex>
 #include <span>
 #include <vector>
 
@@ -121,6 +123,18 @@ namespace Vulkan {
         MemoryCommit Commit(const vk::Buffer &buffer, MemoryUsage usage);
 
     private:
+        /// Lifetime classes of images. Render targets tend to live for the whole session while
+        /// sampled images are recycled constantly, so they are kept in separate memory blocks.
+        enum class ImagePoolClass : u32 {
+            RenderTarget,
+            Sampled,
+            Count,
+        };
+
+        /// Returns the custom pool for the image's lifetime class, creating it on first use.
+        VmaPool GetImagePool(const VkImageCreateInfo &ci,
+                             const VmaAllocationCreateInfo &alloc_ci) const;
+
         static bool IsAutoUsage(VmaMemoryUsage u) noexcept {
             switch (u) {
                 case VMA_MEMORY_USAGE_AUTO:
@@ -137,6 +151,12 @@ namespace Vulkan {
         const VkPhysicalDeviceMemoryProperties properties; ///< Physical device memory properties.
         VkDeviceSize buffer_image_granularity;            ///< Adjacent buffer/image granularity
         u32 valid_memory_types{~0u};
+
+        static constexpr size_t NUM_IMAGE_POOL_CLASSES =
+                static_cast<size_t>(ImagePoolClass::Count);
+        mutable std::mutex image_pool_mutex;
+        mutable std::array<VmaPool, NUM_IMAGE_POOL_CLASSES> image_pools{};
+        mutable std::array<bool, NUM_IMAGE_POOL_CLASSES> image_pool_failed{};
     };
 
 } // namespace Vulkan
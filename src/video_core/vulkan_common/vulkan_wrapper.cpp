@@ -92,11 +92,13 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkCmdBeginConditionalRenderingEXT);
     X(vkCmdBeginQuery);
     X(vkCmdBeginRenderPass);
+    X(vkCmdBeginRendering);
     X(vkCmdBeginTransformFeedbackEXT);
     X(vkCmdBeginDebugUtilsLabelEXT);
     X(vkCmdBindDescriptorSets);
     X(vkCmdBindIndexBuffer);
     X(vkCmdBindPipeline);
+    X(vkCmdBindShadersEXT);
     X(vkCmdBindTransformFeedbackBuffersEXT);
     X(vkCmdBindVertexBuffers);
     X(vkCmdBlitImage);
@@ -116,9 +118,11 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkCmdDrawIndirectCount);
     X(vkCmdDrawIndexedIndirectCount);
     X(vkCmdDrawIndirectByteCountEXT);
+    X(vkCmdDrawMultiIndexedEXT);
     X(vkCmdEndConditionalRenderingEXT);
     X(vkCmdEndQuery);
     X(vkCmdEndRenderPass);
+    X(vkCmdEndRendering);
     X(vkCmdEndTransformFeedbackEXT);
     X(vkCmdEndDebugUtilsLabelEXT);
     X(vkCmdFillBuffer);
@@ -137,6 +141,7 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkCmdSetStencilWriteMask);
     X(vkCmdSetViewport);
     X(vkCmdWaitEvents);
+    X(vkCmdWriteTimestamp);
     X(vkCmdBindVertexBuffers2EXT);
     X(vkCmdSetCullModeEXT);
     X(vkCmdSetDepthBoundsTestEnableEXT);
@@ -187,6 +192,7 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkCreateSampler);
     X(vkCreateSemaphore);
     X(vkCreateShaderModule);
+    X(vkCreateShadersEXT);
     X(vkCreateSwapchainKHR);
     X(vkDestroyBuffer);
     X(vkDestroyBufferView);
@@ -206,6 +212,7 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkDestroyRenderPass);
     X(vkDestroySampler);
     X(vkDestroySemaphore);
+    X(vkDestroyShaderEXT);
     X(vkDestroyShaderModule);
     X(vkDestroySwapchainKHR);
     X(vkDeviceWaitIdle);
@@ -238,6 +245,7 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkUpdateDescriptorSetWithTemplate);
     X(vkUpdateDescriptorSets);
     X(vkWaitForFences);
+    X(vkWaitForPresentKHR);
     X(vkWaitSemaphores);
 
     // Support for timeline semaphores is mandatory in Vulkan 1.2
@@ -264,6 +272,12 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     if (!dld.vkQueueSubmit2) {
         Proc(dld.vkQueueSubmit2, dld, "vkQueueSubmit2KHR", device);
     }
+
+    // Dynamic rendering is core in Vulkan 1.3, otherwise requires VK_KHR_dynamic_rendering
+    if (!dld.vkCmdBeginRendering) {
+        Proc(dld.vkCmdBeginRendering, dld, "vkCmdBeginRenderingKHR", device);
+        Proc(dld.vkCmdEndRendering, dld, "vkCmdEndRenderingKHR", device);
+    }
 #undef X
 }
 
@@ -412,6 +426,10 @@ void Destroy(VkDevice device, VkSemaphore handle, const DeviceDispatch& dld) noe
     dld.vkDestroySemaphore(device, handle, nullptr);
 }
 
+void Destroy(VkDevice device, VkShaderEXT handle, const DeviceDispatch& dld) noexcept {
+    dld.vkDestroyShaderEXT(device, handle, nullptr);
+}
+
 void Destroy(VkDevice device, VkShaderModule handle, const DeviceDispatch& dld) noexcept {
     dld.vkDestroyShaderModule(device, handle, nullptr);
 }
@@ -757,6 +775,12 @@ Pipeline Device::CreateComputePipeline(const VkComputePipelineCreateInfo& ci,
     return Pipeline(object, handle, *dld);
 }
 
+ShaderEXT Device::CreateShaderEXT(const VkShaderCreateInfoEXT& ci) const {
+    VkShaderEXT object;
+    Check(dld->vkCreateShadersEXT(handle, 1, &ci, nullptr, &object));
+    return ShaderEXT(object, handle, *dld);
+}
+
 Sampler Device::CreateSampler(const VkSamplerCreateInfo& ci) const {
     VkSampler object;
     Check(dld->vkCreateSampler(handle, &ci, nullptr, &object));
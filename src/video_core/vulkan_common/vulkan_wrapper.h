@@ -208,10 +208,12 @@ struct DeviceDispatch : InstanceDispatch {
     PFN_vkCmdBeginDebugUtilsLabelEXT vkCmdBeginDebugUtilsLabelEXT{};
     PFN_vkCmdBeginQuery vkCmdBeginQuery{};
     PFN_vkCmdBeginRenderPass vkCmdBeginRenderPass{};
+    PFN_vkCmdBeginRendering vkCmdBeginRendering{};
     PFN_vkCmdBeginTransformFeedbackEXT vkCmdBeginTransformFeedbackEXT{};
     PFN_vkCmdBindDescriptorSets vkCmdBindDescriptorSets{};
     PFN_vkCmdBindIndexBuffer vkCmdBindIndexBuffer{};
     PFN_vkCmdBindPipeline vkCmdBindPipeline{};
+    PFN_vkCmdBindShadersEXT vkCmdBindShadersEXT{};
     PFN_vkCmdBindTransformFeedbackBuffersEXT vkCmdBindTransformFeedbackBuffersEXT{};
     PFN_vkCmdBindVertexBuffers vkCmdBindVertexBuffers{};
     PFN_vkCmdBindVertexBuffers2EXT vkCmdBindVertexBuffers2EXT{};
@@ -232,10 +234,12 @@ struct DeviceDispatch : InstanceDispatch {
     PFN_vkCmdDrawIndirectCount vkCmdDrawIndirectCount{};
     PFN_vkCmdDrawIndexedIndirectCount vkCmdDrawIndexedIndirectCount{};
     PFN_vkCmdDrawIndirectByteCountEXT vkCmdDrawIndirectByteCountEXT{};
+    PFN_vkCmdDrawMultiIndexedEXT vkCmdDrawMultiIndexedEXT{};
     PFN_vkCmdEndConditionalRenderingEXT vkCmdEndConditionalRenderingEXT{};
     PFN_vkCmdEndDebugUtilsLabelEXT vkCmdEndDebugUtilsLabelEXT{};
     PFN_vkCmdEndQuery vkCmdEndQuery{};
     PFN_vkCmdEndRenderPass vkCmdEndRenderPass{};
+    PFN_vkCmdEndRendering vkCmdEndRendering{};
     PFN_vkCmdEndTransformFeedbackEXT vkCmdEndTransformFeedbackEXT{};
     PFN_vkCmdFillBuffer vkCmdFillBuffer{};
     PFN_vkCmdPipelineBarrier vkCmdPipelineBarrier{};
@@ -283,6 +287,7 @@ struct DeviceDispatch : InstanceDispatch {
     PFN_vkCmdSetColorBlendEnableEXT vkCmdSetColorBlendEnableEXT{};
     PFN_vkCmdSetColorBlendEquationEXT vkCmdSetColorBlendEquationEXT{};
     PFN_vkCmdWaitEvents vkCmdWaitEvents{};
+    PFN_vkCmdWriteTimestamp vkCmdWriteTimestamp{};
     PFN_vkCreateBuffer vkCreateBuffer{};
     PFN_vkCreateBufferView vkCreateBufferView{};
     PFN_vkCreateCommandPool vkCreateCommandPool{};
@@ -303,6 +308,7 @@ struct DeviceDispatch : InstanceDispatch {
     PFN_vkCreateSampler vkCreateSampler{};
     PFN_vkCreateSemaphore vkCreateSemaphore{};
     PFN_vkCreateShaderModule vkCreateShaderModule{};
+    PFN_vkCreateShadersEXT vkCreateShadersEXT{};
     PFN_vkCreateSwapchainKHR vkCreateSwapchainKHR{};
     PFN_vkDestroyBuffer vkDestroyBuffer{};
     PFN_vkDestroyBufferView vkDestroyBufferView{};
@@ -322,6 +328,7 @@ struct DeviceDispatch : InstanceDispatch {
     PFN_vkDestroyRenderPass vkDestroyRenderPass{};
     PFN_vkDestroySampler vkDestroySampler{};
     PFN_vkDestroySemaphore vkDestroySemaphore{};
+    PFN_vkDestroyShaderEXT vkDestroyShaderEXT{};
     PFN_vkDestroyShaderModule vkDestroyShaderModule{};
     PFN_vkDestroySwapchainKHR vkDestroySwapchainKHR{};
     PFN_vkDeviceWaitIdle vkDeviceWaitIdle{};
@@ -354,6 +361,7 @@ struct DeviceDispatch : InstanceDispatch {
     PFN_vkUpdateDescriptorSetWithTemplate vkUpdateDescriptorSetWithTemplate{};
     PFN_vkUpdateDescriptorSets vkUpdateDescriptorSets{};
     PFN_vkWaitForFences vkWaitForFences{};
+    PFN_vkWaitForPresentKHR vkWaitForPresentKHR{};
     PFN_vkWaitSemaphores vkWaitSemaphores{};
 };
 
@@ -388,6 +396,7 @@ void Destroy(VkDevice, VkRenderPass, const DeviceDispatch&) noexcept;
 void Destroy(VkDevice, VkSampler, const DeviceDispatch&) noexcept;
 void Destroy(VkDevice, VkSwapchainKHR, const DeviceDispatch&) noexcept;
 void Destroy(VkDevice, VkSemaphore, const DeviceDispatch&) noexcept;
+void Destroy(VkDevice, VkShaderEXT, const DeviceDispatch&) noexcept;
 void Destroy(VkDevice, VkShaderModule, const DeviceDispatch&) noexcept;
 void Destroy(VkInstance, VkDebugUtilsMessengerEXT, const InstanceDispatch&) noexcept;
 void Destroy(VkInstance, VkDebugReportCallbackEXT, const InstanceDispatch&) noexcept;
@@ -636,6 +645,7 @@ using PipelineLayout = Handle<VkPipelineLayout, VkDevice, DeviceDispatch>;
 using QueryPool = Handle<VkQueryPool, VkDevice, DeviceDispatch>;
 using RenderPass = Handle<VkRenderPass, VkDevice, DeviceDispatch>;
 using Sampler = Handle<VkSampler, VkDevice, DeviceDispatch>;
+using ShaderEXT = Handle<VkShaderEXT, VkDevice, DeviceDispatch>;
 using SurfaceKHR = Handle<VkSurfaceKHR, VkInstance, InstanceDispatch>;
 
 using DescriptorSets = PoolAllocations<VkDescriptorSet, VkDescriptorPool>;
@@ -1049,6 +1059,9 @@ public:
 
     [[nodiscard]] Sampler CreateSampler(const VkSamplerCreateInfo& ci) const;
 
+    /// Creates a single unlinked shader object from SPIR-V.
+    [[nodiscard]] ShaderEXT CreateShaderEXT(const VkShaderCreateInfoEXT& ci) const;
+
     [[nodiscard]] Framebuffer CreateFramebuffer(const VkFramebufferCreateInfo& ci) const;
 
     [[nodiscard]] CommandPool CreateCommandPool(const VkCommandPoolCreateInfo& ci) const;
@@ -1097,6 +1110,11 @@ public:
         return dld->vkDeviceWaitIdle(handle);
     }
 
+    VkResult WaitForPresentKHR(VkSwapchainKHR swapchain, u64 present_id,
+                               u64 timeout) const noexcept {
+        return dld->vkWaitForPresentKHR(handle, swapchain, present_id, timeout);
+    }
+
     void ResetQueryPool(VkQueryPool query_pool, u32 first, u32 count) const noexcept {
         dld->vkResetQueryPool(handle, query_pool, first, count);
     }
@@ -1186,6 +1204,14 @@ public:
         dld->vkCmdEndRenderPass(handle);
     }
 
+    void BeginRendering(const VkRenderingInfo& rendering_info) const noexcept {
+        dld->vkCmdBeginRendering(handle, &rendering_info);
+    }
+
+    void EndRendering() const noexcept {
+        dld->vkCmdEndRendering(handle);
+    }
+
     void BeginQuery(VkQueryPool query_pool, u32 query, VkQueryControlFlags flags) const noexcept {
         dld->vkCmdBeginQuery(handle, query_pool, query, flags);
     }
@@ -1214,6 +1240,11 @@ public:
         dld->vkCmdBindPipeline(handle, bind_point, pipeline);
     }
 
+    void BindShadersEXT(Span<VkShaderStageFlagBits> stages,
+                        Span<VkShaderEXT> shaders) const noexcept {
+        dld->vkCmdBindShadersEXT(handle, stages.size(), stages.data(), shaders.data());
+    }
+
     void BindIndexBuffer(VkBuffer buffer, VkDeviceSize offset,
                          VkIndexType index_type) const noexcept {
         dld->vkCmdBindIndexBuffer(handle, buffer, offset, index_type);
@@ -1269,6 +1300,12 @@ public:
                                            counter_buffer_offset, counter_offset, stride);
     }
 
+    void DrawMultiIndexedEXT(Span<VkMultiDrawIndexedInfoEXT> index_info, u32 instance_count,
+                             u32 first_instance) const noexcept {
+        dld->vkCmdDrawMultiIndexedEXT(handle, index_info.size(), index_info.data(), instance_count,
+                                      first_instance, sizeof(VkMultiDrawIndexedInfoEXT), nullptr);
+    }
+
     void ClearAttachments(Span<VkClearAttachment> attachments,
                           Span<VkClearRect> rects) const noexcept {
         dld->vkCmdClearAttachments(handle, attachments.size(), attachments.data(), rects.size(),
@@ -1503,6 +1540,11 @@ public:
                              buffer_barriers.data(), image_barriers.size(), image_barriers.data());
     }
 
+    void WriteTimestamp(VkPipelineStageFlagBits pipeline_stage, VkQueryPool query_pool,
+                        u32 query) const noexcept {
+        dld->vkCmdWriteTimestamp(handle, pipeline_stage, query_pool, query);
+    }
+
     void BindVertexBuffers2EXT(u32 first_binding, u32 binding_count, const VkBuffer* buffers,
                                const VkDeviceSize* offsets, const VkDeviceSize* sizes,
                                const VkDeviceSize* strides) const noexcept {
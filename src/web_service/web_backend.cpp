@@ -5,8 +5,11 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <array>
+#include <map>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
 
 #include <fmt/ranges.h>
 #include "common/httplib.h"
@@ -25,6 +28,55 @@ constexpr std::array<const char, 1> API_VERSION{'1'};
 
 constexpr std::size_t TIMEOUT_SECONDS = 30;
 
+constexpr std::size_t MAX_IDLE_CONNECTIONS_PER_HOST = 4;
+
+namespace {
+
+/**
+ * Keep-alive connections shared by all the clients of a host, so that the requests do not set up a
+ * new TCP connection and TLS session each time. Each request takes a connection of its own, so
+ * slow requests do not hold back the others.
+ */
+class ConnectionPool {
+public:
+    std::unique_ptr<httplib::Client> Acquire(const std::string& host) {
+        {
+            std::scoped_lock lock{mutex};
+            auto& idle = idle_connections[host];
+            if (!idle.empty()) {
+                auto cli = std::move(idle.back());
+                idle.pop_back();
+                return cli;
+            }
+        }
+        auto cli = std::make_unique<httplib::Client>(host.c_str());
+        cli->set_connection_timeout(TIMEOUT_SECONDS);
+        cli->set_read_timeout(TIMEOUT_SECONDS);
+        cli->set_write_timeout(TIMEOUT_SECONDS);
+        cli->set_keep_alive(true);
+#ifdef YUZU_BUNDLED_OPENSSL
+        cli->load_ca_cert_store(kCert, sizeof(kCert));
+#endif
+        return cli;
+    }
+
+    void Release(const std::string& host, std::unique_ptr<httplib::Client> cli) {
+        std::scoped_lock lock{mutex};
+        auto& idle = idle_connections[host];
+        if (idle.size() < MAX_IDLE_CONNECTIONS_PER_HOST) {
+            idle.push_back(std::move(cli));
+        }
+    }
+
+private:
+    std::mutex mutex;
+    std::map<std::string, std::vector<std::unique_ptr<httplib::Client>>> idle_connections;
+};
+
+ConnectionPool connection_pool;
+
+} // Anonymous namespace
+
 struct Client::Impl {
     Impl(std::string host_, std::string username_, std::string token_)
         : host{std::move(host_)}, username{std::move(username_)}, token{std::move(token_)} {
@@ -72,15 +124,7 @@ struct Client::Impl {
                              const std::string& data, const std::string& accept,
                              const std::string& jwt_ = "", const std::string& username_ = "",
                              const std::string& token_ = "") {
-        if (cli == nullptr) {
-            cli = std::make_unique<httplib::Client>(host.c_str());
-            cli->set_connection_timeout(TIMEOUT_SECONDS);
-            cli->set_read_timeout(TIMEOUT_SECONDS);
-            cli->set_write_timeout(TIMEOUT_SECONDS);
-#ifdef YUZU_BUNDLED_OPENSSL
-            cli->load_ca_cert_store(kCert, sizeof(kCert));
-#endif
-        }
+        auto cli = connection_pool.Acquire(host);
         if (!cli->is_valid()) {
             LOG_ERROR(WebService, "Invalid URL {}", host + path);
             return WebResult{WebResult::Code::InvalidURL, "Invalid URL", ""};
@@ -116,6 +160,8 @@ struct Client::Impl {
             LOG_ERROR(WebService, "{} to {} returned null", method, host + path);
             return WebResult{WebResult::Code::LibError, "Null response", ""};
         }
+        // The connection is only reused after a complete response
+        connection_pool.Release(host, std::move(cli));
 
         httplib::Response response = result.value();
 
@@ -161,7 +207,6 @@ struct Client::Impl {
     std::string username;
     std::string token;
     std::string jwt;
-    std::unique_ptr<httplib::Client> cli;
 
     struct JWTCache {
         std::mutex mutex;
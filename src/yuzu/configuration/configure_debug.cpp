@@ -100,6 +100,8 @@ void ConfigureDebug::SetConfiguration() {
         static_cast<int>(Settings::values.gpu_log_level.GetValue()));
     ui->gpu_log_shader_dumps->setEnabled(runtime_lock);
     ui->gpu_log_shader_dumps->setChecked(Settings::values.gpu_log_shader_dumps.GetValue());
+    ui->enable_hot_path_tracing->setEnabled(runtime_lock);
+    ui->enable_hot_path_tracing->setChecked(Settings::values.enable_hot_path_tracing.GetValue());
 #ifdef YUZU_USE_QT_WEB_ENGINE
     ui->disable_web_applet->setChecked(Settings::values.disable_web_applet.GetValue());
 #else
@@ -141,6 +143,7 @@ void ConfigureDebug::ApplyConfiguration() {
     Settings::values.serial_battery = ui->serial_battery_edit->text().toUInt();
     Settings::values.serial_unit = ui->serial_board_edit->text().toUInt();
     Settings::values.debug_knobs = ui->debug_knobs_spinbox->value();
+    Settings::values.enable_hot_path_tracing = ui->enable_hot_path_tracing->isChecked();
     Settings::values.gpu_log_level =
         static_cast<Settings::GpuLogLevel>(ui->gpu_log_level->currentIndex());
     Settings::values.gpu_log_shader_dumps = ui->gpu_log_shader_dumps->isChecked();
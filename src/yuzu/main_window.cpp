@@ -460,6 +460,8 @@ MainWindow::MainWindow(bool has_broken_vulkan)
     connect(&mouse_hide_timer, &QTimer::timeout, this, &MainWindow::HideMouseCursor);
     connect(ui->menubar, &QMenuBar::hovered, this, &MainWindow::ShowMouseCursor);
 
+    // Coarse timers can fire at the system tick rate instead, delaying every controller event
+    update_input_timer.setTimerType(Qt::PreciseTimer);
     update_input_timer.setInterval(default_input_update_timeout);
     connect(&update_input_timer, &QTimer::timeout, this, &MainWindow::UpdateInputDrivers);
     update_input_timer.start();
@@ -1005,9 +1007,18 @@ void MainWindow::InitializeWidgets() {
     emu_frametime_label->setToolTip(
         tr("Time taken to emulate a Switch frame, not counting framelimiting or v-sync. For "
            "full-speed emulation this should be at most 16.67 ms."));
+    audio_frametime_label = new QLabel();
+    audio_frametime_label->setToolTip(
+        tr("Time taken to render an audio frame, followed by the number of buffers queued in the "
+           "audio backend and the number of times it ran out of samples. For stutter free audio "
+           "a frame should take well under 5 ms."));
+    input_latency_label = new QLabel();
+    input_latency_label->setToolTip(
+        tr("Time taken by a controller input to reach the game, followed by the time until the "
+           "next frame was presented. Only counts the time spent in the emulator."));
 
     for (auto& label : {shader_building_label, res_scale_label, emu_speed_label, game_fps_label,
-                        emu_frametime_label}) {
+                        emu_frametime_label, audio_frametime_label, input_latency_label}) {
         label->setVisible(false);
         label->setFrameStyle(QFrame::NoFrame);
         label->setContentsMargins(4, 0, 4, 0);
@@ -2158,6 +2169,8 @@ void MainWindow::OnEmulationStopped() {
     emu_speed_label->setVisible(false);
     game_fps_label->setVisible(false);
     emu_frametime_label->setVisible(false);
+    audio_frametime_label->setVisible(false);
+    input_latency_label->setVisible(false);
     renderer_status_button->setEnabled(!UISettings::values.has_broken_vulkan);
     refresh_button->setEnabled(true);
 
@@ -4116,11 +4129,20 @@ void MainWindow::UpdateStatusBar() {
     game_fps_label->setText(fpsText);
 
     emu_frametime_label->setText(tr("Frame: %1 ms").arg(results.frametime * 1000.0, 0, 'f', 2));
+    audio_frametime_label->setText(tr("Audio: %1 ms | Queue: %2 | Underruns: %3")
+                                       .arg(results.audio_frametime * 1000.0, 0, 'f', 2)
+                                       .arg(results.audio_queue_depth)
+                                       .arg(results.audio_underruns));
+    input_latency_label->setText(tr("Input: %1 ms | To frame: %2 ms")
+                                     .arg(results.input_latency * 1000.0, 0, 'f', 2)
+                                     .arg(results.input_present_latency * 1000.0, 0, 'f', 2));
 
     res_scale_label->setVisible(true);
     emu_speed_label->setVisible(!Settings::values.use_multi_core.GetValue());
     game_fps_label->setVisible(true);
     emu_frametime_label->setVisible(true);
+    audio_frametime_label->setVisible(true);
+    input_latency_label->setVisible(true);
     firmware_label->setVisible(false);
 }
 
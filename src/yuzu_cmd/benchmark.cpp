@@ -0,0 +1,168 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <nlohmann/json.hpp>
+
+#include "common/fs/file.h"
+#include "common/fs/path_util.h"
+#include "common/logging.h"
+#include "core/core.h"
+#include "core/perf_stats.h"
+#include "yuzu_cmd/benchmark.h"
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr auto PollInterval = 50ms;
+
+/// Nearest rank percentile of sorted frametimes
+double Percentile(const std::vector<double>& sorted, double percentile) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    const auto rank = static_cast<size_t>(std::ceil(percentile / 100.0 * sorted.size()));
+    return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+}
+
+#ifdef __linux__
+/// CPU time of the threads of the process, summed by thread name. Emulator threads are named
+/// after what they run, so this splits the time by subsystem.
+std::map<std::string, double> GetThreadCpuTimes() {
+    std::map<std::string, double> times;
+    const double ticks_per_second = static_cast<double>(sysconf(_SC_CLK_TCK));
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator{"/proc/self/task", ec}) {
+        // procfs reports a size of zero, so the file can't be read by size
+        std::ifstream stat_file{entry.path() / "stat"};
+        std::string stat;
+        if (!std::getline(stat_file, stat)) {
+            continue;
+        }
+        // The name is in parentheses and can hold spaces, the fields after it are plain
+        const auto name_begin = stat.find('(');
+        const auto name_end = stat.rfind(')');
+        if (name_begin == std::string::npos || name_end == std::string::npos) {
+            continue;
+        }
+        // utime and stime are the 12th and 13th fields after the name
+        size_t field_begin = name_end + 2;
+        for (int field = 0; field < 11 && field_begin != std::string::npos; ++field) {
+            field_begin = stat.find(' ', field_begin);
+            if (field_begin != std::string::npos) {
+                ++field_begin;
+            }
+        }
+        if (field_begin == std::string::npos) {
+            continue;
+        }
+        char* next{};
+        const u64 utime = std::strtoull(stat.c_str() + field_begin, &next, 10);
+        const u64 stime = std::strtoull(next, nullptr, 10);
+        const auto name = stat.substr(name_begin + 1, name_end - name_begin - 1);
+        times[name] += static_cast<double>(utime + stime) / ticks_per_second;
+    }
+    return times;
+}
+#endif
+
+} // Anonymous namespace
+
+Benchmark::Benchmark(Core::System& system_, Limits limits_, std::function<void()> on_finished_)
+    : system{system_}, limits{limits_}, on_finished{std::move(on_finished_)} {}
+
+Benchmark::~Benchmark() = default;
+
+void Benchmark::Start() {
+    start_time = std::chrono::steady_clock::now();
+    start_frame = system.GetPerfStats().GetFrameCount();
+    watcher = std::jthread([this](std::stop_token stop_token) { Watch(stop_token); });
+}
+
+void Benchmark::Watch(std::stop_token stop_token) {
+    while (!stop_token.stop_requested()) {
+        std::this_thread::sleep_for(PollInterval);
+        const u64 frames = system.GetPerfStats().GetFrameCount() - start_frame;
+        const auto elapsed = std::chrono::steady_clock::now() - start_time;
+        if ((limits.frames && frames >= *limits.frames) ||
+            (limits.duration && elapsed >= *limits.duration)) {
+            LOG_INFO(Frontend, "Benchmark finished after {} frames", frames);
+            on_finished();
+            return;
+        }
+    }
+}
+
+std::string Benchmark::BuildReport() const {
+    const double seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+    std::vector<double> frametimes = system.GetPerfStats().GetFrametimes(start_frame);
+    const double mean =
+        frametimes.empty()
+            ? 0.0
+            : std::accumulate(frametimes.begin(), frametimes.end(), 0.0) / frametimes.size();
+    std::ranges::sort(frametimes);
+
+    nlohmann::json report;
+    report["program_id"] = fmt::format("{:016X}", system.GetApplicationProcessProgramID());
+    report["seconds"] = seconds;
+    report["frames"] = frametimes.size();
+    report["fps"] = seconds > 0.0 ? static_cast<double>(frametimes.size()) / seconds : 0.0;
+    report["frametime_ms"] = {
+        {"mean", mean},
+        {"p50", Percentile(frametimes, 50.0)},
+        {"p90", Percentile(frametimes, 90.0)},
+        {"p99", Percentile(frametimes, 99.0)},
+        {"max", frametimes.empty() ? 0.0 : frametimes.back()},
+    };
+#ifndef _WIN32
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+        const auto to_seconds = [](const timeval& time) {
+            return static_cast<double>(time.tv_sec) + static_cast<double>(time.tv_usec) / 1e6;
+        };
+        report["cpu_seconds"] = to_seconds(usage.ru_utime) + to_seconds(usage.ru_stime);
+#ifdef __APPLE__
+        report["peak_memory_bytes"] = static_cast<u64>(usage.ru_maxrss);
+#else
+        report["peak_memory_bytes"] = static_cast<u64>(usage.ru_maxrss) * 1024;
+#endif
+    }
+#endif
+#ifdef __linux__
+    report["thread_cpu_seconds"] = GetThreadCpuTimes();
+#endif
+    return report.dump(4);
+}
+
+bool Benchmark::WriteReport(const std::filesystem::path& path) const {
+    const std::string report = BuildReport();
+    if (path.empty()) {
+        std::cout << report << std::endl;
+        return true;
+    }
+    Common::FS::IOFile file{path, Common::FS::FileAccessMode::Write,
+                            Common::FS::FileType::TextFile};
+    if (!file.IsOpen() || file.WriteString(report) != report.size()) {
+        LOG_ERROR(Frontend, "Failed to write the benchmark report to {}",
+                  Common::FS::PathToUTF8String(path));
+        return false;
+    }
+    return true;
+}
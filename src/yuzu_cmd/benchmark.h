@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <thread>
+
+#include "common/common_types.h"
+
+namespace Core {
+class System;
+}
+
+/**
+ * Runs the emulation for a fixed number of frames or a fixed amount of time, then reports its
+ * performance as JSON. Meant for automated runs, usually with the null renderer and a TAS script
+ * providing the input.
+ */
+class Benchmark {
+public:
+    struct Limits {
+        /// Frames to present before finishing
+        std::optional<u64> frames;
+        /// Walltime to run for before finishing
+        std::optional<std::chrono::seconds> duration;
+    };
+
+    explicit Benchmark(Core::System& system_, Limits limits_, std::function<void()> on_finished_);
+    ~Benchmark();
+
+    /// Starts measuring, the emulation must be running
+    void Start();
+
+    /// Writes the report to the given file, or to stdout when the path is empty
+    bool WriteReport(const std::filesystem::path& path) const;
+
+private:
+    void Watch(std::stop_token stop_token);
+
+    [[nodiscard]] std::string BuildReport() const;
+
+    Core::System& system;
+    Limits limits;
+    std::function<void()> on_finished;
+
+    std::chrono::steady_clock::time_point start_time{};
+    std::size_t start_frame{};
+    std::jthread watcher;
+};
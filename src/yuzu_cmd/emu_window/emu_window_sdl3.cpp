@@ -14,6 +14,7 @@
 #include "hid_core/hid_core.h"
 #include "input_common/drivers/keyboard.h"
 #include "input_common/drivers/mouse.h"
+#include "input_common/drivers/tas_input.h"
 #include "input_common/drivers/touch_screen.h"
 #include "input_common/main.h"
 #include "yuzu_cmd/emu_window/emu_window_sdl3.h"
@@ -111,6 +112,16 @@ bool EmuWindow_SDL3::IsShown() const {
     return is_shown;
 }
 
+void EmuWindow_SDL3::RequestClose() {
+    SDL_Event event{};
+    event.type = SDL_EVENT_QUIT;
+    SDL_PushEvent(&event);
+}
+
+void EmuWindow_SDL3::OnFrameDisplayed() {
+    input_subsystem->GetTas()->UpdateThread();
+}
+
 void EmuWindow_SDL3::OnResize() {
     int width, height;
     SDL_GetWindowSizeInPixels(render_window, &width, &height);
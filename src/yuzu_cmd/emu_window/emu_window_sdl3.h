@@ -37,6 +37,12 @@ public:
     /// Wait for the next event on the main thread.
     void WaitEvent();
 
+    /// Asks WaitEvent to close the window, can be called from any thread
+    void RequestClose();
+
+    /// Advances the TAS playback, called by the renderer after presenting a frame
+    void OnFrameDisplayed() override;
+
     // Sets the window icon from yuzu.bmp
     void SetWindowIcon();
 
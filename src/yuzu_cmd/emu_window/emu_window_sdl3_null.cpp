@@ -24,18 +24,19 @@
 #include <SDL3/SDL.h>
 
 EmuWindow_SDL3_Null::EmuWindow_SDL3_Null(InputCommon::InputSubsystem* input_subsystem_,
-                                         Core::System& system_, bool fullscreen)
+                                         Core::System& system_, bool fullscreen, bool hidden)
     : EmuWindow_SDL3{input_subsystem_, system_} {
     const std::string window_title = fmt::format("Eden {} | {}-{} (Vulkan)", Common::g_build_name,
                                                  Common::g_scm_branch, Common::g_scm_desc);
-    render_window =
-        SDL_CreateWindow(window_title.c_str(), Layout::ScreenUndocked::Width,
-                         Layout::ScreenUndocked::Height,
-                         SDL_WINDOW_RESIZABLE | SDL_WINDOW_HIGH_PIXEL_DENSITY);
+    // Nothing is presented, a hidden window still delivers the events the frontend relies on
+    const SDL_WindowFlags flags = SDL_WINDOW_RESIZABLE | SDL_WINDOW_HIGH_PIXEL_DENSITY |
+                                  (hidden ? SDL_WINDOW_HIDDEN : 0);
+    render_window = SDL_CreateWindow(window_title.c_str(), Layout::ScreenUndocked::Width,
+                                     Layout::ScreenUndocked::Height, flags);
 
     SetWindowIcon();
 
-    if (fullscreen) {
+    if (fullscreen && !hidden) {
         Fullscreen();
         ShowCursor(false);
     }
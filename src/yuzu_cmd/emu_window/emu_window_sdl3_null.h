@@ -22,7 +22,7 @@ class InputSubsystem;
 class EmuWindow_SDL3_Null final : public EmuWindow_SDL3 {
 public:
     explicit EmuWindow_SDL3_Null(InputCommon::InputSubsystem* input_subsystem_,
-                                 Core::System& system, bool fullscreen);
+                                 Core::System& system, bool fullscreen, bool hidden);
     ~EmuWindow_SDL3_Null() override;
 
     std::unique_ptr<Core::Frontend::GraphicsContext> CreateSharedContext() const override;
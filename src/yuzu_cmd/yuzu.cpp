@@ -11,6 +11,7 @@
 
 #include <fmt/ostream.h>
 
+#include "common/fs/path_util.h"
 #include "common/logging.h"
 #include "common/scm_rev.h"
 #include "common/settings.h"
@@ -25,10 +26,12 @@
 #include "core/hle/service/filesystem/filesystem.h"
 #include "core/loader/loader.h"
 #include "frontend_common/config.h"
+#include "input_common/drivers/tas_input.h"
 #include "input_common/main.h"
 #include "network/network.h"
 #include "sdl_config.h"
 #include "video_core/renderer_base.h"
+#include "yuzu_cmd/benchmark.h"
 #include "yuzu_cmd/emu_window/emu_window_sdl3.h"
 #ifdef HAS_OPENGL
 #include "yuzu_cmd/emu_window/emu_window_sdl3_gl.h"
@@ -63,13 +66,19 @@ __declspec(dllexport) int AmdPowerXpressRequestHighPerformance = 1;
 static void PrintHelp(const char* argv0) {
     std::cout << "Usage: " << argv0
               << " [options] <filename>\n"
+                 "-b, --benchmark-frames=N Exit after N frames and report the performance\n"
+                 "-s, --benchmark-seconds=T Exit after T seconds and report the performance\n"
+                 "-o, --benchmark-output Write the benchmark report to a file instead of stdout\n"
                  "-c, --config          Load the specified configuration file\n"
                  "-f, --fullscreen      Start in fullscreen mode\n"
                  "-g, --game            File path of the game to load\n"
                  "-h, --help            Display this help and exit\n"
+                 "-l, --decode-log      Print a binary log as text and exit\n"
+                 "-n, --headless        Use the null renderer with a hidden window\n"
                  "-m, --multiplayer=nick:password@address:port"
                  " Nickname, password, address and port for multiplayer\n"
                  "-p, --program         Pass following string as arguments to executable\n"
+                 "-t, --tas             Play the TAS scripts from the start\n"
                  "-u, --user            Select a specific user profile from 0 to 7\n"
                  "-d, --debug           Run the GDB stub on a port from 1 to 65535\n"
                  "-v, --version         Output version information and exit\n";
@@ -209,6 +218,10 @@ int main(int argc, char** argv) {
     std::string address{};
     std::string input_profile{};
     u16 port = Network::DefaultRoomPort;
+    bool headless = false;
+    bool play_tas = false;
+    Benchmark::Limits benchmark_limits{};
+    std::filesystem::path benchmark_output{};
 
     static struct option long_options[] = {
         // clang-format off
@@ -216,18 +229,25 @@ int main(int argc, char** argv) {
         {"config", required_argument, 0, 'c'},
         {"fullscreen", no_argument, 0, 'f'},
         {"help", no_argument, 0, 'h'},
+        {"decode-log", required_argument, 0, 'l'},
         {"game", required_argument, 0, 'g'},
         {"multiplayer", required_argument, 0, 'm'},
         {"program", optional_argument, 0, 'p'},
         {"user", required_argument, 0, 'u'},
         {"version", no_argument, 0, 'v'},
         {"input-profile", no_argument, 0, 'i'},
+        {"benchmark-frames", required_argument, 0, 'b'},
+        {"benchmark-seconds", required_argument, 0, 's'},
+        {"benchmark-output", required_argument, 0, 'o'},
+        {"headless", no_argument, 0, 'n'},
+        {"tas", no_argument, 0, 't'},
         {0, 0, 0, 0},
         // clang-format on
     };
 
     while (optind < argc) {
-        int arg = getopt_long(argc, argv, "g:fhvcip::c:u:d:", long_options, &option_index);
+        int arg = getopt_long(argc, argv, "g:fhvcip::c:u:d:l:b:s:o:nt", long_options,
+                              &option_index);
         if (arg != -1) {
             switch (char(arg)) {
             case 'd':
@@ -236,6 +256,21 @@ int main(int argc, char** argv) {
             case 'c':
                 config_path = optarg;
                 break;
+            case 'b':
+                benchmark_limits.frames = std::strtoull(optarg, nullptr, 10);
+                break;
+            case 's':
+                benchmark_limits.duration = std::chrono::seconds{std::strtoll(optarg, nullptr, 10)};
+                break;
+            case 'o':
+                benchmark_output = Common::FS::ToU8String(optarg);
+                break;
+            case 'n':
+                headless = true;
+                break;
+            case 't':
+                play_tas = true;
+                break;
             case 'f':
                 fullscreen = true;
                 LOG_INFO(Frontend, "Starting in fullscreen mode...");
@@ -243,6 +278,20 @@ int main(int argc, char** argv) {
             case 'h':
                 PrintHelp(argv[0]);
                 return 0;
+            case 'l': {
+                std::FILE* file = std::fopen(optarg, "rb");
+                if (file == nullptr) {
+                    std::cout << "Could not open " << optarg << "\n";
+                    return 1;
+                }
+                const bool is_decoded = Common::Log::DecodeBinaryLog(file, stdout);
+                std::fclose(file);
+                if (!is_decoded) {
+                    std::cout << optarg << " is not a binary log or is truncated\n";
+                    return 1;
+                }
+                return 0;
+            }
             case 'g':
                 filepath = std::string(optarg);
                 break;
@@ -311,6 +360,7 @@ int main(int argc, char** argv) {
     Common::Log::Filter filter;
     filter.ParseFilterString(Settings::values.log_filter.GetValue());
     Common::Log::SetGlobalFilter(filter);
+    Common::Log::SetBinaryBackendEnabled(Settings::values.log_binary.GetValue());
 
     if (!program_args.empty()) {
         Settings::values.program_args = program_args;
@@ -325,6 +375,14 @@ int main(int argc, char** argv) {
         Settings::values.current_user = std::clamp(*selected_user, 0, 7);
     }
 
+    if (headless) {
+        Settings::values.renderer_backend = Settings::RendererBackend::Null;
+    }
+
+    if (play_tas) {
+        Settings::values.tas_enable = true;
+    }
+
     if (override_gdb_port.has_value()) {
         Settings::values.use_gdbstub = true;
         Settings::values.gdbstub_port = *override_gdb_port;
@@ -360,7 +418,8 @@ int main(int argc, char** argv) {
         emu_window = std::make_unique<EmuWindow_SDL3_VK>(&input_subsystem, system, fullscreen);
         break;
     case Settings::RendererBackend::Null:
-        emu_window = std::make_unique<EmuWindow_SDL3_Null>(&input_subsystem, system, fullscreen);
+        emu_window =
+            std::make_unique<EmuWindow_SDL3_Null>(&input_subsystem, system, fullscreen, headless);
         break;
     default:
         LOG_CRITICAL(Frontend, "Invalid renderer backend");
@@ -440,17 +499,31 @@ int main(int argc, char** argv) {
         // Just exit right away.
         exit(0);
     });
+    std::optional<Benchmark> benchmark;
+    if (benchmark_limits.frames || benchmark_limits.duration) {
+        benchmark.emplace(system, benchmark_limits, [&] { emu_window->RequestClose(); });
+    }
+
     void(system.Run());
     if (system.DebuggerEnabled()) {
         system.InitializeDebugger();
     }
+    if (play_tas) {
+        input_subsystem.GetTas()->StartStop();
+    }
+    if (benchmark) {
+        benchmark->Start();
+    }
     while (emu_window->IsOpen()) {
         emu_window->WaitEvent();
     }
     system.DetachDebugger();
     void(system.Pause());
+    // Stops the watcher before it can outlive the window
+    const bool report_written = !benchmark || benchmark->WriteReport(benchmark_output);
+    benchmark.reset();
     system.ShutdownMainProcess();
-    return 0;
+    return report_written ? 0 : 1;
 }
 
 #define VMA_IMPLEMENTATION
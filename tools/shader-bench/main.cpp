@@ -0,0 +1,299 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "common/common_types.h"
+#include "common/trace.h"
+#include "shader_recompiler/backend/glasm/emit_glasm.h"
+#include "shader_recompiler/backend/glsl/emit_glsl.h"
+#include "shader_recompiler/backend/spirv/emit_spirv.h"
+#include "shader_recompiler/exception.h"
+#include "shader_recompiler/frontend/ir/basic_block.h"
+#include "shader_recompiler/frontend/maxwell/control_flow.h"
+#include "shader_recompiler/frontend/maxwell/translate_program.h"
+#include "shader_recompiler/host_translate_info.h"
+#include "shader_recompiler/object_pool.h"
+#include "shader_recompiler/profile.h"
+#include "shader_recompiler/program_header.h"
+#include "video_core/shader_environment.h"
+
+namespace {
+
+enum class Backend {
+    SPIRV,
+    GLSL,
+    GLASM,
+};
+
+struct PhaseTime {
+    u64 count{};
+    u64 total_ns{};
+};
+
+struct Statistics {
+    std::map<std::string, PhaseTime> phases;
+    u64 num_shaders{};
+    u64 num_failures{};
+    u64 ir_instructions{};
+    u64 output_bytes{};
+
+    void Add(std::string_view phase, u64 duration_ns) {
+        PhaseTime& time{phases[std::string(phase)]};
+        ++time.count;
+        time.total_ns += duration_ns;
+    }
+
+    void Merge(const Statistics& other) {
+        for (const auto& [phase, time] : other.phases) {
+            PhaseTime& merged{phases[phase]};
+            merged.count += time.count;
+            merged.total_ns += time.total_ns;
+        }
+        num_shaders += other.num_shaders;
+        num_failures += other.num_failures;
+        ir_instructions += other.ir_instructions;
+        output_bytes += other.output_bytes;
+    }
+};
+
+u64 NowNs() {
+    return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::steady_clock::now().time_since_epoch())
+                                .count());
+}
+
+Shader::HostTranslateInfo MakeHostInfo() {
+    Shader::HostTranslateInfo host_info;
+    host_info.support_float64 = true;
+    host_info.support_float16 = true;
+    host_info.support_int64 = true;
+    host_info.needs_demote_reorder = false;
+    host_info.support_snorm_render_buffer = true;
+    host_info.support_viewport_index_layer = true;
+    host_info.support_geometry_shader_passthrough = false;
+    host_info.support_conditional_barrier = true;
+    host_info.min_ssbo_alignment = 16;
+    host_info.ApplyDescriptorLimitPolicy();
+    return host_info;
+}
+
+size_t EmitProgram(Backend backend, const Shader::Profile& profile, Shader::IR::Program& program) {
+    const Shader::RuntimeInfo runtime_info{};
+    switch (backend) {
+    case Backend::SPIRV: {
+        Shader::Backend::Bindings bindings;
+        return Shader::Backend::SPIRV::EmitSPIRV(profile, runtime_info, program, bindings).size() *
+               sizeof(u32);
+    }
+    case Backend::GLSL: {
+        Shader::Backend::Bindings bindings;
+        return Shader::Backend::GLSL::EmitGLSL(profile, runtime_info, program, bindings).size();
+    }
+    case Backend::GLASM: {
+        Shader::Backend::Bindings bindings;
+        return Shader::Backend::GLASM::EmitGLASM(profile, runtime_info, program, bindings).size();
+    }
+    }
+    return 0;
+}
+
+void CompileShader(VideoCommon::FileEnvironment& env, Backend backend,
+                   const Shader::Profile& profile, const Shader::HostTranslateInfo& host_info,
+                   Statistics& stats) {
+    Shader::ObjectPool<Shader::Maxwell::Flow::Block> flow_block_pool;
+    Shader::ObjectPool<Shader::IR::Inst> inst_pool;
+    Shader::ObjectPool<Shader::IR::Block> block_pool;
+
+    const bool is_compute{env.ShaderStage() == Shader::Stage::Compute};
+    const u32 cfg_offset{env.StartAddress() +
+                         (is_compute ? 0 : static_cast<u32>(sizeof(Shader::ProgramHeader)))};
+    try {
+        const u64 cfg_begin{NowNs()};
+        const bool exits_to_dispatcher{env.ShaderStage() == Shader::Stage::VertexA};
+        Shader::Maxwell::Flow::CFG cfg(env, flow_block_pool, cfg_offset, exits_to_dispatcher);
+        const u64 translate_begin{NowNs()};
+        Shader::IR::Program program{
+            Shader::Maxwell::TranslateProgram(inst_pool, block_pool, env, cfg, host_info)};
+        const u64 emit_begin{NowNs()};
+        // Vertex A programs are only emitted after being merged with their vertex B program
+        if (env.ShaderStage() != Shader::Stage::VertexA) {
+            stats.output_bytes += EmitProgram(backend, profile, program);
+        }
+        const u64 emit_end{NowNs()};
+
+        stats.Add("ControlFlow", translate_begin - cfg_begin);
+        stats.Add("TranslateProgram", emit_begin - translate_begin);
+        stats.Add("Emit", emit_end - emit_begin);
+        for (const Shader::IR::Block* const block : program.blocks) {
+            stats.ir_instructions += block->size();
+        }
+        ++stats.num_shaders;
+    } catch (const Shader::Exception& exception) {
+        std::fprintf(stderr, "Shader at 0x%08x failed: %s\n", env.StartAddress(),
+                     exception.what());
+        ++stats.num_failures;
+    }
+    // Every optimization pass records a trace event, gather them as per pass timings
+    Common::Trace::ConsumeThreadEvents([&stats](const char* name, u64 duration_ns) {
+        stats.Add(name, duration_ns);
+    });
+}
+
+bool LoadCache(const std::filesystem::path& path, std::vector<VideoCommon::FileEnvironment>& envs) {
+    // Loading removes files it considers invalid, work on a copy to leave the input untouched
+    const std::filesystem::path copy_path{std::filesystem::temp_directory_path() /
+                                          "shader-bench-cache.bin"};
+    std::error_code error;
+    std::filesystem::copy_file(path, copy_path, std::filesystem::copy_options::overwrite_existing,
+                               error);
+    if (error) {
+        std::fprintf(stderr, "Failed to copy %s: %s\n", path.string().c_str(),
+                     error.message().c_str());
+        return false;
+    }
+    u32 cache_version{};
+    {
+        std::ifstream file(copy_path, std::ios::binary);
+        std::array<char, 8> magic_number{};
+        file.read(magic_number.data(), magic_number.size())
+            .read(reinterpret_cast<char*>(&cache_version), sizeof(cache_version));
+        if (!file || std::string_view(magic_number.data(), magic_number.size()) != "yuzucach") {
+            std::fprintf(stderr, "%s is not a pipeline cache file\n", path.string().c_str());
+            return false;
+        }
+    }
+    VideoCommon::LoadPipelines(
+        std::stop_token{}, copy_path, cache_version,
+        [&envs](std::istream&, VideoCommon::FileEnvironment env) {
+            envs.push_back(std::move(env));
+        },
+        [&envs](std::istream&, std::vector<VideoCommon::FileEnvironment> pipeline_envs) {
+            for (VideoCommon::FileEnvironment& env : pipeline_envs) {
+                envs.push_back(std::move(env));
+            }
+        });
+    std::filesystem::remove(copy_path, error);
+    return true;
+}
+
+void PrintReport(const Statistics& stats, u64 wall_ns, size_t num_threads) {
+    std::printf("%llu shaders (%llu failed) on %zu threads in %.3f ms\n",
+                static_cast<unsigned long long>(stats.num_shaders),
+                static_cast<unsigned long long>(stats.num_failures), num_threads,
+                static_cast<double>(wall_ns) / 1e6);
+    if (stats.num_shaders > 0) {
+        std::printf("%.1f shaders/s, %llu IR instructions, %llu output bytes\n",
+                    static_cast<double>(stats.num_shaders) * 1e9 / static_cast<double>(wall_ns),
+                    static_cast<unsigned long long>(stats.ir_instructions),
+                    static_cast<unsigned long long>(stats.output_bytes));
+    }
+    std::vector<std::pair<std::string, PhaseTime>> phases(stats.phases.begin(),
+                                                          stats.phases.end());
+    std::ranges::sort(phases, [](const auto& lhs, const auto& rhs) {
+        return lhs.second.total_ns > rhs.second.total_ns;
+    });
+    std::printf("\n%-36s %10s %14s %12s\n", "phase", "count", "total (ms)", "avg (us)");
+    for (const auto& [phase, time] : phases) {
+        std::printf("%-36s %10llu %14.3f %12.3f\n", phase.c_str(),
+                    static_cast<unsigned long long>(time.count),
+                    static_cast<double>(time.total_ns) / 1e6,
+                    static_cast<double>(time.total_ns) / 1e3 / static_cast<double>(time.count));
+    }
+}
+
+void PrintUsage(const char* program) {
+    std::printf("usage: %s [pipeline cache file] [options]\n"
+                "  -j <threads>   Compile across this many threads (default 1)\n"
+                "  -b <backend>   spirv, glsl or glasm (default spirv)\n"
+                "  -r <repeats>   Compile every shader this many times (default 1)\n",
+                program);
+}
+
+} // Anonymous namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        PrintUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    size_t num_threads{1};
+    size_t num_repeats{1};
+    Backend backend{Backend::SPIRV};
+    for (int i = 2; i < argc; ++i) {
+        const std::string_view arg{argv[i]};
+        if (i + 1 >= argc) {
+            PrintUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        const std::string_view value{argv[++i]};
+        if (arg == "-j") {
+            num_threads = (std::max)(std::strtoull(value.data(), nullptr, 10), 1ULL);
+        } else if (arg == "-r") {
+            num_repeats = (std::max)(std::strtoull(value.data(), nullptr, 10), 1ULL);
+        } else if (arg == "-b" && value == "spirv") {
+            backend = Backend::SPIRV;
+        } else if (arg == "-b" && value == "glsl") {
+            backend = Backend::GLSL;
+        } else if (arg == "-b" && value == "glasm") {
+            backend = Backend::GLASM;
+        } else {
+            PrintUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::vector<VideoCommon::FileEnvironment> envs;
+    if (!LoadCache(argv[1], envs)) {
+        return EXIT_FAILURE;
+    }
+    std::printf("Loaded %zu shaders from %s\n", envs.size(), argv[1]);
+
+    const Shader::Profile profile{
+        .supported_spirv = 0x00010400,
+        .unified_descriptor_binding = backend == Backend::SPIRV,
+        .support_int64 = true,
+    };
+    const Shader::HostTranslateInfo host_info{MakeHostInfo()};
+
+    Common::Trace::SetEnabled(true);
+    std::vector<Statistics> thread_stats(num_threads);
+    std::atomic<size_t> next_env{0};
+    const u64 wall_begin{NowNs()};
+    {
+        std::vector<std::jthread> threads;
+        for (size_t thread = 0; thread < num_threads; ++thread) {
+            threads.emplace_back([&, thread] {
+                // Environments cache the values they read, keep each one on a single thread
+                for (size_t index = next_env++; index < envs.size(); index = next_env++) {
+                    for (size_t repeat = 0; repeat < num_repeats; ++repeat) {
+                        CompileShader(envs[index], backend, profile, host_info,
+                                      thread_stats[thread]);
+                    }
+                }
+            });
+        }
+    }
+    const u64 wall_ns{NowNs() - wall_begin};
+    Common::Trace::SetEnabled(false);
+
+    Statistics stats;
+    for (const Statistics& thread_stat : thread_stats) {
+        stats.Merge(thread_stat);
+    }
+    PrintReport(stats, wall_ns, num_threads);
+    return stats.num_failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}